@@ -27,6 +27,7 @@
  */
 
 #include <math.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
@@ -471,7 +472,7 @@ void common_hal_bleio_adapter_set_name(bleio_adapter_obj_t *self, const char *na
 //     return true;
 // }
 
-mp_obj_t common_hal_bleio_adapter_start_scan(bleio_adapter_obj_t *self, uint8_t *prefixes, size_t prefix_length, bool extended, mp_int_t buffer_size, mp_float_t timeout, mp_float_t interval, mp_float_t window, mp_int_t minimum_rssi, bool active) {
+mp_obj_t common_hal_bleio_adapter_start_scan(bleio_adapter_obj_t *self, uint8_t *prefixes, size_t prefix_length, bool extended, mp_int_t buffer_size, mp_float_t timeout, mp_float_t interval, mp_float_t window, mp_int_t minimum_rssi, bool active, const bleio_scan_filter_t *filter) {
     // TODO
     mp_raise_NotImplementedError(NULL);
     check_enabled(self);
@@ -482,7 +483,7 @@ mp_obj_t common_hal_bleio_adapter_start_scan(bleio_adapter_obj_t *self, uint8_t
         }
         self->scan_results = NULL;
     }
-    self->scan_results = shared_module_bleio_new_scanresults(buffer_size, prefixes, prefix_length, minimum_rssi);
+    self->scan_results = shared_module_bleio_new_scanresults(buffer_size, prefixes, prefix_length, minimum_rssi, filter);
 
     // size_t max_packet_size = extended ? BLE_GAP_SCAN_BUFFER_EXTENDED_MAX_SUPPORTED : BLE_GAP_SCAN_BUFFER_MAX;
     // uint8_t *raw_data = m_malloc(sizeof(ble_data_t) + max_packet_size);
@@ -946,9 +947,33 @@ uint16_t bleio_adapter_max_attribute_handle(bleio_adapter_obj_t *adapter) {
 }
 
 
-void bleio_adapter_gc_collect(bleio_adapter_obj_t *adapter) {
-    gc_collect_root((void **)adapter, sizeof(bleio_adapter_obj_t) / (sizeof(size_t)));
-    gc_collect_root((void **)bleio_connections, sizeof(bleio_connections) / (sizeof(size_t)));
+// Only these fields can point into the heap, so nothing else in the structs is traced.
+STATIC const uint16_t adapter_root_offsets[] = {
+    offsetof(bleio_adapter_obj_t, scan_results),
+    offsetof(bleio_adapter_obj_t, name),
+    offsetof(bleio_adapter_obj_t, connection_objs),
+    offsetof(bleio_adapter_obj_t, hci_uart),
+    offsetof(bleio_adapter_obj_t, rts_digitalinout),
+    offsetof(bleio_adapter_obj_t, cts_digitalinout),
+    offsetof(bleio_adapter_obj_t, device_name_characteristic),
+    offsetof(bleio_adapter_obj_t, appearance_characteristic),
+    offsetof(bleio_adapter_obj_t, service_changed_characteristic),
+    offsetof(bleio_adapter_obj_t, attributes),
+};
+
+STATIC gc_root_t adapter_root = GC_ROOT(&common_hal_bleio_adapter_obj, bleio_adapter_obj_t, 1, adapter_root_offsets);
+
+STATIC const uint16_t connections_root_offsets[] = {
+    offsetof(bleio_connection_internal_t, remote_service_list),
+    offsetof(bleio_connection_internal_t, connection_obj),
+};
+
+STATIC gc_root_t connections_root = GC_ROOT(bleio_connections, bleio_connection_internal_t,
+    BLEIO_TOTAL_CONNECTION_COUNT, connections_root_offsets);
+
+void bleio_adapter_register_gc_roots(void) {
+    gc_root_register(&adapter_root);
+    gc_root_register(&connections_root);
 }
 
 void bleio_adapter_reset(bleio_adapter_obj_t *adapter) {
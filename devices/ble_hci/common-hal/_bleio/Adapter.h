@@ -93,7 +93,7 @@ void bleio_adapter_advertising_was_stopped(bleio_adapter_obj_t *self);
 mp_obj_t *bleio_adapter_get_attribute(bleio_adapter_obj_t *adapter, uint16_t handle);
 uint16_t bleio_adapter_max_attribute_handle(bleio_adapter_obj_t *adapter);
 void bleio_adapter_background(bleio_adapter_obj_t *adapter);
-void bleio_adapter_gc_collect(bleio_adapter_obj_t *adapter);
+void bleio_adapter_register_gc_roots(void);
 void bleio_adapter_reset(bleio_adapter_obj_t *adapter);
 
 #endif // MICROPY_INCLUDED_BLE_HCI_COMMON_HAL_ADAPTER_H
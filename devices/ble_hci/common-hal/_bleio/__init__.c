@@ -107,8 +107,8 @@ void common_hal_bleio_check_connected(uint16_t conn_handle) {
     }
 }
 
-void common_hal_bleio_gc_collect(void) {
-    bleio_adapter_gc_collect(&common_hal_bleio_adapter_obj);
+void common_hal_bleio_register_gc_roots(void) {
+    bleio_adapter_register_gc_roots();
 }
 
 
@@ -28,6 +28,8 @@
 #include "py/smallint.h"
 #include "py/pairheap.h"
 #include "py/mphal.h"
+// CIRCUITPY-CHANGE
+#include "py/stream.h"
 
 #if MICROPY_PY_ASYNCIO
 
@@ -340,6 +342,184 @@ STATIC MP_DEFINE_CONST_OBJ_TYPE(
     iter, &task_getiter_iternext
     );
 
+/******************************************************************************/
+// CIRCUITPY-CHANGE: Event loop
+//
+// These mirror run_until_complete() and IOQueue.wait_io_event() in asyncio.core,
+// working on the same globals (cur_task, _task_queue, _io_queue) so that the
+// scheduler does not have to go through the bytecode interpreter.
+
+STATIC mp_obj_t asyncio_context_get(qstr name) {
+    return mp_obj_dict_get(asyncio_context, MP_OBJ_NEW_QSTR(name));
+}
+
+STATIC void asyncio_call_method(mp_obj_t obj, qstr name, size_t n_args, const mp_obj_t *args) {
+    mp_obj_t dest[4];
+    assert(n_args <= 2);
+    mp_load_method(obj, name, dest);
+    for (size_t i = 0; i < n_args; i++) {
+        dest[2 + i] = args[i];
+    }
+    mp_call_method_n_kw(n_args, 0, dest);
+}
+
+STATIC void io_queue_wait_io_event(mp_obj_t io_queue, mp_obj_t task_queue, mp_int_t dt) {
+    mp_obj_t poller = mp_load_attr(io_queue, MP_QSTR_poller);
+    mp_obj_t map = mp_load_attr(io_queue, MP_QSTR_map);
+    mp_obj_t dest[3];
+    mp_load_method(poller, MP_QSTR_ipoll, dest);
+    dest[2] = MP_OBJ_NEW_SMALL_INT(dt);
+    mp_obj_t iter = mp_getiter(mp_call_method_n_kw(1, 0, dest), NULL);
+    mp_obj_t item;
+    while ((item = mp_iternext(iter)) != MP_OBJ_STOP_ITERATION) {
+        mp_obj_t *s_ev;
+        mp_obj_get_array_fixed_n(item, 2, &s_ev);
+        mp_obj_t s = s_ev[0];
+        mp_int_t ev = mp_obj_get_int(s_ev[1]);
+        // The map entry is the list [reader_task, writer_task, stream].
+        mp_obj_t *sm;
+        mp_obj_get_array_fixed_n(mp_obj_dict_get(map, mp_obj_id(s)), 3, &sm);
+        mp_obj_t push_args[2] = { task_queue, MP_OBJ_NULL };
+        if ((ev & ~MP_STREAM_POLL_WR) && sm[0] != mp_const_none) {
+            // POLLIN or error
+            push_args[1] = sm[0];
+            task_queue_push(2, push_args);
+            sm[0] = mp_const_none;
+        }
+        if ((ev & ~MP_STREAM_POLL_RD) && sm[1] != mp_const_none) {
+            // POLLOUT or error
+            push_args[1] = sm[1];
+            task_queue_push(2, push_args);
+            sm[1] = mp_const_none;
+        }
+        if (sm[0] == mp_const_none && sm[1] == mp_const_none) {
+            asyncio_call_method(io_queue, MP_QSTR__dequeue, 1, &s);
+        } else {
+            mp_obj_t modify_args[2] = { s, MP_OBJ_NEW_SMALL_INT(sm[0] == mp_const_none ? MP_STREAM_POLL_WR : MP_STREAM_POLL_RD) };
+            asyncio_call_method(poller, MP_QSTR_modify, 2, modify_args);
+        }
+    }
+}
+
+STATIC mp_obj_t asyncio_run_until_complete(size_t n_args, const mp_obj_t *args) {
+    mp_obj_t main_task = n_args > 0 ? args[0] : mp_const_none;
+    if (asyncio_context == MP_OBJ_NULL) {
+        // No Task has been created yet, so there is nothing to run.
+        return mp_const_none;
+    }
+    mp_obj_t cancelled_error = asyncio_context_get(MP_QSTR_CancelledError);
+    for (;;) {
+        mp_obj_t task_queue = asyncio_context_get(MP_QSTR__task_queue);
+        mp_obj_t io_queue = asyncio_context_get(MP_QSTR__io_queue);
+
+        // Wait until the head of _task_queue is ready to run.
+        mp_int_t dt = 1;
+        while (dt > 0) {
+            dt = -1;
+            mp_obj_task_queue_t *queue = MP_OBJ_TO_PTR(task_queue);
+            bool have_io = mp_obj_is_true(mp_load_attr(io_queue, MP_QSTR_map));
+            if (queue->heap != NULL) {
+                // The time to schedule the task at is its ph_key.
+                dt = ticks_diff(queue->heap->ph_key, ticks());
+                if (dt < 0) {
+                    dt = 0;
+                }
+            } else if (!have_io) {
+                // No tasks can be woken so finished running.
+                mp_obj_dict_store(asyncio_context, MP_OBJ_NEW_QSTR(MP_QSTR_cur_task), mp_const_none);
+                return mp_const_none;
+            }
+            if (have_io) {
+                io_queue_wait_io_event(io_queue, task_queue, dt);
+            } else if (dt > 0) {
+                mp_hal_delay_ms(dt);
+            }
+        }
+
+        // Get next task to run and continue it.
+        mp_obj_t t_obj = task_queue_pop(task_queue);
+        mp_obj_task_t *t = MP_OBJ_TO_PTR(t_obj);
+        mp_obj_dict_store(asyncio_context, MP_OBJ_NEW_QSTR(MP_QSTR_cur_task), t_obj);
+
+        // Continue running the coroutine, it's responsible for rescheduling itself.
+        mp_obj_t exc = t->data;
+        mp_obj_t er;
+        mp_vm_return_kind_t kind;
+        if (!mp_obj_is_true(exc)) {
+            kind = mp_resume(t->coro, mp_const_none, MP_OBJ_NULL, &er);
+        } else {
+            // If the task is finished and on the run queue and gets here, then it
+            // had an exception and was not await'ed on. Throwing into it now will
+            // raise StopIteration and the code below will call the exception handler.
+            t->data = mp_const_none;
+            kind = mp_resume(t->coro, MP_OBJ_NULL, exc, &er);
+        }
+        if (kind == MP_VM_RETURN_YIELD) {
+            continue;
+        }
+        if (kind == MP_VM_RETURN_NORMAL) {
+            er = mp_obj_new_exception_arg1(&mp_type_StopIteration, er);
+        } else if (!mp_obj_exception_match(er, MP_OBJ_TO_PTR(cancelled_error))
+                   && !mp_obj_exception_match(er, MP_OBJ_FROM_PTR(&mp_type_Exception))) {
+            nlr_raise(er);
+        }
+
+        // This task is done, check if it's the main task and then loop should stop.
+        if (t_obj == main_task) {
+            mp_obj_dict_store(asyncio_context, MP_OBJ_NEW_QSTR(MP_QSTR_cur_task), mp_const_none);
+            if (kind == MP_VM_RETURN_NORMAL) {
+                return mp_obj_exception_get_value(er);
+            }
+            nlr_raise(er);
+        }
+
+        if (mp_obj_is_true(t->state)) {
+            // Task was running but is now finished.
+            bool waiting = false;
+            if (t->state == TASK_STATE_RUNNING_NOT_WAITED_ON) {
+                // "None" indicates that the task is complete and not await'ed on (yet).
+                t->state = TASK_STATE_DONE_NOT_WAITED_ON;
+            } else if (mp_obj_is_callable(t->state)) {
+                // The task has a callback registered to be called on completion.
+                mp_obj_t cb_args[2] = { t_obj, er };
+                mp_call_function_n_kw(t->state, 2, 0, cb_args);
+                t->state = TASK_STATE_DONE_WAS_WAITED_ON;
+                waiting = true;
+            } else {
+                // Schedule any other tasks waiting on the completion of this task.
+                mp_obj_t push_args[2] = { task_queue, MP_OBJ_NULL };
+                while (task_queue_peek(t->state) != mp_const_none) {
+                    push_args[1] = task_queue_pop(t->state);
+                    task_queue_push(2, push_args);
+                    waiting = true;
+                }
+                // "False" indicates that the task is complete and has been await'ed on.
+                t->state = TASK_STATE_DONE_WAS_WAITED_ON;
+            }
+            if (!waiting
+                && !mp_obj_exception_match(er, MP_OBJ_TO_PTR(cancelled_error))
+                && !mp_obj_exception_match(er, MP_OBJ_FROM_PTR(&mp_type_StopIteration))) {
+                // An exception ended this detached task, so queue it for later
+                // execution to handle the uncaught exception if no other task retrieves
+                // the exception in the meantime (this is handled by Task.throw).
+                mp_obj_t push_args[2] = { task_queue, t_obj };
+                task_queue_push(2, push_args);
+            }
+            // Save return value of coro to pass up to caller.
+            t->data = er;
+        } else if (t->state == TASK_STATE_DONE_NOT_WAITED_ON) {
+            // Task is already finished and nothing await'ed on the task,
+            // so call the exception handler.
+            t->data = exc;
+            mp_obj_t exc_context = asyncio_context_get(MP_QSTR__exc_context);
+            mp_obj_dict_store(exc_context, MP_OBJ_NEW_QSTR(MP_QSTR_exception), exc);
+            mp_obj_dict_store(exc_context, MP_OBJ_NEW_QSTR(MP_QSTR_future), t_obj);
+            asyncio_call_method(asyncio_context_get(MP_QSTR_Loop), MP_QSTR_call_exception_handler, 1, &exc_context);
+        }
+    }
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(asyncio_run_until_complete_obj, 0, 1, asyncio_run_until_complete);
+
 /******************************************************************************/
 // C-level asyncio module
 
@@ -347,6 +527,8 @@ STATIC const mp_rom_map_elem_t mp_module_asyncio_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR__asyncio) },
     { MP_ROM_QSTR(MP_QSTR_TaskQueue), MP_ROM_PTR(&task_queue_type) },
     { MP_ROM_QSTR(MP_QSTR_Task), MP_ROM_PTR(&task_type) },
+    // CIRCUITPY-CHANGE
+    { MP_ROM_QSTR(MP_QSTR_run_until_complete), MP_ROM_PTR(&asyncio_run_until_complete_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(mp_module_asyncio_globals, mp_module_asyncio_globals_table);
 
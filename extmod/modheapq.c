@@ -94,6 +94,32 @@ STATIC mp_obj_t mod_heapq_heappop(mp_obj_t heap_in) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_heapq_heappop_obj, mod_heapq_heappop);
 
+// CIRCUITPY-CHANGE: heappushpop() and heapreplace() keep the heap the same
+// length, so a heap used as a fixed-size queue never reallocates its list.
+STATIC mp_obj_t mod_heapq_heappushpop(mp_obj_t heap_in, mp_obj_t item) {
+    mp_obj_list_t *heap = heapq_get_heap(heap_in);
+    if (heap->len && mp_binary_op(MP_BINARY_OP_LESS, heap->items[0], item) == mp_const_true) {
+        mp_obj_t smallest = heap->items[0];
+        heap->items[0] = item;
+        heapq_heap_siftup(heap, 0);
+        item = smallest;
+    }
+    return item;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_heapq_heappushpop_obj, mod_heapq_heappushpop);
+
+STATIC mp_obj_t mod_heapq_heapreplace(mp_obj_t heap_in, mp_obj_t item) {
+    mp_obj_list_t *heap = heapq_get_heap(heap_in);
+    if (heap->len == 0) {
+        mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("empty heap"));
+    }
+    mp_obj_t smallest = heap->items[0];
+    heap->items[0] = item;
+    heapq_heap_siftup(heap, 0);
+    return smallest;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_heapq_heapreplace_obj, mod_heapq_heapreplace);
+
 STATIC mp_obj_t mod_heapq_heapify(mp_obj_t heap_in) {
     mp_obj_list_t *heap = heapq_get_heap(heap_in);
     for (mp_uint_t i = heap->len / 2; i > 0;) {
@@ -109,6 +135,9 @@ STATIC const mp_rom_map_elem_t mp_module_heapq_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_heappush), MP_ROM_PTR(&mod_heapq_heappush_obj) },
     { MP_ROM_QSTR(MP_QSTR_heappop), MP_ROM_PTR(&mod_heapq_heappop_obj) },
     { MP_ROM_QSTR(MP_QSTR_heapify), MP_ROM_PTR(&mod_heapq_heapify_obj) },
+    // CIRCUITPY-CHANGE
+    { MP_ROM_QSTR(MP_QSTR_heappushpop), MP_ROM_PTR(&mod_heapq_heappushpop_obj) },
+    { MP_ROM_QSTR(MP_QSTR_heapreplace), MP_ROM_PTR(&mod_heapq_heapreplace_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_heapq_globals, mp_module_heapq_globals_table);
@@ -25,6 +25,8 @@
  */
 
 #include <stdio.h>
+// CIRCUITPY-CHANGE
+#include <string.h>
 
 #include "py/binary.h"
 #include "py/objarray.h"
@@ -141,9 +143,10 @@ typedef struct _json_stream_t {
 } json_stream_t;
 
 #define S_EOF (0) // null is not allowed in json stream so is ok as EOF marker
-#define S_END(s) ((s).cur == S_EOF)
-#define S_CUR(s) ((s).cur)
-#define S_NEXT(s) (json_stream_next(&(s)))
+// CIRCUITPY-CHANGE: the parser works on a json_stream_t * so it can be shared by load() and extract()
+#define S_END(s) ((s)->cur == S_EOF)
+#define S_CUR(s) ((s)->cur)
+#define S_NEXT(s) (json_stream_next(s))
 
 STATIC byte json_stream_next(json_stream_t *s) {
     mp_uint_t ret = s->read(s->stream_obj, &s->cur, 1, &s->errcode);
@@ -187,40 +190,89 @@ STATIC mp_uint_t json_python_readinto(mp_obj_t obj, void *buf, mp_uint_t size, i
     return 1;
 }
 
-STATIC mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
+// CIRCUITPY-CHANGE: character_buffer must stay valid while s is used.
+STATIC void json_stream_init(json_stream_t *s, mp_obj_t stream_obj, uint8_t *character_buffer) {
     const mp_stream_p_t *stream_p = mp_proto_get(0, stream_obj);
-    json_stream_t s;
-    uint8_t character_buffer[CIRCUITPY_JSON_READ_CHUNK_SIZE];
     if (stream_p == NULL) {
-        s.start = 0;
-        s.end = 0;
-        mp_load_method(stream_obj, MP_QSTR_readinto, s.python_readinto);
-        s.bytearray_obj.base.type = &mp_type_bytearray;
-        s.bytearray_obj.typecode = BYTEARRAY_TYPECODE;
-        s.bytearray_obj.len = CIRCUITPY_JSON_READ_CHUNK_SIZE;
-        s.bytearray_obj.free = 0;
-        s.bytearray_obj.items = character_buffer;
-        s.python_readinto[2] = MP_OBJ_FROM_PTR(&s.bytearray_obj);
-        s.stream_obj = &s;
-        s.read = json_python_readinto;
+        s->start = 0;
+        s->end = 0;
+        mp_load_method(stream_obj, MP_QSTR_readinto, s->python_readinto);
+        s->bytearray_obj.base.type = &mp_type_bytearray;
+        s->bytearray_obj.typecode = BYTEARRAY_TYPECODE;
+        s->bytearray_obj.len = CIRCUITPY_JSON_READ_CHUNK_SIZE;
+        s->bytearray_obj.free = 0;
+        s->bytearray_obj.items = character_buffer;
+        s->python_readinto[2] = MP_OBJ_FROM_PTR(&s->bytearray_obj);
+        s->stream_obj = s;
+        s->read = json_python_readinto;
     } else {
         stream_p = mp_get_stream_raise(stream_obj, MP_STREAM_OP_READ);
-        s.stream_obj = stream_obj;
-        s.read = stream_p->read;
-        s.errcode = 0;
-        s.cur = 0;
+        s->stream_obj = stream_obj;
+        s->read = stream_p->read;
+        s->errcode = 0;
+        s->cur = 0;
     }
-
     JSON_DEBUG("got JSON stream\n");
-    vstr_t vstr;
-    vstr_init(&vstr, 8);
+}
+
+// CIRCUITPY-CHANGE: read the rest of a string whose opening quote has been
+// consumed. Returns false if the stream ends first.
+STATIC bool json_read_string(json_stream_t *s, vstr_t *vstr) {
+    vstr_reset(vstr);
+    for (; !S_END(s) && S_CUR(s) != '"';) {
+        byte c = S_CUR(s);
+        if (c == '\\') {
+            c = S_NEXT(s);
+            switch (c) {
+                case 'b':
+                    c = 0x08;
+                    break;
+                case 'f':
+                    c = 0x0c;
+                    break;
+                case 'n':
+                    c = 0x0a;
+                    break;
+                case 'r':
+                    c = 0x0d;
+                    break;
+                case 't':
+                    c = 0x09;
+                    break;
+                case 'u': {
+                    mp_uint_t num = 0;
+                    for (int i = 0; i < 4; i++) {
+                        c = (S_NEXT(s) | 0x20) - '0';
+                        if (c > 9) {
+                            c -= ('a' - ('9' + 1));
+                        }
+                        num = (num << 4) | c;
+                    }
+                    vstr_add_char(vstr, num);
+                    goto str_cont;
+                }
+            }
+        }
+        vstr_add_byte(vstr, c);
+    str_cont:
+        S_NEXT(s);
+    }
+    if (S_END(s)) {
+        return false;
+    }
+    S_NEXT(s);
+    return true;
+}
+
+// CIRCUITPY-CHANGE: parse one value starting at the current character. Afterwards
+// the current character is the first one after the value.
+STATIC mp_obj_t json_load_value(json_stream_t *s, vstr_t *vstr) {
     mp_obj_list_t stack; // we use a list as a simple stack for nested JSON
     stack.len = 0;
     stack.items = NULL;
     mp_obj_t stack_top = MP_OBJ_NULL;
     const mp_obj_type_t *stack_top_type = NULL;
     mp_obj_t stack_key = MP_OBJ_NULL;
-    S_NEXT(s);
     for (;;) {
     cont:
         if (S_END(s)) {
@@ -263,50 +315,10 @@ STATIC mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
                 }
                 break;
             case '"':
-                vstr_reset(&vstr);
-                for (; !S_END(s) && S_CUR(s) != '"';) {
-                    byte c = S_CUR(s);
-                    if (c == '\\') {
-                        c = S_NEXT(s);
-                        switch (c) {
-                            case 'b':
-                                c = 0x08;
-                                break;
-                            case 'f':
-                                c = 0x0c;
-                                break;
-                            case 'n':
-                                c = 0x0a;
-                                break;
-                            case 'r':
-                                c = 0x0d;
-                                break;
-                            case 't':
-                                c = 0x09;
-                                break;
-                            case 'u': {
-                                mp_uint_t num = 0;
-                                for (int i = 0; i < 4; i++) {
-                                    c = (S_NEXT(s) | 0x20) - '0';
-                                    if (c > 9) {
-                                        c -= ('a' - ('9' + 1));
-                                    }
-                                    num = (num << 4) | c;
-                                }
-                                vstr_add_char(&vstr, num);
-                                goto str_cont;
-                            }
-                        }
-                    }
-                    vstr_add_byte(&vstr, c);
-                str_cont:
-                    S_NEXT(s);
-                }
-                if (S_END(s)) {
+                if (!json_read_string(s, vstr)) {
                     goto fail;
                 }
-                S_NEXT(s);
-                next = mp_obj_new_str(vstr.buf, vstr.len);
+                next = mp_obj_new_str(vstr->buf, vstr->len);
                 break;
             case '-':
             case '0':
@@ -320,9 +332,9 @@ STATIC mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
             case '8':
             case '9': {
                 bool flt = false;
-                vstr_reset(&vstr);
+                vstr_reset(vstr);
                 for (;;) {
-                    vstr_add_byte(&vstr, cur);
+                    vstr_add_byte(vstr, cur);
                     cur = S_CUR(s);
                     if (cur == '.' || cur == 'E' || cur == 'e') {
                         flt = true;
@@ -334,9 +346,9 @@ STATIC mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
                     S_NEXT(s);
                 }
                 if (flt) {
-                    next = mp_parse_num_float(vstr.buf, vstr.len, false, NULL);
+                    next = mp_parse_num_float(vstr->buf, vstr->len, false, NULL);
                 } else {
-                    next = mp_parse_num_integer(vstr.buf, vstr.len, 10, NULL);
+                    next = mp_parse_num_integer(vstr->buf, vstr->len, 10, NULL);
                 }
                 break;
             }
@@ -401,7 +413,27 @@ STATIC mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
         }
     }
 success:
+    if (stack_top == MP_OBJ_NULL || stack.len != 0) {
+        // not exactly 1 object
+        goto fail;
+    }
+    return stack_top;
+
+fail:
+    mp_raise_ValueError(MP_ERROR_TEXT("syntax error in JSON"));
+}
+
+STATIC mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
     // CIRCUITPY-CHANGE
+    json_stream_t stream;
+    json_stream_t *s = &stream;
+    uint8_t character_buffer[CIRCUITPY_JSON_READ_CHUNK_SIZE];
+    json_stream_init(s, stream_obj, character_buffer);
+
+    vstr_t vstr;
+    vstr_init(&vstr, 8);
+    S_NEXT(s);
+    mp_obj_t result = json_load_value(s, &vstr);
 
     // It is legal for a stream to have contents after JSON.
     // E.g., A UART is not closed after receiving an object; in load() we will
@@ -413,18 +445,11 @@ success:
         }
         if (!S_END(s)) {
             // unexpected chars
-            goto fail;
+            mp_raise_ValueError(MP_ERROR_TEXT("syntax error in JSON"));
         }
     }
-    if (stack_top == MP_OBJ_NULL || stack.len != 0) {
-        // not exactly 1 object
-        goto fail;
-    }
     vstr_clear(&vstr);
-    return stack_top;
-
-fail:
-    mp_raise_ValueError(MP_ERROR_TEXT("syntax error in JSON"));
+    return result;
 }
 
 STATIC mp_obj_t mod_json_load(mp_obj_t stream_obj) {
@@ -441,10 +466,274 @@ STATIC mp_obj_t mod_json_loads(mp_obj_t obj) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_json_loads_obj, mod_json_loads);
 
+// CIRCUITPY-CHANGE: extract() walks the document without building it, and only
+// creates objects for the values at the requested paths.
+
+#define JSON_EXTRACT_MAX_PATHS (32)
+
+typedef struct {
+    mp_obj_t *items;
+    size_t len;
+} json_extract_path_t;
+
+// One open list or dict on the way to a requested value.
+typedef struct {
+    uint32_t mask; // paths whose leading items match the location of this container
+    uint32_t value_mask; // for a dict, paths that match the key just read
+    mp_uint_t index; // for a list, the position of the next value
+    bool is_dict;
+    bool expect_key;
+} json_extract_level_t;
+
+STATIC void json_skip_separators(json_stream_t *s) {
+    while (S_CUR(s) == ',' || S_CUR(s) == ':' || unichar_isspace(S_CUR(s))) {
+        S_NEXT(s);
+    }
+}
+
+// Skip the value starting at the current character without creating any objects.
+STATIC bool json_skip_value(json_stream_t *s) {
+    size_t nest = 0;
+    do {
+        byte c = S_CUR(s);
+        if (c == '"') {
+            S_NEXT(s);
+            while (!S_END(s) && S_CUR(s) != '"') {
+                if (S_CUR(s) == '\\') {
+                    S_NEXT(s);
+                }
+                S_NEXT(s);
+            }
+            if (S_END(s)) {
+                return false;
+            }
+            S_NEXT(s);
+        } else if (c == '[' || c == '{') {
+            nest++;
+            S_NEXT(s);
+        } else if (c == ']' || c == '}') {
+            if (nest == 0) {
+                return false;
+            }
+            nest--;
+            S_NEXT(s);
+        } else if (nest > 0 && (c == ',' || c == ':' || unichar_isspace(c))) {
+            S_NEXT(s);
+        } else if (c == '-' || unichar_isalnum(c)) {
+            // number, true, false or null
+            do {
+                c = S_NEXT(s);
+            } while (c == '+' || c == '-' || c == '.' || unichar_isalnum(c));
+        } else {
+            return false;
+        }
+        if (S_END(s) && nest > 0) {
+            return false;
+        }
+    } while (nest > 0);
+    return true;
+}
+
+STATIC uint32_t json_match_key(const json_extract_path_t *paths, uint32_t mask, size_t depth, const vstr_t *key) {
+    uint32_t matched = 0;
+    for (size_t i = 0; mask >> i; i++) {
+        if (mask & (1u << i)) {
+            mp_obj_t item = paths[i].items[depth];
+            if (mp_obj_is_str(item)) {
+                size_t len;
+                const char *data = mp_obj_str_get_data(item, &len);
+                if (len == key->len && memcmp(data, key->buf, len) == 0) {
+                    matched |= 1u << i;
+                }
+            }
+        }
+    }
+    return matched;
+}
+
+STATIC uint32_t json_match_index(const json_extract_path_t *paths, uint32_t mask, size_t depth, mp_uint_t index) {
+    uint32_t matched = 0;
+    for (size_t i = 0; mask >> i; i++) {
+        if (mask & (1u << i)) {
+            mp_obj_t item = paths[i].items[depth];
+            if (mp_obj_is_small_int(item) && MP_OBJ_SMALL_INT_VALUE(item) == (mp_int_t)index) {
+                matched |= 1u << i;
+            }
+        }
+    }
+    return matched;
+}
+
+// Follow the rest of a path through a value that has already been loaded.
+STATIC bool json_lookup(mp_obj_t value, const mp_obj_t *items, size_t len, mp_obj_t *result) {
+    for (size_t i = 0; i < len; i++) {
+        if (mp_obj_is_type(value, &mp_type_dict) && mp_obj_is_str(items[i])) {
+            mp_map_elem_t *elem = mp_map_lookup(mp_obj_dict_get_map(value), items[i], MP_MAP_LOOKUP);
+            if (elem == NULL) {
+                return false;
+            }
+            value = elem->value;
+        } else if (mp_obj_is_type(value, &mp_type_list) && mp_obj_is_small_int(items[i])) {
+            size_t list_len;
+            mp_obj_t *list_items;
+            mp_obj_list_get(value, &list_len, &list_items);
+            mp_int_t index = MP_OBJ_SMALL_INT_VALUE(items[i]);
+            if (index < 0 || (size_t)index >= list_len) {
+                return false;
+            }
+            value = list_items[index];
+        } else {
+            return false;
+        }
+    }
+    *result = value;
+    return true;
+}
+
+STATIC mp_obj_t mod_json_extract(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_stream, ARG_paths, ARG_default };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_stream, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_paths, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_default, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    size_t num_paths;
+    mp_obj_t *path_objs;
+    mp_obj_get_array(args[ARG_paths].u_obj, &num_paths, &path_objs);
+    mp_arg_validate_length_max(num_paths, JSON_EXTRACT_MAX_PATHS, MP_QSTR_paths);
+
+    json_extract_path_t *paths = m_new(json_extract_path_t, num_paths);
+    size_t max_len = 0;
+    for (size_t i = 0; i < num_paths; i++) {
+        mp_obj_get_array(path_objs[i], &paths[i].len, &paths[i].items);
+        max_len = MAX(max_len, paths[i].len);
+    }
+    json_extract_level_t *levels = m_new(json_extract_level_t, max_len);
+
+    mp_obj_list_t *results = MP_OBJ_TO_PTR(mp_obj_new_list(num_paths, NULL));
+    for (size_t i = 0; i < num_paths; i++) {
+        results->items[i] = args[ARG_default].u_obj;
+    }
+
+    // Like loads(), accept a str or bytes holding the whole document.
+    mp_obj_t stream_obj = args[ARG_stream].u_obj;
+    mp_buffer_info_t bufinfo;
+    vstr_t doc;
+    mp_obj_stringio_t sio;
+    if (mp_get_buffer(stream_obj, &bufinfo, MP_BUFFER_READ)) {
+        doc = (vstr_t) {bufinfo.len, bufinfo.len, (char *)bufinfo.buf, true};
+        sio = (mp_obj_stringio_t) {{&mp_type_stringio}, &doc, 0, MP_OBJ_NULL};
+        stream_obj = MP_OBJ_FROM_PTR(&sio);
+    }
+    json_stream_t stream;
+    json_stream_t *s = &stream;
+    uint8_t character_buffer[CIRCUITPY_JSON_READ_CHUNK_SIZE];
+    json_stream_init(s, stream_obj, character_buffer);
+
+    vstr_t vstr;
+    vstr_init(&vstr, 8);
+    const uint32_t all = num_paths == 32 ? 0xffffffff : (1u << num_paths) - 1;
+    // Paths that have been either found or ruled out.
+    uint32_t done = 0;
+    // Number of open containers that are on the way to a requested value.
+    size_t depth = 0;
+    S_NEXT(s);
+    while (all != 0) {
+        json_skip_separators(s);
+        byte c = S_CUR(s);
+        if (S_END(s)) {
+            goto fail;
+        }
+
+        // Find the paths that lead to or end at this value.
+        uint32_t mask = all;
+        if (depth > 0) {
+            json_extract_level_t *level = &levels[depth - 1];
+            if (c == '}' || c == ']') {
+                S_NEXT(s);
+                depth--;
+                if (depth == 0) {
+                    break;
+                }
+                continue;
+            }
+            if (level->is_dict) {
+                if (level->expect_key) {
+                    if (c != '"') {
+                        goto fail;
+                    }
+                    S_NEXT(s);
+                    if (!json_read_string(s, &vstr)) {
+                        goto fail;
+                    }
+                    level->value_mask = json_match_key(paths, level->mask, depth - 1, &vstr);
+                    level->expect_key = false;
+                    continue;
+                }
+                mask = level->value_mask;
+                level->expect_key = true;
+            } else {
+                mask = json_match_index(paths, level->mask, depth - 1, level->index);
+                level->index++;
+            }
+        }
+
+        bool ends_here = false;
+        for (size_t i = 0; mask >> i; i++) {
+            if ((mask & (1u << i)) && paths[i].len == depth) {
+                ends_here = true;
+            }
+        }
+        if (ends_here) {
+            // Load this value; longer paths through it are looked up in the result.
+            mp_obj_t value = json_load_value(s, &vstr);
+            for (size_t i = 0; mask >> i; i++) {
+                if (mask & (1u << i)) {
+                    json_lookup(value, paths[i].items + depth, paths[i].len - depth, &results->items[i]);
+                }
+            }
+            done |= mask;
+        } else if (mask != 0 && (c == '{' || c == '[')) {
+            S_NEXT(s);
+            json_extract_level_t *level = &levels[depth++];
+            level->mask = mask;
+            level->value_mask = 0;
+            level->index = 0;
+            level->is_dict = c == '{';
+            level->expect_key = true;
+            continue;
+        } else {
+            if (!json_skip_value(s)) {
+                goto fail;
+            }
+            // Any paths that lead here need a list or dict, so they aren't in the document.
+            done |= mask;
+        }
+        if (depth == 0 || done == all) {
+            // Don't read the rest of the document once nothing more can be found.
+            break;
+        }
+    }
+
+    vstr_clear(&vstr);
+    m_del(json_extract_level_t, levels, max_len);
+    m_del(json_extract_path_t, paths, num_paths);
+    return MP_OBJ_FROM_PTR(results);
+
+fail:
+    mp_raise_ValueError(MP_ERROR_TEXT("syntax error in JSON"));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(mod_json_extract_obj, 2, mod_json_extract);
+
 STATIC const mp_rom_map_elem_t mp_module_json_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_json) },
     { MP_ROM_QSTR(MP_QSTR_dump), MP_ROM_PTR(&mod_json_dump_obj) },
     { MP_ROM_QSTR(MP_QSTR_dumps), MP_ROM_PTR(&mod_json_dumps_obj) },
+    // CIRCUITPY-CHANGE
+    { MP_ROM_QSTR(MP_QSTR_extract), MP_ROM_PTR(&mod_json_extract_obj) },
     { MP_ROM_QSTR(MP_QSTR_load), MP_ROM_PTR(&mod_json_load_obj) },
     { MP_ROM_QSTR(MP_QSTR_loads), MP_ROM_PTR(&mod_json_loads_obj) },
 };
@@ -452,7 +452,7 @@ STATIC MP_DEFINE_CONST_OBJ_TYPE(
     );
 #endif
 
-STATIC mp_obj_t mod_re_compile(size_t n_args, const mp_obj_t *args) {
+STATIC mp_obj_t re_compile(size_t n_args, const mp_obj_t *args) {
     (void)n_args;
     const char *re_str = mp_obj_str_get_str(args[0]);
     int size = re1_5_sizecode(re_str);
@@ -478,6 +478,47 @@ STATIC mp_obj_t mod_re_compile(size_t n_args, const mp_obj_t *args) {
     #endif
     return MP_OBJ_FROM_PTR(o);
 }
+
+// CIRCUITPY-CHANGE: keep the most recently used compiled patterns, as CPython
+// does, so re.match(pattern, line) in a loop doesn't recompile each time.
+// Compiled patterns are never modified, so they can be shared.
+#if MICROPY_PY_RE_CACHE_SIZE > 0 && !MICROPY_ENABLE_DYNRUNTIME
+STATIC bool re_cache_hit(mp_obj_t cached, mp_obj_t pattern) {
+    // str and bytes patterns are cached separately.
+    return cached == pattern
+           || (mp_obj_get_type(cached) == mp_obj_get_type(pattern) && mp_obj_equal(cached, pattern));
+}
+
+STATIC mp_obj_t mod_re_compile(size_t n_args, const mp_obj_t *args) {
+    if (n_args > 1) {
+        return re_compile(n_args, args);
+    }
+    mp_obj_t *cache = MP_STATE_VM(re_cache);
+    mp_obj_t pattern = args[0];
+    // Find the matching entry, or else the first empty or the last entry, which is replaced.
+    size_t i = 0;
+    while (i < MICROPY_PY_RE_CACHE_SIZE - 1 && cache[2 * i] != MP_OBJ_NULL && !re_cache_hit(cache[2 * i], pattern)) {
+        i++;
+    }
+    mp_obj_t compiled;
+    if (cache[2 * i] != MP_OBJ_NULL && re_cache_hit(cache[2 * i], pattern)) {
+        compiled = cache[2 * i + 1];
+    } else {
+        compiled = re_compile(1, args);
+    }
+    // Move the entry to the front.
+    memmove(&cache[2], &cache[0], 2 * i * sizeof(mp_obj_t));
+    cache[0] = pattern;
+    cache[1] = compiled;
+    return compiled;
+}
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t re_cache[2 * MICROPY_PY_RE_CACHE_SIZE]);
+#else
+STATIC mp_obj_t mod_re_compile(size_t n_args, const mp_obj_t *args) {
+    return re_compile(n_args, args);
+}
+#endif
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_re_compile_obj, 1, 2, mod_re_compile);
 
 #if !MICROPY_ENABLE_DYNRUNTIME
@@ -57,6 +57,11 @@
 // the period between polling these objects.
 #define MICROPY_PY_SELECT_IOCTL_CALL_PERIOD_MS (1)
 
+// CIRCUITPY-CHANGE
+#else
+
+#include "supervisor/port.h"
+
 #endif
 
 // Flags for ipoll()
@@ -375,6 +380,12 @@ STATIC mp_uint_t poll_set_poll_until_ready_or_timeout(poll_set_t *poll_set, size
         #ifdef MICROPY_EVENT_POLL_HOOK
         MICROPY_EVENT_POLL_HOOK;
         #endif
+        // CIRCUITPY-CHANGE: Sleep instead of spinning. Interrupts and ports
+        // that wake the main task when a socket becomes ready end the sleep
+        // early. Sleeping at most a tick still polls objects that can't wake
+        // us about every millisecond.
+        port_interrupt_after_ticks(1);
+        port_idle_until_interrupt();
     }
 
     #endif
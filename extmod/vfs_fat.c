@@ -63,15 +63,52 @@ STATIC mp_import_stat_t fat_vfs_import_stat(void *vfs_in, const char *path) {
     fs_user_mount_t *vfs = vfs_in;
     FILINFO fno;
     assert(vfs != NULL);
+
+    // CIRCUITPY-CHANGE: Answer repeated lookups from the cache, as long as no
+    // directory entry changed since.
+    #if MICROPY_VFS_FAT_IMPORT_STAT_CACHE
+    const size_t cache_len = MICROPY_VFS_FAT_IMPORT_STAT_CACHE;
+    size_t path_len = strlen(path);
+    bool cacheable = path_len > 0 && path_len < sizeof(vfs->import_stat_cache[0].path);
+    if (vfs->import_stat_changes != vfs->fatfs.dir_changes) {
+        for (size_t i = 0; i < cache_len; i++) {
+            vfs->import_stat_cache[i].path[0] = '\0';
+        }
+        vfs->import_stat_changes = vfs->fatfs.dir_changes;
+    }
+    if (cacheable) {
+        for (size_t i = 0; i < cache_len; i++) {
+            if (strcmp(vfs->import_stat_cache[i].path, path) == 0) {
+                mp_import_stat_t stat = vfs->import_stat_cache[i].stat;
+                // Move the entry to the front, so the least recently used is last.
+                memmove(&vfs->import_stat_cache[1], &vfs->import_stat_cache[0], i * sizeof(vfs->import_stat_cache[0]));
+                vfs->import_stat_cache[0].stat = stat;
+                memcpy(vfs->import_stat_cache[0].path, path, path_len + 1);
+                return stat;
+            }
+        }
+    }
+    #endif
+
+    mp_import_stat_t stat = MP_IMPORT_STAT_NO_EXIST;
     FRESULT res = f_stat(&vfs->fatfs, path, &fno);
     if (res == FR_OK) {
         if ((fno.fattrib & AM_DIR) != 0) {
-            return MP_IMPORT_STAT_DIR;
+            stat = MP_IMPORT_STAT_DIR;
         } else {
-            return MP_IMPORT_STAT_FILE;
+            stat = MP_IMPORT_STAT_FILE;
         }
     }
-    return MP_IMPORT_STAT_NO_EXIST;
+
+    // CIRCUITPY-CHANGE: Only keep answers about the directory contents, not errors.
+    #if MICROPY_VFS_FAT_IMPORT_STAT_CACHE
+    if (cacheable && (res == FR_OK || res == FR_NO_FILE || res == FR_NO_PATH)) {
+        memmove(&vfs->import_stat_cache[1], &vfs->import_stat_cache[0], (cache_len - 1) * sizeof(vfs->import_stat_cache[0]));
+        vfs->import_stat_cache[0].stat = stat;
+        memcpy(vfs->import_stat_cache[0].path, path, path_len + 1);
+    }
+    #endif
+    return stat;
 }
 
 STATIC mp_obj_t fat_vfs_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
@@ -80,6 +117,11 @@ STATIC mp_obj_t fat_vfs_make_new(const mp_obj_type_t *type, size_t n_args, size_
     // create new object
     fs_user_mount_t *vfs = mp_obj_malloc(fs_user_mount_t, type);
     vfs->fatfs.drv = vfs;
+    // CIRCUITPY-CHANGE: Don't let the import_stat() cache match before the first mount.
+    vfs->fatfs.dir_changes = 0;
+    #if MICROPY_VFS_FAT_IMPORT_STAT_CACHE
+    vfs->import_stat_changes = 0;
+    #endif
 
     // Initialise underlying block device
     vfs->blockdev.flags = MP_BLOCKDEV_FLAG_FREE_OBJ;
@@ -38,6 +38,16 @@ typedef struct _fs_user_mount_t {
     // CIRCUITPY-CHANGE: Count the users that are manipulating the blockdev via
     // native fatfs so we can lock and unlock the blockdev.
     int8_t lock_count;
+
+    #if MICROPY_VFS_FAT_IMPORT_STAT_CACHE
+    // CIRCUITPY-CHANGE: Recent import_stat() results, most recent first. They
+    // are dropped when fatfs.dir_changes no longer matches.
+    DWORD import_stat_changes;
+    struct {
+        uint8_t stat;
+        char path[MICROPY_VFS_FAT_IMPORT_STAT_CACHE_PATH_LEN];
+    } import_stat_cache[MICROPY_VFS_FAT_IMPORT_STAT_CACHE];
+    #endif
 } fs_user_mount_t;
 
 extern const byte fresult_to_errno_table[20];
@@ -164,6 +164,8 @@ STATIC const mp_stream_p_t vfs_fat_fileio_stream_p = {
     .read = file_obj_read,
     .write = file_obj_write,
     .ioctl = file_obj_ioctl,
+    // CIRCUITPY-CHANGE
+    .readline_can_seek_back = true,
 };
 
 MP_DEFINE_CONST_OBJ_TYPE(
@@ -180,6 +182,8 @@ STATIC const mp_stream_p_t vfs_fat_textio_stream_p = {
     .write = file_obj_write,
     .ioctl = file_obj_ioctl,
     .is_text = true,
+    // CIRCUITPY-CHANGE
+    .readline_can_seek_back = true,
 };
 
 MP_DEFINE_CONST_OBJ_TYPE(
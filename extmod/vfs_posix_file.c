@@ -259,6 +259,8 @@ STATIC const mp_stream_p_t vfs_posix_fileio_stream_p = {
     .read = vfs_posix_file_read,
     .write = vfs_posix_file_write,
     .ioctl = vfs_posix_file_ioctl,
+    // CIRCUITPY-CHANGE
+    .readline_can_seek_back = true,
 };
 
 MP_DEFINE_CONST_OBJ_TYPE(
@@ -275,6 +277,8 @@ STATIC const mp_stream_p_t vfs_posix_textio_stream_p = {
     .write = vfs_posix_file_write,
     .ioctl = vfs_posix_file_ioctl,
     .is_text = true,
+    // CIRCUITPY-CHANGE
+    .readline_can_seek_back = true,
 };
 
 #if MICROPY_PY_SYS_STDIO_BUFFER
@@ -27,6 +27,8 @@
 #include <stdio.h>
 #include <string.h>
 
+// CIRCUITPY-CHANGE
+#include "py/gc.h"
 #include "py/runtime.h"
 #include "py/stream.h"
 #include "py/reader.h"
@@ -76,6 +78,18 @@ void mp_reader_new_file(mp_reader_t *reader, const char *filename) {
         MP_OBJ_NEW_QSTR(MP_QSTR_rb),
     };
     rf->file = mp_vfs_open(MP_ARRAY_SIZE(args), &args[0], (mp_map_t *)&mp_const_empty_map);
+    #if MICROPY_PERSISTENT_CODE_LOAD_ROM
+    // CIRCUITPY-CHANGE: a file on memory-mapped storage may expose its contents
+    // through the buffer protocol. If that memory is outside the heap then it
+    // stays valid after the file is closed, so read it in place as ROM.
+    mp_buffer_info_t bufinfo;
+    if (mp_get_buffer(rf->file, &bufinfo, MP_BUFFER_READ) && !gc_ptr_on_heap(bufinfo.buf)) {
+        mp_stream_close(rf->file);
+        m_del_obj(mp_reader_vfs_t, rf);
+        mp_reader_new_mem(reader, bufinfo.buf, bufinfo.len, MP_READER_IS_ROM);
+        return;
+    }
+    #endif
     int errcode;
     rf->len = mp_stream_rw(rf->file, rf->buf, sizeof(rf->buf), &errcode, MP_STREAM_RW_READ | MP_STREAM_RW_ONCE);
     if (errcode != 0) {
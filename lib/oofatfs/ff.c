@@ -2479,6 +2479,8 @@ static FRESULT dir_register (   /* FR_OK:succeeded, FR_DENIED:no free entry or t
 {
     FRESULT res;
     FATFS *fs = dp->obj.fs;
+    // CIRCUITPY-CHANGE: Let path lookup caches know the directory changed.
+    fs->dir_changes++;
 #if FF_USE_LFN      /* LFN configuration */
     UINT n, nlen, nent;
     BYTE sn[12], sum;
@@ -2585,6 +2587,8 @@ static FRESULT dir_remove ( /* FR_OK:Succeeded, FR_DISK_ERR:A disk error */
 {
     FRESULT res;
     FATFS *fs = dp->obj.fs;
+    // CIRCUITPY-CHANGE: Let path lookup caches know the directory changed.
+    fs->dir_changes++;
 #if FF_USE_LFN      /* LFN configuration */
     DWORD last = dp->dptr;
 
@@ -3331,6 +3335,8 @@ static FRESULT find_volume (    /* FR_OK(0): successful, !=0: an error occurred
 
     fs->fs_type = fmt;      /* FAT sub-type */
     fs->id = ++Fsid;        /* Volume mount ID */
+    // CIRCUITPY-CHANGE: Anything cached from before this mount is stale.
+    fs->dir_changes++;
 #if FF_USE_LFN == 1
     fs->lfnbuf = LfnBuf;    /* Static LFN working buffer */
 #if FF_FS_EXFAT
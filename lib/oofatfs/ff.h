@@ -162,6 +162,9 @@ typedef struct {
     DWORD   bitbase;        /* Allocation bitmap base sector */
 #endif
     DWORD   winsect;        /* Current sector appearing in the win[] */
+    // CIRCUITPY-CHANGE: Counts mounts and directory entry changes, so that
+    // caches of path lookups can tell when they are stale.
+    DWORD   dir_changes;
     __attribute__((aligned(FF_WINDOW_ALIGNMENT),)) BYTE    win[FF_MAX_SS]; /* Disk access window for Directory, FAT (and file data at tiny cfg). */
 } FATFS;
 
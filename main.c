@@ -61,6 +61,9 @@
 #include "supervisor/usb.h"
 #include "supervisor/workflow.h"
 #include "supervisor/shared/external_flash/external_flash.h"
+#include "supervisor/shared/boot_trace.h"
+#include "supervisor/shared/cpu_governor.h"
+#include "supervisor/shared/profiler.h"
 
 #include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/microcontroller/Processor.h"
@@ -107,6 +110,10 @@
 #include "shared-module/memorymonitor/__init__.h"
 #endif
 
+#if CIRCUITPY_NVM
+#include "shared-module/nvm/ByteArray.h"
+#endif
+
 #if CIRCUITPY_SOCKETPOOL
 #include "shared-bindings/socketpool/__init__.h"
 #endif
@@ -115,10 +122,18 @@
 #include "supervisor/shared/status_bar.h"
 #endif
 
+#if CIRCUITPY_WARM_RELOAD
+#include "supervisor/shared/import_cache.h"
+#endif
+
 #if CIRCUITPY_USB_HID
 #include "shared-module/usb_hid/__init__.h"
 #endif
 
+#if CIRCUITPY_USB_HOST
+#include "shared-module/usb/core/Device.h"
+#endif
+
 #if CIRCUITPY_WIFI
 #include "shared-bindings/wifi/__init__.h"
 #endif
@@ -172,6 +187,10 @@ STATIC uint8_t *_allocate_memory(safe_mode_t safe_mode, const char *env_key, siz
 STATIC void start_mp(safe_mode_t safe_mode) {
     supervisor_workflow_reset();
 
+    #if CIRCUITPY_CPU_GOVERNOR
+    supervisor_cpu_governor_reset();
+    #endif
+
     // Stack limit should be less than real stack size, so we have a chance
     // to recover from limit hit.  (Limit is measured in bytes.) The top of the
     // stack is set to our current state. Not the actual top.
@@ -199,6 +218,10 @@ STATIC void start_mp(safe_mode_t safe_mode) {
     // Clear the readline history. It references the heap we're about to destroy.
     readline_init0();
 
+    #if CIRCUITPY_WARM_RELOAD
+    supervisor_import_cache_init();
+    #endif
+
     #if MICROPY_ENABLE_PYSTACK
     size_t pystack_size = 0;
     _pystack = _allocate_memory(safe_mode, "CIRCUITPY_PYSTACK_SIZE", CIRCUITPY_PYSTACK_SIZE, &pystack_size);
@@ -248,6 +271,11 @@ STATIC void stop_mp(void) {
     port_free(_heap);
     _heap = NULL;
 
+    #if CIRCUITPY_ENABLE_MPY_NATIVE
+    // Native code is only reachable from the heap that was just freed.
+    supervisor_native_code_free_all();
+    #endif
+
     #if MICROPY_ENABLE_PYSTACK
     port_free(_pystack);
     _pystack = NULL;
@@ -357,6 +385,10 @@ STATIC void cleanup_after_vm(mp_obj_t exception) {
         }
     }
 
+    #if CIRCUITPY_SAMPLING_PROFILER
+    supervisor_profiler_reset();
+    #endif
+
     // Reset port-independent devices, like CIRCUITPY_BLEIO_HCI.
     reset_devices();
 
@@ -373,6 +405,11 @@ STATIC void cleanup_after_vm(mp_obj_t exception) {
     memorymonitor_reset();
     #endif
 
+    // Uncommitted nvm changes are dropped with the heap.
+    #if CIRCUITPY_NVM
+    shared_module_nvm_bytearray_reset();
+    #endif
+
     // Disable user related BLE state that uses the micropython heap.
     #if CIRCUITPY_BLEIO
     bleio_user_reset();
@@ -386,6 +423,10 @@ STATIC void cleanup_after_vm(mp_obj_t exception) {
     keypad_reset();
     #endif
 
+    #if CIRCUITPY_USB_HOST
+    usb_core_device_reset();
+    #endif
+
     // Close user-initiated sockets.
     #if CIRCUITPY_SOCKETPOOL
     socketpool_user_reset();
@@ -469,6 +510,9 @@ STATIC bool run_code_py(safe_mode_t safe_mode, bool *simulate_reset) {
         // Make sure we are in the root directory before looking at files.
         common_hal_os_chdir("/");
 
+        // After a reset, this is the end of startup.
+        supervisor_boot_trace_end("code_vm");
+
         // Check if a different run file has been allocated
         if (next_code_configuration != NULL) {
             next_code_configuration->options &= ~SUPERVISOR_NEXT_CODE_OPT_NEWLY_SET;
@@ -754,12 +798,12 @@ STATIC bool run_code_py(safe_mode_t safe_mode, bool *simulate_reset) {
             // we'll undersleep just a little. It shouldn't matter.
             if (time_to_next_change > 0) {
                 port_interrupt_after_ticks(time_to_next_change);
-                port_idle_until_interrupt();
+                supervisor_cpu_governor_idle_until_interrupt();
             }
             #else
             // No status LED can we sleep until we are interrupted by some
             // interaction.
-            port_idle_until_interrupt();
+            supervisor_cpu_governor_idle_until_interrupt();
             #endif
         }
     }
@@ -996,6 +1040,7 @@ int __attribute__((used)) main(void) {
     set_safe_mode(port_init());
 
     port_heap_init();
+    supervisor_boot_trace_mark("port_init");
 
     // Turn on RX and TX LEDs if we have them.
     init_rxtx_leds();
@@ -1010,11 +1055,13 @@ int __attribute__((used)) main(void) {
     // Start the debug serial
     serial_early_init();
     mp_hal_stdout_tx_str(line_clear);
+    supervisor_boot_trace_mark("serial_early_init");
 
     // Wait briefly to give a reset window where we'll enter safe mode after the reset.
     if (get_safe_mode() == SAFE_MODE_NONE) {
         set_safe_mode(wait_for_safe_mode_reset());
     }
+    supervisor_boot_trace_mark("safe_mode_wait");
 
     stack_init();
 
@@ -1023,8 +1070,10 @@ int __attribute__((used)) main(void) {
     #endif
 
     #if CIRCUITPY_BLEIO
+    common_hal_bleio_register_gc_roots();
     // Early init so that a reset press can cause BLE public advertising.
     supervisor_bluetooth_init();
+    supervisor_boot_trace_mark("bluetooth_init");
     #endif
 
     #if !INTERNAL_FLASH_FILESYSTEM
@@ -1060,6 +1109,7 @@ int __attribute__((used)) main(void) {
 
     // displays init after filesystem, since they could share the flash SPI
     board_init();
+    supervisor_boot_trace_mark("board_init");
 
     mp_hal_stdout_tx_str(line_clear);
 
@@ -1084,6 +1134,7 @@ int __attribute__((used)) main(void) {
     #endif
 
     run_boot_py(get_safe_mode());
+    supervisor_boot_trace_mark("boot_py");
 
     supervisor_workflow_start();
 
@@ -1126,6 +1177,37 @@ int __attribute__((used)) main(void) {
     return 0;
 }
 
+#if MICROPY_GC_INCREMENTAL_SWEEP
+// Blocks swept between checks of the slice's time budget.
+#define GC_SWEEP_STEP_BLOCKS (256)
+
+static background_callback_t gc_sweep_callback;
+
+// Current time in units of 1/32768 s: a tick is 1/1024 s and a subtick 1/32 of a tick.
+static uint64_t gc_sweep_now(void) {
+    uint8_t subticks = 0;
+    uint64_t ticks = port_get_raw_ticks(&subticks);
+    return (ticks << 5) + subticks;
+}
+
+// Sweep the heap for up to gc.sweep_budget() microseconds, then yield to the
+// other background tasks until the next pass.
+static void gc_sweep_background(void *data) {
+    if (!gc_is_locked()) {
+        uint64_t budget = (uint64_t)gc_get_sweep_budget_us() * 32768 / 1000000;
+        uint64_t start = gc_sweep_now();
+        while (gc_sweep_step(GC_SWEEP_STEP_BLOCKS)) {
+            if (gc_sweep_now() - start >= budget) {
+                break;
+            }
+        }
+    }
+    if (gc_sweep_pending()) {
+        background_callback_add(&gc_sweep_callback, gc_sweep_background, NULL);
+    }
+}
+#endif
+
 void gc_collect(void) {
     gc_collect_start();
 
@@ -1133,8 +1215,14 @@ void gc_collect(void) {
     mp_uint_t sp = cpu_get_regs_and_sp(regs);
 
     // This collects root pointers from the VFS mount table. Some of them may
-    // have lost their references in the VM even though they are mounted.
-    gc_collect_root((void **)&MP_STATE_VM(vfs_mount_table), sizeof(mp_vfs_mount_t) / sizeof(mp_uint_t));
+    // have lost their references in the VM even though they are mounted. The
+    // table head is a root pointer, but the CIRCUITPY mount is static so the
+    // collector won't follow it to the rest of the list.
+    for (mp_vfs_mount_t *vfs = MP_STATE_VM(vfs_mount_table); vfs != NULL; vfs = vfs->next) {
+        gc_collect_ptr(vfs);
+        gc_collect_ptr((void *)vfs->str);
+        gc_collect_ptr(MP_OBJ_TO_PTR(vfs->obj));
+    }
 
     port_gc_collect();
 
@@ -1152,10 +1240,6 @@ void gc_collect(void) {
     displayio_gc_collect();
     #endif
 
-    #if CIRCUITPY_BLEIO
-    common_hal_bleio_gc_collect();
-    #endif
-
     #if CIRCUITPY_USB_HID
     usb_hid_gc_collect();
     #endif
@@ -1168,6 +1252,12 @@ void gc_collect(void) {
     // range.
     gc_collect_root((void **)sp, ((mp_uint_t)port_stack_get_top() - sp) / sizeof(mp_uint_t));
     gc_collect_end();
+
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    if (gc_sweep_pending()) {
+        background_callback_add(&gc_sweep_callback, gc_sweep_background, NULL);
+    }
+    #endif
 }
 
 // Ports may provide an implementation of this function if it is needed
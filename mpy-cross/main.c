@@ -130,6 +130,8 @@ STATIC int usage(char **argv) {
         "Target specific options:\n"
         "-msmall-int-bits=number : set the maximum bits used to encode a small-int\n"
         "-march=<arch> : set architecture for native emitter; x86, x64, armv6, armv6m, armv7m, armv7em, armv7emsp, armv7emdp, xtensa, xtensawin\n"
+        // CIRCUITPY-CHANGE
+        "-msuperinstructions : fuse common opcode sequences; the target must be built with MICROPY_OPT_BC_SUPERINSTRUCTIONS\n"
         "\n"
         "Implementation specific options:\n", argv[0]
         );
@@ -235,6 +237,8 @@ MP_NOINLINE int main_(int argc, char **argv) {
     // don't support native emitter unless -march is specified
     mp_dynamic_compiler.native_arch = MP_NATIVE_ARCH_NONE;
     mp_dynamic_compiler.nlr_buf_num_regs = 0;
+    // CIRCUITPY-CHANGE: not all targets can run superinstructions
+    mp_dynamic_compiler.superinstructions = false;
 
     const char *input_file = NULL;
     const char *output_file = NULL;
@@ -329,6 +333,9 @@ MP_NOINLINE int main_(int argc, char **argv) {
                 } else {
                     return usage(argv);
                 }
+            // CIRCUITPY-CHANGE
+            } else if (strcmp(argv[a], "-msuperinstructions") == 0) {
+                mp_dynamic_compiler.superinstructions = true;
             } else if (strcmp(argv[a], "--") == 0) {
                 option_parsing_active = false;
             } else {
@@ -56,6 +56,10 @@
 #define MICROPY_COMP_DOUBLE_TUPLE_ASSIGN (1)
 #define MICROPY_COMP_TRIPLE_TUPLE_ASSIGN (1)
 #define MICROPY_COMP_RETURN_IF_EXPR (1)
+// CIRCUITPY-CHANGE: emitted only with -msuperinstructions
+#define MICROPY_OPT_BC_SUPERINSTRUCTIONS (1)
+// CIRCUITPY-CHANGE: used with -O2 and above
+#define MICROPY_OPT_BC_JUMP_THREADING (1)
 
 #define MICROPY_READER_POSIX        (1)
 #define MICROPY_ENABLE_RUNTIME      (0)
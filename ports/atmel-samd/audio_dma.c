@@ -35,6 +35,7 @@
 #include "shared-bindings/audiocore/WaveFile.h"
 #include "shared-bindings/microcontroller/__init__.h"
 #include "supervisor/background_callback.h"
+#include "supervisor/port.h"
 
 #include "py/mpstate.h"
 #include "py/runtime.h"
@@ -92,6 +93,13 @@ void audio_dma_enable_channel(uint8_t channel) {
     dma_enable_channel(channel);
 }
 
+// Microseconds from the RTC that also drives ticks, so resolution is about 30us.
+static uint32_t audio_dma_time_us(void) {
+    uint8_t subticks = 0;
+    uint64_t ticks = port_get_raw_ticks(&subticks);
+    return ((ticks * 32 + subticks) * 15625) >> 9;
+}
+
 static void audio_dma_convert_samples(
     audio_dma_t *dma,
     uint8_t *input, uint32_t input_length,
@@ -141,6 +149,7 @@ static void audio_dma_convert_samples(
 }
 
 static void audio_dma_load_next_block(audio_dma_t *dma, size_t buffer_idx) {
+    uint32_t start_us = audio_dma_time_us();
     uint8_t *sample_buffer;
     uint32_t sample_buffer_length;
     audioio_get_buffer_result_t get_buffer_result =
@@ -168,6 +177,8 @@ static void audio_dma_load_next_block(audio_dma_t *dma, size_t buffer_idx) {
         &output_spacing);
 
     descriptor->BTCNT.reg = output_buffer_length / dma->beat_size / output_spacing;
+    audiosample_output_stats_record_buffer(&dma->stats, audio_dma_time_us() - start_us,
+        descriptor->BTCNT.reg, dma->sample_rate);
     descriptor->SRCADDR.reg = ((uint32_t)output_buffer) + output_buffer_length;
     if (get_buffer_result == GET_BUFFER_DONE) {
         if (dma->loop) {
@@ -224,6 +235,8 @@ audio_dma_result audio_dma_setup_playback(audio_dma_t *dma,
     dma->signed_to_unsigned = false;
     dma->unsigned_to_signed = false;
     dma->spacing = 1;
+    dma->sample_rate = audiosample_sample_rate(sample);
+    audiosample_output_stats_reset(&dma->stats);
     audiosample_reset_buffer(sample, single_channel_output, audio_channel);
     dma->buffer_to_load = NO_BUFFER_TO_LOAD;
     dma->descriptor[0] = dma_descriptor(dma_channel);
@@ -392,6 +405,7 @@ STATIC void dma_callback_fun(void *arg) {
     if (buffer_to_load == NO_BUFFER_TO_LOAD) {
         audio_dma_stop(dma);
     } else {
+        audiosample_output_stats_record_fill_latency(&dma->stats, audio_dma_time_us() - dma->interrupt_us);
         audio_dma_load_next_block(dma, buffer_to_load);
     }
 }
@@ -418,6 +432,12 @@ void audio_dma_evsys_handler(void) {
         // of which buffer to fill here appears correct.
         DmacDescriptor *next_descriptor =
             (DmacDescriptor *)dma_write_back_descriptor(dma->dma_channel)->DESCADDR.reg;
+        if (dma->buffer_to_load != NO_BUFFER_TO_LOAD) {
+            // The background task hasn't refilled the last buffer so it is about to play again.
+            dma->stats.underruns++;
+        } else {
+            dma->interrupt_us = audio_dma_time_us();
+        }
         if (next_descriptor == dma->descriptor[0]) {
             dma->buffer_to_load = 0;
         } else if (next_descriptor == dma->descriptor[1]) {
@@ -428,7 +448,7 @@ void audio_dma_evsys_handler(void) {
             continue;
         }
 
-        background_callback_add(&dma->callback, dma_callback_fun, (void *)dma);
+        background_callback_add_with_priority(&dma->callback, dma_callback_fun, (void *)dma, BACKGROUND_CALLBACK_REALTIME);
     }
 }
 
@@ -29,6 +29,7 @@
 
 #include "extmod/vfs_fat.h"
 #include "py/obj.h"
+#include "shared-module/audiocore/__init__.h"
 #include "shared-module/audiocore/RawSample.h"
 #include "shared-module/audiocore/WaveFile.h"
 #include "supervisor/background_callback.h"
@@ -40,6 +41,9 @@ typedef struct {
     DmacDescriptor *descriptor[2];
     DmacDescriptor second_descriptor;
     background_callback_t callback;
+    audiosample_output_stats_t stats;
+    uint32_t sample_rate;
+    uint32_t interrupt_us; // When the block interrupt for buffer_to_load happened.
     uint8_t dma_channel;
     uint8_t event_channel;
     uint8_t audio_channel;
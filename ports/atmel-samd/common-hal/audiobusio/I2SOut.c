@@ -355,6 +355,10 @@ bool common_hal_audiobusio_i2sout_get_paused(audiobusio_i2sout_obj_t *self) {
     return audio_dma_get_paused(&self->dma);
 }
 
+mp_obj_t common_hal_audiobusio_i2sout_get_stats(audiobusio_i2sout_obj_t *self) {
+    return audiosample_output_stats_get(&self->dma.stats);
+}
+
 void common_hal_audiobusio_i2sout_stop(audiobusio_i2sout_obj_t *self) {
     audio_dma_stop(&self->dma);
 
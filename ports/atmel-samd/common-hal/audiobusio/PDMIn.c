@@ -53,6 +53,28 @@
 #define OVERSAMPLING 64
 #define SAMPLES_PER_BUFFER 32
 
+// Continuous recording decimates in two stages. A third order CIC filter takes the bit stream
+// to four times the sample rate and a FIR filter, which also flattens the CIC droop, takes it
+// the rest of the way.
+#define CIC_DECIMATION 16
+#define CIC_ORDER 3
+#define CIC_GAIN (CIC_DECIMATION * CIC_DECIMATION * CIC_DECIMATION)
+// The CIC impulse response is 46 taps long. Padded to 48 it covers the three most recent
+// 16-bit words of the bit stream, which are looked up a byte at a time.
+#define CIC_TAPS 48
+#define CIC_TABLE_COUNT (CIC_TAPS / 8)
+#define FIR_DECIMATION (OVERSAMPLING / CIC_DECIMATION)
+#define FIR_TAPS 48
+#define FIR_HISTORY (FIR_TAPS - FIR_DECIMATION)
+
+// Output samples per DMA block. Background tasks must get to each block before the DMA
+// comes back around to it.
+#ifdef SAMD21
+#define RECORDING_SAMPLES_PER_BLOCK 64
+#else
+#define RECORDING_SAMPLES_PER_BLOCK 256
+#endif
+
 // MEMS microphones must be clocked at at least 1MHz.
 #define MIN_MIC_CLOCK 1000000
 
@@ -68,14 +90,28 @@
 static volatile bool pdmin_dma_block_done;
 // Event channel used to trigger interrupt. Set to invalid value EVSYS_SYNCH_NUM when not in use.
 static uint8_t pdmin_event_channel;
+// PDMIn that is recording continuously, if any.
+STATIC audiobusio_pdmin_obj_t *active_recording;
+
+STATIC void pdmin_recording_callback(void *arg);
 
 void pdmin_evsys_handler(void) {
     if (pdmin_event_channel < EVSYS_SYNCH_NUM && event_interrupt_active(pdmin_event_channel)) {
         pdmin_dma_block_done = true;
     }
+    audiobusio_pdmin_obj_t *self = active_recording;
+    if (self != NULL && event_interrupt_active(self->event_channel)) {
+        // The blocks alternate so the count is enough to know which one finished.
+        self->blocks_done++;
+        background_callback_add_with_priority(&self->callback, pdmin_recording_callback, self,
+            BACKGROUND_CALLBACK_REALTIME);
+    }
 }
 
 void pdmin_reset(void) {
+    if (active_recording != NULL) {
+        common_hal_audiobusio_pdmin_stop_recording(active_recording);
+    }
     pdmin_dma_block_done = false;
     pdmin_event_channel = EVSYS_SYNCH_NUM;
 
@@ -252,6 +288,7 @@ void common_hal_audiobusio_pdmin_deinit(audiobusio_pdmin_obj_t *self) {
         return;
     }
 
+    common_hal_audiobusio_pdmin_stop_recording(self);
     i2s_set_serializer_enable(self->serializer, false);
     i2s_set_clock_unit_enable(self->clock_unit, false);
 
@@ -384,6 +421,9 @@ static uint16_t filter_sample(uint32_t pdm_samples[4]) {
 // output_buffer_length is the number of slots, not the number of bytes.
 uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t *self,
     uint16_t *output_buffer, uint32_t output_buffer_length) {
+    if (active_recording == self) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Serializer in use"));
+    }
     uint8_t dma_channel = dma_allocate_channel();
     pdmin_event_channel = find_sync_event_channel_raise();
     pdmin_dma_block_done = false;
@@ -502,3 +542,250 @@ uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t *se
 
     return values_output;
 }
+
+// Compensating FIR for the CIC stage, at four times the sample rate. It is a least squares fit
+// to the inverse of the CIC response up to 0.31 of the sample rate and is more than 50dB down
+// from 0.625 of it, so almost nothing aliases into the passband. Q15 with a DC gain of 1.
+STATIC const int16_t __attribute__((aligned(4))) fir_filter[FIR_TAPS] = {
+    56, 93, 101, 56, -46, -179, -285, -300,
+    -180, 68, 369, 598, 621, 359, -164, -792,
+    -1272, -1326, -750, 496, 2246, 4148, 5764, 6703,
+    6703, 5764, 4148, 2246, 496, -750, -1326, -1272,
+    -792, -164, 359, 621, 598, 369, 68, -180,
+    -300, -285, -179, -46, 56, 101, 93, 56
+};
+
+// The CIC filter is applied as the FIR filter it is equivalent to, a byte of the bit stream at
+// a time. Table t holds the sum of the taps under each set bit of byte t, with byte 0 being the
+// most recent.
+STATIC void fill_cic_table(uint16_t *table) {
+    // A boxcar convolved with itself CIC_ORDER times.
+    uint16_t taps[CIC_TAPS];
+    for (size_t k = 0; k < CIC_TAPS; k++) {
+        taps[k] = k < CIC_DECIMATION;
+    }
+    for (size_t pass = 1; pass < CIC_ORDER; pass++) {
+        for (size_t k = CIC_TAPS; k-- > 0;) {
+            uint16_t sum = 0;
+            for (size_t j = 0; j < CIC_DECIMATION && j <= k; j++) {
+                sum += taps[k - j];
+            }
+            taps[k] = sum;
+        }
+    }
+    for (size_t t = 0; t < CIC_TABLE_COUNT; t++) {
+        for (size_t value = 0; value < 256; value++) {
+            uint16_t sum = 0;
+            // The least significant bit was received last.
+            for (size_t i = 0; i < 8; i++) {
+                if (value & (1 << i)) {
+                    sum += taps[8 * t + i];
+                }
+            }
+            table[256 * t + value] = sum;
+        }
+    }
+}
+
+static inline int32_t fir_sample(const int16_t *history) {
+    int32_t sum = 0;
+    #if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+    // Two taps per instruction. The history is word aligned because it steps by FIR_DECIMATION.
+    const uint32_t *taps = (const uint32_t *)fir_filter;
+    const uint32_t *values = (const uint32_t *)history;
+    for (size_t i = 0; i < FIR_TAPS / 2; i++) {
+        sum = __SMLAD(taps[i], values[i], sum);
+    }
+    #else
+    for (size_t i = 0; i < FIR_TAPS; i++) {
+        sum += fir_filter[i] * history[i];
+    }
+    #endif
+    return sum;
+}
+
+STATIC void decimate_block(audiobusio_pdmin_obj_t *self, const uint32_t *block) {
+    const uint16_t *table = self->cic_table;
+    int16_t *cic_values = self->cic_history + FIR_HISTORY;
+    uint32_t previous = self->cic_bits[0];
+    uint32_t oldest = self->cic_bits[1];
+    const size_t words = RECORDING_SAMPLES_PER_BLOCK * FIR_DECIMATION;
+    for (size_t i = 0; i < words; i++) {
+        // As in filter_sample, only the lower 16 bits of each word are our channel.
+        uint32_t bits = block[i] & 0xffff;
+        int32_t sum = table[bits & 0xff] + table[256 + (bits >> 8)] +
+            table[512 + (previous & 0xff)] + table[768 + (previous >> 8)] +
+            table[1024 + (oldest & 0xff)] + table[1280 + (oldest >> 8)];
+        cic_values[i] = sum - CIC_GAIN / 2;
+        oldest = previous;
+        previous = bits;
+    }
+    self->cic_bits[0] = previous;
+    self->cic_bits[1] = oldest;
+
+    size_t sample_size = self->bit_depth / 8;
+    for (size_t i = 0; i < RECORDING_SAMPLES_PER_BLOCK; i++) {
+        // The CIC output is 12 bits and the filter is Q15, so this leaves 16 bits.
+        int32_t value = fir_sample(self->cic_history + i * FIR_DECIMATION) >> 11;
+        value = MIN(MAX(value, -32768), 32767);
+        uint16_t sample = value + 0x8000;
+        // The ring keeps the most recent samples, so drop the oldest when it is full.
+        if (self->ring_count == self->ring_length) {
+            self->ring_count--;
+        }
+        uint8_t *slot = self->ring + self->ring_head * sample_size;
+        if (sample_size == 1) {
+            *slot = sample >> 8;
+        } else {
+            *(uint16_t *)slot = sample;
+        }
+        self->ring_head = (self->ring_head + 1) % self->ring_length;
+        self->ring_count++;
+    }
+    memmove(self->cic_history, self->cic_history + RECORDING_SAMPLES_PER_BLOCK * FIR_DECIMATION,
+        FIR_HISTORY * sizeof(self->cic_history[0]));
+}
+
+STATIC void pdmin_recording_callback(void *arg) {
+    audiobusio_pdmin_obj_t *self = arg;
+    if (active_recording != self) {
+        return;
+    }
+    uint32_t blocks_done = self->blocks_done;
+    if (blocks_done - self->blocks_processed > 1) {
+        // Background tasks were held off for longer than a block. The DMA is already over
+        // all but the last finished block, so carry on from there.
+        self->blocks_processed = blocks_done - 1;
+    }
+    while (self->blocks_processed != blocks_done) {
+        const uint32_t *block = self->raw_blocks +
+            (self->blocks_processed % 2) * RECORDING_SAMPLES_PER_BLOCK * FIR_DECIMATION;
+        decimate_block(self, block);
+        self->blocks_processed++;
+    }
+}
+
+STATIC void setup_recording_descriptor(audiobusio_pdmin_obj_t *self, DmacDescriptor *descriptor,
+    uint32_t *block, DmacDescriptor *next) {
+    const uint32_t words = RECORDING_SAMPLES_PER_BLOCK * FIR_DECIMATION;
+    descriptor->BTCTRL.reg = DMAC_BTCTRL_VALID |
+        DMAC_BTCTRL_BLOCKACT_NOACT |
+        DMAC_BTCTRL_EVOSEL_BLOCK |
+        DMAC_BTCTRL_DSTINC |
+        DMAC_BTCTRL_BEATSIZE_WORD;
+    descriptor->BTCNT.reg = words;
+    descriptor->DSTADDR.reg = (uint32_t)block + sizeof(uint32_t) * words;
+    #ifdef SAMD21
+    descriptor->SRCADDR.reg = (uint32_t)&I2S->DATA[self->serializer];
+    #endif
+    #ifdef SAM_D5X_E5X
+    descriptor->SRCADDR.reg = (uint32_t)&I2S->RXDATA;
+    #endif
+    descriptor->DESCADDR.reg = (uint32_t)next;
+}
+
+void common_hal_audiobusio_pdmin_start_recording(audiobusio_pdmin_obj_t *self, uint32_t buffer_length) {
+    if (active_recording != NULL) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Serializer in use"));
+    }
+    mp_arg_validate_int_min(buffer_length, RECORDING_SAMPLES_PER_BLOCK, MP_QSTR_buffer_length);
+
+    const size_t block_words = RECORDING_SAMPLES_PER_BLOCK * FIR_DECIMATION;
+    self->ring_length = buffer_length;
+    self->ring = m_malloc(buffer_length * (self->bit_depth / 8));
+    self->raw_blocks = m_new(uint32_t, 2 * block_words);
+    self->cic_table = m_new(uint16_t, CIC_TABLE_COUNT * 256);
+    self->cic_history = m_new(int16_t, FIR_HISTORY + block_words);
+    fill_cic_table(self->cic_table);
+    memset(self->cic_history, 0, FIR_HISTORY * sizeof(self->cic_history[0]));
+    self->cic_bits[0] = 0;
+    self->cic_bits[1] = 0;
+    self->ring_head = 0;
+    self->ring_count = 0;
+    self->blocks_done = 0;
+    self->blocks_processed = 0;
+
+    uint8_t dma_channel = dma_allocate_channel();
+    if (dma_channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("No DMA channel found"));
+    }
+    turn_on_event_system();
+    uint8_t event_channel = find_sync_event_channel();
+    if (event_channel >= EVSYS_SYNCH_NUM) {
+        dma_free_channel(dma_channel);
+        mp_raise_RuntimeError(MP_ERROR_TEXT("All sync event channels in use"));
+    }
+    self->dma_channel = dma_channel;
+    self->event_channel = event_channel;
+
+    // The two blocks are chained to each other so the DMA never stops.
+    DmacDescriptor *first_descriptor = dma_descriptor(dma_channel);
+    setup_recording_descriptor(self, first_descriptor, self->raw_blocks, &self->second_descriptor);
+    setup_recording_descriptor(self, &self->second_descriptor, self->raw_blocks + block_words,
+        first_descriptor);
+
+    uint8_t trigger_source = I2S_DMAC_ID_RX_0;
+    #ifdef SAMD21
+    trigger_source += self->serializer;
+    #endif
+    dma_configure(dma_channel, trigger_source, true);
+    init_event_channel_interrupt(event_channel, CORE_GCLK, EVSYS_ID_GEN_DMAC_CH_0 + dma_channel);
+
+    active_recording = self;
+    MP_STATE_PORT(pdmin_recording) = self;
+
+    #ifdef SAM_D5X_E5X
+    int irq = event_channel < 4 ? EVSYS_0_IRQn + event_channel : EVSYS_4_IRQn;
+    NVIC_ClearPendingIRQ(irq);
+    #endif
+    #ifdef SAMD21
+    int irq = EVSYS_IRQn;
+    #endif
+    NVIC_EnableIRQ(irq);
+
+    // Turn on serializer now to get it in sync with DMA.
+    i2s_set_serializer_enable(self->serializer, true);
+    audio_dma_enable_channel(dma_channel);
+}
+
+void common_hal_audiobusio_pdmin_stop_recording(audiobusio_pdmin_obj_t *self) {
+    if (active_recording != self) {
+        return;
+    }
+    audio_dma_disable_channel(self->dma_channel);
+    disable_event_channel(self->event_channel);
+    dma_free_channel(self->dma_channel);
+    // Turn off serializer, but leave clock on, to avoid mic startup delay.
+    i2s_set_serializer_enable(self->serializer, false);
+    active_recording = NULL;
+    MP_STATE_PORT(pdmin_recording) = NULL;
+
+    self->ring = NULL;
+    self->raw_blocks = NULL;
+    self->cic_table = NULL;
+    self->cic_history = NULL;
+    self->ring_count = 0;
+}
+
+bool common_hal_audiobusio_pdmin_get_recording(audiobusio_pdmin_obj_t *self) {
+    return active_recording == self;
+}
+
+uint32_t common_hal_audiobusio_pdmin_read_recording(audiobusio_pdmin_obj_t *self, void *buffer, uint32_t length) {
+    if (active_recording != self) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Not running"));
+    }
+    // Catch up on any finished block before handing out samples.
+    pdmin_recording_callback(self);
+
+    size_t sample_size = self->bit_depth / 8;
+    uint32_t count = MIN(length, self->ring_count);
+    uint32_t tail = (self->ring_head + self->ring_length - self->ring_count) % self->ring_length;
+    uint32_t first = MIN(count, self->ring_length - tail);
+    memcpy(buffer, self->ring + tail * sample_size, first * sample_size);
+    memcpy((uint8_t *)buffer + first * sample_size, self->ring, (count - first) * sample_size);
+    self->ring_count -= count;
+    return count;
+}
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t pdmin_recording);
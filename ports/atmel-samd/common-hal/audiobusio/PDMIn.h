@@ -31,9 +31,27 @@
 
 #include "extmod/vfs_fat.h"
 #include "py/obj.h"
+#include "supervisor/background_callback.h"
 
 typedef struct {
     mp_obj_base_t base;
+    // Continuous recording ping-pongs between two DMA descriptors chained to each other. Each
+    // finished block is decimated by a background callback into the sample ring. Linked
+    // descriptors must be 128-bit aligned.
+    DmacDescriptor second_descriptor __attribute__((aligned(16)));
+    background_callback_t callback;
+    uint32_t *raw_blocks;
+    uint16_t *cic_table;
+    int16_t *cic_history;
+    uint8_t *ring;
+    uint32_t ring_length;
+    uint32_t ring_head;
+    uint32_t ring_count;
+    volatile uint32_t blocks_done;
+    uint32_t blocks_processed;
+    uint16_t cic_bits[2];
+    uint8_t dma_channel;
+    uint8_t event_channel;
     const mcu_pin_obj_t *clock_pin;
     const mcu_pin_obj_t *data_pin;
     uint32_t sample_rate;
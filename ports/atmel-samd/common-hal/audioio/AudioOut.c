@@ -477,6 +477,10 @@ bool common_hal_audioio_audioout_get_paused(audioio_audioout_obj_t *self) {
     return audio_dma_get_paused(&self->left_dma);
 }
 
+mp_obj_t common_hal_audioio_audioout_get_stats(audioio_audioout_obj_t *self) {
+    return audiosample_output_stats_get(&self->left_dma.stats);
+}
+
 void common_hal_audioio_audioout_stop(audioio_audioout_obj_t *self) {
     // Do not stop the timer here. There are occasional audible artifacts if the DMA-triggering timer
     // is stopped between audio plays. (Heard this only on PyPortal with one particular 32kHz sample.)
@@ -25,6 +25,8 @@
  */
 
 #if CIRCUITPY_BUSIO_UART
+#include <string.h>
+
 #include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/busio/UART.h"
@@ -46,6 +48,12 @@
 
 #include "samd/sercom.h"
 
+#if BUSIO_UART_RX_DMA
+#include "audio_dma.h"
+#include "samd/dma.h"
+#include "samd/events.h"
+#endif
+
 #include "common-hal/busio/__init__.h"
 
 #define UART_DEBUG(...) (void)0
@@ -57,6 +65,146 @@ static void usart_async_rxc_callback(const struct usart_async_descriptor *const
     // Nothing needs to be done by us.
 }
 
+#if BUSIO_UART_RX_DMA
+// Below this baudrate the receive interrupt keeps up, so leave the few DMA channels for audio.
+#define RX_DMA_MIN_BAUDRATE (230400)
+
+// Indexed by SERCOM so the event interrupt can find the UARTs receiving through DMA.
+STATIC busio_uart_obj_t *rx_dma_uarts[SERCOM_INST_NUM];
+
+void uart_reset(void) {
+    for (size_t i = 0; i < SERCOM_INST_NUM; i++) {
+        rx_dma_uarts[i] = NULL;
+    }
+}
+
+void uart_evsys_handler(void) {
+    for (size_t i = 0; i < SERCOM_INST_NUM; i++) {
+        busio_uart_obj_t *self = rx_dma_uarts[i];
+        if (self != NULL && event_interrupt_active(self->rx_event_channel)) {
+            self->rx_dma_laps++;
+        }
+    }
+}
+
+STATIC bool rx_dma_active(busio_uart_obj_t *self) {
+    return self->rx_dma_channel < AUDIO_DMA_CHANNEL_COUNT;
+}
+
+// Receive into self->buffer with a DMA descriptor that chains to itself, so the only interrupt is
+// one event per trip around the buffer. Returns false, leaving receive to the RXC interrupt, when
+// no DMA or event channel is free.
+STATIC bool rx_dma_start(busio_uart_obj_t *self, Sercom *sercom, uint8_t sercom_index) {
+    self->rx_dma_channel = AUDIO_DMA_CHANNEL_COUNT;
+    if (self->baudrate < RX_DMA_MIN_BAUDRATE || self->buffer_length == 0) {
+        return false;
+    }
+    uint8_t dma_channel = dma_allocate_channel();
+    if (dma_channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        return false;
+    }
+    turn_on_event_system();
+    uint8_t event_channel = find_sync_event_channel();
+    if (event_channel >= EVSYS_SYNCH_NUM) {
+        dma_free_channel(dma_channel);
+        return false;
+    }
+    init_event_channel_interrupt(event_channel, CORE_GCLK, EVSYS_ID_GEN_DMAC_CH_0 + dma_channel);
+
+    DmacDescriptor *descriptor = dma_descriptor(dma_channel);
+    descriptor->BTCTRL.reg = DMAC_BTCTRL_VALID |
+        DMAC_BTCTRL_BLOCKACT_NOACT |
+        DMAC_BTCTRL_EVOSEL_BLOCK |
+        DMAC_BTCTRL_DSTINC |
+        DMAC_BTCTRL_BEATSIZE_BYTE;
+    descriptor->BTCNT.reg = self->buffer_length;
+    descriptor->SRCADDR.reg = (uint32_t)&sercom->USART.DATA.reg;
+    // With DSTINC, DSTADDR is the end of the buffer.
+    descriptor->DSTADDR.reg = (uint32_t)self->buffer + self->buffer_length;
+    descriptor->DESCADDR.reg = (uint32_t)descriptor;
+    // The write-back descriptor may hold a count from the channel's last user until the first byte
+    // arrives, so start it out as an empty buffer.
+    dma_write_back_descriptor(dma_channel)->BTCNT.reg = self->buffer_length;
+
+    self->rx_dma_channel = dma_channel;
+    self->rx_event_channel = event_channel;
+    self->rx_dma_laps = 0;
+    self->rx_head = 0;
+    self->rx_tail = 0;
+    rx_dma_uarts[sercom_index] = self;
+
+    #ifdef SAM_D5X_E5X
+    int irq = event_channel < 4 ? EVSYS_0_IRQn + event_channel : EVSYS_4_IRQn;
+    NVIC_ClearPendingIRQ(irq);
+    #else
+    // The SAMD21 shares EVSYS with ticks, so don't clear it.
+    int irq = EVSYS_IRQn;
+    #endif
+    NVIC_EnableIRQ(irq);
+
+    // RX DMA triggers follow the TX ones for each SERCOM.
+    dma_configure(dma_channel, SERCOM0_DMAC_ID_RX + 2 * sercom_index, true);
+    dma_enable_channel(dma_channel);
+    return true;
+}
+
+STATIC void rx_dma_stop(busio_uart_obj_t *self) {
+    if (!rx_dma_active(self)) {
+        return;
+    }
+    dma_disable_channel(self->rx_dma_channel);
+    disable_event_channel(self->rx_event_channel);
+    dma_free_channel(self->rx_dma_channel);
+    for (size_t i = 0; i < SERCOM_INST_NUM; i++) {
+        if (rx_dma_uarts[i] == self) {
+            rx_dma_uarts[i] = NULL;
+        }
+    }
+    self->rx_dma_channel = AUDIO_DMA_CHANNEL_COUNT;
+}
+
+// Update and return the count of bytes the DMA has written.
+STATIC uint32_t rx_dma_head(busio_uart_obj_t *self) {
+    uint8_t channel = self->rx_dma_channel;
+    uint32_t laps;
+    uint32_t remaining;
+    do {
+        laps = self->rx_dma_laps;
+        // The write-back descriptor is only current while the channel waits for a trigger.
+        uint32_t active = DMAC->ACTIVE.reg;
+        if ((active & DMAC_ACTIVE_ABUSY) &&
+            ((active & DMAC_ACTIVE_ID_Msk) >> DMAC_ACTIVE_ID_Pos) == channel) {
+            remaining = (active & DMAC_ACTIVE_BTCNT_Msk) >> DMAC_ACTIVE_BTCNT_Pos;
+        } else {
+            remaining = dma_write_back_descriptor(channel)->BTCNT.reg;
+        }
+    } while (laps != self->rx_dma_laps);
+    uint32_t head = (laps + 1) * self->buffer_length - remaining;
+    // The DMA reloads the count a moment before the event interrupt counts the lap.
+    if ((int32_t)(head - self->rx_head) < 0) {
+        head += self->buffer_length;
+    }
+    self->rx_head = head;
+    return head;
+}
+
+// Copy out up to len received bytes. If the DMA lapped the reader, the oldest bytes were lost and
+// the read restarts at the oldest byte still in the buffer.
+STATIC size_t rx_dma_read(busio_uart_obj_t *self, uint8_t *data, size_t len) {
+    uint32_t head = rx_dma_head(self);
+    if (head - self->rx_tail > self->buffer_length) {
+        self->rx_tail = head - self->buffer_length;
+    }
+    size_t count = MIN(len, head - self->rx_tail);
+    size_t start = self->rx_tail & (self->buffer_length - 1);
+    size_t first = MIN(count, self->buffer_length - start);
+    memcpy(data, self->buffer + start, first);
+    memcpy(data + first, self->buffer, count - first);
+    self->rx_tail += count;
+    return count;
+}
+#endif
+
 // shared-bindings validates that the tx and rx are not both missing,
 // and that the pins are distinct.
 void common_hal_busio_uart_construct(busio_uart_obj_t *self,
@@ -81,6 +229,9 @@ void common_hal_busio_uart_construct(busio_uart_obj_t *self,
     self->tx_pin = NO_PIN;
     self->rts_pin = NO_PIN;
     self->cts_pin = NO_PIN;
+    #if BUSIO_UART_RX_DMA
+    self->rx_dma_channel = AUDIO_DMA_CHANNEL_COUNT;
+    #endif
 
     if ((rs485_dir != NULL) || (rs485_invert)) {
         mp_raise_NotImplementedError(MP_ERROR_TEXT("RS485"));
@@ -300,8 +451,13 @@ void common_hal_busio_uart_construct(busio_uart_obj_t *self,
     // Different read function behavior in some asynchronous drivers. As of this writing:
     // http://start.atmel.com/static/help/index.html?GUID-79201A5A-226F-4FBB-B0B8-AB0BE0554836
     // Look at the ASFv4 code example for async USART.
-    usart_async_register_callback(usart_desc_p, USART_ASYNC_RXC_CB, usart_async_rxc_callback);
-
+    #if BUSIO_UART_RX_DMA
+    // The DMA takes the received bytes instead, so the RXC interrupt stays off.
+    if (!(have_rx && rx_dma_start(self, sercom, sercom_index)))
+    #endif
+    {
+        usart_async_register_callback(usart_desc_p, USART_ASYNC_RXC_CB, usart_async_rxc_callback);
+    }
 
     if (have_tx) {
         gpio_set_pin_direction(tx->number, GPIO_DIRECTION_OUT);
@@ -353,6 +509,15 @@ void common_hal_busio_uart_never_reset(busio_uart_obj_t *self) {
 
         // Reserve pins for active UART only
         if (sercom == hw) {
+            #if BUSIO_UART_RX_DMA
+            // DMA and event channels are reset with the VM, so go back to receiving through
+            // interrupts. Bytes the DMA received but that weren't read yet are dropped.
+            if (rx_dma_active(self)) {
+                rx_dma_stop(self);
+                usart_async_flush_rx_buffer(&self->usart_desc);
+                usart_async_register_callback(&self->usart_desc, USART_ASYNC_RXC_CB, usart_async_rxc_callback);
+            }
+            #endif
             never_reset_sercom(hw);
             never_reset_pin_number(self->rx_pin);
             never_reset_pin_number(self->tx_pin);
@@ -373,6 +538,9 @@ void common_hal_busio_uart_deinit(busio_uart_obj_t *self) {
     }
     // This assignment is only here because the usart_async routines take a *const argument.
     struct usart_async_descriptor *const usart_desc_p = (struct usart_async_descriptor *const)&self->usart_desc;
+    #if BUSIO_UART_RX_DMA
+    rx_dma_stop(self);
+    #endif
     usart_async_disable(usart_desc_p);
     usart_async_deinit(usart_desc_p);
     reset_pin_number(self->rx_pin);
@@ -408,7 +576,11 @@ size_t common_hal_busio_uart_read(busio_uart_obj_t *self, uint8_t *data, size_t
     // Busy-wait until timeout or until we've read enough chars.
     while (supervisor_ticks_ms64() - start_ticks <= self->timeout_ms) {
         // Read as many chars as we can right now, up to len.
+        #if BUSIO_UART_RX_DMA
+        size_t num_read = rx_dma_active(self) ? rx_dma_read(self, data, len) : (size_t)io_read(io, data, len);
+        #else
         size_t num_read = io_read(io, data, len);
+        #endif
 
         // Advance pointer in data buffer, and decrease how many chars left to read.
         data += num_read;
@@ -502,6 +674,11 @@ void common_hal_busio_uart_set_timeout(busio_uart_obj_t *self, mp_float_t timeou
 }
 
 uint32_t common_hal_busio_uart_rx_characters_available(busio_uart_obj_t *self) {
+    #if BUSIO_UART_RX_DMA
+    if (rx_dma_active(self)) {
+        return MIN(rx_dma_head(self) - self->rx_tail, self->buffer_length);
+    }
+    #endif
     // This assignment is only here because the usart_async routines take a *const argument.
     struct usart_async_descriptor *const usart_desc_p = (struct usart_async_descriptor *const)&self->usart_desc;
     struct usart_async_status async_status;
@@ -510,6 +687,12 @@ uint32_t common_hal_busio_uart_rx_characters_available(busio_uart_obj_t *self) {
 }
 
 void common_hal_busio_uart_clear_rx_buffer(busio_uart_obj_t *self) {
+    #if BUSIO_UART_RX_DMA
+    if (rx_dma_active(self)) {
+        self->rx_tail = rx_dma_head(self);
+        return;
+    }
+    #endif
     // This assignment is only here because the usart_async routines take a *const argument.
     struct usart_async_descriptor *const usart_desc_p = (struct usart_async_descriptor *const)&self->usart_desc;
     usart_async_flush_rx_buffer(usart_desc_p);
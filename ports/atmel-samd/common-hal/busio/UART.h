@@ -33,6 +33,10 @@
 
 #include "py/obj.h"
 
+// Fast UARTs receive through a DMA channel borrowed from the allocator in audio_dma.c, which is
+// only reset when audioio is present.
+#define BUSIO_UART_RX_DMA (CIRCUITPY_AUDIOIO)
+
 typedef struct {
     mp_obj_base_t base;
     struct usart_async_descriptor usart_desc;
@@ -46,6 +50,22 @@ typedef struct {
     uint32_t timeout_ms;
     uint32_t buffer_length;
     uint8_t *buffer;
+    #if BUSIO_UART_RX_DMA
+    // Set to AUDIO_DMA_CHANNEL_COUNT when receiving through interrupts instead.
+    uint8_t rx_dma_channel;
+    uint8_t rx_event_channel;
+    // Bumped by the event interrupt each time the DMA wraps around the buffer.
+    volatile uint32_t rx_dma_laps;
+    // Counts of bytes written by the DMA and read by Python since the DMA started. Only their
+    // difference matters, so they are free to overflow.
+    uint32_t rx_head;
+    uint32_t rx_tail;
+    #endif
 } busio_uart_obj_t;
 
+#if BUSIO_UART_RX_DMA
+void uart_evsys_handler(void);
+void uart_reset(void);
+#endif
+
 #endif // MICROPY_INCLUDED_ATMEL_SAMD_COMMON_HAL_BUSIO_UART_H
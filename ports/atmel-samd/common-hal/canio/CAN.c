@@ -223,6 +223,15 @@ void common_hal_canio_can_construct(canio_can_obj_t *self, const mcu_pin_obj_t *
         hri_can_write_IE_reg(self->hw, ie.reg);
     }
 
+    // Count bit times, so received messages carry a timestamp.
+    {
+        CAN_TSCC_Type tscc = {
+            .bit.TCP = 0,
+            .bit.TSS = CAN_TSCC_TSS_INC_Val,
+        };
+        hri_can_write_TSCC_reg(self->hw, tscc.reg);
+    }
+
     hri_can_write_XIDAM_reg(self->hw, CAN_XIDAM_RESETVALUE);
 
 // silent: The CAN is set in Bus Monitoring Mode by programming CCCR.MON to '1'. (tx pin unused)
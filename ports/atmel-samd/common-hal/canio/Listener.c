@@ -351,39 +351,73 @@ int common_hal_canio_listener_in_waiting(canio_listener_obj_t *self) {
     return self->hw->RXFS.bit.F0FL;
 }
 
-mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+STATIC bool wait_for_message(canio_listener_obj_t *self) {
     if (!common_hal_canio_listener_in_waiting(self)) {
         uint64_t deadline = supervisor_ticks_ms64() + self->timeout_ms;
         do {
             if (supervisor_ticks_ms64() > deadline) {
-                return NULL;
+                return false;
             }
             RUN_BACKGROUND_TASKS;
             // Allow user to break out of a timeout with a KeyboardInterrupt.
             if (mp_hal_is_interrupted()) {
-                return NULL;
+                return false;
             }
         } while (!common_hal_canio_listener_in_waiting(self));
     }
+    return true;
+}
+
+// Copy the oldest message out of the message RAM and hand its FIFO element back to the peripheral.
+STATIC void read_record(canio_listener_obj_t *self, canio_listener_record_t *record) {
     int index = self->hw->RXFS.bit.F0GI;
     canio_can_rx_fifo_t *hw_message = &self->fifo[index];
+    bool extended = hw_message->rxf0.bit.XTD;
     bool rtr = hw_message->rxf0.bit.RTR;
-    canio_message_obj_t *message =
-        mp_obj_malloc(canio_message_obj_t, rtr ? &canio_remote_transmission_request_type : &canio_message_type);
-    message->extended = hw_message->rxf0.bit.XTD;
-    if (message->extended) {
-        message->id = hw_message->rxf0.bit.ID;
+    if (extended) {
+        record->id = hw_message->rxf0.bit.ID;
     } else {
-        message->id = hw_message->rxf0.bit.ID >> 18; // short ids are left-justified
+        record->id = hw_message->rxf0.bit.ID >> 18; // short ids are left-justified
     }
-    message->size = hw_message->rxf1.bit.DLC;
+    record->timestamp = hw_message->rxf1.bit.RXTS;
+    record->flags = (extended ? CANIO_LISTENER_RECORD_EXTENDED : 0) | (rtr ? CANIO_LISTENER_RECORD_RTR : 0);
+    record->size = hw_message->rxf1.bit.DLC;
+    memset(record->data, 0, sizeof(record->data));
     if (!rtr) {
-        memcpy(message->data, hw_message->data, message->size);
+        memcpy(record->data, hw_message->data, record->size);
     }
     self->hw->RXFA.bit.F0AI = index;
+}
+
+mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+    if (!wait_for_message(self)) {
+        return NULL;
+    }
+    canio_listener_record_t record;
+    read_record(self, &record);
+    bool rtr = record.flags & CANIO_LISTENER_RECORD_RTR;
+    canio_message_obj_t *message =
+        mp_obj_malloc(canio_message_obj_t, rtr ? &canio_remote_transmission_request_type : &canio_message_type);
+    message->extended = record.flags & CANIO_LISTENER_RECORD_EXTENDED;
+    message->id = record.id;
+    message->size = record.size;
+    if (!rtr) {
+        memcpy(message->data, record.data, message->size);
+    }
     return message;
 }
 
+size_t common_hal_canio_listener_receive_into(canio_listener_obj_t *self, canio_listener_record_t *records, size_t count) {
+    if (!wait_for_message(self)) {
+        return 0;
+    }
+    size_t n = 0;
+    while (n < count && common_hal_canio_listener_in_waiting(self)) {
+        read_record(self, &records[n++]);
+    }
+    return n;
+}
+
 void common_hal_canio_listener_deinit(canio_listener_obj_t *self) {
     if (self->can) {
         clear_filters(self);
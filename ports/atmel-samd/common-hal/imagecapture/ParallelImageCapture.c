@@ -41,6 +41,7 @@
 #include "audio_dma.h"
 #include "samd/clocks.h"
 #include "samd/events.h"
+#include "supervisor/shared/tick.h"
 
 #define GPIO_PIN_FUNCTION_PCC (GPIO_PIN_FUNCTION_K)
 
@@ -49,6 +50,17 @@
 #define PIN_PCC_DEN2 (PIN_PA13)
 #define PIN_PCC_CLK (PIN_PA14)
 
+enum {
+    FRAME_FREE,
+    FRAME_FILLING,
+    FRAME_FILLED,
+    FRAME_ACQUIRED,
+};
+
+// There is only one PCC so at most one continuous capture runs at a time. The object is also a
+// root pointer so it can't be collected while the DMA writes into its buffers.
+STATIC imagecapture_parallelimagecapture_obj_t *active_capture;
+
 void common_hal_imagecapture_parallelimagecapture_construct(imagecapture_parallelimagecapture_obj_t *self,
     const uint8_t data_pins[],
     uint8_t data_count,
@@ -93,6 +105,9 @@ void common_hal_imagecapture_parallelimagecapture_construct(imagecapture_paralle
 
     PCC->MR.bit.PCEN = 1; // Enable PCC
 
+    self->buffer_count = 0;
+    self->dma_channel = AUDIO_DMA_CHANNEL_COUNT;
+    self->get_frame_index = -1;
 
     // Now we know we can allocate all pins
     self->data_count = data_count;
@@ -126,6 +141,7 @@ void common_hal_imagecapture_parallelimagecapture_deinit(imagecapture_parallelim
     if (common_hal_imagecapture_parallelimagecapture_deinited(self)) {
         return;
     }
+    common_hal_imagecapture_parallelimagecapture_continuous_capture_stop(self);
     reset_pin_number(self->vertical_sync);
     reset_pin_number(self->horizontal_reference);
     reset_pin_number(PIN_PCC_CLK);
@@ -151,7 +167,27 @@ static void setup_dma(DmacDescriptor *descriptor, size_t count, uint32_t *buffer
     descriptor->DESCADDR.reg = 0;
 }
 
+STATIC bool wait_for_vsync(imagecapture_parallelimagecapture_obj_t *self) {
+    if (self->vertical_sync) {
+        const volatile uint32_t *vsync_reg = &PORT->Group[(self->vertical_sync / 32)].IN.reg;
+        uint32_t vsync_bit = 1 << (self->vertical_sync % 32);
+
+        while (*vsync_reg & vsync_bit) {
+            // Wait for VSYNC low (frame end)
+
+            RUN_BACKGROUND_TASKS;
+            // Allow user to break out of a timeout with a KeyboardInterrupt.
+            if (mp_hal_is_interrupted()) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 void common_hal_imagecapture_parallelimagecapture_singleshot_capture(imagecapture_parallelimagecapture_obj_t *self, mp_obj_t buffer) {
+    common_hal_imagecapture_parallelimagecapture_continuous_capture_stop(self);
+
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_RW);
 
@@ -165,20 +201,9 @@ void common_hal_imagecapture_parallelimagecapture_singleshot_capture(imagecaptur
     setup_dma(dma_descriptor(dma_channel), count, dest);
     dma_configure(dma_channel, PCC_DMAC_ID_RX, true);
 
-    if (self->vertical_sync) {
-        const volatile uint32_t *vsync_reg = &PORT->Group[(self->vertical_sync / 32)].IN.reg;
-        uint32_t vsync_bit = 1 << (self->vertical_sync % 32);
-
-        while (*vsync_reg & vsync_bit) {
-            // Wait for VSYNC low (frame end)
-
-            RUN_BACKGROUND_TASKS;
-            // Allow user to break out of a timeout with a KeyboardInterrupt.
-            if (mp_hal_is_interrupted()) {
-                dma_free_channel(dma_channel);
-                return;
-            }
-        }
+    if (!wait_for_vsync(self)) {
+        dma_free_channel(dma_channel);
+        return;
     }
 
     dma_enable_channel(dma_channel);
@@ -193,3 +218,210 @@ void common_hal_imagecapture_parallelimagecapture_singleshot_capture(imagecaptur
     dma_disable_channel(dma_channel);
     dma_free_channel(dma_channel);
 }
+
+// Picks the buffer that the idle descriptor fills next. Prefer a free buffer, then reuse the oldest
+// filled frame as long as a newer one stays available. Otherwise point at the buffer that is being
+// filled now, which drops the next frame instead.
+STATIC uint8_t next_capture_buffer(imagecapture_parallelimagecapture_obj_t *self, uint8_t running_buffer) {
+    int oldest = -1;
+    uint8_t filled_count = 0;
+    for (uint8_t i = 0; i < self->buffer_count; i++) {
+        if (self->frame_state[i] == FRAME_FREE) {
+            self->frame_state[i] = FRAME_FILLING;
+            return i;
+        }
+        if (self->frame_state[i] == FRAME_FILLED) {
+            filled_count++;
+            if (oldest < 0 || (int32_t)(self->frame_sequence[i] - self->frame_sequence[oldest]) < 0) {
+                oldest = i;
+            }
+        }
+    }
+    if (filled_count > 1) {
+        self->dropped_frames++;
+        self->frame_state[oldest] = FRAME_FILLING;
+        return oldest;
+    }
+    return running_buffer;
+}
+
+void imagecapture_evsys_handler(void) {
+    imagecapture_parallelimagecapture_obj_t *self = active_capture;
+    if (self == NULL || !event_interrupt_active(self->event_channel)) {
+        return;
+    }
+    // Like audio_dma_evsys_handler, the write-back descriptor is already the running one so the
+    // descriptor it chains to is the one that just finished.
+    DmacDescriptor *done_descriptor =
+        (DmacDescriptor *)dma_write_back_descriptor(self->dma_channel)->DESCADDR.reg;
+    uint8_t done = done_descriptor == dma_descriptor(self->dma_channel) ? 0 : 1;
+    uint8_t filled_buffer = self->descriptor_buffer[done];
+    uint8_t running_buffer = self->descriptor_buffer[1 - done];
+    if (filled_buffer == running_buffer) {
+        // Both descriptors target the same buffer so this frame is already being overwritten.
+        self->dropped_frames++;
+    } else {
+        self->frame_state[filled_buffer] = FRAME_FILLED;
+        self->frame_sequence[filled_buffer] = self->next_sequence++;
+    }
+    uint8_t next_buffer = next_capture_buffer(self, running_buffer);
+    self->descriptor_buffer[done] = next_buffer;
+    done_descriptor->DSTADDR.reg = (uint32_t)self->buffer_data[next_buffer] + 4 * self->frame_words;
+}
+
+void imagecapture_reset(void) {
+    if (active_capture != NULL) {
+        common_hal_imagecapture_parallelimagecapture_continuous_capture_stop(active_capture);
+    }
+}
+
+void common_hal_imagecapture_parallelimagecapture_continuous_capture_start(imagecapture_parallelimagecapture_obj_t *self, size_t n_buffers, const mp_obj_t *buffers) {
+    mp_arg_validate_length_range(n_buffers, 2, IMAGECAPTURE_MAX_FRAMES, MP_QSTR_buffers);
+    if (active_capture != NULL) {
+        common_hal_imagecapture_parallelimagecapture_continuous_capture_stop(active_capture);
+    }
+
+    size_t frame_length = 0;
+    for (size_t i = 0; i < n_buffers; i++) {
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(buffers[i], &bufinfo, MP_BUFFER_RW);
+        if (i == 0) {
+            frame_length = bufinfo.len;
+        }
+        mp_arg_validate_length(bufinfo.len, frame_length, MP_QSTR_buffers);
+        self->buffers[i] = buffers[i];
+        self->buffer_data[i] = bufinfo.buf;
+        self->frame_state[i] = FRAME_FREE;
+    }
+
+    uint8_t dma_channel = dma_allocate_channel();
+    if (dma_channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("No DMA channel found"));
+    }
+
+    turn_on_event_system();
+    uint8_t event_channel = find_sync_event_channel();
+    if (event_channel >= EVSYS_SYNCH_NUM) {
+        dma_free_channel(dma_channel);
+        mp_raise_RuntimeError(MP_ERROR_TEXT("All sync event channels in use"));
+    }
+    init_event_channel_interrupt(event_channel, CORE_GCLK, EVSYS_ID_GEN_DMAC_CH_0 + dma_channel);
+
+    self->buffer_count = n_buffers;
+    self->frame_words = frame_length / 4; // PCC receives 4 bytes (2 pixels) at a time
+    self->dma_channel = dma_channel;
+    self->event_channel = event_channel;
+    self->dropped_frames = 0;
+    self->next_sequence = 0;
+    self->get_frame_index = -1;
+
+    // Chain the two descriptors to each other and start on the first two buffers.
+    DmacDescriptor *first_descriptor = dma_descriptor(dma_channel);
+    setup_dma(first_descriptor, self->frame_words, self->buffer_data[0]);
+    setup_dma(&self->second_descriptor, self->frame_words, self->buffer_data[1]);
+    first_descriptor->DESCADDR.reg = (uint32_t)&self->second_descriptor;
+    self->second_descriptor.DESCADDR.reg = (uint32_t)first_descriptor;
+    self->descriptor_buffer[0] = 0;
+    self->descriptor_buffer[1] = 1;
+    self->frame_state[0] = FRAME_FILLING;
+    self->frame_state[1] = FRAME_FILLING;
+
+    dma_configure(dma_channel, PCC_DMAC_ID_RX, true);
+
+    active_capture = self;
+    MP_STATE_PORT(imagecapture_active) = self;
+
+    int irq = event_channel < 4 ? EVSYS_0_IRQn + event_channel : EVSYS_4_IRQn;
+    NVIC_ClearPendingIRQ(irq);
+    NVIC_EnableIRQ(irq);
+
+    if (!wait_for_vsync(self)) {
+        common_hal_imagecapture_parallelimagecapture_continuous_capture_stop(self);
+        return;
+    }
+    dma_enable_channel(dma_channel);
+}
+
+void common_hal_imagecapture_parallelimagecapture_continuous_capture_stop(imagecapture_parallelimagecapture_obj_t *self) {
+    if (active_capture != self) {
+        return;
+    }
+    dma_disable_channel(self->dma_channel);
+    disable_event_channel(self->event_channel);
+    dma_free_channel(self->dma_channel);
+    active_capture = NULL;
+    MP_STATE_PORT(imagecapture_active) = NULL;
+    for (uint8_t i = 0; i < self->buffer_count; i++) {
+        self->buffers[i] = MP_OBJ_NULL;
+        self->buffer_data[i] = NULL;
+    }
+    self->buffer_count = 0;
+    self->dma_channel = AUDIO_DMA_CHANNEL_COUNT;
+    self->get_frame_index = -1;
+}
+
+mp_obj_t common_hal_imagecapture_parallelimagecapture_continuous_capture_acquire_frame(imagecapture_parallelimagecapture_obj_t *self, mp_float_t timeout) {
+    uint64_t start_ticks = supervisor_ticks_ms64();
+    while (true) {
+        if (active_capture != self) {
+            mp_raise_RuntimeError(MP_ERROR_TEXT("Not running"));
+        }
+        // Hand out the oldest filled frame.
+        int oldest = -1;
+        common_hal_mcu_disable_interrupts();
+        for (uint8_t i = 0; i < self->buffer_count; i++) {
+            if (self->frame_state[i] == FRAME_FILLED &&
+                (oldest < 0 || (int32_t)(self->frame_sequence[i] - self->frame_sequence[oldest]) < 0)) {
+                oldest = i;
+            }
+        }
+        if (oldest >= 0) {
+            self->frame_state[oldest] = FRAME_ACQUIRED;
+        }
+        common_hal_mcu_enable_interrupts();
+        if (oldest >= 0) {
+            return self->buffers[oldest];
+        }
+        if (timeout >= 0 && supervisor_ticks_ms64() - start_ticks >= (uint64_t)(timeout * 1000)) {
+            return mp_const_none;
+        }
+        RUN_BACKGROUND_TASKS;
+        // Allow user to break out of a timeout with a KeyboardInterrupt.
+        if (mp_hal_is_interrupted()) {
+            return mp_const_none;
+        }
+    }
+}
+
+void common_hal_imagecapture_parallelimagecapture_continuous_capture_release_frame(imagecapture_parallelimagecapture_obj_t *self, mp_obj_t frame) {
+    for (uint8_t i = 0; i < self->buffer_count; i++) {
+        if (self->buffers[i] == frame && self->frame_state[i] == FRAME_ACQUIRED) {
+            self->frame_state[i] = FRAME_FREE;
+            if (self->get_frame_index == i) {
+                self->get_frame_index = -1;
+            }
+            return;
+        }
+    }
+    mp_arg_error_invalid(MP_QSTR_frame);
+}
+
+mp_obj_t common_hal_imagecapture_parallelimagecapture_continuous_capture_get_frame(imagecapture_parallelimagecapture_obj_t *self) {
+    if (self->get_frame_index >= 0 && self->frame_state[self->get_frame_index] == FRAME_ACQUIRED) {
+        self->frame_state[self->get_frame_index] = FRAME_FREE;
+    }
+    self->get_frame_index = -1;
+    mp_obj_t frame = common_hal_imagecapture_parallelimagecapture_continuous_capture_acquire_frame(self, -1);
+    for (uint8_t i = 0; i < self->buffer_count; i++) {
+        if (self->buffers[i] == frame) {
+            self->get_frame_index = i;
+        }
+    }
+    return frame;
+}
+
+uint32_t common_hal_imagecapture_parallelimagecapture_get_dropped_frames(imagecapture_parallelimagecapture_obj_t *self) {
+    return self->dropped_frames;
+}
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t imagecapture_active);
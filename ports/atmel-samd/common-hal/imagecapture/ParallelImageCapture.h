@@ -28,7 +28,29 @@
 
 #include "shared-bindings/imagecapture/ParallelImageCapture.h"
 
+#define IMAGECAPTURE_MAX_FRAMES (8)
+
 struct imagecapture_parallelimagecapture_obj {
     mp_obj_base_t base;
+    // Continuous capture ping-pongs between two DMA descriptors. When one finishes, the
+    // event interrupt points it at the next buffer in the ring that isn't acquired. Linked
+    // descriptors must be 128-bit aligned.
+    DmacDescriptor second_descriptor __attribute__((aligned(16)));
+    mp_obj_t buffers[IMAGECAPTURE_MAX_FRAMES];
+    uint32_t *buffer_data[IMAGECAPTURE_MAX_FRAMES];
+    volatile uint32_t frame_sequence[IMAGECAPTURE_MAX_FRAMES];
+    volatile uint8_t frame_state[IMAGECAPTURE_MAX_FRAMES];
+    volatile uint8_t descriptor_buffer[2];
+    volatile uint32_t dropped_frames;
+    uint32_t next_sequence;
+    size_t frame_words;
+    uint8_t buffer_count;
+    uint8_t dma_channel;
+    uint8_t event_channel;
+    // Buffer returned by continuous_capture_get_frame, released on the next call.
+    int8_t get_frame_index;
     uint8_t data_pin, data_clock, vertical_sync, horizontal_reference, data_count;
 };
+
+void imagecapture_evsys_handler(void);
+void imagecapture_reset(void);
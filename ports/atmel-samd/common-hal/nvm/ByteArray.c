@@ -44,7 +44,22 @@ bool common_hal_nvm_bytearray_set_bytes(const nvm_bytearray_obj_t *self,
     // whenever we need it instead of storing it long term.
     struct flash_descriptor desc;
     desc.dev.hw = NVMCTRL;
-    bool status = flash_write(&desc, (uint32_t)self->start_address + start_index, values, len) == ERR_NONE;
+    // flash_write() erases the rows it touches. Programming can only clear bits, so skip the
+    // erase with flash_append() when no bit goes from 0 to 1.
+    bool only_clears_bits = true;
+    for (uint32_t i = 0; i < len; i++) {
+        if ((self->start_address[start_index + i] & values[i]) != values[i]) {
+            only_clears_bits = false;
+            break;
+        }
+    }
+    uint32_t address = (uint32_t)self->start_address + start_index;
+    bool status;
+    if (only_clears_bits) {
+        status = flash_append(&desc, address, values, len) == ERR_NONE;
+    } else {
+        status = flash_write(&desc, address, values, len) == ERR_NONE;
+    }
     assert_heap_ok();
     return status;
 }
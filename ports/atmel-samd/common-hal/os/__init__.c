@@ -24,6 +24,8 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "genhdr/mpversion.h"
 #include "py/mpconfig.h"
 #include "py/objstr.h"
@@ -75,7 +77,14 @@ bool common_hal_os_urandom(uint8_t *buffer, mp_uint_t length) {
     rand_sync_init(&random, TRNG);
     rand_sync_enable(&random);
 
-    rand_sync_read_buf8(&random, buffer, length);
+    // Each TRNG sample is 32 bits, so use all of them instead of one per byte.
+    while (length > 0) {
+        uint32_t sample = rand_sync_read32(&random);
+        size_t n = MIN(length, sizeof(sample));
+        memcpy(buffer, &sample, n);
+        buffer += n;
+        length -= n;
+    }
 
     rand_sync_disable(&random);
     rand_sync_deinit(&random);
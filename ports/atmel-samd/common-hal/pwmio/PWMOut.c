@@ -263,7 +263,9 @@ void common_hal_pwmio_pwmout_deinit(pwmio_pwmout_obj_t *self) {
     self->pin = NULL;
 }
 
-extern void common_hal_pwmio_pwmout_set_duty_cycle(pwmio_pwmout_obj_t *self, uint16_t duty) {
+// Write the duty cycle into the buffered compare register. The caller must
+// set LUPD on a TCC before calling this and clear it afterwards.
+static void pwmout_write_duty_cycle(pwmio_pwmout_obj_t *self, uint16_t duty) {
     // Store the unadjusted duty cycle. It turns out the the process of adjusting and calculating
     // the duty cycle here and reading it back is lossy - the value will decay over time.
     // Track it here so that if frequency is changed we can use this value to recalculate the
@@ -290,20 +292,57 @@ extern void common_hal_pwmio_pwmout_set_duty_cycle(pwmio_pwmout_obj_t *self, uin
 
         // Write into the CC buffer register, which will be transferred to the
         // CC register on an UPDATE (when period is finished).
-        // Do clock domain syncing as necessary.
-
-        while (tcc->SYNCBUSY.reg != 0) {
-        }
-
-        // Lock out double-buffering while updating the CCB value.
-        tcc->CTRLBSET.bit.LUPD = 1;
         #ifdef SAMD21
         tcc->CCB[channel].reg = adjusted_duty;
         #endif
         #ifdef SAM_D5X_E5X
         tcc->CCBUF[channel].reg = adjusted_duty;
         #endif
-        tcc->CTRLBCLR.bit.LUPD = 1;
+    }
+}
+
+// Lock out double-buffering while updating the CCB values.
+static void tcc_lock_update(uint8_t index) {
+    Tcc *tcc = tcc_insts[index];
+    // Do clock domain syncing as necessary.
+    while (tcc->SYNCBUSY.reg != 0) {
+    }
+    tcc->CTRLBSET.bit.LUPD = 1;
+}
+
+static void tcc_unlock_update(uint8_t index) {
+    tcc_insts[index]->CTRLBCLR.bit.LUPD = 1;
+}
+
+extern void common_hal_pwmio_pwmout_set_duty_cycle(pwmio_pwmout_obj_t *self, uint16_t duty) {
+    const pin_timer_t *t = self->timer;
+    if (!t->is_tc) {
+        tcc_lock_update(t->index);
+    }
+    pwmout_write_duty_cycle(self, duty);
+    if (!t->is_tc) {
+        tcc_unlock_update(t->index);
+    }
+}
+
+void common_hal_pwmio_pwmout_set_duty_cycles(pwmio_pwmout_obj_t **pwms, const uint16_t *duty_cycles, size_t count) {
+    // Keep every TCC involved from picking up any of the new values until all
+    // of them are written, so that each TCC applies them at one UPDATE.
+    uint32_t locked = 0;
+    for (size_t i = 0; i < count; i++) {
+        const pin_timer_t *t = pwms[i]->timer;
+        if (!t->is_tc && (locked & (1 << t->index)) == 0) {
+            tcc_lock_update(t->index);
+            locked |= 1 << t->index;
+        }
+    }
+    for (size_t i = 0; i < count; i++) {
+        pwmout_write_duty_cycle(pwms[i], duty_cycles[i]);
+    }
+    for (uint8_t index = 0; index < TCC_INST_NUM; index++) {
+        if (locked & (1 << index)) {
+            tcc_unlock_update(index);
+        }
     }
 }
 
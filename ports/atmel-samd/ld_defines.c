@@ -28,3 +28,5 @@
 
 /*CIRCUITPY_INTERNAL_FLASH_FILESYSTEM_START_ADDR=*/ CIRCUITPY_INTERNAL_FLASH_FILESYSTEM_START_ADDR;
 /*CIRCUITPY_INTERNAL_FLASH_FILESYSTEM_SIZE=*/ CIRCUITPY_INTERNAL_FLASH_FILESYSTEM_SIZE;
+
+/*CIRCUITPY_NATIVE_CODE_RAM_SIZE=*/ CIRCUITPY_NATIVE_CODE_RAM_SIZE;
@@ -73,10 +73,18 @@
 #include "common-hal/busio/__init__.h"
 #endif
 
+#if CIRCUITPY_BUSIO_UART
+#include "common-hal/busio/UART.h"
+#endif
+
 #if CIRCUITPY_FREQUENCYIO
 #include "common-hal/frequencyio/FrequencyIn.h"
 #endif
 
+#if CIRCUITPY_IMAGECAPTURE
+#include "common-hal/imagecapture/ParallelImageCapture.h"
+#endif
+
 #include "common-hal/microcontroller/Pin.h"
 
 #if CIRCUITPY_PS2IO
@@ -103,6 +111,7 @@
 #include "samd/external_interrupts.h"
 #include "samd/dma.h"
 #include "shared-bindings/microcontroller/__init__.h"
+#include "shared-bindings/microcontroller/Processor.h"
 #include "shared-bindings/rtc/__init__.h"
 #include "reset.h"
 
@@ -384,15 +393,24 @@ void reset_port(void) {
     reset_sercoms();
     #endif
 
-    #if CIRCUITPY_AUDIOIO
-    audio_dma_reset();
-    audioout_reset();
+    #if CIRCUITPY_BUSIO_UART && BUSIO_UART_RX_DMA
+    uart_reset();
+    #endif
+
+    // Stop continuous capture and recording before DMA channels and event channels are reset under it.
+    #if CIRCUITPY_IMAGECAPTURE
+    imagecapture_reset();
     #endif
 
     #if CIRCUITPY_AUDIOBUSIO
     pdmin_reset();
     #endif
 
+    #if CIRCUITPY_AUDIOIO
+    audio_dma_reset();
+    audioout_reset();
+    #endif
+
     #if CIRCUITPY_AUDIOBUSIO_I2SOUT
     i2sout_reset();
     #endif
@@ -563,6 +581,21 @@ uint64_t port_get_raw_ticks(uint8_t *subticks) {
     return overflow_count + current_ticks / 16;
 }
 
+#ifdef SAM_D5X_E5X
+uint32_t port_get_cycle_count(void) {
+    if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0) {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+    return DWT->CYCCNT;
+}
+
+uint32_t port_get_cycle_count_frequency(void) {
+    return common_hal_mcu_processor_get_frequency();
+}
+#endif
+
 static void evsyshandler_common(void) {
     #ifdef SAMD21
     if (_tick_event_channel < EVSYS_SYNCH_NUM && event_interrupt_active(_tick_event_channel)) {
@@ -577,6 +610,14 @@ static void evsyshandler_common(void) {
     #if CIRCUITPY_AUDIOBUSIO
     pdmin_evsys_handler();
     #endif
+
+    #if CIRCUITPY_IMAGECAPTURE
+    imagecapture_evsys_handler();
+    #endif
+
+    #if CIRCUITPY_BUSIO_UART && BUSIO_UART_RX_DMA
+    uart_evsys_handler();
+    #endif
 }
 
 #ifdef SAM_D5X_E5X
@@ -214,28 +214,77 @@ MP_PROPERTY_GETTER(espcamera_camera_frame_available_obj,
 //|         If `pixel_format` is `PixelFormat.JPEG`, the returned value is a read-only `memoryview`.
 //|         Otherwise, the returned value is a read-only `displayio.Bitmap`.
 //|         """
-STATIC mp_obj_t espcamera_camera_take(size_t n_args, const mp_obj_t *args) {
-    espcamera_camera_obj_t *self = MP_OBJ_TO_PTR(args[0]);
-    mp_float_t timeout = n_args < 2 ? MICROPY_FLOAT_CONST(0.25) : mp_obj_get_float(args[1]);
-    check_for_deinit(self);
-    camera_fb_t *result = common_hal_espcamera_camera_take(self, (int)MICROPY_FLOAT_C_FUN(round)(timeout * 1000));
-    if (!result) {
+// Wraps the frame buffer in place, without copying it.
+STATIC mp_obj_t frame_obj(espcamera_camera_obj_t *self, camera_fb_t *frame, bool read_only) {
+    if (!frame) {
         return mp_const_none;
     }
     pixformat_t format = common_hal_espcamera_camera_get_pixel_format(self);
     if (format == PIXFORMAT_JPEG) {
-        return mp_obj_new_memoryview('b', result->len, result->buf);
+        return mp_obj_new_memoryview('b', frame->len, frame->buf);
     } else {
         int width = common_hal_espcamera_camera_get_width(self);
         int height = common_hal_espcamera_camera_get_height(self);
         displayio_bitmap_t *bitmap = m_new_obj(displayio_bitmap_t);
         bitmap->base.type = &displayio_bitmap_type;
-        common_hal_displayio_bitmap_construct_from_buffer(bitmap, width, height, (format == PIXFORMAT_RGB565) ? 16 : 8, (uint32_t *)(void *)result->buf, true);
+        common_hal_displayio_bitmap_construct_from_buffer(bitmap, width, height, (format == PIXFORMAT_RGB565) ? 16 : 8, (uint32_t *)(void *)frame->buf, read_only);
         return bitmap;
     }
 }
+
+STATIC mp_obj_t espcamera_camera_take(size_t n_args, const mp_obj_t *args) {
+    espcamera_camera_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_float_t timeout = n_args < 2 ? MICROPY_FLOAT_CONST(0.25) : mp_obj_get_float(args[1]);
+    check_for_deinit(self);
+    camera_fb_t *result = common_hal_espcamera_camera_take(self, (int)MICROPY_FLOAT_C_FUN(round)(timeout * 1000));
+    return frame_obj(self, result, true);
+}
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(espcamera_camera_take_obj, 1, 2, espcamera_camera_take);
 
+//|     def take_frame(
+//|         self, timeout: Optional[float] = 0.25
+//|     ) -> Optional[displayio.Bitmap | WriteableBuffer]:
+//|         """Record a frame and keep it until it is given back with `release()`. Wait up to
+//|         'timeout' seconds for a frame to be captured.
+//|
+//|         The result uses the driver's frame buffer in place, with no copy. Unlike with `take()`,
+//|         the frame stays valid while later frames are taken, so one frame can be shown, for
+//|         instance by setting it as a `displayio.TileGrid`'s ``bitmap``, while the camera fills
+//|         another. Up to `framebuffer_count` frames can be held at once, and the camera stops
+//|         capturing while all of them are held.
+//|
+//|         In the case of timeout, or when two frames are already held, `None` is returned.
+//|         If `pixel_format` is `PixelFormat.JPEG`, the returned value is a `memoryview`.
+//|         Otherwise, the returned value is a writable `displayio.Bitmap`, so it can be
+//|         filtered in place before it is shown.
+//|         Frames are in the camera's byte order, so show RGB565 frames through a
+//|         `displayio.ColorConverter` using `displayio.Colorspace.RGB565_SWAPPED`.
+//|         """
+STATIC mp_obj_t espcamera_camera_take_frame(size_t n_args, const mp_obj_t *args) {
+    espcamera_camera_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_float_t timeout = n_args < 2 ? MICROPY_FLOAT_CONST(0.25) : mp_obj_get_float(args[1]);
+    check_for_deinit(self);
+    camera_fb_t *result = common_hal_espcamera_camera_take_frame(self, (int)MICROPY_FLOAT_C_FUN(round)(timeout * 1000));
+    return frame_obj(self, result, false);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(espcamera_camera_take_frame_obj, 1, 2, espcamera_camera_take_frame);
+
+//|     def release(self, frame: displayio.Bitmap | WriteableBuffer) -> None:
+//|         """Give a frame from `take_frame()` back to the camera so it can be filled again.
+//|
+//|         The frame's contents will change, so stop showing it before releasing it."""
+STATIC mp_obj_t espcamera_camera_release(mp_obj_t self_in, mp_obj_t frame_in) {
+    espcamera_camera_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(frame_in, &bufinfo, MP_BUFFER_READ);
+    if (!common_hal_espcamera_camera_release_frame(self, bufinfo.buf)) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_frame);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(espcamera_camera_release_obj, espcamera_camera_release);
+
 
 //|     def reconfigure(
 //|         self,
@@ -976,12 +1025,14 @@ STATIC const mp_rom_map_elem_t espcamera_camera_locals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_quality), MP_ROM_PTR(&espcamera_camera_quality_obj) },
     { MP_ROM_QSTR(MP_QSTR_raw_gma), MP_ROM_PTR(&espcamera_camera_raw_gma_obj) },
     { MP_ROM_QSTR(MP_QSTR_reconfigure), MP_ROM_PTR(&espcamera_camera_reconfigure_obj) },
+    { MP_ROM_QSTR(MP_QSTR_release), MP_ROM_PTR(&espcamera_camera_release_obj) },
     { MP_ROM_QSTR(MP_QSTR_saturation), MP_ROM_PTR(&espcamera_camera_saturation_obj) },
     { MP_ROM_QSTR(MP_QSTR_sensor_name), MP_ROM_PTR(&espcamera_camera_sensor_name_obj) },
     { MP_ROM_QSTR(MP_QSTR_sharpness), MP_ROM_PTR(&espcamera_camera_sharpness_obj) },
     { MP_ROM_QSTR(MP_QSTR_special_effect), MP_ROM_PTR(&espcamera_camera_special_effect_obj) },
     { MP_ROM_QSTR(MP_QSTR_supports_jpeg), MP_ROM_PTR(&espcamera_camera_supports_jpeg_obj) },
     { MP_ROM_QSTR(MP_QSTR_take), MP_ROM_PTR(&espcamera_camera_take_obj) },
+    { MP_ROM_QSTR(MP_QSTR_take_frame), MP_ROM_PTR(&espcamera_camera_take_frame_obj) },
     { MP_ROM_QSTR(MP_QSTR_vflip), MP_ROM_PTR(&espcamera_camera_vflip_obj) },
     { MP_ROM_QSTR(MP_QSTR_wb_mode), MP_ROM_PTR(&espcamera_camera_wb_mode_obj) },
     { MP_ROM_QSTR(MP_QSTR_whitebal), MP_ROM_PTR(&espcamera_camera_whitebal_obj) },
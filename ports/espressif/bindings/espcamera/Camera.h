@@ -57,6 +57,8 @@ extern void common_hal_espcamera_camera_deinit(espcamera_camera_obj_t *self);
 extern bool common_hal_espcamera_camera_deinited(espcamera_camera_obj_t *self);
 extern bool common_hal_espcamera_camera_available(espcamera_camera_obj_t *self);
 extern camera_fb_t *common_hal_espcamera_camera_take(espcamera_camera_obj_t *self, int timeout_ms);
+extern camera_fb_t *common_hal_espcamera_camera_take_frame(espcamera_camera_obj_t *self, int timeout_ms);
+extern bool common_hal_espcamera_camera_release_frame(espcamera_camera_obj_t *self, const void *buf);
 extern void common_hal_espcamera_camera_reconfigure(espcamera_camera_obj_t *self, framesize_t frame_size, pixformat_t pixel_format, camera_grab_mode_t grab_mode, mp_int_t framebuffer_count);
 
 #define DECLARE_SENSOR_GETSET(type, name, field_name, setter_function_name) \
@@ -123,7 +123,10 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(espnow___exit___obj, 4, 4, espnow_obj
 //|     ) -> None:
 //|         """Send a message to the peer's mac address.
 //|
-//|         This blocks until a timeout of ``2`` seconds if the ESP-NOW internal buffers are full.
+//|         This returns once the message is queued, without waiting for the peer to
+//|         acknowledge it. It blocks until a timeout of ``2`` seconds if the ESP-NOW
+//|         internal buffers are full. Use `send_pending` and `read_send_failure` to
+//|         check on queued messages afterwards.
 //|
 //|         :param ReadableBuffer message: The message to send (length <= 250 bytes).
 //|         :param Peer peer: Send message to this peer. If `None`, send to all registered peers.
@@ -171,6 +174,62 @@ STATIC mp_obj_t espnow_read(mp_obj_t self_in) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(espnow_read_obj, espnow_read);
 
+//|     def readinto(self, buffer: WriteableBuffer) -> int:
+//|         """Copy as many whole packets from the receive buffer into ``buffer`` as fit,
+//|         without allocating an `ESPNowPacket` for each one.
+//|
+//|         Each packet is a 12 byte header followed by the message:
+//|
+//|         * message length (1 byte)
+//|         * time in milliseconds when it was received (4 bytes, little endian)
+//|         * RSSI in dBm (1 byte, signed)
+//|         * mac of the sender (6 bytes)
+//|
+//|         This is non-blocking.
+//|
+//|         :param WriteableBuffer buffer: Where to copy the packets. It must be large enough
+//|             for the largest packet, 262 bytes.
+//|         :returns: The number of bytes copied, 0 if there were no packets."""
+//|         ...
+STATIC mp_obj_t espnow_readinto(mp_obj_t self_in, mp_obj_t buffer) {
+    espnow_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    espnow_check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_WRITE);
+    mp_arg_validate_length_min(bufinfo.len, 12 + ESP_NOW_MAX_DATA_LEN, MP_QSTR_buffer);
+
+    return mp_obj_new_int_from_uint(common_hal_espnow_readinto(self, &bufinfo));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(espnow_readinto_obj, espnow_readinto);
+
+//|     def read_send_failure(self) -> Optional[bytes]:
+//|         """Return the mac of the peer for the oldest failed send that has not been read yet.
+//|
+//|         Up to 16 unread failures are kept. Any after that are only counted in `send_failure`.
+//|
+//|         :returns: The peer's mac, or `None` if no failed sends are waiting."""
+//|         ...
+STATIC mp_obj_t espnow_read_send_failure(mp_obj_t self_in) {
+    espnow_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    espnow_check_for_deinit(self);
+
+    return common_hal_espnow_read_send_failure(self);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(espnow_read_send_failure_obj, espnow_read_send_failure);
+
+//|     send_pending: int
+//|     """The number of tx packets that were queued but not yet acknowledged or failed. (read-only)"""
+//|
+STATIC mp_obj_t espnow_get_send_pending(const mp_obj_t self_in) {
+    espnow_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_espnow_get_send_pending(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(espnow_get_send_pending_obj, espnow_get_send_pending);
+
+MP_PROPERTY_GETTER(espnow_send_pending_obj,
+    (mp_obj_t)&espnow_get_send_pending_obj);
+
 //|     send_success: int
 //|     """The number of tx packets received by the peer(s) ``ESP_NOW_SEND_SUCCESS``. (read-only)"""
 //|
@@ -293,9 +352,12 @@ STATIC const mp_rom_map_elem_t espnow_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_send),         MP_ROM_PTR(&espnow_send_obj) },
     { MP_ROM_QSTR(MP_QSTR_send_success), MP_ROM_PTR(&espnow_send_success_obj)},
     { MP_ROM_QSTR(MP_QSTR_send_failure), MP_ROM_PTR(&espnow_send_failure_obj)},
+    { MP_ROM_QSTR(MP_QSTR_send_pending), MP_ROM_PTR(&espnow_send_pending_obj)},
+    { MP_ROM_QSTR(MP_QSTR_read_send_failure), MP_ROM_PTR(&espnow_read_send_failure_obj)},
 
     // Read messages
     { MP_ROM_QSTR(MP_QSTR_read),         MP_ROM_PTR(&espnow_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto),     MP_ROM_PTR(&espnow_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_read_success), MP_ROM_PTR(&espnow_read_success_obj)},
     { MP_ROM_QSTR(MP_QSTR_read_failure), MP_ROM_PTR(&espnow_read_failure_obj)},
 
@@ -30,6 +30,7 @@
 
 #include "bindings/espnow/Peer.h"
 #include "common-hal/espnow/__init__.h"
+#include "common-hal/espnow/ESPNow.h"
 
 //| class Peer:
 //|     """A data class to store parameters specific to a peer."""
@@ -103,10 +104,19 @@ MP_DEFINE_CONST_FUN_OBJ_1(espnow_peer_get_mac_obj, espnow_peer_get_mac);
 
 STATIC mp_obj_t espnow_peer_set_mac(const mp_obj_t self_in, const mp_obj_t value) {
     espnow_peer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    espnow_obj_t *espnow = MP_STATE_PORT(espnow_singleton);
+    bool has_stats = common_hal_espnow_get_peer_stats(espnow, self->peer_info.peer_addr) != NULL;
+    if (has_stats) {
+        common_hal_espnow_remove_peer_stats(espnow, self->peer_info.peer_addr);
+    }
 
     memcpy(self->peer_info.peer_addr, common_hal_espnow_get_bytes_len(value, ESP_NOW_ETH_ALEN), ESP_NOW_ETH_ALEN);
     esp_now_mod_peer(&self->peer_info);
 
+    if (has_stats) {
+        common_hal_espnow_add_peer_stats(espnow, self->peer_info.peer_addr);
+    }
+
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_2(espnow_peer_set_mac_obj, espnow_peer_set_mac);
@@ -212,6 +222,54 @@ MP_PROPERTY_GETSET(espnow_peer_encrypted_obj,
     (mp_obj_t)&espnow_peer_get_encrypted_obj,
     (mp_obj_t)&espnow_peer_set_encrypted_obj);
 
+//|     rssi: Optional[int]
+//|     """The RSSI value (in dBm) of the last packet received from this peer,
+//|     or `None` if none were received since it was added to `ESPNow.peers`. (read-only)"""
+//|
+STATIC mp_obj_t espnow_peer_get_rssi(const mp_obj_t self_in) {
+    espnow_peer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    const espnow_peer_stats_t *stats = common_hal_espnow_get_peer_stats(MP_STATE_PORT(espnow_singleton), self->peer_info.peer_addr);
+    if (stats == NULL || stats->read_success == 0) {
+        return mp_const_none;
+    }
+    return MP_OBJ_NEW_SMALL_INT(stats->rssi);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(espnow_peer_get_rssi_obj, espnow_peer_get_rssi);
+
+MP_PROPERTY_GETTER(espnow_peer_rssi_obj,
+    (mp_obj_t)&espnow_peer_get_rssi_obj);
+
+//|     time: Optional[int]
+//|     """The time in milliseconds since the device last reset when the last packet
+//|     from this peer was received, or `None` if none were received. (read-only)"""
+//|
+STATIC mp_obj_t espnow_peer_get_time(const mp_obj_t self_in) {
+    espnow_peer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    const espnow_peer_stats_t *stats = common_hal_espnow_get_peer_stats(MP_STATE_PORT(espnow_singleton), self->peer_info.peer_addr);
+    if (stats == NULL || stats->read_success == 0) {
+        return mp_const_none;
+    }
+    return mp_obj_new_int_from_uint(stats->time_ms);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(espnow_peer_get_time_obj, espnow_peer_get_time);
+
+MP_PROPERTY_GETTER(espnow_peer_time_obj,
+    (mp_obj_t)&espnow_peer_get_time_obj);
+
+//|     read_success: int
+//|     """The number of rx packets received from this peer, including ones dropped
+//|     because the receive buffer was full. (read-only)"""
+//|
+STATIC mp_obj_t espnow_peer_get_read_success(const mp_obj_t self_in) {
+    espnow_peer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    const espnow_peer_stats_t *stats = common_hal_espnow_get_peer_stats(MP_STATE_PORT(espnow_singleton), self->peer_info.peer_addr);
+    return mp_obj_new_int_from_uint(stats == NULL ? 0 : stats->read_success);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(espnow_peer_get_read_success_obj, espnow_peer_get_read_success);
+
+MP_PROPERTY_GETTER(espnow_peer_read_success_obj,
+    (mp_obj_t)&espnow_peer_get_read_success_obj);
+
 STATIC const mp_rom_map_elem_t espnow_peer_locals_dict_table[] = {
     // Peer parameters
     { MP_ROM_QSTR(MP_QSTR_mac),         MP_ROM_PTR(&espnow_peer_mac_obj) },
@@ -219,6 +277,11 @@ STATIC const mp_rom_map_elem_t espnow_peer_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_channel),     MP_ROM_PTR(&espnow_peer_channel_obj) },
     { MP_ROM_QSTR(MP_QSTR_interface),   MP_ROM_PTR(&espnow_peer_interface_obj) },
     { MP_ROM_QSTR(MP_QSTR_encrypted),   MP_ROM_PTR(&espnow_peer_encrypted_obj) },
+
+    // Receive stats
+    { MP_ROM_QSTR(MP_QSTR_rssi),         MP_ROM_PTR(&espnow_peer_rssi_obj) },
+    { MP_ROM_QSTR(MP_QSTR_time),         MP_ROM_PTR(&espnow_peer_time_obj) },
+    { MP_ROM_QSTR(MP_QSTR_read_success), MP_ROM_PTR(&espnow_peer_read_success_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(espnow_peer_locals_dict, espnow_peer_locals_dict_table);
 
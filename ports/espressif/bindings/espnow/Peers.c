@@ -32,6 +32,7 @@
 
 #include "bindings/espnow/Peer.h"
 #include "bindings/espnow/Peers.h"
+#include "common-hal/espnow/ESPNow.h"
 
 #include "esp_now.h"
 
@@ -51,6 +52,7 @@
 STATIC mp_obj_t espnow_peers_append(mp_obj_t self_in, mp_obj_t arg) {
     espnow_peer_obj_t *peer = MP_OBJ_TO_PTR(mp_arg_validate_type(arg, &espnow_peer_type, MP_QSTR_Peer));
     CHECK_ESP_RESULT(esp_now_add_peer(&peer->peer_info));
+    common_hal_espnow_add_peer_stats(MP_STATE_PORT(espnow_singleton), peer->peer_info.peer_addr);
     espnow_peers_obj_t *self = MP_OBJ_TO_PTR(self_in);
     return mp_obj_list_append(self->list, arg);
 }
@@ -66,6 +68,7 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_2(espnow_peers_append_obj, espnow_peers_append);
 STATIC mp_obj_t espnow_peers_remove(mp_obj_t self_in, mp_obj_t arg) {
     espnow_peer_obj_t *peer = MP_OBJ_TO_PTR(mp_arg_validate_type(arg, &espnow_peer_type, MP_QSTR_Peer));
     CHECK_ESP_RESULT(esp_now_del_peer(peer->peer_info.peer_addr));
+    common_hal_espnow_remove_peer_stats(MP_STATE_PORT(espnow_singleton), peer->peer_info.peer_addr);
     espnow_peers_obj_t *self = MP_OBJ_TO_PTR(self_in);
     return mp_obj_list_remove(self->list, arg);
 }
@@ -27,6 +27,7 @@
  */
 
 #include <math.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
@@ -216,7 +217,7 @@ static int _scan_event(struct ble_gap_event *event, void *scan_results_in) {
 
 mp_obj_t common_hal_bleio_adapter_start_scan(bleio_adapter_obj_t *self, uint8_t *prefixes,
     size_t prefix_length, bool extended, mp_int_t buffer_size, mp_float_t timeout,
-    mp_float_t interval, mp_float_t window, mp_int_t minimum_rssi, bool active) {
+    mp_float_t interval, mp_float_t window, mp_int_t minimum_rssi, bool active, const bleio_scan_filter_t *filter) {
     if (self->scan_results != NULL) {
         if (!shared_module_bleio_scanresults_get_done(self->scan_results)) {
             mp_raise_bleio_BluetoothError(MP_ERROR_TEXT("Scan already in progress. Stop with stop_scan."));
@@ -224,7 +225,7 @@ mp_obj_t common_hal_bleio_adapter_start_scan(bleio_adapter_obj_t *self, uint8_t
         self->scan_results = NULL;
     }
 
-    self->scan_results = shared_module_bleio_new_scanresults(buffer_size, prefixes, prefix_length, minimum_rssi);
+    self->scan_results = shared_module_bleio_new_scanresults(buffer_size, prefixes, prefix_length, minimum_rssi, filter);
     // size_t max_packet_size = extended ? BLE_HCI_MAX_EXT_ADV_DATA_LEN : BLE_HCI_MAX_ADV_DATA_LEN;
 
     uint8_t own_addr_type;
@@ -650,12 +651,26 @@ bool common_hal_bleio_adapter_is_bonded_to_central(bleio_adapter_obj_t *self) {
     return false;
 }
 
-void bleio_adapter_gc_collect(bleio_adapter_obj_t *adapter) {
-    // We divide by size_t so that we can scan each 32-bit aligned value to see
-    // if it is a pointer. This allows us to change the structs without worrying
-    // about collecting new pointers.
-    gc_collect_root((void **)adapter, sizeof(bleio_adapter_obj_t) / (sizeof(size_t)));
-    gc_collect_root((void **)bleio_connections, sizeof(bleio_connections) / (sizeof(size_t)));
+// Only these fields can point into the heap, so nothing else in the structs is traced.
+STATIC const uint16_t adapter_root_offsets[] = {
+    offsetof(bleio_adapter_obj_t, scan_results),
+    offsetof(bleio_adapter_obj_t, name),
+    offsetof(bleio_adapter_obj_t, connection_objs),
+};
+
+STATIC gc_root_t adapter_root = GC_ROOT(&common_hal_bleio_adapter_obj, bleio_adapter_obj_t, 1, adapter_root_offsets);
+
+STATIC const uint16_t connections_root_offsets[] = {
+    offsetof(bleio_connection_internal_t, remote_service_list),
+    offsetof(bleio_connection_internal_t, connection_obj),
+};
+
+STATIC gc_root_t connections_root = GC_ROOT(bleio_connections, bleio_connection_internal_t,
+    BLEIO_TOTAL_CONNECTION_COUNT, connections_root_offsets);
+
+void bleio_adapter_register_gc_roots(void) {
+    gc_root_register(&adapter_root);
+    gc_root_register(&connections_root);
 }
 
 void bleio_adapter_reset(bleio_adapter_obj_t *adapter) {
@@ -54,7 +54,7 @@ typedef struct {
     bool user_advertising;
 } bleio_adapter_obj_t;
 
-void bleio_adapter_gc_collect(bleio_adapter_obj_t *adapter);
+void bleio_adapter_register_gc_roots(void);
 void bleio_adapter_reset(bleio_adapter_obj_t *adapter);
 
 #endif // MICROPY_INCLUDED_ESPRESSIF_COMMON_HAL_BLEIO_ADAPTER_H
@@ -75,8 +75,8 @@ bleio_adapter_obj_t common_hal_bleio_adapter_obj;
 void bleio_background(void) {
 }
 
-void common_hal_bleio_gc_collect(void) {
-    bleio_adapter_gc_collect(&common_hal_bleio_adapter_obj);
+void common_hal_bleio_register_gc_roots(void) {
+    bleio_adapter_register_gc_roots();
 }
 
 void check_nimble_error(int rc, const char *file, size_t line) {
@@ -316,3 +316,23 @@ uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t
     #endif // DEBUG_ANALOGBUFIO
     return captured_samples;
 }
+
+// Continuous capture into a caller-owned ring is not implemented on this port.
+void common_hal_analogbufio_bufferedin_start(analogbufio_bufferedin_obj_t *self, mp_obj_t buffer_obj, uint8_t *buffer, uint32_t len, uint8_t bytes_per_sample) {
+    mp_raise_NotImplementedError(NULL);
+}
+
+void common_hal_analogbufio_bufferedin_stop(analogbufio_bufferedin_obj_t *self) {
+}
+
+bool common_hal_analogbufio_bufferedin_get_running(analogbufio_bufferedin_obj_t *self) {
+    return false;
+}
+
+bool common_hal_analogbufio_bufferedin_wait(analogbufio_bufferedin_obj_t *self, bool half, uint32_t *completed_start) {
+    return false;
+}
+
+uint32_t common_hal_analogbufio_bufferedin_readinto_latest(analogbufio_bufferedin_obj_t *self, uint8_t *buffer, uint32_t len, uint8_t bytes_per_sample) {
+    return 0;
+}
@@ -0,0 +1,173 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/runtime.h"
+#include "common-hal/audiobusio/I2S.h"
+#include "shared-bindings/audiobusio/I2S.h"
+#include "shared-bindings/microcontroller/Pin.h"
+
+#include "bindings/espidf/__init__.h"
+
+// Ping-pong DMA buffers in each direction.
+#define I2S_DMA_BUFFER_COUNT 2
+// 16-bit stereo.
+#define I2S_BYTES_PER_FRAME 4
+
+// Caller validates that pins are free.
+void common_hal_audiobusio_i2s_construct(audiobusio_i2s_obj_t *self,
+    const mcu_pin_obj_t *bit_clock, const mcu_pin_obj_t *word_select,
+    const mcu_pin_obj_t *data_out, const mcu_pin_obj_t *data_in, const mcu_pin_obj_t *main_clock,
+    uint32_t sample_rate, uint16_t buffer_size, bool left_justified) {
+    i2s_chan_config_t chan_config = {
+        .id = I2S_NUM_AUTO,
+        .role = I2S_ROLE_MASTER,
+        .dma_desc_num = I2S_DMA_BUFFER_COUNT,
+        .dma_frame_num = buffer_size,
+        // Send silence when Python hasn't queued anything.
+        .auto_clear = true,
+    };
+    self->tx_handle = NULL;
+    self->rx_handle = NULL;
+    esp_err_t err = i2s_new_channel(&chan_config,
+        data_out != NULL ? &self->tx_handle : NULL,
+        data_in != NULL ? &self->rx_handle : NULL);
+    if (err == ESP_ERR_NOT_FOUND) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Peripheral in use"));
+    }
+    CHECK_ESP_RESULT(err);
+
+    i2s_std_config_t i2s_config = {
+        .clk_cfg = I2S_STD_CLK_DEFAULT_CONFIG(sample_rate),
+        .slot_cfg = I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_STEREO),
+        .gpio_cfg = {
+            .mclk = main_clock != NULL ? main_clock->number : I2S_GPIO_UNUSED,
+            .bclk = bit_clock->number,
+            .ws = word_select->number,
+            .dout = data_out != NULL ? data_out->number : I2S_GPIO_UNUSED,
+            .din = data_in != NULL ? data_in->number : I2S_GPIO_UNUSED,
+        }
+    };
+    if (left_justified) {
+        i2s_config.slot_cfg = (i2s_std_slot_config_t)I2S_STD_MSB_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_STEREO);
+    }
+    // Set these before anything can fail so deinit can clean up.
+    self->bit_clock = bit_clock;
+    self->word_select = word_select;
+    self->data_out = data_out;
+    self->data_in = data_in;
+    self->mclk = main_clock;
+    self->sample_rate = sample_rate;
+    claim_pin(bit_clock);
+    claim_pin(word_select);
+    if (data_out) {
+        claim_pin(data_out);
+    }
+    if (data_in) {
+        claim_pin(data_in);
+    }
+    if (main_clock) {
+        claim_pin(main_clock);
+    }
+
+    if (self->tx_handle != NULL) {
+        err = i2s_channel_init_std_mode(self->tx_handle, &i2s_config);
+    }
+    if (err == ESP_OK && self->rx_handle != NULL) {
+        err = i2s_channel_init_std_mode(self->rx_handle, &i2s_config);
+    }
+    // Start both before returning so they begin on the same frame.
+    if (err == ESP_OK && self->tx_handle != NULL) {
+        err = i2s_channel_enable(self->tx_handle);
+    }
+    if (err == ESP_OK && self->rx_handle != NULL) {
+        err = i2s_channel_enable(self->rx_handle);
+    }
+    if (err != ESP_OK) {
+        common_hal_audiobusio_i2s_deinit(self);
+        CHECK_ESP_RESULT(err);
+    }
+}
+
+bool common_hal_audiobusio_i2s_deinited(audiobusio_i2s_obj_t *self) {
+    return self->bit_clock == NULL;
+}
+
+STATIC void delete_channel(i2s_chan_handle_t *handle) {
+    if (*handle == NULL) {
+        return;
+    }
+    // Disabling a channel that never got enabled only returns an error.
+    i2s_channel_disable(*handle);
+    i2s_del_channel(*handle);
+    *handle = NULL;
+}
+
+STATIC void reset_optional_pin(const mcu_pin_obj_t **pin) {
+    if (*pin != NULL) {
+        reset_pin_number((*pin)->number);
+    }
+    *pin = NULL;
+}
+
+void common_hal_audiobusio_i2s_deinit(audiobusio_i2s_obj_t *self) {
+    if (common_hal_audiobusio_i2s_deinited(self)) {
+        return;
+    }
+    delete_channel(&self->tx_handle);
+    delete_channel(&self->rx_handle);
+
+    reset_optional_pin(&self->word_select);
+    reset_optional_pin(&self->data_out);
+    reset_optional_pin(&self->data_in);
+    reset_optional_pin(&self->mclk);
+    reset_optional_pin(&self->bit_clock);
+}
+
+uint32_t common_hal_audiobusio_i2s_get_sample_rate(audiobusio_i2s_obj_t *self) {
+    return self->sample_rate;
+}
+
+size_t common_hal_audiobusio_i2s_write(audiobusio_i2s_obj_t *self, const int16_t *samples, size_t count) {
+    if (self->tx_handle == NULL) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("No %q pin"), MP_QSTR_data_out);
+    }
+    // The DMA buffers hold whole frames, so a whole number of frames in is a whole number out.
+    size_t size = count * sizeof(int16_t) / I2S_BYTES_PER_FRAME * I2S_BYTES_PER_FRAME;
+    size_t written = 0;
+    // A zero timeout copies into whatever DMA buffer space is free and returns.
+    i2s_channel_write(self->tx_handle, samples, size, &written, 0);
+    return written / sizeof(int16_t);
+}
+
+size_t common_hal_audiobusio_i2s_readinto(audiobusio_i2s_obj_t *self, int16_t *samples, size_t count) {
+    if (self->rx_handle == NULL) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("No %q pin"), MP_QSTR_data_in);
+    }
+    size_t size = count * sizeof(int16_t) / I2S_BYTES_PER_FRAME * I2S_BYTES_PER_FRAME;
+    size_t read = 0;
+    i2s_channel_read(self->rx_handle, samples, size, &read, 0);
+    return read / sizeof(int16_t);
+}
@@ -130,6 +130,10 @@ bool common_hal_audiobusio_i2sout_get_paused(audiobusio_i2sout_obj_t *self) {
     return port_i2s_paused(&self->i2s);
 }
 
+mp_obj_t common_hal_audiobusio_i2sout_get_stats(audiobusio_i2sout_obj_t *self) {
+    return audiosample_output_stats_get(&self->i2s.stats);
+}
+
 void common_hal_audiobusio_i2sout_stop(audiobusio_i2sout_obj_t *self) {
     port_i2s_stop(&self->i2s);
 }
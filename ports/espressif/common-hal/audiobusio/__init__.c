@@ -32,6 +32,7 @@
 #include "bindings/espidf/__init__.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "esp_timer.h"
 
 #include "shared-module/audiocore/__init__.h"
 
@@ -117,15 +118,29 @@ static void i2s_fill_buffer(i2s_t *self) {
 
 static void i2s_callback_fun(void *self_in) {
     i2s_t *self = self_in;
+    int64_t start_us = esp_timer_get_time();
+    size_t frames = self->next_buffer_size / 4;
+    bool rendering = self->next_buffer != NULL && self->playing && !self->paused;
+    if (rendering) {
+        audiosample_output_stats_record_fill_latency(&self->stats, start_us - self->interrupt_us);
+    }
     i2s_fill_buffer(self);
+    if (rendering) {
+        audiosample_output_stats_record_buffer(&self->stats, esp_timer_get_time() - start_us,
+            frames, self->sample_rate);
+    }
 }
 
 static bool i2s_event_interrupt(i2s_chan_handle_t handle, i2s_event_data_t *event, void *self_in) {
     i2s_t *self = self_in;
-    self->underrun = self->underrun || self->next_buffer != NULL;
+    if (self->next_buffer != NULL) {
+        self->underrun = true;
+        self->stats.underruns++;
+    }
+    self->interrupt_us = esp_timer_get_time();
     self->next_buffer = *(int16_t **)event->data;
     self->next_buffer_size = event->size;
-    background_callback_add(&self->callback, i2s_callback_fun, self_in);
+    background_callback_add_with_priority(&self->callback, i2s_callback_fun, self_in, BACKGROUND_CALLBACK_REALTIME);
     return false;
 }
 
@@ -180,6 +195,7 @@ void port_i2s_play(i2s_t *self, mp_obj_t sample, bool loop) {
     audiosample_reset_buffer(self->sample, false, 0);
 
     uint32_t sample_rate = audiosample_sample_rate(sample);
+    self->sample_rate = sample_rate;
     i2s_std_clk_config_t clk_config = I2S_STD_CLK_DEFAULT_CONFIG(sample_rate);
     CHECK_ESP_RESULT(i2s_channel_reconfig_std_clock(self->handle, &clk_config));
 
@@ -202,6 +218,8 @@ void port_i2s_play(i2s_t *self, mp_obj_t sample, bool loop) {
         preloaded += 1;
     }
 
+    audiosample_output_stats_reset(&self->stats);
+
     // enable the channel
     i2s_channel_enable(self->handle);
 
@@ -27,6 +27,7 @@
 #pragma once
 
 #include "py/obj.h"
+#include "shared-module/audiocore/__init__.h"
 
 #include "supervisor/background_callback.h"
 
@@ -49,6 +50,9 @@ typedef struct {
     i2s_chan_handle_t handle;
     background_callback_t callback;
     bool underrun;
+    audiosample_output_stats_t stats;
+    uint32_t sample_rate;
+    int64_t interrupt_us; // When the IDF asked for the buffer in next_buffer.
 } i2s_t;
 
 
@@ -203,6 +203,41 @@ uint8_t common_hal_busio_i2c_write_read(busio_i2c_obj_t *self, uint16_t addr,
             out_data, out_len, in_data, in_len, 100 /* wait in ticks */));
 }
 
+// Put every step in one command link, so the driver runs the whole list from its interrupt
+// handler in a single i2c_master_cmd_begin(). A NACK anywhere ends the link, so the error is
+// for the list as a whole.
+uint8_t common_hal_busio_i2c_transact(busio_i2c_obj_t *self, const busio_i2c_step_t *steps, size_t num_steps) {
+    if (num_steps == 0) {
+        return 0;
+    }
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+    if (cmd == NULL) {
+        return MP_ENOMEM;
+    }
+    for (size_t i = 0; i < num_steps; i++) {
+        const busio_i2c_step_t *step = &steps[i];
+        uint8_t addr = (uint8_t)step->address;
+        i2c_master_start(cmd);
+        if (step->out_len > 0 || step->data_in == NULL) {
+            i2c_master_write_byte(cmd, addr << 1 | I2C_MASTER_WRITE, true);
+            if (step->out_len > 0) {
+                i2c_master_write(cmd, step->data_out, step->out_len, true);
+            }
+            if (step->data_in != NULL) {
+                i2c_master_start(cmd);
+            }
+        }
+        if (step->data_in != NULL) {
+            i2c_master_write_byte(cmd, addr << 1 | I2C_MASTER_READ, true);
+            i2c_master_read(cmd, step->data_in, step->in_len, I2C_MASTER_LAST_NACK);
+        }
+        i2c_master_stop(cmd);
+    }
+    esp_err_t result = i2c_master_cmd_begin(self->i2c_num, cmd, 100 * num_steps /* wait in ticks */);
+    i2c_cmd_link_delete(cmd);
+    return convert_esp_err(result);
+}
+
 void common_hal_busio_i2c_never_reset(busio_i2c_obj_t *self) {
     never_reset_i2c(self->i2c_num);
 
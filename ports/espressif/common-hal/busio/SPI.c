@@ -28,8 +28,10 @@
 
 #include "py/runtime.h"
 #include "shared-bindings/busio/SPI.h"
+#include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/microcontroller/Pin.h"
 
+#include "driver/gpio.h"
 #include "esp_private/spi_common_internal.h"
 
 #define SPI_MAX_DMA_BITS (SPI_MAX_DMA_LEN * 8)
@@ -54,6 +56,14 @@ void spi_reset(void) {
     }
 }
 
+// Sets the DC pin, if any, that transact() stored in the transaction before it is sent.
+static void IRAM_ATTR spi_pre_transfer_callback(spi_transaction_t *trans) {
+    uintptr_t dc = (uintptr_t)trans->user;
+    if (dc != 0) {
+        gpio_set_level(dc >> 2, (dc >> 1) & 1);
+    }
+}
+
 static void set_spi_config(busio_spi_obj_t *self,
     uint32_t baudrate, uint8_t polarity, uint8_t phase, uint8_t bits) {
     // 128 is a 50% duty cycle.
@@ -63,7 +73,7 @@ static void set_spi_config(busio_spi_obj_t *self,
         .mode = phase | (polarity << 1),
         .spics_io_num = -1, // No CS pin
         .queue_size = MAX_SPI_TRANSACTIONS,
-        .pre_cb = NULL
+        .pre_cb = spi_pre_transfer_callback
     };
     esp_err_t result = spi_bus_add_device(self->host_id, &device_config, &spi_handle[self->host_id]);
     if (result != ESP_OK) {
@@ -287,3 +297,87 @@ uint8_t common_hal_busio_spi_get_polarity(busio_spi_obj_t *self) {
 uint8_t common_hal_busio_spi_get_phase(busio_spi_obj_t *self) {
     return self->phase;
 }
+
+static void spi_wait_for_transactions(busio_spi_obj_t *self, size_t *in_flight, size_t count) {
+    spi_transaction_t *rtrans;
+    while (count-- > 0) {
+        RUN_BACKGROUND_TASKS;
+        spi_device_get_trans_result(spi_handle[self->host_id], &rtrans, portMAX_DELAY);
+        (*in_flight)--;
+    }
+}
+
+// Queue every step in the IDF transaction queue, so the steps run back to back without
+// returning to the VM. The DC pin is switched by spi_pre_transfer_callback(), just before
+// the first transaction of its step goes out. Only delays drain the queue.
+bool common_hal_busio_spi_transact(busio_spi_obj_t *self, const busio_spi_step_t *steps, size_t num_steps,
+    digitalio_digitalinout_obj_t *dc) {
+    spi_transaction_t transactions[MAX_SPI_TRANSACTIONS];
+    size_t next = 0;
+    size_t in_flight = 0;
+
+    for (size_t i = 0; i < num_steps; i++) {
+        if (self->MOSI == NULL && steps[i].data_out != NULL) {
+            mp_raise_ValueError_varg(MP_ERROR_TEXT("No %q pin"), MP_QSTR_mosi);
+        }
+        if (self->MISO == NULL && steps[i].data_in != NULL) {
+            mp_raise_ValueError_varg(MP_ERROR_TEXT("No %q pin"), MP_QSTR_miso);
+        }
+    }
+
+    for (size_t i = 0; i < num_steps && !mp_hal_is_interrupted(); i++) {
+        const busio_spi_step_t *step = &steps[i];
+        uintptr_t dc_user = 0;
+        if (step->dc >= 0) {
+            dc_user = (dc->pin->number << 2) | (step->dc << 1) | 1;
+        }
+        if (step->len == 0) {
+            if (dc_user != 0) {
+                // Nothing to send, so set DC once everything before it is done.
+                spi_wait_for_transactions(self, &in_flight, in_flight);
+                gpio_set_level(dc->pin->number, step->dc);
+            }
+        } else {
+            // Round to nearest whole set of bits
+            int bits_remaining = step->len * 8 / self->bits * self->bits;
+            size_t offset = 0;
+            do {
+                if (in_flight == MAX_SPI_TRANSACTIONS) {
+                    spi_wait_for_transactions(self, &in_flight, 1);
+                }
+                spi_transaction_t *trans = &transactions[next];
+                next = (next + 1) % MAX_SPI_TRANSACTIONS;
+                memset(trans, 0, sizeof(spi_transaction_t));
+                trans->length = bits_remaining > SPI_MAX_DMA_BITS ? SPI_MAX_DMA_BITS : bits_remaining;
+                trans->user = (void *)dc_user;
+                if (step->data_in == NULL && step->len <= 4) {
+                    // Short command writes don't need DMA.
+                    trans->flags = SPI_TRANS_USE_TXDATA;
+                    if (step->data_out != NULL) {
+                        memcpy(trans->tx_data, step->data_out, step->len);
+                    }
+                } else {
+                    if (step->data_out != NULL) {
+                        trans->tx_buffer = step->data_out + offset;
+                    }
+                    if (step->data_in != NULL) {
+                        trans->rx_buffer = step->data_in + offset;
+                    }
+                }
+                bits_remaining -= trans->length;
+                offset += trans->length / 8;
+                // Only the first transaction of a step changes DC.
+                dc_user = 0;
+                spi_device_queue_trans(spi_handle[self->host_id], trans, portMAX_DELAY);
+                in_flight++;
+            } while (bits_remaining > 0);
+        }
+
+        if (step->delay_us > 0) {
+            spi_wait_for_transactions(self, &in_flight, in_flight);
+            common_hal_mcu_delay_us(step->delay_us);
+        }
+    }
+    spi_wait_for_transactions(self, &in_flight, in_flight);
+    return true;
+}
@@ -134,40 +134,69 @@ int common_hal_canio_listener_in_waiting(canio_listener_obj_t *self) {
     return self->pending;
 }
 
-mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+STATIC bool wait_for_message(canio_listener_obj_t *self) {
     if (!common_hal_canio_listener_in_waiting(self)) {
         uint64_t deadline = supervisor_ticks_ms64() + self->timeout_ms;
         do {
             if (supervisor_ticks_ms64() > deadline) {
-                return NULL;
+                return false;
             }
             RUN_BACKGROUND_TASKS;
             // Allow user to break out of a timeout with a KeyboardInterrupt.
             if (mp_hal_is_interrupted()) {
-                return NULL;
+                return false;
             }
         } while (!common_hal_canio_listener_in_waiting(self));
     }
+    return true;
+}
 
+// The TWAI driver doesn't timestamp messages, so the timestamp is always 0.
+STATIC void read_record(canio_listener_obj_t *self, canio_listener_record_t *record) {
     bool rtr = self->message_in.rtr;
+    record->id = self->message_in.identifier;
+    record->timestamp = 0;
+    record->flags = (self->message_in.extd ? CANIO_LISTENER_RECORD_EXTENDED : 0) |
+        (rtr ? CANIO_LISTENER_RECORD_RTR : 0);
+    record->size = self->message_in.data_length_code;
+    MP_STATIC_ASSERT(sizeof(self->message_in.data) == sizeof(record->data));
+    if (rtr) {
+        memset(record->data, 0, sizeof(record->data));
+    } else {
+        memcpy(record->data, self->message_in.data, sizeof(record->data));
+    }
+    self->pending = false;
+}
 
-    int dlc = self->message_in.data_length_code;
+mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+    if (!wait_for_message(self)) {
+        return NULL;
+    }
+    canio_listener_record_t record;
+    read_record(self, &record);
+    bool rtr = record.flags & CANIO_LISTENER_RECORD_RTR;
     canio_message_obj_t *message =
         mp_obj_malloc(canio_message_obj_t, rtr ? &canio_remote_transmission_request_type : &canio_message_type);
-    message->extended = self->message_in.extd;
-    message->id = self->message_in.identifier;
-    message->size = dlc;
-
+    message->extended = record.flags & CANIO_LISTENER_RECORD_EXTENDED;
+    message->id = record.id;
+    message->size = record.size;
     if (!rtr) {
-        MP_STATIC_ASSERT(sizeof(self->message_in.data) == sizeof(message->data));
-        memcpy(message->data, self->message_in.data, sizeof(message->data));
+        memcpy(message->data, record.data, sizeof(message->data));
     }
-
-    self->pending = false;
-
     return message;
 }
 
+size_t common_hal_canio_listener_receive_into(canio_listener_obj_t *self, canio_listener_record_t *records, size_t count) {
+    if (!wait_for_message(self)) {
+        return 0;
+    }
+    size_t n = 0;
+    while (n < count && common_hal_canio_listener_in_waiting(self)) {
+        read_record(self, &records[n++]);
+    }
+    return n;
+}
+
 void common_hal_canio_listener_deinit(canio_listener_obj_t *self) {
     if (self->can) {
         self->can->fifo_in_use = false;
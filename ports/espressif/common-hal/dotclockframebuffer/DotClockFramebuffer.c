@@ -227,6 +227,24 @@ void common_hal_dotclockframebuffer_framebuffer_refresh(dotclockframebuffer_fram
     Cache_WriteBack_Addr((uint32_t)(self->bufinfo.buf), self->bufinfo.len);
 }
 
+void common_hal_dotclockframebuffer_framebuffer_refresh_rows(dotclockframebuffer_framebuffer_obj_t *self, uint8_t *dirty_row_bitmask) {
+    // Write back each run of consecutive dirty rows in one call.
+    uint8_t *buf = (uint8_t *)self->bufinfo.buf + self->first_pixel_offset;
+    int height = common_hal_dotclockframebuffer_framebuffer_get_height(self);
+    int y = 0;
+    while (y < height) {
+        if (!(dirty_row_bitmask[y / 8] & (1 << (y & 7)))) {
+            y++;
+            continue;
+        }
+        int first = y;
+        while (y < height && (dirty_row_bitmask[y / 8] & (1 << (y & 7)))) {
+            y++;
+        }
+        Cache_WriteBack_Addr((uint32_t)(buf + first * self->row_stride), (y - first) * self->row_stride);
+    }
+}
+
 mp_int_t common_hal_dotclockframebuffer_framebuffer_get_refresh_rate(dotclockframebuffer_framebuffer_obj_t *self) {
     return self->refresh_rate;
 }
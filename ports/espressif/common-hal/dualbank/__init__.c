@@ -33,9 +33,28 @@
 #include "esp_ota_ops.h"
 #include "esp_app_format.h"
 
+#include "mbedtls/sha256.h"
+
 static const esp_partition_t *update_partition = NULL;
 static esp_ota_handle_t update_handle = 0;
 
+// The image is hashed as it is written, using the SHA peripheral through mbedtls.
+// append_offset is where esp_ota_write() continues from and hash_offset is how
+// much of the image, from the start, has been hashed.
+static mbedtls_sha256_context update_sha256;
+static size_t append_offset = 0;
+static size_t hash_offset = 0;
+static bool hash_in_order = false;
+
+static void update_hash_reset(void) {
+    if (hash_in_order) {
+        mbedtls_sha256_free(&update_sha256);
+    }
+    append_offset = 0;
+    hash_offset = 0;
+    hash_in_order = false;
+}
+
 static const char *TAG = "dualbank";
 
 void dualbank_reset(void) {
@@ -43,6 +62,7 @@ void dualbank_reset(void) {
         update_handle = 0;
         update_partition = NULL;
     }
+    update_hash_reset();
 }
 
 static void __attribute__((noreturn)) task_fatal_error(void) {
@@ -102,14 +122,22 @@ void common_hal_dualbank_flash(const void *buf, const size_t len, const size_t o
                 ESP_LOGE(TAG, "esp_ota_begin failed (%s)", esp_err_to_name(err));
                 task_fatal_error();
             }
+
+            update_hash_reset();
+            mbedtls_sha256_init(&update_sha256);
+            mbedtls_sha256_starts(&update_sha256, 0);
+            hash_in_order = true;
         } else {
             ESP_LOGE(TAG, "received package is not fit len");
             mp_raise_RuntimeError(MP_ERROR_TEXT("Firmware is too big"));
         }
     }
 
+    size_t position = offset;
     if (offset == 0) {
         err = esp_ota_write(update_handle, buf, len);
+        position = append_offset;
+        append_offset += len;
     } else {
         err = esp_ota_write_with_offset(update_handle, buf, len, offset);
     }
@@ -117,6 +145,30 @@ void common_hal_dualbank_flash(const void *buf, const size_t len, const size_t o
         ESP_LOGE(TAG, "esp_ota_write failed (%s)", esp_err_to_name(err));
         task_fatal_error();
     }
+
+    if (hash_in_order) {
+        if (position == hash_offset) {
+            mbedtls_sha256_update(&update_sha256, buf, len);
+            hash_offset += len;
+        } else {
+            // Rewrites and gaps can't be hashed incrementally.
+            mbedtls_sha256_free(&update_sha256);
+            hash_in_order = false;
+        }
+    }
+}
+
+bool common_hal_dualbank_get_sha256(uint8_t digest[32]) {
+    if (!hash_in_order) {
+        return false;
+    }
+    // Finish a copy so that more data can still be written and hashed.
+    mbedtls_sha256_context copy;
+    mbedtls_sha256_init(&copy);
+    mbedtls_sha256_clone(&copy, &update_sha256);
+    mbedtls_sha256_finish(&copy, digest);
+    mbedtls_sha256_free(&copy);
+    return true;
 }
 
 void common_hal_dualbank_switch(void) {
@@ -124,6 +176,7 @@ void common_hal_dualbank_switch(void) {
         update_handle = 0;
         update_partition = NULL;
     }
+    update_hash_reset();
     esp_err_t err = esp_ota_set_boot_partition(esp_ota_get_next_update_partition(NULL));
     if (err != ESP_OK) {
         if (err == ESP_ERR_OTA_VALIDATE_FAILED) {
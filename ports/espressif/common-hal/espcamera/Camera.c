@@ -24,6 +24,8 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "py/mperrno.h"
 #include "py/runtime.h"
 
@@ -156,6 +158,9 @@ extern void common_hal_espcamera_camera_deinit(espcamera_camera_obj_t *self) {
     reset_pin_number(self->camera_config.pin_d0);
 
     esp_camera_deinit();
+    // Their buffers were freed along with the driver.
+    self->buffer_to_return = NULL;
+    memset(self->held_frames, 0, sizeof(self->held_frames));
 
     reset_pin_number(self->camera_config.pin_pclk);
     reset_pin_number(self->camera_config.pin_vsync);
@@ -180,6 +185,26 @@ camera_fb_t *common_hal_espcamera_camera_take(espcamera_camera_obj_t *self, int
     return self->buffer_to_return = esp_camera_fb_get_timeout(timeout_ms);
 }
 
+camera_fb_t *common_hal_espcamera_camera_take_frame(espcamera_camera_obj_t *self, int timeout_ms) {
+    for (size_t i = 0; i < MP_ARRAY_SIZE(self->held_frames); i++) {
+        if (self->held_frames[i] == NULL) {
+            return self->held_frames[i] = esp_camera_fb_get_timeout(timeout_ms);
+        }
+    }
+    return NULL;
+}
+
+bool common_hal_espcamera_camera_release_frame(espcamera_camera_obj_t *self, const void *buf) {
+    for (size_t i = 0; i < MP_ARRAY_SIZE(self->held_frames); i++) {
+        if (self->held_frames[i] != NULL && self->held_frames[i]->buf == buf) {
+            esp_camera_fb_return(self->held_frames[i]);
+            self->held_frames[i] = NULL;
+            return true;
+        }
+    }
+    return false;
+}
+
 #define SENSOR_GETSET(type, name, field_name, setter_function_name) \
     SENSOR_GET(type, name, field_name, setter_function_name) \
     SENSOR_SET(type, name, setter_function_name)
@@ -233,6 +258,8 @@ void common_hal_espcamera_camera_reconfigure(espcamera_camera_obj_t *self, frame
 
     i2c_lock(self);
     cam_deinit();
+    self->buffer_to_return = NULL;
+    memset(self->held_frames, 0, sizeof(self->held_frames));
     self->camera_config.pixel_format = pixel_format;
     self->camera_config.frame_size = frame_size;
     self->camera_config.grab_mode = grab_mode;
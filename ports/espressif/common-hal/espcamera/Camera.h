@@ -35,6 +35,8 @@ typedef struct espcamera_camera_obj {
     mp_obj_base_t base;
     camera_config_t camera_config;
     camera_fb_t *buffer_to_return;
+    // Frames from take_frame() that are held until release(), one per possible framebuffer
+    camera_fb_t *held_frames[2];
     pwmio_pwmout_obj_t pwm;
     busio_i2c_obj_t *i2c;
 } espcamera_obj_t;
@@ -27,6 +27,8 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "py/mperrno.h"
 #include "py/runtime.h"
 
@@ -56,6 +58,9 @@
 // Time to wait (millisec) for responses from sent packets: (2 seconds).
 #define DEFAULT_SEND_TIMEOUT_MS (2000)
 
+// Number of failed sends whose peer mac is kept until read_send_failure().
+#define SEND_FAILURES_LEN (16)
+
 // ESPNow packet format for the receive buffer.
 // Use this for peeking at the header of the next packet in the buffer.
 typedef struct {
@@ -71,16 +76,84 @@ typedef struct {
     uint8_t msg[0];             // Message is up to 250 bytes
 } __attribute__((packed)) espnow_packet_t;
 
+// --- Per-peer receive stats ---
+
+// The stats table is open addressed with linear probing. Removed slots are
+// kept as tombstones so that probes for peers added after them still work.
+#define PEER_STATS_EMPTY (0)
+#define PEER_STATS_USED (1)
+#define PEER_STATS_REMOVED (2)
+
+static size_t peer_stats_hash(const uint8_t *mac) {
+    // The last bytes of a MAC are the ones that differ between devices.
+    return (mac[5] ^ (mac[4] << 2) ^ (mac[3] << 4)) & (ESPNOW_PEER_STATS_SLOTS - 1);
+}
+
+static espnow_peer_stats_t *find_peer_stats(espnow_obj_t *self, const uint8_t *mac) {
+    size_t i = peer_stats_hash(mac);
+    for (size_t n = 0; n < ESPNOW_PEER_STATS_SLOTS; n++) {
+        espnow_peer_stats_t *stats = &self->peer_stats[i];
+        if (stats->state == PEER_STATS_EMPTY) {
+            break;
+        }
+        if (stats->state == PEER_STATS_USED && memcmp(stats->mac, mac, ESP_NOW_ETH_ALEN) == 0) {
+            return stats;
+        }
+        i = (i + 1) & (ESPNOW_PEER_STATS_SLOTS - 1);
+    }
+    return NULL;
+}
+
+void common_hal_espnow_add_peer_stats(espnow_obj_t *self, const uint8_t *mac) {
+    if (self == NULL || find_peer_stats(self, mac) != NULL) {
+        return;
+    }
+    size_t i = peer_stats_hash(mac);
+    for (size_t n = 0; n < ESPNOW_PEER_STATS_SLOTS; n++) {
+        espnow_peer_stats_t *stats = &self->peer_stats[i];
+        if (stats->state != PEER_STATS_USED) {
+            memcpy(stats->mac, mac, ESP_NOW_ETH_ALEN);
+            stats->rssi = 0;
+            stats->time_ms = 0;
+            stats->read_success = 0;
+            // Set last, so recv_cb never matches a half written slot.
+            stats->state = PEER_STATS_USED;
+            return;
+        }
+        i = (i + 1) & (ESPNOW_PEER_STATS_SLOTS - 1);
+    }
+}
+
+void common_hal_espnow_remove_peer_stats(espnow_obj_t *self, const uint8_t *mac) {
+    if (self == NULL) {
+        return;
+    }
+    espnow_peer_stats_t *stats = find_peer_stats(self, mac);
+    if (stats != NULL) {
+        stats->state = PEER_STATS_REMOVED;
+    }
+}
+
+const espnow_peer_stats_t *common_hal_espnow_get_peer_stats(espnow_obj_t *self, const uint8_t *mac) {
+    if (self == NULL) {
+        return NULL;
+    }
+    return find_peer_stats(self, mac);
+}
+
 // --- The ESP-NOW send and recv callback routines ---
 
 // Callback triggered when a sent packet is acknowledged by the peer (or not).
-// Just count the number of responses and number of failures.
-// These are used in the send() logic.
+// Count the number of responses and number of failures, and keep the mac of
+// failed sends for read_send_failure(). If that buffer is full, only count it.
 static void send_cb(const uint8_t *mac, esp_now_send_status_t status) {
     espnow_obj_t *self = MP_STATE_PORT(espnow_singleton);
     if (status == ESP_NOW_SEND_SUCCESS) {
         self->send_success++;
     } else {
+        if (ringbuf_num_empty(self->send_failures) >= ESP_NOW_ETH_ALEN) {
+            ringbuf_put_n(self->send_failures, mac, ESP_NOW_ETH_ALEN);
+        }
         self->send_failure++;
     }
 }
@@ -92,11 +165,6 @@ static void recv_cb(const esp_now_recv_info_t *esp_now_info, const uint8_t *msg,
     espnow_obj_t *self = MP_STATE_PORT(espnow_singleton);
     ringbuf_t *buf = self->recv_buffer;
 
-    if (sizeof(espnow_packet_t) + msg_len > ringbuf_num_empty(buf)) {
-        self->read_failure++;
-        return;
-    }
-
     // Get the RSSI value from the wifi packet header
     // Secret magic to get the rssi from the wifi packet header
     // See espnow.c:espnow_recv_cb() at https://github.com/espressif/esp-now/
@@ -116,6 +184,18 @@ static void recv_cb(const esp_now_recv_info_t *esp_now_info, const uint8_t *msg,
     header.rssi = wifi_packet->rx_ctrl.rssi;
     header.time_ms = mp_hal_ticks_ms();
 
+    espnow_peer_stats_t *stats = find_peer_stats(self, esp_now_info->src_addr);
+    if (stats != NULL) {
+        stats->rssi = header.rssi;
+        stats->time_ms = header.time_ms;
+        stats->read_success++;
+    }
+
+    if (sizeof(espnow_packet_t) + msg_len > ringbuf_num_empty(buf)) {
+        self->read_failure++;
+        return;
+    }
+
     ringbuf_put_n(buf, (uint8_t *)&header, sizeof(header));
     ringbuf_put_n(buf, esp_now_info->src_addr, ESP_NOW_ETH_ALEN);
     ringbuf_put_n(buf, msg, msg_len);
@@ -132,6 +212,7 @@ void common_hal_espnow_construct(espnow_obj_t *self, mp_int_t buffer_size, mp_in
     common_hal_espnow_set_phy_rate(self, phy_rate);
     self->recv_buffer_size = mp_arg_validate_int_min(buffer_size, MIN_PACKET_LEN, MP_QSTR_buffer_size);
     self->peers = espnow_peers_new();
+    memset(self->peer_stats, 0, sizeof(self->peer_stats));
     common_hal_espnow_init(self);
 }
 
@@ -147,6 +228,11 @@ void common_hal_espnow_init(espnow_obj_t *self) {
         m_malloc_fail(self->recv_buffer_size);
     }
 
+    self->send_failures = m_new_obj(ringbuf_t);
+    if (!ringbuf_alloc(self->send_failures, SEND_FAILURES_LEN * ESP_NOW_ETH_ALEN)) {
+        m_malloc_fail(SEND_FAILURES_LEN * ESP_NOW_ETH_ALEN);
+    }
+
     if (!common_hal_wifi_radio_get_enabled(&common_hal_wifi_radio_obj)) {
         common_hal_wifi_init(false);
         common_hal_wifi_radio_set_enabled(&common_hal_wifi_radio_obj, true);
@@ -173,6 +259,8 @@ void common_hal_espnow_deinit(espnow_obj_t *self) {
 
     self->recv_buffer->buf = NULL;
     self->recv_buffer = NULL;
+    self->send_failures->buf = NULL;
+    self->send_failures = NULL;
 }
 
 void espnow_reset(void) {
@@ -202,9 +290,30 @@ mp_obj_t common_hal_espnow_send(espnow_obj_t *self, const mp_buffer_info_t *mess
     }
     CHECK_ESP_RESULT(err);
 
+    // Sending to all peers gets a send_cb for each of them.
+    size_t frames = 1;
+    if (mac == NULL) {
+        esp_now_peer_num_t peer_num;
+        CHECK_ESP_RESULT(esp_now_get_peer_num(&peer_num));
+        frames = peer_num.total_num;
+    }
+    self->send_count += frames;
+
     return mp_const_none;
 }
 
+size_t common_hal_espnow_get_send_pending(espnow_obj_t *self) {
+    return self->send_count - self->send_success - self->send_failure;
+}
+
+mp_obj_t common_hal_espnow_read_send_failure(espnow_obj_t *self) {
+    uint8_t mac[ESP_NOW_ETH_ALEN];
+    if (ringbuf_get_n(self->send_failures, mac, ESP_NOW_ETH_ALEN) != ESP_NOW_ETH_ALEN) {
+        return mp_const_none;
+    }
+    return mp_obj_new_bytes(mac, ESP_NOW_ETH_ALEN);
+}
+
 mp_obj_t common_hal_espnow_read(espnow_obj_t *self) {
     if (!ringbuf_num_filled(self->recv_buffer)) {
         return mp_const_none;
@@ -238,3 +347,28 @@ mp_obj_t common_hal_espnow_read(espnow_obj_t *self) {
 
     return namedtuple_make_new((const mp_obj_type_t *)&espnow_packet_type_obj, 4, 0, elems);
 }
+
+// Copy whole packets, without the magic byte, into the caller's buffer.
+// Packets that don't fit stay in the receive buffer for the next call.
+size_t common_hal_espnow_readinto(espnow_obj_t *self, const mp_buffer_info_t *bufinfo) {
+    ringbuf_t *buf = self->recv_buffer;
+    uint8_t *dest = bufinfo->buf;
+    size_t len = 0;
+
+    while (ringbuf_num_filled(buf) >= sizeof(espnow_packet_t)) {
+        // Peek at msg_len, which follows the magic byte.
+        uint8_t msg_len = buf->buf[(buf->next_read + 1) % buf->size];
+        size_t record_len = sizeof(espnow_packet_t) - 1 + msg_len;
+        if (len + record_len > bufinfo->len) {
+            break;
+        }
+        if (ringbuf_get(buf) != ESPNOW_MAGIC ||
+            msg_len > ESP_NOW_MAX_DATA_LEN ||
+            ringbuf_get_n(buf, dest + len, record_len) != record_len) {
+            mp_arg_error_invalid(MP_QSTR_buffer);
+        }
+        len += record_len;
+    }
+
+    return len;
+}
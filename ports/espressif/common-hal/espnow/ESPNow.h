@@ -31,18 +31,35 @@
 
 #include "bindings/espnow/Peers.h"
 
+#include "esp_now.h"
 #include "esp_wifi.h"
 
+// Slots in the per-peer receive stats table. A power of two with room to spare
+// over the ESP_NOW_MAX_TOTAL_PEER_NUM peers that ESP-NOW allows, so that
+// lookups from recv_cb stay short.
+#define ESPNOW_PEER_STATS_SLOTS (32)
+
+typedef struct {
+    uint8_t mac[ESP_NOW_ETH_ALEN];
+    uint8_t state;
+    int8_t rssi;
+    uint32_t time_ms;
+    size_t read_success;
+} espnow_peer_stats_t;
+
 typedef struct _espnow_obj_t {
     mp_obj_base_t base;
     ringbuf_t *recv_buffer;
     size_t recv_buffer_size;
     wifi_phy_rate_t phy_rate;
     espnow_peers_obj_t *peers;
+    ringbuf_t *send_failures;
+    volatile size_t send_count;
     volatile size_t send_success;
     volatile size_t send_failure;
     volatile size_t read_success;
     volatile size_t read_failure;
+    espnow_peer_stats_t peer_stats[ESPNOW_PEER_STATS_SLOTS];
 } espnow_obj_t;
 
 extern void espnow_reset(void);
@@ -56,4 +73,12 @@ extern void common_hal_espnow_set_phy_rate(espnow_obj_t *self, mp_int_t value);
 extern void common_hal_espnow_set_pmk(espnow_obj_t *self, const uint8_t *key);
 
 extern mp_obj_t common_hal_espnow_send(espnow_obj_t *self, const mp_buffer_info_t *message, const uint8_t *mac);
+extern size_t common_hal_espnow_get_send_pending(espnow_obj_t *self);
+extern mp_obj_t common_hal_espnow_read_send_failure(espnow_obj_t *self);
 extern mp_obj_t common_hal_espnow_read(espnow_obj_t *self);
+extern size_t common_hal_espnow_readinto(espnow_obj_t *self, const mp_buffer_info_t *bufinfo);
+
+// Start, stop and get receive stats for a registered peer. self may be NULL.
+extern void common_hal_espnow_add_peer_stats(espnow_obj_t *self, const uint8_t *mac);
+extern void common_hal_espnow_remove_peer_stats(espnow_obj_t *self, const uint8_t *mac);
+extern const espnow_peer_stats_t *common_hal_espnow_get_peer_stats(espnow_obj_t *self, const uint8_t *mac);
@@ -124,3 +124,15 @@ void common_hal_i2ctarget_i2c_target_ack(i2ctarget_i2c_target_obj_t *self, bool
 void common_hal_i2ctarget_i2c_target_close(i2ctarget_i2c_target_obj_t *self) {
 
 }
+
+void common_hal_i2ctarget_i2c_target_serve_registers(i2ctarget_i2c_target_obj_t *self,
+    mp_obj_t registers_obj, uint8_t *registers, size_t length, uint8_t first_register, bool notify) {
+    if (registers != NULL) {
+        mp_raise_NotImplementedError(NULL);
+    }
+}
+
+bool common_hal_i2ctarget_i2c_target_pop_write(i2ctarget_i2c_target_obj_t *self,
+    uint8_t *first_register, size_t *length) {
+    return false;
+}
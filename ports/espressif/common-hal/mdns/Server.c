@@ -24,6 +24,8 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "shared-bindings/mdns/Server.h"
 
 #include "py/gc.h"
@@ -52,6 +54,7 @@ void mdns_server_construct(mdns_server_obj_t *self, bool workflow) {
         return;
     }
     _active_object = self;
+    memset(self->advertised, 0, sizeof(self->advertised));
 
     uint8_t mac[6];
     esp_netif_get_mac(common_hal_wifi_radio_obj.netif, mac);
@@ -208,9 +211,43 @@ mp_obj_t common_hal_mdns_server_find(mdns_server_obj_t *self, const char *servic
     return MP_OBJ_FROM_PTR(tuple);
 }
 
+// Remember the port a service was advertised with. Returns the previous port,
+// or -1 if the service wasn't remembered.
+STATIC mp_int_t remember_service_port(mdns_server_obj_t *self, const char *service_type, const char *protocol, mp_int_t port) {
+    mdns_advertised_service_t *free_slot = NULL;
+    for (size_t i = 0; i < MDNS_ADVERTISED_SERVICES; i++) {
+        mdns_advertised_service_t *advertised = &self->advertised[i];
+        if (advertised->service_type[0] == '\0') {
+            if (free_slot == NULL) {
+                free_slot = advertised;
+            }
+            continue;
+        }
+        if (strcmp(advertised->service_type, service_type) == 0 &&
+            strcmp(advertised->protocol, protocol) == 0) {
+            mp_int_t previous = advertised->port;
+            advertised->port = port;
+            return previous;
+        }
+    }
+    if (free_slot != NULL &&
+        strlen(service_type) < sizeof(free_slot->service_type) &&
+        strlen(protocol) < sizeof(free_slot->protocol)) {
+        strcpy(free_slot->service_type, service_type);
+        strcpy(free_slot->protocol, protocol);
+        free_slot->port = port;
+    }
+    return -1;
+}
+
 void common_hal_mdns_server_advertise_service(mdns_server_obj_t *self, const char *service_type, const char *protocol, mp_int_t port, const char *txt_records[], size_t num_txt_records) {
+    mp_int_t previous_port = remember_service_port(self, service_type, protocol, port);
     if (mdns_service_exists(service_type, protocol, NULL)) {
-        mdns_service_port_set(service_type, protocol, port);
+        // Setting the port announces the service to the network again, even
+        // when it is unchanged. The web workflow advertises on every reload.
+        if (previous_port != port) {
+            mdns_service_port_set(service_type, protocol, port);
+        }
     } else {
         // TODO: Add support for TXT record
         /* NOTE: The `mdns_txt_item_t *txt` argument of mdns_service_add uses a struct
@@ -28,11 +28,22 @@
 
 #include "py/obj.h"
 
+// Number of advertised services whose port is remembered, see advertise_service.
+#define MDNS_ADVERTISED_SERVICES (4)
+
+typedef struct {
+    // DNS-SD service names are at most 15 characters after the leading underscore.
+    char service_type[17];
+    char protocol[5];
+    uint16_t port;
+} mdns_advertised_service_t;
+
 typedef struct {
     mp_obj_base_t base;
     const char *hostname;
     const char *instance_name;
     char default_hostname[sizeof("cpy-XXXXXX")];
+    mdns_advertised_service_t advertised[MDNS_ADVERTISED_SERVICES];
     // Track if this object owns access to the underlying MDNS service.
     bool inited;
 } mdns_server_obj_t;
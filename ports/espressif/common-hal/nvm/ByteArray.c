@@ -92,12 +92,16 @@ bool common_hal_nvm_bytearray_set_bytes(const nvm_bytearray_obj_t *self,
         raise_esp_error(result);
     }
 
-    // erase old data, including 6.3.x incompatible data
-    result = nvs_erase_all(handle);
-    if (result != ESP_OK) {
-        gc_free(buf);
-        nvs_close(handle);
-        raise_esp_error(result);
+    // erase 6.3.x incompatible data. Once the blob exists, NVS replaces it in place and spreads
+    // the writes over its pages itself.
+    size_t size;
+    if (nvs_get_blob(handle, "data", NULL, &size) == ESP_ERR_NVS_NOT_FOUND) {
+        result = nvs_erase_all(handle);
+        if (result != ESP_OK) {
+            gc_free(buf);
+            nvs_close(handle);
+            raise_esp_error(result);
+        }
     }
 
     // make our modification
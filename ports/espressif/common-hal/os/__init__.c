@@ -62,15 +62,6 @@ mp_obj_t common_hal_os_uname(void) {
 }
 
 bool common_hal_os_urandom(uint8_t *buffer, mp_uint_t length) {
-    uint32_t i = 0;
-    while (i < length) {
-        uint32_t new_random = esp_random();
-        for (int j = 0; j < 4 && i < length; j++) {
-            buffer[i] = new_random & 0xff;
-            i++;
-            new_random >>= 8;
-        }
-    }
-
+    esp_fill_random(buffer, length);
     return true;
 }
@@ -182,6 +182,17 @@ void common_hal_pwmio_pwmout_set_duty_cycle(pwmio_pwmout_obj_t *self, uint16_t d
     ledc_update_duty(LEDC_LOW_SPEED_MODE, self->chan_handle.channel);
 }
 
+void common_hal_pwmio_pwmout_set_duty_cycles(pwmio_pwmout_obj_t **pwms, const uint16_t *duty_cycles, size_t count) {
+    // New duties are latched at the end of each channel's current period once
+    // updated, so stage all of them before updating any.
+    for (size_t i = 0; i < count; i++) {
+        ledc_set_duty(LEDC_LOW_SPEED_MODE, pwms[i]->chan_handle.channel, duty_cycles[i] >> (16 - pwms[i]->duty_resolution));
+    }
+    for (size_t i = 0; i < count; i++) {
+        ledc_update_duty(LEDC_LOW_SPEED_MODE, pwms[i]->chan_handle.channel);
+    }
+}
+
 uint16_t common_hal_pwmio_pwmout_get_duty_cycle(pwmio_pwmout_obj_t *self) {
     return ledc_get_duty(LEDC_LOW_SPEED_MODE, self->chan_handle.channel) << (16 - self->duty_resolution);
 }
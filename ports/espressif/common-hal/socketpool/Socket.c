@@ -57,6 +57,14 @@ StackType_t socket_select_stack[2 * configMINIMAL_STACK_SIZE];
 STATIC uint8_t socket_fd_state[CONFIG_LWIP_MAX_SOCKETS];
 
 STATIC socketpool_socket_obj_t *user_socket[CONFIG_LWIP_MAX_SOCKETS];
+
+/* User sockets that select.poll() is waiting on. The select task adds them to
+ * its set and wakes the main task once when one becomes ready, then drops them
+ * until they are polled again.
+ */
+#define POLL_WATCH_READ  (1 << 0)
+#define POLL_WATCH_WRITE (1 << 1)
+STATIC volatile uint8_t socket_poll_watch[CONFIG_LWIP_MAX_SOCKETS];
 StaticTask_t socket_select_task_buffer;
 TaskHandle_t socket_select_task_handle;
 STATIC int socket_change_fd = -1;
@@ -64,23 +72,38 @@ STATIC int socket_change_fd = -1;
 STATIC void socket_select_task(void *arg) {
     uint64_t signal;
     fd_set readfds;
+    fd_set writefds;
     fd_set excptfds;
 
     while (true) {
         FD_ZERO(&readfds);
+        FD_ZERO(&writefds);
         FD_ZERO(&excptfds);
         FD_SET(socket_change_fd, &readfds);
         int max_fd = socket_change_fd;
         for (size_t i = 0; i < MP_ARRAY_SIZE(socket_fd_state); i++) {
-            if ((socket_fd_state[i] == FDSTATE_OPEN) && (user_socket[i] == NULL)) {
-                int sockfd = i + LWIP_SOCKET_OFFSET;
+            if (socket_fd_state[i] != FDSTATE_OPEN) {
+                continue;
+            }
+            int sockfd = i + LWIP_SOCKET_OFFSET;
+            if (user_socket[i] == NULL) {
                 max_fd = MAX(max_fd, sockfd);
                 FD_SET(sockfd, &readfds);
                 FD_SET(sockfd, &excptfds);
+            } else if (socket_poll_watch[i] != 0) {
+                uint8_t watch = socket_poll_watch[i];
+                max_fd = MAX(max_fd, sockfd);
+                if (watch & POLL_WATCH_READ) {
+                    FD_SET(sockfd, &readfds);
+                }
+                if (watch & POLL_WATCH_WRITE) {
+                    FD_SET(sockfd, &writefds);
+                }
+                FD_SET(sockfd, &excptfds);
             }
         }
 
-        int num_triggered = select(max_fd + 1, &readfds, NULL, &excptfds, NULL);
+        int num_triggered = select(max_fd + 1, &readfds, &writefds, &excptfds, NULL);
         // Hard error (or someone closed a socket on another thread)
         if (num_triggered == -1) {
             assert(errno == EBADF);
@@ -96,8 +119,19 @@ STATIC void socket_select_task(void *arg) {
         }
 
         // Handle active FDs, close the dead ones
+        bool wake_main_task = false;
         for (size_t i = 0; i < MP_ARRAY_SIZE(socket_fd_state); i++) {
             int sockfd = i + LWIP_SOCKET_OFFSET;
+            if (user_socket[i] != NULL) {
+                // Each fd counts once per set it is ready in.
+                int ready = (FD_ISSET(sockfd, &readfds) != 0) + (FD_ISSET(sockfd, &writefds) != 0) + (FD_ISSET(sockfd, &excptfds) != 0);
+                if (ready > 0) {
+                    socket_poll_watch[i] = 0;
+                    wake_main_task = true;
+                    num_triggered -= ready;
+                }
+                continue;
+            }
             if (socket_fd_state[i] != FDSTATE_CLOSED) {
                 if (FD_ISSET(sockfd, &readfds) || FD_ISSET(sockfd, &excptfds)) {
                     if (socket_fd_state[i] == FDSTATE_CLOSING) {
@@ -108,6 +142,11 @@ STATIC void socket_select_task(void *arg) {
             }
         }
 
+        if (wake_main_task) {
+            // select.poll() rechecks every polled object when it wakes.
+            port_wake_main_task();
+        }
+
         if (num_triggered > 0) {
             // Wake up CircuitPython by queuing request
             supervisor_workflow_request_background();
@@ -129,6 +168,7 @@ void socket_user_reset(void) {
         for (size_t i = 0; i < MP_ARRAY_SIZE(socket_fd_state); i++) {
             socket_fd_state[i] = FDSTATE_CLOSED;
             user_socket[i] = NULL;
+            socket_poll_watch[i] = 0;
         }
         socket_change_fd = eventfd(0, 0);
         // Run this at the same priority as CP so that the web workflow background task can be
@@ -174,12 +214,60 @@ STATIC bool register_open_socket(int fd) {
     return false;
 }
 
+// Ask the select task to wake the main task when a polled user socket is ready.
+STATIC void watch_user_socket(socketpool_socket_obj_t *self, uint8_t watch) {
+    int fd = self->num;
+    if (fd < LWIP_SOCKET_OFFSET || user_socket[fd - LWIP_SOCKET_OFFSET] != self) {
+        return;
+    }
+    size_t i = fd - LWIP_SOCKET_OFFSET;
+    uint8_t old_watch = socket_poll_watch[i];
+    if ((old_watch & watch) == watch) {
+        return;
+    }
+    socket_poll_watch[i] = old_watch | watch;
+    uint64_t signal = 1;
+    write(socket_change_fd, &signal, sizeof(signal));
+}
+
 STATIC void mark_user_socket(int fd, socketpool_socket_obj_t *obj) {
     socket_fd_state[fd - LWIP_SOCKET_OFFSET] = FDSTATE_OPEN;
     user_socket[fd - LWIP_SOCKET_OFFSET] = obj;
+    socket_poll_watch[fd - LWIP_SOCKET_OFFSET] = 0;
     // No need to wakeup select task
 }
 
+#if CIRCUITPY_NETWORK_STATS
+STATIC void socket_stats_record_recv(socketpool_socket_obj_t *self, int received, uint32_t wait_ms) {
+    if (received > 0) {
+        self->stats.bytes_received += received;
+    }
+    self->stats.recv_wait_ms += wait_ms;
+    self->stats.max_recv_wait_ms = MAX(self->stats.max_recv_wait_ms, wait_ms);
+}
+
+STATIC void socket_stats_record_send(socketpool_socket_obj_t *self, int sent) {
+    if (sent > 0) {
+        self->stats.bytes_sent += sent;
+    } else if (errno == EAGAIN) {
+        self->stats.send_stalls++;
+    }
+}
+
+mp_obj_t common_hal_socketpool_socket_get_stats(socketpool_socket_obj_t *self) {
+    const socketpool_socket_stats_t *stats = &self->stats;
+    mp_obj_t items[6] = {
+        mp_obj_new_int_from_uint(stats->bytes_sent),
+        mp_obj_new_int_from_uint(stats->bytes_received),
+        mp_obj_new_int_from_uint(stats->send_stalls),
+        mp_obj_new_int_from_uint(stats->recv_wait_ms),
+        mp_obj_new_int_from_uint(stats->max_recv_wait_ms),
+        mp_obj_new_int_from_uint(stats->connect_ms),
+    };
+    return namedtuple_make_new((const mp_obj_type_t *)&socketpool_socket_stats_type, 6, 0, items);
+}
+#endif
+
 STATIC bool _socketpool_socket(socketpool_socketpool_obj_t *self,
     socketpool_socketpool_addressfamily_t family, socketpool_socketpool_sock_t type,
     int proto,
@@ -211,6 +299,12 @@ STATIC bool _socketpool_socket(socketpool_socketpool_obj_t *self,
     sock->ipproto = ipproto;
     sock->pool = self;
     sock->timeout_ms = (uint)-1;
+    sock->recv_buf = NULL;
+    sock->recv_start = 0;
+    sock->recv_end = 0;
+    #if CIRCUITPY_NETWORK_STATS
+    memset(&sock->stats, 0, sizeof(sock->stats));
+    #endif
 
     // Create LWIP socket
     int socknum = -1;
@@ -308,6 +402,12 @@ int socketpool_socket_accept(socketpool_socket_obj_t *self, uint8_t *ip, uint32_
         accepted->pool = self->pool;
         accepted->connected = true;
         accepted->type = self->type;
+        accepted->recv_buf = NULL;
+        accepted->recv_start = 0;
+        accepted->recv_end = 0;
+        #if CIRCUITPY_NETWORK_STATS
+        memset(&accepted->stats, 0, sizeof(accepted->stats));
+        #endif
     }
 
     return newsoc;
@@ -326,6 +426,12 @@ socketpool_socket_obj_t *common_hal_socketpool_socket_accept(socketpool_socket_o
         sock->pool = self->pool;
         sock->connected = true;
         sock->type = self->type;
+        sock->recv_buf = NULL;
+        sock->recv_start = 0;
+        sock->recv_end = 0;
+        #if CIRCUITPY_NETWORK_STATS
+        memset(&sock->stats, 0, sizeof(sock->stats));
+        #endif
 
         return sock;
     } else {
@@ -366,6 +472,9 @@ void socketpool_socket_close(socketpool_socket_obj_t *self) {
         return;
     }
     self->connected = false;
+    self->recv_buf = NULL;
+    self->recv_start = 0;
+    self->recv_end = 0;
     int fd = self->num;
     // Ignore bogus/closed sockets
     if (fd >= LWIP_SOCKET_OFFSET) {
@@ -374,6 +483,7 @@ void socketpool_socket_close(socketpool_socket_obj_t *self) {
             lwip_shutdown(fd, SHUT_RDWR);
             lwip_close(fd);
         } else {
+            socket_poll_watch[fd - LWIP_SOCKET_OFFSET] = 0;
             lwip_shutdown(fd, SHUT_RDWR);
             lwip_close(fd);
             socket_fd_state[fd - LWIP_SOCKET_OFFSET] = FDSTATE_CLOSED;
@@ -419,7 +529,13 @@ void common_hal_socketpool_socket_connect(socketpool_socket_obj_t *self,
     lwip_fcntl(self->num, F_SETFL, opts);
 
     int result = -1;
+    #if CIRCUITPY_NETWORK_STATS
+    uint64_t start_ticks = supervisor_ticks_ms64();
+    #endif
     result = lwip_connect(self->num, (struct sockaddr *)&dest_addr, sizeof(struct sockaddr_in));
+    #if CIRCUITPY_NETWORK_STATS
+    self->stats.connect_ms = supervisor_ticks_ms64() - start_ticks;
+    #endif
 
     // Switch back once complete
     opts = opts | O_NONBLOCK;
@@ -469,6 +585,9 @@ mp_uint_t common_hal_socketpool_socket_recvfrom_into(socketpool_socket_obj_t *se
             mp_raise_OSError(MP_EAGAIN);
         }
     }
+    #if CIRCUITPY_NETWORK_STATS
+    socket_stats_record_recv(self, received, supervisor_ticks_ms64() - start_ticks);
+    #endif
 
     if (!timed_out) {
         memcpy((void *)ip, (void *)&source_addr.sin_addr.s_addr, sizeof(source_addr.sin_addr.s_addr));
@@ -485,11 +604,44 @@ mp_uint_t common_hal_socketpool_socket_recvfrom_into(socketpool_socket_obj_t *se
     return received;
 }
 
+#if CIRCUITPY_SOCKETPOOL_RECV_BUFFER_SIZE > 0
+// Read-ahead is only used for sockets owned by user code. Workflow sockets are
+// woken by select() on the lwIP socket, which can't see data buffered here.
+STATIC uint8_t *socket_recv_buffer(socketpool_socket_obj_t *self) {
+    if (self->recv_buf == NULL && self->type == SOCK_STREAM &&
+        self->num >= LWIP_SOCKET_OFFSET && user_socket[self->num - LWIP_SOCKET_OFFSET] == self) {
+        self->recv_buf = m_malloc_maybe(CIRCUITPY_SOCKETPOOL_RECV_BUFFER_SIZE);
+    }
+    return self->recv_buf;
+}
+#endif
+
 int socketpool_socket_recv_into(socketpool_socket_obj_t *self,
     const uint8_t *buf, uint32_t len) {
     int received = 0;
     bool timed_out = false;
 
+    #if CIRCUITPY_SOCKETPOOL_RECV_BUFFER_SIZE > 0
+    // Serve data that has already been read without going back into lwIP.
+    if (self->recv_start < self->recv_end) {
+        size_t available = MIN((uint32_t)(self->recv_end - self->recv_start), len);
+        memcpy((void *)buf, self->recv_buf + self->recv_start, available);
+        self->recv_start += available;
+        return available;
+    }
+    // Small reads fetch as much as is ready in one call, and larger ones go
+    // straight into the caller's buffer.
+    uint8_t *read_ahead = NULL;
+    if (len < CIRCUITPY_SOCKETPOOL_RECV_BUFFER_SIZE && self->num != -1) {
+        read_ahead = socket_recv_buffer(self);
+    }
+    uint8_t *dest = read_ahead != NULL ? read_ahead : (uint8_t *)buf;
+    uint32_t dest_len = read_ahead != NULL ? CIRCUITPY_SOCKETPOOL_RECV_BUFFER_SIZE : len;
+    #else
+    uint8_t *dest = (uint8_t *)buf;
+    uint32_t dest_len = len;
+    #endif
+
     if (self->num != -1) {
         // LWIP Socket
         uint64_t start_ticks = supervisor_ticks_ms64();
@@ -500,7 +652,7 @@ int socketpool_socket_recv_into(socketpool_socket_obj_t *self,
                 timed_out = supervisor_ticks_ms64() - start_ticks >= self->timeout_ms;
             }
             RUN_BACKGROUND_TASKS;
-            received = lwip_recv(self->num, (void *)buf, len, 0);
+            received = lwip_recv(self->num, dest, dest_len, 0);
             // In non-blocking mode, fail instead of looping
             if (received < 1 && self->timeout_ms == 0) {
                 if ((received == 0) || (errno == ENOTCONN)) {
@@ -518,6 +670,9 @@ int socketpool_socket_recv_into(socketpool_socket_obj_t *self,
                 break;
             }
         }
+        #if CIRCUITPY_NETWORK_STATS
+        socket_stats_record_recv(self, received, supervisor_ticks_ms64() - start_ticks);
+        #endif
     } else {
         return -MP_EBADF;
     }
@@ -525,6 +680,15 @@ int socketpool_socket_recv_into(socketpool_socket_obj_t *self,
     if (timed_out) {
         return -ETIMEDOUT;
     }
+    #if CIRCUITPY_SOCKETPOOL_RECV_BUFFER_SIZE > 0
+    if (read_ahead != NULL && received > 0) {
+        size_t available = MIN((uint32_t)received, len);
+        memcpy((void *)buf, read_ahead, available);
+        self->recv_start = available;
+        self->recv_end = received;
+        received = available;
+    }
+    #endif
     return received;
 }
 
@@ -542,6 +706,9 @@ int socketpool_socket_send(socketpool_socket_obj_t *self, const uint8_t *buf, ui
         // LWIP Socket
         // TODO: deal with potential failure/add timeout?
         sent = lwip_send(self->num, buf, len, 0);
+        #if CIRCUITPY_NETWORK_STATS
+        socket_stats_record_send(self, sent);
+        #endif
     } else {
         sent = -MP_EBADF;
     }
@@ -591,6 +758,9 @@ mp_uint_t common_hal_socketpool_socket_sendto(socketpool_socket_obj_t *self,
     dest_addr.sin_port = htons(port);
 
     int bytes_sent = lwip_sendto(self->num, buf, len, 0, (struct sockaddr *)&dest_addr, sizeof(dest_addr));
+    #if CIRCUITPY_NETWORK_STATS
+    socket_stats_record_send(self, bytes_sent);
+    #endif
     if (bytes_sent < 0) {
         mp_raise_BrokenPipeError();
         return 0;
@@ -612,6 +782,9 @@ int common_hal_socketpool_socket_setsockopt(socketpool_socket_obj_t *self, int l
 }
 
 bool common_hal_socketpool_readable(socketpool_socket_obj_t *self) {
+    if (self->recv_start < self->recv_end) {
+        return true;
+    }
     struct timeval immediate = {0, 0};
 
     fd_set fds;
@@ -619,6 +792,9 @@ bool common_hal_socketpool_readable(socketpool_socket_obj_t *self) {
     FD_SET(self->num, &fds);
     int num_triggered = select(self->num + 1, &fds, NULL, &fds, &immediate);
 
+    if (num_triggered == 0) {
+        watch_user_socket(self, POLL_WATCH_READ);
+    }
     // including returning true in the error case
     return num_triggered != 0;
 }
@@ -631,6 +807,9 @@ bool common_hal_socketpool_writable(socketpool_socket_obj_t *self) {
     FD_SET(self->num, &fds);
     int num_triggered = select(self->num + 1, NULL, &fds, &fds, &immediate);
 
+    if (num_triggered == 0) {
+        watch_user_socket(self, POLL_WATCH_WRITE);
+    }
     // including returning true in the error case
     return num_triggered != 0;
 }
@@ -648,4 +827,10 @@ void socketpool_socket_reset(socketpool_socket_obj_t *self) {
     self->base.type = &socketpool_socket_type;
     self->connected = false;
     self->num = -1;
+    self->recv_buf = NULL;
+    self->recv_start = 0;
+    self->recv_end = 0;
+    #if CIRCUITPY_NETWORK_STATS
+    memset(&self->stats, 0, sizeof(self->stats));
+    #endif
 }
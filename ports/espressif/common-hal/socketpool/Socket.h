@@ -35,6 +35,17 @@
 
 typedef struct ssl_sslsocket_obj ssl_sslsocket_obj_t;
 
+#if CIRCUITPY_NETWORK_STATS
+typedef struct {
+    uint32_t bytes_sent;
+    uint32_t bytes_received;
+    uint32_t send_stalls; // Sends refused with EAGAIN because lwIP's send buffer was full.
+    uint32_t recv_wait_ms;
+    uint32_t max_recv_wait_ms;
+    uint32_t connect_ms;
+} socketpool_socket_stats_t;
+#endif
+
 typedef struct {
     mp_obj_base_t base;
     int num;
@@ -45,8 +56,22 @@ typedef struct {
     socketpool_socketpool_obj_t *pool;
     ssl_sslsocket_obj_t *ssl_socket;
     mp_uint_t timeout_ms;
+    // Data read ahead from lwIP for small recv_into() calls on user sockets.
+    // recv_buf[recv_start:recv_end] has not been returned yet.
+    uint8_t *recv_buf;
+    uint16_t recv_start;
+    uint16_t recv_end;
+    #if CIRCUITPY_NETWORK_STATS
+    socketpool_socket_stats_t stats;
+    #endif
 } socketpool_socket_obj_t;
 
+// Reads shorter than this are served from a read-ahead buffer of this size,
+// so one lwIP call can satisfy many of them. 0 turns read-ahead off.
+#ifndef CIRCUITPY_SOCKETPOOL_RECV_BUFFER_SIZE
+#define CIRCUITPY_SOCKETPOOL_RECV_BUFFER_SIZE (256)
+#endif
+
 void socket_user_reset(void);
 // Unblock workflow socket select thread (platform specific)
 void socketpool_socket_poll_resume(void);
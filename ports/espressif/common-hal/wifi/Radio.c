@@ -42,6 +42,12 @@
 
 #include "components/esp_wifi/include/esp_wifi.h"
 #include "components/lwip/include/apps/ping/ping_sock.h"
+#include "components/lwip/lwip/src/include/lwip/memp.h"
+#include "components/lwip/lwip/src/include/lwip/stats.h"
+
+#include "esp_attr.h"
+#include "mbedtls/pkcs5.h"
+#include "mbedtls/sha256.h"
 
 #if CIRCUITPY_MDNS
 #include "common-hal/mdns/Server.h"
@@ -49,6 +55,26 @@
 
 #define MAC_ADDRESS_LENGTH 6
 
+#define FAST_CONNECT_MAGIC (0x57464331)
+
+// What the last fast_connect connection learned, so that the next one can skip
+// the scan, the PBKDF2 key derivation and DHCP. RTC memory survives deep sleep
+// but not a power cycle, after which connect takes the normal path.
+typedef struct {
+    uint32_t magic;
+    // SHA-256 of the ssid and password the rest belongs to.
+    uint8_t credentials_hash[32];
+    uint8_t bssid[MAC_ADDRESS_LENGTH];
+    uint8_t channel;
+    // The WPA2 PSK, when the network uses one.
+    bool pmk_valid;
+    uint8_t pmk[32];
+    esp_netif_ip_info_t ip_info;
+    esp_netif_dns_info_t dns;
+} fast_connect_cache_t;
+
+static RTC_DATA_ATTR fast_connect_cache_t fast_connect_cache;
+
 static void set_mode_station(wifi_radio_obj_t *self, bool state) {
     wifi_mode_t next_mode;
     if (state) {
@@ -288,51 +314,8 @@ mp_obj_t common_hal_wifi_radio_get_stations_ap(wifi_radio_obj_t *self) {
     return mp_sta_list;
 }
 
-wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t channel, mp_float_t timeout, uint8_t *bssid, size_t bssid_len) {
-    if (!common_hal_wifi_radio_get_enabled(self)) {
-        mp_raise_RuntimeError(MP_ERROR_TEXT("wifi is not enabled"));
-    }
+static void set_station_config(wifi_radio_obj_t *self, uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t channel, uint8_t *bssid, size_t bssid_len) {
     wifi_config_t *config = &self->sta_config;
-
-    size_t timeout_ms = timeout * 1000;
-    uint32_t start_time = common_hal_time_monotonic_ms();
-    uint32_t end_time = start_time + timeout_ms;
-
-    EventBits_t bits;
-    // can't block since both bits are false after wifi_init
-    // both bits are true after an existing connection stops
-    bits = xEventGroupWaitBits(self->event_group_handle,
-        WIFI_CONNECTED_BIT | WIFI_DISCONNECTED_BIT,
-        pdTRUE,
-        pdTRUE,
-        0);
-    bool connected = ((bits & WIFI_CONNECTED_BIT) != 0) &&
-        !((bits & WIFI_DISCONNECTED_BIT) != 0);
-    if (connected) {
-        // SSIDs are up to 32 bytes. Assume it is null terminated if it is less.
-        if (memcmp(ssid, config->sta.ssid, ssid_len) == 0 &&
-            (ssid_len == 32 || strlen((const char *)config->sta.ssid) == ssid_len)) {
-            // Already connected to the desired network.
-            return WIFI_RADIO_ERROR_NONE;
-        } else {
-            xEventGroupClearBits(self->event_group_handle, WIFI_DISCONNECTED_BIT);
-            // Trying to switch networks so disconnect first.
-            esp_wifi_disconnect();
-            do {
-                RUN_BACKGROUND_TASKS;
-                bits = xEventGroupWaitBits(self->event_group_handle,
-                    WIFI_DISCONNECTED_BIT,
-                    pdTRUE,
-                    pdTRUE,
-                    0);
-            } while ((bits & WIFI_DISCONNECTED_BIT) == 0 && !mp_hal_is_interrupted());
-        }
-    }
-    // explicitly clear bits since xEventGroupWaitBits may have timed out
-    xEventGroupClearBits(self->event_group_handle, WIFI_CONNECTED_BIT);
-    xEventGroupClearBits(self->event_group_handle, WIFI_DISCONNECTED_BIT);
-    set_mode_station(self, true);
-
     memcpy(&config->sta.ssid, ssid, ssid_len);
     if (ssid_len < 32) {
         config->sta.ssid[ssid_len] = 0;
@@ -358,8 +341,13 @@ wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t
         config->sta.scan_method = WIFI_FAST_SCAN;
     }
     esp_wifi_set_config(ESP_IF_WIFI_STA, config);
+}
+
+// Retries happen in the event handler, up to retries times.
+static wifi_radio_error_t connect_and_wait(wifi_radio_obj_t *self, uint8_t retries, uint32_t end_time) {
+    EventBits_t bits;
     self->starting_retries = 5;
-    self->retries_left = 5;
+    self->retries_left = retries;
     esp_wifi_connect();
 
     do {
@@ -392,6 +380,145 @@ wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t
     return WIFI_RADIO_ERROR_NONE;
 }
 
+static void hash_credentials(uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t hash[32]) {
+    mbedtls_sha256_context ctx;
+    mbedtls_sha256_init(&ctx);
+    mbedtls_sha256_starts(&ctx, 0);
+    uint8_t length = ssid_len;
+    mbedtls_sha256_update(&ctx, &length, sizeof(length));
+    mbedtls_sha256_update(&ctx, ssid, ssid_len);
+    mbedtls_sha256_update(&ctx, password, password_len);
+    mbedtls_sha256_finish(&ctx, hash);
+    mbedtls_sha256_free(&ctx);
+}
+
+// A single try with the cached AP, key and address. Explicit channel and bssid
+// arguments still win.
+static wifi_radio_error_t fast_connect_from_cache(wifi_radio_obj_t *self, uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t channel, uint8_t *bssid, size_t bssid_len, uint32_t end_time) {
+    fast_connect_cache_t *cache = &fast_connect_cache;
+    if (channel == 0 && bssid_len == 0) {
+        channel = cache->channel;
+        bssid = cache->bssid;
+        bssid_len = MAC_ADDRESS_LENGTH;
+    }
+    // The 64 hex digit form of the key skips deriving it from the password.
+    char pmk_hex[sizeof(cache->pmk) * 2 + 1];
+    if (cache->pmk_valid) {
+        static const char hex[] = "0123456789abcdef";
+        for (size_t i = 0; i < sizeof(cache->pmk); i++) {
+            pmk_hex[i * 2] = hex[cache->pmk[i] >> 4];
+            pmk_hex[i * 2 + 1] = hex[cache->pmk[i] & 0xf];
+        }
+        pmk_hex[sizeof(pmk_hex) - 1] = '\0';
+        password = (uint8_t *)pmk_hex;
+        password_len = sizeof(cache->pmk) * 2;
+    }
+    set_station_config(self, ssid, ssid_len, password, password_len, channel, bssid, bssid_len);
+    if (cache->ip_info.ip.addr != 0) {
+        // Reuse the last lease as a static address, which skips DHCP.
+        esp_netif_dhcpc_stop(self->netif);
+        esp_netif_set_ip_info(self->netif, &cache->ip_info);
+        esp_netif_set_dns_info(self->netif, ESP_NETIF_DNS_MAIN, &cache->dns);
+    }
+    return connect_and_wait(self, 0, end_time);
+}
+
+static void save_fast_connect(wifi_radio_obj_t *self, const uint8_t credentials_hash[32], uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len) {
+    fast_connect_cache_t *cache = &fast_connect_cache;
+    wifi_ap_record_t ap;
+    if (esp_wifi_sta_get_ap_info(&ap) != ESP_OK) {
+        return;
+    }
+    cache->magic = 0;
+    memcpy(cache->credentials_hash, credentials_hash, sizeof(cache->credentials_hash));
+    memcpy(cache->bssid, ap.bssid, MAC_ADDRESS_LENGTH);
+    cache->channel = ap.primary;
+    esp_netif_get_ip_info(self->netif, &cache->ip_info);
+    esp_netif_get_dns_info(self->netif, ESP_NETIF_DNS_MAIN, &cache->dns);
+
+    // Only plain WPA/WPA2 PSK networks take the key in place of the password.
+    // A hex password is the key already.
+    cache->pmk_valid = false;
+    bool psk = ap.authmode == WIFI_AUTH_WPA_PSK ||
+        ap.authmode == WIFI_AUTH_WPA2_PSK ||
+        ap.authmode == WIFI_AUTH_WPA_WPA2_PSK;
+    if (psk && password_len >= 8 && password_len < 64) {
+        cache->pmk_valid = mbedtls_pkcs5_pbkdf2_hmac_ext(MBEDTLS_MD_SHA1,
+            password, password_len, ssid, ssid_len, 4096, sizeof(cache->pmk), cache->pmk) == 0;
+    }
+    cache->magic = FAST_CONNECT_MAGIC;
+}
+
+wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t channel, mp_float_t timeout, uint8_t *bssid, size_t bssid_len, bool fast_connect) {
+    if (!common_hal_wifi_radio_get_enabled(self)) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("wifi is not enabled"));
+    }
+    wifi_config_t *config = &self->sta_config;
+
+    size_t timeout_ms = timeout * 1000;
+    uint32_t start_time = common_hal_time_monotonic_ms();
+    uint32_t end_time = start_time + timeout_ms;
+
+    EventBits_t bits;
+    // can't block since both bits are false after wifi_init
+    // both bits are true after an existing connection stops
+    bits = xEventGroupWaitBits(self->event_group_handle,
+        WIFI_CONNECTED_BIT | WIFI_DISCONNECTED_BIT,
+        pdTRUE,
+        pdTRUE,
+        0);
+    bool connected = ((bits & WIFI_CONNECTED_BIT) != 0) &&
+        !((bits & WIFI_DISCONNECTED_BIT) != 0);
+    if (connected) {
+        // SSIDs are up to 32 bytes. Assume it is null terminated if it is less.
+        if (memcmp(ssid, config->sta.ssid, ssid_len) == 0 &&
+            (ssid_len == 32 || strlen((const char *)config->sta.ssid) == ssid_len)) {
+            // Already connected to the desired network.
+            return WIFI_RADIO_ERROR_NONE;
+        } else {
+            xEventGroupClearBits(self->event_group_handle, WIFI_DISCONNECTED_BIT);
+            // Trying to switch networks so disconnect first.
+            esp_wifi_disconnect();
+            do {
+                RUN_BACKGROUND_TASKS;
+                bits = xEventGroupWaitBits(self->event_group_handle,
+                    WIFI_DISCONNECTED_BIT,
+                    pdTRUE,
+                    pdTRUE,
+                    0);
+            } while ((bits & WIFI_DISCONNECTED_BIT) == 0 && !mp_hal_is_interrupted());
+        }
+    }
+    // explicitly clear bits since xEventGroupWaitBits may have timed out
+    xEventGroupClearBits(self->event_group_handle, WIFI_CONNECTED_BIT);
+    xEventGroupClearBits(self->event_group_handle, WIFI_DISCONNECTED_BIT);
+    set_mode_station(self, true);
+
+    uint8_t credentials_hash[32];
+    fast_connect_cache_t *cache = &fast_connect_cache;
+    if (fast_connect) {
+        hash_credentials(ssid, ssid_len, password, password_len, credentials_hash);
+        if (cache->magic == FAST_CONNECT_MAGIC &&
+            memcmp(cache->credentials_hash, credentials_hash, sizeof(credentials_hash)) == 0) {
+            wifi_radio_error_t error = fast_connect_from_cache(self, ssid, ssid_len, password, password_len, channel, bssid, bssid_len, end_time);
+            if (error == WIFI_RADIO_ERROR_NONE) {
+                return error;
+            }
+            // Something changed. Forget it all and connect the normal way.
+            cache->magic = 0;
+            esp_netif_dhcpc_start(self->netif);
+            xEventGroupClearBits(self->event_group_handle, WIFI_CONNECTED_BIT | WIFI_DISCONNECTED_BIT);
+        }
+    }
+
+    set_station_config(self, ssid, ssid_len, password, password_len, channel, bssid, bssid_len);
+    wifi_radio_error_t error = connect_and_wait(self, 5, end_time);
+    if (error == WIFI_RADIO_ERROR_NONE && fast_connect) {
+        save_fast_connect(self, credentials_hash, ssid, ssid_len, password, password_len);
+    }
+    return error;
+}
+
 bool common_hal_wifi_radio_get_connected(wifi_radio_obj_t *self) {
     return self->sta_mode && esp_netif_is_netif_up(self->netif);
 }
@@ -582,3 +709,34 @@ void common_hal_wifi_radio_gc_collect(wifi_radio_obj_t *self) {
     // Only bother to scan the actual object references.
     gc_collect_ptr(self->current_scan);
 }
+
+#if CIRCUITPY_NETWORK_STATS
+mp_obj_t common_hal_wifi_radio_get_stats(wifi_radio_obj_t *self) {
+    mp_obj_t items[9] = {
+        mp_obj_new_int_from_uint(lwip_stats.tcp.xmit),
+        mp_obj_new_int_from_uint(lwip_stats.tcp.recv),
+        #if MIB2_STATS
+        mp_obj_new_int_from_uint(lwip_stats.mib2.tcpretranssegs),
+        #else
+        mp_const_none,
+        #endif
+        mp_obj_new_int_from_uint(lwip_stats.tcp.drop),
+        mp_obj_new_int_from_uint(lwip_stats.ip.drop),
+        mp_obj_new_int_from_uint(lwip_stats.link.drop),
+        // Pools and the heap are only counted when lwIP manages them itself.
+        #if MEMP_STATS
+        mp_obj_new_int_from_uint(lwip_stats.memp[MEMP_PBUF_POOL]->err),
+        mp_obj_new_int_from_uint(lwip_stats.memp[MEMP_TCP_SEG]->err),
+        #else
+        mp_const_none,
+        mp_const_none,
+        #endif
+        #if MEM_STATS
+        mp_obj_new_int_from_uint(lwip_stats.mem.err),
+        #else
+        mp_const_none,
+        #endif
+    };
+    return namedtuple_make_new((const mp_obj_type_t *)&wifi_radio_stats_type, 9, 0, items);
+}
+#endif
@@ -16,10 +16,14 @@ CIRCUITPY_FULL_BUILD ?= 1
 # If SSL is enabled, it's mbedtls
 CIRCUITPY_SSL_MBEDTLS = 1
 
+# The ESP-IDF mbedtls uses the AES peripheral (hashlib already gets the SHA one)
+CIRCUITPY_AESIO_MBEDTLS ?= 1
+
 # These modules are implemented in ports/<port>/common-hal:
 CIRCUITPY_ALARM ?= 1
 CIRCUITPY_ANALOGBUFIO ?= 1
 CIRCUITPY_AUDIOBUSIO ?= 1
+CIRCUITPY_AUDIOBUSIO_I2S ?= $(CIRCUITPY_AUDIOBUSIO)
 CIRCUITPY_AUDIOBUSIO_PDMIN ?= 0
 CIRCUITPY_AUDIOIO ?= 0
 CIRCUITPY_AUDIOMP3 ?= 0
@@ -52,6 +56,7 @@ CIRCUITPY_RGBMATRIX = 0
 CIRCUITPY_BLEIO = 0
 # Features
 CIRCUITPY_USB = 0
+CIRCUITPY_ENABLE_MPY_NATIVE ?= 1
 
 else ifeq ($(IDF_TARGET),esp32c3)
 # Modules
@@ -113,11 +118,15 @@ else ifeq ($(IDF_TARGET),esp32s2)
 # No BLE in hw
 CIRCUITPY_BLEIO = 0
 
+# Features
+CIRCUITPY_ENABLE_MPY_NATIVE ?= 1
 CIRCUITPY_ESP_USB_SERIAL_JTAG ?= 0
 
 else ifeq ($(IDF_TARGET),esp32s3)
 # Modules
 CIRCUITPY_BITMAPFILTER ?= $(CIRCUITPY_ESPCAMERA)
+# Features
+CIRCUITPY_ENABLE_MPY_NATIVE ?= 1
 CIRCUITPY_ESP_USB_SERIAL_JTAG ?= 0
 
 # No room for _bleio on boards with 4MB flash
@@ -129,9 +138,10 @@ endif
 
 endif
 
-# No room for dualbank on boards with 2MB flash
+# No room for dualbank or the native emitter on boards with 2MB flash
 ifeq ($(CIRCUITPY_ESP_FLASH_SIZE),2MB)
 CIRCUITPY_DUALBANK = 0
+CIRCUITPY_ENABLE_MPY_NATIVE = 0
 endif
 
 # Modules dependent on other modules
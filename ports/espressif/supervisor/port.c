@@ -55,6 +55,7 @@
 #include "supervisor/background_callback.h"
 #include "supervisor/shared/tick.h"
 #include "shared-bindings/microcontroller/__init__.h"
+#include "shared-bindings/microcontroller/Processor.h"
 #include "shared-bindings/microcontroller/RunMode.h"
 #include "shared-bindings/rtc/__init__.h"
 #include "shared-bindings/socketpool/__init__.h"
@@ -84,9 +85,11 @@
 
 #include "bootloader_flash_config.h"
 
+#include "esp_cpu.h"
 #include "esp_debug_helpers.h"
 #include "esp_efuse.h"
 #include "esp_ipc.h"
+#include "esp_memory_utils.h"
 #include "esp_rom_efuse.h"
 #include "esp_timer.h"
 
@@ -330,6 +333,14 @@ void *port_malloc(size_t size, bool dma_capable) {
     return ptr;
 }
 
+void *port_malloc_fast(size_t size) {
+    return heap_caps_malloc(size, MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL);
+}
+
+bool port_heap_is_fast(void *ptr) {
+    return esp_ptr_internal(ptr);
+}
+
 void port_free(void *ptr) {
     heap_caps_free(ptr);
 }
@@ -343,6 +354,23 @@ size_t port_heap_get_largest_free_size(void) {
     return free_size;
 }
 
+#if CIRCUITPY_ENABLE_MPY_NATIVE
+// Native code is run from IRAM.
+void *port_malloc_exec(size_t size) {
+    void *ptr = heap_caps_malloc(size, MALLOC_CAP_EXEC);
+    // Some IDF versions hand out non-executable memory for MALLOC_CAP_EXEC on the S2.
+    if (ptr != NULL && !esp_ptr_executable(ptr)) {
+        heap_caps_free(ptr);
+        ptr = NULL;
+    }
+    return ptr;
+}
+
+void port_free_exec(void *ptr) {
+    heap_caps_free(ptr);
+}
+#endif
+
 void reset_port(void) {
     // TODO deinit for esp32-camera
     #if CIRCUITPY_ESPCAMERA
@@ -454,6 +482,14 @@ uint64_t port_get_raw_ticks(uint8_t *subticks) {
     return all_subticks / 32;
 }
 
+uint32_t port_get_cycle_count(void) {
+    return esp_cpu_get_cycle_count();
+}
+
+uint32_t port_get_cycle_count_frequency(void) {
+    return common_hal_mcu_processor_get_frequency();
+}
+
 // Enable 1/1024 second tick.
 void port_enable_tick(void) {
     esp_timer_start_periodic(_tick_timer, 1000000 / 1024);
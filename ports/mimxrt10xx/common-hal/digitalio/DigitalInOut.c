@@ -177,3 +177,28 @@ digitalio_pull_t common_hal_digitalio_digitalinout_get_pull(
         return self->pull;
     }
 }
+
+bool common_hal_digitalio_has_reg_op(digitalinout_reg_op_t op) {
+    return true;
+}
+
+volatile uint32_t *common_hal_digitalio_digitalinout_get_reg(digitalio_digitalinout_obj_t *self, digitalinout_reg_op_t op, uint32_t *mask) {
+    GPIO_Type *gpio = self->pin->gpio;
+
+    *mask = 1u << self->pin->number;
+
+    switch (op) {
+        case DIGITALINOUT_REG_READ:
+            return (volatile uint32_t *)&gpio->DR;
+        case DIGITALINOUT_REG_WRITE:
+            return &gpio->DR;
+        case DIGITALINOUT_REG_SET:
+            return &gpio->DR_SET;
+        case DIGITALINOUT_REG_RESET:
+            return &gpio->DR_CLEAR;
+        case DIGITALINOUT_REG_TOGGLE:
+            return &gpio->DR_TOGGLE;
+        default:
+            return NULL;
+    }
+}
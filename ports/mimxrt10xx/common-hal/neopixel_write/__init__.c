@@ -64,8 +64,8 @@ void PLACE_IN_ITCM(common_hal_neopixel_write)(const digitalio_digitalinout_obj_t
     const uint32_t pin = digitalinout->pin->number;
 
     __disable_irq();
-    // Use DWT in debug core. Usable when interrupts disabled, as opposed to Systick->VAL
-    DWT->CYCCNT = 0;
+    // Use DWT in debug core. Usable when interrupts disabled, as opposed to Systick->VAL.
+    // Leave CYCCNT running because port_get_cycle_count() shares it.
 
     for (;;) {
         cyc = (pix & mask) ? t1 : t0;
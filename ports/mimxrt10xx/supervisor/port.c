@@ -525,6 +525,15 @@ uint64_t port_get_raw_ticks(uint8_t *subticks) {
     return ticks / 32;
 }
 
+// The DWT cycle counter is turned on in port_init().
+uint32_t port_get_cycle_count(void) {
+    return DWT->CYCCNT;
+}
+
+uint32_t port_get_cycle_count_frequency(void) {
+    return SystemCoreClock;
+}
+
 #if IMXRT10XX
 void SNVS_HP_WRAPPER_IRQHandler(void);
 __attribute__((used))
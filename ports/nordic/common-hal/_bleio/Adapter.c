@@ -27,6 +27,7 @@
  */
 
 #include <math.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
@@ -525,7 +526,7 @@ STATIC bool scan_on_ble_evt(ble_evt_t *ble_evt, void *scan_results_in) {
     return true;
 }
 
-mp_obj_t common_hal_bleio_adapter_start_scan(bleio_adapter_obj_t *self, uint8_t *prefixes, size_t prefix_length, bool extended, mp_int_t buffer_size, mp_float_t timeout, mp_float_t interval, mp_float_t window, mp_int_t minimum_rssi, bool active) {
+mp_obj_t common_hal_bleio_adapter_start_scan(bleio_adapter_obj_t *self, uint8_t *prefixes, size_t prefix_length, bool extended, mp_int_t buffer_size, mp_float_t timeout, mp_float_t interval, mp_float_t window, mp_int_t minimum_rssi, bool active, const bleio_scan_filter_t *filter) {
     if (self->scan_results != NULL) {
         if (!shared_module_bleio_scanresults_get_done(self->scan_results)) {
             mp_raise_bleio_BluetoothError(MP_ERROR_TEXT("Scan already in progress. Stop with stop_scan."));
@@ -542,7 +543,7 @@ mp_obj_t common_hal_bleio_adapter_start_scan(bleio_adapter_obj_t *self, uint8_t
     if (self->current_advertising_data != NULL) {
         common_hal_bleio_adapter_stop_advertising(self);
     }
-    self->scan_results = shared_module_bleio_new_scanresults(buffer_size, prefixes, prefix_length, minimum_rssi);
+    self->scan_results = shared_module_bleio_new_scanresults(buffer_size, prefixes, prefix_length, minimum_rssi, filter);
     size_t max_packet_size = extended ? BLE_GAP_SCAN_BUFFER_EXTENDED_MAX_SUPPORTED : BLE_GAP_SCAN_BUFFER_MAX;
     uint8_t *raw_data = m_malloc(sizeof(ble_data_t) + max_packet_size);
     ble_data_t *sd_data = (ble_data_t *)raw_data;
@@ -985,12 +986,34 @@ bool common_hal_bleio_adapter_is_bonded_to_central(bleio_adapter_obj_t *self) {
     return bonding_peripheral_bond_count() > 0;
 }
 
-void bleio_adapter_gc_collect(bleio_adapter_obj_t *adapter) {
-    // We divide by size_t so that we can scan each 32-bit aligned value to see
-    // if it is a pointer. This allows us to change the structs without worrying
-    // about collecting new pointers.
-    gc_collect_root((void **)adapter, sizeof(bleio_adapter_obj_t) / (sizeof(size_t)));
-    gc_collect_root((void **)bleio_connections, sizeof(bleio_connections) / (sizeof(size_t)));
+// Only these fields can point into the heap, so nothing else in the structs is traced.
+// The event handler entries are linked into a list that can continue into heap
+// allocated entries.
+STATIC const uint16_t adapter_root_offsets[] = {
+    offsetof(bleio_adapter_obj_t, advertising_data),
+    offsetof(bleio_adapter_obj_t, scan_response_data),
+    offsetof(bleio_adapter_obj_t, current_advertising_data),
+    offsetof(bleio_adapter_obj_t, scan_results),
+    offsetof(bleio_adapter_obj_t, name),
+    offsetof(bleio_adapter_obj_t, connection_objs),
+    offsetof(bleio_adapter_obj_t, connection_handler_entry.next),
+    offsetof(bleio_adapter_obj_t, advertising_handler_entry.next),
+};
+
+STATIC gc_root_t adapter_root = GC_ROOT(&common_hal_bleio_adapter_obj, bleio_adapter_obj_t, 1, adapter_root_offsets);
+
+STATIC const uint16_t connections_root_offsets[] = {
+    offsetof(bleio_connection_internal_t, remote_service_list),
+    offsetof(bleio_connection_internal_t, connection_obj),
+    offsetof(bleio_connection_internal_t, handler_entry.next),
+};
+
+STATIC gc_root_t connections_root = GC_ROOT(bleio_connections, bleio_connection_internal_t,
+    BLEIO_TOTAL_CONNECTION_COUNT, connections_root_offsets);
+
+void bleio_adapter_register_gc_roots(void) {
+    gc_root_register(&adapter_root);
+    gc_root_register(&connections_root);
 }
 
 void bleio_adapter_reset(bleio_adapter_obj_t *adapter) {
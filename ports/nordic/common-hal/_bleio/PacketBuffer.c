@@ -66,11 +66,11 @@ STATIC void write_to_ringbuf(bleio_packet_buffer_obj_t *self, uint8_t *data, uin
 }
 
 STATIC uint32_t queue_next_write(bleio_packet_buffer_obj_t *self) {
-    // Queue up the next outgoing buffer. We use two, one that has been passed to the SD for
-    // transmission (when packet_queued is true) and the other is `pending` and can still be
-    // modified. By primarily appending to the `pending` buffer we can reduce the protocol overhead
-    // of the lower level link and ATT layers.
-    self->packet_queued = false;
+    // Queue up the next outgoing buffer. Notifications and write commands are copied into the
+    // SD's tx queue, so several packets can be in flight at once, up to its queue credits. Once
+    // the queue is full, writes keep appending to the `pending` buffer, which reduces the protocol
+    // overhead of the lower level link and ATT layers, until a tx complete event sends it. We
+    // alternate between two buffers so that the one last handed to the SD is left alone.
     if (self->pending_size > 0) {
         uint16_t conn_handle = self->conn_handle;
         uint32_t err_code;
@@ -96,22 +96,40 @@ STATIC uint32_t queue_next_write(bleio_packet_buffer_obj_t *self) {
             err_code = sd_ble_gatts_hvx(conn_handle, &hvx_params);
         }
         if (err_code != NRF_SUCCESS) {
-            // On error, simply skip updating the pending buffers so that the next HVC or WRITE
-            // complete event triggers another attempt.
+            // On error (usually a full SD queue), simply skip updating the pending buffers so
+            // that the next HVN/HVC or WRITE complete event triggers another attempt.
             return err_code;
         }
         self->pending_size = 0;
         self->pending_index = (self->pending_index + 1) % 2;
-        self->packet_queued = true;
+        self->packets_in_flight++;
     }
     return NRF_SUCCESS;
 }
 
+STATIC void packets_sent(bleio_packet_buffer_obj_t *self, uint8_t count) {
+    // Tx complete events count packets for every characteristic on the connection.
+    self->packets_in_flight = count < self->packets_in_flight ? self->packets_in_flight - count : 0;
+    queue_next_write(self);
+}
+
+// Ask for 2M PHY and the longest link layer packets so that each connection event carries
+// more data. These are nice-to-haves so ignore any errors; the peer may decline them.
+STATIC void request_fast_link(uint16_t conn_handle) {
+    ble_gap_phys_t const phys = {
+        .rx_phys = BLE_GAP_PHY_2MBPS,
+        .tx_phys = BLE_GAP_PHY_2MBPS,
+    };
+    sd_ble_gap_phy_update(conn_handle, &phys);
+    sd_ble_gap_data_length_update(conn_handle, NULL, NULL);
+}
+
 STATIC bool packet_buffer_on_ble_client_evt(ble_evt_t *ble_evt, void *param) {
     const uint16_t evt_id = ble_evt->header.evt_id;
     bleio_packet_buffer_obj_t *self = (bleio_packet_buffer_obj_t *)param;
     if (evt_id == BLE_GAP_EVT_DISCONNECTED && self->conn_handle == ble_evt->evt.gap_evt.conn_handle) {
         self->conn_handle = BLE_CONN_HANDLE_INVALID;
+        self->packets_in_flight = 0;
     }
     // Check if this is a GATTC event so we can make sure the conn_handle is valid.
     if (evt_id < BLE_GATTC_EVT_BASE || evt_id > BLE_GATTC_EVT_LAST) {
@@ -136,10 +154,10 @@ STATIC bool packet_buffer_on_ble_client_evt(ble_evt_t *ble_evt, void *param) {
             break;
         }
         case BLE_GATTC_EVT_WRITE_CMD_TX_COMPLETE:
-            queue_next_write(self);
+            packets_sent(self, ble_evt->evt.gattc_evt.params.write_cmd_tx_complete.count);
             break;
         case BLE_GATTC_EVT_WRITE_RSP:
-            queue_next_write(self);
+            packets_sent(self, 1);
             break;
         default:
             return false;
@@ -169,6 +187,7 @@ STATIC bool packet_buffer_on_ble_server_evt(ble_evt_t *ble_evt, void *param) {
                 uint16_t cccd = *((uint16_t *)evt_write->data);
                 if (cccd & BLE_GATT_HVX_NOTIFICATION) {
                     self->conn_handle = conn_handle;
+                    request_fast_link(conn_handle);
                 } else {
                     self->conn_handle = BLE_CONN_HANDLE_INVALID;
                 }
@@ -189,6 +208,7 @@ STATIC bool packet_buffer_on_ble_server_evt(ble_evt_t *ble_evt, void *param) {
             sd_ble_gatts_value_get(conn_handle, self->characteristic->cccd_handle, &value);
             if (cccd & BLE_GATT_HVX_NOTIFICATION) {
                 self->conn_handle = conn_handle;
+                request_fast_link(conn_handle);
             }
             break;
         }
@@ -197,10 +217,21 @@ STATIC bool packet_buffer_on_ble_server_evt(ble_evt_t *ble_evt, void *param) {
         case BLE_GAP_EVT_DISCONNECTED:
             if (self->conn_handle == ble_evt->evt.gap_evt.conn_handle) {
                 self->conn_handle = BLE_CONN_HANDLE_INVALID;
+                self->packets_in_flight = 0;
             }
             break;
         case BLE_GATTS_EVT_HVN_TX_COMPLETE:
-            queue_next_write(self);
+            if (ble_evt->evt.gatts_evt.conn_handle != self->conn_handle) {
+                return false;
+            }
+            packets_sent(self, ble_evt->evt.gatts_evt.params.hvn_tx_complete.count);
+            break;
+        case BLE_GATTS_EVT_HVC:
+            // An indication was confirmed.
+            if (ble_evt->evt.gatts_evt.conn_handle != self->conn_handle) {
+                return false;
+            }
+            packets_sent(self, 1);
             break;
         default:
             return false;
@@ -236,7 +267,7 @@ void _common_hal_bleio_packet_buffer_construct(
         ringbuf_init(&self->ringbuf, (uint8_t *)incoming_buffer, incoming_buffer_size);
     }
 
-    self->packet_queued = false;
+    self->packets_in_flight = 0;
     self->pending_index = 0;
     self->pending_size = 0;
     self->outgoing[0] = outgoing_buffer1;
@@ -401,12 +432,12 @@ mp_int_t common_hal_bleio_packet_buffer_write(bleio_packet_buffer_obj_t *self, c
     self->pending_size += len;
     num_bytes_written += len;
 
+    // Send the data now if the SD has room for it. Otherwise the next tx complete
+    // event will, along with anything appended meanwhile.
+    queue_next_write(self);
+
     sd_nvic_critical_region_exit(is_nested_critical_region);
 
-    // If no writes are queued then sneak in this data.
-    if (!self->packet_queued) {
-        queue_next_write(self);
-    }
     return num_bytes_written;
 }
 
@@ -487,7 +518,7 @@ mp_int_t common_hal_bleio_packet_buffer_get_outgoing_packet_length(bleio_packet_
 
 void common_hal_bleio_packet_buffer_flush(bleio_packet_buffer_obj_t *self) {
     while ((self->pending_size != 0 ||
-            self->packet_queued) &&
+            self->packets_in_flight != 0) &&
            self->conn_handle != BLE_CONN_HANDLE_INVALID &&
            !mp_hal_is_interrupted()) {
         RUN_BACKGROUND_TASKS;
@@ -37,8 +37,8 @@ typedef struct {
     bleio_characteristic_obj_t *characteristic;
     // Ring buffer storing consecutive incoming values.
     ringbuf_t ringbuf;
-    // Two outgoing buffers to alternate between. One will be queued for transmission by the SD and
-    // the other is waiting to be queued and can be extended.
+    // Two outgoing buffers to alternate between. One was last handed to the SD and the other
+    // is waiting to be queued and can be extended.
     uint32_t *outgoing[2];
     volatile uint16_t pending_size;
     // We remember the conn_handle so we can do a NOTIFY/INDICATE to a client.
@@ -47,8 +47,9 @@ typedef struct {
     uint16_t max_packet_size;
     uint8_t pending_index;
     uint8_t write_type;
+    // Number of packets handed to the SD that it hasn't reported as sent yet.
+    volatile uint8_t packets_in_flight;
     bool client;
-    bool packet_queued;
 } bleio_packet_buffer_obj_t;
 
 #endif // MICROPY_INCLUDED_NRF_COMMON_HAL_BLEIO_PACKETBUFFER_H
@@ -159,3 +159,27 @@ digitalio_pull_t common_hal_digitalio_digitalinout_get_pull(
             return PULL_NONE;
     }
 }
+
+bool common_hal_digitalio_has_reg_op(digitalinout_reg_op_t op) {
+    return op != DIGITALINOUT_REG_TOGGLE;
+}
+
+volatile uint32_t *common_hal_digitalio_digitalinout_get_reg(digitalio_digitalinout_obj_t *self, digitalinout_reg_op_t op, uint32_t *mask) {
+    uint32_t pin = self->pin->number;
+    NRF_GPIO_Type *reg = nrf_gpio_pin_port_decode(&pin);
+
+    *mask = 1u << pin;
+
+    switch (op) {
+        case DIGITALINOUT_REG_READ:
+            return (volatile uint32_t *)&reg->IN;
+        case DIGITALINOUT_REG_WRITE:
+            return &reg->OUT;
+        case DIGITALINOUT_REG_SET:
+            return &reg->OUTSET;
+        case DIGITALINOUT_REG_RESET:
+            return &reg->OUTCLR;
+        default:
+            return NULL;
+    }
+}
@@ -132,3 +132,18 @@ void common_hal_memorymap_addressrange_get_bytes(const memorymap_addressrange_ob
     }
     #pragma GCC diagnostic pop
 }
+
+bool common_hal_memorymap_addressrange_get_buffer(const memorymap_addressrange_obj_t *self,
+    mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    // Flash (the first allowed range) can be read directly and RAM read and written.
+    // Peripheral registers can't be a buffer.
+    uint8_t *flash_end = (uint8_t *)allow_ranges[0][1];
+    bool in_flash = self->start_address + self->len <= flash_end;
+    bool in_ram = (size_t)self->start_address >= 0x20000000 && (size_t)self->start_address < 0x40000000;
+    if ((in_flash && !(flags & MP_BUFFER_WRITE)) || in_ram) {
+        bufinfo->buf = self->start_address;
+        bufinfo->len = self->len;
+        return true;
+    }
+    return false;
+}
@@ -24,6 +24,7 @@
  * THE SOFTWARE.
  */
 
+#include "py/gc.h"
 #include "py/mphal.h"
 #include "py/mpstate.h"
 #include "shared-bindings/neopixel_write/__init__.h"
@@ -101,6 +102,19 @@ static NRF_PWM_Type *find_free_pwm(void) {
     return NULL;
 }
 
+// Fills pattern with the PWM values for count bits of pixels, starting with bit first_bit. Values
+// past the end of pixels hold the line low.
+static void fill_pattern(uint16_t *pattern, uint32_t count, const uint8_t *pixels, uint32_t numBytes, uint32_t first_bit) {
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t bit = first_bit + i;
+        if (bit / 8 >= numBytes) {
+            pattern[i] = 0 | (0x8000);
+        } else {
+            pattern[i] = (pixels[bit / 8] & (0x80 >> (bit % 8))) ? MAGIC_T1H : MAGIC_T0H;
+        }
+    }
+}
+
 static size_t pixels_pattern_heap_size = 0;
 // Called during reset_port() to free the pattern buffer
 void neopixel_write_reset(void) {
@@ -119,8 +133,9 @@ void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout,
     // The two additional bytes at the end are needed to reset the
     // sequence.
     //
-    // If there is not enough memory, we will fall back to cycle counter
-    // using DWT
+    // If there is not enough memory, the pattern is streamed through a
+    // buffer on the stack. Only if there is no free PWM device, we will fall
+    // back to cycle counter using DWT
 
 #define PATTERN_SIZE(numBytes) (numBytes * 8 * sizeof(uint16_t) + 2 * sizeof(uint16_t))
 // Allocate PWM space for up to STACK_PIXELS on the stack, to avoid malloc'ing.
@@ -143,10 +158,7 @@ void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout,
     if (pwm != NULL) {
         if (pattern_size <= sizeof(stack_pixels)) {
             pixels_pattern = (uint16_t *)stack_pixels;
-        } else {
-            uint8_t sd_en = 0;
-            (void)sd_softdevice_is_enabled(&sd_en);
-
+        } else if (gc_alloc_possible()) {
             if (pixels_pattern_heap_size < pattern_size) {
                 // Current heap buffer is too small.
                 if (MP_STATE_VM(pixels_pattern_heap)) {
@@ -155,19 +167,11 @@ void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout,
                     pixels_pattern_heap_size = 0;
                 }
 
-                // realloc routines fall back to a plain malloc if the incoming ptr is NULL.
-                if (sd_en) {
-                    // If the soft device is enabled then we must use PWM to
-                    // transmit. This takes a bunch of memory to do so raise an
-                    // exception if we can't.
-                    MP_STATE_VM(pixels_pattern_heap) =
-                        (uint16_t *)m_realloc(MP_STATE_VM(pixels_pattern_heap), pattern_size);
-                } else {
-                    // Might return NULL.
-                    MP_STATE_VM(pixels_pattern_heap) =
-                        // true means move if necessary.
-                        (uint16_t *)m_realloc_maybe(MP_STATE_VM(pixels_pattern_heap), pattern_size, true);
-                }
+                // Might return NULL, in which case the pattern is streamed through the stack
+                // buffer instead.
+                MP_STATE_VM(pixels_pattern_heap) =
+                    // true means move if necessary.
+                    (uint16_t *)m_realloc_maybe(MP_STATE_VM(pixels_pattern_heap), pattern_size, true);
                 if (MP_STATE_VM(pixels_pattern_heap)) {
                     pixels_pattern_heap_size = pattern_size;
                 }
@@ -259,6 +263,61 @@ void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout,
 
     } // End of DMA implementation
     // ---------------------------------------------------------------------
+    else if (pwm != NULL) {
+        // The whole pattern didn't fit in memory, so stream it through the two halves of the
+        // stack buffer. The PWM plays SEQ[0] and SEQ[1] in turn, and each half is refilled
+        // while the other one plays. Interrupts stay enabled, so an interrupt that runs longer
+        // than half a buffer of bits (about 0.36ms) corrupts the pixels sent after it.
+        uint32_t half = sizeof(stack_pixels) / sizeof(uint16_t) / 2;
+        uint16_t *halves[2] = { (uint16_t *)stack_pixels, (uint16_t *)stack_pixels + half };
+        // The extra two values end the sequence like in the DMA implementation.
+        uint32_t sequence_count = (numBytes * 8 + 2 + half - 1) / half;
+        // Each loop plays SEQ[0] and then SEQ[1].
+        uint32_t loop_count = (sequence_count + 1) / 2;
+
+        fill_pattern(halves[0], half, pixels, numBytes, 0);
+        fill_pattern(halves[1], half, pixels, numBytes, half);
+
+        nrf_pwm_configure(pwm, NRF_PWM_CLK_16MHz, NRF_PWM_MODE_UP, CTOPVAL);
+        nrf_pwm_loop_set(pwm, loop_count);
+        nrf_pwm_decoder_set(pwm, PWM_DECODER_LOAD_Common, PWM_DECODER_MODE_RefreshCount);
+        for (uint8_t seq = 0; seq < 2; seq++) {
+            nrf_pwm_seq_ptr_set(pwm, seq, halves[seq]);
+            nrf_pwm_seq_cnt_set(pwm, seq, half);
+            nrf_pwm_seq_refresh_set(pwm, seq, 0);
+            nrf_pwm_seq_end_delay_set(pwm, seq, 0);
+        }
+        nrf_pwm_pins_set(pwm, (uint32_t[]) {digitalinout->pin->number, 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL});
+        nrf_pwm_enable(pwm);
+
+        nrf_pwm_event_clear(pwm, NRF_PWM_EVENT_SEQEND0);
+        nrf_pwm_event_clear(pwm, NRF_PWM_EVENT_SEQEND1);
+        nrf_pwm_event_clear(pwm, NRF_PWM_EVENT_LOOPSDONE);
+        nrf_pwm_event_clear(pwm, NRF_PWM_EVENT_STOPPED);
+        nrf_pwm_task_trigger(pwm, NRF_PWM_TASK_SEQSTART0);
+
+        for (uint32_t seq = 2; seq < loop_count * 2; seq++) {
+            // Wait for the half to finish playing its previous sequence.
+            nrf_pwm_event_t seqend = (seq % 2) ? NRF_PWM_EVENT_SEQEND1 : NRF_PWM_EVENT_SEQEND0;
+            while (!nrf_pwm_event_check(pwm, seqend)) {
+            }
+            nrf_pwm_event_clear(pwm, seqend);
+            fill_pattern(halves[seq % 2], half, pixels, numBytes, seq * half);
+        }
+
+        while (!nrf_pwm_event_check(pwm, NRF_PWM_EVENT_LOOPSDONE)) {
+            RUN_BACKGROUND_TASKS;
+        }
+        nrf_pwm_task_trigger(pwm, NRF_PWM_TASK_STOP);
+        while (!nrf_pwm_event_check(pwm, NRF_PWM_EVENT_STOPPED)) {
+        }
+        nrf_pwm_event_clear(pwm, NRF_PWM_EVENT_LOOPSDONE);
+        nrf_pwm_event_clear(pwm, NRF_PWM_EVENT_STOPPED);
+
+        nrf_pwm_disable(pwm);
+        nrf_pwm_pins_set(pwm, (uint32_t[]) {0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL});
+    }
+    // ---------------------------------------------------------------------
     else {
         // Fall back to DWT
         // If you are using the Bluetooth SoftDevice we advise you to not disable
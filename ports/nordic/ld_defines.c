@@ -50,3 +50,5 @@
 
 /*APP_RAM_START_ADDR=*/ APP_RAM_START_ADDR;
 /*APP_RAM_SIZE=*/ APP_RAM_SIZE;
+
+/*CIRCUITPY_NATIVE_CODE_RAM_SIZE=*/ CIRCUITPY_NATIVE_CODE_RAM_SIZE;
@@ -60,6 +60,9 @@
 #endif
 #endif
 
+// port_background_task() runs board_background_task(), which boards may use.
+#define CIRCUITPY_PORT_BACKGROUND_TASK (1)
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // This also includes mpconfigboard.h.
@@ -36,6 +36,7 @@
 #include "py/runtime.h"
 
 #include "src/rp2_common/hardware_irq/include/hardware/irq.h"
+#include "src/rp2_common/hardware_timer/include/hardware/timer.h"
 
 #if CIRCUITPY_AUDIOCORE
 
@@ -134,10 +135,36 @@ STATIC size_t audio_dma_convert_samples(audio_dma_t *dma, uint8_t *input, uint32
     return output_length_used;
 }
 
-// buffer_idx is 0 or 1.
-STATIC void audio_dma_load_next_block(audio_dma_t *dma, size_t buffer_idx) {
-    size_t dma_channel = dma->channel[buffer_idx];
+STATIC void dma_callback_fun(void *arg);
 
+// Gives the oldest rendered buffer to dma_channel, which must not be busy. Runs in the DMA
+// interrupt or with interrupts disabled. Returns false if no rendered buffer is waiting.
+STATIC bool audio_dma_queue_buffer(audio_dma_t *dma, size_t dma_channel) {
+    if (dma->buffers_queued == dma->buffers_rendered) {
+        return false;
+    }
+    size_t buffer_idx = dma->buffers_queued % CIRCUITPY_AUDIO_DMA_BUFFERS;
+
+    dma_channel_set_read_addr(dma_channel, dma->buffer[buffer_idx], false /* trigger */);
+    dma_channel_set_trans_count(dma_channel, dma->buffer_transfer_count[buffer_idx], false /* trigger */);
+
+    if (dma->buffer_is_last[buffer_idx]) {
+        // Set channel trigger to ourselves so we don't keep going.
+        dma_channel_hw_t *c = &dma_hw->ch[dma_channel];
+        c->al1_ctrl =
+            (c->al1_ctrl & ~DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS) |
+            (dma_channel << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB);
+    }
+    dma->buffers_queued++;
+    return true;
+}
+
+// Renders the next block of the sample into a free buffer and hands it to any DMA channel that is
+// waiting for one. Returns false once there is nothing more to render.
+STATIC bool audio_dma_render_next_block(audio_dma_t *dma) {
+    size_t buffer_idx = dma->buffers_rendered % CIRCUITPY_AUDIO_DMA_BUFFERS;
+
+    uint32_t start_us = time_us_32();
     audioio_get_buffer_result_t get_buffer_result;
     uint8_t *sample_buffer;
     uint32_t sample_buffer_length;
@@ -146,39 +173,42 @@ STATIC void audio_dma_load_next_block(audio_dma_t *dma, size_t buffer_idx) {
 
     if (get_buffer_result == GET_BUFFER_ERROR) {
         audio_dma_stop(dma);
-        return;
+        return false;
     }
 
     // Convert the sample format resolution and signedness, as necessary.
     // The input sample buffer is what was read from a file, Mixer, or a raw sample buffer.
-    // The output buffer is one of the DMA buffers (passed in).
+    // The output buffer is one of the DMA buffers.
 
     size_t output_length_used = audio_dma_convert_samples(
         dma, sample_buffer, sample_buffer_length,
         dma->buffer[buffer_idx], dma->buffer_length[buffer_idx]);
 
-    dma_channel_set_read_addr(dma_channel, dma->buffer[buffer_idx], false /* trigger */);
-    dma_channel_set_trans_count(dma_channel, output_length_used / dma->output_size, false /* trigger */);
+    dma->buffer_transfer_count[buffer_idx] = output_length_used / dma->output_size;
+    dma->buffer_is_last[buffer_idx] = false;
+    audiosample_output_stats_record_buffer(&dma->stats, time_us_32() - start_us,
+        dma->buffer_transfer_count[buffer_idx], dma->sample_rate);
 
     if (get_buffer_result == GET_BUFFER_DONE) {
         if (dma->loop) {
             audiosample_reset_buffer(dma->sample, dma->single_channel_output, dma->audio_channel);
         } else {
-            // Set channel trigger to ourselves so we don't keep going.
-            dma_channel_hw_t *c = &dma_hw->ch[dma_channel];
-            c->al1_ctrl =
-                (c->al1_ctrl & ~DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS) |
-                (dma_channel << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB);
-
-            if (output_length_used == 0 &&
-                !dma_channel_is_busy(dma->channel[0]) &&
-                !dma_channel_is_busy(dma->channel[1])) {
-                // No data has been read, and both DMA channels have now finished, so it's safe to stop.
-                audio_dma_stop(dma);
-                dma->playing_in_progress = false;
-            }
+            dma->buffer_is_last[buffer_idx] = true;
+            dma->render_done = true;
         }
     }
+
+    common_hal_mcu_disable_interrupts();
+    dma->buffers_rendered++;
+    for (size_t i = 0; i < 2; i++) {
+        uint32_t mask = 1 << dma->channel[i];
+        if ((dma->channels_to_load_mask & mask) && audio_dma_queue_buffer(dma, dma->channel[i])) {
+            dma->channels_to_load_mask &= ~mask;
+        }
+    }
+    common_hal_mcu_enable_interrupts();
+
+    return !dma->render_done;
 }
 
 // Playback should be shutdown before calling this.
@@ -212,6 +242,9 @@ audio_dma_result audio_dma_setup_playback(
 
     dma->sample = sample;
     dma->loop = loop;
+    dma->render_done = false;
+    dma->buffers_rendered = 0;
+    dma->buffers_queued = 0;
     dma->single_channel_output = single_channel_output;
     dma->audio_channel = audio_channel;
     dma->signed_to_unsigned = false;
@@ -222,6 +255,9 @@ audio_dma_result audio_dma_setup_playback(
     dma->sample_resolution = audiosample_bits_per_sample(sample);
     dma->output_register_address = output_register_address;
     dma->swap_channel = swap_channel;
+    dma->sample_rate = audiosample_sample_rate(sample);
+    dma->interrupt_pending = false;
+    audiosample_output_stats_reset(&dma->stats);
 
     audiosample_reset_buffer(sample, single_channel_output, audio_channel);
 
@@ -250,10 +286,12 @@ audio_dma_result audio_dma_setup_playback(
     }
 
     if (!single_buffer) {
-        dma->buffer[1] = (uint8_t *)m_realloc(dma->buffer[1], max_buffer_length);
-        dma->buffer_length[1] = max_buffer_length;
-        if (dma->buffer[1] == NULL) {
-            return AUDIO_DMA_MEMORY_ERROR;
+        for (size_t i = 1; i < CIRCUITPY_AUDIO_DMA_BUFFERS; i++) {
+            dma->buffer[i] = (uint8_t *)m_realloc(dma->buffer[i], max_buffer_length);
+            dma->buffer_length[i] = max_buffer_length;
+            if (dma->buffer[i] == NULL) {
+                return AUDIO_DMA_MEMORY_ERROR;
+            }
         }
     }
 
@@ -295,10 +333,14 @@ audio_dma_result audio_dma_setup_playback(
     MP_STATE_PORT(playing_audio)[dma->channel[0]] = dma;
     MP_STATE_PORT(playing_audio)[dma->channel[1]] = dma;
 
-    // Load the first two blocks up front.
-    audio_dma_load_next_block(dma, 0);
+    // Load the first two blocks up front, one into each channel. The rest are rendered ahead by
+    // the background task once playback is running.
+    dma->channels_to_load_mask = 1 << dma->channel[0];
     if (!single_buffer) {
-        audio_dma_load_next_block(dma, 1);
+        dma->channels_to_load_mask |= 1 << dma->channel[1];
+    }
+    if (audio_dma_render_next_block(dma) && !single_buffer) {
+        audio_dma_render_next_block(dma);
     }
 
     // Special case the DMA for a single buffer. It's commonly used for a single wave length of sound
@@ -327,6 +369,9 @@ audio_dma_result audio_dma_setup_playback(
 
     dma->playing_in_progress = true;
     dma_channel_start(dma->channel[0]);
+    if (!single_buffer) {
+        background_callback_add_with_priority(&dma->callback, dma_callback_fun, (void *)dma, BACKGROUND_CALLBACK_REALTIME);
+    }
 
     return AUDIO_DMA_OK;
 }
@@ -426,19 +471,19 @@ void audio_dma_unpause_mask(uint32_t channel_mask) {
 }
 
 void audio_dma_init(audio_dma_t *dma) {
-    dma->buffer[0] = NULL;
-    dma->buffer[1] = NULL;
+    for (size_t i = 0; i < CIRCUITPY_AUDIO_DMA_BUFFERS; i++) {
+        dma->buffer[i] = NULL;
+    }
 
     dma->channel[0] = NUM_DMA_CHANNELS;
     dma->channel[1] = NUM_DMA_CHANNELS;
 }
 
 void audio_dma_deinit(audio_dma_t *dma) {
-    m_free(dma->buffer[0]);
-    dma->buffer[0] = NULL;
-
-    m_free(dma->buffer[1]);
-    dma->buffer[1] = NULL;
+    for (size_t i = 0; i < CIRCUITPY_AUDIO_DMA_BUFFERS; i++) {
+        m_free(dma->buffer[i]);
+        dma->buffer[i] = NULL;
+    }
 }
 
 bool audio_dma_get_playing(audio_dma_t *dma) {
@@ -458,24 +503,27 @@ STATIC void dma_callback_fun(void *arg) {
         return;
     }
 
-    common_hal_mcu_disable_interrupts();
-    uint32_t channels_to_load_mask = dma->channels_to_load_mask;
-    dma->channels_to_load_mask = 0;
-    common_hal_mcu_enable_interrupts();
+    if (dma->interrupt_pending) {
+        audiosample_output_stats_record_fill_latency(&dma->stats, time_us_32() - dma->interrupt_us);
+        dma->interrupt_pending = false;
+    }
 
-    // Load the blocks for the requested channels.
-    uint32_t channel = 0;
-    while (channels_to_load_mask) {
-        if (channels_to_load_mask & 1) {
-            if (dma->channel[0] == channel) {
-                audio_dma_load_next_block(dma, 0);
-            }
-            if (dma->channel[1] == channel) {
-                audio_dma_load_next_block(dma, 1);
-            }
+    // Render for any channel that ran dry, then ahead until every buffer not owned by a DMA
+    // channel is full. With only two buffers this reduces to loading each channel as it finishes.
+    while (dma->channel[0] < NUM_DMA_CHANNELS && !dma->render_done &&
+           (dma->channels_to_load_mask != 0 ||
+            (uint8_t)(dma->buffers_rendered - dma->buffers_queued) < CIRCUITPY_AUDIO_DMA_BUFFERS - 2)) {
+        if (!audio_dma_render_next_block(dma)) {
+            break;
         }
-        channels_to_load_mask >>= 1;
-        channel++;
+    }
+
+    if (dma->channel[0] < NUM_DMA_CHANNELS && dma->render_done &&
+        dma->buffers_queued == dma->buffers_rendered &&
+        !dma_channel_is_busy(dma->channel[0]) &&
+        !dma_channel_is_busy(dma->channel[1])) {
+        // Everything has been played, and both DMA channels have now finished, so it's safe to stop.
+        audio_dma_stop(dma);
     }
 }
 
@@ -492,9 +540,19 @@ void isr_dma_0(void) {
         dma_hw->ints0 = mask;
         if (MP_STATE_PORT(playing_audio)[i] != NULL) {
             audio_dma_t *dma = MP_STATE_PORT(playing_audio)[i];
-            // Record all channels whose DMA has completed; they need loading.
-            dma->channels_to_load_mask |= mask;
-            background_callback_add(&dma->callback, dma_callback_fun, (void *)dma);
+            // Restart the channel with a block rendered ahead of time. If there isn't one yet,
+            // record that the channel needs loading once it has been rendered.
+            if (!audio_dma_queue_buffer(dma, i)) {
+                dma->channels_to_load_mask |= mask;
+                if (!dma->render_done) {
+                    dma->stats.underruns++;
+                }
+            }
+            if (!dma->interrupt_pending) {
+                dma->interrupt_us = time_us_32();
+                dma->interrupt_pending = true;
+            }
+            background_callback_add_with_priority(&dma->callback, dma_callback_fun, (void *)dma, BACKGROUND_CALLBACK_REALTIME);
         }
         if (MP_STATE_PORT(background_pio)[i] != NULL) {
             rp2pio_statemachine_obj_t *pio = MP_STATE_PORT(background_pio)[i];
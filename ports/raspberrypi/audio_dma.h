@@ -28,15 +28,35 @@
 #define MICROPY_INCLUDED_RASPBERRYPI_AUDIO_DMA_OUT_H
 
 #include "py/obj.h"
+#include "shared-module/audiocore/__init__.h"
 #include "supervisor/background_callback.h"
 
 #include "src/rp2_common/hardware_dma/include/hardware/dma.h"
 
+// Number of sample buffers used while playing. Two are always owned by the DMA channels. The rest
+// hold blocks rendered ahead of time, so the DMA interrupt can restart a channel right away and
+// playback keeps going while the VM is slow to run background tasks. Two gives plain ping-pong buffering.
+#ifndef CIRCUITPY_AUDIO_DMA_BUFFERS
+#define CIRCUITPY_AUDIO_DMA_BUFFERS (3)
+#endif
+
 typedef struct {
     mp_obj_t sample;
-    uint8_t *buffer[2];
-    size_t buffer_length[2];
+    uint8_t *buffer[CIRCUITPY_AUDIO_DMA_BUFFERS];
+    size_t buffer_length[CIRCUITPY_AUDIO_DMA_BUFFERS];
+    uint32_t buffer_transfer_count[CIRCUITPY_AUDIO_DMA_BUFFERS];
+    bool buffer_is_last[CIRCUITPY_AUDIO_DMA_BUFFERS];
+    // Free running buffer counts. Only the background task advances buffers_rendered, and only
+    // the DMA interrupt (or code with interrupts disabled) advances buffers_queued.
+    volatile uint8_t buffers_rendered;
+    volatile uint8_t buffers_queued;
+    // DMA channels that finished while no rendered buffer was waiting.
     uint32_t channels_to_load_mask;
+    audiosample_output_stats_t stats;
+    uint32_t sample_rate;
+    // When the oldest DMA interrupt not yet followed by the background task happened.
+    uint32_t interrupt_us;
+    volatile bool interrupt_pending;
     uint32_t output_register_address;
     background_callback_t callback;
     uint8_t channel[2];
@@ -46,6 +66,7 @@ typedef struct {
     uint8_t output_resolution; // in bits
     uint8_t sample_resolution; // in bits
     bool loop;
+    bool render_done;
     bool single_channel_output;
     bool signed_to_unsigned;
     bool unsigned_to_signed;
@@ -485,10 +485,10 @@ MP_DEFINE_CONST_FUN_OBJ_KW(rp2pio_statemachine_write_obj, 2, rp2pio_statemachine
 //|         """
 //|         ...
 
-STATIC void fill_buf_info(sm_buf_info *info, mp_obj_t obj, size_t *stride_in_bytes) {
+STATIC void fill_buf_info(sm_buf_info *info, mp_obj_t obj, size_t *stride_in_bytes, mp_uint_t direction) {
     if (obj != mp_const_none) {
         info->obj = obj;
-        mp_get_buffer_raise(obj, &info->info, MP_BUFFER_READ);
+        mp_get_buffer_raise(obj, &info->info, direction);
         size_t stride = mp_binary_get_size('@', info->info.typecode, NULL);
         if (stride > 4) {
             mp_raise_ValueError(MP_ERROR_TEXT("Buffer elements must be 4 bytes long or less"));
@@ -517,8 +517,8 @@ STATIC mp_obj_t rp2pio_statemachine_background_write(size_t n_args, const mp_obj
     sm_buf_info once_info;
     sm_buf_info loop_info;
     size_t stride_in_bytes = 0;
-    fill_buf_info(&once_info, args[ARG_once].u_obj, &stride_in_bytes);
-    fill_buf_info(&loop_info, args[ARG_loop].u_obj, &stride_in_bytes);
+    fill_buf_info(&once_info, args[ARG_once].u_obj, &stride_in_bytes, MP_BUFFER_READ);
+    fill_buf_info(&loop_info, args[ARG_loop].u_obj, &stride_in_bytes, MP_BUFFER_READ);
     if (!stride_in_bytes) {
         return mp_const_none;
     }
@@ -585,6 +585,159 @@ const mp_obj_property_t rp2pio_statemachine_pending_obj = {
               MP_ROM_NONE},
 };
 
+//|     completed_writes: int
+//|     """Returns the number of buffers completely written since `background_write` started.
+//|
+//|     Reading this property does not allocate until the count passes 2**30,
+//|     so it can be polled in a tight loop."""
+STATIC mp_obj_t rp2pio_statemachine_obj_get_completed_writes(mp_obj_t self_in) {
+    rp2pio_statemachine_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_rp2pio_statemachine_get_completed_writes(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(rp2pio_statemachine_get_completed_writes_obj, rp2pio_statemachine_obj_get_completed_writes);
+
+MP_PROPERTY_GETTER(rp2pio_statemachine_completed_writes_obj,
+    (mp_obj_t)&rp2pio_statemachine_get_completed_writes_obj);
+
+//|     def background_read(
+//|         self,
+//|         once: Optional[WriteableBuffer] = None,
+//|         *,
+//|         loop: Optional[WriteableBuffer] = None,
+//|         loop2: Optional[WriteableBuffer] = None,
+//|         swap: bool = False,
+//|     ) -> None:
+//|         """Read data from the RX fifo in the background, with optional looping.
+//|
+//|         First, if any previous ``once``, ``loop`` or ``loop2`` buffer has not been started, this function blocks until they have been started.
+//|         Then the buffers are queued and the function returns.
+//|         The ``once`` buffer (if specified) will be filled just once.
+//|         Then the ``loop`` buffer (if specified) is filled repeatedly. If ``loop2`` is also
+//|         specified, ``loop`` and ``loop2`` are filled alternately, so one can be processed
+//|         while the other is being filled and no samples are lost between them.
+//|
+//|         Reads from the FIFO will match the buffer's element size, in the same way as `readinto`.
+//|         All of the buffers must have the same element size.
+//|
+//|         `last_read` returns the buffer filled most recently, and `completed_reads` counts
+//|         the buffers filled so far.
+//|
+//|         Having none of ``once``, ``loop`` or ``loop2`` terminates an existing
+//|         background looping read after exactly a whole buffer. This is in contrast to
+//|         `stop_background_read`, which interrupts an ongoing DMA operation.
+//|
+//|         :param ~Optional[circuitpython_typing.WriteableBuffer] once: Data to be read once
+//|         :param ~Optional[circuitpython_typing.WriteableBuffer] loop: Data to be read repeatedly
+//|         :param ~Optional[circuitpython_typing.WriteableBuffer] loop2: Data to be read repeatedly, alternating with ``loop``
+//|         :param bool swap: For 2- and 4-byte elements, swap (reverse) the byte order
+//|         """
+//|         ...
+
+STATIC mp_obj_t rp2pio_statemachine_background_read(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_once, ARG_loop, ARG_loop2, ARG_swap };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_once,     MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_loop,     MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_loop2,    MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_swap,   MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+    rp2pio_statemachine_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    sm_buf_info once_info;
+    sm_buf_info loop_info;
+    sm_buf_info loop2_info;
+    size_t stride_in_bytes = 0;
+    fill_buf_info(&once_info, args[ARG_once].u_obj, &stride_in_bytes, MP_BUFFER_WRITE);
+    fill_buf_info(&loop_info, args[ARG_loop].u_obj, &stride_in_bytes, MP_BUFFER_WRITE);
+    fill_buf_info(&loop2_info, args[ARG_loop2].u_obj, &stride_in_bytes, MP_BUFFER_WRITE);
+    if (!stride_in_bytes) {
+        return mp_const_none;
+    }
+
+    bool ok = common_hal_rp2pio_statemachine_background_read(self, &once_info, &loop_info, &loop2_info, stride_in_bytes, args[ARG_swap].u_bool);
+
+    if (mp_hal_is_interrupted()) {
+        return mp_const_none;
+    }
+    if (!ok) {
+        mp_raise_OSError(MP_EIO);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(rp2pio_statemachine_background_read_obj, 1, rp2pio_statemachine_background_read);
+
+//|     def stop_background_read(self) -> None:
+//|         """Immediately stop a background read, if one is in progress.  Any
+//|         DMA in progress is halted, but items already in the RX FIFO are not
+//|         affected."""
+STATIC mp_obj_t rp2pio_statemachine_obj_stop_background_read(mp_obj_t self_in) {
+    rp2pio_statemachine_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    bool ok = common_hal_rp2pio_statemachine_stop_background_read(self);
+    if (mp_hal_is_interrupted()) {
+        return mp_const_none;
+    }
+    if (!ok) {
+        mp_raise_OSError(MP_EIO);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(rp2pio_statemachine_stop_background_read_obj, rp2pio_statemachine_obj_stop_background_read);
+
+//|     reading: bool
+//|     """Returns True if a background read is in progress"""
+STATIC mp_obj_t rp2pio_statemachine_obj_get_reading(mp_obj_t self_in) {
+    rp2pio_statemachine_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_rp2pio_statemachine_get_reading(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(rp2pio_statemachine_get_reading_obj, rp2pio_statemachine_obj_get_reading);
+
+MP_PROPERTY_GETTER(rp2pio_statemachine_reading_obj,
+    (mp_obj_t)&rp2pio_statemachine_get_reading_obj);
+
+//|     pending_read: int
+//|     """Returns the number of pending buffers for background reading.
+//|
+//|     If the number is 0, then a `StateMachine.background_read` call will not block."""
+STATIC mp_obj_t rp2pio_statemachine_obj_get_pending_read(mp_obj_t self_in) {
+    rp2pio_statemachine_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int(common_hal_rp2pio_statemachine_get_pending_read(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(rp2pio_statemachine_get_pending_read_obj, rp2pio_statemachine_obj_get_pending_read);
+
+MP_PROPERTY_GETTER(rp2pio_statemachine_pending_read_obj,
+    (mp_obj_t)&rp2pio_statemachine_get_pending_read_obj);
+
+//|     completed_reads: int
+//|     """Returns the number of buffers completely filled since `background_read` started.
+//|
+//|     Reading this property does not allocate until the count passes 2**30,
+//|     so it can be polled in a tight loop."""
+STATIC mp_obj_t rp2pio_statemachine_obj_get_completed_reads(mp_obj_t self_in) {
+    rp2pio_statemachine_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_rp2pio_statemachine_get_completed_reads(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(rp2pio_statemachine_get_completed_reads_obj, rp2pio_statemachine_obj_get_completed_reads);
+
+MP_PROPERTY_GETTER(rp2pio_statemachine_completed_reads_obj,
+    (mp_obj_t)&rp2pio_statemachine_get_completed_reads_obj);
+
+//|     last_read: WriteableBuffer
+//|     """Returns the buffer most recently filled by `background_read`.
+//|
+//|     This property is self-clearing: once read, it returns an empty `bytes` until
+//|     another buffer has been filled."""
+STATIC mp_obj_t rp2pio_statemachine_obj_get_last_read(mp_obj_t self_in) {
+    rp2pio_statemachine_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_rp2pio_statemachine_get_last_read(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(rp2pio_statemachine_get_last_read_obj, rp2pio_statemachine_obj_get_last_read);
+
+MP_PROPERTY_GETTER(rp2pio_statemachine_last_read_obj,
+    (mp_obj_t)&rp2pio_statemachine_get_last_read_obj);
+
 //|     def readinto(
 //|         self,
 //|         buffer: WriteableBuffer,
@@ -851,6 +1004,13 @@ STATIC const mp_rom_map_elem_t rp2pio_statemachine_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_stop_background_write), MP_ROM_PTR(&rp2pio_statemachine_stop_background_write_obj) },
     { MP_ROM_QSTR(MP_QSTR_writing), MP_ROM_PTR(&rp2pio_statemachine_writing_obj) },
     { MP_ROM_QSTR(MP_QSTR_pending), MP_ROM_PTR(&rp2pio_statemachine_pending_obj) },
+    { MP_ROM_QSTR(MP_QSTR_completed_writes), MP_ROM_PTR(&rp2pio_statemachine_completed_writes_obj) },
+    { MP_ROM_QSTR(MP_QSTR_background_read), MP_ROM_PTR(&rp2pio_statemachine_background_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop_background_read), MP_ROM_PTR(&rp2pio_statemachine_stop_background_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_reading), MP_ROM_PTR(&rp2pio_statemachine_reading_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pending_read), MP_ROM_PTR(&rp2pio_statemachine_pending_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_completed_reads), MP_ROM_PTR(&rp2pio_statemachine_completed_reads_obj) },
+    { MP_ROM_QSTR(MP_QSTR_last_read), MP_ROM_PTR(&rp2pio_statemachine_last_read_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_frequency), MP_ROM_PTR(&rp2pio_statemachine_frequency_obj) },
     { MP_ROM_QSTR(MP_QSTR_rxstall), MP_ROM_PTR(&rp2pio_statemachine_rxstall_obj) },
@@ -45,6 +45,21 @@
 #define ADC_CLOCK_INPUT 48000000
 #define ADC_MAX_CLOCK_DIV (1 << (ADC_DIV_INT_MSB - ADC_DIV_INT_LSB + 1))
 
+#define NO_DMA_CHANNEL (-1)
+
+// Set up the ADC FIFO and the data DMA channel's transfer size for the given sample size.
+STATIC void _setup_fifo(analogbufio_bufferedin_obj_t *self, uint8_t bytes_per_sample) {
+    adc_fifo_setup(
+        true,                 // Write each completed conversion to the sample FIFO
+        true,                 // Enable DMA data request (DREQ)
+        1,                    // DREQ (and IRQ) asserted when at least 1 sample present
+        bytes_per_sample == 2, // See the ERR bit
+        bytes_per_sample == 1 // Shift each sample to 8 bits when pushing to FIFO
+        );
+
+    channel_config_set_transfer_data_size(&(self->cfg), bytes_per_sample == 2 ? DMA_SIZE_16 : DMA_SIZE_8);
+}
+
 void common_hal_analogbufio_bufferedin_construct(analogbufio_bufferedin_obj_t *self, const mcu_pin_obj_t *pin, uint32_t sample_rate) {
     // Make sure pin number is in range for ADC
     if (pin->number < ADC_FIRST_PIN_NUMBER || pin->number >= (ADC_FIRST_PIN_NUMBER + ADC_PIN_COUNT)) {
@@ -94,6 +109,10 @@ void common_hal_analogbufio_bufferedin_construct(analogbufio_bufferedin_obj_t *s
     // Pace transfers based on availability of ADC samples
     channel_config_set_dreq(&(self->cfg), DREQ_ADC);
 
+    self->ring_obj = mp_const_none;
+    self->ring_buffer = NULL;
+    self->ctrl_dma_chan = NO_DMA_CHANNEL;
+
     // clear any previous activity
     adc_fifo_drain();
     adc_run(false);
@@ -108,6 +127,8 @@ void common_hal_analogbufio_bufferedin_deinit(analogbufio_bufferedin_obj_t *self
         return;
     }
 
+    common_hal_analogbufio_bufferedin_stop(self);
+
     // Release ADC Pin
     reset_pin_number(self->pin->number);
     self->pin = NULL;
@@ -125,25 +146,10 @@ uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t
     // samples at the first sample with the error bit set.
     // Number of transfers is always the number of samples which is the array
     // byte length divided by the bytes_per_sample.
-    uint dma_size = DMA_SIZE_8;
-    bool show_error_bit = false;
-    if (bytes_per_sample == 2) {
-        dma_size = DMA_SIZE_16;
-        show_error_bit = true;
-    }
-
-    adc_fifo_setup(
-        true,                 // Write each completed conversion to the sample FIFO
-        true,                 // Enable DMA data request (DREQ)
-        1,                    // DREQ (and IRQ) asserted when at least 1 sample present
-        show_error_bit,       // See the ERR bit
-        bytes_per_sample == 1 // Shift each sample to 8 bits when pushing to FIFO
-        );
+    _setup_fifo(self, bytes_per_sample);
 
     uint32_t sample_count = len / bytes_per_sample;
 
-    channel_config_set_transfer_data_size(&(self->cfg), dma_size);
-
     dma_channel_configure(self->dma_chan, &(self->cfg),
         buffer,   // dst
         &adc_hw->fifo,  // src
@@ -172,7 +178,7 @@ uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t
     adc_fifo_drain();
 
     size_t captured_count = sample_count - remaining_transfers;
-    if (dma_size == DMA_SIZE_16) {
+    if (bytes_per_sample == 2) {
         uint16_t *buf16 = (uint16_t *)buffer;
         for (size_t i = 0; i < captured_count; i++) {
             uint16_t value = buf16[i];
@@ -187,3 +193,119 @@ uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t
     }
     return captured_count;
 }
+
+bool common_hal_analogbufio_bufferedin_get_running(analogbufio_bufferedin_obj_t *self) {
+    return self->ring_buffer != NULL;
+}
+
+void common_hal_analogbufio_bufferedin_start(analogbufio_bufferedin_obj_t *self, mp_obj_t buffer_obj, uint8_t *buffer, uint32_t len, uint8_t bytes_per_sample) {
+    int ctrl_dma_chan = dma_claim_unused_channel(false);
+    if (ctrl_dma_chan < 0) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("No DMA channel found"));
+    }
+    self->ctrl_dma_chan = ctrl_dma_chan;
+    self->ring_obj = buffer_obj;
+    self->ring_buffer = buffer;
+    self->ring_start = buffer;
+    self->ring_samples = len / bytes_per_sample;
+    self->ring_bytes_per_sample = bytes_per_sample;
+
+    _setup_fifo(self, bytes_per_sample);
+    channel_config_set_chain_to(&(self->cfg), ctrl_dma_chan);
+
+    // The control channel rewrites the data channel's write address through
+    // the register alias that also triggers it. The ADC FIFO holds the
+    // samples taken in the few cycles this takes, so none are lost.
+    dma_channel_config ctrl_cfg = dma_channel_get_default_config(ctrl_dma_chan);
+    channel_config_set_transfer_data_size(&ctrl_cfg, DMA_SIZE_32);
+    channel_config_set_read_increment(&ctrl_cfg, false);
+    channel_config_set_write_increment(&ctrl_cfg, false);
+    dma_channel_configure(ctrl_dma_chan, &ctrl_cfg,
+        &dma_hw->ch[self->dma_chan].al2_write_addr_trig, // dst
+        &self->ring_start, // src
+        1,                 // transfer count
+        false);
+
+    dma_channel_configure(self->dma_chan, &(self->cfg),
+        buffer,         // dst
+        &adc_hw->fifo,  // src
+        self->ring_samples, // transfer count
+        true            // start immediately
+        );
+
+    adc_run(true);
+}
+
+void common_hal_analogbufio_bufferedin_stop(analogbufio_bufferedin_obj_t *self) {
+    if (self->ring_buffer == NULL) {
+        return;
+    }
+    adc_run(false);
+
+    // Chaining a channel to itself disables chaining, so the control channel
+    // can't restart the data channel while both are being aborted.
+    hw_write_masked(&dma_hw->ch[self->dma_chan].al1_ctrl,
+        self->dma_chan << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB, DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS);
+    dma_channel_abort(self->ctrl_dma_chan);
+    dma_channel_abort(self->dma_chan);
+    dma_channel_unclaim(self->ctrl_dma_chan);
+    channel_config_set_chain_to(&(self->cfg), self->dma_chan);
+    adc_fifo_drain();
+
+    self->ctrl_dma_chan = NO_DMA_CHANNEL;
+    self->ring_obj = mp_const_none;
+    self->ring_buffer = NULL;
+}
+
+// Index of the next sample the DMA will write.
+STATIC uint32_t _ring_position(analogbufio_bufferedin_obj_t *self) {
+    uint32_t remaining = dma_channel_hw_addr(self->dma_chan)->transfer_count;
+    // While the control channel restarts the data channel, the count is 0
+    // for a moment; that is the start of the ring.
+    if (remaining == 0 || remaining > self->ring_samples) {
+        return 0;
+    }
+    return self->ring_samples - remaining;
+}
+
+bool common_hal_analogbufio_bufferedin_wait(analogbufio_bufferedin_obj_t *self, bool half, uint32_t *completed_start) {
+    uint32_t half_samples = self->ring_samples / 2;
+    uint32_t last = _ring_position(self);
+    while (!mp_hal_is_interrupted()) {
+        RUN_BACKGROUND_TASKS;
+        uint32_t position = _ring_position(self);
+        if (position < last) {
+            // Wrapped, so the whole buffer (and its second half) is complete.
+            *completed_start = half ? half_samples : 0;
+            return true;
+        }
+        if (half && last < half_samples && position >= half_samples) {
+            *completed_start = 0;
+            return true;
+        }
+        last = position;
+    }
+    return false;
+}
+
+uint32_t common_hal_analogbufio_bufferedin_readinto_latest(analogbufio_bufferedin_obj_t *self, uint8_t *buffer, uint32_t len, uint8_t bytes_per_sample) {
+    if (bytes_per_sample != self->ring_bytes_per_sample) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Mismatched data size"));
+    }
+    uint32_t count = MIN(len / bytes_per_sample, self->ring_samples);
+    uint32_t start = (_ring_position(self) + self->ring_samples - count) % self->ring_samples;
+    if (self->ring_bytes_per_sample == 1) {
+        for (uint32_t i = 0; i < count; i++) {
+            buffer[i] = self->ring_buffer[(start + i) % self->ring_samples];
+        }
+    } else {
+        const uint16_t *ring16 = (const uint16_t *)self->ring_buffer;
+        uint16_t *buf16 = (uint16_t *)buffer;
+        for (uint32_t i = 0; i < count; i++) {
+            // Drop the error bit and scale the values to the standard 16 bit range.
+            uint16_t value = ring16[(start + i) % self->ring_samples] & ~ADC_FIFO_ERR_BITS;
+            buf16[i] = (value << 4) | (value >> 8);
+        }
+    }
+    return count;
+}
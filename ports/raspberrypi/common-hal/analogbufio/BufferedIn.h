@@ -44,6 +44,14 @@ typedef struct {
     uint8_t chan;
     uint dma_chan;
     dma_channel_config cfg;
+    // Continuous capture: dma_chan fills ring_buffer and chains to
+    // ctrl_dma_chan, which writes ring_start back to dma_chan to restart it.
+    mp_obj_t ring_obj;
+    uint8_t *ring_buffer;
+    volatile uint8_t *ring_start;
+    uint32_t ring_samples;
+    uint8_t ring_bytes_per_sample;
+    int ctrl_dma_chan;
 } analogbufio_bufferedin_obj_t;
 
 #endif // MICROPY_INCLUDED_RASPBERRYPI_COMMON_HAL_ANALOGBUFIO_BUFFEREDIN_H
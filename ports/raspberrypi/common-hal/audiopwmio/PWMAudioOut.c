@@ -275,3 +275,7 @@ void common_hal_audiopwmio_pwmaudioout_resume(audiopwmio_pwmaudioout_obj_t *self
 bool common_hal_audiopwmio_pwmaudioout_get_paused(audiopwmio_pwmaudioout_obj_t *self) {
     return audio_dma_get_paused(&self->dma);
 }
+
+mp_obj_t common_hal_audiopwmio_pwmaudioout_get_stats(audiopwmio_pwmaudioout_obj_t *self) {
+    return audiosample_output_stats_get(&self->dma.stats);
+}
@@ -28,6 +28,7 @@
 #include "py/mphal.h"
 #include "shared-bindings/busio/I2C.h"
 #include "py/runtime.h"
+#include "supervisor/shared/cpu_governor.h"
 
 #include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/microcontroller/Pin.h"
@@ -58,6 +59,8 @@ void reset_i2c(void) {
 void common_hal_busio_i2c_construct(busio_i2c_obj_t *self,
     const mcu_pin_obj_t *scl, const mcu_pin_obj_t *sda, uint32_t frequency, uint32_t timeout) {
     self->peripheral = NULL;
+    // Set up at the frequency this will run at.
+    supervisor_cpu_governor_restore_frequency();
     // I2C pins have a regular pattern. SCL is always odd and SDA is even. They match up in pairs
     // so we can divide by two to get the instance. This pattern repeats.
     size_t scl_instance = (scl->number / 2) % 2;
@@ -31,6 +31,7 @@
 #include "py/runtime.h"
 
 #include "supervisor/board.h"
+#include "supervisor/shared/cpu_governor.h"
 #include "common-hal/microcontroller/Pin.h"
 #include "shared-bindings/microcontroller/Pin.h"
 
@@ -56,6 +57,8 @@ void common_hal_busio_spi_construct(busio_spi_obj_t *self,
     const mcu_pin_obj_t *clock, const mcu_pin_obj_t *mosi,
     const mcu_pin_obj_t *miso, bool half_duplex) {
     size_t instance_index = NO_INSTANCE;
+    // Set up at the frequency this will run at.
+    supervisor_cpu_governor_restore_frequency();
 
     if (half_duplex) {
         mp_raise_NotImplementedError_varg(MP_ERROR_TEXT("%q"), MP_QSTR_half_duplex);
@@ -29,6 +29,7 @@
 #include "py/stream.h"
 #include "py/mperrno.h"
 #include "py/runtime.h"
+#include "supervisor/shared/cpu_governor.h"
 #include "supervisor/shared/tick.h"
 #include "shared/runtime/interrupt_char.h"
 #include "common-hal/microcontroller/Pin.h"
@@ -113,6 +114,8 @@ void common_hal_busio_uart_construct(busio_uart_obj_t *self,
     if (uart_status[uart_id] != STATUS_FREE) {
         mp_raise_ValueError(MP_ERROR_TEXT("UART peripheral in use"));
     }
+    // Set up at the frequency this will run at.
+    supervisor_cpu_governor_restore_frequency();
     // These may raise exceptions if pins are already in use.
     self->tx_pin = pin_init(uart_id, tx, 0);
     self->rx_pin = pin_init(uart_id, rx, 1);
@@ -0,0 +1,157 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/floppyio/__init__.h"
+#include "shared-module/floppyio/__init__.h"
+#include "common-hal/floppyio/__init__.h"
+
+#include <string.h>
+
+#include "py/mphal.h"
+#include "py/runtime.h"
+#include "bindings/rp2pio/StateMachine.h"
+#include "common-hal/rp2pio/StateMachine.h"
+#include "shared-bindings/digitalio/DigitalInOut.h"
+#include "shared/runtime/interrupt_char.h"
+
+#include "src/rp2_common/hardware_dma/include/hardware/dma.h"
+
+// Each count takes two cycles.
+#define FLUX_FREQUENCY (FLOPPYIO_SAMPLERATE * 2)
+// Counts spent between falling edges outside of the loops below.
+#define FLUX_OVERHEAD 2
+
+// Pushes the number of counts from each falling edge of the data pin to the
+// next in the low byte. x counts down from 255, which is kept in osr, so long
+// intervals stop at 255 instead of wrapping around.
+static const uint16_t flux_program[] = {
+    0xa0eb, //  0: mov    osr, ~null
+    0x6078, //  1: out    null, 24
+    0x20a0, //  2: wait   1 pin, 0
+    0x2020, //  3: wait   0 pin, 0
+    //     .wrap_target
+    0xa027, //  4: mov    x, osr
+    0x00c8, //  5: jmp    pin, 8
+    0x0045, //  6: jmp    x--, 5
+    0x000d, //  7: jmp    13
+    0x004a, //  8: jmp    x--, 10
+    0x000d, //  9: jmp    13
+    0x00c8, // 10: jmp    pin, 8
+    0xa0c9, // 11: mov    isr, ~x
+    0x8000, // 12: push   noblock
+    //     .wrap
+    0x20a0, // 13: wait   1 pin, 0
+    0x2020, // 14: wait   0 pin, 0
+    0xa0c7, // 15: mov    isr, osr
+    0x8000, // 16: push   noblock
+    0x0004, // 17: jmp    4
+};
+#define FLUX_WRAP_TARGET 4
+#define FLUX_WRAP 12
+
+// Times the flux with a state machine and streams it into buf by DMA, so
+// interrupts stay on and the sample rate doesn't depend on the code running
+// from cache. Falls back to polling when no state machine or DMA channel is free.
+int common_hal_floppyio_flux_readinto(void *buf, size_t len, digitalio_digitalinout_obj_t *data, digitalio_digitalinout_obj_t *index) {
+    rp2pio_statemachine_obj_t state_machine = { 0 };
+    // The state machine only reads the data pin, so the DigitalInOut keeps it.
+    if (!rp2pio_statemachine_construct(&state_machine,
+        flux_program, MP_ARRAY_SIZE(flux_program),
+        FLUX_FREQUENCY,
+        NULL, 0, // init program
+        NULL, 0, // out
+        data->pin, 1, // in
+        0, 0, // in pulls
+        NULL, 0, // set
+        NULL, 0, // sideset
+        0, 0, // initial pin state
+        data->pin, // jump pin
+        0, false, true, // pins we use, TX, RX
+        false, 32, true, // TX, shifts right so that 255 is left in osr
+        false, // Wait for txstall
+        false, 32, true, // RX, pushed by the program
+        false, // claim pins
+        false, // Not user-interruptible.
+        false, // No sideset enable
+        FLUX_WRAP_TARGET, FLUX_WRAP,
+        PIO_ANY_OFFSET)) {
+        return floppyio_flux_readinto_polled(buf, len, data, index);
+    }
+    int channel = rp2pio_statemachine_claim_read_dma(&state_machine);
+    if (channel < 0) {
+        rp2pio_statemachine_deinit(&state_machine, true);
+        return floppyio_flux_readinto_polled(buf, len, data, index);
+    }
+
+    PIO pio = state_machine.pio;
+    uint sm = state_machine.state_machine;
+
+    // Hold the state machine at the start of the program until the index
+    // pulse, where it waits for the first falling edge of the data pin.
+    pio_sm_set_enabled(pio, sm, false);
+    pio_sm_restart(pio, sm);
+    pio_sm_clear_fifos(pio, sm);
+    pio_sm_exec(pio, sm, pio_encode_jmp(state_machine.offset));
+
+    memset(buf, 0, len);
+
+    dma_channel_config c = dma_channel_get_default_config(channel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, pio_get_dreq(pio, sm, false));
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    dma_channel_configure(channel, &c, buf, &pio->rxf[sm], len, true);
+
+    // wait for index pulse low
+    while (common_hal_digitalio_digitalinout_get_value(index) && !mp_hal_is_interrupted()) {
+        RUN_BACKGROUND_TASKS;
+    }
+
+    pio_sm_set_enabled(pio, sm, true);
+
+    // Stop at the start of the next index pulse, one revolution later.
+    bool index_high = false;
+    while (dma_channel_is_busy(channel) && !mp_hal_is_interrupted()) {
+        bool index_value = common_hal_digitalio_digitalinout_get_value(index);
+        if (index_high && !index_value) {
+            break;
+        }
+        index_high = index_value;
+        RUN_BACKGROUND_TASKS;
+    }
+
+    pio_sm_set_enabled(pio, sm, false);
+    dma_channel_abort(channel);
+    size_t count = len - dma_channel_hw_addr(channel)->transfer_count;
+    // This also releases the DMA channel.
+    rp2pio_statemachine_deinit(&state_machine, true);
+
+    uint8_t *pulses = buf;
+    for (size_t i = 0; i < count; i++) {
+        pulses[i] = MIN(255, pulses[i] + FLUX_OVERHEAD);
+    }
+    return count;
+}
@@ -26,7 +26,7 @@
 
 #pragma once
 
-// empirical-ish from RP2040 @ 125MHz for floppy_flux_readinto
+// the rate of the state machine in floppy_flux_readinto
 #define FLOPPYIO_SAMPLERATE (24000000)
 // empirical-ish from RP2040 @ 125MHz for floppy_mfm_readinto
 // my guess is these are slower because the more complex routine falls out of cache, but it's just
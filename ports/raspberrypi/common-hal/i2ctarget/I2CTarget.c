@@ -30,16 +30,81 @@
 
 #include "py/mperrno.h"
 #include "py/mphal.h"
+#include "py/mpstate.h"
 #include "shared-bindings/busio/I2C.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "py/runtime.h"
 
 #include "src/rp2_common/hardware_gpio/include/hardware/gpio.h"
+#include "src/rp2_common/hardware_irq/include/hardware/irq.h"
 
 STATIC i2c_inst_t *i2c[2] = {i2c0, i2c1};
 
 #define NO_PIN 0xff
 
+// Interrupts used while serving registers.
+#define REGISTER_FILE_INTERRUPTS (I2C_IC_INTR_MASK_M_RX_FULL_BITS | I2C_IC_INTR_MASK_M_RD_REQ_BITS | \
+    I2C_IC_INTR_MASK_M_TX_ABRT_BITS | I2C_IC_INTR_MASK_M_START_DET_BITS | I2C_IC_INTR_MASK_M_STOP_DET_BITS)
+
+STATIC void i2c_target_irq_handler(i2ctarget_i2c_target_obj_t *self) {
+    i2c_hw_t *hw = self->peripheral->hw;
+    i2ctarget_register_file_t *register_file = &self->register_file;
+    uint32_t status = hw->intr_stat;
+
+    // Take the received bytes first so they count toward the write that a start or stop ends.
+    while (hw->status & I2C_IC_STATUS_RFNE_BITS) {
+        uint32_t data_cmd = hw->data_cmd;
+        if (data_cmd & I2C_IC_DATA_CMD_FIRST_DATA_BYTE_BITS) {
+            i2ctarget_register_file_select(register_file, (uint8_t)data_cmd);
+        } else {
+            i2ctarget_register_file_write(register_file, (uint8_t)data_cmd);
+        }
+    }
+    if (status & I2C_IC_INTR_STAT_R_TX_ABRT_BITS) {
+        hw->clr_tx_abrt;
+    }
+    if (status & (I2C_IC_INTR_STAT_R_START_DET_BITS | I2C_IC_INTR_STAT_R_STOP_DET_BITS)) {
+        hw->clr_start_det;
+        hw->clr_stop_det;
+        i2ctarget_register_file_end(register_file);
+    }
+    if (status & I2C_IC_INTR_STAT_R_RD_REQ_BITS) {
+        // The clock is stretched until this byte is in the FIFO.
+        hw->data_cmd = i2ctarget_register_file_read(register_file);
+        hw->clr_rd_req;
+    }
+}
+
+STATIC void i2c0_target_irq_handler(void) {
+    i2c_target_irq_handler(MP_STATE_PORT(serving_i2c_targets)[0]);
+}
+
+STATIC void i2c1_target_irq_handler(void) {
+    i2c_target_irq_handler(MP_STATE_PORT(serving_i2c_targets)[1]);
+}
+
+STATIC void stop_serving_registers(i2ctarget_i2c_target_obj_t *self) {
+    if (!i2ctarget_register_file_active(&self->register_file)) {
+        return;
+    }
+    uint index = i2c_hw_index(self->peripheral);
+    uint irq = I2C0_IRQ + index;
+    irq_set_enabled(irq, false);
+    irq_remove_handler(irq, index == 0 ? i2c0_target_irq_handler : i2c1_target_irq_handler);
+    self->peripheral->hw->intr_mask = I2C_IC_INTR_MASK_M_RESTART_DET_BITS;
+    i2ctarget_register_file_init(&self->register_file, mp_const_none, NULL, 0, 0, false);
+    MP_STATE_PORT(serving_i2c_targets)[index] = NULL;
+}
+
+void reset_i2ctarget(void) {
+    for (size_t i = 0; i < 2; i++) {
+        i2ctarget_i2c_target_obj_t *self = MP_STATE_PORT(serving_i2c_targets)[i];
+        if (self != NULL) {
+            stop_serving_registers(self);
+        }
+    }
+}
+
 void common_hal_i2ctarget_i2c_target_construct(i2ctarget_i2c_target_obj_t *self, const mcu_pin_obj_t *scl, const mcu_pin_obj_t *sda,
     uint8_t *addresses, unsigned int num_addresses, bool smbus) {
     self->peripheral = NULL;
@@ -81,6 +146,7 @@ void common_hal_i2ctarget_i2c_target_construct(i2ctarget_i2c_target_obj_t *self,
 
     self->peripheral->hw->intr_mask |= I2C_IC_INTR_MASK_M_RESTART_DET_BITS;
     i2c_set_slave_mode(self->peripheral, true, self->addresses[0]);
+    i2ctarget_register_file_init(&self->register_file, mp_const_none, NULL, 0, 0, false);
 
     return;
 }
@@ -94,6 +160,7 @@ void common_hal_i2ctarget_i2c_target_deinit(i2ctarget_i2c_target_obj_t *self) {
         return;
     }
 
+    stop_serving_registers(self);
     i2c_deinit(self->peripheral);
 
     reset_pin_number(self->sda_pin);
@@ -105,6 +172,9 @@ void common_hal_i2ctarget_i2c_target_deinit(i2ctarget_i2c_target_obj_t *self) {
 }
 
 int common_hal_i2ctarget_i2c_target_is_addressed(i2ctarget_i2c_target_obj_t *self, uint8_t *address, bool *is_read, bool *is_restart) {
+    if (i2ctarget_register_file_active(&self->register_file)) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Registers are being served"));
+    }
     if (!((self->peripheral->hw->raw_intr_stat & I2C_IC_INTR_STAT_R_RX_FULL_BITS) || (self->peripheral->hw->raw_intr_stat & I2C_IC_INTR_STAT_R_RD_REQ_BITS))) {
         return 0;
     }
@@ -150,3 +220,33 @@ void common_hal_i2ctarget_i2c_target_ack(i2ctarget_i2c_target_obj_t *self, bool
 void common_hal_i2ctarget_i2c_target_close(i2ctarget_i2c_target_obj_t *self) {
     return;
 }
+
+void common_hal_i2ctarget_i2c_target_serve_registers(i2ctarget_i2c_target_obj_t *self,
+    mp_obj_t registers_obj, uint8_t *registers, size_t length, uint8_t first_register, bool notify) {
+    stop_serving_registers(self);
+    if (registers == NULL) {
+        return;
+    }
+
+    uint index = i2c_hw_index(self->peripheral);
+    uint irq = I2C0_IRQ + index;
+    i2ctarget_register_file_init(&self->register_file, registers_obj, registers, length, first_register, notify);
+    MP_STATE_PORT(serving_i2c_targets)[index] = self;
+
+    i2c_hw_t *hw = self->peripheral->hw;
+    // Drop anything received while Python was answering requests.
+    while (hw->status & I2C_IC_STATUS_RFNE_BITS) {
+        (void)hw->data_cmd;
+    }
+    hw->clr_intr;
+    hw->intr_mask = REGISTER_FILE_INTERRUPTS;
+    irq_set_exclusive_handler(irq, index == 0 ? i2c0_target_irq_handler : i2c1_target_irq_handler);
+    irq_set_enabled(irq, true);
+}
+
+bool common_hal_i2ctarget_i2c_target_pop_write(i2ctarget_i2c_target_obj_t *self,
+    uint8_t *first_register, size_t *length) {
+    return i2ctarget_register_file_pop_write(&self->register_file, first_register, length);
+}
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t serving_i2c_targets[2]);
@@ -29,6 +29,7 @@
 
 #include "py/obj.h"
 #include "common-hal/microcontroller/Pin.h"
+#include "shared-module/i2ctarget/RegisterFile.h"
 #include "src/rp2_common/hardware_i2c/include/hardware/i2c.h"
 
 typedef struct {
@@ -41,6 +42,10 @@ typedef struct {
 
     uint8_t scl_pin;
     uint8_t sda_pin;
+
+    i2ctarget_register_file_t register_file;
 } i2ctarget_i2c_target_obj_t;
 
+void reset_i2ctarget(void);
+
 #endif MICROPY_INCLUDED_RPI_COMMON_HAL_BUSIO_I2C_TARGET_H
@@ -61,6 +61,8 @@ void mdns_server_construct(mdns_server_obj_t *self, bool workflow) {
         mdns_resp_restart(NETIF_STA);
     }
     self->inited = true;
+    // Services were removed along with the netif when the last object was deinited.
+    memset(self->service_type, 0, sizeof(self->service_type));
 
     uint8_t mac[6];
     wifi_radio_get_mac_address(&common_hal_wifi_radio_obj, mac);
@@ -316,6 +318,18 @@ STATIC void assign_txt_records(mdns_server_obj_t *self, const char *txt_records[
     }
 }
 
+STATIC bool same_txt_records(mdns_server_obj_t *self, const char *txt_records[], size_t num_txt_records) {
+    if (MIN(num_txt_records, MDNS_MAX_TXT_RECORDS) != self->num_txt_records) {
+        return false;
+    }
+    for (size_t i = 0; i < self->num_txt_records; i++) {
+        if (strcmp(txt_records[i], self->txt_records[i]) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void common_hal_mdns_server_advertise_service(mdns_server_obj_t *self, const char *service_type, const char *protocol, mp_int_t port, const char *txt_records[], size_t num_txt_records) {
     enum mdns_sd_proto proto = DNSSD_PROTO_UDP;
     if (strcmp(protocol, "_tcp") == 0) {
@@ -332,6 +346,11 @@ void common_hal_mdns_server_advertise_service(mdns_server_obj_t *self, const cha
         }
     }
     if (existing_slot < MDNS_MAX_SERVICES) {
+        // Re-adding a service probes for and announces it on the network again.
+        // The web workflow advertises on every reload, so skip it when nothing changed.
+        if (self->service_port[existing_slot] == port && same_txt_records(self, txt_records, num_txt_records)) {
+            return;
+        }
         mdns_resp_del_service(NETIF_STA, existing_slot);
     }
 
@@ -342,4 +361,5 @@ void common_hal_mdns_server_advertise_service(mdns_server_obj_t *self, const cha
         return;
     }
     self->service_type[slot] = service_type;
+    self->service_port[slot] = port;
 }
@@ -38,6 +38,7 @@ typedef struct {
     const char *instance_name;
     char default_hostname[sizeof("cpy-XXXXXX")];
     const char *service_type[MDNS_MAX_SERVICES];
+    uint16_t service_port[MDNS_MAX_SERVICES];
     size_t num_txt_records;
     const char *txt_records[MDNS_MAX_TXT_RECORDS];
     // Track if this object owns access to the underlying MDNS service.
@@ -134,3 +134,23 @@ void common_hal_memorymap_addressrange_get_bytes(const memorymap_addressrange_ob
             break;
     }
 }
+
+bool common_hal_memorymap_addressrange_get_buffer(const memorymap_addressrange_obj_t *self,
+    mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    switch (self->type) {
+        case SRAM:
+            break;
+        case XIP:
+        case ROM:
+            if (flags & MP_BUFFER_WRITE) {
+                return false;
+            }
+            break;
+        case IO:
+            // Registers need accesses of the right width, so they can't be a buffer
+            return false;
+    }
+    bufinfo->buf = self->start_address;
+    bufinfo->len = self->len;
+    return true;
+}
@@ -33,15 +33,21 @@
 #include "shared-bindings/microcontroller/Processor.h"
 #include "shared-bindings/microcontroller/ResetReason.h"
 #include "shared-bindings/time/__init__.h"
+#include "supervisor/shared/cpu_governor.h"
 
 #include "pico/stdlib.h"
 #include "src/rp2_common/hardware_adc/include/hardware/adc.h"
 #include "src/rp2_common/hardware_clocks/include/hardware/clocks.h"
+#include "src/rp2_common/hardware_i2c/include/hardware/i2c.h"
+#include "src/rp2_common/hardware_pio/include/hardware/pio.h"
+#include "src/rp2_common/hardware_spi/include/hardware/spi.h"
+#include "src/rp2_common/hardware_uart/include/hardware/uart.h"
 #include "src/rp2_common/hardware_vreg/include/hardware/vreg.h"
 #include "src/rp2_common/hardware_watchdog/include/hardware/watchdog.h"
 
 #include "src/rp2040/hardware_regs/include/hardware/regs/vreg_and_chip_reset.h"
 #include "src/rp2040/hardware_regs/include/hardware/regs/watchdog.h"
+#include "src/rp2040/hardware_structs/include/hardware/structs/pwm.h"
 #include "src/rp2040/hardware_structs/include/hardware/structs/vreg_and_chip_reset.h"
 #include "src/rp2040/hardware_structs/include/hardware/structs/watchdog.h"
 
@@ -85,6 +91,44 @@ void common_hal_mcu_processor_set_frequency(mcu_processor_obj_t *self, uint32_t
     set_sys_clock_khz(freq_khz, false);
 }
 
+#if CIRCUITPY_CPU_GOVERNOR
+// All of these run at the default 1.10V, so the governor can skip changing the
+// voltage and the wait that goes with it. Each has an exact PLL setting for the
+// 12MHz crystal.
+STATIC const uint32_t governor_frequencies[] = {
+    48000000,
+    96000000,
+};
+
+size_t port_cpu_governor_get_frequencies(const uint32_t **frequencies) {
+    *frequencies = governor_frequencies;
+    return MP_ARRAY_SIZE(governor_frequencies);
+}
+
+bool port_cpu_governor_can_change(void) {
+    // clk_peri follows clk_sys, so UART and SPI baud rates move with it. I2C,
+    // PWM and PIO are clocked from clk_sys directly. USB and the ADC have their
+    // own PLL and don't care.
+    if ((pio0->ctrl | pio1->ctrl) & PIO_CTRL_SM_ENABLE_BITS) {
+        return false;
+    }
+    if (pwm_hw->en != 0) {
+        return false;
+    }
+    if (i2c_get_hw(i2c0)->enable || i2c_get_hw(i2c1)->enable) {
+        return false;
+    }
+    if ((spi_get_hw(spi0)->cr1 | spi_get_hw(spi1)->cr1) & SPI_SSPCR1_SSE_BITS) {
+        return false;
+    }
+    return !uart_is_enabled(uart0) && !uart_is_enabled(uart1);
+}
+
+void port_cpu_governor_set_frequency(uint32_t frequency) {
+    set_sys_clock_khz(frequency / 1000, false);
+}
+#endif
+
 void common_hal_mcu_processor_get_uid(uint8_t raw_id[]) {
     pico_unique_board_id_t retrieved_id;
     pico_get_unique_board_id(&retrieved_id);
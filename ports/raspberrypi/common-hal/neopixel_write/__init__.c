@@ -32,6 +32,13 @@
 #include "shared-bindings/digitalio/DigitalInOut.h"
 
 #include "supervisor/port.h"
+#include "supervisor/port_heap.h"
+
+#include <string.h>
+
+#ifndef CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND_STRIPS
+#define CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND_STRIPS (4)
+#endif
 
 uint64_t next_start_raw_ticks = 0;
 
@@ -54,14 +61,9 @@ const uint16_t neopixel_program[] = {
     0xa442
 };
 
-void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout, uint8_t *pixels, uint32_t num_bytes) {
-    // Set everything up.
-    rp2pio_statemachine_obj_t state_machine;
-
-    // TODO: Cache the state machine after we create it once. We'll need a way to
-    // change the pins then though.
-    uint32_t pins_we_use = 1 << digitalinout->pin->number;
-    bool ok = rp2pio_statemachine_construct(&state_machine,
+STATIC bool _construct_state_machine(rp2pio_statemachine_obj_t *state_machine, const mcu_pin_obj_t *pin) {
+    uint32_t pins_we_use = 1 << pin->number;
+    return rp2pio_statemachine_construct(state_machine,
         neopixel_program, sizeof(neopixel_program) / sizeof(neopixel_program[0]),
         12800000, // 12.8MHz, to get appropriate sub-bit times in PIO program.
         NULL, 0, // init program
@@ -69,7 +71,7 @@ void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout,
         NULL, 1, // in
         0, 0, // in pulls
         NULL, 1, // set
-        digitalinout->pin, 1, // sideset
+        pin, 1, // sideset
         0, pins_we_use, // initial pin state
         NULL, // jump pin
         pins_we_use, true, false,
@@ -82,7 +84,145 @@ void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout,
         0, -1, // wrap
         PIO_ANY_OFFSET  // offset
         );
-    if (!ok) {
+}
+
+STATIC void _release_pin(const digitalio_digitalinout_obj_t *digitalinout) {
+    // Reset the pin and release it from the PIO
+    gpio_init(digitalinout->pin->number);
+    common_hal_digitalio_digitalinout_switch_to_output((digitalio_digitalinout_obj_t *)digitalinout, false, DRIVE_MODE_PUSH_PULL);
+}
+
+#if CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND
+// Strips being written in the background keep their state machine and a copy of the pixel data
+// until the VM ends, so that the next frame can be rendered while this one is sent.
+typedef struct {
+    rp2pio_statemachine_obj_t state_machine;
+    // NULL when the entry is free.
+    const mcu_pin_obj_t *pin;
+    uint8_t *buffer;
+    uint32_t buffer_size;
+    // When the current transmission and the latch time after it are over.
+    uint64_t next_start_raw_ticks;
+} neopixel_background_strip_t;
+
+STATIC neopixel_background_strip_t background_strips[CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND_STRIPS];
+
+// Pass NULL to find a free entry.
+STATIC neopixel_background_strip_t *_find_background_strip(const mcu_pin_obj_t *pin) {
+    for (size_t i = 0; i < CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND_STRIPS; i++) {
+        if (background_strips[i].pin == pin) {
+            return &background_strips[i];
+        }
+    }
+    return NULL;
+}
+
+STATIC bool _background_strip_writing(neopixel_background_strip_t *strip) {
+    rp2pio_statemachine_obj_t *state_machine = &strip->state_machine;
+    return common_hal_rp2pio_statemachine_get_writing(state_machine) ||
+           !pio_sm_is_tx_fifo_empty(state_machine->pio, state_machine->state_machine) ||
+           port_get_raw_ticks(NULL) < strip->next_start_raw_ticks;
+}
+
+STATIC void _wait_for_background_strip(neopixel_background_strip_t *strip) {
+    while (_background_strip_writing(strip)) {
+        RUN_BACKGROUND_TASKS;
+    }
+}
+
+// digitalinout is NULL when the VM is ending and there is no DigitalInOut to update.
+STATIC void _release_background_strip(neopixel_background_strip_t *strip, const digitalio_digitalinout_obj_t *digitalinout) {
+    rp2pio_statemachine_deinit(&strip->state_machine, true);
+    if (digitalinout != NULL) {
+        _release_pin(digitalinout);
+    } else {
+        gpio_init(strip->pin->number);
+    }
+    if (strip->buffer != NULL) {
+        port_free(strip->buffer);
+    }
+    strip->buffer = NULL;
+    strip->buffer_size = 0;
+    strip->pin = NULL;
+}
+
+bool common_hal_neopixel_write_background(const digitalio_digitalinout_obj_t *digitalinout, uint8_t *pixels, uint32_t num_bytes) {
+    neopixel_background_strip_t *strip = _find_background_strip(digitalinout->pin);
+    if (strip == NULL) {
+        strip = _find_background_strip(NULL);
+        if (strip == NULL || !_construct_state_machine(&strip->state_machine, digitalinout->pin)) {
+            return false;
+        }
+        strip->pin = digitalinout->pin;
+        // Don't append onto the end of a foreground write.
+        strip->next_start_raw_ticks = next_start_raw_ticks;
+    }
+
+    _wait_for_background_strip(strip);
+
+    if (strip->buffer_size < num_bytes) {
+        if (strip->buffer != NULL) {
+            port_free(strip->buffer);
+        }
+        strip->buffer = port_malloc(num_bytes, true);
+        if (strip->buffer == NULL) {
+            _release_background_strip(strip, digitalinout);
+            return false;
+        }
+        strip->buffer_size = num_bytes;
+    }
+    memcpy(strip->buffer, pixels, num_bytes);
+
+    sm_buf_info once = {
+        .obj = mp_const_none,
+        .info = { .buf = strip->buffer, .len = num_bytes },
+    };
+    sm_buf_info loop = {
+        .obj = mp_const_none,
+        .info = { .buf = NULL, .len = 0 },
+    };
+    if (!common_hal_rp2pio_statemachine_background_write(&strip->state_machine, &once, &loop, 1 /* stride in bytes */, false)) {
+        _release_background_strip(strip, digitalinout);
+        return false;
+    }
+    // Each byte takes 10us to send. Round up to whole ticks (1/1024 s) and then add two more to
+    // give it at least 300us to latch, like a foreground write.
+    strip->next_start_raw_ticks = port_get_raw_ticks(NULL) + ((uint64_t)num_bytes * 1024 * 10 + 999999) / 1000000 + 2;
+    return true;
+}
+
+bool common_hal_neopixel_write_get_writing(const digitalio_digitalinout_obj_t *digitalinout) {
+    neopixel_background_strip_t *strip = _find_background_strip(digitalinout->pin);
+    return strip != NULL && _background_strip_writing(strip);
+}
+
+void neopixel_write_reset(void) {
+    for (size_t i = 0; i < CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND_STRIPS; i++) {
+        if (background_strips[i].pin != NULL) {
+            _release_background_strip(&background_strips[i], NULL);
+        }
+    }
+}
+#endif
+
+void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout, uint8_t *pixels, uint32_t num_bytes) {
+    #if CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND
+    // Finish any background write to this pin and give the pin back before writing in the
+    // foreground.
+    neopixel_background_strip_t *strip = _find_background_strip(digitalinout->pin);
+    if (strip != NULL) {
+        _wait_for_background_strip(strip);
+        _release_background_strip(strip, digitalinout);
+        next_start_raw_ticks = port_get_raw_ticks(NULL) + 2;
+    }
+    #endif
+
+    // Set everything up.
+    rp2pio_statemachine_obj_t state_machine;
+
+    // TODO: Cache the state machine after we create it once. We'll need a way to
+    // change the pins then though.
+    if (!_construct_state_machine(&state_machine, digitalinout->pin)) {
         // Do nothing. Maybe bitbang?
         return;
     }
@@ -97,9 +237,7 @@ void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout,
     // Use a private deinit of the state machine that doesn't reset the pin.
     rp2pio_statemachine_deinit(&state_machine, true);
 
-    // Reset the pin and release it from the PIO
-    gpio_init(digitalinout->pin->number);
-    common_hal_digitalio_digitalinout_switch_to_output((digitalio_digitalinout_obj_t *)digitalinout, false, DRIVE_MODE_PUSH_PULL);
+    _release_pin(digitalinout);
 
     // Update the next start to +2 ticks. This ensures we give it at least 300us.
     next_start_raw_ticks = port_get_raw_ticks(NULL) + 2;
@@ -92,15 +92,17 @@ bool common_hal_nvm_bytearray_set_bytes(const nvm_bytearray_obj_t *self,
     uint8_t values_in[len];
     common_hal_nvm_bytearray_get_bytes(self, start_index, len, values_in);
 
-    bool all_ones = true;
+    // Programming can only clear bits, so the sector only needs erasing when a bit goes from 0
+    // to 1.
+    bool only_clears_bits = true;
     for (uint32_t i = 0; i < len; i++) {
-        if (values_in[i] != UINT8_MAX) {
-            all_ones = false;
+        if ((values_in[i] & values[i]) != values[i]) {
+            only_clears_bits = false;
             break;
         }
     }
 
-    if (all_ones) {
+    if (only_clears_bits) {
         uint32_t address = (uint32_t)self->start_address + start_index;
         uint32_t offset = address % FLASH_PAGE_SIZE;
         uint32_t page_addr = address - offset;
@@ -67,6 +67,11 @@ static void __not_in_flash_func(core1_main)(void) {
         (0x1b << MPU_RASR_SIZE_Pos);         // Size is 0x10000000 which masks up to SRAM region.
     MPU->RNR = 7;
 
+    // Scanlines always come from the SRAM framebuffer. Compositing them here
+    // from a displayio Group isn't possible: flash (and so any flash-resident
+    // tiles or palettes) is off limits to this core, and the Group, TileGrids
+    // and Bitmaps live on the GC heap where core 0 mutates and frees them
+    // without any locking.
     uint y = 0;
     while (1) {
         uint32_t *scanbuf;
@@ -25,6 +25,7 @@
  */
 
 #include "src/rp2_common/hardware_gpio/include/hardware/gpio.h"
+#include "src/rp2_common/hardware_dma/include/hardware/dma.h"
 
 #include <stdint.h>
 
@@ -39,26 +40,96 @@
 #define MAX_PULSE 65535
 #define MIN_PULSE 0
 
+// Each loop below takes two cycles, so the count is in microseconds.
+#define PULSEIN_FREQUENCY 2000000
+// Time spent between pulses outside of the loops, in microseconds.
+#define PULSEIN_OVERHEAD 2
+// The largest DMA ring, in address bits. Longer buffers are filled by interrupt.
+#define PULSEIN_MAX_RING_BITS 11
+
+// Pushes the length of each pulse, less PULSEIN_OVERHEAD. Start at 0 to
+// measure a high pulse first and at PULSEIN_LOW_START for a low one.
 static const uint16_t pulsein_program[] = {
-    0x4001, //  1: in     pins, 1
+    0xa02b, //  0: mov    x, ~null
+    0x00c3, //  1: jmp    pin, 3
+    0x0004, //  2: jmp    4
+    0x0041, //  3: jmp    x--, 1
+    0xa0c9, //  4: mov    isr, ~x
+    0x8000, //  5: push   noblock
+    0xa02b, //  6: mov    x, ~null
+    0x00c9, //  7: jmp    pin, 9
+    0x0047, //  8: jmp    x--, 7
+    0xa0c9, //  9: mov    isr, ~x
+    0x8000, // 10: push   noblock
 };
+#define PULSEIN_LOW_START 6
+
+STATIC uint16_t pulsein_duration(uint32_t count) {
+    // Pulses that are longer than MAX_PULSE will return MAX_PULSE
+    return count > MAX_PULSE - PULSEIN_OVERHEAD ? MAX_PULSE : count + PULSEIN_OVERHEAD;
+}
+
+STATIC void pulsein_dma_start(pulseio_pulsein_obj_t *self, volatile void *write_addr) {
+    PIO pio = self->state_machine.pio;
+    uint sm = self->state_machine.state_machine;
+    dma_channel_config c = dma_channel_get_default_config(self->dma_channel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_dreq(&c, pio_get_dreq(pio, sm, false));
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, self->ring_bits + 2);
+    dma_channel_configure(self->dma_channel, &c, write_addr, &pio->rxf[sm], UINT32_MAX, true);
+}
+
+// Returns how many pulses have been captured in total. Unread pulses beyond
+// maxlen are dropped, oldest first, as if the buffer were a plain ring.
+STATIC uint32_t pulsein_dma_sync(pulseio_pulsein_obj_t *self) {
+    dma_channel_hw_t *hw = dma_channel_hw_addr(self->dma_channel);
+    uint32_t remaining = hw->transfer_count;
+    if (remaining < UINT32_MAX / 2) {
+        // Restart long before the transfer count runs out. Stopping first keeps
+        // the count and write address in step.
+        dma_channel_abort(self->dma_channel);
+        self->written_base += UINT32_MAX - hw->transfer_count;
+        pulsein_dma_start(self, (volatile void *)hw->write_addr);
+        remaining = UINT32_MAX;
+    }
+    uint32_t written = self->written_base + (UINT32_MAX - remaining);
+    if (written - self->consumed > self->maxlen) {
+        self->consumed = written - self->maxlen;
+    }
+    return written;
+}
+
+STATIC uint16_t pulsein_dma_get(pulseio_pulsein_obj_t *self, uint32_t index) {
+    uint32_t ring_len = 1u << self->ring_bits;
+    while (true) {
+        pulsein_dma_sync(self);
+        uint32_t entry = self->consumed + index;
+        uint32_t count = self->ring[entry % ring_len];
+        // Retry if the DMA lapped the entry while it was read. The entry has
+        // been dropped by then, so the next sync moves past it.
+        if (pulsein_dma_sync(self) - entry <= ring_len) {
+            return pulsein_duration(count);
+        }
+    }
+}
 
 void common_hal_pulseio_pulsein_construct(pulseio_pulsein_obj_t *self,
     const mcu_pin_obj_t *pin, uint16_t maxlen, bool idle_state) {
 
-    self->buffer = (uint16_t *)m_malloc(maxlen * sizeof(uint16_t));
-    if (self->buffer == NULL) {
-        m_malloc_fail(maxlen * sizeof(uint16_t));
-    }
     self->pin = pin->number;
     self->maxlen = maxlen;
     self->idle_state = idle_state;
     self->start = 0;
     self->len = 0;
+    self->buffer = NULL;
+    self->ring_alloc = NULL;
+    self->dma_channel = -1;
 
     common_hal_rp2pio_statemachine_construct(&self->state_machine,
         pulsein_program, MP_ARRAY_SIZE(pulsein_program),
-        1000000, // frequency
+        PULSEIN_FREQUENCY,
         NULL, 0, // init, init_len
         NULL, 0, // may_exec
         NULL, 0, 0, 0, // first out pin, # out pins, initial_out_pin_state
@@ -66,19 +137,46 @@ void common_hal_pulseio_pulsein_construct(pulseio_pulsein_obj_t *self,
         NULL, 0, 0, 0, // first set pin
         NULL, 0, 0, 0, // first sideset pin
         false, // No sideset enable
-        NULL, PULL_NONE, // jump pin, jmp_pull
+        pin, PULL_NONE, // jump pin, jmp_pull
         0, // wait gpio pins
         true, // exclusive pin usage
         false, 8, false, // TX, setting we don't use
         false, // wait for TX stall
-        true, 32, true, // RX auto pull every 32 bits. shift left to output msb first
+        false, 32, true, // RX, pushed by the program
         false, // Not user-interruptible.
         0, -1, // wrap settings
         PIO_ANY_OFFSET);
 
+    // Stream the pulses into a ring by DMA so that they are still captured
+    // while interrupts are off.
+    uint8_t ring_bits = 0;
+    while ((1u << ring_bits) < maxlen) {
+        ring_bits++;
+    }
+    if (ring_bits <= PULSEIN_MAX_RING_BITS) {
+        self->dma_channel = rp2pio_statemachine_claim_read_dma(&self->state_machine);
+    }
+    if (self->dma_channel >= 0) {
+        // DMA ring buffers must be aligned to their size.
+        size_t ring_size = sizeof(uint32_t) << ring_bits;
+        self->ring_alloc = m_malloc(2 * ring_size);
+        self->ring = (uint32_t *)(((uintptr_t)self->ring_alloc + ring_size - 1) & ~(ring_size - 1));
+        self->ring_bits = ring_bits;
+        self->written_base = 0;
+        self->consumed = 0;
+        pulsein_dma_start(self, self->ring);
+    } else {
+        self->buffer = (uint16_t *)m_malloc(maxlen * sizeof(uint16_t));
+        if (self->buffer == NULL) {
+            m_malloc_fail(maxlen * sizeof(uint16_t));
+        }
+    }
+
     common_hal_pulseio_pulsein_pause(self);
 
-    common_hal_rp2pio_statemachine_set_interrupt_handler(&(self->state_machine), &common_hal_pulseio_pulsein_interrupt, self, PIO_IRQ0_INTE_SM0_RXNEMPTY_BITS);
+    if (self->dma_channel < 0) {
+        common_hal_rp2pio_statemachine_set_interrupt_handler(&(self->state_machine), &common_hal_pulseio_pulsein_interrupt, self, PIO_IRQ0_INTE_SM0_RXNEMPTY_BITS);
+    }
 
     common_hal_pulseio_pulsein_resume(self, 0);
 }
@@ -92,52 +190,36 @@ void common_hal_pulseio_pulsein_deinit(pulseio_pulsein_obj_t *self) {
         return;
     }
     pio_sm_set_enabled(self->state_machine.pio, self->state_machine.state_machine, false);
+    // This also releases the DMA channel.
     common_hal_rp2pio_statemachine_deinit(&self->state_machine);
     m_free(self->buffer);
+    self->buffer = NULL;
+    m_free(self->ring_alloc);
+    self->ring_alloc = NULL;
     reset_pin_number(self->pin);
     self->pin = NO_PIN;
 }
 
 void common_hal_pulseio_pulsein_pause(pulseio_pulsein_obj_t *self) {
+    // The DMA keeps running and simply waits for the next pulse.
     pio_sm_restart(self->state_machine.pio, self->state_machine.state_machine);
     pio_sm_set_enabled(self->state_machine.pio, self->state_machine.state_machine, false);
     pio_sm_clear_fifos(self->state_machine.pio, self->state_machine.state_machine);
-    self->last_level = self->idle_state;
-    self->level_count = 0;
     self->paused = true;
 }
 void common_hal_pulseio_pulsein_interrupt(void *self_in) {
     pulseio_pulsein_obj_t *self = self_in;
 
-    uint32_t rxfifo = 0;
-
-    rxfifo = pio_sm_get_blocking(self->state_machine.pio, self->state_machine.state_machine);
-    // translate from fifo to buffer
-    if ((rxfifo == 0 && self->last_level == false) || (rxfifo == 0xffffffff && self->last_level == true)) {
-        self->level_count = self->level_count + 32;
-    } else {
-        for (uint i = 0; i < 32; i++) {
-            bool level = (rxfifo & (1 << i)) >> i;
-            if (level == self->last_level) {
-                self->level_count++;
+    while (!pio_sm_is_rx_fifo_empty(self->state_machine.pio, self->state_machine.state_machine)) {
+        uint32_t result = pulsein_duration(pio_sm_get(self->state_machine.pio, self->state_machine.state_machine));
+        // return  pulses that are not too short
+        if (result > MIN_PULSE) {
+            size_t buf_index = (self->start + self->len) % self->maxlen;
+            self->buffer[buf_index] = (uint16_t)result;
+            if (self->len < self->maxlen) {
+                self->len++;
             } else {
-                uint32_t result = self->level_count;
-                self->last_level = level;
-                self->level_count = 1;
-                // Pulses that are longer than MAX_PULSE will return MAX_PULSE
-                if (result > MAX_PULSE) {
-                    result = MAX_PULSE;
-                }
-                // return  pulses that are not too short
-                if (result > MIN_PULSE) {
-                    size_t buf_index = (self->start + self->len) % self->maxlen;
-                    self->buffer[buf_index] = (uint16_t)result;
-                    if (self->len < self->maxlen) {
-                        self->len++;
-                    } else {
-                        self->start = (self->start + 1) % self->maxlen;
-                    }
-                }
+                self->start = (self->start + 1) % self->maxlen;
             }
         }
     }
@@ -155,24 +237,36 @@ void common_hal_pulseio_pulsein_resume(pulseio_pulsein_obj_t *self,
         gpio_set_function(self->pin, GPIO_FUNC_PIO0);
     }
 
-    // exec a wait for the selected pin to change state
+    // Measure the first pulse away from the idle state once the pin leaves it.
+    uint offset = self->state_machine.offset;
     if (self->idle_state == true) {
-        pio_sm_exec(self->state_machine.pio, self->state_machine.state_machine, 0x2020);
+        pio_sm_exec(self->state_machine.pio, self->state_machine.state_machine, pio_encode_jmp(offset + PULSEIN_LOW_START));
+        pio_sm_exec(self->state_machine.pio, self->state_machine.state_machine, pio_encode_wait_pin(false, 0));
     } else {
-        pio_sm_exec(self->state_machine.pio, self->state_machine.state_machine, 0x20a0);
+        pio_sm_exec(self->state_machine.pio, self->state_machine.state_machine, pio_encode_jmp(offset));
+        pio_sm_exec(self->state_machine.pio, self->state_machine.state_machine, pio_encode_wait_pin(true, 0));
     }
     pio_sm_set_enabled(self->state_machine.pio, self->state_machine.state_machine, true);
     self->paused = false;
 }
 
 void common_hal_pulseio_pulsein_clear(pulseio_pulsein_obj_t *self) {
+    if (self->dma_channel >= 0) {
+        self->consumed = pulsein_dma_sync(self);
+        return;
+    }
     self->len = 0;
 }
 
 uint16_t common_hal_pulseio_pulsein_popleft(pulseio_pulsein_obj_t *self) {
-    if (self->len == 0) {
+    if (common_hal_pulseio_pulsein_get_len(self) == 0) {
         mp_raise_IndexError_varg(MP_ERROR_TEXT("pop from empty %q"), MP_QSTR_PulseIn);
     }
+    if (self->dma_channel >= 0) {
+        uint16_t value = pulsein_dma_get(self, 0);
+        self->consumed++;
+        return value;
+    }
     uint16_t value = self->buffer[self->start];
     common_hal_mcu_disable_interrupts();
     self->start = (self->start + 1) % self->maxlen;
@@ -186,6 +280,9 @@ uint16_t common_hal_pulseio_pulsein_get_maxlen(pulseio_pulsein_obj_t *self) {
 }
 
 uint16_t common_hal_pulseio_pulsein_get_len(pulseio_pulsein_obj_t *self) {
+    if (self->dma_channel >= 0) {
+        return pulsein_dma_sync(self) - self->consumed;
+    }
     return self->len;
 }
 
@@ -195,11 +292,15 @@ bool common_hal_pulseio_pulsein_get_paused(pulseio_pulsein_obj_t *self) {
 
 uint16_t common_hal_pulseio_pulsein_get_item(pulseio_pulsein_obj_t *self,
     int16_t index) {
+    uint16_t len = common_hal_pulseio_pulsein_get_len(self);
     if (index < 0) {
-        index += self->len;
+        index += len;
+    }
+    if (index < 0 || index >= len) {
+        mp_arg_validate_index_range(index, 0, len, MP_QSTR_index);
     }
-    if (index < 0 || index >= self->len) {
-        mp_arg_validate_index_range(index, 0, self->len, MP_QSTR_index);
+    if (self->dma_channel >= 0) {
+        return pulsein_dma_get(self, index);
     }
     uint16_t value = self->buffer[(self->start + index) % self->maxlen];
     return value;
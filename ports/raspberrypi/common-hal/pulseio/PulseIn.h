@@ -38,11 +38,18 @@ typedef struct {
     bool idle_state;
     bool paused;
     uint16_t maxlen;
+    // Filled by common_hal_pulseio_pulsein_interrupt when there is no DMA channel.
     uint16_t *buffer;
-    volatile bool last_level;
-    volatile uint32_t level_count;
     volatile uint16_t len;
     volatile uint16_t start;
+    // Otherwise DMA streams the raw durations into ring, which has 1 << ring_bits
+    // entries and is aligned to its size within ring_alloc.
+    int8_t dma_channel;
+    uint8_t ring_bits;
+    uint32_t *ring_alloc;
+    volatile uint32_t *ring;
+    uint32_t written_base; // Entries written before the DMA was last restarted.
+    uint32_t consumed;
     rp2pio_statemachine_obj_t state_machine;
 } pulseio_pulsein_obj_t;
 
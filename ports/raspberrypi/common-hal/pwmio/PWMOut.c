@@ -28,8 +28,10 @@
 
 #include "shared/runtime/interrupt_char.h"
 #include "py/runtime.h"
+#include "supervisor/shared/cpu_governor.h"
 #include "common-hal/pwmio/PWMOut.h"
 #include "shared-bindings/pwmio/PWMOut.h"
+#include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/microcontroller/Processor.h"
 
 #include "src/rp2040/hardware_regs/include/hardware/platform_defs.h"
@@ -94,6 +96,8 @@ pwmout_result_t pwmout_allocate(uint8_t slice, uint8_t ab_channel, bool variable
     if ((channel_use & channel_use_mask) != 0) {
         return PWMOUT_INTERNAL_RESOURCES_IN_USE;
     }
+    // Set up at the frequency this will run at.
+    supervisor_cpu_governor_restore_frequency();
     // Now check if the slice is in use and if we can share with it.
     if (target_slice_frequencies[slice] > 0) {
         // If we want to change frequency then we can't share.
@@ -185,19 +189,42 @@ void common_hal_pwmio_pwmout_deinit(pwmio_pwmout_obj_t *self) {
     self->pin = NULL;
 }
 
-extern void common_hal_pwmio_pwmout_set_duty_cycle(pwmio_pwmout_obj_t *self, uint16_t duty) {
+STATIC uint16_t pwmout_compare_count(pwmio_pwmout_obj_t *self, uint16_t duty) {
     self->duty_cycle = duty;
     // Do arithmetic in 32 bits to prevent overflow.
-    uint16_t compare_count;
     if (duty == 65535) {
         // Ensure that 100% duty cycle is 100% full on and not rounded down,
         // but do MIN() to keep value in range, just in case.
-        compare_count = MIN(UINT16_MAX, (uint32_t)self->top + 1);
-    } else {
-        compare_count = ((uint32_t)duty * self->top + MAX_TOP / 2) / MAX_TOP;
+        return MIN(UINT16_MAX, (uint32_t)self->top + 1);
     }
+    return ((uint32_t)duty * self->top + MAX_TOP / 2) / MAX_TOP;
+}
+
+extern void common_hal_pwmio_pwmout_set_duty_cycle(pwmio_pwmout_obj_t *self, uint16_t duty) {
     // compare_count is the CC register value, which should be TOP+1 for 100% duty cycle.
-    pwm_set_chan_level(self->slice, self->ab_channel, compare_count);
+    pwm_set_chan_level(self->slice, self->ab_channel, pwmout_compare_count(self, duty));
+}
+
+void common_hal_pwmio_pwmout_set_duty_cycles(pwmio_pwmout_obj_t **pwms, const uint16_t *duty_cycles, size_t count) {
+    // CC is double buffered and latched when the slice wraps, so the channels
+    // of a slice change together when both of them are written in one go.
+    // Slices that run in phase all change at the same wrap.
+    uint32_t cc[NUM_PWM_SLICES] = { 0 };
+    uint32_t cc_mask[NUM_PWM_SLICES] = { 0 };
+    for (size_t i = 0; i < count; i++) {
+        pwmio_pwmout_obj_t *self = pwms[i];
+        uint32_t shift = self->ab_channel ? PWM_CH0_CC_B_LSB : PWM_CH0_CC_A_LSB;
+        uint32_t mask = (uint32_t)UINT16_MAX << shift;
+        cc[self->slice] = (cc[self->slice] & ~mask) | ((uint32_t)pwmout_compare_count(self, duty_cycles[i]) << shift);
+        cc_mask[self->slice] |= mask;
+    }
+    common_hal_mcu_disable_interrupts();
+    for (size_t slice = 0; slice < NUM_PWM_SLICES; slice++) {
+        if (cc_mask[slice] != 0) {
+            hw_write_masked(&pwm_hw->slice[slice].cc, cc[slice], cc_mask[slice]);
+        }
+    }
+    common_hal_mcu_enable_interrupts();
 }
 
 uint16_t common_hal_pwmio_pwmout_get_duty_cycle(pwmio_pwmout_obj_t *self) {
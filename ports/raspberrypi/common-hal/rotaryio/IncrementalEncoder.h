@@ -34,9 +34,7 @@
 typedef struct {
     mp_obj_base_t base;
     rp2pio_statemachine_obj_t state_machine;
-    uint8_t state;        // <old A><old B>
-    int8_t sub_count; // count intermediate transitions between detents
     int8_t divisor; // Number of quadrature edges required per count
     bool swapped;         // Did the pins need to be swapped to be sequential?
-    mp_int_t position;
+    mp_int_t position; // Offset of the state machine's count, in quadrature edges
 } rotaryio_incrementalencoder_obj_t;
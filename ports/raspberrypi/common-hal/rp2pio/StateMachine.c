@@ -44,6 +44,7 @@
 #include "py/obj.h"
 #include "py/objproperty.h"
 #include "py/runtime.h"
+#include "supervisor/shared/cpu_governor.h"
 
 #define NO_DMA_CHANNEL (-1)
 
@@ -57,12 +58,18 @@ STATIC bool _never_reset[NUM_PIOS][NUM_PIO_STATE_MACHINES];
 STATIC uint32_t _current_pins[NUM_PIOS];
 STATIC uint32_t _current_sm_pins[NUM_PIOS][NUM_PIO_STATE_MACHINES];
 STATIC int8_t _sm_dma_plus_one[NUM_PIOS][NUM_PIO_STATE_MACHINES];
+STATIC int8_t _sm_dma_plus_one_read[NUM_PIOS][NUM_PIO_STATE_MACHINES];
 
 #define SM_DMA_ALLOCATED(pio_index, sm) (_sm_dma_plus_one[(pio_index)][(sm)] != 0)
 #define SM_DMA_GET_CHANNEL(pio_index, sm) (_sm_dma_plus_one[(pio_index)][(sm)] - 1)
 #define SM_DMA_CLEAR_CHANNEL(pio_index, sm) (_sm_dma_plus_one[(pio_index)][(sm)] = 0)
 #define SM_DMA_SET_CHANNEL(pio_isntance, sm, channel) (_sm_dma_plus_one[(pio_index)][(sm)] = (channel) + 1)
 
+#define SM_DMA_ALLOCATED_READ(pio_index, sm) (_sm_dma_plus_one_read[(pio_index)][(sm)] != 0)
+#define SM_DMA_GET_CHANNEL_READ(pio_index, sm) (_sm_dma_plus_one_read[(pio_index)][(sm)] - 1)
+#define SM_DMA_CLEAR_CHANNEL_READ(pio_index, sm) (_sm_dma_plus_one_read[(pio_index)][(sm)] = 0)
+#define SM_DMA_SET_CHANNEL_READ(pio_index, sm, channel) (_sm_dma_plus_one_read[(pio_index)][(sm)] = (channel) + 1)
+
 STATIC PIO pio_instances[2] = {pio0, pio1};
 typedef void (*interrupt_handler_type)(void *);
 STATIC interrupt_handler_type _interrupt_handler[NUM_PIOS][NUM_PIO_STATE_MACHINES];
@@ -81,24 +88,35 @@ static void rp2pio_statemachine_set_pull(uint32_t pull_pin_up, uint32_t pull_pin
     }
 }
 
+STATIC void rp2pio_statemachine_release_dma_channel(int channel) {
+    uint32_t channel_mask = 1u << channel;
+    dma_hw->inte0 &= ~channel_mask;
+    if (!dma_hw->inte0) {
+        irq_set_mask_enabled(1 << DMA_IRQ_0, false);
+    }
+    MP_STATE_PORT(background_pio)[channel] = NULL;
+    dma_channel_abort(channel);
+    dma_channel_unclaim(channel);
+}
+
 STATIC void rp2pio_statemachine_clear_dma(int pio_index, int sm) {
     if (SM_DMA_ALLOCATED(pio_index, sm)) {
-        int channel = SM_DMA_GET_CHANNEL(pio_index, sm);
-        uint32_t channel_mask = 1u << channel;
-        dma_hw->inte0 &= ~channel_mask;
-        if (!dma_hw->inte0) {
-            irq_set_mask_enabled(1 << DMA_IRQ_0, false);
-        }
-        MP_STATE_PORT(background_pio)[channel] = NULL;
-        dma_channel_abort(channel);
-        dma_channel_unclaim(channel);
+        rp2pio_statemachine_release_dma_channel(SM_DMA_GET_CHANNEL(pio_index, sm));
     }
     SM_DMA_CLEAR_CHANNEL(pio_index, sm);
 }
 
+STATIC void rp2pio_statemachine_clear_dma_read(int pio_index, int sm) {
+    if (SM_DMA_ALLOCATED_READ(pio_index, sm)) {
+        rp2pio_statemachine_release_dma_channel(SM_DMA_GET_CHANNEL_READ(pio_index, sm));
+    }
+    SM_DMA_CLEAR_CHANNEL_READ(pio_index, sm);
+}
+
 STATIC void _reset_statemachine(PIO pio, uint8_t sm, bool leave_pins) {
     uint8_t pio_index = pio_get_index(pio);
     rp2pio_statemachine_clear_dma(pio_index, sm);
+    rp2pio_statemachine_clear_dma_read(pio_index, sm);
     uint32_t program_id = _current_program_id[pio_index][sm];
     if (program_id == 0) {
         return;
@@ -215,6 +233,8 @@ bool rp2pio_statemachine_construct(rp2pio_statemachine_obj_t *self,
     int wrap_target, int wrap,
     int offset
     ) {
+    // Set up at the frequency this will run at.
+    supervisor_cpu_governor_restore_frequency();
     // Create a program id that isn't the pointer so we can store it without storing the original object.
     uint32_t program_id = ~((uint32_t)program);
 
@@ -388,6 +408,9 @@ bool rp2pio_statemachine_construct(rp2pio_statemachine_obj_t *self,
 
     // no DMA allocated
     SM_DMA_CLEAR_CHANNEL(pio_index, state_machine);
+    SM_DMA_CLEAR_CHANNEL_READ(pio_index, state_machine);
+    self->dma_completed_read = true;
+    self->last_read = mp_const_empty_bytes;
 
     pio_sm_init(self->pio, self->state_machine, program_offset, &c);
     common_hal_rp2pio_statemachine_run(self, init, init_len);
@@ -679,6 +702,19 @@ void common_hal_rp2pio_statemachine_set_frequency(rp2pio_statemachine_obj_t *sel
     pio_sm_clkdiv_restart(self->pio, self->state_machine);
 }
 
+int rp2pio_statemachine_claim_read_dma(rp2pio_statemachine_obj_t *self) {
+    uint8_t pio_index = pio_get_index(self->pio);
+    uint8_t sm = self->state_machine;
+    if (SM_DMA_ALLOCATED_READ(pio_index, sm)) {
+        return -1;
+    }
+    int channel = dma_claim_unused_channel(false);
+    if (channel != -1) {
+        SM_DMA_SET_CHANNEL_READ(pio_index, sm, channel);
+    }
+    return channel;
+}
+
 void rp2pio_statemachine_reset_ok(PIO pio, int sm) {
     uint8_t pio_index = pio_get_index(pio);
     _never_reset[pio_index][sm] = false;
@@ -692,6 +728,7 @@ void rp2pio_statemachine_never_reset(PIO pio, int sm) {
 void rp2pio_statemachine_deinit(rp2pio_statemachine_obj_t *self, bool leave_pins) {
     common_hal_rp2pio_statemachine_stop(self);
     (void)common_hal_rp2pio_statemachine_stop_background_write(self);
+    (void)common_hal_rp2pio_statemachine_stop_background_read(self);
 
     uint8_t sm = self->state_machine;
     uint8_t pio_index = pio_get_index(self->pio);
@@ -1042,6 +1079,7 @@ bool common_hal_rp2pio_statemachine_background_write(rp2pio_statemachine_obj_t *
     self->loop = *loop;
     self->pending_buffers = pending_buffers;
     self->dma_completed = false;
+    self->completed_writes = 0;
     self->background_stride_in_bytes = stride_in_bytes;
     self->byteswap = swap;
 
@@ -1067,7 +1105,19 @@ bool common_hal_rp2pio_statemachine_background_write(rp2pio_statemachine_obj_t *
     return true;
 }
 
+STATIC void rp2pio_statemachine_dma_complete_read(rp2pio_statemachine_obj_t *self, int channel);
+
 void rp2pio_statemachine_dma_complete(rp2pio_statemachine_obj_t *self, int channel) {
+    uint8_t pio_index = pio_get_index(self->pio);
+    if (SM_DMA_ALLOCATED_READ(pio_index, self->state_machine) &&
+        channel == SM_DMA_GET_CHANNEL_READ(pio_index, self->state_machine)) {
+        rp2pio_statemachine_dma_complete_read(self, channel);
+        return;
+    }
+
+    if (self->current.info.buf) {
+        self->completed_writes++;
+    }
     self->current = self->once;
     self->once = self->loop;
 
@@ -1102,6 +1152,184 @@ int common_hal_rp2pio_statemachine_get_pending(rp2pio_statemachine_obj_t *self)
     return self->pending_buffers;
 }
 
+uint32_t common_hal_rp2pio_statemachine_get_completed_writes(rp2pio_statemachine_obj_t *self) {
+    return self->completed_writes;
+}
+
+// Queue the read buffers so that once_read is filled next. If there is no
+// once buffer, the loop buffers alternate starting with loop.
+STATIC void _queue_read_buffers(rp2pio_statemachine_obj_t *self, const sm_buf_info *once, const sm_buf_info *loop, const sm_buf_info *loop2) {
+    sm_buf_info empty;
+    memset(&empty, 0, sizeof(empty));
+    if (!loop->info.len) {
+        loop = loop2;
+        loop2 = &empty;
+    }
+    if (once->info.len) {
+        self->once_read = *once;
+        self->loop_read = *loop;
+        self->loop2_read = *loop2;
+    } else if (loop2->info.len) {
+        sm_buf_info first = *loop;
+        self->once_read = first;
+        self->loop_read = *loop2;
+        self->loop2_read = first;
+    } else {
+        self->once_read = *loop;
+        self->loop_read = *loop;
+        memset(&self->loop2_read, 0, sizeof(self->loop2_read));
+    }
+}
+
+// Move the next buffer into current_read and line up the one after it.
+STATIC void _advance_read_buffers(rp2pio_statemachine_obj_t *self) {
+    self->current_read = self->once_read;
+    self->once_read = self->loop_read;
+    if (self->loop2_read.info.buf) {
+        sm_buf_info tmp = self->loop_read;
+        self->loop_read = self->loop2_read;
+        self->loop2_read = tmp;
+    }
+}
+
+STATIC void _start_read_buffer(rp2pio_statemachine_obj_t *self, int channel) {
+    dma_channel_set_write_addr(channel, self->current_read.info.buf, false);
+    dma_channel_set_trans_count(channel, self->current_read.info.len / self->background_stride_in_bytes_read, true);
+}
+
+bool common_hal_rp2pio_statemachine_background_read(rp2pio_statemachine_obj_t *self, const sm_buf_info *once, const sm_buf_info *loop, const sm_buf_info *loop2, uint8_t stride_in_bytes, bool swap) {
+    uint8_t pio_index = pio_get_index(self->pio);
+    uint8_t sm = self->state_machine;
+
+    int pending_buffers = (once->info.len != 0) + (loop->info.len != 0) + (loop2->info.len != 0);
+
+    if (SM_DMA_ALLOCATED_READ(pio_index, sm)) {
+        if (stride_in_bytes != self->background_stride_in_bytes_read) {
+            mp_raise_ValueError(MP_ERROR_TEXT("Mismatched data size"));
+        }
+        if (swap != self->byteswap_read) {
+            mp_raise_ValueError(MP_ERROR_TEXT("Mismatched swap flag"));
+        }
+
+        while (self->pending_buffers_read) {
+            RUN_BACKGROUND_TASKS;
+            if (self->user_interruptible && mp_hal_is_interrupted()) {
+                return false;
+            }
+        }
+
+        common_hal_mcu_disable_interrupts();
+        _queue_read_buffers(self, once, loop, loop2);
+        self->pending_buffers_read = pending_buffers;
+
+        if (self->dma_completed_read && self->once_read.info.len) {
+            _advance_read_buffers(self);
+            _start_read_buffer(self, SM_DMA_GET_CHANNEL_READ(pio_index, sm));
+            self->dma_completed_read = false;
+        }
+
+        common_hal_mcu_enable_interrupts();
+
+        return true;
+    }
+
+    int channel = dma_claim_unused_channel(false);
+    if (channel == -1) {
+        return false;
+    }
+
+    SM_DMA_SET_CHANNEL_READ(pio_index, sm, channel);
+
+    const volatile uint8_t *rx_source = (const volatile uint8_t *)&self->pio->rxf[self->state_machine];
+    if (self->in_shift_right) {
+        rx_source += 4 - stride_in_bytes;
+    }
+
+    self->rx_dreq = pio_get_dreq(self->pio, self->state_machine, false);
+
+    _queue_read_buffers(self, once, loop, loop2);
+    _advance_read_buffers(self);
+    self->last_read = mp_const_empty_bytes;
+    self->pending_buffers_read = pending_buffers;
+    self->dma_completed_read = false;
+    self->completed_reads = 0;
+    self->background_stride_in_bytes_read = stride_in_bytes;
+    self->byteswap_read = swap;
+
+    dma_channel_config c = dma_channel_get_default_config(channel);
+    channel_config_set_transfer_data_size(&c, _stride_to_dma_size(stride_in_bytes));
+    channel_config_set_dreq(&c, self->rx_dreq);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_bswap(&c, swap);
+    dma_channel_configure(channel, &c,
+        self->current_read.info.buf,
+        rx_source,
+        self->current_read.info.len / stride_in_bytes,
+        false);
+
+    common_hal_mcu_disable_interrupts();
+    MP_STATE_PORT(background_pio)[channel] = self;
+    dma_hw->inte0 |= 1u << channel;
+    irq_set_mask_enabled(1 << DMA_IRQ_0, true);
+    dma_start_channel_mask(1u << channel);
+    common_hal_mcu_enable_interrupts();
+
+    return true;
+}
+
+STATIC void rp2pio_statemachine_dma_complete_read(rp2pio_statemachine_obj_t *self, int channel) {
+    if (self->current_read.info.buf) {
+        self->last_read = self->current_read.obj;
+        self->completed_reads++;
+    }
+    _advance_read_buffers(self);
+
+    if (self->current_read.info.buf) {
+        if (self->pending_buffers_read > 0) {
+            self->pending_buffers_read--;
+        }
+        _start_read_buffer(self, channel);
+    } else {
+        self->dma_completed_read = true;
+        self->pending_buffers_read = 0; // should be a no-op
+    }
+}
+
+bool common_hal_rp2pio_statemachine_stop_background_read(rp2pio_statemachine_obj_t *self) {
+    uint8_t pio_index = pio_get_index(self->pio);
+    uint8_t sm = self->state_machine;
+    rp2pio_statemachine_clear_dma_read(pio_index, sm);
+    memset(&self->current_read, 0, sizeof(self->current_read));
+    memset(&self->once_read, 0, sizeof(self->once_read));
+    memset(&self->loop_read, 0, sizeof(self->loop_read));
+    memset(&self->loop2_read, 0, sizeof(self->loop2_read));
+    self->pending_buffers_read = 0;
+    self->dma_completed_read = true;
+    return true;
+}
+
+bool common_hal_rp2pio_statemachine_get_reading(rp2pio_statemachine_obj_t *self) {
+    return !self->dma_completed_read;
+}
+
+mp_int_t common_hal_rp2pio_statemachine_get_pending_read(rp2pio_statemachine_obj_t *self) {
+    return self->pending_buffers_read;
+}
+
+uint32_t common_hal_rp2pio_statemachine_get_completed_reads(rp2pio_statemachine_obj_t *self) {
+    return self->completed_reads;
+}
+
+mp_obj_t common_hal_rp2pio_statemachine_get_last_read(rp2pio_statemachine_obj_t *self) {
+    // Self-clearing, so that polling code sees each filled buffer once.
+    common_hal_mcu_disable_interrupts();
+    mp_obj_t last_read = self->last_read;
+    self->last_read = mp_const_empty_bytes;
+    common_hal_mcu_enable_interrupts();
+    return last_read;
+}
+
 // Use a compile-time constant for MP_REGISTER_POINTER so the preprocessor will
 // not split the expansion across multiple lines.
 MP_REGISTER_ROOT_POINTER(mp_obj_t background_pio[enum_NUM_DMA_CHANNELS]);
@@ -68,6 +68,16 @@ typedef struct {
     sm_buf_info current, once, loop;
     int background_stride_in_bytes;
     bool dma_completed, byteswap;
+    uint32_t completed_writes;
+
+    // background read items; once_read is the next buffer to be filled, and
+    // loop_read and loop2_read trade places each time a buffer is started.
+    volatile int pending_buffers_read;
+    sm_buf_info current_read, once_read, loop_read, loop2_read;
+    mp_obj_t last_read;
+    int background_stride_in_bytes_read;
+    bool dma_completed_read, byteswap_read;
+    uint32_t completed_reads;
 } rp2pio_statemachine_obj_t;
 
 void reset_rp2pio_statemachine(void);
@@ -97,6 +107,10 @@ uint8_t rp2pio_statemachine_program_offset(rp2pio_statemachine_obj_t *self);
 
 void rp2pio_statemachine_deinit(rp2pio_statemachine_obj_t *self, bool leave_pins);
 void rp2pio_statemachine_dma_complete(rp2pio_statemachine_obj_t *self, int channel);
+// Claims a DMA channel for the caller to read the RX FIFO with. It is released
+// with the state machine and whenever a background read stops. Returns -1 if
+// no channel is free.
+int rp2pio_statemachine_claim_read_dma(rp2pio_statemachine_obj_t *self);
 
 void rp2pio_statemachine_reset_ok(PIO pio, int sm);
 void rp2pio_statemachine_never_reset(PIO pio, int sm);
@@ -45,7 +45,9 @@
 #include "lwip/sys.h"
 #include "lwip/dns.h"
 #include "lwip/icmp.h"
+#include "lwip/memp.h"
 #include "lwip/raw.h"
+#include "lwip/stats.h"
 #include "lwip_src/ping.h"
 
 #include "shared/netutils/dhcpserver.h"
@@ -302,7 +304,7 @@ static bool connection_unchanged(wifi_radio_obj_t *self, const uint8_t *ssid, si
     return true;
 }
 
-wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t channel, mp_float_t timeout, uint8_t *bssid, size_t bssid_len) {
+wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t channel, mp_float_t timeout, uint8_t *bssid, size_t bssid_len, bool fast_connect) {
     if (!common_hal_wifi_radio_get_enabled(self)) {
         mp_raise_RuntimeError(MP_ERROR_TEXT("Wifi is not enabled"));
     }
@@ -542,3 +544,34 @@ void common_hal_wifi_radio_gc_collect(wifi_radio_obj_t *self) {
     // Only bother to scan the actual object references.
     gc_collect_ptr(self->current_scan);
 }
+
+#if CIRCUITPY_NETWORK_STATS
+mp_obj_t common_hal_wifi_radio_get_stats(wifi_radio_obj_t *self) {
+    mp_obj_t items[9] = {
+        mp_obj_new_int_from_uint(lwip_stats.tcp.xmit),
+        mp_obj_new_int_from_uint(lwip_stats.tcp.recv),
+        #if MIB2_STATS
+        mp_obj_new_int_from_uint(lwip_stats.mib2.tcpretranssegs),
+        #else
+        mp_const_none,
+        #endif
+        mp_obj_new_int_from_uint(lwip_stats.tcp.drop),
+        mp_obj_new_int_from_uint(lwip_stats.ip.drop),
+        mp_obj_new_int_from_uint(lwip_stats.link.drop),
+        // Pools and the heap are only counted when lwIP manages them itself.
+        #if MEMP_STATS
+        mp_obj_new_int_from_uint(lwip_stats.memp[MEMP_PBUF_POOL]->err),
+        mp_obj_new_int_from_uint(lwip_stats.memp[MEMP_TCP_SEG]->err),
+        #else
+        mp_const_none,
+        mp_const_none,
+        #endif
+        #if MEM_STATS
+        mp_obj_new_int_from_uint(lwip_stats.mem.err),
+        #else
+        mp_const_none,
+        #endif
+    };
+    return namedtuple_make_new((const mp_obj_type_t *)&wifi_radio_stats_type, 9, 0, items);
+}
+#endif
@@ -0,0 +1,83 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "shared-module/keypad/__init__.h"
+
+#include "hardware/gpio.h"
+#include "hardware/irq.h"
+
+// Pins with a keypad wake interrupt enabled, and the level that fires it.
+STATIC uint32_t _keypad_pins;
+STATIC uint32_t _keypad_pins_high;
+
+// Shared with the default GPIO callback used by alarm.pin, so only handle
+// and acknowledge our own pins.
+STATIC void _keypad_gpio_irq_handler(void) {
+    uint32_t pins = _keypad_pins;
+    for (uint i = 0; pins != 0; i++, pins >>= 1) {
+        if ((pins & 1) == 0) {
+            continue;
+        }
+        uint32_t event = (_keypad_pins_high & (1u << i)) ? GPIO_IRQ_LEVEL_HIGH : GPIO_IRQ_LEVEL_LOW;
+        if (gpio_get_irq_event_mask(i) & event) {
+            // Level interrupts keep firing until disabled; the keypad
+            // scanner takes over until the keys are released again.
+            gpio_set_irq_enabled(i, event, false);
+            keypad_pin_changed_from_isr();
+        }
+    }
+}
+
+bool keypad_pin_change_enable(const mcu_pin_obj_t *pin, bool value) {
+    uint32_t mask = 1u << pin->number;
+    if (_keypad_pins == 0) {
+        gpio_add_raw_irq_handler_masked(0xffffffff, _keypad_gpio_irq_handler);
+        irq_set_enabled(IO_IRQ_BANK0, true);
+    }
+    _keypad_pins |= mask;
+    if (value) {
+        _keypad_pins_high |= mask;
+    } else {
+        _keypad_pins_high &= ~mask;
+    }
+    // A level interrupt fires right away if the key is already pressed, so a
+    // press between the last scan and now is not missed.
+    gpio_set_irq_enabled(pin->number, value ? GPIO_IRQ_LEVEL_HIGH : GPIO_IRQ_LEVEL_LOW, true);
+    return true;
+}
+
+void keypad_pin_change_disable(const mcu_pin_obj_t *pin) {
+    uint32_t mask = 1u << pin->number;
+    if ((_keypad_pins & mask) == 0) {
+        return;
+    }
+    gpio_set_irq_enabled(pin->number, GPIO_IRQ_LEVEL_HIGH | GPIO_IRQ_LEVEL_LOW, false);
+    _keypad_pins &= ~mask;
+    if (_keypad_pins == 0) {
+        gpio_remove_raw_irq_handler_masked(0xffffffff, _keypad_gpio_irq_handler);
+    }
+}
@@ -36,10 +36,17 @@
 #define LWIP_NETIF_LINK_CALLBACK    1
 #define LWIP_NETIF_HOSTNAME         1
 #define LWIP_NETCONN                0
+#if CIRCUITPY_NETWORK_STATS
+// Counters for wifi.Radio.stats.
+#define LWIP_STATS                  1
+#define MIB2_STATS                  1
+#define SYS_STATS                   0
+#else
 #define MEM_STATS                   0
 #define SYS_STATS                   0
 #define MEMP_STATS                  0
 #define LINK_STATS                  0
+#endif
 // #define ETH_PAD_SIZE                2
 #define LWIP_CHKSUM_ALGORITHM       3
 #define LWIP_DHCP                   1
@@ -48,6 +55,9 @@
 #define LWIP_UDP                    1
 #define LWIP_DNS                    1
 #define LWIP_DNS_SUPPORT_MDNS_QUERIES   1
+// lwIP keeps answers for their TTL. The default of 4 is easily churned by an
+// HTTP client talking to a few hosts plus NTP.
+#define DNS_TABLE_SIZE              8
 #define LWIP_TCP_KEEPALIVE          1
 #define LWIP_NETIF_TX_SINGLE_PBUF   1
 #define DHCP_DOES_ARP_CHECK         0
@@ -8,6 +8,7 @@ CIRCUITPY_WIFI_RADIO_SETTABLE_MAC_ADDRESS = 0
 CIRCUITPY_ALARM ?= 1
 CIRCUITPY_RP2PIO ?= 1
 CIRCUITPY_NEOPIXEL_WRITE ?= $(CIRCUITPY_RP2PIO)
+CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND ?= $(CIRCUITPY_NEOPIXEL_WRITE)
 CIRCUITPY_FLOPPYIO ?= 1
 CIRCUITPY_FRAMEBUFFERIO ?= $(CIRCUITPY_DISPLAYIO)
 CIRCUITPY_FULL_BUILD ?= 1
@@ -20,7 +21,6 @@ CIRCUITPY_MEMORYMAP ?= 1
 CIRCUITPY_PWMIO ?= 1
 CIRCUITPY_RGBMATRIX ?= $(CIRCUITPY_DISPLAYIO)
 CIRCUITPY_ROTARYIO ?= 1
-CIRCUITPY_ROTARYIO_SOFTENCODER = 1
 CIRCUITPY_SYNTHIO_MAX_CHANNELS = 12
 CIRCUITPY_USB_HOST ?= 1
 CIRCUITPY_USB_VIDEO ?= 1
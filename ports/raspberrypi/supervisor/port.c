@@ -36,7 +36,9 @@
 #include "shared-bindings/busio/I2C.h"
 #include "shared-bindings/busio/SPI.h"
 #include "shared-bindings/countio/Counter.h"
+#include "shared-bindings/i2ctarget/I2CTarget.h"
 #include "shared-bindings/microcontroller/__init__.h"
+#include "shared-bindings/neopixel_write/__init__.h"
 #include "shared-bindings/rtc/__init__.h"
 
 #if CIRCUITPY_AUDIOCORE
@@ -176,6 +178,10 @@ safe_mode_t port_init(void) {
 }
 
 void reset_port(void) {
+    #if CIRCUITPY_I2CTARGET
+    reset_i2ctarget();
+    #endif
+
     #if CIRCUITPY_BUSIO
     reset_i2c();
     reset_spi();
@@ -186,6 +192,10 @@ void reset_port(void) {
     reset_countio();
     #endif
 
+    #if CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND
+    neopixel_write_reset();
+    #endif
+
     #if CIRCUITPY_RP2PIO
     reset_rp2pio_statemachine();
     #endif
@@ -270,6 +280,15 @@ uint64_t port_get_raw_ticks(uint8_t *subticks) {
     return 1024 * (microseconds / 1000000) + (microseconds % 1000000) / 977;
 }
 
+// The Cortex-M0+ has no cycle counter so use the microsecond timer instead.
+uint32_t port_get_cycle_count(void) {
+    return time_us_32();
+}
+
+uint32_t port_get_cycle_count_frequency(void) {
+    return 1000000;
+}
+
 STATIC void _tick_callback(uint alarm_num) {
     if (ticks_enabled) {
         supervisor_tick();
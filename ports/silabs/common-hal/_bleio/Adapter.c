@@ -25,6 +25,7 @@
  */
 
 #include <math.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
@@ -188,7 +189,8 @@ mp_obj_t common_hal_bleio_adapter_start_scan(bleio_adapter_obj_t *self,
     mp_float_t interval,
     mp_float_t window,
     mp_int_t minimum_rssi,
-    bool active) {
+    bool active,
+    const bleio_scan_filter_t *filter) {
 
     sl_status_t sc;
     uint64_t start_ticks = supervisor_ticks_ms64();
@@ -211,7 +213,8 @@ mp_obj_t common_hal_bleio_adapter_start_scan(bleio_adapter_obj_t *self,
     self->scan_results = shared_module_bleio_new_scanresults(buffer_size,
         prefixes,
         prefix_length,
-        minimum_rssi);
+        minimum_rssi,
+        filter);
     xscan_event = xEventGroupCreate();
     if (xscan_event != NULL) {
         xEventGroupClearBits(xscan_event, 1 << 0);
@@ -604,14 +607,26 @@ bool common_hal_bleio_adapter_is_bonded_to_central(bleio_adapter_obj_t *self) {
     return false;
 }
 
-void bleio_adapter_gc_collect(bleio_adapter_obj_t *adapter) {
-    // We divide by size_t so that we can scan each 32-bit aligned value to see
-    // if it is a pointer. This allows us to change the structs without worrying
-    // about collecting new pointers.
-    gc_collect_root((void **)adapter,
-        sizeof(bleio_adapter_obj_t) / (sizeof(size_t)));
-    gc_collect_root((void **)bleio_connections,
-        sizeof(bleio_connections) / (sizeof(size_t)));
+// Only these fields can point into the heap, so nothing else in the structs is traced.
+STATIC const uint16_t adapter_root_offsets[] = {
+    offsetof(bleio_adapter_obj_t, scan_results),
+    offsetof(bleio_adapter_obj_t, name),
+    offsetof(bleio_adapter_obj_t, connection_objs),
+};
+
+STATIC gc_root_t adapter_root = GC_ROOT(&common_hal_bleio_adapter_obj, bleio_adapter_obj_t, 1, adapter_root_offsets);
+
+STATIC const uint16_t connections_root_offsets[] = {
+    offsetof(bleio_connection_internal_t, remote_service_list),
+    offsetof(bleio_connection_internal_t, connection_obj),
+};
+
+STATIC gc_root_t connections_root = GC_ROOT(bleio_connections, bleio_connection_internal_t,
+    BLEIO_TOTAL_CONNECTION_COUNT, connections_root_offsets);
+
+void bleio_adapter_register_gc_roots(void) {
+    gc_root_register(&adapter_root);
+    gc_root_register(&connections_root);
 }
 
 // Reset the BLE adapter
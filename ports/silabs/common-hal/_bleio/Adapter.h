@@ -80,7 +80,7 @@ typedef struct {
 
 void set_scan_device_info_on_ble_evt(bd_addr address, uint8_t address_type,
     int8_t rssi, uint8array *data);
-void bleio_adapter_gc_collect(bleio_adapter_obj_t *adapter);
+void bleio_adapter_register_gc_roots(void);
 void bleio_adapter_reset(bleio_adapter_obj_t *adapter);
 void common_hal_bleio_adapter_remove_connection(uint8_t conn_handle);
 
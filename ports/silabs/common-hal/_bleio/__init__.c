@@ -80,8 +80,8 @@ void bleio_background(void) {
 
 }
 
-void common_hal_bleio_gc_collect(void) {
-    bleio_adapter_gc_collect(&common_hal_bleio_adapter_obj);
+void common_hal_bleio_register_gc_roots(void) {
+    bleio_adapter_register_gc_roots();
 }
 
 void check_ble_error(int error_code) {
@@ -123,6 +123,8 @@ void common_hal_canio_can_construct(canio_can_obj_t *self, const mcu_pin_obj_t *
     CAN_InitTypeDef init = {
         .AutoRetransmission = ENABLE,
         .AutoBusOff = ENABLE,
+        // Runs the counter that timestamps received messages
+        .TimeTriggeredMode = ENABLE,
         .Prescaler = divisor,
         .Mode = (loopback ? CAN_MODE_LOOPBACK : 0) | (silent ? CAN_MODE_SILENT_LOOPBACK : 0),
         .SyncJumpWidth = (sjw - 1) << CAN_BTR_SJW_Pos,
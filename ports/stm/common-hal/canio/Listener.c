@@ -266,44 +266,78 @@ int common_hal_canio_listener_in_waiting(canio_listener_obj_t *self) {
     return *(self->rfr) & CAN_RF0R_FMP0;
 }
 
-mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+STATIC bool wait_for_message(canio_listener_obj_t *self) {
     if (!common_hal_canio_listener_in_waiting(self)) {
         uint64_t deadline = supervisor_ticks_ms64() + self->timeout_ms;
         do {
             if (supervisor_ticks_ms64() > deadline) {
-                return NULL;
+                return false;
             }
             RUN_BACKGROUND_TASKS;
             // Allow user to break out of a timeout with a KeyboardInterrupt.
             if (mp_hal_is_interrupted()) {
-                return NULL;
+                return false;
             }
         } while (!common_hal_canio_listener_in_waiting(self));
     }
+    return true;
+}
 
+// Copy the message out of the FIFO's output mailbox and release it.
+STATIC void read_record(canio_listener_obj_t *self, canio_listener_record_t *record) {
     uint32_t rir = self->mailbox->RIR;
     uint32_t rdtr = self->mailbox->RDTR;
 
+    bool extended = rir & CAN_RI0R_IDE;
     bool rtr = rir & CAN_RI0R_RTR;
-    canio_message_obj_t *message =
-        mp_obj_malloc(canio_message_obj_t, rtr ? &canio_remote_transmission_request_type : &canio_message_type);
-    message->extended = rir & CAN_RI0R_IDE;
-    if (message->extended) {
-        message->id = rir >> 3;
+    if (extended) {
+        record->id = rir >> 3;
     } else {
-        message->id = rir >> 21;
+        record->id = rir >> 21;
     }
-    message->size = rdtr & CAN_RDT0R_DLC;
-    if (!rtr) {
+    record->timestamp = (rdtr & CAN_RDT0R_TIME) >> CAN_RDT0R_TIME_Pos;
+    record->flags = (extended ? CANIO_LISTENER_RECORD_EXTENDED : 0) | (rtr ? CANIO_LISTENER_RECORD_RTR : 0);
+    record->size = rdtr & CAN_RDT0R_DLC;
+    if (rtr) {
+        memset(record->data, 0, sizeof(record->data));
+    } else {
         uint32_t payload[] = { self->mailbox->RDLR, self->mailbox->RDHR };
-        MP_STATIC_ASSERT(sizeof(payload) == sizeof(message->data));
-        memcpy(message->data, payload, sizeof(payload));
+        MP_STATIC_ASSERT(sizeof(payload) == sizeof(record->data));
+        memcpy(record->data, payload, sizeof(payload));
     }
     // Release the mailbox
     SET_BIT(*self->rfr, CAN_RF0R_RFOM0);
+}
+
+mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+    if (!wait_for_message(self)) {
+        return NULL;
+    }
+    canio_listener_record_t record;
+    read_record(self, &record);
+    bool rtr = record.flags & CANIO_LISTENER_RECORD_RTR;
+    canio_message_obj_t *message =
+        mp_obj_malloc(canio_message_obj_t, rtr ? &canio_remote_transmission_request_type : &canio_message_type);
+    message->extended = record.flags & CANIO_LISTENER_RECORD_EXTENDED;
+    message->id = record.id;
+    message->size = record.size;
+    if (!rtr) {
+        memcpy(message->data, record.data, sizeof(message->data));
+    }
     return message;
 }
 
+size_t common_hal_canio_listener_receive_into(canio_listener_obj_t *self, canio_listener_record_t *records, size_t count) {
+    if (!wait_for_message(self)) {
+        return 0;
+    }
+    size_t n = 0;
+    while (n < count && common_hal_canio_listener_in_waiting(self)) {
+        read_record(self, &records[n++]);
+    }
+    return n;
+}
+
 void common_hal_canio_listener_deinit(canio_listener_obj_t *self) {
     if (self->can) {
         clear_filters(self);
@@ -170,3 +170,28 @@ digitalio_pull_t common_hal_digitalio_digitalinout_get_pull(
             return PULL_NONE;
     }
 }
+
+bool common_hal_digitalio_has_reg_op(digitalinout_reg_op_t op) {
+    return op != DIGITALINOUT_REG_TOGGLE;
+}
+
+volatile uint32_t *common_hal_digitalio_digitalinout_get_reg(digitalio_digitalinout_obj_t *self, digitalinout_reg_op_t op, uint32_t *mask) {
+    GPIO_TypeDef *port = pin_port(self->pin->port);
+
+    *mask = pin_mask(self->pin->number);
+
+    switch (op) {
+        case DIGITALINOUT_REG_READ:
+            return (volatile uint32_t *)&port->IDR;
+        case DIGITALINOUT_REG_WRITE:
+            return &port->ODR;
+        case DIGITALINOUT_REG_SET:
+            return &port->BSRR;
+        case DIGITALINOUT_REG_RESET:
+            // The upper half of BSRR resets the pins.
+            *mask <<= 16;
+            return &port->BSRR;
+        default:
+            return NULL;
+    }
+}
@@ -24,6 +24,7 @@
  * THE SOFTWARE.
  */
 #include <stdbool.h>
+#include <string.h>
 
 #include "shared-bindings/sdioio/SDCard.h"
 #include "py/mperrno.h"
@@ -123,6 +124,12 @@ void common_hal_sdioio_sdcard_construct(sdioio_sdcard_obj_t *self,
     const mcu_pin_obj_t *clock, const mcu_pin_obj_t *command,
     uint8_t num_data, const mcu_pin_obj_t **data, uint32_t frequency) {
 
+    // Allocate before claiming anything, in case the heap is full.
+    self->write_behind_data = m_malloc(SDIOIO_WRITE_BEHIND_BLOCKS * 512);
+    self->write_behind_block = m_malloc(SDIOIO_WRITE_BEHIND_BLOCKS * sizeof(uint32_t));
+    self->write_behind_head = 0;
+    self->write_behind_count = 0;
+
     int periph_index = check_pins(self, clock, command, num_data, data);
     SDIO_TypeDef *SDIOx = mcu_sdio_banks[periph_index - 1];
 
@@ -189,6 +196,8 @@ void common_hal_sdioio_sdcard_construct(sdioio_sdcard_obj_t *self,
         common_hal_mcu_pin_claim(data[i]);
     }
 
+    MP_STATE_VM(sdioio_write_behind_card) = self;
+
     return;
 }
 
@@ -230,13 +239,22 @@ STATIC void check_for_deinit(sdioio_sdcard_obj_t *self) {
     }
 }
 
-int common_hal_sdioio_sdcard_writeblocks(sdioio_sdcard_obj_t *self, uint32_t start_block, mp_buffer_info_t *bufinfo) {
-    check_for_deinit(self);
-    check_whole_block(bufinfo);
+STATIC bool card_busy(sdioio_sdcard_obj_t *self) {
+    if (self->state_programming) {
+        HAL_SD_CardStateTypedef st = HAL_SD_GetCardState(&self->handle);
+        if (st == HAL_SD_CARD_PROGRAMMING || st == HAL_SD_CARD_RECEIVING) {
+            return true;
+        }
+        self->state_programming = false;
+    }
+    return false;
+}
+
+STATIC int write_to_card(sdioio_sdcard_obj_t *self, uint32_t start_block, uint8_t *buf, uint32_t num_blocks) {
     wait_write_complete(self);
     self->state_programming = true;
     common_hal_mcu_disable_interrupts();
-    HAL_StatusTypeDef r = HAL_SD_WriteBlocks(&self->handle, bufinfo->buf, start_block, bufinfo->len / 512, 1000);
+    HAL_StatusTypeDef r = HAL_SD_WriteBlocks(&self->handle, buf, start_block, num_blocks, 1000);
     common_hal_mcu_enable_interrupts();
     if (r != HAL_OK) {
         return -EIO;
@@ -244,17 +262,112 @@ int common_hal_sdioio_sdcard_writeblocks(sdioio_sdcard_obj_t *self, uint32_t sta
     return 0;
 }
 
+// Ring index of the i-th oldest queued block.
+STATIC size_t write_behind_slot(sdioio_sdcard_obj_t *self, size_t i) {
+    size_t slot = self->write_behind_head + i;
+    return slot >= SDIOIO_WRITE_BEHIND_BLOCKS ? slot - SDIOIO_WRITE_BEHIND_BLOCKS : slot;
+}
+
+// Send the run of consecutive blocks at the head of the queue as one
+// multi-block write. The blocks leave the queue even if the write fails.
+STATIC int write_behind_send(sdioio_sdcard_obj_t *self) {
+    size_t head = self->write_behind_head;
+    uint32_t first = self->write_behind_block[head];
+    size_t n = 1;
+    while (n < self->write_behind_count && head + n < SDIOIO_WRITE_BEHIND_BLOCKS &&
+           self->write_behind_block[head + n] == first + n) {
+        n++;
+    }
+    int r = write_to_card(self, first, self->write_behind_data + head * 512, n);
+    // The run stops at the end of the ring, so this wraps to 0 at most.
+    head += n;
+    self->write_behind_head = head == SDIOIO_WRITE_BEHIND_BLOCKS ? 0 : head;
+    self->write_behind_count -= n;
+    return r;
+}
+
+// Send queued blocks for as long as the card is ready to take them.
+STATIC int write_behind_poll(sdioio_sdcard_obj_t *self) {
+    while (self->write_behind_count > 0 && !card_busy(self)) {
+        int r = write_behind_send(self);
+        if (r < 0) {
+            return r;
+        }
+    }
+    return 0;
+}
+
+int common_hal_sdioio_sdcard_sync(sdioio_sdcard_obj_t *self) {
+    check_for_deinit(self);
+    while (self->write_behind_count > 0) {
+        int r = write_behind_send(self);
+        if (r < 0) {
+            return r;
+        }
+    }
+    wait_write_complete(self);
+    return 0;
+}
+
+int common_hal_sdioio_sdcard_writeblocks(sdioio_sdcard_obj_t *self, uint32_t start_block, mp_buffer_info_t *bufinfo) {
+    check_for_deinit(self);
+    check_whole_block(bufinfo);
+    uint32_t num_blocks = bufinfo->len / 512;
+
+    // Writes too big to queue go straight to the card, after whatever is queued.
+    if (num_blocks > SDIOIO_WRITE_BEHIND_BLOCKS) {
+        int r = common_hal_sdioio_sdcard_sync(self);
+        if (r < 0) {
+            return r;
+        }
+        return write_to_card(self, start_block, bufinfo->buf, num_blocks);
+    }
+
+    // Queue the blocks and return, so that the caller does not wait while the
+    // card is busy programming. Only wait when the queue is full.
+    int r = write_behind_poll(self);
+    if (r < 0) {
+        return r;
+    }
+    const uint8_t *src = bufinfo->buf;
+    for (uint32_t i = 0; i < num_blocks; i++) {
+        if (self->write_behind_count == SDIOIO_WRITE_BEHIND_BLOCKS) {
+            r = write_behind_send(self);
+            if (r < 0) {
+                return r;
+            }
+        }
+        size_t slot = write_behind_slot(self, self->write_behind_count);
+        self->write_behind_block[slot] = start_block + i;
+        memcpy(self->write_behind_data + slot * 512, src + i * 512, 512);
+        self->write_behind_count++;
+    }
+    return 0;
+}
+
 int common_hal_sdioio_sdcard_readblocks(sdioio_sdcard_obj_t *self, uint32_t start_block, mp_buffer_info_t *bufinfo) {
     check_for_deinit(self);
     check_whole_block(bufinfo);
     wait_write_complete(self);
+    uint32_t num_blocks = bufinfo->len / 512;
     common_hal_mcu_disable_interrupts();
-    HAL_StatusTypeDef r = HAL_SD_ReadBlocks(&self->handle, bufinfo->buf, start_block, bufinfo->len / 512, 1000);
+    HAL_StatusTypeDef r = HAL_SD_ReadBlocks(&self->handle, bufinfo->buf, start_block, num_blocks, 1000);
     common_hal_mcu_enable_interrupts();
     if (r != HAL_OK) {
         return -EIO;
     }
-    return 0;
+
+    // Queued blocks are newer than what the card holds. Copy them oldest
+    // first so that the last write to a block wins.
+    uint8_t *dest = bufinfo->buf;
+    for (size_t i = 0; i < self->write_behind_count; i++) {
+        size_t slot = write_behind_slot(self, i);
+        uint32_t block = self->write_behind_block[slot];
+        if (block >= start_block && block - start_block < num_blocks) {
+            memcpy(dest + (block - start_block) * 512, self->write_behind_data + slot * 512, 512);
+        }
+    }
+    return write_behind_poll(self);
 }
 
 bool common_hal_sdioio_sdcard_configure(sdioio_sdcard_obj_t *self, uint32_t frequency, uint8_t bits) {
@@ -283,6 +396,13 @@ void common_hal_sdioio_sdcard_deinit(sdioio_sdcard_obj_t *self) {
         return;
     }
 
+    common_hal_sdioio_sdcard_sync(self);
+    self->write_behind_data = NULL;
+    self->write_behind_block = NULL;
+    if (MP_STATE_VM(sdioio_write_behind_card) == self) {
+        MP_STATE_VM(sdioio_write_behind_card) = NULL;
+    }
+
     reserved_sdio[self->command->periph_index - 1] = false;
     never_reset_sdio[self->command->periph_index - 1] = false;
 
@@ -318,9 +438,18 @@ void common_hal_sdioio_sdcard_never_reset(sdioio_sdcard_obj_t *self) {
 }
 
 void sdioio_reset() {
+    // Queued writes live on the heap, so send them before it goes away.
+    sdioio_sdcard_obj_t *card = MP_STATE_VM(sdioio_write_behind_card);
+    if (card != NULL && !common_hal_sdioio_sdcard_deinited(card)) {
+        common_hal_sdioio_sdcard_sync(card);
+    }
+    MP_STATE_VM(sdioio_write_behind_card) = NULL;
+
     for (size_t i = 0; i < MP_ARRAY_SIZE(reserved_sdio); i++) {
         if (!never_reset_sdio[i]) {
             reserved_sdio[i] = false;
         }
     }
 }
+
+MP_REGISTER_ROOT_POINTER(void *sdioio_write_behind_card);
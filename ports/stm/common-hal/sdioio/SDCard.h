@@ -33,6 +33,13 @@
 
 #include "py/obj.h"
 
+// Number of 512-byte blocks that writeblocks() may queue while the card is
+// still busy programming. The queue is allocated on the heap by the
+// constructor, so boards short on RAM may lower this, down to 1.
+#ifndef SDIOIO_WRITE_BEHIND_BLOCKS
+#define SDIOIO_WRITE_BEHIND_BLOCKS (16)
+#endif
+
 typedef struct {
     mp_obj_base_t base;
     SD_HandleTypeDef handle;
@@ -43,6 +50,11 @@ typedef struct {
     const mcu_periph_obj_t *data[4];
     uint32_t frequency;
     uint32_t capacity;
+    // Ring of queued blocks, oldest at write_behind_head.
+    uint8_t *write_behind_data;
+    uint32_t *write_behind_block;
+    uint16_t write_behind_head;
+    uint16_t write_behind_count;
 } sdioio_sdcard_obj_t;
 
 void sdioio_reset(void);
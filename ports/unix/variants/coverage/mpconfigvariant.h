@@ -41,6 +41,16 @@
 #define MICROPY_DEBUG_PARSE_RULE_NAME  (1)
 #define MICROPY_TRACKED_ALLOC          (1)
 #define MICROPY_WARNINGS_CATEGORY      (1)
+// CIRCUITPY-CHANGE
+#define MICROPY_PREALLOCATED_EXCEPTIONS (1)
+// CIRCUITPY-CHANGE: for memorymonitor.AllocationSites
+#define MICROPY_TRACK_CURRENT_CODE_STATE (1)
+// CIRCUITPY-CHANGE: test the FAT import_stat() cache
+#define MICROPY_VFS_FAT_IMPORT_STAT_CACHE (4)
+// CIRCUITPY-CHANGE: test loading deflate compressed .mpy files
+#define MICROPY_PERSISTENT_CODE_LOAD_COMPRESSED (1)
+// CIRCUITPY-CHANGE: test the decompressed message cache
+#define CIRCUITPY_TRANSLATE_CACHE (4)
 
 // CIRCUITPY-CHANGE: Disable things never used in circuitpython
 #define MICROPY_PY_CRYPTOLIB          (0)
@@ -31,6 +31,10 @@ SRC_BITMAP := \
 	shared-bindings/audiocore/__init__.c \
 	shared-bindings/audiocore/RawSample.c \
 	shared-bindings/audiocore/WaveFile.c \
+	shared-bindings/audiofx/__init__.c \
+	shared-bindings/audiofx/Chorus.c \
+	shared-bindings/audiofx/Delay.c \
+	shared-bindings/audiofx/Reverb.c \
 	shared-bindings/audiomixer/__init__.c \
 	shared-bindings/audiomixer/Mixer.c \
 	shared-bindings/audiomixer/MixerVoice.c \
@@ -43,8 +47,14 @@ SRC_BITMAP := \
 	shared-bindings/jpegio/__init__.c \
 	shared-bindings/jpegio/JpegDecoder.c \
 	shared-bindings/locale/__init__.c \
+	shared-bindings/memorymonitor/__init__.c \
+	shared-bindings/memorymonitor/AllocationAlarm.c \
+	shared-bindings/memorymonitor/AllocationSites.c \
+	shared-bindings/memorymonitor/AllocationSize.c \
+	shared-bindings/memorymonitor/HeapStats.c \
 	shared-bindings/rainbowio/__init__.c \
 	shared-bindings/struct/__init__.c \
+	shared-bindings/struct/Struct.c \
 	shared-bindings/synthio/__init__.c \
 	shared-bindings/synthio/Math.c \
 	shared-bindings/synthio/MidiTrack.c \
@@ -55,11 +65,16 @@ SRC_BITMAP := \
 	shared-bindings/traceback/__init__.c \
 	shared-bindings/util.c \
 	shared-bindings/zlib/__init__.c \
+	shared-bindings/zlib/Decompress.c \
 	shared-module/aesio/aes.c \
 	shared-module/aesio/__init__.c \
 	shared-module/audiocore/__init__.c \
 	shared-module/audiocore/RawSample.c \
 	shared-module/audiocore/WaveFile.c \
+	shared-module/audiofx/__init__.c \
+	shared-module/audiofx/Chorus.c \
+	shared-module/audiofx/Delay.c \
+	shared-module/audiofx/Reverb.c \
 	shared-module/audiomixer/__init__.c \
 	shared-module/audiomixer/Mixer.c \
 	shared-module/audiomixer/MixerVoice.c \
@@ -71,9 +86,15 @@ SRC_BITMAP := \
 	shared-module/displayio/Palette.c \
 	shared-module/jpegio/__init__.c \
 	shared-module/jpegio/JpegDecoder.c \
+	shared-module/memorymonitor/__init__.c \
+	shared-module/memorymonitor/AllocationAlarm.c \
+	shared-module/memorymonitor/AllocationSites.c \
+	shared-module/memorymonitor/AllocationSize.c \
+	shared-module/memorymonitor/HeapStats.c \
 	shared-module/os/getenv.c \
 	shared-module/rainbowio/__init__.c \
 	shared-module/struct/__init__.c \
+	shared-module/struct/Struct.c \
 	shared-module/synthio/__init__.c \
 	shared-module/synthio/Math.c \
 	shared-module/synthio/MidiTrack.c \
@@ -83,12 +104,14 @@ SRC_BITMAP := \
 	shared-module/synthio/Synthesizer.c \
 	shared-module/traceback/__init__.c \
 	shared-module/zlib/__init__.c \
+	shared-module/zlib/Decompress.c \
 
 SRC_C += $(SRC_BITMAP)
 
 CFLAGS += \
 	-DCIRCUITPY_AESIO=1 \
 	-DCIRCUITPY_AUDIOCORE=1 \
+	-DCIRCUITPY_AUDIOFX=1 \
 	-DCIRCUITPY_AUDIOMIXER=1 \
 	-DCIRCUITPY_AUDIOCORE_DEBUG=1 \
 	-DCIRCUITPY_BITMAPTOOLS=1 \
@@ -98,6 +121,8 @@ CFLAGS += \
 	-DCIRCUITPY_GIFIO=1 \
 	-DCIRCUITPY_JPEGIO=1 \
 	-DCIRCUITPY_LOCALE=1 \
+	-DCIRCUITPY_MEMORYMONITOR=1 \
+	-DCIRCUITPY_MEMORYMONITOR_ALLOCATION_SITES=1 \
 	-DCIRCUITPY_OS_GETENV=1 \
 	-DCIRCUITPY_RAINBOWIO=1 \
 	-DCIRCUITPY_STRUCT=1 \
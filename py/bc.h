@@ -223,6 +223,8 @@ typedef struct _mp_compiled_module_t {
     const struct _mp_raw_code_t *rc;
     #if MICROPY_PERSISTENT_CODE_SAVE
     bool has_native;
+    // CIRCUITPY-CHANGE
+    bool has_superinstructions;
     size_t n_qstr;
     size_t n_obj;
     #endif
@@ -249,8 +251,11 @@ typedef struct _mp_code_state_t {
     #if MICROPY_STACKLESS
     struct _mp_code_state_t *prev;
     #endif
-    #if MICROPY_PY_SYS_SETTRACE
+    // CIRCUITPY-CHANGE
+    #if MICROPY_TRACK_CURRENT_CODE_STATE
     struct _mp_code_state_t *prev_state;
+    #endif
+    #if MICROPY_PY_SYS_SETTRACE
     struct _mp_obj_frame_t *frame;
     #endif
     // Variable-length
@@ -159,4 +159,17 @@
 #define MP_BC_IMPORT_FROM                   (MP_BC_BASE_QSTR_O + 0x0c) // qstr
 #define MP_BC_IMPORT_STAR                   (MP_BC_BASE_BYTE_E + 0x09)
 
+// CIRCUITPY-CHANGE: superinstructions, see MICROPY_OPT_BC_SUPERINSTRUCTIONS.
+// Each one replaces a common opcode sequence with code of the same size, and
+// uses a slot that already has a trailing extra byte in the encoding rules.
+// Local numbers in the extra byte are 0-15 and packed as low | high << 4.
+#define MP_BC_LOAD_FAST_LOAD_FAST           (MP_BC_BASE_RESERVED + 0x00) // extra byte: local | local << 4
+#define MP_BC_STORE_FAST_LOAD_FAST          (MP_BC_BASE_RESERVED + 0x01) // extra byte: local | local << 4
+#define MP_BC_LOAD_FAST_LOAD_ATTR_MULTI     (MP_BC_BASE_QSTR_O + 0x0d) // qstr; local is the opcode's offset
+#define MP_BC_BINARY_OP_POP_JUMP_IF         (MP_BC_BASE_JUMP_E + 0x01) // signed relative bytecode offset; then a byte: op | jump_if_true << 7
+#define MP_BC_LOAD_FAST_LOAD_CONST_SMALL_INT (MP_BC_BASE_BYTE_E + 0x00) // extra byte: local | value << 4
+#define MP_BC_LOAD_FAST_LOAD_FAST_LOAD_SUBSCR (MP_BC_BASE_BYTE_E + 0x01) // extra byte: local | local << 4
+
+#define MP_BC_LOAD_FAST_LOAD_ATTR_MULTI_NUM (3)
+
 #endif // MICROPY_INCLUDED_PY_BC0_H
@@ -38,6 +38,12 @@
 #include "py/runtime.h"
 #include "py/builtin.h"
 #include "py/frozenmod.h"
+// CIRCUITPY-CHANGE: for the import cache
+#if MICROPY_MODULE_IMPORT_CACHE || MICROPY_MODULE_IMPORT_CACHE_WARM
+#include "py/reader.h"
+#include "py/stream.h"
+#include "extmod/vfs.h"
+#endif
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
 #define DEBUG_PRINT (1)
@@ -197,6 +203,200 @@ STATIC void do_execute_raw_code(const mp_module_context_t *context, const mp_raw
 }
 #endif
 
+// CIRCUITPY-CHANGE: cache compiled .py modules as .mpy files or in memory
+#if (MICROPY_MODULE_IMPORT_CACHE || MICROPY_MODULE_IMPORT_CACHE_WARM) && MICROPY_ENABLE_COMPILER
+
+#if !MICROPY_PERSISTENT_CODE_SAVE || !MICROPY_PERSISTENT_CODE_LOAD || !MICROPY_VFS
+#error "MICROPY_MODULE_IMPORT_CACHE requires MICROPY_PERSISTENT_CODE_SAVE, MICROPY_PERSISTENT_CODE_LOAD and MICROPY_VFS"
+#endif
+
+STATIC void import_cache_key(const char *source_path, byte *key) {
+    mp_obj_t stat = mp_vfs_stat(mp_obj_new_str(source_path, strlen(source_path)));
+    mp_obj_tuple_t *t = MP_OBJ_TO_PTR(stat);
+    uint32_t size = mp_obj_get_int_truncated(t->items[6]);
+    uint32_t mtime = mp_obj_get_int_truncated(t->items[8]);
+    for (size_t i = 0; i < 4; i++) {
+        key[i] = size >> (8 * i);
+        key[4 + i] = mtime >> (8 * i);
+    }
+}
+
+#if MICROPY_MODULE_IMPORT_CACHE
+// Each cache file starts with the size and mtime of the source it was compiled
+// from, followed by the .mpy data.
+
+typedef struct {
+    mp_obj_t file;
+    int errcode;
+} import_cache_writer_t;
+
+// The cache file for "/lib/foo/bar.py" is "lib.foo.bar.mpy" in the cache
+// directory, so the cache doesn't need subdirectories.
+STATIC void import_cache_path(vstr_t *cache_path, const char *source_path) {
+    vstr_add_str(cache_path, MICROPY_MODULE_IMPORT_CACHE_DIR PATH_SEP_CHAR);
+    while (*source_path == PATH_SEP_CHAR[0]) {
+        source_path++;
+    }
+    // Drop the ".py" extension.
+    size_t len = strlen(source_path) - 3;
+    for (size_t i = 0; i < len; i++) {
+        vstr_add_char(cache_path, source_path[i] == PATH_SEP_CHAR[0] ? '.' : source_path[i]);
+    }
+    vstr_add_str(cache_path, ".mpy");
+}
+
+// Returns false if there is no usable cache file for key.
+STATIC bool import_cache_load(const char *cache_path, const byte *key, mp_compiled_module_t *cm) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_reader_t reader;
+        mp_reader_new_file(&reader, cache_path);
+        bool up_to_date = true;
+        for (size_t i = 0; i < MP_IMPORT_CACHE_KEY_LEN; i++) {
+            if (reader.readbyte(reader.data) != key[i]) {
+                up_to_date = false;
+            }
+        }
+        if (!up_to_date) {
+            reader.close(reader.data);
+            nlr_pop();
+            return false;
+        }
+        // Closes the reader.
+        mp_raw_code_load(&reader, cm);
+        nlr_pop();
+        return true;
+    }
+    // Missing, truncated or from an incompatible version. It gets recompiled
+    // and overwritten.
+    return false;
+}
+
+STATIC void import_cache_write(void *env, const char *str, size_t len) {
+    import_cache_writer_t *writer = env;
+    if (writer->errcode == 0 &&
+        mp_stream_write_exactly(writer->file, str, len, &writer->errcode) != len &&
+        writer->errcode == 0) {
+        writer->errcode = MP_ENOSPC;
+    }
+}
+
+STATIC void import_cache_save(const char *cache_path, const byte *key, mp_compiled_module_t *cm) {
+    mp_obj_t path = mp_obj_new_str(cache_path, strlen(cache_path));
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_vfs_mkdir(MP_OBJ_NEW_QSTR(qstr_from_str(MICROPY_MODULE_IMPORT_CACHE_DIR)));
+        nlr_pop();
+    }
+
+    import_cache_writer_t writer = {MP_OBJ_NULL, 0};
+    if (nlr_push(&nlr) == 0) {
+        writer.file = mp_call_function_2(MP_OBJ_FROM_PTR(&mp_builtin_open_obj), path, MP_OBJ_NEW_QSTR(MP_QSTR_wb));
+        import_cache_write(&writer, (const char *)key, MP_IMPORT_CACHE_KEY_LEN);
+        mp_print_t print = {&writer, import_cache_write};
+        mp_raw_code_save(cm, &print);
+        mp_obj_t file = writer.file;
+        writer.file = MP_OBJ_NULL;
+        mp_stream_close(file);
+        if (writer.errcode != 0) {
+            mp_raise_OSError(writer.errcode);
+        }
+        nlr_pop();
+        return;
+    }
+
+    // Caching is best effort: the filesystem may be read-only (such as when
+    // it is shared over USB) or full. Don't leave a partial file behind.
+    if (nlr_push(&nlr) == 0) {
+        if (writer.file != MP_OBJ_NULL) {
+            mp_stream_close(writer.file);
+        }
+        mp_vfs_remove(path);
+        nlr_pop();
+    }
+}
+
+#endif
+
+#if MICROPY_MODULE_IMPORT_CACHE_WARM
+// Returns false if the port has no up to date data for file_str.
+STATIC bool import_cache_warm_load(const char *file_str, const byte *key, mp_compiled_module_t *cm) {
+    size_t len;
+    const byte *data = mp_import_cache_warm_lookup(file_str, key, &len);
+    if (data == NULL) {
+        return false;
+    }
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_raw_code_load_mem(data, len, cm);
+        nlr_pop();
+        return true;
+    }
+    return false;
+}
+
+STATIC void import_cache_warm_save(const char *file_str, const byte *key, mp_compiled_module_t *cm) {
+    vstr_t data;
+    mp_print_t print;
+    vstr_init_print(&data, 256, &print);
+    mp_raw_code_save(cm, &print);
+    mp_import_cache_warm_store(file_str, key, (const byte *)data.buf, data.len);
+    vstr_clear(&data);
+}
+#endif
+
+void mp_raw_code_load_file_cached(const char *file_str, mp_compiled_module_t *cm) {
+    byte key[MP_IMPORT_CACHE_KEY_LEN];
+    import_cache_key(file_str, key);
+
+    #if MICROPY_MODULE_IMPORT_CACHE_WARM
+    if (import_cache_warm_load(file_str, key, cm)) {
+        return;
+    }
+    #endif
+
+    #if MICROPY_MODULE_IMPORT_CACHE
+    vstr_t cache_path;
+    vstr_init(&cache_path, strlen(MICROPY_MODULE_IMPORT_CACHE_DIR) + strlen(file_str) + 3);
+    import_cache_path(&cache_path, file_str);
+    const char *cache_str = vstr_null_terminated_str(&cache_path);
+    bool loaded = import_cache_load(cache_str, key, cm);
+    #else
+    bool loaded = false;
+    #endif
+
+    if (!loaded) {
+        mp_lexer_t *lex = mp_lexer_new_from_file(file_str);
+        qstr source_name = lex->source_name;
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        mp_compile_to_raw_code(&parse_tree, source_name, false, cm);
+    }
+
+    // Native code isn't saved because it is already linked for this image.
+    if (!cm->has_native) {
+        #if MICROPY_MODULE_IMPORT_CACHE
+        if (!loaded) {
+            import_cache_save(cache_str, key, cm);
+        }
+        #endif
+        #if MICROPY_MODULE_IMPORT_CACHE_WARM
+        import_cache_warm_save(file_str, key, cm);
+        #endif
+    }
+
+    #if MICROPY_MODULE_IMPORT_CACHE
+    vstr_clear(&cache_path);
+    #endif
+}
+
+STATIC void do_load_with_import_cache(mp_module_context_t *context, const char *file_str) {
+    mp_compiled_module_t cm;
+    cm.context = context;
+    mp_raw_code_load_file_cached(file_str, &cm);
+    do_execute_raw_code(context, cm.rc, file_str);
+}
+#endif
+
 STATIC void do_load(mp_module_context_t *module_obj, vstr_t *file) {
     #if MICROPY_MODULE_FROZEN || MICROPY_ENABLE_COMPILER || (MICROPY_PERSISTENT_CODE_LOAD && MICROPY_HAS_FILE_READER)
     const char *file_str = vstr_null_terminated_str(file);
@@ -249,6 +449,11 @@ STATIC void do_load(mp_module_context_t *module_obj, vstr_t *file) {
     // If we can compile scripts then load the file and compile and execute it.
     #if MICROPY_ENABLE_COMPILER
     {
+        // CIRCUITPY-CHANGE
+        #if MICROPY_MODULE_IMPORT_CACHE || MICROPY_MODULE_IMPORT_CACHE_WARM
+        do_load_with_import_cache(module_obj, file_str);
+        return;
+        #endif
         mp_lexer_t *lex = mp_lexer_new_from_file(file_str);
         do_load_from_lexer(module_obj, lex);
         return;
@@ -128,6 +128,9 @@ endif
 ifeq ($(CIRCUITPY_AUDIOCORE),1)
 SRC_PATTERNS += audiocore/%
 endif
+ifeq ($(CIRCUITPY_AUDIOFX),1)
+SRC_PATTERNS += audiofx/%
+endif
 ifeq ($(CIRCUITPY_AUDIOMIXER),1)
 SRC_PATTERNS += audiomixer/%
 endif
@@ -540,6 +543,20 @@ SRC_C += \
 
 endif
 
+ifeq ($(CIRCUITPY_I2CTARGET),1)
+# Register file that the ports' I2CTarget interrupt handlers serve.
+SRC_C += \
+	shared-module/i2ctarget/RegisterFile.c \
+
+endif
+
+ifeq ($(CIRCUITPY_NVM),1)
+# Stages and trims writes before the ports' nvm.ByteArray programs flash.
+SRC_C += \
+	shared-module/nvm/ByteArray.c \
+
+endif
+
 SRC_COMMON_HAL = $(filter $(SRC_PATTERNS), $(SRC_COMMON_HAL_ALL))
 
 # These don't have corresponding files in each port but are still located in
@@ -552,6 +569,7 @@ $(filter $(SRC_PATTERNS), \
 	_bleio/ScanEntry.c \
 	_eve/__init__.c \
 	__future__/__init__.c \
+	audiocore/OutputStats.c \
 	camera/ImageFormat.c \
 	canio/Match.c \
 	codeop/__init__.c \
@@ -560,6 +578,7 @@ $(filter $(SRC_PATTERNS), \
 	digitalio/DriveMode.c \
 	digitalio/Pull.c \
 	displayio/Colorspace.c \
+	displayio/DisplayStats.c \
 	fontio/Glyph.c \
 	imagecapture/ParallelImageCapture.c \
 	locale/__init__.c \
@@ -604,6 +623,10 @@ SRC_SHARED_MODULE_ALL = \
 	audiocore/RawSample.c \
 	audiocore/WaveFile.c \
 	audiocore/__init__.c \
+	audiofx/Chorus.c \
+	audiofx/Delay.c \
+	audiofx/Reverb.c \
+	audiofx/__init__.c \
 	audioio/__init__.c \
 	audiomixer/Mixer.c \
 	audiomixer/MixerVoice.c \
@@ -626,6 +649,7 @@ SRC_SHARED_MODULE_ALL = \
 	canio/Match.c \
 	canio/Message.c \
 	canio/RemoteTransmissionRequest.c \
+	digitalio/PortGroup.c \
 	displayio/Bitmap.c \
 	displayio/ColorConverter.c \
 	displayio/Group.c \
@@ -666,9 +690,12 @@ SRC_SHARED_MODULE_ALL = \
 	keypad/Keys.c \
 	memorymonitor/__init__.c \
 	memorymonitor/AllocationAlarm.c \
+	memorymonitor/AllocationSites.c \
 	memorymonitor/AllocationSize.c \
+	memorymonitor/HeapStats.c \
 	network/__init__.c \
 	msgpack/__init__.c \
+	msgpack/Unpacker.c \
 	onewireio/__init__.c \
 	onewireio/OneWire.c \
 	os/__init__.c \
@@ -686,9 +713,12 @@ SRC_SHARED_MODULE_ALL = \
 	sharpdisplay/__init__.c \
 	socket/__init__.c \
 	storage/__init__.c \
+	storage/DataPartition.c \
 	struct/__init__.c \
+	struct/Struct.c \
 	supervisor/__init__.c \
 	supervisor/StatusBar.c \
+	supervisor/Stopwatch.c \
 	synthio/Biquad.c \
 	synthio/LFO.c \
 	synthio/Math.c \
@@ -713,6 +743,7 @@ SRC_SHARED_MODULE_ALL = \
 	warnings/__init__.c \
 	watchdog/__init__.c \
 	zlib/__init__.c \
+	zlib/Decompress.c \
 
 # All possible sources are listed here, and are filtered by SRC_PATTERNS.
 SRC_SHARED_MODULE = $(filter $(SRC_PATTERNS), $(SRC_SHARED_MODULE_ALL))
@@ -742,6 +773,11 @@ SRC_SHARED_MODULE_ALL += \
 	ssl/SSLSocket.c
 endif
 
+ifeq ($(CIRCUITPY_AUDIOBUSIO_I2S),1)
+SRC_COMMON_HAL_ALL += \
+	audiobusio/I2S.c
+endif
+
 ifeq ($(CIRCUITPY_KEYPAD_DEMUX),1)
 SRC_SHARED_MODULE_ALL += \
 	keypad_demux/__init__.c \
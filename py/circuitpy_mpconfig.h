@@ -63,11 +63,19 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_PY_OS_DUPTERM            (0)
 #define MICROPY_ROM_TEXT_COMPRESSION     (0)
 #define MICROPY_VFS_LFS1                 (0)
+// Turned on from the makefiles for CIRCUITPY_STORAGE_DATA_PARTITION_SIZE.
+#ifndef MICROPY_VFS_LFS2
 #define MICROPY_VFS_LFS2                 (0)
+#endif
 
 // Sorted alphabetically for easy finding.
 //
 // default is 128; consider raising to reduce fragmentation.
+// The whole module's parse tree stays alive until compilation finishes: the
+// compiler makes several passes over every scope, and a module level name's
+// kind (global, local or closed over) can depend on code later in the file.
+// Peak memory for importing a .py therefore grows with its size; libraries
+// too large for small boards should be shipped as .mpy files.
 #define MICROPY_ALLOC_PARSE_CHUNK_INIT   (16)
 // default is 512. Longest path in .py bundle as of June 6th, 2023 is 73 characters.
 #define MICROPY_ALLOC_PATH_MAX           (96)
@@ -77,8 +85,30 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_COMP_MODULE_CONST        (1)
 #define MICROPY_COMP_TRIPLE_TUPLE_ASSIGN (0)
 #define MICROPY_DEBUG_PRINTERS           (0)
-#define MICROPY_EMIT_INLINE_THUMB        (CIRCUITPY_ENABLE_MPY_NATIVE)
-#define MICROPY_EMIT_THUMB               (CIRCUITPY_ENABLE_MPY_NATIVE)
+// @micropython.native and @micropython.viper use the emitter for the CPU we're built for.
+// Cortex-M0+ lacks the Thumb-2 instructions the Thumb emitter uses by default.
+#if CIRCUITPY_ENABLE_MPY_NATIVE && defined(__thumb__)
+#define MICROPY_EMIT_INLINE_THUMB        (1)
+#define MICROPY_EMIT_THUMB               (1)
+#ifdef __thumb2__
+#define MICROPY_EMIT_THUMB_ARMV7M        (1)
+#else
+#define MICROPY_EMIT_THUMB_ARMV7M        (0)
+#endif
+#else
+#define MICROPY_EMIT_INLINE_THUMB        (0)
+#define MICROPY_EMIT_THUMB               (0)
+#endif
+#if CIRCUITPY_ENABLE_MPY_NATIVE && defined(__xtensa__)
+// ESP-IDF builds all Xtensa targets with the windowed ABI.
+#define MICROPY_EMIT_XTENSAWIN           (1)
+#endif
+#if CIRCUITPY_ENABLE_MPY_NATIVE
+#define MP_PLAT_COMMIT_EXEC(buf, len, reloc) supervisor_native_code_commit(buf, len, reloc)
+// Committed code lives outside the VM heap, so the GC can't see what it references.
+#define MICROPY_PERSISTENT_CODE_TRACK_BSS_RODATA (1)
+#include "supervisor/shared/native_code.h"
+#endif
 #define MICROPY_EMIT_X64                 (0)
 #define MICROPY_ENABLE_DOC_STRING        (0)
 #define MICROPY_ENABLE_FINALISER         (1)
@@ -90,11 +120,19 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_ERROR_REPORTING          (CIRCUITPY_FULL_BUILD ? MICROPY_ERROR_REPORTING_NORMAL : MICROPY_ERROR_REPORTING_TERSE)
 #define MICROPY_FLOAT_HIGH_QUALITY_HASH  (0)
 #define MICROPY_FLOAT_IMPL               (MICROPY_FLOAT_IMPL_FLOAT)
+#define MICROPY_FLOAT_POW10_TABLE        (1)
 #define MICROPY_GC_ALLOC_THRESHOLD       (0)
+#define MICROPY_GC_ARENA                 (CIRCUITPY_FULL_BUILD)
+#define MICROPY_GC_COMPACT               (CIRCUITPY_GC_COMPACT)
+#define MICROPY_GC_FREE_RUN_HINTS        (CIRCUITPY_FULL_BUILD ? 8 : 0)
+#define MICROPY_GC_INCREMENTAL_SWEEP     (CIRCUITPY_FULL_BUILD)
 #define MICROPY_GC_SPLIT_HEAP            (1)
 #define MICROPY_GC_SPLIT_HEAP_AUTO       (1)
+#define MICROPY_GEN_POOL                 (CIRCUITPY_FULL_BUILD)
 #define MP_PLAT_ALLOC_HEAP(size) port_malloc(size, false)
 #define MP_PLAT_FREE_HEAP(ptr) port_free(ptr)
+#define MP_PLAT_ALLOC_HEAP_FAST(size) port_malloc_fast(size)
+#define MP_PLAT_HEAP_IS_FAST(ptr) port_heap_is_fast(ptr)
 #include "supervisor/port_heap.h"
 #define MICROPY_HELPER_LEXER_UNIX        (0)
 #define MICROPY_HELPER_REPL              (1)
@@ -103,15 +141,25 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_MODULE_BUILTIN_INIT      (1)
 #define MICROPY_MODULE_BUILTIN_SUBPACKAGES (1)
 #define MICROPY_NONSTANDARD_TYPECODES    (0)
+#define MICROPY_OPT_BC_SUPERINSTRUCTIONS (CIRCUITPY_OPT_BC_SUPERINSTRUCTIONS)
 #define MICROPY_OPT_COMPUTED_GOTO        (1)
 #define MICROPY_OPT_COMPUTED_GOTO_SAVE_SPACE (CIRCUITPY_COMPUTED_GOTO_SAVE_SPACE)
 #define MICROPY_OPT_LOAD_ATTR_FAST_PATH  (CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH)
 #define MICROPY_OPT_MAP_LOOKUP_CACHE  (CIRCUITPY_OPT_MAP_LOOKUP_CACHE)
 #define MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE (CIRCUITPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE)
+#define MICROPY_OPT_INLINE_CACHE      (CIRCUITPY_OPT_INLINE_CACHE)
+#define MICROPY_OPT_VM_SMALL_INT_BINARY_OP (CIRCUITPY_OPT_VM_SMALL_INT_BINARY_OP)
 #define MICROPY_PERSISTENT_CODE_LOAD     (1)
+#define MICROPY_PERSISTENT_CODE_LOAD_ROM (CIRCUITPY_PERSISTENT_CODE_LOAD_ROM)
+#define MICROPY_PERSISTENT_CODE_LOAD_COMPRESSED (CIRCUITPY_ZLIB)
+#define MICROPY_PERSISTENT_CODE_SAVE     (CIRCUITPY_IMPORT_CACHE || CIRCUITPY_WARM_RELOAD)
+#define MICROPY_PREALLOCATED_EXCEPTIONS  (CIRCUITPY_PREALLOCATED_EXCEPTIONS)
+#define MICROPY_MODULE_IMPORT_CACHE      (CIRCUITPY_IMPORT_CACHE)
+#define MICROPY_MODULE_IMPORT_CACHE_WARM (CIRCUITPY_WARM_RELOAD)
 
 #define MICROPY_PY_ARRAY                 (CIRCUITPY_ARRAY)
 #define MICROPY_PY_ARRAY_SLICE_ASSIGN    (1)
+#define MICROPY_PY_ARRAY_BULK_OPS        (CIRCUITPY_ARRAY_BULK_OPS)
 #define MICROPY_PY_ATTRTUPLE             (1)
 #define MICROPY_PY_BUILTINS_BYTEARRAY    (1)
 #define MICROPY_PY_BUILTINS_BYTES_HEX    (1)
@@ -160,10 +208,12 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_PY___FILE__              (1)
 
 #define MICROPY_QSTR_BYTES_IN_HASH       (1)
+#define MICROPY_QSTR_INDEX               (CIRCUITPY_FULL_BUILD)
 #define MICROPY_REPL_AUTO_INDENT         (1)
 #define MICROPY_REPL_EVENT_DRIVEN        (0)
 #define MICROPY_STACK_CHECK              (1)
 #define MICROPY_STREAMS_NON_BLOCK        (1)
+#define MICROPY_TRACK_CURRENT_CODE_STATE (CIRCUITPY_SAMPLING_PROFILER || CIRCUITPY_MEMORYMONITOR_ALLOCATION_SITES)
 #ifndef MICROPY_USE_INTERNAL_PRINTF
 #define MICROPY_USE_INTERNAL_PRINTF      (1)
 #endif
@@ -194,7 +244,9 @@ extern void common_hal_mcu_enable_interrupts(void);
 
 #define BYTES_PER_WORD (4)
 
+#ifdef __thumb__
 #define MICROPY_MAKE_POINTER_CALLABLE(p) ((void *)((mp_uint_t)(p) | 1))
+#endif
 
 // Track stack usage. Expose results via ustack module.
 #define MICROPY_MAX_STACK_USAGE       (0)
@@ -270,6 +322,11 @@ typedef long mp_off_t;
 #define MICROPY_FATFS_EXFAT           (CIRCUITPY_FULL_BUILD)
 #endif
 
+// Imports probe several names in each directory on sys.path, and most don't exist.
+#ifndef MICROPY_VFS_FAT_IMPORT_STAT_CACHE
+#define MICROPY_VFS_FAT_IMPORT_STAT_CACHE (CIRCUITPY_FULL_BUILD ? 8 : 0)
+#endif
+
 #ifndef MICROPY_FATFS_MKFS_FAT32
 #define MICROPY_FATFS_MKFS_FAT32           (CIRCUITPY_FULL_BUILD)
 #endif
@@ -357,9 +414,16 @@ typedef long mp_off_t;
 #define CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE (128)
 #endif
 
+// Number of separate dirty rectangles a TileGrid tracks for set_tile() changes before it starts
+// merging them together. Each one costs a displayio_area_t per TileGrid.
+#ifndef CIRCUITPY_TILEGRID_DIRTY_AREAS
+#define CIRCUITPY_TILEGRID_DIRTY_AREAS (2)
+#endif
+
 #else
 #define CIRCUITPY_DISPLAY_LIMIT (0)
 #define CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE (0)
+#define CIRCUITPY_TILEGRID_DIRTY_AREAS (1)
 #endif
 
 // This is not a top-level module; it's microcontroller.nvm.
@@ -416,7 +480,17 @@ extern const struct _mp_obj_module_t nvm_module;
 #define MP_STATE_PORT MP_STATE_VM
 
 void background_callback_run_all(void);
+extern volatile bool background_callback_queued;
+// Ports whose port_background_task() does work must set this so that it runs
+// even when no background callback is queued.
+#ifndef CIRCUITPY_PORT_BACKGROUND_TASK
+#define CIRCUITPY_PORT_BACKGROUND_TASK (0)
+#endif
+#if CIRCUITPY_PORT_BACKGROUND_TASK
 #define RUN_BACKGROUND_TASKS (background_callback_run_all())
+#else
+#define RUN_BACKGROUND_TASKS do { if (background_callback_queued) { background_callback_run_all(); } } while (0)
+#endif
 
 #define MICROPY_VM_HOOK_LOOP RUN_BACKGROUND_TASKS;
 #define MICROPY_VM_HOOK_RETURN RUN_BACKGROUND_TASKS;
@@ -430,6 +504,13 @@ void background_callback_run_all(void);
 #define CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS 1000
 #endif
 
+// When 1, flushing a file on CIRCUITPY returns once the data is in the flash
+// cache, and background tasks write it out a page at a time. Only os.sync()
+// waits for it to reach the flash.
+#ifndef CIRCUITPY_FILESYSTEM_WRITE_BEHIND
+#define CIRCUITPY_FILESYSTEM_WRITE_BEHIND (0)
+#endif
+
 #ifndef CIRCUITPY_PYSTACK_SIZE
 #define CIRCUITPY_PYSTACK_SIZE 1536
 #endif
@@ -441,6 +522,11 @@ void background_callback_run_all(void);
 #define CIRCUITPY_HEAP_START_SIZE (8 * 1024)
 #endif
 
+// Bytes of compiled modules that CIRCUITPY_WARM_RELOAD keeps across soft reloads.
+#ifndef CIRCUITPY_WARM_RELOAD_CACHE_SIZE
+#define CIRCUITPY_WARM_RELOAD_CACHE_SIZE (32 * 1024)
+#endif
+
 // How much of the c stack we leave to ensure we can process exceptions.
 #ifndef CIRCUITPY_EXCEPTION_STACK_SIZE
 #define CIRCUITPY_EXCEPTION_STACK_SIZE 1024
@@ -546,6 +632,13 @@ void background_callback_run_all(void);
 #error "CIRCUITPY_USB_HID_MAX_REPORT_IDS_PER_DESCRIPTOR must be at least 1"
 #endif
 
+// Reports sent while the HID IN endpoint is busy, shared by all HID devices.
+#ifndef CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH
+#define CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH (4)
+#elif CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH < 1 || CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH > 255
+#error "CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH must be between 1 and 255"
+#endif
+
 #ifndef USB_MIDI_EP_NUM_OUT
 #define USB_MIDI_EP_NUM_OUT (0)
 #endif
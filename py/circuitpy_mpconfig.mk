@@ -90,6 +90,11 @@ CFLAGS += -DMICROPY_PY_SELECT_SELECT=$(MICROPY_PY_SELECT_SELECT)
 CIRCUITPY_AESIO ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_AESIO=$(CIRCUITPY_AESIO)
 
+# Use the port's mbedtls for aesio instead of the built-in software AES, so
+# ports whose mbedtls drives an AES peripheral get hardware acceleration.
+CIRCUITPY_AESIO_MBEDTLS ?= 0
+CFLAGS += -DCIRCUITPY_AESIO_MBEDTLS=$(CIRCUITPY_AESIO_MBEDTLS)
+
 # TODO: CIRCUITPY_ALARM will gradually be added to as many ports as possible
 # so make this 1 or CIRCUITPY_FULL_BUILD eventually
 CIRCUITPY_ALARM ?= 0
@@ -104,6 +109,9 @@ CFLAGS += -DCIRCUITPY_ANALOGIO=$(CIRCUITPY_ANALOGIO)
 CIRCUITPY_ARRAY ?= 1
 CFLAGS += -DCIRCUITPY_ARRAY=$(CIRCUITPY_ARRAY)
 
+CIRCUITPY_ARRAY_BULK_OPS ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_ARRAY_BULK_OPS=$(CIRCUITPY_ARRAY_BULK_OPS)
+
 CIRCUITPY_ATEXIT ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_ATEXIT=$(CIRCUITPY_ATEXIT)
 
@@ -118,6 +126,10 @@ CFLAGS += -DCIRCUITPY_AUDIOBUSIO_I2SOUT=$(CIRCUITPY_AUDIOBUSIO_I2SOUT)
 CIRCUITPY_AUDIOBUSIO_PDMIN ?= $(CIRCUITPY_AUDIOBUSIO)
 CFLAGS += -DCIRCUITPY_AUDIOBUSIO_PDMIN=$(CIRCUITPY_AUDIOBUSIO_PDMIN)
 
+# Full duplex raw streaming. Ports opt in.
+CIRCUITPY_AUDIOBUSIO_I2S ?= 0
+CFLAGS += -DCIRCUITPY_AUDIOBUSIO_I2S=$(CIRCUITPY_AUDIOBUSIO_I2S)
+
 CIRCUITPY_AUDIOIO ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_AUDIOIO=$(CIRCUITPY_AUDIOIO)
 
@@ -127,6 +139,9 @@ CFLAGS += -DCIRCUITPY_AUDIOPWMIO=$(CIRCUITPY_AUDIOPWMIO)
 CIRCUITPY_AUDIOCORE ?= $(call enable-if-any,$(CIRCUITPY_AUDIOPWMIO) $(CIRCUITPY_AUDIOIO) $(CIRCUITPY_AUDIOBUSIO))
 CFLAGS += -DCIRCUITPY_AUDIOCORE=$(CIRCUITPY_AUDIOCORE)
 
+CIRCUITPY_AUDIOFX ?= $(call enable-if-all,$(CIRCUITPY_FULL_BUILD) $(CIRCUITPY_AUDIOCORE))
+CFLAGS += -DCIRCUITPY_AUDIOFX=$(CIRCUITPY_AUDIOFX)
+
 CIRCUITPY_AUDIOMIXER ?= $(CIRCUITPY_AUDIOCORE)
 CFLAGS += -DCIRCUITPY_AUDIOMIXER=$(CIRCUITPY_AUDIOMIXER)
 
@@ -168,6 +183,10 @@ CFLAGS += -DCIRCUITPY_BLE_FILE_SERVICE=$(CIRCUITPY_BLE_FILE_SERVICE)
 CIRCUITPY_BOARD ?= 1
 CFLAGS += -DCIRCUITPY_BOARD=$(CIRCUITPY_BOARD)
 
+# Record when each startup phase finishes, for supervisor.runtime.boot_trace
+CIRCUITPY_BOOT_TRACE ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_BOOT_TRACE=$(CIRCUITPY_BOOT_TRACE)
+
 CIRCUITPY_BUSDEVICE ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_BUSDEVICE=$(CIRCUITPY_BUSDEVICE)
 
@@ -207,6 +226,9 @@ CFLAGS += -DCIRCUITPY_CYW43=$(CIRCUITPY_CYW43)
 CIRCUITPY_DIGITALIO ?= 1
 CFLAGS += -DCIRCUITPY_DIGITALIO=$(CIRCUITPY_DIGITALIO)
 
+CIRCUITPY_DIGITALIO_PORTGROUP ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_DIGITALIO_PORTGROUP=$(CIRCUITPY_DIGITALIO_PORTGROUP)
+
 CIRCUITPY_COPROC ?= 0
 CFLAGS += -DCIRCUITPY_COPROC=$(CIRCUITPY_COPROC)
 
@@ -249,10 +271,25 @@ CFLAGS += -DCIRCUITPY_VECTORIO=$(CIRCUITPY_VECTORIO)
 CIRCUITPY_DUALBANK ?= 0
 CFLAGS += -DCIRCUITPY_DUALBANK=$(CIRCUITPY_DUALBANK)
 
-# Enabled micropython.native decorator (experimental)
+# Enable the micropython.native and micropython.viper decorators and native .mpy files.
+# Supported on Cortex-M and Xtensa.
 CIRCUITPY_ENABLE_MPY_NATIVE ?= 0
 CFLAGS += -DCIRCUITPY_ENABLE_MPY_NATIVE=$(CIRCUITPY_ENABLE_MPY_NATIVE)
 
+# Bytes of RAM the linker script reserves for emitted machine code. 0 takes code space
+# from the supervisor heap instead.
+CIRCUITPY_NATIVE_CODE_RAM_SIZE ?= 0
+CFLAGS += -DCIRCUITPY_NATIVE_CODE_RAM_SIZE=$(CIRCUITPY_NATIVE_CODE_RAM_SIZE)
+
+# Largest machine code, in bytes, allowed for one native or viper function.
+CIRCUITPY_NATIVE_FUNCTION_MAX_SIZE ?= 4096
+CFLAGS += -DCIRCUITPY_NATIVE_FUNCTION_MAX_SIZE=$(CIRCUITPY_NATIVE_FUNCTION_MAX_SIZE)
+
+# Largest relocatable machine code, in bytes, allowed from a native .mpy file. A dynamic
+# native module built with py/dynruntime.mk is loaded as one block of this kind.
+CIRCUITPY_NATIVE_MODULE_MAX_SIZE ?= 32768
+CFLAGS += -DCIRCUITPY_NATIVE_MODULE_MAX_SIZE=$(CIRCUITPY_NATIVE_MODULE_MAX_SIZE)
+
 CIRCUITPY_OS_GETENV ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_OS_GETENV=$(CIRCUITPY_OS_GETENV)
 
@@ -288,6 +325,10 @@ CFLAGS += -DCIRCUITPY_FREQUENCYIO=$(CIRCUITPY_FREQUENCYIO)
 CIRCUITPY_FUTURE ?= 1
 CFLAGS += -DCIRCUITPY_FUTURE=$(CIRCUITPY_FUTURE)
 
+# Move buffers to make room when an allocation would otherwise fail.
+CIRCUITPY_GC_COMPACT ?= 0
+CFLAGS += -DCIRCUITPY_GC_COMPACT=$(CIRCUITPY_GC_COMPACT)
+
 CIRCUITPY_GETPASS ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_GETPASS=$(CIRCUITPY_GETPASS)
 
@@ -313,6 +354,10 @@ CFLAGS += -DCIRCUITPY_I2CTARGET=$(CIRCUITPY_I2CTARGET)
 CIRCUITPY_IMAGECAPTURE ?= 0
 CFLAGS += -DCIRCUITPY_IMAGECAPTURE=$(CIRCUITPY_IMAGECAPTURE)
 
+# Save compiled .py imports as .mpy files in /.mpycache and reuse them while the source is unchanged
+CIRCUITPY_IMPORT_CACHE ?= 0
+CFLAGS += -DCIRCUITPY_IMPORT_CACHE=$(CIRCUITPY_IMPORT_CACHE)
+
 # io - needed by JSON support
 CIRCUITPY_IO ?= $(CIRCUITPY_JSON)
 CFLAGS += -DCIRCUITPY_IO=$(CIRCUITPY_IO)
@@ -360,6 +405,11 @@ CFLAGS += -DCIRCUITPY_MEMORYMAP=$(CIRCUITPY_MEMORYMAP)
 CIRCUITPY_MEMORYMONITOR ?= 0
 CFLAGS += -DCIRCUITPY_MEMORYMONITOR=$(CIRCUITPY_MEMORYMONITOR)
 
+# Sampled allocation-site recording in memorymonitor. Needs the VM to track the
+# running frame.
+CIRCUITPY_MEMORYMONITOR_ALLOCATION_SITES ?= 0
+CFLAGS += -DCIRCUITPY_MEMORYMONITOR_ALLOCATION_SITES=$(CIRCUITPY_MEMORYMONITOR_ALLOCATION_SITES)
+
 CIRCUITPY_MICROCONTROLLER ?= 1
 CFLAGS += -DCIRCUITPY_MICROCONTROLLER=$(CIRCUITPY_MICROCONTROLLER)
 
@@ -372,18 +422,31 @@ CFLAGS += -DCIRCUITPY_MSGPACK=$(CIRCUITPY_MSGPACK)
 CIRCUITPY_NEOPIXEL_WRITE ?= 1
 CFLAGS += -DCIRCUITPY_NEOPIXEL_WRITE=$(CIRCUITPY_NEOPIXEL_WRITE)
 
+# Whether neopixel_write(..., background=True) can return before the data is sent
+CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND ?= 0
+CFLAGS += -DCIRCUITPY_NEOPIXEL_WRITE_BACKGROUND=$(CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND)
+
 CIRCUITPY_NVM ?= 1
 CFLAGS += -DCIRCUITPY_NVM=$(CIRCUITPY_NVM)
 
 CIRCUITPY_ONEWIREIO ?= $(CIRCUITPY_BUSIO)
 CFLAGS += -DCIRCUITPY_ONEWIREIO=$(CIRCUITPY_ONEWIREIO)
 
+CIRCUITPY_OPT_BC_SUPERINSTRUCTIONS ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_BC_SUPERINSTRUCTIONS=$(CIRCUITPY_OPT_BC_SUPERINSTRUCTIONS)
+
 CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH ?= 1
 CFLAGS += -DCIRCUITPY_OPT_LOAD_ATTR_FAST_PATH=$(CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH)
 
+CIRCUITPY_OPT_INLINE_CACHE ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_INLINE_CACHE=$(CIRCUITPY_OPT_INLINE_CACHE)
+
 CIRCUITPY_OPT_MAP_LOOKUP_CACHE ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_OPT_MAP_LOOKUP_CACHE=$(CIRCUITPY_OPT_MAP_LOOKUP_CACHE)
 
+CIRCUITPY_OPT_VM_SMALL_INT_BINARY_OP ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_VM_SMALL_INT_BINARY_OP=$(CIRCUITPY_OPT_VM_SMALL_INT_BINARY_OP)
+
 CIRCUITPY_OS ?= 1
 CFLAGS += -DCIRCUITPY_OS=$(CIRCUITPY_OS)
 
@@ -392,6 +455,11 @@ CFLAGS += -DCIRCUITPY_PEW=$(CIRCUITPY_PEW)
 
 # CIRCUITPY_PICODVI is handled in the raspberrypi tree.
 # Only for RP2 chips. Assume not a raspberrypi build.
+# Load .mpy files from memory-mapped (XIP) storage in place instead of copying
+# their bytecode and constants to the heap; needs a VFS whose files expose a buffer
+CIRCUITPY_PERSISTENT_CODE_LOAD_ROM ?= 0
+CFLAGS += -DCIRCUITPY_PERSISTENT_CODE_LOAD_ROM=$(CIRCUITPY_PERSISTENT_CODE_LOAD_ROM)
+
 CIRCUITPY_PICODVI ?= 0
 CFLAGS += -DCIRCUITPY_PICODVI=$(CIRCUITPY_PICODVI)
 
@@ -401,6 +469,11 @@ CFLAGS += -DCIRCUITPY_PIXELBUF=$(CIRCUITPY_PIXELBUF)
 CIRCUITPY_PIXELMAP ?= $(CIRCUITPY_PIXELBUF)
 CFLAGS += -DCIRCUITPY_PIXELMAP=$(CIRCUITPY_PIXELMAP)
 
+# Reuse preallocated StopIteration() and OSError(ETIMEDOUT/EAGAIN) instances so
+# polling loops don't allocate; off by default because the instances are shared.
+CIRCUITPY_PREALLOCATED_EXCEPTIONS ?= 0
+CFLAGS += -DCIRCUITPY_PREALLOCATED_EXCEPTIONS=$(CIRCUITPY_PREALLOCATED_EXCEPTIONS)
+
 # Only for SAMD boards for the moment
 CIRCUITPY_PS2IO ?= 0
 CFLAGS += -DCIRCUITPY_PS2IO=$(CIRCUITPY_PS2IO)
@@ -450,6 +523,22 @@ CFLAGS += -DCIRCUITPY_RTC=$(CIRCUITPY_RTC)
 CIRCUITPY_SAFEMODE_PY ?= 1
 CFLAGS += -DCIRCUITPY_SAFEMODE_PY=$(CIRCUITPY_SAFEMODE_PY)
 
+# Lower the CPU frequency while the VM is mostly idle. Needs port support.
+CIRCUITPY_CPU_GOVERNOR ?= 0
+CFLAGS += -DCIRCUITPY_CPU_GOVERNOR=$(CIRCUITPY_CPU_GOVERNOR)
+
+# Sample the running Python function on each tick, for supervisor.runtime.profile_samples
+CIRCUITPY_SAMPLING_PROFILER ?= 0
+CFLAGS += -DCIRCUITPY_SAMPLING_PROFILER=$(CIRCUITPY_SAMPLING_PROFILER)
+
+# Time each background callback, for supervisor.runtime.background_task_stats
+CIRCUITPY_BACKGROUND_TASK_STATS ?= 0
+CFLAGS += -DCIRCUITPY_BACKGROUND_TASK_STATS=$(CIRCUITPY_BACKGROUND_TASK_STATS)
+
+# Keep network stack counters for wifi.Radio.stats and socketpool.Socket.stats. Needs port support.
+CIRCUITPY_NETWORK_STATS ?= 0
+CFLAGS += -DCIRCUITPY_NETWORK_STATS=$(CIRCUITPY_NETWORK_STATS)
+
 # CIRCUITPY_SAMD is handled in the atmel-samd tree.
 # Only for SAMD chips.
 # Assume not a SAMD build.
@@ -498,6 +587,16 @@ CFLAGS += -DCIRCUITPY_STORAGE=$(CIRCUITPY_STORAGE)
 CIRCUITPY_STORAGE_EXTEND ?= $(CIRCUITPY_DUALBANK)
 CFLAGS += -DCIRCUITPY_STORAGE_EXTEND=$(CIRCUITPY_STORAGE_EXTEND)
 
+# Bytes at the end of the flash filesystem area to keep out of CIRCUITPY, for
+# storage.DataPartition. Must be a multiple of 4096. Turns on littlefs so that
+# the partition can be mounted with storage.VfsLfs2. CIRCUITPY shrinks by the
+# same amount, so changing it needs storage.erase_filesystem().
+CIRCUITPY_STORAGE_DATA_PARTITION_SIZE ?= 0
+CFLAGS += -DCIRCUITPY_STORAGE_DATA_PARTITION_SIZE=$(CIRCUITPY_STORAGE_DATA_PARTITION_SIZE)
+ifneq ($(CIRCUITPY_STORAGE_DATA_PARTITION_SIZE),0)
+MICROPY_VFS_LFS2 = 1
+endif
+
 CIRCUITPY_STRUCT ?= 1
 CFLAGS += -DCIRCUITPY_STRUCT=$(CIRCUITPY_STRUCT)
 
@@ -533,6 +632,15 @@ CFLAGS += -DCIRCUITPY_TOUCHIO=$(CIRCUITPY_TOUCHIO)
 CIRCUITPY_TRACEBACK ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_TRACEBACK=$(CIRCUITPY_TRACEBACK)
 
+# Number of recently decompressed message strings to keep. Each entry takes about 70
+# bytes of RAM.
+ifeq ($(CIRCUITPY_FULL_BUILD),1)
+CIRCUITPY_TRANSLATE_CACHE ?= 4
+else
+CIRCUITPY_TRANSLATE_CACHE ?= 0
+endif
+CFLAGS += -DCIRCUITPY_TRANSLATE_CACHE=$(CIRCUITPY_TRANSLATE_CACHE)
+
 # For debugging.
 CIRCUITPY_UHEAP ?= 0
 CFLAGS += -DCIRCUITPY_UHEAP=$(CIRCUITPY_UHEAP)
@@ -624,6 +732,10 @@ CFLAGS += -DCIRCUITPY_VIDEOCORE=$(CIRCUITPY_VIDEOCORE)
 CIRCUITPY_WARNINGS ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_WARNINGS=$(CIRCUITPY_WARNINGS)
 
+# Keep compiled .py imports in memory across soft reloads and reuse them while the source is unchanged
+CIRCUITPY_WARM_RELOAD ?= 0
+CFLAGS += -DCIRCUITPY_WARM_RELOAD=$(CIRCUITPY_WARM_RELOAD)
+
 # watchdog hardware support
 CIRCUITPY_WATCHDOG ?= 0
 CFLAGS += -DCIRCUITPY_WATCHDOG=$(CIRCUITPY_WATCHDOG)
@@ -669,6 +781,11 @@ $(error LONGINT_IMPL set to surprising value: "$(LONGINT_IMPL)")
 endif
 MPY_TOOL_FLAGS += $(MPY_TOOL_LONGINT_IMPL)
 
+# Frozen modules can use superinstructions when the firmware executes them.
+ifeq ($(CIRCUITPY_OPT_BC_SUPERINSTRUCTIONS),1)
+MPY_CROSS_FLAGS += -msuperinstructions
+endif
+
 ###
 ifeq ($(LONGINT_IMPL),NONE)
 else ifeq ($(LONGINT_IMPL),MPZ)
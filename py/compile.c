@@ -3607,6 +3607,8 @@ void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool
     cm->rc = module_scope->raw_code;
     #if MICROPY_PERSISTENT_CODE_SAVE
     cm->has_native = false;
+    // CIRCUITPY-CHANGE
+    cm->has_superinstructions = MP_EMIT_BC_SUPERINSTRUCTIONS;
     #if MICROPY_EMIT_NATIVE
     if (emit_native != NULL) {
         cm->has_native = true;
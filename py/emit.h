@@ -46,6 +46,19 @@ typedef enum {
     MP_PASS_EMIT = 4,       // emit code (may be run multiple times if the emitter requests it)
 } pass_kind_t;
 
+// CIRCUITPY-CHANGE
+// Whether the bytecode emitter fuses opcodes into superinstructions. They hide
+// opcode boundaries from sys.settrace, so tracing builds don't emit them.
+#if MICROPY_OPT_BC_SUPERINSTRUCTIONS && !MICROPY_PY_SYS_SETTRACE
+#if MICROPY_DYNAMIC_COMPILER
+#define MP_EMIT_BC_SUPERINSTRUCTIONS (mp_dynamic_compiler.superinstructions)
+#else
+#define MP_EMIT_BC_SUPERINSTRUCTIONS (1)
+#endif
+#else
+#define MP_EMIT_BC_SUPERINSTRUCTIONS (0)
+#endif
+
 #define MP_EMIT_STAR_FLAG_SINGLE (0x01)
 #define MP_EMIT_STAR_FLAG_DOUBLE (0x02)
 
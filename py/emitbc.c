@@ -64,6 +64,17 @@ struct _emit_t {
     size_t max_num_labels;
     size_t *label_offsets;
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_BC_JUMP_THREADING
+    // label_targets[l] is where a jump to label l can go instead: the target
+    // of the unconditional jump that directly follows l, or else l itself.
+    // It is worked out in the stack-size pass, during which the labels
+    // assigned at the current offset are linked through it, starting from
+    // pending_labels.
+    size_t *label_targets;
+    size_t pending_labels;
+    #endif
+
     size_t code_info_offset;
     size_t code_info_size;
     size_t bytecode_offset;
@@ -73,6 +84,16 @@ struct _emit_t {
 
     size_t n_info;
     size_t n_cell;
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+    // The last opcode written, if the next one may be fused with it into a
+    // superinstruction: its offset, the opcode, and its extra byte if any.
+    // fuse_op is -1 when there is nothing to fuse with.
+    size_t fuse_offset;
+    int fuse_op;
+    byte fuse_arg;
+    #endif
 };
 
 emit_t *emit_bc_new(mp_emit_common_t *emit_common) {
@@ -84,10 +105,18 @@ emit_t *emit_bc_new(mp_emit_common_t *emit_common) {
 void emit_bc_set_max_num_labels(emit_t *emit, mp_uint_t max_num_labels) {
     emit->max_num_labels = max_num_labels;
     emit->label_offsets = m_new(size_t, emit->max_num_labels);
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_BC_JUMP_THREADING
+    emit->label_targets = m_new(size_t, emit->max_num_labels);
+    #endif
 }
 
 void emit_bc_free(emit_t *emit) {
     m_del(size_t, emit->label_offsets, emit->max_num_labels);
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_BC_JUMP_THREADING
+    m_del(size_t, emit->label_targets, emit->max_num_labels);
+    #endif
     m_del_obj(emit_t, emit);
 }
 
@@ -142,9 +171,47 @@ STATIC void emit_write_code_info_bytes_lines(emit_t *emit, mp_uint_t bytes_to_sk
 }
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_BC_JUMP_THREADING
+#define NO_PENDING_LABELS ((size_t)-1)
+
+STATIC bool emit_bc_jump_threading(void) {
+    return MP_STATE_VM(mp_optimise_value) >= 2;
+}
+
+// Set the target of the labels assigned at the current offset, in the
+// stack-size pass: the opcode about to be written follows all of them.
+STATIC void emit_bc_resolve_pending_labels(emit_t *emit, bool is_jump, mp_uint_t jump_label) {
+    while (emit->pending_labels != NO_PENDING_LABELS) {
+        size_t l = emit->pending_labels;
+        emit->pending_labels = emit->label_targets[l];
+        emit->label_targets[l] = is_jump ? jump_label : l;
+    }
+}
+
+// Follow a chain of jumps to its end. The number of steps is bounded because
+// the chain can be a loop, such as "while True: pass".
+STATIC mp_uint_t emit_bc_thread_jump(emit_t *emit, mp_uint_t label) {
+    for (size_t n = 0; n < 8 && emit->label_targets[label] != label; ++n) {
+        label = emit->label_targets[label];
+    }
+    return label;
+}
+#endif
+
 // all functions must go through this one to emit byte code
 STATIC uint8_t *emit_get_cur_to_write_bytecode(void *emit_in, size_t num_bytes_to_write) {
     emit_t *emit = emit_in;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_BC_JUMP_THREADING
+    if (emit->pending_labels != NO_PENDING_LABELS) {
+        emit_bc_resolve_pending_labels(emit, false, 0);
+    }
+    #endif
+    // CIRCUITPY-CHANGE: any opcode written ends the chance to fuse with the last one
+    #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+    emit->fuse_op = -1;
+    #endif
     if (emit->suppress) {
         return emit->dummy_data;
     }
@@ -170,6 +237,30 @@ STATIC void emit_write_bytecode_byte(emit_t *emit, int stack_adj, byte b1) {
     c[0] = b1;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+// Note that the opcode just written, starting at offset, may be fused with
+// the next one.  The decision depends only on the opcode sequence, so it is
+// the same on every pass and the code size stays consistent between passes.
+STATIC void emit_bc_set_fuse_candidate(emit_t *emit, size_t offset, int op, byte arg) {
+    if (MP_EMIT_BC_SUPERINSTRUCTIONS && !emit->suppress) {
+        emit->fuse_offset = offset;
+        emit->fuse_op = op;
+        emit->fuse_arg = arg;
+    }
+}
+
+// Rewind over the fuse candidate so a superinstruction can be written in its place.
+STATIC void emit_bc_rewind_fuse_candidate(emit_t *emit) {
+    emit->bytecode_offset = emit->fuse_offset;
+    emit->fuse_op = -1;
+}
+
+STATIC bool emit_bc_fuse_candidate_is(emit_t *emit, byte base, size_t num) {
+    return emit->fuse_op >= base && emit->fuse_op < (int)(base + num);
+}
+#endif
+
 // Similar to mp_encode_uint(), just some extra handling to encode sign
 STATIC void emit_write_bytecode_byte_int(emit_t *emit, int stack_adj, byte b1, mp_int_t num) {
     emit_write_bytecode_byte(emit, stack_adj, b1);
@@ -237,6 +328,23 @@ STATIC void emit_write_bytecode_byte_label(emit_t *emit, int stack_adj, byte b1,
     // Determine if the jump offset is signed or unsigned, based on the opcode.
     const bool is_signed = b1 <= MP_BC_POP_JUMP_IF_FALSE;
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_BC_JUMP_THREADING
+    if (emit_bc_jump_threading()) {
+        if (emit->pass == MP_PASS_STACK_SIZE) {
+            if (b1 == MP_BC_JUMP) {
+                emit_bc_resolve_pending_labels(emit, true, label);
+            }
+        } else if (emit->pass >= MP_PASS_CODE_SIZE && is_signed) {
+            // Jumps with a signed offset can go either way. An unconditional
+            // jump leaves the stack alone and doesn't leave an exception
+            // handler, so going straight to the end of the chain is the same as
+            // following it.
+            label = emit_bc_thread_jump(emit, label);
+        }
+    }
+    #endif
+
     // Default to a 2-byte encoding (the largest) with an unknown jump offset.
     unsigned int jump_encoding_size = 1;
     ssize_t bytecode_offset = 0;
@@ -290,6 +398,13 @@ void mp_emit_bc_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scope) {
     emit->bytecode_offset = 0;
     emit->code_info_offset = 0;
     emit->overflow = false;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+    emit->fuse_op = -1;
+    #endif
+    #if MICROPY_OPT_BC_JUMP_THREADING
+    emit->pending_labels = NO_PENDING_LABELS;
+    #endif
 
     // Write local state size, exception stack size, scope flags and number of arguments
     {
@@ -355,6 +470,11 @@ bool mp_emit_bc_end_pass(emit_t *emit) {
     // check stack is back to zero size
     assert(emit->stack_size == 0);
 
+    // CIRCUITPY-CHANGE: labels at the very end aren't followed by a jump
+    #if MICROPY_OPT_BC_JUMP_THREADING
+    emit_bc_resolve_pending_labels(emit, false, 0);
+    #endif
+
     // Calculate size of source code info section
     emit->n_info = emit->code_info_offset - emit->n_info;
 
@@ -426,6 +546,13 @@ void mp_emit_bc_set_source_line(emit_t *emit, mp_uint_t source_line) {
         return;
     }
     if (source_line > emit->last_source_line) {
+        // CIRCUITPY-CHANGE: don't fuse opcodes across a line boundary, except
+        // after a store, which can't raise and so needs no line of its own.
+        #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+        if (!emit_bc_fuse_candidate_is(emit, MP_BC_STORE_FAST_MULTI, MP_BC_STORE_FAST_MULTI_NUM)) {
+            emit->fuse_op = -1;
+        }
+        #endif
         mp_uint_t bytes_to_skip = emit->bytecode_offset - emit->last_source_line_offset;
         mp_uint_t lines_to_skip = source_line - emit->last_source_line;
         emit_write_code_info_bytes_lines(emit, bytes_to_skip, lines_to_skip);
@@ -443,6 +570,11 @@ void mp_emit_bc_label_assign(emit_t *emit, mp_uint_t l) {
     // should be emitted (until another unconditional flow control).
     emit->suppress = false;
 
+    // CIRCUITPY-CHANGE: opcodes can't be fused across a jump target
+    #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+    emit->fuse_op = -1;
+    #endif
+
     mp_emit_bc_adjust_stack_size(emit, 0);
     if (emit->pass == MP_PASS_SCOPE) {
         return;
@@ -457,6 +589,14 @@ void mp_emit_bc_label_assign(emit_t *emit, mp_uint_t l) {
 
     // Assign label offset.
     emit->label_offsets[l] = emit->bytecode_offset;
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_BC_JUMP_THREADING
+    if (emit->pass == MP_PASS_STACK_SIZE && emit_bc_jump_threading()) {
+        emit->label_targets[l] = emit->pending_labels;
+        emit->pending_labels = l;
+    }
+    #endif
 }
 
 void mp_emit_bc_import(emit_t *emit, qstr qst, int kind) {
@@ -482,6 +622,16 @@ void mp_emit_bc_load_const_tok(emit_t *emit, mp_token_kind_t tok) {
 
 void mp_emit_bc_load_const_small_int(emit_t *emit, mp_int_t arg) {
     assert(MP_SMALL_INT_FITS(arg));
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+    if (0 <= arg && arg <= 15 && emit_bc_fuse_candidate_is(emit, MP_BC_LOAD_FAST_MULTI, MP_BC_LOAD_FAST_MULTI_NUM)) {
+        byte local_num = emit->fuse_op - MP_BC_LOAD_FAST_MULTI;
+        emit_bc_rewind_fuse_candidate(emit);
+        emit_write_bytecode_byte(emit, 1, MP_BC_LOAD_FAST_LOAD_CONST_SMALL_INT);
+        emit_write_bytecode_raw_byte(emit, local_num | arg << 4);
+        return;
+    }
+    #endif
     if (-MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS <= arg
         && arg < MP_BC_LOAD_CONST_SMALL_INT_MULTI_NUM - MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS) {
         emit_write_bytecode_byte(emit, 1,
@@ -508,7 +658,27 @@ void mp_emit_bc_load_local(emit_t *emit, qstr qst, mp_uint_t local_num, int kind
     MP_STATIC_ASSERT(MP_BC_LOAD_FAST_N + MP_EMIT_IDOP_LOCAL_DEREF == MP_BC_LOAD_DEREF);
     (void)qst;
     if (kind == MP_EMIT_IDOP_LOCAL_FAST && local_num <= 15) {
+        // CIRCUITPY-CHANGE
+        #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+        size_t offset = emit->bytecode_offset;
+        byte op = MP_BC_LOAD_FAST_MULTI + local_num;
+        byte arg = 0;
+        if (emit_bc_fuse_candidate_is(emit, MP_BC_LOAD_FAST_MULTI, MP_BC_LOAD_FAST_MULTI_NUM)
+            || emit_bc_fuse_candidate_is(emit, MP_BC_STORE_FAST_MULTI, MP_BC_STORE_FAST_MULTI_NUM)) {
+            // The low nibble of the candidate opcode is its local number.
+            offset = emit->fuse_offset;
+            op = emit->fuse_op < MP_BC_STORE_FAST_MULTI ? MP_BC_LOAD_FAST_LOAD_FAST : MP_BC_STORE_FAST_LOAD_FAST;
+            arg = (emit->fuse_op & 0x0f) | local_num << 4;
+            emit_bc_rewind_fuse_candidate(emit);
+            emit_write_bytecode_byte(emit, 1, op);
+            emit_write_bytecode_raw_byte(emit, arg);
+        } else {
+            emit_write_bytecode_byte(emit, 1, op);
+        }
+        emit_bc_set_fuse_candidate(emit, offset, op, arg);
+        #else
         emit_write_bytecode_byte(emit, 1, MP_BC_LOAD_FAST_MULTI + local_num);
+        #endif
     } else {
         emit_write_bytecode_byte_uint(emit, 1, MP_BC_LOAD_FAST_N + kind, local_num);
     }
@@ -532,6 +702,16 @@ void mp_emit_bc_load_build_class(emit_t *emit) {
 
 void mp_emit_bc_subscr(emit_t *emit, int kind) {
     if (kind == MP_EMIT_SUBSCR_LOAD) {
+        // CIRCUITPY-CHANGE
+        #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+        if (emit->fuse_op == MP_BC_LOAD_FAST_LOAD_FAST) {
+            byte arg = emit->fuse_arg;
+            emit_bc_rewind_fuse_candidate(emit);
+            emit_write_bytecode_byte(emit, -1, MP_BC_LOAD_FAST_LOAD_FAST_LOAD_SUBSCR);
+            emit_write_bytecode_raw_byte(emit, arg);
+            return;
+        }
+        #endif
         emit_write_bytecode_byte(emit, -1, MP_BC_LOAD_SUBSCR);
     } else {
         if (kind == MP_EMIT_SUBSCR_DELETE) {
@@ -544,6 +724,15 @@ void mp_emit_bc_subscr(emit_t *emit, int kind) {
 
 void mp_emit_bc_attr(emit_t *emit, qstr qst, int kind) {
     if (kind == MP_EMIT_ATTR_LOAD) {
+        // CIRCUITPY-CHANGE
+        #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+        if (emit_bc_fuse_candidate_is(emit, MP_BC_LOAD_FAST_MULTI, MP_BC_LOAD_FAST_LOAD_ATTR_MULTI_NUM)) {
+            byte local_num = emit->fuse_op - MP_BC_LOAD_FAST_MULTI;
+            emit_bc_rewind_fuse_candidate(emit);
+            emit_write_bytecode_byte_qstr(emit, 0, MP_BC_LOAD_FAST_LOAD_ATTR_MULTI + local_num, qst);
+            return;
+        }
+        #endif
         emit_write_bytecode_byte_qstr(emit, 0, MP_BC_LOAD_ATTR, qst);
     } else {
         if (kind == MP_EMIT_ATTR_DELETE) {
@@ -559,7 +748,14 @@ void mp_emit_bc_store_local(emit_t *emit, qstr qst, mp_uint_t local_num, int kin
     MP_STATIC_ASSERT(MP_BC_STORE_FAST_N + MP_EMIT_IDOP_LOCAL_DEREF == MP_BC_STORE_DEREF);
     (void)qst;
     if (kind == MP_EMIT_IDOP_LOCAL_FAST && local_num <= 15) {
+        // CIRCUITPY-CHANGE
+        #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+        size_t offset = emit->bytecode_offset;
+        emit_write_bytecode_byte(emit, -1, MP_BC_STORE_FAST_MULTI + local_num);
+        emit_bc_set_fuse_candidate(emit, offset, MP_BC_STORE_FAST_MULTI + local_num, 0);
+        #else
         emit_write_bytecode_byte(emit, -1, MP_BC_STORE_FAST_MULTI + local_num);
+        #endif
     } else {
         emit_write_bytecode_byte_uint(emit, -1, MP_BC_STORE_FAST_N + kind, local_num);
     }
@@ -610,6 +806,16 @@ void mp_emit_bc_jump(emit_t *emit, mp_uint_t label) {
 }
 
 void mp_emit_bc_pop_jump_if(emit_t *emit, bool cond, mp_uint_t label) {
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+    if (emit_bc_fuse_candidate_is(emit, MP_BC_BINARY_OP_MULTI, MP_BC_BINARY_OP_MULTI_NUM)) {
+        byte op = emit->fuse_op - MP_BC_BINARY_OP_MULTI;
+        emit_bc_rewind_fuse_candidate(emit);
+        emit_write_bytecode_byte_label(emit, -1, MP_BC_BINARY_OP_POP_JUMP_IF, label);
+        emit_write_bytecode_raw_byte(emit, op | cond << 7);
+        return;
+    }
+    #endif
     if (cond) {
         emit_write_bytecode_byte_label(emit, -1, MP_BC_POP_JUMP_IF_TRUE, label);
     } else {
@@ -698,7 +904,14 @@ void mp_emit_bc_binary_op(emit_t *emit, mp_binary_op_t op) {
         invert = true;
         op = MP_BINARY_OP_IS;
     }
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+    size_t offset = emit->bytecode_offset;
     emit_write_bytecode_byte(emit, -1, MP_BC_BINARY_OP_MULTI + op);
+    emit_bc_set_fuse_candidate(emit, offset, MP_BC_BINARY_OP_MULTI + op, 0);
+    #else
+    emit_write_bytecode_byte(emit, -1, MP_BC_BINARY_OP_MULTI + op);
+    #endif
     if (invert) {
         emit_write_bytecode_byte(emit, 0, MP_BC_UNARY_OP_MULTI + MP_UNARY_OP_NOT);
     }
@@ -99,6 +99,36 @@ static inline int fp_expval(FPTYPE x) {
     return (int)((fb.i >> MP_FLOAT_FRAC_BITS) & (~(0xFFFFFFFF << MP_FLOAT_EXP_BITS))) - MP_FLOAT_EXP_OFFSET;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_FLOAT_POW10_TABLE
+// Non-negative powers of ten, so that formatting a float doesn't need a call
+// to pow() for every digit. That call is slow without a hardware FPU, and
+// slower still when it has to be done in double precision.
+#if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
+STATIC const float pow10_table[] = {
+    1e0F, 1e1F, 1e2F, 1e3F, 1e4F, 1e5F, 1e6F, 1e7F,
+    1e8F, 1e9F, 1e10F, 1e11F, 1e12F, 1e13F, 1e14F, 1e15F,
+    1e16F, 1e17F, 1e18F, 1e19F, 1e20F, 1e21F, 1e22F, 1e23F,
+    1e24F, 1e25F, 1e26F, 1e27F, 1e28F, 1e29F, 1e30F, 1e31F,
+    1e32F, 1e33F, 1e34F, 1e35F, 1e36F, 1e37F, 1e38F,
+};
+#else
+// Only the exactly representable ones.
+STATIC const double pow10_table[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+    1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+    1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+#endif
+
+FPTYPE mp_float_pow10(int n) {
+    if (0 <= n && n < (int)MP_ARRAY_SIZE(pow10_table)) {
+        return pow10_table[n];
+    }
+    return MICROPY_FLOAT_C_FUN(pow)(10, n);
+}
+#endif
+
 int mp_format_float(FPTYPE f, char *buf, size_t buf_size, char fmt, int prec, char sign) {
 
     char *s = buf;
@@ -236,10 +266,10 @@ int mp_format_float(FPTYPE f, char *buf, size_t buf_size, char fmt, int prec, ch
         // that is not greater than it, and use that to start the
         // mantissa.
         e = e_guess;
-        FPTYPE next_u = MICROPY_FLOAT_C_FUN(pow)(10, e + 1);
+        FPTYPE next_u = mp_float_pow10(e + 1);
         while (f >= next_u) {
             ++e;
-            next_u = MICROPY_FLOAT_C_FUN(pow)(10, e + 1);
+            next_u = mp_float_pow10(e + 1);
         }
 
         // If the user specified fixed format (fmt == 'f') and e makes the
@@ -311,7 +341,7 @@ int mp_format_float(FPTYPE f, char *buf, size_t buf_size, char fmt, int prec, ch
         FPTYPE u_base = FPCONST(1.0);
         if (digit_index > 0) {
             // Generate 10^digit_index for positive digit_index.
-            u_base = MICROPY_FLOAT_C_FUN(pow)(10, digit_index);
+            u_base = mp_float_pow10(digit_index);
         }
         for (d = 0; d < 9; ++d) {
             if (f < u_base) {
@@ -30,6 +30,12 @@
 
 #if MICROPY_PY_BUILTINS_FLOAT
 int mp_format_float(mp_float_t f, char *buf, size_t bufSize, char fmt, int prec, char sign);
+// CIRCUITPY-CHANGE
+#if MICROPY_FLOAT_POW10_TABLE
+mp_float_t mp_float_pow10(int n);
+#else
+#define mp_float_pow10(n) MICROPY_FLOAT_C_FUN(pow)(10, (n))
+#endif
 #endif
 
 #endif // MICROPY_INCLUDED_PY_FORMATFLOAT_H
@@ -43,6 +43,17 @@
 #include "shared-module/memorymonitor/__init__.h"
 #endif
 
+#if MICROPY_GEN_POOL
+#include "py/objgenerator.h"
+#endif
+
+#if MICROPY_GC_COMPACT
+#include "py/binary.h"
+#include "py/objarray.h"
+#include "py/objlist.h"
+#include "py/objstr.h"
+#endif
+
 #if MICROPY_ENABLE_GC
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
@@ -103,6 +114,14 @@
 #define ATB_HEAD_TO_MARK(area, block) do { area->gc_alloc_table_start[(block) / BLOCKS_PER_ATB] |= (AT_MARK << BLOCK_SHIFT(block)); } while (0)
 #define ATB_MARK_TO_HEAD(area, block) do { area->gc_alloc_table_start[(block) / BLOCKS_PER_ATB] &= (~(AT_TAIL << BLOCK_SHIFT(block))); } while (0)
 
+// CIRCUITPY-CHANGE: outside a collection, live objects that a pending
+// incremental sweep has not reached yet are still marked.
+#if MICROPY_GC_INCREMENTAL_SWEEP
+#define ATB_IS_LIVE_HEAD(area, block) (ATB_GET_KIND(area, block) == AT_HEAD || (ATB_GET_KIND(area, block) == AT_MARK && (block) >= (area)->gc_sweep_block))
+#else
+#define ATB_IS_LIVE_HEAD(area, block) (ATB_GET_KIND(area, block) == AT_HEAD)
+#endif
+
 #define BLOCK_FROM_PTR(area, ptr) (((byte *)(ptr) - area->gc_pool_start) / BYTES_PER_BLOCK)
 #define PTR_FROM_BLOCK(area, block) (((block) * BYTES_PER_BLOCK + (uintptr_t)area->gc_pool_start))
 
@@ -144,6 +163,24 @@ void __attribute__ ((noinline)) gc_log_change(uint32_t start_block, uint32_t len
 #endif
 
 // TODO waste less memory; currently requires that all entries in alloc_table have a corresponding block in pool
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_FREE_RUN_HINTS > 1
+STATIC void gc_free_run_hints_reset(mp_state_mem_area_t *area) {
+    memset(area->gc_free_run_atb_index, 0, sizeof(area->gc_free_run_atb_index));
+}
+
+// Blocks starting at `block` were just freed. A new run of n free blocks that
+// includes them can start at most n - 1 blocks earlier.
+STATIC void gc_free_run_hints_freed(mp_state_mem_area_t *area, size_t block) {
+    for (size_t n = 2; n <= MICROPY_GC_FREE_RUN_HINTS; n++) {
+        size_t atb = (block < n - 1 ? 0 : block - (n - 1)) / BLOCKS_PER_ATB;
+        if (atb < area->gc_free_run_atb_index[n - 2]) {
+            area->gc_free_run_atb_index[n - 2] = atb;
+        }
+    }
+}
+#endif
+
 STATIC void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     // calculate parameters for GC (T=total, A=alloc table, F=finaliser table, P=pool; all in bytes):
     // T = A + F + P
@@ -187,10 +224,19 @@ STATIC void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     #endif
 
     area->gc_last_free_atb_index = 0;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_FREE_RUN_HINTS > 1
+    gc_free_run_hints_reset(area);
+    #endif
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    area->gc_sweep_block = SIZE_MAX;
+    #endif
     area->gc_last_used_block = 0;
 
     #if MICROPY_GC_SPLIT_HEAP
     area->next = NULL;
+    // CIRCUITPY-CHANGE
+    area->fast = MP_PLAT_HEAP_IS_FAST(start);
     #endif
 
     DEBUG_printf("GC layout:\n");
@@ -224,9 +270,20 @@ void gc_init(void *start, void *end) {
     // unlock the GC
     MP_STATE_THREAD(gc_lock_depth) = 0;
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_ARENA
+    MP_STATE_THREAD(gc_arena) = NULL;
+    #endif
+
     // allow auto collection
     MP_STATE_MEM(gc_auto_collect_enabled) = 1;
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    MP_STATE_MEM(gc_sweep_area) = NULL;
+    MP_STATE_MEM(gc_sweep_budget_us) = 0;
+    #endif
+
     #if MICROPY_GC_ALLOC_THRESHOLD
     // by default, maxuint for gc threshold, effectively turning gc-by-threshold off
     MP_STATE_MEM(gc_alloc_threshold) = (size_t)-1;
@@ -262,7 +319,8 @@ void gc_add(void *start, void *end) {
 
 #if MICROPY_GC_SPLIT_HEAP_AUTO
 // Try to automatically add a heap area large enough to fulfill 'failed_alloc'.
-STATIC bool gc_try_add_heap(size_t failed_alloc) {
+// CIRCUITPY-CHANGE: 'fast' asks for the area to be in fast RAM.
+STATIC bool gc_try_add_heap(size_t failed_alloc, bool fast) {
     // 'needed' is the size of a heap large enough to hold failed_alloc, with
     // the additional metadata overheads as calculated in gc_setup_area().
     //
@@ -317,7 +375,16 @@ STATIC bool gc_try_add_heap(size_t failed_alloc) {
 
     size_t to_alloc = MIN(avail, MAX(total_heap, needed));
 
-    mp_state_mem_area_t *new_heap = MP_PLAT_ALLOC_HEAP(to_alloc);
+    // CIRCUITPY-CHANGE: fast RAM is usually small and shared with the rest of
+    // the system, so only take exactly what this allocation needs. avail may
+    // describe slower RAM so the allocation itself decides whether it fits.
+    mp_state_mem_area_t *new_heap;
+    if (fast) {
+        to_alloc = needed;
+        new_heap = MP_PLAT_ALLOC_HEAP_FAST(to_alloc);
+    } else {
+        new_heap = MP_PLAT_ALLOC_HEAP(to_alloc);
+    }
 
     DEBUG_printf("MP_PLAT_ALLOC_HEAP " UINT_FMT " = %p\n",
         to_alloc, new_heap);
@@ -506,12 +573,75 @@ STATIC void gc_deal_with_stack_overflow(void) {
     }
 }
 
+// CIRCUITPY-CHANGE: the per-block sweep is split out so that an incremental
+// sweep can run it over part of an area. Returns the first block freed, or
+// SIZE_MAX if none were.
+STATIC size_t gc_sweep_range(mp_state_mem_area_t *area, size_t block, size_t end_block, size_t *last_used_block) {
+    size_t first_freed = SIZE_MAX;
+    int free_tail = 0;
+    for (; block < end_block; block++) {
+        MICROPY_GC_HOOK_LOOP(block);
+        switch (ATB_GET_KIND(area, block)) {
+            case AT_HEAD:
+                #if MICROPY_ENABLE_FINALISER
+                if (FTB_GET(area, block)) {
+                    mp_obj_base_t *obj = (mp_obj_base_t *)PTR_FROM_BLOCK(area, block);
+                    if (obj->type != NULL) {
+                        // if the object has a type then see if it has a __del__ method
+                        mp_obj_t dest[2];
+                        mp_load_method_maybe(MP_OBJ_FROM_PTR(obj), MP_QSTR___del__, dest);
+                        if (dest[0] != MP_OBJ_NULL) {
+                            // load_method returned a method, execute it in a protected environment
+                            #if MICROPY_ENABLE_SCHEDULER
+                            mp_sched_lock();
+                            #endif
+                            mp_call_function_1_protected(dest[0], dest[1]);
+                            #if MICROPY_ENABLE_SCHEDULER
+                            mp_sched_unlock();
+                            #endif
+                        }
+                    }
+                    // clear finaliser flag
+                    FTB_CLEAR(area, block);
+                }
+                #endif
+                free_tail = 1;
+                if (first_freed == SIZE_MAX) {
+                    first_freed = block;
+                }
+                DEBUG_printf("gc_sweep(%p)\n", (void *)PTR_FROM_BLOCK(area, block));
+                #if MICROPY_PY_GC_COLLECT_RETVAL
+                MP_STATE_MEM(gc_collected)++;
+                #endif
+                // fall through to free the head
+                MP_FALLTHROUGH
+
+            case AT_TAIL:
+                if (free_tail) {
+                    ATB_ANY_TO_FREE(area, block);
+                    #if CLEAR_ON_SWEEP
+                    memset((void *)PTR_FROM_BLOCK(area, block), 0, BYTES_PER_BLOCK);
+                    #endif
+                } else {
+                    *last_used_block = block;
+                }
+                break;
+
+            case AT_MARK:
+                ATB_MARK_TO_HEAD(area, block);
+                free_tail = 0;
+                *last_used_block = block;
+                break;
+        }
+    }
+    return first_freed;
+}
+
 STATIC void gc_sweep(void) {
     #if MICROPY_PY_GC_COLLECT_RETVAL
     MP_STATE_MEM(gc_collected) = 0;
     #endif
     // free unmarked heads and their tails
-    int free_tail = 0;
     #if MICROPY_GC_SPLIT_HEAP_AUTO
     mp_state_mem_area_t *prev_area = NULL;
     #endif
@@ -523,58 +653,8 @@ STATIC void gc_sweep(void) {
 
         size_t last_used_block = 0;
 
-        for (size_t block = 0; block < end_block; block++) {
-            MICROPY_GC_HOOK_LOOP(block);
-            switch (ATB_GET_KIND(area, block)) {
-                case AT_HEAD:
-                    #if MICROPY_ENABLE_FINALISER
-                    if (FTB_GET(area, block)) {
-                        mp_obj_base_t *obj = (mp_obj_base_t *)PTR_FROM_BLOCK(area, block);
-                        if (obj->type != NULL) {
-                            // if the object has a type then see if it has a __del__ method
-                            mp_obj_t dest[2];
-                            mp_load_method_maybe(MP_OBJ_FROM_PTR(obj), MP_QSTR___del__, dest);
-                            if (dest[0] != MP_OBJ_NULL) {
-                                // load_method returned a method, execute it in a protected environment
-                                #if MICROPY_ENABLE_SCHEDULER
-                                mp_sched_lock();
-                                #endif
-                                mp_call_function_1_protected(dest[0], dest[1]);
-                                #if MICROPY_ENABLE_SCHEDULER
-                                mp_sched_unlock();
-                                #endif
-                            }
-                        }
-                        // clear finaliser flag
-                        FTB_CLEAR(area, block);
-                    }
-                    #endif
-                    free_tail = 1;
-                    DEBUG_printf("gc_sweep(%p)\n", (void *)PTR_FROM_BLOCK(area, block));
-                    #if MICROPY_PY_GC_COLLECT_RETVAL
-                    MP_STATE_MEM(gc_collected)++;
-                    #endif
-                    // fall through to free the head
-                    MP_FALLTHROUGH
-
-                case AT_TAIL:
-                    if (free_tail) {
-                        ATB_ANY_TO_FREE(area, block);
-                        #if CLEAR_ON_SWEEP
-                        memset((void *)PTR_FROM_BLOCK(area, block), 0, BYTES_PER_BLOCK);
-                        #endif
-                    } else {
-                        last_used_block = block;
-                    }
-                    break;
-
-                case AT_MARK:
-                    ATB_MARK_TO_HEAD(area, block);
-                    free_tail = 0;
-                    last_used_block = block;
-                    break;
-            }
-        }
+        // CIRCUITPY-CHANGE
+        gc_sweep_range(area, 0, end_block, &last_used_block);
 
         area->gc_last_used_block = last_used_block;
 
@@ -591,13 +671,188 @@ STATIC void gc_sweep(void) {
     }
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_INCREMENTAL_SWEEP
+void gc_set_sweep_budget_us(uint32_t budget_us) {
+    MP_STATE_MEM(gc_sweep_budget_us) = budget_us;
+}
+
+uint32_t gc_get_sweep_budget_us(void) {
+    return MP_STATE_MEM(gc_sweep_budget_us);
+}
+
+bool gc_sweep_pending(void) {
+    return MP_STATE_MEM(gc_sweep_area) != NULL;
+}
+
+// Called at the end of marking instead of gc_sweep.
+STATIC void gc_sweep_begin(void) {
+    #if MICROPY_PY_GC_COLLECT_RETVAL
+    MP_STATE_MEM(gc_collected) = 0;
+    #endif
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        area->gc_sweep_block = 0;
+    }
+    MP_STATE_MEM(gc_sweep_area) = &MP_STATE_MEM(area);
+    MP_STATE_MEM(gc_sweep_last_used) = 0;
+}
+
+// Sweeps up to about max_blocks blocks of the pending sweep. The caller must
+// hold the GC mutex and have the heap locked so finalisers cannot allocate.
+STATIC void gc_sweep_blocks(size_t max_blocks) {
+    while (MP_STATE_MEM(gc_sweep_area) != NULL && max_blocks > 0) {
+        mp_state_mem_area_t *area = MP_STATE_MEM(gc_sweep_area);
+        if (area->gc_sweep_block == SIZE_MAX) {
+            // Added after this collection, so it has nothing to sweep.
+            MP_STATE_MEM(gc_sweep_area) = NEXT_AREA(area);
+            continue;
+        }
+        // Allocations made since the sweep began may have raised this.
+        size_t end_block = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+        if (area->gc_last_used_block < end_block) {
+            end_block = area->gc_last_used_block + 1;
+        }
+        size_t block = area->gc_sweep_block;
+        size_t stop = end_block - block > max_blocks ? block + max_blocks : end_block;
+        // Never stop inside a chain, so each slice can start with free_tail clear.
+        while (stop < end_block && ATB_GET_KIND(area, stop) == AT_TAIL) {
+            stop++;
+        }
+        max_blocks -= MIN(max_blocks, stop - block);
+
+        size_t first_freed = gc_sweep_range(area, block, stop, &MP_STATE_MEM(gc_sweep_last_used));
+        if (first_freed != SIZE_MAX) {
+            if (first_freed / BLOCKS_PER_ATB < area->gc_last_free_atb_index) {
+                area->gc_last_free_atb_index = first_freed / BLOCKS_PER_ATB;
+            }
+            #if MICROPY_GC_FREE_RUN_HINTS > 1
+            gc_free_run_hints_freed(area, first_freed);
+            #endif
+            #if MICROPY_GC_SPLIT_HEAP
+            MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
+            #endif
+        }
+        area->gc_sweep_block = stop;
+        if (stop < end_block) {
+            continue;
+        }
+
+        // This area is done.
+        size_t last_used_block = MP_STATE_MEM(gc_sweep_last_used);
+        area->gc_last_used_block = last_used_block;
+        area->gc_sweep_block = SIZE_MAX;
+        MP_STATE_MEM(gc_sweep_area) = NEXT_AREA(area);
+        MP_STATE_MEM(gc_sweep_last_used) = 0;
+
+        #if MICROPY_GC_SPLIT_HEAP_AUTO
+        // Free the area if it is empty, aside from the first one
+        if (last_used_block == 0 && area != &MP_STATE_MEM(area)) {
+            mp_state_mem_area_t *prev_area = &MP_STATE_MEM(area);
+            while (NEXT_AREA(prev_area) != area) {
+                prev_area = NEXT_AREA(prev_area);
+            }
+            DEBUG_printf("gc_sweep free empty area %p\n", area);
+            NEXT_AREA(prev_area) = NEXT_AREA(area);
+            MP_PLAT_FREE_HEAP(area);
+            MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
+        }
+        #endif
+    }
+}
+
+bool gc_sweep_step(size_t max_blocks) {
+    GC_ENTER();
+    if (MP_STATE_THREAD(gc_lock_depth) == 0) {
+        MP_STATE_THREAD(gc_lock_depth)++;
+        gc_sweep_blocks(max_blocks);
+        MP_STATE_THREAD(gc_lock_depth)--;
+    }
+    bool pending = MP_STATE_MEM(gc_sweep_area) != NULL;
+    GC_EXIT();
+    return pending;
+}
+
+// Completes any pending sweep. Returns true if one was pending.
+STATIC bool gc_sweep_finish(void) {
+    GC_ENTER();
+    bool pending = MP_STATE_MEM(gc_sweep_area) != NULL;
+    if (pending) {
+        MP_STATE_THREAD(gc_lock_depth)++;
+        gc_sweep_blocks(SIZE_MAX);
+        MP_STATE_THREAD(gc_lock_depth)--;
+    }
+    GC_EXIT();
+    return pending;
+}
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_COMPACT
+
+// Other threads could see an owner's pointer hidden while marking.
+#if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
+#error "MICROPY_GC_COMPACT needs MICROPY_PY_THREAD_GIL"
+#endif
+
+// A buffer that may be moved, because the only pointer to it is one field of
+// its owning object. The table lives on the C stack, so it holds block numbers
+// and inverted addresses that marking won't mistake for references.
+typedef struct {
+    uintptr_t field; // ~address of the owner's pointer to the buffer
+    size_t block;
+    size_t n_blocks;
+    bool pinned;
+} gc_compact_candidate_t;
+
+typedef struct _gc_compact_t {
+    mp_state_mem_area_t *area;
+    // Sorted by block.
+    gc_compact_candidate_t candidates[MICROPY_GC_COMPACT_CANDIDATES];
+    size_t len;
+} gc_compact_t;
+
+#define GC_COMPACT_FIELD(c) ((void **)~(c)->field)
+
+STATIC void gc_compact_pin(gc_compact_t *compact, void *ptr) {
+    mp_state_mem_area_t *area = compact->area;
+    if (compact->len == 0 || (byte *)ptr < area->gc_pool_start || (byte *)ptr > area->gc_pool_end) {
+        return;
+    }
+    // Marking only follows pointers to the head of a chain, but C code may
+    // hold a pointer into a buffer, or just past its end as a loop bound.
+    size_t offset = (byte *)ptr - area->gc_pool_start;
+    const gc_compact_candidate_t *last = &compact->candidates[compact->len - 1];
+    if (offset < compact->candidates[0].block * BYTES_PER_BLOCK ||
+        offset > (last->block + last->n_blocks) * BYTES_PER_BLOCK) {
+        return;
+    }
+    for (size_t i = 0; i < compact->len; i++) {
+        gc_compact_candidate_t *c = &compact->candidates[i];
+        if (offset >= c->block * BYTES_PER_BLOCK && offset <= (c->block + c->n_blocks) * BYTES_PER_BLOCK) {
+            c->pinned = true;
+        }
+    }
+}
+#endif
+
+// CIRCUITPY-CHANGE: kept outside MP_STATE_MEM so registrations outlive the heap.
+STATIC gc_root_t *gc_roots = NULL;
+
 void gc_collect_start(void) {
+    // CIRCUITPY-CHANGE: marking needs every live head unmarked.
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    gc_sweep_finish();
+    #endif
     GC_ENTER();
     MP_STATE_THREAD(gc_lock_depth)++;
     #if MICROPY_GC_ALLOC_THRESHOLD
     MP_STATE_MEM(gc_alloc_amount) = 0;
     #endif
     MP_STATE_MEM(gc_stack_overflow) = 0;
+    // CIRCUITPY-CHANGE: pooled generators aren't roots, so let this collection free them.
+    #if MICROPY_GEN_POOL
+    mp_obj_gen_pool_clear();
+    #endif
 
     // Trace root pointers.  This relies on the root pointers being organised
     // correctly in the mp_state_ctx structure.  We scan nlr_top, dict_locals,
@@ -612,6 +867,16 @@ void gc_collect_start(void) {
     ptrs = (void **)(void *)MP_STATE_THREAD(pystack_start);
     gc_collect_root(ptrs, (MP_STATE_THREAD(pystack_cur) - MP_STATE_THREAD(pystack_start)) / sizeof(void *));
     #endif
+
+    // CIRCUITPY-CHANGE: trace the registered precise roots.
+    for (const gc_root_t *root = gc_roots; root != NULL; root = root->next) {
+        const byte *item = root->base;
+        for (size_t i = 0; i < root->count; i++, item += root->stride) {
+            for (size_t j = 0; j < root->num_offsets; j++) {
+                gc_collect_root((void **)(item + root->offsets[j]), 1);
+            }
+        }
+    }
 }
 
 // CIRCUITPY-CHANGE
@@ -620,6 +885,27 @@ void gc_collect_ptr(void *ptr) {
     gc_collect_root(ptrs, 1);
 }
 
+// CIRCUITPY-CHANGE
+void gc_root_register(gc_root_t *root) {
+    for (gc_root_t *r = gc_roots; r != NULL; r = r->next) {
+        if (r == root) {
+            return;
+        }
+    }
+    root->next = gc_roots;
+    gc_roots = root;
+}
+
+// CIRCUITPY-CHANGE
+void gc_root_unregister(gc_root_t *root) {
+    for (gc_root_t **r = &gc_roots; *r != NULL; r = &(*r)->next) {
+        if (*r == root) {
+            *r = root->next;
+            return;
+        }
+    }
+}
+
 // Address sanitizer needs to know that the access to ptrs[i] must always be
 // considered OK, even if it's a load from an address that would normally be
 // prohibited (due to being undefined, in a red zone, etc).
@@ -643,6 +929,12 @@ void gc_collect_root(void **ptrs, size_t len) {
     for (size_t i = 0; i < len; i++) {
         MICROPY_GC_HOOK_LOOP(i);
         void *ptr = gc_get_ptr(ptrs, i);
+        // CIRCUITPY-CHANGE
+        #if MICROPY_GC_COMPACT
+        if (MP_STATE_MEM(gc_compact) != NULL) {
+            gc_compact_pin(MP_STATE_MEM(gc_compact), ptr);
+        }
+        #endif
         #if MICROPY_GC_SPLIT_HEAP
         mp_state_mem_area_t *area = gc_get_ptr_area(ptr);
         if (!area) {
@@ -666,27 +958,64 @@ void gc_collect_root(void **ptrs, size_t len) {
     }
 }
 
-void gc_collect_end(void) {
+// CIRCUITPY-CHANGE
+STATIC void gc_collect_end_helper(bool incremental) {
     gc_deal_with_stack_overflow();
-    gc_sweep();
+    #if MICROPY_GC_COMPACT
+    // gc_compact() needs the marks and doesn't want anything freed.
+    if (MP_STATE_MEM(gc_compact) != NULL) {
+        MP_STATE_THREAD(gc_lock_depth)--;
+        GC_EXIT();
+        return;
+    }
+    #endif
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    if (incremental) {
+        gc_sweep_begin();
+    } else
+    #endif
+    {
+        gc_sweep();
+    }
     #if MICROPY_GC_SPLIT_HEAP
     MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
     #endif
     for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
         area->gc_last_free_atb_index = 0;
+        // CIRCUITPY-CHANGE
+        #if MICROPY_GC_FREE_RUN_HINTS > 1
+        gc_free_run_hints_reset(area);
+        #endif
     }
     MP_STATE_THREAD(gc_lock_depth)--;
     GC_EXIT();
 }
 
+void gc_collect_end(void) {
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    gc_collect_end_helper(MP_STATE_MEM(gc_sweep_budget_us) != 0);
+    #else
+    gc_collect_end_helper(false);
+    #endif
+}
+
 void gc_sweep_all(void) {
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    gc_sweep_finish();
+    #endif
     GC_ENTER();
     MP_STATE_THREAD(gc_lock_depth)++;
     MP_STATE_MEM(gc_stack_overflow) = 0;
-    gc_collect_end();
+    gc_collect_end_helper(false);
 }
 
 void gc_info(gc_info_t *info) {
+    // CIRCUITPY-CHANGE: report the heap as a full collection would leave it.
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    gc_sweep_finish();
+    #endif
     GC_ENTER();
     info->total = 0;
     info->used = 0;
@@ -759,6 +1088,30 @@ void gc_info(gc_info_t *info) {
     GC_EXIT();
 }
 
+// CIRCUITPY-CHANGE
+void gc_walk(gc_walk_callback_t callback, void *env) {
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    gc_sweep_finish();
+    #endif
+    gc_lock();
+    GC_ENTER();
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        size_t n_blocks = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+        for (size_t block = 0; block < n_blocks;) {
+            size_t start = block;
+            bool is_free = ATB_GET_KIND(area, block) == AT_FREE;
+            // A free run ends at the next head; a chain ends at anything but a tail.
+            do {
+                MICROPY_GC_HOOK_LOOP(block);
+                block++;
+            } while (block < n_blocks && ATB_GET_KIND(area, block) == (is_free ? AT_FREE : AT_TAIL));
+            callback(env, (void *)PTR_FROM_BLOCK(area, start), block - start, is_free);
+        }
+    }
+    GC_EXIT();
+    gc_unlock();
+}
+
 // CIRCUITPY-CHANGE
 bool gc_alloc_possible(void) {
     #if MICROPY_GC_SPLIT_HEAP
@@ -768,8 +1121,352 @@ bool gc_alloc_possible(void) {
     #endif
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_ARENA
+// Splits n_blocks off the front of the arena's remainder. The remaining blocks
+// become a new chain by turning their first tail block into a head.
+STATIC void *gc_arena_take(gc_arena_t *arena, size_t n_blocks, bool has_finaliser) {
+    GC_ENTER();
+    void *ret_ptr = arena->free;
+    mp_state_mem_area_t *area;
+    #if MICROPY_GC_SPLIT_HEAP
+    area = gc_get_ptr_area(ret_ptr);
+    #else
+    area = &MP_STATE_MEM(area);
+    #endif
+    size_t block = BLOCK_FROM_PTR(area, ret_ptr);
+    arena->free_blocks -= n_blocks;
+    if (arena->free_blocks == 0) {
+        arena->free = NULL;
+    } else {
+        size_t rest = block + n_blocks;
+        ATB_ANY_TO_FREE(area, rest);
+        ATB_FREE_TO_HEAD(area, rest);
+        #if MICROPY_GC_INCREMENTAL_SWEEP
+        if (rest >= area->gc_sweep_block) {
+            ATB_HEAD_TO_MARK(area, rest);
+        }
+        #endif
+        arena->free = (void *)PTR_FROM_BLOCK(area, rest);
+    }
+
+    #if MICROPY_ENABLE_FINALISER
+    if (has_finaliser) {
+        // clear type pointer in case it is never set
+        ((mp_obj_base_t *)ret_ptr)->type = NULL;
+        FTB_SET(area, block);
+    }
+    #else
+    (void)has_finaliser;
+    #endif
+    GC_EXIT();
+
+    // The reservation was zeroed when the arena began and nothing else has
+    // written to it since.
+
+    #if CIRCUITPY_MEMORYMONITOR
+    memorymonitor_track_allocation(n_blocks);
+    #endif
+
+    return ret_ptr;
+}
+
+bool gc_arena_begin(gc_arena_t *arena, size_t n_bytes) {
+    arena->prev = MP_STATE_THREAD(gc_arena);
+    // Reserve from the heap rather than from any enclosing arena.
+    MP_STATE_THREAD(gc_arena) = NULL;
+    arena->free = gc_alloc(n_bytes, 0);
+    if (arena->free == NULL) {
+        arena->free_blocks = 0;
+        MP_STATE_THREAD(gc_arena) = arena->prev;
+        return false;
+    }
+    arena->free_blocks = gc_nbytes(arena->free) / BYTES_PER_BLOCK;
+    memset(arena->free, 0, arena->free_blocks * BYTES_PER_BLOCK);
+    MP_STATE_THREAD(gc_arena) = arena;
+    return true;
+}
+
+void gc_arena_end(gc_arena_t *arena) {
+    if (MP_STATE_THREAD(gc_arena) == arena) {
+        MP_STATE_THREAD(gc_arena) = arena->prev;
+    }
+    if (arena->free != NULL) {
+        gc_free(arena->free);
+        arena->free = NULL;
+        arena->free_blocks = 0;
+    }
+}
+
+size_t gc_arena_free_bytes(const gc_arena_t *arena) {
+    return arena->free_blocks * BYTES_PER_BLOCK;
+}
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_COMPACT
+
+#define BLOCKS_FOR_BYTES(n) (((n) + BYTES_PER_BLOCK - 1) / BYTES_PER_BLOCK)
+
+STATIC size_t gc_compact_chain_len(mp_state_mem_area_t *area, size_t block) {
+    size_t n_blocks = 0;
+    do {
+        n_blocks++;
+    } while (ATB_GET_KIND(area, block + n_blocks) == AT_TAIL);
+    return n_blocks;
+}
+
+// If ptr is an object that owns a movable buffer, returns the location of its
+// pointer to the buffer and sets n_bytes to the size the buffer was allocated
+// with. Any allocation may start with a type pointer, so the object's size and
+// fields are checked as well.
+STATIC void **gc_compact_owned_buffer(void *ptr, size_t n_blocks, size_t *n_bytes) {
+    const mp_obj_type_t *type = ((mp_obj_base_t *)ptr)->type;
+    if (type == &mp_type_list && n_blocks == BLOCKS_FOR_BYTES(sizeof(mp_obj_list_t))) {
+        mp_obj_list_t *list = ptr;
+        if (list->len > list->alloc) {
+            return NULL;
+        }
+        *n_bytes = list->alloc * sizeof(mp_obj_t);
+        return (void **)&list->items;
+    }
+    if ((type == &mp_type_dict
+         #if MICROPY_PY_COLLECTIONS_ORDEREDDICT
+         || type == &mp_type_ordereddict
+         #endif
+         ) && n_blocks == BLOCKS_FOR_BYTES(sizeof(mp_obj_dict_t))) {
+        mp_map_t *map = &((mp_obj_dict_t *)ptr)->map;
+        if (map->is_fixed || map->used > map->alloc) {
+            return NULL;
+        }
+        *n_bytes = map->alloc * sizeof(mp_map_elem_t);
+        return (void **)&map->table;
+    }
+    #if MICROPY_PY_BUILTINS_BYTEARRAY
+    if (type == &mp_type_bytearray && n_blocks == BLOCKS_FOR_BYTES(sizeof(mp_obj_array_t))) {
+        mp_obj_array_t *array = ptr;
+        if (array->typecode != BYTEARRAY_TYPECODE) {
+            return NULL;
+        }
+        *n_bytes = array->len + array->free;
+        return &array->items;
+    }
+    #endif
+    if ((type == &mp_type_str || type == &mp_type_bytes) && n_blocks == BLOCKS_FOR_BYTES(sizeof(mp_obj_str_t))) {
+        mp_obj_str_t *str = ptr;
+        // Heap data always has a terminating null byte.
+        *n_bytes = str->len + 1;
+        return (void **)&str->data;
+    }
+    return NULL;
+}
+
+STATIC void gc_compact_insert(gc_compact_t *compact, void **field, size_t block, size_t n_blocks) {
+    gc_compact_candidate_t *candidates = compact->candidates;
+    size_t i = 0;
+    while (i < compact->len && candidates[i].block < block) {
+        i++;
+    }
+    if (i < compact->len && candidates[i].block == block) {
+        // Two owners share this buffer, as a str decoded from bytes does, and
+        // only one of them would be fixed up.
+        candidates[i].pinned = true;
+        return;
+    }
+    if (compact->len < MICROPY_GC_COMPACT_CANDIDATES) {
+        memmove(&candidates[i + 1], &candidates[i], (compact->len - i) * sizeof(*candidates));
+        compact->len++;
+    } else if (i == 0) {
+        return;
+    } else {
+        // Drop the lowest buffer to keep the highest ones.
+        i--;
+        memmove(&candidates[0], &candidates[1], i * sizeof(*candidates));
+    }
+    candidates[i] = (gc_compact_candidate_t) {
+        .field = ~(uintptr_t)field,
+        .block = block,
+        .n_blocks = n_blocks,
+        .pinned = false,
+    };
+}
+
+// Finds the highest movable buffers in compact->area that start below limit.
+// Their owners may be in any area.
+STATIC void gc_compact_find_candidates(gc_compact_t *compact, size_t limit) {
+    mp_state_mem_area_t *buf_area = compact->area;
+    compact->len = 0;
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        size_t end_block = MIN(area->gc_last_used_block + 1, area->gc_alloc_table_byte_len * BLOCKS_PER_ATB);
+        for (size_t block = 0; block < end_block; block++) {
+            MICROPY_GC_HOOK_LOOP(block);
+            if (ATB_GET_KIND(area, block) != AT_HEAD) {
+                continue;
+            }
+            size_t n_blocks = gc_compact_chain_len(area, block);
+            void *owner = (void *)PTR_FROM_BLOCK(area, block);
+            size_t n_bytes = 0;
+            void **field = gc_compact_owned_buffer(owner, n_blocks, &n_bytes);
+            block += n_blocks - 1;
+            byte *buf = field != NULL ? *field : NULL;
+            if (((uintptr_t)buf & (BYTES_PER_BLOCK - 1)) != 0 || buf == owner ||
+                buf < buf_area->gc_pool_start || buf >= buf_area->gc_pool_end) {
+                continue;
+            }
+            size_t buf_block = BLOCK_FROM_PTR(buf_area, buf);
+            size_t buf_n_blocks = BLOCKS_FOR_BYTES(n_bytes);
+            if (buf_block >= limit ||
+                ATB_GET_KIND(buf_area, buf_block) != AT_HEAD ||
+                gc_compact_chain_len(buf_area, buf_block) != buf_n_blocks) {
+                continue;
+            }
+            #if MICROPY_ENABLE_FINALISER
+            if (FTB_GET(buf_area, buf_block)) {
+                continue;
+            }
+            #endif
+            gc_compact_insert(compact, field, buf_block, buf_n_blocks);
+        }
+    }
+}
+
+// Pins every candidate that is reachable other than through its owner.
+STATIC void gc_compact_mark(gc_compact_t *compact) {
+    mp_state_mem_area_t *area = compact->area;
+    for (size_t i = 0; i < compact->len; i++) {
+        *GC_COMPACT_FIELD(&compact->candidates[i]) = NULL;
+    }
+    MP_STATE_MEM(gc_compact) = compact;
+    gc_collect();
+    MP_STATE_MEM(gc_compact) = NULL;
+
+    GC_ENTER();
+    for (size_t i = 0; i < compact->len; i++) {
+        gc_compact_candidate_t *c = &compact->candidates[i];
+        *GC_COMPACT_FIELD(c) = (void *)PTR_FROM_BLOCK(area, c->block);
+        if (ATB_GET_KIND(area, c->block) == AT_MARK) {
+            c->pinned = true;
+        }
+    }
+    for (area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        for (size_t block = 0; block < area->gc_alloc_table_byte_len * BLOCKS_PER_ATB; block++) {
+            MICROPY_GC_HOOK_LOOP(block);
+            if (ATB_GET_KIND(area, block) == AT_MARK) {
+                ATB_MARK_TO_HEAD(area, block);
+            }
+        }
+    }
+    GC_EXIT();
+}
+
+// Moves each unpinned candidate, highest first, to the lowest free run below
+// it that fits. Returns whether anything moved.
+STATIC bool gc_compact_move(gc_compact_t *compact) {
+    mp_state_mem_area_t *area = compact->area;
+    bool moved = false;
+    for (size_t i = compact->len; i-- > 0;) {
+        gc_compact_candidate_t *c = &compact->candidates[i];
+        if (c->pinned) {
+            continue;
+        }
+        size_t n_free = 0;
+        size_t dest = 0;
+        for (size_t block = 0; block < c->block && n_free < c->n_blocks; block++) {
+            MICROPY_GC_HOOK_LOOP(block);
+            if (ATB_GET_KIND(area, block) == AT_FREE) {
+                if (n_free++ == 0) {
+                    dest = block;
+                }
+            } else {
+                n_free = 0;
+            }
+        }
+        if (n_free < c->n_blocks) {
+            continue;
+        }
+
+        ATB_FREE_TO_HEAD(area, dest);
+        for (size_t block = dest + 1; block < dest + c->n_blocks; block++) {
+            ATB_FREE_TO_TAIL(area, block);
+        }
+        memcpy((void *)PTR_FROM_BLOCK(area, dest), (void *)PTR_FROM_BLOCK(area, c->block), c->n_blocks * BYTES_PER_BLOCK);
+        for (size_t block = c->block; block < c->block + c->n_blocks; block++) {
+            ATB_ANY_TO_FREE(area, block);
+        }
+        *GC_COMPACT_FIELD(c) = (void *)PTR_FROM_BLOCK(area, dest);
+
+        // An owner that is itself inside the moved buffer has moved with it.
+        byte *start = (byte *)PTR_FROM_BLOCK(area, c->block);
+        byte *end = start + c->n_blocks * BYTES_PER_BLOCK;
+        for (size_t j = 0; j < compact->len; j++) {
+            byte *field = (byte *)GC_COMPACT_FIELD(&compact->candidates[j]);
+            if (field >= start && field < end) {
+                compact->candidates[j].field = ~(uintptr_t)(field - start + (byte *)PTR_FROM_BLOCK(area, dest));
+            }
+        }
+        moved = true;
+    }
+    if (moved) {
+        area->gc_last_free_atb_index = 0;
+        #if MICROPY_GC_FREE_RUN_HINTS > 1
+        gc_free_run_hints_reset(area);
+        #endif
+        #if MICROPY_GC_SPLIT_HEAP
+        MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
+        #endif
+    }
+    return moved;
+}
+
+STATIC bool gc_compact_has_run(mp_state_mem_area_t *area, size_t n_blocks) {
+    size_t n_free = 0;
+    for (size_t block = 0; block < area->gc_alloc_table_byte_len * BLOCKS_PER_ATB; block++) {
+        MICROPY_GC_HOOK_LOOP(block);
+        if (ATB_GET_KIND(area, block) != AT_FREE) {
+            n_free = 0;
+        } else if (++n_free >= n_blocks) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Called when an allocation of n_blocks fails after a collection. Works down
+// from the top of each area, MICROPY_GC_COMPACT_CANDIDATES buffers per marking
+// pass, until there is a free run of n_blocks. Returns whether there is one.
+STATIC bool gc_compact(size_t n_blocks) {
+    gc_compact_t compact;
+    for (compact.area = &MP_STATE_MEM(area); compact.area != NULL; compact.area = NEXT_AREA(compact.area)) {
+        size_t limit = SIZE_MAX;
+        for (;;) {
+            GC_ENTER();
+            gc_compact_find_candidates(&compact, limit);
+            GC_EXIT();
+            if (compact.len == 0) {
+                break;
+            }
+            limit = compact.candidates[0].block;
+
+            gc_compact_mark(&compact);
+
+            GC_ENTER();
+            bool found = gc_compact_move(&compact) && gc_compact_has_run(compact.area, n_blocks);
+            GC_EXIT();
+            if (found) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+#endif
+
 void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
     bool has_finaliser = alloc_flags & GC_ALLOC_FLAG_HAS_FINALISER;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_SPLIT_HEAP
+    bool fast_only = alloc_flags & GC_ALLOC_FLAG_FAST;
+    #endif
     size_t n_blocks = ((n_bytes + BYTES_PER_BLOCK - 1) & (~(BYTES_PER_BLOCK - 1))) / BYTES_PER_BLOCK;
     DEBUG_printf("gc_alloc(" UINT_FMT " bytes -> " UINT_FMT " blocks)\n", n_bytes, n_blocks);
 
@@ -783,6 +1480,14 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
         return NULL;
     }
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_ARENA
+    gc_arena_t *arena = MP_STATE_THREAD(gc_arena);
+    if (arena != NULL && n_blocks <= arena->free_blocks) {
+        return gc_arena_take(arena, n_blocks, has_finaliser);
+    }
+    #endif
+
     GC_ENTER();
 
     mp_state_mem_area_t *area;
@@ -793,6 +1498,12 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
     int collected = !MP_STATE_MEM(gc_auto_collect_enabled);
     #if MICROPY_GC_SPLIT_HEAP_AUTO
     bool added = false;
+    // CIRCUITPY-CHANGE
+    bool added_fast = false;
+    #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_COMPACT
+    bool compacted = false;
     #endif
 
     #if MICROPY_GC_ALLOC_THRESHOLD
@@ -819,8 +1530,21 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
 
         // look for a run of n_blocks available blocks
         for (; area != NULL; area = NEXT_AREA(area), i = 0) {
+            // CIRCUITPY-CHANGE
+            #if MICROPY_GC_SPLIT_HEAP
+            if (fast_only && !area->fast) {
+                continue;
+            }
+            #endif
             n_free = 0;
-            for (i = area->gc_last_free_atb_index; i < area->gc_alloc_table_byte_len; i++) {
+            i = area->gc_last_free_atb_index;
+            // CIRCUITPY-CHANGE: skip space already known to lack a run this size
+            #if MICROPY_GC_FREE_RUN_HINTS > 1
+            if (n_blocks > 1 && n_blocks <= MICROPY_GC_FREE_RUN_HINTS) {
+                i = MAX(i, area->gc_free_run_atb_index[n_blocks - 2]);
+            }
+            #endif
+            for (; i < area->gc_alloc_table_byte_len; i++) {
                 MICROPY_GC_HOOK_LOOP(i);
                 byte a = area->gc_alloc_table_start[i];
                 // *FORMAT-OFF*
@@ -839,18 +1563,59 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
                 area->gc_last_free_atb_index = (i + 1) / BLOCKS_PER_ATB; // or (size_t)-1
             }
             #endif
+            // CIRCUITPY-CHANGE
+            #if MICROPY_GC_FREE_RUN_HINTS > 1
+            if (n_blocks > 1 && n_blocks <= MICROPY_GC_FREE_RUN_HINTS) {
+                area->gc_free_run_atb_index[n_blocks - 2] = area->gc_alloc_table_byte_len;
+            }
+            #endif
         }
 
         GC_EXIT();
+        // CIRCUITPY-CHANGE: garbage from the last collection may not be swept yet.
+        #if MICROPY_GC_INCREMENTAL_SWEEP
+        if (gc_sweep_finish()) {
+            GC_ENTER();
+            continue;
+        }
+        #endif
+        // CIRCUITPY-CHANGE: fast RAM is only a preference. Add a fast area if
+        // the port has room, otherwise search every area as usual. Either way
+        // don't collect just to find fast space.
+        #if MICROPY_GC_SPLIT_HEAP
+        if (fast_only) {
+            #if MICROPY_GC_SPLIT_HEAP_AUTO
+            if (!added_fast && gc_try_add_heap(n_bytes, true)) {
+                added_fast = true;
+                GC_ENTER();
+                continue;
+            }
+            #endif
+            fast_only = false;
+            GC_ENTER();
+            continue;
+        }
+        #endif
         // nothing found!
         if (collected) {
             #if MICROPY_GC_SPLIT_HEAP_AUTO
-            if (!added && gc_try_add_heap(n_bytes)) {
+            if (!added && gc_try_add_heap(n_bytes, false)) {
                 added = true;
                 continue;
             }
             #endif
 
+            // CIRCUITPY-CHANGE
+            #if MICROPY_GC_COMPACT
+            if (!compacted && MP_STATE_MEM(gc_auto_collect_enabled)) {
+                compacted = true;
+                if (gc_compact(n_blocks)) {
+                    GC_ENTER();
+                    continue;
+                }
+            }
+            #endif
+
             #if CIRCUITPY_DEBUG
             gc_dump_alloc_table(&mp_plat_print);
             #endif
@@ -875,20 +1640,45 @@ found:
     // if this index needs adjusting (see gc_realloc and gc_free).
     if (n_free == 1) {
         #if MICROPY_GC_SPLIT_HEAP
-        MP_STATE_MEM(gc_last_free_area) = area;
+        // CIRCUITPY-CHANGE: a fast only search skipped other areas, which may
+        // still have free blocks.
+        if (!fast_only) {
+            MP_STATE_MEM(gc_last_free_area) = area;
+        }
         #endif
         area->gc_last_free_atb_index = (i + 1) / BLOCKS_PER_ATB;
     }
 
+    // CIRCUITPY-CHANGE
+    // This was the first run of n_blocks free blocks, and it is about to be
+    // used, so the next search for this size can start after it.
+    #if MICROPY_GC_FREE_RUN_HINTS > 1
+    if (n_free > 1 && n_free <= MICROPY_GC_FREE_RUN_HINTS) {
+        area->gc_free_run_atb_index[n_free - 2] = (i + 1) / BLOCKS_PER_ATB;
+    }
+    #endif
+
     // CIRCUITPY-CHANGE
     #ifdef LOG_HEAP_ACTIVITY
     gc_log_change(start_block, end_block - start_block + 1);
     #endif
 
     area->gc_last_used_block = MAX(area->gc_last_used_block, end_block);
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    if (area == MP_STATE_MEM(gc_sweep_area)) {
+        MP_STATE_MEM(gc_sweep_last_used) = MAX(MP_STATE_MEM(gc_sweep_last_used), end_block);
+    }
+    #endif
 
     // mark first block as used head
     ATB_FREE_TO_HEAD(area, start_block);
+    // CIRCUITPY-CHANGE: keep it alive through the rest of a pending sweep
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    if (start_block >= area->gc_sweep_block) {
+        ATB_HEAD_TO_MARK(area, start_block);
+    }
+    #endif
 
     // mark rest of blocks as used tail
     // TODO for a run of many blocks can make this more efficient
@@ -988,7 +1778,8 @@ void gc_free(void *ptr) {
     #endif
 
     size_t block = BLOCK_FROM_PTR(area, ptr);
-    assert(ATB_GET_KIND(area, block) == AT_HEAD);
+    // CIRCUITPY-CHANGE
+    assert(ATB_IS_LIVE_HEAD(area, block));
 
     #if MICROPY_ENABLE_FINALISER
     FTB_CLEAR(area, block);
@@ -1013,6 +1804,10 @@ void gc_free(void *ptr) {
     if (block / BLOCKS_PER_ATB < area->gc_last_free_atb_index) {
         area->gc_last_free_atb_index = block / BLOCKS_PER_ATB;
     }
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_FREE_RUN_HINTS > 1
+    gc_free_run_hints_freed(area, block);
+    #endif
 
     // CIRCUITPY-CHANGE
     #ifdef LOG_HEAP_ACTIVITY
@@ -1048,7 +1843,8 @@ size_t gc_nbytes(const void *ptr) {
 
     if (area) {
         size_t block = BLOCK_FROM_PTR(area, ptr);
-        if (ATB_GET_KIND(area, block) == AT_HEAD) {
+        // CIRCUITPY-CHANGE
+        if (ATB_IS_LIVE_HEAD(area, block)) {
             // work out number of consecutive blocks in the chain starting with this on
             size_t n_blocks = 0;
             do {
@@ -1123,7 +1919,8 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
     area = &MP_STATE_MEM(area);
     #endif
     size_t block = BLOCK_FROM_PTR(area, ptr);
-    assert(ATB_GET_KIND(area, block) == AT_HEAD);
+    // CIRCUITPY-CHANGE
+    assert(ATB_IS_LIVE_HEAD(area, block));
 
     // compute number of new blocks that are requested
     size_t new_blocks = (n_bytes + BYTES_PER_BLOCK - 1) / BYTES_PER_BLOCK;
@@ -1178,6 +1975,10 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
         if ((block + new_blocks) / BLOCKS_PER_ATB < area->gc_last_free_atb_index) {
             area->gc_last_free_atb_index = (block + new_blocks) / BLOCKS_PER_ATB;
         }
+        // CIRCUITPY-CHANGE
+        #if MICROPY_GC_FREE_RUN_HINTS > 1
+        gc_free_run_hints_freed(area, block + new_blocks);
+        #endif
 
         GC_EXIT();
 
@@ -1207,6 +2008,12 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
         }
 
         area->gc_last_used_block = MAX(area->gc_last_used_block, end_block);
+        // CIRCUITPY-CHANGE
+        #if MICROPY_GC_INCREMENTAL_SWEEP
+        if (area == MP_STATE_MEM(gc_sweep_area)) {
+            MP_STATE_MEM(gc_sweep_last_used) = MAX(MP_STATE_MEM(gc_sweep_last_used), end_block - 1);
+        }
+        #endif
 
         GC_EXIT();
 
@@ -63,6 +63,32 @@ void gc_collect_ptr(void *ptr);
 void gc_collect_root(void **ptrs, size_t len);
 void gc_collect_end(void);
 
+// CIRCUITPY-CHANGE: A precise root outside the heap: count structs, stride bytes
+// apart, starting at base. Only the fields at offsets, which must hold pointers,
+// are traced, so the rest of each struct can't keep garbage alive. Registered
+// roots are traced by gc_collect_start() until they are unregistered, so both
+// the descriptor and the structs it describes must outlive the heap.
+typedef struct _gc_root_t {
+    struct _gc_root_t *next;
+    const void *base;
+    const uint16_t *offsets;
+    uint16_t num_offsets;
+    uint16_t stride;
+    uint16_t count;
+} gc_root_t;
+
+#define GC_ROOT(base_, type, count_, offsets_) { \
+        .base = (base_), \
+        .offsets = (offsets_), \
+        .num_offsets = MP_ARRAY_SIZE(offsets_), \
+        .stride = sizeof(type), \
+        .count = (count_), \
+}
+
+// Registering a root that is already registered does nothing.
+void gc_root_register(gc_root_t *root);
+void gc_root_unregister(gc_root_t *root);
+
 // CIRCUITPY-CHANGE
 // Is the gc heap available?
 bool gc_alloc_possible(void);
@@ -70,8 +96,25 @@ bool gc_alloc_possible(void);
 // Use this function to sweep the whole heap and run all finalisers
 void gc_sweep_all(void);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_INCREMENTAL_SWEEP
+// When the sweep budget is non-zero, gc_collect_end only marks; the sweep is
+// then done in slices by gc_sweep_step. Unswept garbage is not reusable until
+// its slice runs. A pending sweep is finished before the next collection,
+// before gc_info, and before gc_alloc gives up.
+void gc_set_sweep_budget_us(uint32_t budget_us);
+uint32_t gc_get_sweep_budget_us(void);
+// Sweeps about max_blocks blocks, without splitting a chain. Returns true if
+// more of the sweep is pending. Does nothing while the heap is locked.
+bool gc_sweep_step(size_t max_blocks);
+bool gc_sweep_pending(void);
+#endif
+
 enum {
     GC_ALLOC_FLAG_HAS_FINALISER = 1,
+    // CIRCUITPY-CHANGE: prefer heap areas in fast RAM. Falls back to any area
+    // rather than failing.
+    GC_ALLOC_FLAG_FAST = 2,
 };
 
 void *gc_alloc(size_t n_bytes, unsigned int alloc_flags);
@@ -80,6 +123,33 @@ size_t gc_nbytes(const void *ptr);
 bool gc_has_finaliser(const void *ptr);
 void *gc_realloc(void *ptr, size_t n_bytes, bool allow_move);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_ARENA
+// An arena reserves one contiguous run of blocks up front. While it is active,
+// gc_alloc carves allocations off the front of that run without searching the
+// allocation table, which keeps short-lived objects together instead of
+// scattering them through the heap. Every carved piece is an ordinary GC
+// object: it is freed by collection once unreferenced, so objects may safely
+// outlive the arena. Ending the arena returns the unused remainder to the heap.
+//
+// The arena struct must be visible to the GC (on the C stack, or inside a heap
+// object) for as long as it is active.
+typedef struct _gc_arena_t {
+    void *free; // Head block of the unused remainder, or NULL when used up.
+    size_t free_blocks;
+    struct _gc_arena_t *prev; // Arena that was active before this one.
+} gc_arena_t;
+
+// Reserves n_bytes and makes the arena active. Returns false if the
+// reservation failed; gc_alloc then behaves normally.
+bool gc_arena_begin(gc_arena_t *arena, size_t n_bytes);
+// Deactivates the arena and frees the unused remainder. Arenas must be ended
+// in the reverse order they were begun.
+void gc_arena_end(gc_arena_t *arena);
+// Number of bytes still available in the arena.
+size_t gc_arena_free_bytes(const gc_arena_t *arena);
+#endif
+
 // CIRCUITPY-CHANGE
 // Prevents a pointer from ever being freed because it establishes a permanent reference to it. Use
 // very sparingly because it can leak memory.
@@ -104,6 +174,13 @@ typedef struct _gc_info_t {
 } gc_info_t;
 
 void gc_info(gc_info_t *info);
+
+// CIRCUITPY-CHANGE
+// Calls callback for each chain of allocated blocks and each run of free
+// blocks, in address order, in a single pass over the allocation table. The
+// heap is locked meanwhile, so callback can't allocate.
+typedef void (*gc_walk_callback_t)(void *env, void *ptr, size_t n_blocks, bool is_free);
+void gc_walk(gc_walk_callback_t callback, void *env);
 void gc_dump_info(const mp_print_t *print);
 void gc_dump_alloc_table(const mp_print_t *print);
 
@@ -329,6 +329,45 @@ def compute_hash(qstr, bytes_hash):
     return (hash & ((1 << (8 * bytes_hash)) - 1)) or 1
 
 
+# CIRCUITPY-CHANGE: this must match qstr_compute_raw_hash in py/qstr.c
+def compute_raw_hash(qstr):
+    hash = 5381
+    for b in qstr:
+        hash = ((hash * 33) ^ b) & 0xFFFFFFFF
+    return hash
+
+
+# CIRCUITPY-CHANGE: this must match qstr_index_size in py/qstr.c
+def index_size(count):
+    size = 1
+    while size < count + count // 3 + 1:
+        size *= 2
+    return size
+
+
+# CIRCUITPY-CHANGE: djb2 keeps similar names close together so spread them out before
+# they pick a slot. This must match qstr_index_slot in py/qstr.c
+def index_slot(raw_hash, size):
+    h = raw_hash ^ (raw_hash >> 16)
+    h = (h * 0x45D9F3B) & 0xFFFFFFFF
+    h ^= h >> 16
+    return h & (size - 1)
+
+
+# CIRCUITPY-CHANGE: open-addressed index of (index in pool + 1) by raw hash with linear
+# probing, searched by qstr_find_strn in py/qstr.c. `first` is the pool index of the
+# first entry of qbytes_list.
+def make_index(qbytes_list, first=0):
+    size = index_size(first + len(qbytes_list))
+    index = [0] * size
+    for i, qbytes in enumerate(qbytes_list, first):
+        slot = index_slot(compute_raw_hash(qbytes), size)
+        while index[slot] != 0:
+            slot = (slot + 1) & (size - 1)
+        index[slot] = i + 1
+    return index
+
+
 def qstr_escape(qst):
     def esc_char(m):
         c = ord(m.group(0))
@@ -448,6 +487,8 @@ def print_qstr_data(qcfgs, qstrs, translations):
     # get config variables
     cfg_bytes_len = int(qcfgs["BYTES_IN_LEN"])
     cfg_bytes_hash = int(qcfgs["BYTES_IN_HASH"])
+    # CIRCUITPY-CHANGE
+    cfg_index = int(qcfgs.get("INDEX", "0").strip("() "))
 
     # print out the starter of the generated C header file
     print("// This file was automatically generated by makeqstrdata.py")
@@ -457,12 +498,23 @@ def print_qstr_data(qcfgs, qstrs, translations):
     print('QDEF(MP_QSTRnull, 0, 0, "")')
 
     total_qstr_size = 0
+    # CIRCUITPY-CHANGE
+    all_qbytes = []
     # go through each qstr and print it out
     for order, ident, qstr in sorted(qstrs.values(), key=lambda x: x[0]):
         qbytes = make_bytes(cfg_bytes_len, cfg_bytes_hash, qstr)
         print("QDEF(MP_QSTR_%s, %s)" % (ident, qbytes))
 
         total_qstr_size += len(qstr)
+        all_qbytes.append(bytes_cons(qstr, "utf8"))
+
+    # CIRCUITPY-CHANGE
+    if cfg_index:
+        print("#ifdef QINDEX")
+        # the null qstr is never looked up so it isn't indexed
+        for entry in make_index(all_qbytes, first=1):
+            print("QINDEX(%d)" % entry)
+        print("#endif")
 
     print(
         "// Enumerate translated texts but don't actually include translations. Instead, the linker will link them in."
@@ -83,6 +83,20 @@ STATIC size_t get_hash_alloc_greater_or_equal_to(size_t x) {
     return (x + x / 2) | 1;
 }
 
+// CIRCUITPY-CHANGE
+// Whether a hash table with alloc slots can hold used elements without going
+// over MICROPY_MAP_MAX_LOAD_PERCENT.
+#define MAP_HAS_ROOM_FOR(used, alloc) ((used) * 100 <= (alloc) * MICROPY_MAP_MAX_LOAD_PERCENT)
+
+// The size to grow a hash table to, so that it holds at least used elements.
+STATIC size_t get_hash_alloc_for(size_t alloc, size_t used) {
+    size_t new_alloc = get_hash_alloc_greater_or_equal_to(alloc + 1);
+    while (!MAP_HAS_ROOM_FOR(used, new_alloc)) {
+        new_alloc = get_hash_alloc_greater_or_equal_to(new_alloc + 1);
+    }
+    return new_alloc;
+}
+
 /******************************************************************************/
 /* map                                                                        */
 
@@ -128,9 +142,9 @@ void mp_map_clear(mp_map_t *map) {
     map->table = NULL;
 }
 
-STATIC void mp_map_rehash(mp_map_t *map) {
+// CIRCUITPY-CHANGE: takes the new size
+STATIC void mp_map_rehash(mp_map_t *map, size_t new_alloc) {
     size_t old_alloc = map->alloc;
-    size_t new_alloc = get_hash_alloc_greater_or_equal_to(map->alloc + 1);
     DEBUG_printf("mp_map_rehash(%p): " UINT_FMT " -> " UINT_FMT "\n", map, old_alloc, new_alloc);
     mp_map_elem_t *old_table = map->table;
     mp_map_elem_t *new_table = m_new0(mp_map_elem_t, new_alloc);
@@ -147,6 +161,20 @@ STATIC void mp_map_rehash(mp_map_t *map) {
     m_del(mp_map_elem_t, old_table, old_alloc);
 }
 
+// CIRCUITPY-CHANGE
+void mp_map_reserve(mp_map_t *map, size_t n) {
+    assert(!map->is_fixed);
+    if (map->is_ordered) {
+        if (map->alloc < n) {
+            map->table = m_renew(mp_map_elem_t, map->table, map->alloc, n);
+            mp_seq_clear(map->table, map->used, n, sizeof(*map->table));
+            map->alloc = n;
+        }
+    } else if (!MAP_HAS_ROOM_FOR(n, map->alloc)) {
+        mp_map_rehash(map, get_hash_alloc_for(map->alloc, n));
+    }
+}
+
 // MP_MAP_LOOKUP behaviour:
 //  - returns NULL if not found, else the slot it was found in with key,value non-null
 // MP_MAP_LOOKUP_ADD_IF_NOT_FOUND behaviour:
@@ -235,7 +263,7 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
 
     if (map->alloc == 0) {
         if (lookup_kind == MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
-            mp_map_rehash(map);
+            mp_map_rehash(map, get_hash_alloc_for(0, 1));
         } else {
             return NULL;
         }
@@ -257,6 +285,15 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
         if (slot->key == MP_OBJ_NULL) {
             // found NULL slot, so index is not in table
             if (lookup_kind == MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
+                // CIRCUITPY-CHANGE: grow the table before it gets too full
+                #if MICROPY_MAP_MAX_LOAD_PERCENT < 100
+                if (!MAP_HAS_ROOM_FOR(map->used + 1, map->alloc)) {
+                    mp_map_rehash(map, get_hash_alloc_for(map->alloc, map->used + 1));
+                    start_pos = pos = hash % map->alloc;
+                    avail_slot = NULL;
+                    continue;
+                }
+                #endif
                 map->used += 1;
                 if (avail_slot == NULL) {
                     avail_slot = slot;
@@ -310,7 +347,7 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
                     return avail_slot;
                 } else {
                     // not enough room in table, rehash it
-                    mp_map_rehash(map);
+                    mp_map_rehash(map, get_hash_alloc_for(map->alloc, map->used + 1));
                     // restart the search for the new element
                     start_pos = pos = hash % map->alloc;
                 }
@@ -321,6 +358,31 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
     }
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_INLINE_CACHE
+#define MAP_CACHE_SITE_ID(map) (~(uintptr_t)(map))
+
+mp_map_elem_t *mp_map_lookup_cached(mp_map_t *map, mp_obj_t index, mp_map_cache_site_t *site) {
+    uintptr_t map_id = MAP_CACHE_SITE_ID(map);
+    size_t limit = map->is_ordered ? map->used : map->alloc;
+    for (size_t i = 0; i < 2; i++) {
+        size_t pos = site->pos[i];
+        if (site->map_id[i] == map_id && pos < limit && map->table[pos].key == index) {
+            return &map->table[pos];
+        }
+    }
+    mp_map_elem_t *elem = mp_map_lookup(map, index, MP_MAP_LOOKUP);
+    if (elem != NULL && (size_t)(elem - map->table) <= UINT16_MAX) {
+        // Keep the most recent map first; the older one moves to the second way.
+        site->map_id[1] = site->map_id[0];
+        site->pos[1] = site->pos[0];
+        site->map_id[0] = map_id;
+        site->pos[0] = elem - map->table;
+    }
+    return elem;
+}
+#endif
+
 /******************************************************************************/
 /* set                                                                        */
 
@@ -335,7 +397,8 @@ void mp_set_init(mp_set_t *set, size_t n) {
 STATIC void mp_set_rehash(mp_set_t *set) {
     size_t old_alloc = set->alloc;
     mp_obj_t *old_table = set->table;
-    set->alloc = get_hash_alloc_greater_or_equal_to(set->alloc + 1);
+    // CIRCUITPY-CHANGE
+    set->alloc = get_hash_alloc_for(set->alloc, set->used + 1);
     set->used = 0;
     set->table = m_new0(mp_obj_t, set->alloc);
     for (size_t i = 0; i < old_alloc; i++) {
@@ -366,6 +429,15 @@ mp_obj_t mp_set_lookup(mp_set_t *set, mp_obj_t index, mp_map_lookup_kind_t looku
         if (elem == MP_OBJ_NULL) {
             // found NULL slot, so index is not in table
             if (lookup_kind & MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
+                // CIRCUITPY-CHANGE: grow the table before it gets too full
+                #if MICROPY_MAP_MAX_LOAD_PERCENT < 100
+                if (!MAP_HAS_ROOM_FOR(set->used + 1, set->alloc)) {
+                    mp_set_rehash(set);
+                    start_pos = pos = hash % set->alloc;
+                    avail_slot = NULL;
+                    continue;
+                }
+                #endif
                 if (avail_slot == NULL) {
                     avail_slot = &set->table[pos];
                 }
@@ -101,6 +101,8 @@ typedef unsigned int uint;
 void *m_malloc(size_t num_bytes);
 void *m_malloc_maybe(size_t num_bytes);
 void *m_malloc_with_finaliser(size_t num_bytes);
+// CIRCUITPY-CHANGE: prefer fast RAM, for buffers that are accessed often or by DMA
+void *m_malloc_fast(size_t num_bytes);
 void *m_malloc0(size_t num_bytes);
 #if MICROPY_MALLOC_USES_ALLOCATED_SIZE
 void *m_realloc(void *ptr, size_t old_num_bytes, size_t new_num_bytes);
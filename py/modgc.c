@@ -27,6 +27,8 @@
 #include "py/mpstate.h"
 #include "py/obj.h"
 #include "py/gc.h"
+// CIRCUITPY-CHANGE
+#include "py/runtime.h"
 
 #if MICROPY_PY_GC && MICROPY_ENABLE_GC
 
@@ -100,6 +102,83 @@ STATIC mp_obj_t gc_threshold(size_t n_args, const mp_obj_t *args) {
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_threshold_obj, 0, 1, gc_threshold);
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_INCREMENTAL_SWEEP
+// sweep_budget([us]): get or set the time slice for incremental sweeping
+STATIC mp_obj_t gc_sweep_budget(size_t n_args, const mp_obj_t *args) {
+    if (n_args == 0) {
+        return mp_obj_new_int_from_uint(gc_get_sweep_budget_us());
+    }
+    mp_int_t val = mp_obj_get_int(args[0]);
+    if (val < 0) {
+        mp_raise_ValueError(NULL);
+    }
+    gc_set_sweep_budget_us(val);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_sweep_budget_obj, 0, 1, gc_sweep_budget);
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_ARENA
+typedef struct _mp_obj_gc_arena_t {
+    mp_obj_base_t base;
+    gc_arena_t arena;
+    size_t size;
+} mp_obj_gc_arena_t;
+
+STATIC mp_obj_t gc_arena_enter(mp_obj_t self_in) {
+    mp_obj_gc_arena_t *self = MP_OBJ_TO_PTR(self_in);
+    if (!gc_arena_begin(&self->arena, self->size)) {
+        m_malloc_fail(self->size);
+    }
+    return self_in;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(gc_arena_enter_obj, gc_arena_enter);
+
+STATIC mp_obj_t gc_arena_exit(size_t n_args, const mp_obj_t *args) {
+    mp_obj_gc_arena_t *self = MP_OBJ_TO_PTR(args[0]);
+    gc_arena_end(&self->arena);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_arena_exit_obj, 4, 4, gc_arena_exit);
+
+STATIC mp_obj_t gc_arena_mem_free(mp_obj_t self_in) {
+    mp_obj_gc_arena_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(gc_arena_free_bytes(&self->arena));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(gc_arena_mem_free_obj, gc_arena_mem_free);
+
+STATIC const mp_rom_map_elem_t gc_arena_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&gc_arena_enter_obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&gc_arena_exit_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mem_free), MP_ROM_PTR(&gc_arena_mem_free_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(gc_arena_locals_dict, gc_arena_locals_dict_table);
+
+STATIC MP_DEFINE_CONST_OBJ_TYPE(
+    mp_type_gc_arena,
+    MP_QSTR_arena,
+    MP_TYPE_FLAG_NONE,
+    locals_dict, &gc_arena_locals_dict
+    );
+
+// arena(size): context manager that bump-allocates from a size byte reservation
+STATIC mp_obj_t gc_arena(mp_obj_t size_in) {
+    mp_int_t size = mp_obj_get_int(size_in);
+    if (size <= 0) {
+        mp_raise_ValueError(NULL);
+    }
+    mp_obj_gc_arena_t *self = mp_obj_malloc(mp_obj_gc_arena_t, &mp_type_gc_arena);
+    self->arena.free = NULL;
+    self->arena.free_blocks = 0;
+    self->arena.prev = NULL;
+    self->size = size;
+    return MP_OBJ_FROM_PTR(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gc_arena_obj, gc_arena);
+#endif
+
 STATIC const mp_rom_map_elem_t mp_module_gc_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_gc) },
     { MP_ROM_QSTR(MP_QSTR_collect), MP_ROM_PTR(&gc_collect_obj) },
@@ -111,6 +190,13 @@ STATIC const mp_rom_map_elem_t mp_module_gc_globals_table[] = {
     #if MICROPY_GC_ALLOC_THRESHOLD
     { MP_ROM_QSTR(MP_QSTR_threshold), MP_ROM_PTR(&gc_threshold_obj) },
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_ARENA
+    { MP_ROM_QSTR(MP_QSTR_arena), MP_ROM_PTR(&gc_arena_obj) },
+    #endif
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    { MP_ROM_QSTR(MP_QSTR_sweep_budget), MP_ROM_PTR(&gc_sweep_budget_obj) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_gc_globals, mp_module_gc_globals_table);
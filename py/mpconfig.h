@@ -195,6 +195,61 @@
 #define MICROPY_GC_ALLOC_THRESHOLD (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_CORE_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Support arenas: a contiguous reservation of GC blocks that allocations are
+// bump-allocated from while the arena is active, via gc.arena().
+#ifndef MICROPY_GC_ARENA
+#define MICROPY_GC_ARENA (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
+// CIRCUITPY-CHANGE
+// Largest allocation, in blocks, that gets its own free-run search hint. Each
+// size from 2 up to this value remembers where its last search ended so that
+// small multi-block allocations don't rescan fragmented space. 0 disables.
+#ifndef MICROPY_GC_FREE_RUN_HINTS
+#define MICROPY_GC_FREE_RUN_HINTS (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES ? 8 : 0)
+#endif
+
+// CIRCUITPY-CHANGE
+// Support deferring the sweep phase of a collection and running it in bounded
+// slices, configured by gc.sweep_budget().
+#ifndef MICROPY_GC_INCREMENTAL_SWEEP
+#define MICROPY_GC_INCREMENTAL_SWEEP (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
+// CIRCUITPY-CHANGE
+// When an allocation fails even after a collection, try moving list, dict,
+// bytearray, str and bytes buffers down the heap to make a large enough free
+// run. Only buffers that nothing but their owner points to are moved.
+#ifndef MICROPY_GC_COMPACT
+#define MICROPY_GC_COMPACT (0)
+#endif
+
+// Number of buffers gc_compact() considers per marking pass.
+#ifndef MICROPY_GC_COMPACT_CANDIDATES
+#define MICROPY_GC_COMPACT_CANDIDATES (32)
+#endif
+
+// CIRCUITPY-CHANGE
+// Keep finished generators that were only ever referenced by an await or yield
+// from, and reuse their memory for the next generator of the same size. The
+// pool is emptied by every collection so it never holds heap memory for long.
+// Incompatible with sys.settrace, whose frames can outlive the generator, and
+// with threads that run without the GIL because the pool is shared.
+#ifndef MICROPY_GEN_POOL
+#define MICROPY_GEN_POOL (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES && !MICROPY_PY_SYS_SETTRACE && !(MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL))
+#endif
+
+// Number of pooled size classes: class n holds generators of n GC blocks.
+#ifndef MICROPY_GEN_POOL_CLASSES
+#define MICROPY_GEN_POOL_CLASSES (8)
+#endif
+
+// Number of finished generators kept per size class.
+#ifndef MICROPY_GEN_POOL_DEPTH
+#define MICROPY_GEN_POOL_DEPTH (4)
+#endif
+
 // Number of bytes to allocate initially when creating new chunks to store
 // interned string data.  Smaller numbers lead to more chunks being needed
 // and more wastage at the end of the chunk.  Larger numbers lead to wasted
@@ -292,6 +347,18 @@
 #endif
 #endif
 
+// CIRCUITPY-CHANGE
+// Keep an open-addressed hash index with each qstr pool so that looking up a
+// string doesn't compare it against every interned qstr. The index for the ROM
+// pool is generated by makeqstrdata.py and costs 2 bytes per slot of flash.
+#ifndef MICROPY_QSTR_INDEX
+#if MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES
+#define MICROPY_QSTR_INDEX (1)
+#else
+#define MICROPY_QSTR_INDEX (0)
+#endif
+#endif
+
 // Avoid using C stack when making Python function calls. C stack still
 // may be used if there's no free heap.
 #ifndef MICROPY_STACKLESS
@@ -323,6 +390,22 @@
 #define MICROPY_PERSISTENT_CODE_LOAD (0)
 #endif
 
+// CIRCUITPY-CHANGE: Whether .mpy files read from memory that stays mapped for
+// the life of the VM (e.g. XIP flash) are loaded in place: bytecode, qstr data
+// and str/bytes constants are referenced rather than copied to the heap, the
+// way frozen modules are. Applies to readers created with MP_READER_IS_ROM.
+#ifndef MICROPY_PERSISTENT_CODE_LOAD_ROM
+#define MICROPY_PERSISTENT_CODE_LOAD_ROM (0)
+#endif
+
+// CIRCUITPY-CHANGE: Whether .mpy files whose contents are deflate compressed
+// (made by tools/mpy_compress.py) can be loaded. They are inflated as they
+// are read, straight into the buffers being loaded. Requires uzlib to be
+// linked in, e.g. by MICROPY_PY_ZLIB.
+#ifndef MICROPY_PERSISTENT_CODE_LOAD_COMPRESSED
+#define MICROPY_PERSISTENT_CODE_LOAD_COMPRESSED (0)
+#endif
+
 // Whether to support saving of persistent code, i.e. for mpy-cross to
 // generate .mpy files. Enabling this enables additional metadata on raw code
 // objects which is also required for sys.settrace.
@@ -335,6 +418,26 @@
 #define MICROPY_PERSISTENT_CODE_SAVE_FILE (0)
 #endif
 
+// CIRCUITPY-CHANGE: Whether imported .py files are saved as .mpy files in
+// MICROPY_MODULE_IMPORT_CACHE_DIR after compiling them, and later imports load
+// the .mpy instead while the source file's size and mtime are unchanged.
+// Requires MICROPY_PERSISTENT_CODE_SAVE, MICROPY_PERSISTENT_CODE_LOAD and MICROPY_VFS.
+#ifndef MICROPY_MODULE_IMPORT_CACHE
+#define MICROPY_MODULE_IMPORT_CACHE (0)
+#endif
+
+#ifndef MICROPY_MODULE_IMPORT_CACHE_DIR
+#define MICROPY_MODULE_IMPORT_CACHE_DIR "/.mpycache"
+#endif
+
+// CIRCUITPY-CHANGE: Whether imported .py files are also kept as .mpy data in memory
+// that outlives the VM, through mp_import_cache_warm_lookup() and
+// mp_import_cache_warm_store(), which the port provides. Works with or without
+// MICROPY_MODULE_IMPORT_CACHE. Requires MICROPY_PERSISTENT_CODE_SAVE and MICROPY_VFS.
+#ifndef MICROPY_MODULE_IMPORT_CACHE_WARM
+#define MICROPY_MODULE_IMPORT_CACHE_WARM (0)
+#endif
+
 // Whether generated code can persist independently of the VM/runtime instance
 // This is enabled automatically when needed by other features
 #ifndef MICROPY_PERSISTENT_CODE
@@ -425,6 +528,14 @@
 #endif
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether the BSS/rodata of viper code loaded from .mpy files is explicitly tracked so
+// that the GC cannot reclaim it. Needed when MP_PLAT_COMMIT_EXEC copies the code to
+// memory the GC doesn't trace, because the code is then the only reference to it.
+#ifndef MICROPY_PERSISTENT_CODE_TRACK_BSS_RODATA
+#define MICROPY_PERSISTENT_CODE_TRACK_BSS_RODATA (0)
+#endif
+
 /*****************************************************************************/
 /* Compiler configuration                                                    */
 
@@ -569,6 +680,57 @@
 #define MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE (128)
 #endif
 
+// CIRCUITPY-CHANGE
+// How full, in percent, a dict or set hash table may get before adding to it
+// grows the table. At 100 a table only grows once it is completely full, which
+// uses the least RAM; lower values keep the linear probe sequences short, at
+// the cost of more empty slots.
+#ifndef MICROPY_MAP_MAX_LOAD_PERCENT
+#define MICROPY_MAP_MAX_LOAD_PERCENT (100)
+#endif
+
+// CIRCUITPY-CHANGE
+// Give each bytecode function a small table of lookup caches for its name,
+// global, attribute and method loads, so that repeated lookups in module,
+// instance and native type namespaces from the same place skip map searches.
+// Costs MICROPY_OPT_INLINE_CACHE_SITES * 3 words of RAM per function, allocated
+// the first time the function does a cached lookup.
+#ifndef MICROPY_OPT_INLINE_CACHE
+#define MICROPY_OPT_INLINE_CACHE (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
+// Number of cache sites per function; load sites share them by bytecode offset.
+#ifndef MICROPY_OPT_INLINE_CACHE_SITES
+#define MICROPY_OPT_INLINE_CACHE_SITES (8)
+#endif
+
+// CIRCUITPY-CHANGE
+// Have the bytecode emitter fuse the most frequent opcode sequences (such as
+// two local loads, or a comparison and the jump that tests it) into single
+// superinstructions, and have the VM execute them. Saves a dispatch for each
+// fused opcode; the bytecode size is unchanged. .mpy files that use them are
+// marked and are rejected by builds without this option.
+#ifndef MICROPY_OPT_BC_SUPERINSTRUCTIONS
+#define MICROPY_OPT_BC_SUPERINSTRUCTIONS (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether the bytecode emitter, when compiling at optimisation level 2 or
+// above, sends a jump whose target is itself an unconditional jump straight to
+// the final destination. Saves the extra dispatch at the end of every nested
+// if/elif block and loop. Costs a label-sized array during compilation.
+#ifndef MICROPY_OPT_BC_JUMP_THREADING
+#define MICROPY_OPT_BC_JUMP_THREADING (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether the VM evaluates comparisons, add/subtract, shifts and bitwise ops
+// on two small ints inline instead of calling mp_binary_op. Costs a few
+// hundred bytes of code in the VM loop.
+#ifndef MICROPY_OPT_VM_SMALL_INT_BINARY_OP
+#define MICROPY_OPT_VM_SMALL_INT_BINARY_OP (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 // Whether to use fast versions of bitwise operations (and, or, xor) when the
 // arguments are both positive.  Increases Thumb2 code size by about 250 bytes.
 #ifndef MICROPY_OPT_MPZ_BITWISE
@@ -692,6 +854,23 @@
 #endif
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether StopIteration() and OSError(ETIMEDOUT) / OSError(EAGAIN), which
+// polling loops tend to raise and catch on every pass, reuse preallocated
+// instances (like KeyboardInterrupt does) instead of allocating an exception,
+// argument tuple and traceback each time. The cost is that such an exception
+// is only valid until the next one of the same kind is raised: code that keeps
+// a reference to it will see its traceback and context change.
+#ifndef MICROPY_PREALLOCATED_EXCEPTIONS
+#define MICROPY_PREALLOCATED_EXCEPTIONS (0)
+#endif
+
+// Number of traceback entries a preallocated exception can hold; frames
+// further out than this are not recorded.
+#ifndef MICROPY_PREALLOCATED_EXCEPTION_TRACEBACK_DEPTH
+#define MICROPY_PREALLOCATED_EXCEPTION_TRACEBACK_DEPTH (4)
+#endif
+
 // Whether to provide the mp_kbd_exception object, and micropython.kbd_intr function
 #ifndef MICROPY_KBD_EXCEPTION
 #define MICROPY_KBD_EXCEPTION (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
@@ -857,6 +1036,14 @@ typedef double mp_float_t;
 #define MICROPY_FLOAT_HIGH_QUALITY_HASH (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EVERYTHING)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether float formatting and parsing take powers of ten from a table rather
+// than calling pow(), which formatting does once per digit. Costs 156 bytes
+// with single precision floats and 184 bytes with double precision.
+#ifndef MICROPY_FLOAT_POW10_TABLE
+#define MICROPY_FLOAT_POW10_TABLE (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 // Enable features which improve CPython compatibility
 // but may lead to more code size/memory usage.
 // TODO: Originally intended as generic category to not
@@ -1002,6 +1189,18 @@ typedef double mp_float_t;
 #define MICROPY_VFS_FAT (0)
 #endif
 
+// CIRCUITPY-CHANGE: Number of recent import_stat() results to keep for each FAT
+// filesystem. Each takes MICROPY_VFS_FAT_IMPORT_STAT_CACHE_PATH_LEN bytes.
+#ifndef MICROPY_VFS_FAT_IMPORT_STAT_CACHE
+#define MICROPY_VFS_FAT_IMPORT_STAT_CACHE (0)
+#endif
+
+// CIRCUITPY-CHANGE: Longest path, including the terminating NUL, whose
+// import_stat() result is kept. Longer paths are always looked up.
+#ifndef MICROPY_VFS_FAT_IMPORT_STAT_CACHE_PATH_LEN
+#define MICROPY_VFS_FAT_IMPORT_STAT_CACHE_PATH_LEN (56)
+#endif
+
 // Support for VFS LittleFS v1 component, to mount a LFSv1 filesystem within VFS
 #ifndef MICROPY_VFS_LFS1
 #define MICROPY_VFS_LFS1 (0)
@@ -1308,6 +1507,14 @@ typedef double mp_float_t;
 #define MICROPY_PY_ARRAY_SLICE_ASSIGN (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether array has fill(), sum(), min(), max(), scale(), add() and clip()
+// methods, which work on every element without boxing them (MicroPython
+// extension). Adds ~1.5K of code.
+#ifndef MICROPY_PY_ARRAY_BULK_OPS
+#define MICROPY_PY_ARRAY_BULK_OPS (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 // Whether to support attrtuple type (MicroPython extension)
 // It provides space-efficient tuples with attribute access
 #ifndef MICROPY_PY_ATTRTUPLE
@@ -1500,6 +1707,14 @@ typedef double mp_float_t;
 #define MICROPY_PY_SYS_SETTRACE (0)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether the VM keeps MP_STATE_THREAD(current_code_state) pointing at the
+// innermost running bytecode function, so that it can be sampled from an
+// interrupt by a profiler. sys.settrace does this already.
+#ifndef MICROPY_TRACK_CURRENT_CODE_STATE
+#define MICROPY_TRACK_CURRENT_CODE_STATE (MICROPY_PY_SYS_SETTRACE)
+#endif
+
 // Whether to provide "sys.getsizeof" function
 #ifndef MICROPY_PY_SYS_GETSIZEOF
 #define MICROPY_PY_SYS_GETSIZEOF (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EVERYTHING)
@@ -1665,6 +1880,12 @@ typedef double mp_float_t;
 #define MICROPY_PY_RE_SUB (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE: number of compiled patterns that re.compile and the module
+// level re functions keep for reuse. 0 disables the cache.
+#ifndef MICROPY_PY_RE_CACHE_SIZE
+#define MICROPY_PY_RE_CACHE_SIZE (MICROPY_PY_RE ? 4 : 0)
+#endif
+
 #ifndef MICROPY_PY_HEAPQ
 #define MICROPY_PY_HEAPQ (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
@@ -1962,6 +2183,19 @@ typedef double mp_float_t;
 #ifndef MP_PLAT_FREE_HEAP
 #define MP_PLAT_FREE_HEAP(ptr) free(ptr)
 #endif
+// CIRCUITPY-CHANGE: allocate a heap area in the port's fastest RAM, for
+// allocations made with GC_ALLOC_FLAG_FAST.
+#ifndef MP_PLAT_ALLOC_HEAP_FAST
+#define MP_PLAT_ALLOC_HEAP_FAST(size) MP_PLAT_ALLOC_HEAP(size)
+#endif
+#endif
+
+// CIRCUITPY-CHANGE: whether a heap area starting at ptr is in the port's fastest
+// RAM. Ports with slow external RAM use this to steer GC_ALLOC_FLAG_FAST allocations.
+#if MICROPY_GC_SPLIT_HEAP
+#ifndef MP_PLAT_HEAP_IS_FAST
+#define MP_PLAT_HEAP_IS_FAST(ptr) (1)
+#endif
 #endif
 
 // This macro is used to do all output (except when MICROPY_PY_IO is defined)
@@ -73,6 +73,8 @@ typedef struct mp_dynamic_compiler_t {
     uint8_t small_int_bits; // must be <= host small_int_bits
     uint8_t native_arch;
     uint8_t nlr_buf_num_regs;
+    // CIRCUITPY-CHANGE
+    bool superinstructions; // emit MICROPY_OPT_BC_SUPERINSTRUCTIONS opcodes
 } mp_dynamic_compiler_t;
 extern mp_dynamic_compiler_t mp_dynamic_compiler;
 #endif
@@ -92,6 +94,8 @@ typedef struct _mp_sched_item_t {
 typedef struct _mp_state_mem_area_t {
     #if MICROPY_GC_SPLIT_HEAP
     struct _mp_state_mem_area_t *next;
+    // CIRCUITPY-CHANGE: area is in fast RAM, see MP_PLAT_HEAP_IS_FAST
+    bool fast;
     #endif
 
     byte *gc_alloc_table_start;
@@ -103,6 +107,16 @@ typedef struct _mp_state_mem_area_t {
     byte *gc_pool_end;
 
     size_t gc_last_free_atb_index;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_FREE_RUN_HINTS > 1
+    // gc_free_run_atb_index[n - 2] is the ATB index before which there is no
+    // run of n free blocks.
+    size_t gc_free_run_atb_index[MICROPY_GC_FREE_RUN_HINTS - 1];
+    #endif
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    // First block not yet reached by a pending sweep; SIZE_MAX when none.
+    size_t gc_sweep_block;
+    #endif
     size_t gc_last_used_block; // The block ID of the highest block allocated in the area
 } mp_state_mem_area_t;
 
@@ -141,6 +155,20 @@ typedef struct _mp_state_mem_t {
     size_t gc_collected;
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    // Area currently being swept incrementally, or NULL when no sweep is pending.
+    mp_state_mem_area_t *gc_sweep_area;
+    size_t gc_sweep_last_used;
+    uint32_t gc_sweep_budget_us;
+    #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_COMPACT
+    // Buffers gc_compact() is considering; non-NULL only while it marks.
+    struct _gc_compact_t *gc_compact;
+    #endif
+
     #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
     // This is a global mutex used to make the GC thread-safe.
     mp_thread_mutex_t gc_mutex;
@@ -191,6 +219,12 @@ typedef struct _mp_state_vm_t {
     // exception object of type ReloadException
     mp_obj_exception_t mp_reload_exception;
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PREALLOCATED_EXCEPTIONS
+    // reused exception objects, indexed by MP_PREALLOCATED_EXC_xxx
+    mp_obj_exception_t mp_preallocated_exception[MP_PREALLOCATED_EXC_NUM];
+    #endif
+
     // dictionary with loaded modules (may be exposed as sys.modules)
     mp_obj_dict_t mp_loaded_modules_dict;
 
@@ -231,6 +265,13 @@ typedef struct _mp_state_vm_t {
     #endif
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PREALLOCATED_EXCEPTIONS
+    // traceback storage for the preallocated exception objects
+    mp_obj_traceback_t mp_preallocated_traceback[MP_PREALLOCATED_EXC_NUM];
+    size_t mp_preallocated_traceback_data[MP_PREALLOCATED_EXC_NUM][MICROPY_PREALLOCATED_EXCEPTION_TRACEBACK_DEPTH * 3];
+    #endif
+
     // size of the emergency exception buf, if it's dynamically allocated
     #if MICROPY_ENABLE_EMERGENCY_EXCEPTION_BUF && MICROPY_EMERGENCY_EXCEPTION_BUF_SIZE == 0
     mp_int_t mp_emergency_exception_buf_size;
@@ -310,9 +351,18 @@ typedef struct _mp_state_thread_t {
     // If MP_OBJ_STOP_ITERATION is propagated then this holds its argument.
     mp_obj_t stop_iteration_arg;
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_ARENA
+    // Arena that gc_alloc takes blocks from before searching the heap.
+    struct _gc_arena_t *gc_arena;
+    #endif
+
     #if MICROPY_PY_SYS_SETTRACE
     mp_obj_t prof_trace_callback;
     bool prof_callback_is_executing;
+    #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_TRACK_CURRENT_CODE_STATE
     struct _mp_code_state_t *current_code_state;
     #endif
 
@@ -461,6 +461,139 @@ STATIC size_t mpn_mul(mpz_dig_t *idig, mpz_dig_t *jdig, size_t jlen, mpz_dig_t *
     return ilen;
 }
 
+// CIRCUITPY-CHANGE: Karatsuba multiplication for large operands
+
+/* computes i = i + j
+   returns the carry out of the top digit of i
+   assumes ilen >= jlen
+*/
+STATIC mpz_dig_t mpn_add_inpl(mpz_dig_t *idig, size_t ilen, const mpz_dig_t *jdig, size_t jlen) {
+    mpz_dbl_dig_t carry = 0;
+
+    ilen -= jlen;
+
+    for (; jlen > 0; --jlen, ++idig, ++jdig) {
+        carry += (mpz_dbl_dig_t)*idig + (mpz_dbl_dig_t)*jdig;
+        *idig = carry & DIG_MASK;
+        carry >>= DIG_SIZE;
+    }
+
+    for (; ilen > 0 && carry != 0; --ilen, ++idig) {
+        carry += *idig;
+        *idig = carry & DIG_MASK;
+        carry >>= DIG_SIZE;
+    }
+
+    return carry;
+}
+
+/* computes i = i - j
+   assumes ilen >= jlen; assumes i >= j
+*/
+STATIC void mpn_sub_inpl(mpz_dig_t *idig, size_t ilen, const mpz_dig_t *jdig, size_t jlen) {
+    mpz_dbl_dig_signed_t borrow = 0;
+
+    ilen -= jlen;
+
+    for (; jlen > 0; --jlen, ++idig, ++jdig) {
+        borrow += (mpz_dbl_dig_t)*idig - (mpz_dbl_dig_t)*jdig;
+        *idig = borrow & DIG_MASK;
+        borrow >>= DIG_SIZE;
+    }
+
+    for (; ilen > 0 && borrow != 0; --ilen, ++idig) {
+        borrow += *idig;
+        *idig = borrow & DIG_MASK;
+        borrow >>= DIG_SIZE;
+    }
+}
+
+/* returns the number of scratch digits mpn_mul_karatsuba needs for n digit operands
+*/
+STATIC size_t mpn_karatsuba_scratch(size_t n) {
+    size_t need = 0;
+    while (n >= MPZ_KARATSUBA_THRESHOLD) {
+        n = n - n / 2 + 1;
+        need += 4 * n;
+    }
+    return need;
+}
+
+/* computes i = j * k where j and k are both n digits long
+   writes all 2n digits of i; j, k need not be normalised
+   assumes scratch has mpn_karatsuba_scratch(n) digits
+   can have j, k point to same memory
+*/
+STATIC void mpn_mul_karatsuba(mpz_dig_t *idig, mpz_dig_t *jdig, mpz_dig_t *kdig, size_t n, mpz_dig_t *scratch) {
+    if (n < MPZ_KARATSUBA_THRESHOLD) {
+        memset(idig, 0, 2 * n * sizeof(mpz_dig_t));
+        mpn_mul(idig, jdig, n, kdig, n);
+        return;
+    }
+
+    // split j = j1 * B^lo + j0 and k = k1 * B^lo + k0
+    size_t lo = n / 2;
+    size_t hi = n - lo;
+
+    // low half of i is j0 * k0, high half is j1 * k1
+    mpn_mul_karatsuba(idig, jdig, kdig, lo, scratch);
+    mpn_mul_karatsuba(idig + 2 * lo, jdig + lo, kdig + lo, hi, scratch);
+
+    // middle term is (j0 + j1) * (k0 + k1) - j0 * k0 - j1 * k1
+    mpz_dig_t *jsum = scratch;
+    mpz_dig_t *ksum = jsum + hi + 1;
+    mpz_dig_t *mid = ksum + hi + 1;
+    memcpy(jsum, jdig + lo, hi * sizeof(mpz_dig_t));
+    jsum[hi] = mpn_add_inpl(jsum, hi, jdig, lo);
+    memcpy(ksum, kdig + lo, hi * sizeof(mpz_dig_t));
+    ksum[hi] = mpn_add_inpl(ksum, hi, kdig, lo);
+    mpn_mul_karatsuba(mid, jsum, ksum, hi + 1, mid + 2 * (hi + 1));
+    mpn_sub_inpl(mid, 2 * (hi + 1), idig, 2 * lo);
+    mpn_sub_inpl(mid, 2 * (hi + 1), idig + 2 * lo, 2 * hi);
+
+    // the middle term is less than 2 * B^n so fits in n + 1 digits
+    mpn_add_inpl(idig + lo, 2 * n - lo, mid, n + 1);
+}
+
+/* computes i = j * k
+   returns number of digits in i
+   assumes enough memory in i; assumes normalised j, k
+   can have j, k point to same memory
+*/
+STATIC size_t mpn_mul_fast(mpz_dig_t *idig, mpz_dig_t *jdig, size_t jlen, mpz_dig_t *kdig, size_t klen) {
+    if (jlen < klen) {
+        mpz_dig_t *t = jdig;
+        jdig = kdig;
+        kdig = t;
+        size_t tlen = jlen;
+        jlen = klen;
+        klen = tlen;
+    }
+
+    memset(idig, 0, (jlen + klen) * sizeof(mpz_dig_t));
+
+    if (klen < MPZ_KARATSUBA_THRESHOLD) {
+        return mpn_mul(idig, jdig, jlen, kdig, klen);
+    }
+
+    // multiply by klen digit pieces of j so each product is balanced
+    size_t prod_len = 2 * klen + mpn_karatsuba_scratch(klen);
+    mpz_dig_t *prod = m_new(mpz_dig_t, prod_len);
+    for (size_t off = 0; off < jlen; off += klen) {
+        size_t n = MIN(klen, jlen - off);
+        if (n == klen) {
+            mpn_mul_karatsuba(prod, jdig + off, kdig, klen, prod + 2 * klen);
+        } else {
+            memset(prod, 0, (n + klen) * sizeof(mpz_dig_t));
+            mpn_mul(prod, kdig, klen, jdig + off, n);
+        }
+        mpn_add_inpl(idig + off, jlen + klen - off, prod, n + klen);
+    }
+    m_del(mpz_dig_t, prod, prod_len);
+
+    return mpn_remove_trailing_zeros(idig, idig + jlen + klen);
+}
+
 /* natural_div - quo * den + new_num = old_num (ie num is replaced with rem)
    assumes den != 0
    assumes num_dig has enough memory to be extended by 1 digit
@@ -1310,8 +1443,8 @@ void mpz_mul_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs) {
     }
 
     mpz_need_dig(dest, lhs->len + rhs->len); // min mem l+r-1, max mem l+r
-    memset(dest->dig, 0, dest->alloc * sizeof(mpz_dig_t));
-    dest->len = mpn_mul(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len);
+    // CIRCUITPY-CHANGE: use Karatsuba multiplication for large operands
+    dest->len = mpn_mul_fast(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len);
 
     if (lhs->neg == rhs->neg) {
         dest->neg = 0;
@@ -1356,6 +1489,82 @@ void mpz_pow_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs) {
     mpz_free(n);
 }
 
+// CIRCUITPY-CHANGE: modular multiplication for mpz_pow3_inpl, using Montgomery
+// reduction when the modulus is odd
+typedef struct _mpz_modmul_t {
+    const mpz_t *mod; // positive modulus
+    mpz_t quo; // quotient from the division when not using Montgomery
+    mpz_dig_t *prod; // 2 * mod->len + 1 digits for the Montgomery product
+    mpz_dig_t minv; // -mod ** -1 % DIG_BASE, or 0 when not using Montgomery
+} mpz_modmul_t;
+
+/* returns -m ** -1 % DIG_BASE
+   assumes m is odd
+*/
+STATIC mpz_dig_t mpn_montgomery_minv(mpz_dig_t m) {
+    // m * m == 1 mod 8, and each Newton step doubles the correct bits
+    mpz_dbl_dig_t inv = m;
+    for (size_t bits = 3; bits < DIG_SIZE; bits *= 2) {
+        inv = (inv * (2 - (mpz_dbl_dig_t)m * inv)) & DIG_MASK;
+    }
+    return (0 - inv) & DIG_MASK;
+}
+
+/* computes dest = lhs * rhs % mod, or lhs * rhs / R % mod when using Montgomery,
+   where R = DIG_BASE ** mod->len
+   assumes 0 <= lhs, rhs < mod
+   can have dest, lhs, rhs the same
+*/
+STATIC void mpz_modmul_inpl(mpz_modmul_t *ctx, mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs) {
+    if (ctx->minv == 0) {
+        mpz_mul_inpl(dest, lhs, rhs);
+        mpz_divmod_inpl(&ctx->quo, dest, dest, ctx->mod);
+        return;
+    }
+
+    const mpz_dig_t *mdig = ctx->mod->dig;
+    size_t n = ctx->mod->len;
+    mpz_dig_t *prod = ctx->prod;
+    size_t prod_len = lhs->len + rhs->len;
+    mpn_mul_fast(prod, lhs->dig, lhs->len, rhs->dig, rhs->len);
+    memset(prod + prod_len, 0, (2 * n + 1 - prod_len) * sizeof(mpz_dig_t));
+
+    // add multiples of mod to clear the low n digits
+    for (size_t i = 0; i < n; ++i) {
+        mpz_dig_t u = ((mpz_dbl_dig_t)prod[i] * (mpz_dbl_dig_t)ctx->minv) & DIG_MASK;
+        mpz_dig_t *pd = prod + i;
+        mpz_dbl_dig_t carry = 0;
+        for (size_t j = 0; j < n; ++j, ++pd) {
+            carry += (mpz_dbl_dig_t)*pd + (mpz_dbl_dig_t)u * (mpz_dbl_dig_t)mdig[j];
+            *pd = carry & DIG_MASK;
+            carry >>= DIG_SIZE;
+        }
+        for (; carry != 0; ++pd) {
+            carry += *pd;
+            *pd = carry & DIG_MASK;
+            carry >>= DIG_SIZE;
+        }
+        #ifdef RUN_BACKGROUND_TASKS
+        RUN_BACKGROUND_TASKS;
+        #endif
+    }
+
+    // the high digits are now less than 2 * mod
+    mpz_need_dig(dest, n + 1);
+    memcpy(dest->dig, prod + n, (n + 1) * sizeof(mpz_dig_t));
+    dest->len = mpn_remove_trailing_zeros(dest->dig, dest->dig + n + 1);
+    dest->neg = 0;
+    if (mpn_cmp(dest->dig, dest->len, mdig, n) >= 0) {
+        dest->len = mpn_sub(dest->dig, dest->dig, dest->len, mdig, n);
+    }
+}
+
+/* returns bit i of z
+*/
+STATIC mp_uint_t mpz_get_bit(const mpz_t *z, size_t i) {
+    return (z->dig[i / DIG_SIZE] >> (i % DIG_SIZE)) & 1;
+}
+
 /* computes dest = (lhs ** rhs) % mod
    can have dest, lhs, rhs the same; mod can't be the same as dest
 */
@@ -1365,32 +1574,109 @@ void mpz_pow3_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t
         return;
     }
 
-    mpz_set_from_int(dest, 1);
-
     if (rhs->len == 0) {
+        mpz_set_from_int(dest, 1);
         return;
     }
 
-    mpz_t *x = mpz_clone(lhs);
-    mpz_t *n = mpz_clone(rhs);
-    mpz_t quo;
-    mpz_init_zero(&quo);
+    // CIRCUITPY-CHANGE: sliding window exponentiation, working modulo abs(mod)
+    // and fixing the sign at the end
+    mpz_t *n = NULL;
+    if (rhs == dest) {
+        rhs = n = mpz_clone(rhs);
+    }
+
+    mpz_t abs_mod = *mod;
+    abs_mod.neg = 0;
+
+    mpz_modmul_t ctx;
+    ctx.mod = &abs_mod;
+    mpz_init_zero(&ctx.quo);
+    ctx.prod = NULL;
+    ctx.minv = 0;
+    if (mod->dig[0] & 1) {
+        ctx.prod = m_new(mpz_dig_t, 2 * mod->len + 1);
+        ctx.minv = mpn_montgomery_minv(mod->dig[0]);
+    }
+
+    // odd powers x, x ** 3, ... x ** (2 ** window - 1) of the reduced base
+    size_t num_bits = mpz_max_num_bits(rhs);
+    for (mp_uint_t top = rhs->dig[rhs->len - 1]; (top & DIG_MSB) == 0; top <<= 1) {
+        --num_bits;
+    }
+    size_t window = num_bits > 256 ? 5 : num_bits > 80 ? 4 : num_bits > 24 ? 3 : num_bits > 6 ? 2 : 1;
+    size_t num_powers = 1 << (window - 1);
+    mpz_t powers[16];
+    for (size_t i = 0; i < num_powers; ++i) {
+        mpz_init_zero(&powers[i]);
+    }
+    if (ctx.minv != 0) {
+        // convert to Montgomery form, x * R % mod
+        mpz_t shifted;
+        mpz_init_zero(&shifted);
+        mpz_shl_inpl(&shifted, lhs, abs_mod.len * DIG_SIZE);
+        mpz_divmod_inpl(&ctx.quo, &powers[0], &shifted, &abs_mod);
+        mpz_deinit(&shifted);
+    } else {
+        mpz_divmod_inpl(&ctx.quo, &powers[0], lhs, &abs_mod);
+    }
+    if (num_powers > 1) {
+        mpz_t square;
+        mpz_init_zero(&square);
+        mpz_modmul_inpl(&ctx, &square, &powers[0], &powers[0]);
+        for (size_t i = 1; i < num_powers; ++i) {
+            mpz_modmul_inpl(&ctx, &powers[i], &powers[i - 1], &square);
+        }
+        mpz_deinit(&square);
+    }
 
-    while (n->len > 0) {
-        if ((n->dig[0] & 1) != 0) {
-            mpz_mul_inpl(dest, dest, x);
-            mpz_divmod_inpl(&quo, dest, dest, mod);
+    // the top bit of rhs is set, so the first window is never empty
+    bool started = false;
+    for (size_t i = num_bits; i > 0;) {
+        if (!mpz_get_bit(rhs, i - 1)) {
+            mpz_modmul_inpl(&ctx, dest, dest, dest);
+            --i;
+            continue;
         }
-        n->len = mpn_shr(n->dig, n->dig, n->len, 1);
-        if (n->len == 0) {
-            break;
+        // take the longest window of at most window bits ending in a set bit
+        size_t low = i > window ? i - window : 0;
+        while (!mpz_get_bit(rhs, low)) {
+            ++low;
         }
-        mpz_mul_inpl(x, x, x);
-        mpz_divmod_inpl(&quo, x, x, mod);
+        size_t index = 0;
+        for (size_t j = i; j > low; --j) {
+            index = (index << 1) | mpz_get_bit(rhs, j - 1);
+            if (started) {
+                mpz_modmul_inpl(&ctx, dest, dest, dest);
+            }
+        }
+        if (started) {
+            mpz_modmul_inpl(&ctx, dest, dest, &powers[index >> 1]);
+        } else {
+            mpz_set(dest, &powers[index >> 1]);
+            started = true;
+        }
+        i = low;
     }
 
-    mpz_deinit(&quo);
-    mpz_free(x);
+    if (ctx.minv != 0) {
+        // convert out of Montgomery form
+        mpz_t one;
+        mpz_init_from_int(&one, 1);
+        mpz_modmul_inpl(&ctx, dest, dest, &one);
+        mpz_deinit(&one);
+        m_del(mpz_dig_t, ctx.prod, 2 * mod->len + 1);
+    }
+
+    // Python style modulo takes the sign of mod
+    if (mod->neg && dest->len != 0) {
+        mpz_add_inpl(dest, dest, mod);
+    }
+
+    for (size_t i = 0; i < num_powers; ++i) {
+        mpz_deinit(&powers[i]);
+    }
+    mpz_deinit(&ctx.quo);
     mpz_free(n);
 }
 
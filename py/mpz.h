@@ -86,6 +86,12 @@ typedef int8_t mpz_dbl_dig_signed_t;
   #define MPZ_LONG_1 1L
 #endif
 
+// CIRCUITPY-CHANGE: multiplications where both operands have at least this
+// many digits use Karatsuba multiplication instead of the schoolbook method.
+#ifndef MPZ_KARATSUBA_THRESHOLD
+#define MPZ_KARATSUBA_THRESHOLD (32)
+#endif
+
 // these define the maximum storage needed to hold an int or long long
 #define MPZ_NUM_DIG_FOR_INT ((sizeof(mp_int_t) * 8 + MPZ_DIG_SIZE - 1) / MPZ_DIG_SIZE)
 #define MPZ_NUM_DIG_FOR_LL ((sizeof(long long) * 8 + MPZ_DIG_SIZE - 1) / MPZ_DIG_SIZE)
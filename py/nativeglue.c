@@ -348,6 +348,10 @@ const mp_fun_table_t mp_fun_table = {
     &mp_stream_write_obj,
 };
 
+// CIRCUITPY-CHANGE: native .mpy files index mp_fun_table directly.
+_Static_assert(sizeof(mp_fun_table_t) == MP_FUN_TABLE_ENTRY_COUNT * sizeof(void *),
+    "mp_fun_table changed: update MP_FUN_TABLE_ENTRY_COUNT and bump MPY_SUB_VERSION");
+
 #elif MICROPY_EMIT_NATIVE && MICROPY_DYNAMIC_COMPILER
 
 const int mp_fun_table;
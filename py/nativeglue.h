@@ -173,6 +173,12 @@ typedef struct _mp_fun_table_t {
     const mp_obj_fun_builtin_var_t *stream_write_obj;
 } mp_fun_table_t;
 
+// CIRCUITPY-CHANGE: Native .mpy files, including dynamic native modules, call into the
+// runtime through this table by index, so it is part of the native .mpy ABI. Any change
+// to it must come with a new MPY_SUB_VERSION, in py/persistentcode.h, tools/mpy_ld.py
+// and tools/mpy-tool.py, so that .mpy files built against the old table are refused.
+#define MP_FUN_TABLE_ENTRY_COUNT (81)
+
 #if (MICROPY_EMIT_NATIVE && !MICROPY_DYNAMIC_COMPILER) || MICROPY_ENABLE_DYNRUNTIME
 extern const mp_fun_table_t mp_fun_table;
 #elif MICROPY_EMIT_NATIVE && MICROPY_DYNAMIC_COMPILER
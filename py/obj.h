@@ -516,6 +516,24 @@ mp_map_t *mp_map_new(size_t n);
 void mp_map_deinit(mp_map_t *map);
 void mp_map_free(mp_map_t *map);
 mp_map_elem_t *mp_map_lookup(mp_map_t *map, mp_obj_t index, mp_map_lookup_kind_t lookup_kind);
+// CIRCUITPY-CHANGE
+// Grow the table now so that it can hold n elements without growing again.
+void mp_map_reserve(mp_map_t *map, size_t n);
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_INLINE_CACHE
+// An inline cache site remembers the last two maps a lookup at one place in the
+// code hit, and where in those maps the index was found. Maps are recorded by
+// an inverted address, so the cache neither keeps them alive nor trusts them:
+// a hit is only taken after checking the slot in the map being searched.
+typedef struct _mp_map_cache_site_t {
+    uintptr_t map_id[2];
+    uint16_t pos[2];
+} mp_map_cache_site_t;
+
+// Lookup only, like mp_map_lookup(map, index, MP_MAP_LOOKUP), but first tries
+// the positions remembered by site, and updates site on a miss.
+mp_map_elem_t *mp_map_lookup_cached(mp_map_t *map, mp_obj_t index, mp_map_cache_site_t *site);
+#endif
 void mp_map_clear(mp_map_t *map);
 void mp_map_dump(mp_map_t *map);
 
@@ -518,6 +518,316 @@ STATIC mp_obj_t array_extend(mp_obj_t self_in, mp_obj_t arg_in) {
 MP_DEFINE_CONST_FUN_OBJ_2(mp_obj_array_extend_obj, array_extend);
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_ARRAY && MICROPY_PY_ARRAY_BULK_OPS
+// Elementwise operations on whole arrays, for boards without ulab. Elements
+// are read and written unboxed, so none of these allocate while they loop.
+// Integer arrays are worked on as long long, and float arrays (or float
+// arguments) as mp_float_t.
+
+typedef long long array_int_t;
+
+typedef enum {
+    ARRAY_BULK_SCALE,
+    ARRAY_BULK_ADD,
+    ARRAY_BULK_CLIP,
+} array_bulk_op_t;
+
+STATIC char array_numeric_typecode(mp_obj_array_t *self) {
+    char typecode = self->typecode;
+    switch (typecode) {
+        case 'b':
+        case 'B':
+        case 'h':
+        case 'H':
+        case 'i':
+        case 'I':
+        case 'l':
+        case 'L':
+        #if MICROPY_LONGINT_IMPL != MICROPY_LONGINT_IMPL_NONE
+        case 'q':
+        case 'Q':
+        #endif
+        #if MICROPY_PY_BUILTINS_FLOAT
+        case 'f':
+        case 'd':
+        #endif
+            return typecode;
+        default:
+            mp_arg_error_invalid(MP_QSTR_typecode);
+    }
+}
+
+STATIC array_int_t array_get_int(char typecode, const void *items, size_t i) {
+    switch (typecode) {
+        case 'b':
+            return ((const signed char *)items)[i];
+        case 'B':
+            return ((const unsigned char *)items)[i];
+        case 'h':
+            return ((const short *)items)[i];
+        case 'H':
+            return ((const unsigned short *)items)[i];
+        case 'i':
+            return ((const int *)items)[i];
+        case 'I':
+            return ((const unsigned int *)items)[i];
+        case 'l':
+            return ((const long *)items)[i];
+        case 'L':
+            return ((const unsigned long *)items)[i];
+        case 'q':
+            return ((const long long *)items)[i];
+        default:
+            return ((const unsigned long long *)items)[i];
+    }
+}
+
+STATIC void array_set_int(char typecode, void *items, size_t i, array_int_t val) {
+    switch (typecode) {
+        case 'b':
+        case 'B':
+            ((unsigned char *)items)[i] = val;
+            break;
+        case 'h':
+        case 'H':
+            ((unsigned short *)items)[i] = val;
+            break;
+        case 'i':
+        case 'I':
+            ((unsigned int *)items)[i] = val;
+            break;
+        case 'l':
+        case 'L':
+            ((unsigned long *)items)[i] = val;
+            break;
+        default:
+            ((unsigned long long *)items)[i] = val;
+            break;
+    }
+}
+
+#if MICROPY_PY_BUILTINS_FLOAT
+STATIC bool array_is_float(char typecode) {
+    return typecode == 'f' || typecode == 'd';
+}
+
+STATIC mp_float_t array_get_float(char typecode, const void *items, size_t i) {
+    if (typecode == 'f') {
+        return ((const float *)items)[i];
+    } else if (typecode == 'd') {
+        return ((const double *)items)[i];
+    }
+    return (mp_float_t)array_get_int(typecode, items, i);
+}
+
+// Stored into an integer array, a float is truncated towards zero.
+STATIC void array_set_float(char typecode, void *items, size_t i, mp_float_t val) {
+    if (typecode == 'f') {
+        ((float *)items)[i] = (float)val;
+    } else if (typecode == 'd') {
+        ((double *)items)[i] = val;
+    } else {
+        array_set_int(typecode, items, i, (array_int_t)val);
+    }
+}
+#endif
+
+STATIC mp_obj_t array_fill(mp_obj_t self_in, mp_obj_t value) {
+    mp_obj_array_t *self = MP_OBJ_TO_PTR(self_in);
+    array_numeric_typecode(self);
+    if (self->len == 0) {
+        return mp_const_none;
+    }
+    // Store the value once, then copy it over the rest of the array in
+    // doubling chunks.
+    size_t item_sz = mp_binary_get_size('@', self->typecode, NULL);
+    size_t total = self->len * item_sz;
+    mp_binary_set_val_array(self->typecode, self->items, 0, value);
+    for (size_t done = item_sz; done < total; done *= 2) {
+        memcpy((byte *)self->items + done, self->items, MIN(done, total - done));
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(array_fill_obj, array_fill);
+
+STATIC mp_obj_t array_sum(mp_obj_t self_in) {
+    mp_obj_array_t *self = MP_OBJ_TO_PTR(self_in);
+    char typecode = array_numeric_typecode(self);
+    #if MICROPY_PY_BUILTINS_FLOAT
+    if (array_is_float(typecode)) {
+        mp_float_t sum = 0;
+        for (size_t i = 0; i < self->len; i++) {
+            sum += array_get_float(typecode, self->items, i);
+        }
+        return mp_obj_new_float(sum);
+    }
+    #endif
+    array_int_t sum = 0;
+    for (size_t i = 0; i < self->len; i++) {
+        sum += array_get_int(typecode, self->items, i);
+    }
+    return mp_obj_new_int_from_ll(sum);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(array_sum_obj, array_sum);
+
+STATIC mp_obj_t array_min_max(mp_obj_t self_in, bool is_max) {
+    mp_obj_array_t *self = MP_OBJ_TO_PTR(self_in);
+    char typecode = array_numeric_typecode(self);
+    if (self->len == 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("arg is an empty sequence"));
+    }
+    size_t best = 0;
+    #if MICROPY_PY_BUILTINS_FLOAT
+    if (array_is_float(typecode)) {
+        mp_float_t best_val = array_get_float(typecode, self->items, 0);
+        for (size_t i = 1; i < self->len; i++) {
+            mp_float_t val = array_get_float(typecode, self->items, i);
+            if (is_max ? val > best_val : val < best_val) {
+                best = i;
+                best_val = val;
+            }
+        }
+    } else
+    #endif
+    {
+        array_int_t best_val = array_get_int(typecode, self->items, 0);
+        for (size_t i = 1; i < self->len; i++) {
+            array_int_t val = array_get_int(typecode, self->items, i);
+            if (is_max ? val > best_val : val < best_val) {
+                best = i;
+                best_val = val;
+            }
+        }
+    }
+    return mp_binary_get_val_array(typecode, self->items, best);
+}
+
+STATIC mp_obj_t array_min(mp_obj_t self_in) {
+    return array_min_max(self_in, false);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(array_min_obj, array_min);
+
+STATIC mp_obj_t array_max(mp_obj_t self_in) {
+    return array_min_max(self_in, true);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(array_max_obj, array_max);
+
+// Check that arg is a numeric array of the same length as self.
+STATIC mp_obj_array_t *array_bulk_arg(mp_obj_array_t *self, mp_obj_t arg, qstr arg_name) {
+    mp_obj_array_t *array = MP_OBJ_TO_PTR(mp_arg_validate_type(arg, &mp_type_array, arg_name));
+    array_numeric_typecode(array);
+    mp_arg_validate_length(array->len, self->len, arg_name);
+    return array;
+}
+
+// Compute out[i] = op(self[i], other[i], a, b) for each element, where a and b
+// are the scalar arguments of the operation.
+STATIC mp_obj_t array_bulk_op(array_bulk_op_t op, mp_obj_t self_in, mp_obj_t other_in, mp_obj_t a_in, mp_obj_t b_in, mp_obj_t out_in) {
+    mp_obj_array_t *self = MP_OBJ_TO_PTR(self_in);
+    char typecode = array_numeric_typecode(self);
+    mp_obj_array_t *other = other_in == mp_const_none ? self : array_bulk_arg(self, other_in, MP_QSTR_other);
+    mp_obj_array_t *out = out_in == mp_const_none ? self : array_bulk_arg(self, out_in, MP_QSTR_out);
+    char other_typecode = other->typecode;
+    char out_typecode = out->typecode;
+    size_t len = self->len;
+
+    #if MICROPY_PY_BUILTINS_FLOAT
+    if (array_is_float(typecode) || array_is_float(other_typecode) || array_is_float(out_typecode)
+        || mp_obj_is_float(a_in) || mp_obj_is_float(b_in)) {
+        mp_float_t a = op == ARRAY_BULK_ADD ? 0 : mp_obj_get_float(a_in);
+        mp_float_t b = op == ARRAY_BULK_ADD ? 0 : mp_obj_get_float(b_in);
+        for (size_t i = 0; i < len; i++) {
+            mp_float_t val = array_get_float(typecode, self->items, i);
+            if (op == ARRAY_BULK_SCALE) {
+                val = val * a + b;
+            } else if (op == ARRAY_BULK_ADD) {
+                val += array_get_float(other_typecode, other->items, i);
+            } else {
+                val = val < a ? a : val > b ? b : val;
+            }
+            array_set_float(out_typecode, out->items, i, val);
+        }
+        return mp_const_none;
+    }
+    #endif
+
+    array_int_t a = op == ARRAY_BULK_ADD ? 0 : mp_obj_get_int(a_in);
+    array_int_t b = op == ARRAY_BULK_ADD ? 0 : mp_obj_get_int(b_in);
+    for (size_t i = 0; i < len; i++) {
+        array_int_t val = array_get_int(typecode, self->items, i);
+        if (op == ARRAY_BULK_SCALE) {
+            val = val * a + b;
+        } else if (op == ARRAY_BULK_ADD) {
+            val += array_get_int(other_typecode, other->items, i);
+        } else {
+            val = val < a ? a : val > b ? b : val;
+        }
+        array_set_int(out_typecode, out->items, i, val);
+    }
+    return mp_const_none;
+}
+
+STATIC mp_obj_t array_scale(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_scale, ARG_offset, ARG_out };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_scale, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_offset, MP_ARG_OBJ, {.u_obj = MP_OBJ_NEW_SMALL_INT(0)} },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    return array_bulk_op(ARRAY_BULK_SCALE, pos_args[0], mp_const_none, args[ARG_scale].u_obj, args[ARG_offset].u_obj, args[ARG_out].u_obj);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(array_scale_obj, 1, array_scale);
+
+STATIC mp_obj_t array_add(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_other, ARG_out };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_other, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_arg_validate_type(args[ARG_other].u_obj, &mp_type_array, MP_QSTR_other);
+    return array_bulk_op(ARRAY_BULK_ADD, pos_args[0], args[ARG_other].u_obj, mp_const_none, mp_const_none, args[ARG_out].u_obj);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(array_add_obj, 1, array_add);
+
+STATIC mp_obj_t array_clip(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_low, ARG_high, ARG_out };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_low, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_high, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    return array_bulk_op(ARRAY_BULK_CLIP, pos_args[0], mp_const_none, args[ARG_low].u_obj, args[ARG_high].u_obj, args[ARG_out].u_obj);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(array_clip_obj, 1, array_clip);
+
+STATIC const mp_rom_map_elem_t array_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_append), MP_ROM_PTR(&mp_obj_array_append_obj) },
+    { MP_ROM_QSTR(MP_QSTR_extend), MP_ROM_PTR(&mp_obj_array_extend_obj) },
+    { MP_ROM_QSTR(MP_QSTR_fill), MP_ROM_PTR(&array_fill_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sum), MP_ROM_PTR(&array_sum_obj) },
+    { MP_ROM_QSTR(MP_QSTR_min), MP_ROM_PTR(&array_min_obj) },
+    { MP_ROM_QSTR(MP_QSTR_max), MP_ROM_PTR(&array_max_obj) },
+    { MP_ROM_QSTR(MP_QSTR_scale), MP_ROM_PTR(&array_scale_obj) },
+    { MP_ROM_QSTR(MP_QSTR_add), MP_ROM_PTR(&array_add_obj) },
+    { MP_ROM_QSTR(MP_QSTR_clip), MP_ROM_PTR(&array_clip_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(array_locals_dict, array_locals_dict_table);
+#define ARRAY_LOCALS_DICT (&array_locals_dict)
+#else
+#define ARRAY_LOCALS_DICT (&mp_obj_array_locals_dict)
+#endif
+
 #if MICROPY_PY_BUILTINS_BYTEARRAY && MICROPY_CPYTHON_COMPAT
 STATIC mp_obj_t buffer_finder(size_t n_args, const mp_obj_t *args, int direction, bool is_index) {
     mp_check_self(mp_obj_is_type(args[0], &mp_type_bytearray));
@@ -781,7 +1091,8 @@ MP_DEFINE_CONST_OBJ_TYPE(
     binary_op, array_binary_op,
     subscr, array_subscr,
     buffer, array_get_buffer,
-    locals_dict, &mp_obj_array_locals_dict
+    // CIRCUITPY-CHANGE
+    locals_dict, ARRAY_LOCALS_DICT
     );
 #endif
 
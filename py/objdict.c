@@ -421,6 +421,8 @@ STATIC mp_obj_t dict_update(size_t n_args, const mp_obj_t *args, mp_map_t *kwarg
         if (mp_obj_is_dict_or_ordereddict(args[1])) {
             // update from other dictionary (make sure other is not self)
             if (args[1] != args[0]) {
+                // CIRCUITPY-CHANGE: grow once rather than once per step
+                mp_map_reserve(&self->map, self->map.used + ((mp_obj_dict_t *)MP_OBJ_TO_PTR(args[1]))->map.used);
                 size_t cur = 0;
                 mp_map_elem_t *elem = NULL;
                 while ((elem = dict_iter_next((mp_obj_dict_t *)MP_OBJ_TO_PTR(args[1]), &cur)) != NULL) {
@@ -448,6 +450,10 @@ STATIC mp_obj_t dict_update(size_t n_args, const mp_obj_t *args, mp_map_t *kwarg
     }
 
     // update the dict with any keyword args
+    // CIRCUITPY-CHANGE
+    if (kwargs->used) {
+        mp_map_reserve(&self->map, self->map.used + kwargs->used);
+    }
     for (size_t i = 0; i < kwargs->alloc; i++) {
         if (mp_map_slot_is_filled(kwargs, i)) {
             mp_map_lookup(&self->map, kwargs->table[i].key, MP_MAP_LOOKUP_ADD_IF_NOT_FOUND)->value = kwargs->table[i].value;
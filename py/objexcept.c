@@ -52,6 +52,14 @@
 // Number of items per traceback entry (file, line, block)
 #define TRACEBACK_ENTRY_LEN (3)
 
+// CIRCUITPY-CHANGE
+#if !MICROPY_ROM_TEXT_COMPRESSION && MICROPY_ERROR_REPORTING != MICROPY_ERROR_REPORTING_NONE
+// Hash of a message string whose data still points at the compressed message passed
+// to mp_obj_new_exception_msg. String hashes are at most 16 bits so can't be this.
+#define EXC_MSG_HASH_COMPRESSED ((size_t)-1)
+STATIC void exc_format_compressed_msg(mp_obj_exception_t *o, mp_obj_str_t *o_str);
+#endif
+
 // Optionally allocated buffer for storing some traceback, the tuple argument,
 // and possible string object and data, for when the heap is locked.
 #if MICROPY_ENABLE_EMERGENCY_EXCEPTION_BUF
@@ -157,6 +165,14 @@ STATIC void decompress_error_text_maybe(mp_obj_exception_t *o) {
             o_str->hash = qstr_compute_hash(o_str->data, o_str->len);
         }
     }
+    // CIRCUITPY-CHANGE
+    #elif MICROPY_ERROR_REPORTING != MICROPY_ERROR_REPORTING_NONE
+    if (o->args->len == 1 && mp_obj_is_exact_type(o->args->items[0], &mp_type_str)) {
+        mp_obj_str_t *o_str = MP_OBJ_TO_PTR(o->args->items[0]);
+        if (o_str->hash == EXC_MSG_HASH_COMPRESSED) {
+            exc_format_compressed_msg(o, o_str);
+        }
+    }
     #endif
 }
 
@@ -213,6 +229,46 @@ void mp_obj_exception_initialize0(mp_obj_exception_t *o_exc, const mp_obj_type_t
     mp_obj_exception_clear_traceback(o_exc);
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PREALLOCATED_EXCEPTIONS
+STATIC const mp_rom_obj_tuple_t preallocated_ETIMEDOUT_args = {{&mp_type_tuple}, 1, {MP_ROM_INT(MP_ETIMEDOUT)}};
+STATIC const mp_rom_obj_tuple_t preallocated_EAGAIN_args = {{&mp_type_tuple}, 1, {MP_ROM_INT(MP_EAGAIN)}};
+
+// Reset the preallocated exception in the given slot, as if it was just made.
+// Its traceback goes into fixed storage, so raising it doesn't allocate.
+STATIC mp_obj_t preallocated_exception(size_t slot, const mp_obj_type_t *type, const mp_obj_tuple_t *args) {
+    mp_obj_exception_t *o_exc = &MP_STATE_VM(mp_preallocated_exception)[slot];
+    mp_obj_traceback_t *tb = &MP_STATE_VM(mp_preallocated_traceback)[slot];
+    mp_obj_exception_initialize0(o_exc, type);
+    o_exc->args = (mp_obj_tuple_t *)args;
+    tb->base.type = &mp_type_traceback;
+    tb->alloc = MICROPY_PREALLOCATED_EXCEPTION_TRACEBACK_DEPTH * TRACEBACK_ENTRY_LEN;
+    tb->len = 0;
+    tb->data = MP_STATE_VM(mp_preallocated_traceback_data)[slot];
+    o_exc->traceback = tb;
+    return MP_OBJ_FROM_PTR(o_exc);
+}
+
+STATIC bool is_preallocated_traceback(const mp_obj_traceback_t *tb) {
+    return tb >= &MP_STATE_VM(mp_preallocated_traceback)[0]
+           && tb < &MP_STATE_VM(mp_preallocated_traceback)[MP_PREALLOCATED_EXC_NUM];
+}
+
+mp_obj_t mp_obj_exception_preallocated_StopIteration(void) {
+    return preallocated_exception(MP_PREALLOCATED_EXC_STOP_ITERATION, &mp_type_StopIteration, &mp_const_empty_tuple_obj);
+}
+
+mp_obj_t mp_obj_exception_preallocated_OSError(int errno_) {
+    if (errno_ == MP_ETIMEDOUT) {
+        return preallocated_exception(MP_PREALLOCATED_EXC_ETIMEDOUT, &mp_type_OSError, (const mp_obj_tuple_t *)&preallocated_ETIMEDOUT_args);
+    }
+    if (errno_ == MP_EAGAIN) {
+        return preallocated_exception(MP_PREALLOCATED_EXC_EAGAIN, &mp_type_OSError, (const mp_obj_tuple_t *)&preallocated_EAGAIN_args);
+    }
+    return MP_OBJ_NULL;
+}
+#endif
+
 mp_obj_t mp_obj_exception_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
     mp_arg_check_num(n_args, n_kw, 0, MP_OBJ_FUN_ARGS_MAX, false);
 
@@ -483,6 +539,20 @@ mp_obj_t mp_obj_new_exception_args(const mp_obj_type_t *exc_type, size_t n_args,
 #if MICROPY_ERROR_REPORTING != MICROPY_ERROR_REPORTING_NONE
 mp_obj_t mp_obj_new_exception_msg(const mp_obj_type_t *exc_type, mp_rom_error_text_t msg) {
     // CIRCUITPY-CHANGE: is different here and for many lines below.
+    #if !MICROPY_ROM_TEXT_COMPRESSION
+    // Keep the message compressed until the exception is printed or its args are
+    // read, so an exception that is caught and dropped never decompresses it.
+    assert(MP_OBJ_TYPE_GET_SLOT_OR_NULL(exc_type, make_new) == mp_obj_exception_make_new);
+    mp_obj_str_t *o_str = m_new_obj_maybe(mp_obj_str_t);
+    if (o_str != NULL) {
+        o_str->base.type = &mp_type_str;
+        o_str->hash = EXC_MSG_HASH_COMPRESSED;
+        o_str->len = 0;
+        o_str->data = (const byte *)msg;
+        mp_obj_t arg = MP_OBJ_FROM_PTR(o_str);
+        return mp_obj_exception_make_new(exc_type, 1, 0, &arg);
+    }
+    #endif
     return mp_obj_new_exception_msg_varg(exc_type, msg);
 }
 
@@ -519,6 +589,38 @@ STATIC void exc_add_strn(void *data, const char *str, size_t len) {
     pr->len += len;
 }
 
+// CIRCUITPY-CHANGE
+#if !MICROPY_ROM_TEXT_COMPRESSION
+// Format a message left compressed by mp_obj_new_exception_msg into the string object.
+// The message is still run through the formatter so that "%%" comes out as it would have.
+STATIC void exc_format_compressed_msg(mp_obj_exception_t *o, mp_obj_str_t *o_str) {
+    mp_rom_error_text_t msg = (mp_rom_error_text_t)o_str->data;
+    size_t alloc = decompress_length(msg);
+    byte *buf = m_new_maybe(byte, alloc);
+    if (buf == NULL) {
+        #if MICROPY_ENABLE_EMERGENCY_EXCEPTION_BUF
+        // Try and use the emergency exception buf if enough space is available.
+        if (mp_emergency_exception_buf_size < (mp_int_t)(EMG_BUF_STR_BUF_OFFSET + alloc)) {
+            // No way to decompress, fallback to no message text.
+            o->args = (mp_obj_tuple_t *)&mp_const_empty_tuple_obj;
+            return;
+        }
+        buf = (byte *)((uint8_t *)MP_STATE_VM(mp_emergency_exception_buf) + EMG_BUF_STR_BUF_OFFSET);
+        #else
+        o->args = (mp_obj_tuple_t *)&mp_const_empty_tuple_obj;
+        return;
+        #endif
+    }
+    struct _exc_printer_t exc_pr = {false, alloc, 0, buf};
+    mp_print_t print = {&exc_pr, exc_add_strn};
+    mp_cprintf(&print, msg);
+    buf[exc_pr.len] = '\0';
+    o_str->data = buf;
+    o_str->len = exc_pr.len;
+    o_str->hash = qstr_compute_hash(buf, exc_pr.len);
+}
+#endif
+
 mp_obj_t mp_obj_new_exception_msg_varg(const mp_obj_type_t *exc_type, mp_rom_error_text_t fmt, ...) {
     va_list args;
     va_start(args, fmt);
@@ -687,6 +789,13 @@ void mp_obj_exception_add_traceback(mp_obj_t self_in, qstr file, size_t line, qs
             return;
         }
         #endif
+        // CIRCUITPY-CHANGE
+        #if MICROPY_PREALLOCATED_EXCEPTIONS
+        if (is_preallocated_traceback(self->traceback)) {
+            // Can't resize the preallocated traceback storage
+            return;
+        }
+        #endif
         // be conservative with growing traceback data
         size_t *tb_data = m_renew_maybe(size_t, self->traceback->data, self->traceback->alloc,
             self->traceback->alloc + TRACEBACK_ENTRY_LEN, true);
@@ -47,6 +47,22 @@ void mp_obj_exception_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest);
 void mp_obj_exception_initialize0(mp_obj_exception_t *o_exc, const mp_obj_type_t *type);
 mp_obj_exception_t *mp_obj_exception_get_native(mp_obj_t self_in);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PREALLOCATED_EXCEPTIONS
+enum {
+    MP_PREALLOCATED_EXC_STOP_ITERATION,
+    MP_PREALLOCATED_EXC_ETIMEDOUT,
+    MP_PREALLOCATED_EXC_EAGAIN,
+    MP_PREALLOCATED_EXC_NUM,
+};
+
+// Return the reset preallocated StopIteration().
+mp_obj_t mp_obj_exception_preallocated_StopIteration(void);
+// Return the reset preallocated OSError(errno_), or MP_OBJ_NULL if there
+// isn't one for that errno.
+mp_obj_t mp_obj_exception_preallocated_OSError(int errno_);
+#endif
+
 #define MP_DEFINE_EXCEPTION(exc_name, base_name) \
     MP_DEFINE_CONST_OBJ_TYPE(mp_type_##exc_name, MP_QSTR_##exc_name, MP_TYPE_FLAG_NONE, \
     make_new, mp_obj_exception_make_new, \
@@ -37,6 +37,11 @@ typedef struct _mp_obj_fun_bc_t {
     #if MICROPY_PY_SYS_SETTRACE
     const struct _mp_raw_code_t *rc;
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_INLINE_CACHE
+    // MICROPY_OPT_INLINE_CACHE_SITES lookup caches, allocated on first use.
+    mp_map_cache_site_t *inline_cache;
+    #endif
     // the following extra_args array is allocated space to take (in order):
     //  - values of positional default args (if any)
     //  - a single slot for default kw args dict (if it has them)
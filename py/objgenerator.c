@@ -26,9 +26,11 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 
 #include "py/runtime.h"
+#include "py/gc.h"
 #include "py/bc.h"
 #include "py/objstr.h"
 #include "py/objgenerator.h"
@@ -54,9 +56,67 @@ typedef struct _mp_obj_gen_instance_t {
     // MP_OBJ_NULL: Running, no exception.
     // other: Not running, pending exception.
     mp_obj_t pend_exc;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GEN_POOL
+    // Only the stack of the frame that awaits it refers to this generator.
+    bool pooled;
+    #endif
     mp_code_state_t code_state;
 } mp_obj_gen_instance_t;
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GEN_POOL
+// Finished generators, by size in GC blocks. Not a root pointer: gc_collect
+// empties it first so that a collection frees everything in it.
+STATIC mp_obj_gen_instance_t *gen_pool[MICROPY_GEN_POOL_CLASSES][MICROPY_GEN_POOL_DEPTH];
+STATIC uint8_t gen_pool_len[MICROPY_GEN_POOL_CLASSES];
+
+STATIC mp_obj_gen_instance_t *gen_pool_take(size_t num_bytes) {
+    size_t n_blocks = (num_bytes + MICROPY_BYTES_PER_GC_BLOCK - 1) / MICROPY_BYTES_PER_GC_BLOCK;
+    if (n_blocks > MICROPY_GEN_POOL_CLASSES || gen_pool_len[n_blocks - 1] == 0) {
+        return NULL;
+    }
+    return gen_pool[n_blocks - 1][--gen_pool_len[n_blocks - 1]];
+}
+
+void mp_obj_gen_pool_mark(mp_obj_t fun, mp_obj_t gen) {
+    if (mp_obj_is_type(fun, &mp_type_gen_wrap)
+        #if MICROPY_PY_ASYNC_AWAIT
+        || mp_obj_is_type(fun, &mp_type_coro_wrap)
+        #endif
+        ) {
+        ((mp_obj_gen_instance_t *)MP_OBJ_TO_PTR(gen))->pooled = true;
+    }
+}
+
+void mp_obj_gen_pool_release(mp_obj_t gen) {
+    if (!mp_obj_is_type(gen, &mp_type_gen_instance)
+        #if MICROPY_PY_ASYNC_AWAIT
+        && !mp_obj_is_type(gen, &mp_type_coro_instance)
+        #endif
+        ) {
+        return;
+    }
+    mp_obj_gen_instance_t *self = MP_OBJ_TO_PTR(gen);
+    if (!self->pooled) {
+        return;
+    }
+    size_t num_bytes = gc_nbytes(self);
+    size_t n_blocks = num_bytes / MICROPY_BYTES_PER_GC_BLOCK;
+    if (n_blocks == 0 || n_blocks > MICROPY_GEN_POOL_CLASSES
+        || gen_pool_len[n_blocks - 1] == MICROPY_GEN_POOL_DEPTH) {
+        return;
+    }
+    // Drop the references held by the finished frame.
+    memset(self, 0, num_bytes);
+    gen_pool[n_blocks - 1][gen_pool_len[n_blocks - 1]++] = self;
+}
+
+void mp_obj_gen_pool_clear(void) {
+    memset(gen_pool_len, 0, sizeof(gen_pool_len));
+}
+#endif
+
 STATIC mp_obj_t gen_wrap_call(mp_obj_t self_in, size_t n_args, size_t n_kw, const mp_obj_t *args) {
     // A generating or coroutine function is just a bytecode function
     // with type mp_type_gen_wrap or mp_type_coro_wrap.
@@ -67,14 +127,24 @@ STATIC mp_obj_t gen_wrap_call(mp_obj_t self_in, size_t n_args, size_t n_kw, cons
     MP_BC_PRELUDE_SIG_DECODE(ip);
 
     // allocate the generator or coroutine object, with room for local stack and exception stack
-    mp_obj_gen_instance_t *o = mp_obj_malloc_var(mp_obj_gen_instance_t, byte,
-        n_state * sizeof(mp_obj_t) + n_exc_stack * sizeof(mp_exc_stack_t),
-        #if MICROPY_PY_ASYNC_AWAIT
-        self_fun->base.type == &mp_type_gen_wrap ? &mp_type_gen_instance : &mp_type_coro_instance
-        #else
-        &mp_type_gen_instance
-        #endif
-        );
+    // CIRCUITPY-CHANGE: reuse a pooled generator of the same size if there is one
+    #if MICROPY_PY_ASYNC_AWAIT
+    const mp_obj_type_t *type = self_fun->base.type == &mp_type_gen_wrap ? &mp_type_gen_instance : &mp_type_coro_instance;
+    #else
+    const mp_obj_type_t *type = &mp_type_gen_instance;
+    #endif
+    size_t var_size = n_state * sizeof(mp_obj_t) + n_exc_stack * sizeof(mp_exc_stack_t);
+    #if MICROPY_GEN_POOL
+    mp_obj_gen_instance_t *o = gen_pool_take(sizeof(mp_obj_gen_instance_t) + var_size);
+    if (o != NULL) {
+        o->base.type = type;
+    } else {
+        o = mp_obj_malloc_var(mp_obj_gen_instance_t, byte, var_size, type);
+    }
+    o->pooled = false;
+    #else
+    mp_obj_gen_instance_t *o = mp_obj_malloc_var(mp_obj_gen_instance_t, byte, var_size, type);
+    #endif
 
     o->pend_exc = mp_const_none;
     o->code_state.fun_bc = self_fun;
@@ -116,6 +186,10 @@ MP_DEFINE_CONST_OBJ_TYPE(
 typedef struct _mp_obj_gen_instance_native_t {
     mp_obj_base_t base;
     mp_obj_t pend_exc;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GEN_POOL
+    bool pooled;
+    #endif
     mp_code_state_native_t code_state;
 } mp_obj_gen_instance_native_t;
 
@@ -150,6 +224,10 @@ STATIC mp_obj_t native_gen_wrap_call(mp_obj_t self_in, size_t n_args, size_t n_k
 
     // Parse the input arguments and set up the code state
     o->pend_exc = mp_const_none;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GEN_POOL
+    o->pooled = false;
+    #endif
     o->code_state.fun_bc = self_fun;
     o->code_state.ip = prelude_ptr;
     o->code_state.n_state = n_state;
@@ -31,4 +31,15 @@
 
 mp_vm_return_kind_t mp_obj_gen_resume(mp_obj_t self_in, mp_obj_t send_val, mp_obj_t throw_val, mp_obj_t *ret_val);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GEN_POOL
+// Marks gen, just made by calling fun, as referenced only by the await or yield
+// from that follows the call. Does nothing unless fun is a bytecode generator function.
+void mp_obj_gen_pool_mark(mp_obj_t fun, mp_obj_t gen);
+// Returns a marked generator that has finished to the pool.
+void mp_obj_gen_pool_release(mp_obj_t gen);
+// Forgets every pooled generator so that the collector frees them.
+void mp_obj_gen_pool_clear(void);
+#endif
+
 #endif // MICROPY_INCLUDED_PY_OBJGENERATOR_H
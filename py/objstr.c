@@ -528,19 +528,24 @@ STATIC mp_obj_t str_join(mp_obj_t self_in, mp_obj_t arg) {
     }
     #endif
     for (size_t i = 0; i < seq_len; i++) {
-        const mp_obj_type_t *seq_type = mp_obj_get_type(seq_items[i]);
-        #if MICROPY_PY_BUILTINS_BYTEARRAY
-        if (seq_type == &mp_type_bytearray) {
-            seq_type = &mp_type_bytes;
+        if (i > 0) {
+            required_len += sep_len;
         }
-        #endif
-        if (seq_type != self_type) {
+        // CIRCUITPY-CHANGE: like CPython, bytes.join() takes any bytes-like
+        // items, such as memoryview slices, without copying them first.
+        if (self_type != &mp_type_str) {
+            mp_buffer_info_t bufinfo;
+            if (!mp_get_buffer(seq_items[i], &bufinfo, MP_BUFFER_READ) || mp_obj_is_str(seq_items[i])) {
+                mp_raise_TypeError(
+                    MP_ERROR_TEXT("join expects a list of str/bytes objects consistent with self object"));
+            }
+            required_len += bufinfo.len;
+            continue;
+        }
+        if (mp_obj_get_type(seq_items[i]) != self_type) {
             mp_raise_TypeError(
                 MP_ERROR_TEXT("join expects a list of str/bytes objects consistent with self object"));
         }
-        if (i > 0) {
-            required_len += sep_len;
-        }
         GET_STR_LEN(seq_items[i], l);
         required_len += l;
     }
@@ -554,6 +559,14 @@ STATIC mp_obj_t str_join(mp_obj_t self_in, mp_obj_t arg) {
             memcpy(data, sep_str, sep_len);
             data += sep_len;
         }
+        // CIRCUITPY-CHANGE
+        if (self_type != &mp_type_str) {
+            mp_buffer_info_t bufinfo;
+            mp_get_buffer_raise(seq_items[i], &bufinfo, MP_BUFFER_READ);
+            memcpy(data, bufinfo.buf, bufinfo.len);
+            data += bufinfo.len;
+            continue;
+        }
         GET_STR_DATA_LEN(seq_items[i], s, l);
         memcpy(data, s, l);
         data += l;
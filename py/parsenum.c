@@ -31,6 +31,8 @@
 #include "py/parsenumbase.h"
 #include "py/parsenum.h"
 #include "py/smallint.h"
+// CIRCUITPY-CHANGE
+#include "py/formatfloat.h"
 
 #if MICROPY_PY_BUILTINS_FLOAT
 #include <math.h>
@@ -351,10 +353,11 @@ parse_start:
         // turns out small positive powers of 10 do, whereas small negative powers of 10 don't.
         // So in that case, we'll yield a division of exact values rather than a multiplication
         // of slightly erroneous values.
+        // CIRCUITPY-CHANGE: small powers come from a table
         if (exp_val < 0 && exp_val >= -EXACT_POWER_OF_10) {
-            dec_val /= MICROPY_FLOAT_C_FUN(pow)(10, -exp_val);
+            dec_val /= mp_float_pow10(-exp_val);
         } else {
-            dec_val *= MICROPY_FLOAT_C_FUN(pow)(10, exp_val);
+            dec_val *= mp_float_pow10(exp_val);
         }
     }
 
@@ -140,11 +140,56 @@ void mp_native_relocate(void *ri_in, uint8_t *text, uintptr_t reloc_text) {
 
 #endif
 
+// CIRCUITPY-CHANGE: a reader that inflates a compressed .mpy as it is read
+#if MICROPY_PERSISTENT_CODE_LOAD_COMPRESSED
+
+#include "lib/uzlib/uzlib.h"
+
+// The window bits byte in the header of a compressed .mpy is limited to this.
+#define MPY_COMPRESSED_MAX_WBITS (15)
+
+typedef struct _mp_reader_inflate_t {
+    struct uzlib_uncomp decomp;
+    mp_reader_t *src;
+} mp_reader_inflate_t;
+
+STATIC int mp_reader_inflate_read_src(struct uzlib_uncomp *decomp) {
+    mp_reader_inflate_t *inflate = decomp->self;
+    mp_uint_t b = inflate->src->readbyte(inflate->src->data);
+    return b == MP_READER_EOF ? -1 : (int)b;
+}
+
+STATIC void mp_reader_inflate_into(mp_reader_inflate_t *inflate, byte *buf, size_t len) {
+    inflate->decomp.dest = buf;
+    inflate->decomp.dest_limit = buf + len;
+    int st = uzlib_uncompress(&inflate->decomp);
+    if (st < 0 || inflate->decomp.dest != buf + len) {
+        mp_raise_ValueError(MP_ERROR_TEXT("incompatible .mpy file"));
+    }
+}
+
+STATIC mp_uint_t mp_reader_inflate_readbyte(void *data) {
+    byte b;
+    mp_reader_inflate_into(data, &b, 1);
+    return b;
+}
+
+#endif
+
 STATIC int read_byte(mp_reader_t *reader) {
     return reader->readbyte(reader->data);
 }
 
 STATIC void read_bytes(mp_reader_t *reader, byte *buf, size_t len) {
+    // CIRCUITPY-CHANGE: inflate straight into the destination
+    #if MICROPY_PERSISTENT_CODE_LOAD_COMPRESSED
+    if (reader->readbyte == mp_reader_inflate_readbyte) {
+        if (len > 0) {
+            mp_reader_inflate_into(reader->data, buf, len);
+        }
+        return;
+    }
+    #endif
     while (len-- > 0) {
         *buf++ = reader->readbyte(reader->data);
     }
@@ -169,6 +214,13 @@ STATIC qstr load_qstr(mp_reader_t *reader) {
         return len >> 1;
     }
     len >>= 1;
+    #if MICROPY_PERSISTENT_CODE_LOAD_ROM
+    // CIRCUITPY-CHANGE: intern qstr data in place, including its null terminator
+    const char *rom_str = (const char *)mp_reader_try_read_rom(reader, len + 1);
+    if (rom_str != NULL) {
+        return qstr_from_strn_static(rom_str, len);
+    }
+    #endif
     char *str = m_new(char, len);
     read_bytes(reader, (byte *)str, len);
     read_byte(reader); // read and discard null terminator
@@ -204,6 +256,19 @@ STATIC mp_obj_t load_obj(mp_reader_t *reader) {
             }
             return MP_OBJ_FROM_PTR(tuple);
         }
+        #if MICROPY_PERSISTENT_CODE_LOAD_ROM
+        // CIRCUITPY-CHANGE: str/bytes constants keep referencing their data in ROM
+        if (obj_type == MP_PERSISTENT_OBJ_STR || obj_type == MP_PERSISTENT_OBJ_BYTES) {
+            const byte *data = mp_reader_try_read_rom(reader, len + 1);
+            if (data != NULL) {
+                mp_obj_str_t *o = mp_obj_malloc(mp_obj_str_t, obj_type == MP_PERSISTENT_OBJ_STR ? &mp_type_str : &mp_type_bytes);
+                o->hash = qstr_compute_hash(data, len);
+                o->len = len;
+                o->data = data;
+                return MP_OBJ_FROM_PTR(o);
+            }
+        }
+        #endif
         vstr_t vstr;
         vstr_init_len(&vstr, len);
         read_bytes(reader, (byte *)vstr.buf, len);
@@ -245,10 +310,17 @@ STATIC mp_raw_code_t *load_raw_code(mp_reader_t *reader, mp_module_context_t *co
     #endif
 
     if (kind == MP_CODE_BYTECODE) {
-        // Allocate memory for the bytecode
-        fun_data = m_new(uint8_t, fun_data_len);
-        // Load bytecode
-        read_bytes(reader, fun_data, fun_data_len);
+        #if MICROPY_PERSISTENT_CODE_LOAD_ROM
+        // CIRCUITPY-CHANGE: execute bytecode in place when it is in ROM
+        fun_data = (uint8_t *)mp_reader_try_read_rom(reader, fun_data_len);
+        if (fun_data == NULL)
+        #endif
+        {
+            // Allocate memory for the bytecode
+            fun_data = m_new(uint8_t, fun_data_len);
+            // Load bytecode
+            read_bytes(reader, fun_data, fun_data_len);
+        }
 
     #if MICROPY_EMIT_MACHINE_CODE
     } else {
@@ -306,6 +378,16 @@ STATIC mp_raw_code_t *load_raw_code(mp_reader_t *reader, mp_module_context_t *co
             // memory so that it is not reclaimed by the GC.
             assert(!has_children);
             children = (void *)data;
+
+            // CIRCUITPY-CHANGE: the raw code, and so children, can be freed once a
+            // native module's init function has run, while the committed code
+            // still points into data.
+            #if MICROPY_PERSISTENT_CODE_TRACK_BSS_RODATA
+            if (MP_STATE_PORT(track_reloc_code_list) == MP_OBJ_NULL) {
+                MP_STATE_PORT(track_reloc_code_list) = mp_obj_new_list(0, NULL);
+            }
+            mp_obj_list_append(MP_STATE_PORT(track_reloc_code_list), MP_OBJ_FROM_PTR(data));
+            #endif
         }
     }
     #endif
@@ -405,6 +487,32 @@ void mp_raw_code_load(mp_reader_t *reader, mp_compiled_module_t *cm) {
     byte header[4];
     read_bytes(reader, header, sizeof(header));
     byte arch = MPY_FEATURE_DECODE_ARCH(header[2]);
+    // CIRCUITPY-CHANGE: a compressed .mpy starts with 'Z' and the window bits
+    // of the raw deflate stream holding the rest of the file
+    #if MICROPY_PERSISTENT_CODE_LOAD_COMPRESSED
+    mp_reader_t inflate_reader;
+    mp_reader_inflate_t inflate;
+    byte *window = NULL;
+    size_t window_len = 0;
+    if (header[0] == 'Z') {
+        mp_uint_t wbits = reader->readbyte(reader->data);
+        if (wbits < 8 || wbits > MPY_COMPRESSED_MAX_WBITS) {
+            mp_raise_ValueError(MP_ERROR_TEXT("incompatible .mpy file"));
+        }
+        window_len = 1 << wbits;
+        window = m_new(byte, window_len);
+        memset(&inflate.decomp, 0, sizeof(inflate.decomp));
+        inflate.decomp.self = &inflate;
+        inflate.decomp.source_read_cb = mp_reader_inflate_read_src;
+        uzlib_uncompress_init(&inflate.decomp, window, window_len);
+        inflate.src = reader;
+        inflate_reader.data = &inflate;
+        inflate_reader.readbyte = mp_reader_inflate_readbyte;
+        inflate_reader.close = reader->close;
+        reader = &inflate_reader;
+        header[0] = 'C';
+    }
+    #endif
     // CIRCUITPY-CHANGE: 'C', not 'M'
     if (header[0] != 'C'
         || header[1] != MPY_VERSION
@@ -423,6 +531,12 @@ void mp_raw_code_load(mp_reader_t *reader, mp_compiled_module_t *cm) {
             }
         }
     }
+    // CIRCUITPY-CHANGE
+    #if !MICROPY_OPT_BC_SUPERINSTRUCTIONS
+    if (header[2] & MPY_FEATURE_SUPERINSTRUCTIONS) {
+        mp_raise_ValueError(MP_ERROR_TEXT("incompatible .mpy file"));
+    }
+    #endif
 
     size_t n_qstr = read_uint(reader);
     size_t n_obj = read_uint(reader);
@@ -443,10 +557,17 @@ void mp_raw_code_load(mp_reader_t *reader, mp_compiled_module_t *cm) {
 
     #if MICROPY_PERSISTENT_CODE_SAVE
     cm->has_native = MPY_FEATURE_DECODE_ARCH(header[2]) != MP_NATIVE_ARCH_NONE;
+    // CIRCUITPY-CHANGE
+    cm->has_superinstructions = (header[2] & MPY_FEATURE_SUPERINSTRUCTIONS) != 0;
     cm->n_qstr = n_qstr;
     cm->n_obj = n_obj;
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PERSISTENT_CODE_LOAD_COMPRESSED
+    m_del(byte, window, window_len);
+    #endif
+
     // Deregister exception handler and close the reader.
     nlr_pop_jump_callback(true);
 }
@@ -600,12 +721,14 @@ void mp_raw_code_save(mp_compiled_module_t *cm, mp_print_t *print) {
     // header contains:
     //  byte  'C' (CIRCUITPY)
     //  byte  version
-    //  byte  native arch (and sub-version if native)
+    //  byte  native arch (and sub-version if native), and superinstructions flag
     //  byte  number of bits in a small int
     byte header[4] = {
         'C',
         MPY_VERSION,
-        cm->has_native ? MPY_FEATURE_ENCODE_SUB_VERSION(MPY_SUB_VERSION) | MPY_FEATURE_ENCODE_ARCH(MPY_FEATURE_ARCH_DYNAMIC) : 0,
+        // CIRCUITPY-CHANGE
+        (cm->has_native ? MPY_FEATURE_ENCODE_SUB_VERSION(MPY_SUB_VERSION) | MPY_FEATURE_ENCODE_ARCH(MPY_FEATURE_ARCH_DYNAMIC) : 0)
+        | (cm->has_superinstructions ? MPY_FEATURE_SUPERINSTRUCTIONS : 0),
         #if MICROPY_DYNAMIC_COMPILER
         mp_dynamic_compiler.small_int_bits,
         #else
@@ -664,7 +787,8 @@ void mp_raw_code_save_file(mp_compiled_module_t *cm, const char *filename) {
 
 #endif // MICROPY_PERSISTENT_CODE_SAVE
 
-#if MICROPY_PERSISTENT_CODE_TRACK_RELOC_CODE
+// CIRCUITPY-CHANGE: also holds BSS/rodata with MICROPY_PERSISTENT_CODE_TRACK_BSS_RODATA
+#if MICROPY_PERSISTENT_CODE_TRACK_RELOC_CODE || MICROPY_PERSISTENT_CODE_TRACK_BSS_RODATA
 // An mp_obj_list_t that tracks relocated native code to prevent the GC from reclaiming them.
 MP_REGISTER_ROOT_POINTER(mp_obj_t track_reloc_code_list);
 #endif
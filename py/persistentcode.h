@@ -45,7 +45,13 @@
 
 // Macros to encode/decode native architecture to/from the feature byte
 #define MPY_FEATURE_ENCODE_ARCH(arch) ((arch) << 2)
-#define MPY_FEATURE_DECODE_ARCH(feat) ((feat) >> 2)
+// CIRCUITPY-CHANGE: the top bit is the superinstructions flag
+#define MPY_FEATURE_DECODE_ARCH(feat) (((feat) >> 2) & 0x1f)
+
+// CIRCUITPY-CHANGE
+// Set in the feature byte when the bytecode may contain superinstructions
+// (see MICROPY_OPT_BC_SUPERINSTRUCTIONS).
+#define MPY_FEATURE_SUPERINSTRUCTIONS (0x80)
 
 // Define the host architecture
 #if MICROPY_EMIT_X86
@@ -114,6 +120,18 @@ enum {
 void mp_raw_code_load(mp_reader_t *reader, mp_compiled_module_t *ctx);
 void mp_raw_code_load_mem(const byte *buf, size_t len, mp_compiled_module_t *ctx);
 void mp_raw_code_load_file(const char *filename, mp_compiled_module_t *ctx);
+// CIRCUITPY-CHANGE: compile a .py file, or load it from the import cache when
+// it hasn't changed since it was last compiled. ctx->context must be set.
+#if (MICROPY_MODULE_IMPORT_CACHE || MICROPY_MODULE_IMPORT_CACHE_WARM) && MICROPY_ENABLE_COMPILER
+// Size and mtime of the source file, which the cached data must match.
+#define MP_IMPORT_CACHE_KEY_LEN (8)
+void mp_raw_code_load_file_cached(const char *filename, mp_compiled_module_t *ctx);
+#endif
+#if MICROPY_MODULE_IMPORT_CACHE_WARM && MICROPY_ENABLE_COMPILER
+// Provided by the port. The data returned by lookup must stay valid until the next store.
+const byte *mp_import_cache_warm_lookup(const char *filename, const byte *key, size_t *len);
+void mp_import_cache_warm_store(const char *filename, const byte *key, const byte *data, size_t len);
+#endif
 
 void mp_raw_code_save(mp_compiled_module_t *cm, mp_print_t *print);
 void mp_raw_code_save_file(mp_compiled_module_t *cm, const char *filename);
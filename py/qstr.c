@@ -61,14 +61,19 @@
 // allocated pool is twice this size.  The value here must be <= MP_QSTRnumber_of.
 #define MICROPY_ALLOC_QSTR_ENTRIES_INIT (10)
 
-// this must match the equivalent function in makeqstrdata.py
-size_t qstr_compute_hash(const byte *data, size_t len) {
+// CIRCUITPY-CHANGE: the full 32 bit hash is used to place qstrs in pool indexes
+// this must match compute_raw_hash in makeqstrdata.py
+STATIC uint32_t qstr_compute_raw_hash(const byte *data, size_t len) {
     // djb2 algorithm; see http://www.cse.yorku.ca/~oz/hash.html
-    size_t hash = 5381;
+    uint32_t hash = 5381;
     for (const byte *top = data + len; data < top; data++) {
         hash = ((hash << 5) + hash) ^ (*data); // hash * 33 ^ data
     }
-    hash &= Q_HASH_MASK;
+    return hash;
+}
+
+STATIC size_t qstr_hash_from_raw(uint32_t raw_hash) {
+    size_t hash = raw_hash & Q_HASH_MASK;
     // Make sure that valid hash is never zero, zero means "hash not computed"
     if (hash == 0) {
         hash++;
@@ -76,6 +81,44 @@ size_t qstr_compute_hash(const byte *data, size_t len) {
     return hash;
 }
 
+// this must match the equivalent function in makeqstrdata.py
+size_t qstr_compute_hash(const byte *data, size_t len) {
+    return qstr_hash_from_raw(qstr_compute_raw_hash(data, len));
+}
+
+#if MICROPY_QSTR_INDEX
+// Number of index slots for a pool of `alloc` qstrs; keeps the index at most 3/4 full.
+// this must match index_size in makeqstrdata.py
+STATIC size_t qstr_index_size(size_t alloc) {
+    size_t size = 1;
+    while (size < alloc + alloc / 3 + 1) {
+        size *= 2;
+    }
+    return size;
+}
+
+// djb2 keeps similar names close together so spread them out before they pick a slot.
+// this must match index_slot in makeqstrdata.py
+static inline size_t qstr_index_slot(uint32_t raw_hash, size_t mask) {
+    uint32_t h = raw_hash ^ (raw_hash >> 16);
+    h *= 0x45d9f3b;
+    h ^= h >> 16;
+    return h & mask;
+}
+
+const qstr_short_t mp_qstr_const_index[] = {
+    #ifndef NO_QSTR
+#define QDEF(id, hash, len, str)
+#define TRANSLATION(id, length, compressed ...)
+#define QINDEX(entry) entry,
+    #include "genhdr/qstrdefs.generated.h"
+#undef QINDEX
+#undef TRANSLATION
+#undef QDEF
+    #endif
+};
+#endif
+
 const qstr_hash_t mp_qstr_const_hashes[] = {
     #ifndef NO_QSTR
 #define QDEF(id, hash, len, str) hash,
@@ -103,6 +146,14 @@ const qstr_pool_t mp_qstr_const_pool = {
     MP_QSTRnumber_of,   // corresponds to number of strings in array just below
     (qstr_hash_t *)mp_qstr_const_hashes,
     (qstr_len_t *)mp_qstr_const_lengths,
+    // CIRCUITPY-CHANGE
+    #if MICROPY_QSTR_INDEX && !defined(NO_QSTR)
+    (qstr_short_t *)mp_qstr_const_index,
+    MP_ARRAY_SIZE(mp_qstr_const_index) - 1,
+    #else
+    NULL,               // no index
+    0,
+    #endif
     {
         #ifndef NO_QSTR
 #define QDEF(id, hash, len, str) str,
@@ -148,7 +199,9 @@ STATIC const qstr_pool_t *PLACE_IN_ITCM(find_qstr)(qstr *q) {
 }
 
 // qstr_mutex must be taken while in this function
-STATIC qstr qstr_add(mp_uint_t hash, mp_uint_t len, const char *q_ptr) {
+STATIC qstr qstr_add(uint32_t raw_hash, mp_uint_t len, const char *q_ptr) {
+    // CIRCUITPY-CHANGE
+    mp_uint_t hash = qstr_hash_from_raw(raw_hash);
     DEBUG_printf("QSTR: add hash=%d len=%d data=%.*s\n", hash, len, len, q_ptr);
 
     // make sure we have room in the pool for a new qstr
@@ -158,8 +211,17 @@ STATIC qstr qstr_add(mp_uint_t hash, mp_uint_t len, const char *q_ptr) {
         // Put a lower bound on the allocation size in case the extra qstr pool has few entries
         new_alloc = MAX(MICROPY_ALLOC_QSTR_ENTRIES_INIT, new_alloc);
         #endif
+        // CIRCUITPY-CHANGE: the index goes straight after the qstr pointers to keep it aligned
+        size_t index_size = 0;
+        #if MICROPY_QSTR_INDEX
+        // Entries are stored as index + 1 in a qstr_short_t.
+        if (new_alloc < (1 << (8 * sizeof(qstr_short_t))) - 1) {
+            index_size = qstr_index_size(new_alloc);
+        }
+        #endif
         mp_uint_t pool_size = sizeof(qstr_pool_t)
-            + (sizeof(const char *) + sizeof(qstr_hash_t) + sizeof(qstr_len_t)) * new_alloc;
+            + (sizeof(const char *) + sizeof(qstr_hash_t) + sizeof(qstr_len_t)) * new_alloc
+            + sizeof(qstr_short_t) * index_size;
         qstr_pool_t *pool = (qstr_pool_t *)m_malloc_maybe(pool_size);
         if (pool == NULL) {
             // Keep qstr_last_chunk consistent with qstr_pool_t: qstr_last_chunk is not scanned
@@ -171,7 +233,15 @@ STATIC qstr qstr_add(mp_uint_t hash, mp_uint_t len, const char *q_ptr) {
             QSTR_EXIT();
             m_malloc_fail(new_alloc);
         }
-        pool->hashes = (qstr_hash_t *)(pool->qstrs + new_alloc);
+        // CIRCUITPY-CHANGE
+        pool->index = NULL;
+        pool->index_mask = 0;
+        if (index_size > 0) {
+            pool->index = (qstr_short_t *)(pool->qstrs + new_alloc);
+            pool->index_mask = index_size - 1;
+            memset(pool->index, 0, sizeof(qstr_short_t) * index_size);
+        }
+        pool->hashes = (qstr_hash_t *)((qstr_short_t *)(pool->qstrs + new_alloc) + index_size);
         pool->lengths = (qstr_len_t *)(pool->hashes + new_alloc);
         pool->prev = MP_STATE_VM(last_pool);
         pool->total_prev_len = MP_STATE_VM(last_pool)->total_prev_len + MP_STATE_VM(last_pool)->len;
@@ -188,16 +258,43 @@ STATIC qstr qstr_add(mp_uint_t hash, mp_uint_t len, const char *q_ptr) {
     MP_STATE_VM(last_pool)->qstrs[at] = q_ptr;
     MP_STATE_VM(last_pool)->len++;
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_QSTR_INDEX
+    qstr_pool_t *pool = MP_STATE_VM(last_pool);
+    if (pool->index != NULL) {
+        size_t slot = qstr_index_slot(raw_hash, pool->index_mask);
+        while (pool->index[slot] != 0) {
+            slot = (slot + 1) & pool->index_mask;
+        }
+        pool->index[slot] = at + 1;
+    }
+    #endif
+
     // return id for the newly-added qstr
     return MP_STATE_VM(last_pool)->total_prev_len + at;
 }
 
 qstr qstr_find_strn(const char *str, size_t str_len) {
     // work out hash of str
-    size_t str_hash = qstr_compute_hash((const byte *)str, str_len);
+    // CIRCUITPY-CHANGE
+    uint32_t raw_hash = qstr_compute_raw_hash((const byte *)str, str_len);
+    size_t str_hash = qstr_hash_from_raw(raw_hash);
 
     // search pools for the data
     for (const qstr_pool_t *pool = MP_STATE_VM(last_pool); pool != NULL; pool = pool->prev) {
+        // CIRCUITPY-CHANGE
+        #if MICROPY_QSTR_INDEX
+        if (pool->index != NULL) {
+            for (size_t slot = qstr_index_slot(raw_hash, pool->index_mask); pool->index[slot] != 0; slot = (slot + 1) & pool->index_mask) {
+                mp_uint_t at = pool->index[slot] - 1;
+                if (pool->hashes[at] == str_hash && pool->lengths[at] == str_len
+                    && memcmp(pool->qstrs[at], str, str_len) == 0) {
+                    return pool->total_prev_len + at;
+                }
+            }
+            continue;
+        }
+        #endif
         for (mp_uint_t at = 0, top = pool->len; at < top; at++) {
             if (pool->hashes[at] == str_hash && pool->lengths[at] == str_len
                 && memcmp(pool->qstrs[at], str, str_len) == 0) {
@@ -214,7 +311,9 @@ qstr qstr_from_str(const char *str) {
     return qstr_from_strn(str, strlen(str));
 }
 
-qstr qstr_from_strn(const char *str, size_t len) {
+// CIRCUITPY-CHANGE: data_is_static means str is null terminated and outlives the
+// VM, so it can be referenced directly instead of being copied into a chunk.
+STATIC qstr qstr_from_strn_helper(const char *str, size_t len, bool data_is_static) {
     QSTR_ENTER();
     qstr q = qstr_find_strn(str, len);
     if (q == 0) {
@@ -226,6 +325,13 @@ qstr qstr_from_strn(const char *str, size_t len) {
             mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("Name too long"));
         }
 
+        if (data_is_static) {
+            assert(str[len] == '\0');
+            q = qstr_add(qstr_compute_raw_hash((const byte *)str, len), len, str);
+            QSTR_EXIT();
+            return q;
+        }
+
         // compute number of bytes needed to intern this string
         size_t n_bytes = len + 1;
 
@@ -267,15 +373,25 @@ qstr qstr_from_strn(const char *str, size_t len) {
         MP_STATE_VM(qstr_last_used) += n_bytes;
 
         // store the interned strings' data
-        size_t hash = qstr_compute_hash((const byte *)str, len);
+        // CIRCUITPY-CHANGE
+        uint32_t raw_hash = qstr_compute_raw_hash((const byte *)str, len);
         memcpy(q_ptr, str, len);
         q_ptr[len] = '\0';
-        q = qstr_add(hash, len, q_ptr);
+        q = qstr_add(raw_hash, len, q_ptr);
     }
     QSTR_EXIT();
     return q;
 }
 
+qstr qstr_from_strn(const char *str, size_t len) {
+    return qstr_from_strn_helper(str, len, false);
+}
+
+// CIRCUITPY-CHANGE
+qstr qstr_from_strn_static(const char *str, size_t len) {
+    return qstr_from_strn_helper(str, len, true);
+}
+
 mp_uint_t qstr_hash(qstr q) {
     const qstr_pool_t *pool = find_qstr(&q);
     return pool->hashes[q];
@@ -313,7 +429,9 @@ void qstr_pool_info(size_t *n_pool, size_t *n_qstr, size_t *n_str_data_bytes, si
         *n_total_bytes += gc_nbytes(pool); // this counts actual bytes used in heap
         #else
         *n_total_bytes += sizeof(qstr_pool_t)
-            + (sizeof(const char *) + sizeof(qstr_hash_t) + sizeof(qstr_len_t)) * pool->alloc;
+            + (sizeof(const char *) + sizeof(qstr_hash_t) + sizeof(qstr_len_t)) * pool->alloc
+            // CIRCUITPY-CHANGE
+            + (pool->index != NULL ? sizeof(qstr_short_t) * (pool->index_mask + 1) : 0);
         #endif
     }
     *n_total_bytes += *n_str_data_bytes;
@@ -74,6 +74,10 @@ typedef struct _qstr_pool_t {
     size_t len;
     qstr_hash_t *hashes;
     qstr_len_t *lengths;
+    // CIRCUITPY-CHANGE: open-addressed hash index of (local qstr index + 1), 0 for an
+    // empty slot. NULL if the pool has no index and must be scanned.
+    qstr_short_t *index;
+    size_t index_mask;
     const char *qstrs[];
 } qstr_pool_t;
 
@@ -87,6 +91,8 @@ qstr qstr_find_strn(const char *str, size_t str_len); // returns MP_QSTRnull if
 
 qstr qstr_from_str(const char *str);
 qstr qstr_from_strn(const char *str, size_t len);
+// CIRCUITPY-CHANGE: str must be null terminated and remain valid for the life of the VM
+qstr qstr_from_strn_static(const char *str, size_t len);
 
 mp_uint_t qstr_hash(qstr q);
 const char *qstr_str(qstr q);
@@ -50,7 +50,8 @@ STATIC mp_uint_t mp_reader_mem_readbyte(void *data) {
 
 STATIC void mp_reader_mem_close(void *data) {
     mp_reader_mem_t *reader = (mp_reader_mem_t *)data;
-    if (reader->free_len > 0) {
+    // CIRCUITPY-CHANGE
+    if (reader->free_len > 0 && reader->free_len != MP_READER_IS_ROM) {
         m_del(char, (char *)reader->beg, reader->free_len);
     }
     m_del_obj(mp_reader_mem_t, reader);
@@ -67,6 +68,20 @@ void mp_reader_new_mem(mp_reader_t *reader, const byte *buf, size_t len, size_t
     reader->close = mp_reader_mem_close;
 }
 
+// CIRCUITPY-CHANGE
+const byte *mp_reader_try_read_rom(mp_reader_t *reader, size_t len) {
+    if (reader->readbyte != mp_reader_mem_readbyte) {
+        return NULL;
+    }
+    mp_reader_mem_t *rm = reader->data;
+    if (rm->free_len != MP_READER_IS_ROM || len > (size_t)(rm->end - rm->cur)) {
+        return NULL;
+    }
+    const byte *data = rm->cur;
+    rm->cur += len;
+    return data;
+}
+
 #if MICROPY_READER_POSIX
 
 #include <sys/stat.h>
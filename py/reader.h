@@ -39,7 +39,14 @@ typedef struct _mp_reader_t {
     void (*close)(void *data);
 } mp_reader_t;
 
+// CIRCUITPY-CHANGE: pass as free_len to mp_reader_new_mem when buf stays mapped
+// for the life of the VM, so that loaders may reference data in place.
+#define MP_READER_IS_ROM ((size_t)-1)
+
 void mp_reader_new_mem(mp_reader_t *reader, const byte *buf, size_t len, size_t free_len);
+// CIRCUITPY-CHANGE: if reader reads from ROM memory, return a pointer to the next
+// len bytes and advance past them; otherwise return NULL and consume nothing.
+const byte *mp_reader_try_read_rom(mp_reader_t *reader, size_t len);
 void mp_reader_new_file(mp_reader_t *reader, const char *filename);
 void mp_reader_new_file_from_fd(mp_reader_t *reader, int fd, bool close_fd);
 
@@ -99,6 +99,11 @@ void mp_init(void) {
 
     mp_obj_exception_initialize0(&MP_STATE_VM(mp_reload_exception), &mp_type_ReloadException);
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GEN_POOL
+    mp_obj_gen_pool_clear();
+    #endif
+
     // call port specific initialization if any
     #ifdef MICROPY_PORT_INIT_FUNC
     MICROPY_PORT_INIT_FUNC;
@@ -128,7 +133,8 @@ void mp_init(void) {
     MP_STATE_VM(mp_module_builtins_override_dict) = NULL;
     #endif
 
-    #if MICROPY_PERSISTENT_CODE_TRACK_RELOC_CODE
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PERSISTENT_CODE_TRACK_RELOC_CODE || MICROPY_PERSISTENT_CODE_TRACK_BSS_RODATA
     MP_STATE_VM(track_reloc_code_list) = MP_OBJ_NULL;
     #endif
 
@@ -170,6 +176,9 @@ void mp_init(void) {
     #if MICROPY_PY_SYS_SETTRACE
     MP_STATE_THREAD(prof_trace_callback) = MP_OBJ_NULL;
     MP_STATE_THREAD(prof_callback_is_executing) = false;
+    #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_TRACK_CURRENT_CODE_STATE
     MP_STATE_THREAD(current_code_state) = NULL;
     #endif
 
@@ -181,6 +190,11 @@ void mp_init(void) {
     MP_STATE_VM(bluetooth) = MP_OBJ_NULL;
     #endif
 
+    // CIRCUITPY-CHANGE: the compiled patterns were on the previous heap.
+    #if MICROPY_PY_RE && MICROPY_PY_RE_CACHE_SIZE > 0
+    memset(MP_STATE_VM(re_cache), 0, sizeof(MP_STATE_VM(re_cache)));
+    #endif
+
     #if MICROPY_PY_THREAD_GIL
     mp_thread_mutex_init(&MP_STATE_VM(gil_mutex));
     #endif
@@ -1280,6 +1294,52 @@ void mp_load_method(mp_obj_t base, qstr attr, mp_obj_t *dest) {
     }
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_INLINE_CACHE
+// Acts like mp_load_method, but attributes of modules, and of native types
+// that don't implement attr themselves, are looked up through a cache site.
+// Anything else, including a cache miss, takes the regular path.
+void mp_load_method_cached(mp_obj_t base, qstr attr, mp_obj_t *dest, mp_map_cache_site_t *site) {
+    const mp_obj_type_t *type = mp_obj_get_type(base);
+    if (attr != MP_QSTR___class__ && attr != MP_QSTR___next__) {
+        if (type == &mp_type_module) {
+            mp_obj_module_t *module = MP_OBJ_TO_PTR(base);
+            mp_map_elem_t *elem = mp_map_lookup_cached(&module->globals->map, MP_OBJ_NEW_QSTR(attr), site);
+            if (elem != NULL) {
+                dest[0] = elem->value;
+                dest[1] = MP_OBJ_NULL;
+                return;
+            }
+        } else if (!MP_OBJ_TYPE_HAS_SLOT(type, attr) && MP_OBJ_TYPE_HAS_SLOT(type, locals_dict)) {
+            mp_map_t *locals_map = &MP_OBJ_TYPE_GET_SLOT(type, locals_dict)->map;
+            mp_map_elem_t *elem = mp_map_lookup_cached(locals_map, MP_OBJ_NEW_QSTR(attr), site);
+            if (elem != NULL
+                #if MICROPY_PY_BUILTINS_PROPERTY
+                // Same property flag check as mp_load_method_maybe.
+                && !(mp_obj_is_type(elem->value, &mp_type_property) && (type->flags & MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS) == 0)
+                #endif
+                ) {
+                dest[0] = MP_OBJ_NULL;
+                dest[1] = MP_OBJ_NULL;
+                mp_convert_member_lookup(base, type, elem->value, dest);
+                return;
+            }
+        }
+    }
+    mp_load_method(base, attr, dest);
+}
+
+mp_obj_t mp_load_attr_cached(mp_obj_t base, qstr attr, mp_map_cache_site_t *site) {
+    mp_obj_t dest[2];
+    mp_load_method_cached(base, attr, dest, site);
+    if (dest[1] == MP_OBJ_NULL) {
+        return dest[0];
+    } else {
+        return mp_obj_new_bound_meth(dest[0], dest[1]);
+    }
+}
+#endif
+
 // Acts like mp_load_method_maybe but catches AttributeError, and all other exceptions if requested
 void mp_load_method_protected(mp_obj_t obj, qstr attr, mp_obj_t *dest, bool catch_all_exc) {
     nlr_buf_t nlr;
@@ -1895,7 +1955,12 @@ NORETURN MP_COLD void mp_raise_type_arg(const mp_obj_type_t *exc_type, mp_obj_t
 // Leave this as not COLD because it is used by iterators in normal execution.
 NORETURN void mp_raise_StopIteration(mp_obj_t arg) {
     if (arg == MP_OBJ_NULL) {
+        // CIRCUITPY-CHANGE
+        #if MICROPY_PREALLOCATED_EXCEPTIONS
+        nlr_raise(mp_obj_exception_preallocated_StopIteration());
+        #else
         mp_raise_type(&mp_type_StopIteration);
+        #endif
     } else {
         mp_raise_type_arg(&mp_type_StopIteration, arg);
     }
@@ -1912,6 +1977,13 @@ NORETURN void mp_raise_TypeError_int_conversion(mp_const_obj_t arg) {
 }
 
 NORETURN MP_COLD void mp_raise_OSError(int errno_) {
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PREALLOCATED_EXCEPTIONS
+    mp_obj_t exc = mp_obj_exception_preallocated_OSError(errno_);
+    if (exc != MP_OBJ_NULL) {
+        nlr_raise(exc);
+    }
+    #endif
     mp_raise_type_arg(&mp_type_OSError, MP_OBJ_NEW_SMALL_INT(errno_));
 }
 
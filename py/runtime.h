@@ -211,6 +211,11 @@ void mp_convert_member_lookup(mp_obj_t obj, const mp_obj_type_t *type, mp_obj_t
 void mp_load_method(mp_obj_t base, qstr attr, mp_obj_t *dest);
 void mp_load_method_maybe(mp_obj_t base, qstr attr, mp_obj_t *dest);
 void mp_load_method_protected(mp_obj_t obj, qstr attr, mp_obj_t *dest, bool catch_all_exc);
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_INLINE_CACHE
+void mp_load_method_cached(mp_obj_t base, qstr attr, mp_obj_t *dest, mp_map_cache_site_t *site);
+mp_obj_t mp_load_attr_cached(mp_obj_t base, qstr attr, mp_map_cache_site_t *site);
+#endif
 void mp_load_super_method(qstr attr, mp_obj_t *dest);
 void mp_store_attr(mp_obj_t base, qstr attr, mp_obj_t val);
 
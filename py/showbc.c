@@ -526,6 +526,48 @@ const byte *mp_bytecode_print_str(const mp_print_t *print, const byte *ip_start,
             mp_printf(print, "IMPORT_STAR");
             break;
 
+        // CIRCUITPY-CHANGE
+        #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+        case MP_BC_LOAD_FAST_LOAD_FAST:
+            mp_printf(print, "LOAD_FAST_LOAD_FAST %d %d", *ip & 0x0f, *ip >> 4);
+            ip += 1;
+            break;
+
+        case MP_BC_STORE_FAST_LOAD_FAST:
+            mp_printf(print, "STORE_FAST_LOAD_FAST %d %d", *ip & 0x0f, *ip >> 4);
+            ip += 1;
+            break;
+
+        case MP_BC_LOAD_FAST_LOAD_CONST_SMALL_INT:
+            mp_printf(print, "LOAD_FAST_LOAD_CONST_SMALL_INT %d %d", *ip & 0x0f, *ip >> 4);
+            ip += 1;
+            break;
+
+        case MP_BC_LOAD_FAST_LOAD_FAST_LOAD_SUBSCR:
+            mp_printf(print, "LOAD_FAST_LOAD_FAST_LOAD_SUBSCR %d %d", *ip & 0x0f, *ip >> 4);
+            ip += 1;
+            break;
+
+        case MP_BC_LOAD_FAST_LOAD_ATTR_MULTI:
+        case MP_BC_LOAD_FAST_LOAD_ATTR_MULTI + 1:
+        case MP_BC_LOAD_FAST_LOAD_ATTR_MULTI + 2: {
+            mp_uint_t local_num = ip[-1] - MP_BC_LOAD_FAST_LOAD_ATTR_MULTI;
+            DECODE_QSTR;
+            mp_printf(print, "LOAD_FAST_LOAD_ATTR " UINT_FMT " %s", local_num, qstr_str(qst));
+            break;
+        }
+
+        case MP_BC_BINARY_OP_POP_JUMP_IF: {
+            DECODE_SLABEL;
+            mp_uint_t op = *ip & 0x7f;
+            mp_printf(print, "BINARY_OP_POP_JUMP_IF_%s " UINT_FMT " %s " UINT_FMT,
+                *ip & 0x80 ? "TRUE" : "FALSE", op,
+                qstr_str(mp_binary_op_method_name[op]), (mp_uint_t)(ip + unum - ip_start));
+            ip += 1;
+            break;
+        }
+        #endif
+
         default:
             if (ip[-1] < MP_BC_LOAD_CONST_SMALL_INT_MULTI + 64) {
                 mp_printf(print, "LOAD_CONST_SMALL_INT " INT_FMT, (mp_int_t)ip[-1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI - 16);
@@ -347,6 +347,58 @@ STATIC mp_obj_t stream_readall(mp_obj_t self_in) {
 }
 
 // Unbuffered, inefficient implementation of readline() for raw I/O files.
+// CIRCUITPY-CHANGE
+#define STREAM_READLINE_CHUNK (128)
+
+// CIRCUITPY-CHANGE: read a chunk at a time, and seek back over whatever follows
+// the newline. Returns false, having read nothing, if the stream can't seek
+// from where it is.
+STATIC bool stream_readline_seek_back(mp_obj_t stream, const mp_stream_p_t *stream_p, mp_int_t max_size, vstr_t *vstr) {
+    struct mp_stream_seek_t seek_s = { .offset = 0, .whence = SEEK_CUR };
+    int error;
+    if (stream_p->ioctl(stream, MP_STREAM_SEEK, (mp_uint_t)(uintptr_t)&seek_s, &error) == MP_STREAM_ERROR) {
+        return false;
+    }
+
+    while (max_size != 0) {
+        mp_uint_t chunk = STREAM_READLINE_CHUNK;
+        if (max_size != -1 && (mp_uint_t)max_size < chunk) {
+            chunk = max_size;
+        }
+        char *p = vstr_add_len(vstr, chunk);
+        mp_uint_t out_sz = stream_p->read(stream, p, chunk, &error);
+        if (out_sz == MP_STREAM_ERROR) {
+            vstr_cut_tail_bytes(vstr, chunk);
+            // Report what was read so far, like the byte at a time loop does.
+            if (mp_is_nonblocking_error(error) && vstr->len > 0) {
+                break;
+            }
+            mp_raise_OSError(error);
+        }
+        const char *newline = memchr(p, '\n', out_sz);
+        if (newline != NULL) {
+            mp_uint_t extra = out_sz - (newline + 1 - p);
+            vstr_cut_tail_bytes(vstr, chunk - out_sz + extra);
+            if (extra > 0) {
+                seek_s.offset = -(mp_off_t)extra;
+                seek_s.whence = SEEK_CUR;
+                if (stream_p->ioctl(stream, MP_STREAM_SEEK, (mp_uint_t)(uintptr_t)&seek_s, &error) == MP_STREAM_ERROR) {
+                    mp_raise_OSError(error);
+                }
+            }
+            break;
+        }
+        vstr_cut_tail_bytes(vstr, chunk - out_sz);
+        if (out_sz == 0) {
+            break;
+        }
+        if (max_size != -1) {
+            max_size -= out_sz;
+        }
+    }
+    return true;
+}
+
 STATIC mp_obj_t stream_unbuffered_readline(size_t n_args, const mp_obj_t *args) {
     const mp_stream_p_t *stream_p = mp_get_stream(args[0]);
 
@@ -362,6 +414,11 @@ STATIC mp_obj_t stream_unbuffered_readline(size_t n_args, const mp_obj_t *args)
         vstr_init(&vstr, 16);
     }
 
+    // CIRCUITPY-CHANGE
+    if (stream_p->readline_can_seek_back && stream_readline_seek_back(args[0], stream_p, max_size, &vstr)) {
+        max_size = 0;
+    }
+
     while (max_size == -1 || max_size-- != 0) {
         char *p = vstr_add_len(&vstr, 1);
         int error;
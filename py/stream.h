@@ -80,6 +80,8 @@ typedef struct _mp_stream_p_t {
     bool pyserial_readinto_compatibility : 1;         // Disallow size parameter in readinto()
     bool pyserial_read_compatibility : 1;             // Disallow omitting read(size) size parameter
     bool pyserial_dont_return_none_compatibility : 1; // Don't return None for read() or readinto()
+    // CIRCUITPY-CHANGE
+    bool readline_can_seek_back : 1; // readline() may read ahead and seek back over the extra bytes
 } mp_stream_p_t;
 
 MP_DECLARE_CONST_FUN_OBJ_VAR_BETWEEN(mp_stream_read_obj);
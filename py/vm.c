@@ -34,6 +34,9 @@
 #include "py/objfun.h"
 #include "py/runtime.h"
 #include "py/bc0.h"
+#include "py/objgenerator.h"
+// CIRCUITPY-CHANGE
+#include "py/smallint.h"
 #include "py/profile.h"
 
 // *FORMAT-OFF*
@@ -108,6 +111,98 @@
     DECODE_UINT; \
     mp_obj_t obj = (mp_obj_t)code_state->fun_bc->context->constants.obj_table[unum]
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_INLINE_CACHE
+// Shared by functions whose own cache table couldn't be allocated. Hits are
+// validated against the map being searched, so sharing only costs hit rate.
+STATIC mp_map_cache_site_t vm_shared_inline_cache[MICROPY_OPT_INLINE_CACHE_SITES];
+
+// Returns the cache site for the load whose operands end at ip.
+STATIC mp_map_cache_site_t *vm_inline_cache_site(mp_code_state_t *code_state, const byte *ip) {
+    mp_obj_fun_bc_t *fun = code_state->fun_bc;
+    if (fun->inline_cache == NULL) {
+        mp_map_cache_site_t *sites = m_new_maybe(mp_map_cache_site_t, MICROPY_OPT_INLINE_CACHE_SITES);
+        if (sites != NULL) {
+            memset(sites, 0, sizeof(mp_map_cache_site_t) * MICROPY_OPT_INLINE_CACHE_SITES);
+        } else {
+            sites = vm_shared_inline_cache;
+        }
+        fun->inline_cache = sites;
+    }
+    return &fun->inline_cache[(size_t)(ip - fun->bytecode) % MICROPY_OPT_INLINE_CACHE_SITES];
+}
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_VM_SMALL_INT_BINARY_OP
+// Evaluate the cheap binary ops on two small ints without leaving the VM.
+// Anything else, including results that don't fit in a small int and shifts
+// that must raise, goes through mp_binary_op so the semantics are unchanged.
+STATIC inline MP_ALWAYSINLINE mp_obj_t vm_binary_op(mp_binary_op_t op, mp_obj_t lhs, mp_obj_t rhs) {
+    if (mp_obj_is_small_int(lhs) && mp_obj_is_small_int(rhs)) {
+        mp_int_t lhs_val = MP_OBJ_SMALL_INT_VALUE(lhs);
+        mp_int_t rhs_val = MP_OBJ_SMALL_INT_VALUE(rhs);
+        switch (op) {
+            case MP_BINARY_OP_LESS:
+                return mp_obj_new_bool(lhs_val < rhs_val);
+            case MP_BINARY_OP_MORE:
+                return mp_obj_new_bool(lhs_val > rhs_val);
+            case MP_BINARY_OP_EQUAL:
+                return mp_obj_new_bool(lhs_val == rhs_val);
+            case MP_BINARY_OP_LESS_EQUAL:
+                return mp_obj_new_bool(lhs_val <= rhs_val);
+            case MP_BINARY_OP_MORE_EQUAL:
+                return mp_obj_new_bool(lhs_val >= rhs_val);
+            case MP_BINARY_OP_NOT_EQUAL:
+                return mp_obj_new_bool(lhs_val != rhs_val);
+            case MP_BINARY_OP_OR:
+            case MP_BINARY_OP_INPLACE_OR:
+                return MP_OBJ_NEW_SMALL_INT(lhs_val | rhs_val);
+            case MP_BINARY_OP_XOR:
+            case MP_BINARY_OP_INPLACE_XOR:
+                return MP_OBJ_NEW_SMALL_INT(lhs_val ^ rhs_val);
+            case MP_BINARY_OP_AND:
+            case MP_BINARY_OP_INPLACE_AND:
+                return MP_OBJ_NEW_SMALL_INT(lhs_val & rhs_val);
+            case MP_BINARY_OP_LSHIFT:
+            case MP_BINARY_OP_INPLACE_LSHIFT:
+                if (rhs_val >= 0 && rhs_val < (mp_int_t)(sizeof(lhs_val) * MP_BITS_PER_BYTE)
+                    && lhs_val <= (MP_SMALL_INT_MAX >> rhs_val)
+                    && lhs_val >= (MP_SMALL_INT_MIN >> rhs_val)) {
+                    return MP_OBJ_NEW_SMALL_INT((mp_uint_t)lhs_val << rhs_val);
+                }
+                break;
+            case MP_BINARY_OP_RSHIFT:
+            case MP_BINARY_OP_INPLACE_RSHIFT:
+                if (rhs_val >= 0 && rhs_val < (mp_int_t)(sizeof(lhs_val) * MP_BITS_PER_BYTE)) {
+                    return MP_OBJ_NEW_SMALL_INT(lhs_val >> rhs_val);
+                }
+                break;
+            // The sum or difference of two small ints always fits in mp_int_t.
+            case MP_BINARY_OP_ADD:
+            case MP_BINARY_OP_INPLACE_ADD:
+                lhs_val += rhs_val;
+                if (MP_SMALL_INT_FITS(lhs_val)) {
+                    return MP_OBJ_NEW_SMALL_INT(lhs_val);
+                }
+                break;
+            case MP_BINARY_OP_SUBTRACT:
+            case MP_BINARY_OP_INPLACE_SUBTRACT:
+                lhs_val -= rhs_val;
+                if (MP_SMALL_INT_FITS(lhs_val)) {
+                    return MP_OBJ_NEW_SMALL_INT(lhs_val);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    return mp_binary_op(op, lhs, rhs);
+}
+#else
+#define vm_binary_op mp_binary_op
+#endif
+
 #define PUSH(val) *++sp = (val)
 #define POP() (*sp--)
 #define TOP() (*sp)
@@ -188,9 +283,22 @@
 } while(0)
 
 #else // MICROPY_PY_SYS_SETTRACE
+// CIRCUITPY-CHANGE
+#if MICROPY_TRACK_CURRENT_CODE_STATE
+#define FRAME_SETUP() do { \
+    MP_STATE_THREAD(current_code_state) = code_state; \
+} while (0)
+#define FRAME_ENTER() do { \
+    code_state->prev_state = MP_STATE_THREAD(current_code_state); \
+} while (0)
+#define FRAME_LEAVE() do { \
+    MP_STATE_THREAD(current_code_state) = code_state->prev_state; \
+} while (0)
+#else
 #define FRAME_SETUP()
 #define FRAME_ENTER()
 #define FRAME_LEAVE()
+#endif
 #define FRAME_UPDATE()
 #define TRACE_TICK(current_ip, current_sp, is_exception)
 #endif // MICROPY_PY_SYS_SETTRACE
@@ -205,6 +313,32 @@ STATIC mp_obj_t get_active_exception(mp_exc_stack_t *exc_sp, mp_exc_stack_t *exc
     return MP_OBJ_NULL;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GEN_POOL
+// Returns true if the call whose operands end at ip is followed by the code for
+// "await" or "yield from", so its result lives only on this frame's stack.
+STATIC bool vm_call_is_awaited(mp_code_state_t *code_state, const byte *ip) {
+    if (*ip == MP_BC_GET_ITER) {
+        ip++;
+    } else if (*ip == MP_BC_LOAD_METHOD) {
+        ip++;
+        mp_uint_t qst = mp_decode_uint(&ip);
+        #if MICROPY_EMIT_BYTECODE_USES_QSTR_TABLE
+        qst = code_state->fun_bc->context->constants.qstr_table[qst];
+        #else
+        (void)code_state;
+        #endif
+        if (qst != MP_QSTR___await__ || ip[0] != MP_BC_CALL_METHOD || ip[1] != 0) {
+            return false;
+        }
+        ip += 2;
+    } else {
+        return false;
+    }
+    return ip[0] == MP_BC_LOAD_CONST_NONE && ip[1] == MP_BC_YIELD_FROM;
+}
+#endif
+
 // fastn has items in reverse order (fastn[0] is local[0], fastn[-1] is local[1], etc)
 // sp points to bottom of stack which grows up
 // returns:
@@ -402,23 +536,50 @@ dispatch_loop:
                 ENTRY(MP_BC_LOAD_NAME): {
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
-                    PUSH(mp_load_name(qst));
+                    // CIRCUITPY-CHANGE
+                    #if MICROPY_OPT_INLINE_CACHE
+                    mp_map_elem_t *elem = mp_map_lookup_cached(&mp_locals_get()->map, MP_OBJ_NEW_QSTR(qst), vm_inline_cache_site(code_state, ip));
+                    if (elem != NULL) {
+                        PUSH(elem->value);
+                    } else
+                    #endif
+                    {
+                        PUSH(mp_load_name(qst));
+                    }
                     DISPATCH();
                 }
 
                 ENTRY(MP_BC_LOAD_GLOBAL): {
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
-                    PUSH(mp_load_global(qst));
+                    // CIRCUITPY-CHANGE
+                    #if MICROPY_OPT_INLINE_CACHE
+                    mp_map_elem_t *elem = mp_map_lookup_cached(&mp_globals_get()->map, MP_OBJ_NEW_QSTR(qst), vm_inline_cache_site(code_state, ip));
+                    if (elem != NULL) {
+                        PUSH(elem->value);
+                    } else
+                    #endif
+                    {
+                        PUSH(mp_load_global(qst));
+                    }
                     DISPATCH();
                 }
 
-                ENTRY(MP_BC_LOAD_ATTR): {
+                ENTRY(MP_BC_LOAD_ATTR):
+                // CIRCUITPY-CHANGE
+                #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+                load_attr:
+                #endif
+                {
                     FRAME_UPDATE();
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
                     mp_obj_t top = TOP();
                     mp_obj_t obj;
+                    // CIRCUITPY-CHANGE
+                    #if MICROPY_OPT_INLINE_CACHE
+                    mp_map_cache_site_t *site = vm_inline_cache_site(code_state, ip);
+                    #endif
                     #if MICROPY_OPT_LOAD_ATTR_FAST_PATH
                     // For the specific case of an instance type, it implements .attr
                     // and forwards to its members map. Attribute lookups on instance
@@ -427,14 +588,22 @@ dispatch_loop:
                     mp_map_elem_t *elem = NULL;
                     if (mp_obj_is_instance_type(mp_obj_get_type(top))) {
                         mp_obj_instance_t *self = MP_OBJ_TO_PTR(top);
+                        #if MICROPY_OPT_INLINE_CACHE
+                        elem = mp_map_lookup_cached(&self->members, MP_OBJ_NEW_QSTR(qst), site);
+                        #else
                         elem = mp_map_lookup(&self->members, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
+                        #endif
                     }
                     if (elem) {
                         obj = elem->value;
                     } else
                     #endif
                     {
+                        #if MICROPY_OPT_INLINE_CACHE
+                        obj = mp_load_attr_cached(top, qst, site);
+                        #else
                         obj = mp_load_attr(top, qst);
+                        #endif
                     }
                     SET_TOP(obj);
                     DISPATCH();
@@ -443,7 +612,12 @@ dispatch_loop:
                 ENTRY(MP_BC_LOAD_METHOD): {
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
+                    // CIRCUITPY-CHANGE
+                    #if MICROPY_OPT_INLINE_CACHE
+                    mp_load_method_cached(*sp, qst, sp, vm_inline_cache_site(code_state, ip));
+                    #else
                     mp_load_method(*sp, qst, sp);
+                    #endif
                     sp += 1;
                     DISPATCH();
                 }
@@ -975,7 +1149,16 @@ unwind_jump:;
                         }
                     }
                     #endif
+                    // CIRCUITPY-CHANGE
+                    #if MICROPY_GEN_POOL
+                    mp_obj_t fun = *sp;
+                    #endif
                     SET_TOP(mp_call_function_n_kw(*sp, unum & 0xff, (unum >> 8) & 0xff, sp + 1));
+                    #if MICROPY_GEN_POOL
+                    if (vm_call_is_awaited(code_state, ip)) {
+                        mp_obj_gen_pool_mark(fun, TOP());
+                    }
+                    #endif
                     DISPATCH();
                 }
 
@@ -1060,7 +1243,16 @@ unwind_jump:;
                         }
                     }
                     #endif
+                    // CIRCUITPY-CHANGE
+                    #if MICROPY_GEN_POOL
+                    mp_obj_t fun = *sp;
+                    #endif
                     SET_TOP(mp_call_method_n_kw(unum & 0xff, (unum >> 8) & 0xff, sp));
+                    #if MICROPY_GEN_POOL
+                    if (vm_call_is_awaited(code_state, ip)) {
+                        mp_obj_gen_pool_mark(fun, TOP());
+                    }
+                    #endif
                     // CIRCUITPY-CHANGE
                     DISPATCH_WITH_PEND_EXC_CHECK();
                 }
@@ -1243,6 +1435,10 @@ yield:
                     } else if (ret_kind == MP_VM_RETURN_NORMAL) {
                         // The generator has finished, and returned a value via StopIteration
                         // Replace exhausted generator with the returned value
+                        // CIRCUITPY-CHANGE
+                        #if MICROPY_GEN_POOL
+                        mp_obj_gen_pool_release(TOP());
+                        #endif
                         SET_TOP(ret_value);
                         // If we injected GeneratorExit downstream, then even
                         // if it was swallowed, we re-raise GeneratorExit
@@ -1255,6 +1451,10 @@ yield:
                         assert(ret_kind == MP_VM_RETURN_EXCEPTION);
                         assert(!mp_obj_exception_match(ret_value, MP_OBJ_FROM_PTR(&mp_type_StopIteration)));
                         // Pop exhausted gen
+                        // CIRCUITPY-CHANGE
+                        #if MICROPY_GEN_POOL
+                        mp_obj_gen_pool_release(TOP());
+                        #endif
                         sp--;
                         RAISE(ret_value);
                     }
@@ -1283,6 +1483,75 @@ yield:
                     mp_import_all(POP());
                     DISPATCH();
 
+                // CIRCUITPY-CHANGE
+                #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+                ENTRY(MP_BC_LOAD_FAST_LOAD_FAST):
+                    obj_shared = fastn[-(ip[0] & 0x0f)];
+                    if (obj_shared == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    PUSH(obj_shared);
+                    obj_shared = fastn[-(*ip++ >> 4)];
+                    goto load_check;
+
+                ENTRY(MP_BC_STORE_FAST_LOAD_FAST):
+                    fastn[-(ip[0] & 0x0f)] = TOP();
+                    obj_shared = fastn[-(*ip++ >> 4)];
+                    if (obj_shared == MP_OBJ_NULL) {
+                        // The load may begin a new source line, so report
+                        // the error from where the load opcode would be.
+                        code_state->ip = ip - 1;
+                        goto local_name_error;
+                    }
+                    SET_TOP(obj_shared);
+                    DISPATCH();
+
+                ENTRY(MP_BC_LOAD_FAST_LOAD_CONST_SMALL_INT):
+                    obj_shared = fastn[-(ip[0] & 0x0f)];
+                    if (obj_shared == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    PUSH(obj_shared);
+                    PUSH(MP_OBJ_NEW_SMALL_INT(*ip++ >> 4));
+                    DISPATCH();
+
+                ENTRY(MP_BC_LOAD_FAST_LOAD_FAST_LOAD_SUBSCR): {
+                    mp_obj_t base = fastn[-(ip[0] & 0x0f)];
+                    mp_obj_t index = fastn[-(*ip++ >> 4)];
+                    if (base == MP_OBJ_NULL || index == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    MARK_EXC_IP_SELECTIVE();
+                    PUSH(mp_obj_subscr(base, index, MP_OBJ_SENTINEL));
+                    DISPATCH();
+                }
+
+                ENTRY(MP_BC_LOAD_FAST_LOAD_ATTR_MULTI):
+                #if !MICROPY_OPT_COMPUTED_GOTO
+                case MP_BC_LOAD_FAST_LOAD_ATTR_MULTI + 1:
+                case MP_BC_LOAD_FAST_LOAD_ATTR_MULTI + 2:
+                #endif
+                    obj_shared = fastn[MP_BC_LOAD_FAST_LOAD_ATTR_MULTI - (mp_int_t)ip[-1]];
+                    if (obj_shared == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    PUSH(obj_shared);
+                    goto load_attr;
+
+                ENTRY(MP_BC_BINARY_OP_POP_JUMP_IF): {
+                    MARK_EXC_IP_SELECTIVE();
+                    DECODE_SLABEL;
+                    const byte *target = ip + slab;
+                    byte op = *ip++;
+                    mp_obj_t rhs = POP();
+                    mp_obj_t lhs = POP();
+                    if (mp_obj_is_true(vm_binary_op(op & 0x7f, lhs, rhs)) == (op >> 7)) {
+                        ip = target;
+                    }
+                    DISPATCH_WITH_PEND_EXC_CHECK();
+                }
+                #endif
+
                 #if MICROPY_OPT_COMPUTED_GOTO
                 ENTRY(MP_BC_LOAD_CONST_SMALL_INT_MULTI):
                     PUSH(MP_OBJ_NEW_SMALL_INT((mp_int_t)ip[-1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI - MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS));
@@ -1305,7 +1574,7 @@ yield:
                     MARK_EXC_IP_SELECTIVE();
                     mp_obj_t rhs = POP();
                     mp_obj_t lhs = TOP();
-                    SET_TOP(mp_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
+                    SET_TOP(vm_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
                     DISPATCH();
                 }
 
@@ -1328,7 +1597,7 @@ yield:
                     } else if (ip[-1] < MP_BC_BINARY_OP_MULTI + MP_BC_BINARY_OP_MULTI_NUM) {
                         mp_obj_t rhs = POP();
                         mp_obj_t lhs = TOP();
-                        SET_TOP(mp_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
+                        SET_TOP(vm_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
                         DISPATCH();
                     } else
                 #endif // MICROPY_OPT_COMPUTED_GOTO
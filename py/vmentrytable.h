@@ -123,6 +123,15 @@ static entry_table_type const PLACE_IN_DTCM_DATA(entry_table[256]) = {
     [MP_BC_IMPORT_NAME] = COMPUTE_ENTRY(&& entry_MP_BC_IMPORT_NAME),
     [MP_BC_IMPORT_FROM] = COMPUTE_ENTRY(&& entry_MP_BC_IMPORT_FROM),
     [MP_BC_IMPORT_STAR] = COMPUTE_ENTRY(&& entry_MP_BC_IMPORT_STAR),
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_BC_SUPERINSTRUCTIONS
+    [MP_BC_LOAD_FAST_LOAD_FAST] = COMPUTE_ENTRY(&& entry_MP_BC_LOAD_FAST_LOAD_FAST),
+    [MP_BC_STORE_FAST_LOAD_FAST] = COMPUTE_ENTRY(&& entry_MP_BC_STORE_FAST_LOAD_FAST),
+    [MP_BC_LOAD_FAST_LOAD_CONST_SMALL_INT] = COMPUTE_ENTRY(&& entry_MP_BC_LOAD_FAST_LOAD_CONST_SMALL_INT),
+    [MP_BC_LOAD_FAST_LOAD_FAST_LOAD_SUBSCR] = COMPUTE_ENTRY(&& entry_MP_BC_LOAD_FAST_LOAD_FAST_LOAD_SUBSCR),
+    [MP_BC_LOAD_FAST_LOAD_ATTR_MULTI ... MP_BC_LOAD_FAST_LOAD_ATTR_MULTI + MP_BC_LOAD_FAST_LOAD_ATTR_MULTI_NUM - 1] = COMPUTE_ENTRY(&& entry_MP_BC_LOAD_FAST_LOAD_ATTR_MULTI),
+    [MP_BC_BINARY_OP_POP_JUMP_IF] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_POP_JUMP_IF),
+    #endif
     [MP_BC_LOAD_CONST_SMALL_INT_MULTI ... MP_BC_LOAD_CONST_SMALL_INT_MULTI + MP_BC_LOAD_CONST_SMALL_INT_MULTI_NUM - 1] = COMPUTE_ENTRY(&& entry_MP_BC_LOAD_CONST_SMALL_INT_MULTI),
     [MP_BC_LOAD_FAST_MULTI ... MP_BC_LOAD_FAST_MULTI + MP_BC_LOAD_FAST_MULTI_NUM - 1] = COMPUTE_ENTRY(&& entry_MP_BC_LOAD_FAST_MULTI),
     [MP_BC_STORE_FAST_MULTI ... MP_BC_STORE_FAST_MULTI + MP_BC_LOAD_FAST_MULTI_NUM - 1] = COMPUTE_ENTRY(&& entry_MP_BC_STORE_FAST_MULTI),
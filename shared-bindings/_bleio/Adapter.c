@@ -32,6 +32,7 @@
 #include "shared-bindings/_bleio/__init__.h"
 #include "shared-bindings/_bleio/Address.h"
 #include "shared-bindings/_bleio/Adapter.h"
+#include "shared-bindings/_bleio/UUID.h"
 
 #define ADV_INTERVAL_MIN (0.02f)
 #define ADV_INTERVAL_MIN_STRING "0.02"
@@ -282,7 +283,11 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_1(bleio_adapter_stop_advertising_obj, bleio_adapt
 //|         interval: float = 0.1,
 //|         window: float = 0.1,
 //|         minimum_rssi: int = -80,
-//|         active: bool = True
+//|         active: bool = True,
+//|         addresses: Optional[Sequence[Address]] = None,
+//|         manufacturer_ids: Optional[Sequence[int]] = None,
+//|         service_uuids: Optional[Sequence[UUID]] = None,
+//|         duplicate_timeout: float = 0
 //|     ) -> Iterable[ScanEntry]:
 //|         """Starts a BLE scan and returns an iterator of results. Advertisements and scan responses are
 //|         filtered and returned separately.
@@ -299,11 +304,23 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_1(bleio_adapter_stop_advertising_obj, bleio_adapt
 //|            window must be <= interval.
 //|         :param int minimum_rssi: the minimum rssi of entries to return.
 //|         :param bool active: retrieve scan responses for scannable advertisements.
+//|         :param Sequence[Address] addresses: only return packets from these addresses.
+//|         :param Sequence[int] manufacturer_ids: only return packets with manufacturer specific data
+//|             from one of these Bluetooth company identifiers.
+//|         :param Sequence[UUID] service_uuids: only return packets that list or carry service data for
+//|             one of these services.
+//|         :param float duplicate_timeout: when non-zero, drop packets with the same address and data as
+//|             one returned less than this many seconds ago.
+//|
+//|         All of the filters are applied as packets arrive, so ones that don't match never take up
+//|         buffer space. Use `ScanResults.read_into` to read many results without allocating.
+//|
 //|         :returns: an iterable of `_bleio.ScanEntry` objects
 //|         :rtype: iterable"""
 //|         ...
 STATIC mp_obj_t bleio_adapter_start_scan(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_prefixes, ARG_buffer_size, ARG_extended, ARG_timeout, ARG_interval, ARG_window, ARG_minimum_rssi, ARG_active };
+    enum { ARG_prefixes, ARG_buffer_size, ARG_extended, ARG_timeout, ARG_interval, ARG_window, ARG_minimum_rssi, ARG_active,
+           ARG_addresses, ARG_manufacturer_ids, ARG_service_uuids, ARG_duplicate_timeout };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_prefixes,  MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
         { MP_QSTR_buffer_size,  MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 512} },
@@ -313,6 +330,10 @@ STATIC mp_obj_t bleio_adapter_start_scan(size_t n_args, const mp_obj_t *pos_args
         { MP_QSTR_window,   MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
         { MP_QSTR_minimum_rssi,  MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = -80} },
         { MP_QSTR_active,  MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
+        { MP_QSTR_addresses, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_manufacturer_ids, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_service_uuids, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_duplicate_timeout, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
     };
 
     bleio_adapter_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
@@ -359,7 +380,58 @@ STATIC mp_obj_t bleio_adapter_start_scan(size_t n_args, const mp_obj_t *pos_args
         }
     }
 
-    return common_hal_bleio_adapter_start_scan(self, prefix_bufinfo.buf, prefix_bufinfo.len, args[ARG_extended].u_bool, args[ARG_buffer_size].u_int, timeout, interval, window, args[ARG_minimum_rssi].u_int, args[ARG_active].u_bool);
+    // The lists are copied to the heap, where the scan results keep them.
+    bleio_scan_filter_t filter = { 0 };
+    if (args[ARG_addresses].u_obj != mp_const_none) {
+        size_t count;
+        mp_obj_t *items;
+        mp_obj_get_array(args[ARG_addresses].u_obj, &count, &items);
+        uint8_t *addresses = m_malloc(count * NUM_BLEIO_ADDRESS_BYTES);
+        for (size_t i = 0; i < count; i++) {
+            bleio_address_obj_t *address = mp_arg_validate_type(items[i], &bleio_address_type, MP_QSTR_addresses);
+            mp_buffer_info_t address_bufinfo;
+            mp_get_buffer_raise(common_hal_bleio_address_get_address_bytes(address), &address_bufinfo, MP_BUFFER_READ);
+            memcpy(addresses + i * NUM_BLEIO_ADDRESS_BYTES, address_bufinfo.buf, NUM_BLEIO_ADDRESS_BYTES);
+        }
+        filter.addresses = addresses;
+        filter.address_count = count;
+    }
+    if (args[ARG_manufacturer_ids].u_obj != mp_const_none) {
+        size_t count;
+        mp_obj_t *items;
+        mp_obj_get_array(args[ARG_manufacturer_ids].u_obj, &count, &items);
+        uint16_t *manufacturer_ids = m_malloc(count * sizeof(uint16_t));
+        for (size_t i = 0; i < count; i++) {
+            manufacturer_ids[i] = mp_arg_validate_int_range(mp_obj_get_int(items[i]), 0, 0xffff, MP_QSTR_manufacturer_ids);
+        }
+        filter.manufacturer_ids = manufacturer_ids;
+        filter.manufacturer_id_count = count;
+    }
+    if (args[ARG_service_uuids].u_obj != mp_const_none) {
+        size_t count;
+        mp_obj_t *items;
+        mp_obj_get_array(args[ARG_service_uuids].u_obj, &count, &items);
+        uint8_t *service_uuids = m_malloc(count * BLEIO_SCAN_UUID_ENTRY_SIZE);
+        for (size_t i = 0; i < count; i++) {
+            bleio_uuid_obj_t *uuid = mp_arg_validate_type(items[i], &bleio_uuid_type, MP_QSTR_service_uuids);
+            uint8_t *entry = service_uuids + i * BLEIO_SCAN_UUID_ENTRY_SIZE;
+            memset(entry, 0, BLEIO_SCAN_UUID_ENTRY_SIZE);
+            if (common_hal_bleio_uuid_get_size(uuid) == 16) {
+                uint32_t uuid16 = common_hal_bleio_uuid_get_uuid16(uuid);
+                entry[0] = 2;
+                entry[1] = uuid16 & 0xff;
+                entry[2] = uuid16 >> 8;
+            } else {
+                entry[0] = 16;
+                common_hal_bleio_uuid_get_uuid128(uuid, entry + 1);
+            }
+        }
+        filter.service_uuids = service_uuids;
+        filter.service_uuid_count = count;
+    }
+    filter.duplicate_timeout_ms = (uint32_t)(mp_arg_validate_obj_float_non_negative(args[ARG_duplicate_timeout].u_obj, 0, MP_QSTR_duplicate_timeout) * 1000);
+
+    return common_hal_bleio_adapter_start_scan(self, prefix_bufinfo.buf, prefix_bufinfo.len, args[ARG_extended].u_bool, args[ARG_buffer_size].u_int, timeout, interval, window, args[ARG_minimum_rssi].u_int, args[ARG_active].u_bool, &filter);
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(bleio_adapter_start_scan_obj, 1, bleio_adapter_start_scan);
 
@@ -60,10 +60,34 @@ STATIC mp_obj_t scanresults_iternext(mp_obj_t self_in) {
 //|         """
 //|         ...
 //|
+//|     def read_into(self, buf: WriteableBuffer) -> int:
+//|         """Moves as many buffered results as fit into ``buf`` without allocating, and returns the
+//|         number of bytes written. Does not wait for results.
+//|
+//|         Each record is a 16 byte header, laid out as ``struct`` format ``"<HBbB6sxI"``, followed
+//|         by the advertising data. The header holds the data length, flags (bit 0 is connectable,
+//|         bit 1 is scan response), rssi, address type, address bytes and the low 32 bits of
+//|         `supervisor.ticks_ms` when it was received. A result too large for an empty ``buf`` is
+//|         dropped."""
+//|         ...
+//|
+STATIC mp_obj_t scanresults_read_into(mp_obj_t self_in, mp_obj_t buf_in) {
+    bleio_scanresults_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_WRITE);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_bleio_scanresults_read_into(self, bufinfo.buf, bufinfo.len));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(scanresults_read_into_obj, scanresults_read_into);
+
+STATIC const mp_rom_map_elem_t scanresults_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_read_into), MP_ROM_PTR(&scanresults_read_into_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(scanresults_locals_dict, scanresults_locals_dict_table);
 
 MP_DEFINE_CONST_OBJ_TYPE(
     bleio_scanresults_type,
     MP_QSTR_ScanResults,
     MP_TYPE_FLAG_ITER_IS_ITERNEXT,
-    iter, scanresults_iternext
+    iter, scanresults_iternext,
+    locals_dict, &scanresults_locals_dict
     );
@@ -35,5 +35,6 @@
 extern const mp_obj_type_t bleio_scanresults_type;
 
 mp_obj_t common_hal_bleio_scanresults_next(bleio_scanresults_obj_t *self);
+size_t common_hal_bleio_scanresults_read_into(bleio_scanresults_obj_t *self, uint8_t *buf, size_t len);
 
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_BLEIO_SCANRESULTS_H
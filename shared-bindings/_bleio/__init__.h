@@ -77,6 +77,7 @@ void common_hal_bleio_gatts_write(uint16_t handle, uint16_t conn_handle, mp_buff
 size_t common_hal_bleio_gattc_read(uint16_t handle, uint16_t conn_handle, uint8_t *buf, size_t len);
 void common_hal_bleio_gattc_write(uint16_t handle, uint16_t conn_handle, mp_buffer_info_t *bufinfo, bool write_no_response);
 
-void common_hal_bleio_gc_collect(void);
+// Registers the precise GC roots of the adapter and its connections, which live outside the heap.
+void common_hal_bleio_register_gc_roots(void);
 
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_BLEIO___INIT___H
@@ -57,10 +57,36 @@ STATIC const mp_obj_type_t _EVE_type;
 STATIC mp_obj_t _register(mp_obj_t self, mp_obj_t o) {
     common_hal__eve_t *eve = EVEHAL(self);
     mp_load_method(o, MP_QSTR_write, eve->dest);
+    #if EVE_NATIVE_SPI
+    eve->spi = NULL;
+    #endif
     return mp_const_none;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(register_obj, _register);
 
+#if EVE_NATIVE_SPI
+//|     def register_spi(self, spi: busio.SPI, cs: digitalio.DigitalInOut) -> None:
+//|         """Flush commands straight to the BT81x or FT81x bulk command register
+//|         ``REG_CMDB_WRITE`` over ``spi``, instead of calling the registered
+//|         ``write`` method. Free FIFO space is polled from ``REG_CMDB_SPACE``, so
+//|         flushes wait for the coprocessor when it is busy.
+//|
+//|         ``spi`` must already be configured for the EVE. ``cs`` must be an output
+//|         and is driven low for each transfer. The SPI lock is taken for each
+//|         transfer when it is free, and otherwise assumed to be held by the caller.
+//|
+//|         :param ~busio.SPI spi: The bus the EVE is on
+//|         :param ~digitalio.DigitalInOut cs: The EVE chip select"""
+//|         ...
+STATIC mp_obj_t _register_spi(mp_obj_t self, mp_obj_t spi, mp_obj_t cs) {
+    common_hal__eve_register_spi(EVEHAL(self),
+        MP_OBJ_TO_PTR(mp_arg_validate_type(spi, &busio_spi_type, MP_QSTR_spi)),
+        MP_OBJ_TO_PTR(mp_arg_validate_type(cs, &digitalio_digitalinout_type, MP_QSTR_cs)));
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(register_spi_obj, _register_spi);
+#endif
+
 //|     def flush(self) -> None:
 //|         """Send any queued drawing commands directly to the hardware.
 //|
@@ -1047,6 +1073,9 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(cmd_obj, 4, 4, _cmd);
 
 STATIC const mp_rom_map_elem_t _EVE_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_register), MP_ROM_PTR(&register_obj) },
+    #if EVE_NATIVE_SPI
+    { MP_ROM_QSTR(MP_QSTR_register_spi), MP_ROM_PTR(&register_spi_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_cc), MP_ROM_PTR(&cc_obj) },
     { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&flush_obj) },
     { MP_ROM_QSTR(MP_QSTR_Vertex2f), MP_ROM_PTR(&vertex2f_obj) },
@@ -1061,6 +1090,9 @@ STATIC mp_obj_t _EVE_make_new(const mp_obj_type_t *type, size_t n_args, size_t n
     mp_obj__EVE_t *o = mp_obj_malloc(mp_obj__EVE_t, &_EVE_type);
     o->_eve.n = 0;
     o->_eve.vscale = 16;
+    #if EVE_NATIVE_SPI
+    o->_eve.spi = NULL;
+    #endif
     return MP_OBJ_FROM_PTR(o);
 }
 
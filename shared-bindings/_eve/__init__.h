@@ -30,6 +30,9 @@
 #include "shared-module/_eve/__init__.h"
 
 void common_hal__eve_flush(common_hal__eve_t *eve);
+#if EVE_NATIVE_SPI
+void common_hal__eve_register_spi(common_hal__eve_t *eve, busio_spi_obj_t *spi, digitalio_digitalinout_obj_t *cs);
+#endif
 void common_hal__eve_add(common_hal__eve_t *eve, size_t len, void *buf);
 void common_hal__eve_Vertex2f(common_hal__eve_t *eve, mp_float_t x, mp_float_t y);
 
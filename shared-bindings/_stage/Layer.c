@@ -65,6 +65,8 @@ STATIC mp_obj_t layer_make_new(const mp_obj_type_t *type, size_t n_args,
     self->y = 0;
     self->frame = 0;
     self->rotation = false;
+    self->last_map = NULL;
+    self->rendered = false;
 
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(args[2], &bufinfo, MP_BUFFER_READ);
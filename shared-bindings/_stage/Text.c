@@ -63,6 +63,7 @@ STATIC mp_obj_t text_make_new(const mp_obj_type_t *type, size_t n_args,
     self->height = mp_obj_get_int(args[1]);
     self->x = 0;
     self->y = 0;
+    self->last_chars = NULL;
 
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(args[2], &bufinfo, MP_BUFFER_READ);
@@ -103,12 +103,75 @@ STATIC mp_obj_t stage_render(size_t n_args, const mp_obj_t *args) {
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(stage_render_obj, 10, 10, stage_render);
 
+//| def render_dirty(
+//|     x0: int,
+//|     y0: int,
+//|     x1: int,
+//|     y1: int,
+//|     layers: List[Layer],
+//|     buffer: WriteableBuffer,
+//|     display: busdisplay.BusDisplay,
+//|     scale: int,
+//|     vx: int,
+//|     vy: int,
+//| ) -> int:
+//|     """Like `render`, but only render and send the parts of the fragment that
+//|     changed since the last call.
+//|
+//|     Each layer remembers its position, frame, rotation and grid or text
+//|     contents as of the last call, and the fragment is split into 16x16
+//|     cells. Only the cells that a change touched are sent, grouped into as
+//|     few rectangles as is easy. A layer that wasn't passed last time counts
+//|     as changed everywhere it covers.
+//|
+//|     Changes it can't see need a full `render`: different graphics,
+//|     palettes, scrolling with ``vx`` or ``vy``, and layers that were removed.
+//|     The fragment can be at most 512 pixels on each side.
+//|
+//|     :return: The number of rectangles sent."""
+//|
+STATIC mp_obj_t stage_render_dirty(size_t n_args, const mp_obj_t *args) {
+    uint16_t x0 = mp_obj_get_int(args[0]);
+    uint16_t y0 = mp_obj_get_int(args[1]);
+    uint16_t x1 = mp_obj_get_int(args[2]);
+    uint16_t y1 = mp_obj_get_int(args[3]);
+    mp_arg_validate_int_range(x1 - x0, 0, STAGE_DIRTY_MAX_CELLS << STAGE_CELL_SHIFT, MP_QSTR_x1);
+    mp_arg_validate_int_range(y1 - y0, 0, STAGE_DIRTY_MAX_CELLS << STAGE_CELL_SHIFT, MP_QSTR_y1);
+
+    size_t layers_size = 0;
+    mp_obj_t *layers;
+    mp_obj_get_array(args[4], &layers_size, &layers);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[5], &bufinfo, MP_BUFFER_WRITE);
+    uint16_t *buffer = bufinfo.buf;
+    size_t buffer_size = bufinfo.len / 2; // 16-bit indexing
+
+    mp_obj_t native_display = mp_obj_cast_to_native_base(args[6],
+        &busdisplay_busdisplay_type);
+    if (!mp_obj_is_type(native_display, &busdisplay_busdisplay_type)) {
+        mp_raise_TypeError(MP_ERROR_TEXT("argument num/types mismatch"));
+    }
+    busdisplay_busdisplay_obj_t *display = MP_OBJ_TO_PTR(native_display);
+    uint8_t scale = mp_obj_get_int(args[7]);
+    int16_t vx = mp_obj_get_int(args[8]);
+    int16_t vy = mp_obj_get_int(args[9]);
+    uint16_t background = 0;
+
+    size_t count = render_stage_dirty(x0, y0, x1, y1, vx, vy, layers, layers_size,
+        buffer, buffer_size, display, scale, background);
+
+    return MP_OBJ_NEW_SMALL_INT(count);
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(stage_render_dirty_obj, 10, 10, stage_render_dirty);
+
 
 STATIC const mp_rom_map_elem_t stage_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR__stage) },
     { MP_ROM_QSTR(MP_QSTR_Layer), MP_ROM_PTR(&mp_type_layer) },
     { MP_ROM_QSTR(MP_QSTR_Text), MP_ROM_PTR(&mp_type_text) },
     { MP_ROM_QSTR(MP_QSTR_render), MP_ROM_PTR(&stage_render_obj) },
+    { MP_ROM_QSTR(MP_QSTR_render_dirty), MP_ROM_PTR(&stage_render_dirty_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(stage_module_globals, stage_module_globals_table);
@@ -284,7 +284,12 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_2(pixelbuf_pixelbuf_fill_obj, pixelbuf_pixelbuf_f
 //|         The individual (Red, Green, Blue[, White]) values between 0 and 255.  If given an integer, the
 //|         red, green and blue values are packed into the lower three bytes (0xRRGGBB).
 //|         For RGBW byteorders, if given only RGB values either as an int or as a tuple, the white value
-//|         is used instead when the red, green, and blue values are the same."""
+//|         is used instead when the red, green, and blue values are the same.
+//|
+//|         A slice can also be set from a flat sequence of (Red, Green, Blue[, White]) values, one for
+//|         each of the `bpp` bytes of every pixel. A buffer of bytes (such as a `bytearray`, a byte
+//|         `array.array` or a ``uint8`` ``ulab`` ndarray) in this layout is converted without handling
+//|         each value as a Python object, which is much faster for long strips."""
 //|         ...
 //|
 STATIC mp_obj_t pixelbuf_pixelbuf_subscr(mp_obj_t self_in, mp_obj_t index_in, mp_obj_t value) {
@@ -332,9 +337,18 @@ STATIC mp_obj_t pixelbuf_pixelbuf_subscr(mp_obj_t self_in, mp_obj_t index_in, mp
         } else { // Set
             #if MICROPY_PY_ARRAY_SLICE_ASSIGN
 
+            size_t bpp = common_hal_adafruit_pixelbuf_pixelbuf_get_bpp(self_in);
+            mp_buffer_info_t bufinfo;
+            if (!mp_obj_is_str(value) && mp_get_buffer(value, &bufinfo, MP_BUFFER_READ) &&
+                mp_binary_get_size('@', bufinfo.typecode, NULL) == 1 &&
+                bufinfo.len == slice_len * bpp) {
+                common_hal_adafruit_pixelbuf_pixelbuf_set_pixels_from_buffer(self_in, slice.start, slice.step, slice_len, bufinfo.buf);
+                return mp_const_none;
+            }
+
             size_t num_items = mp_obj_get_int(mp_obj_len(value));
 
-            if (num_items != slice_len && num_items != (slice_len * common_hal_adafruit_pixelbuf_pixelbuf_get_bpp(self_in))) {
+            if (num_items != slice_len && num_items != (slice_len * bpp)) {
                 mp_raise_ValueError_varg(MP_ERROR_TEXT("Unmatched number of items on RHS (expected %d, got %d)."), slice_len, num_items);
             }
             common_hal_adafruit_pixelbuf_pixelbuf_set_pixels(self_in, slice.start, slice.step, slice_len, value,
@@ -31,6 +31,7 @@
 #include "py/binary.h"
 #include "py/mphal.h"
 #include "py/nlr.h"
+#include "py/objproperty.h"
 #include "py/runtime.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/analogbufio/BufferedIn.h"
@@ -118,6 +119,22 @@ STATIC mp_obj_t analogbufio_bufferedin___exit__(size_t n_args, const mp_obj_t *a
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(analogbufio_bufferedin___exit___obj, 4, 4, analogbufio_bufferedin___exit__);
 
+STATIC uint8_t get_bytes_per_sample(mp_buffer_info_t *bufinfo) {
+    // Bytes Per Sample
+    if (bufinfo->typecode == 'H') {
+        return 2;
+    } else if (bufinfo->typecode != 'B' && bufinfo->typecode != BYTEARRAY_TYPECODE) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be a bytearray or array of type 'H' or 'B'"), MP_QSTR_buffer);
+    }
+    return 1;
+}
+
+STATIC void check_for_running(analogbufio_bufferedin_obj_t *self) {
+    if (!common_hal_analogbufio_bufferedin_get_running(self)) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Not running"));
+    }
+}
+
 //|     def readinto(self, buffer: WriteableBuffer) -> int:
 //|         """Fills the provided buffer with ADC voltage values.
 //|
@@ -138,13 +155,10 @@ STATIC mp_obj_t analogbufio_bufferedin_obj_readinto(mp_obj_t self_in, mp_obj_t b
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(buffer_obj, &bufinfo, MP_BUFFER_READ);
 
-    uint8_t bytes_per_sample = 1;
+    uint8_t bytes_per_sample = get_bytes_per_sample(&bufinfo);
 
-    // Bytes Per Sample
-    if (bufinfo.typecode == 'H') {
-        bytes_per_sample = 2;
-    } else if (bufinfo.typecode != 'B' && bufinfo.typecode != BYTEARRAY_TYPECODE) {
-        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be a bytearray or array of type 'H' or 'B'"), MP_QSTR_buffer);
+    if (common_hal_analogbufio_bufferedin_get_running(self)) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Already running"));
     }
 
     mp_uint_t captured = common_hal_analogbufio_bufferedin_readinto(self, bufinfo.buf, bufinfo.len, bytes_per_sample);
@@ -152,12 +166,128 @@ STATIC mp_obj_t analogbufio_bufferedin_obj_readinto(mp_obj_t self_in, mp_obj_t b
 }
 MP_DEFINE_CONST_FUN_OBJ_2(analogbufio_bufferedin_readinto_obj, analogbufio_bufferedin_obj_readinto);
 
+//|     def start(self, buffer: WriteableBuffer) -> None:
+//|         """Start capturing into ``buffer`` continuously, in the background.
+//|
+//|         The buffer is used as a ring: when it is full, capture carries on at its
+//|         start without stopping, so no samples are lost. Use `wait` to process it
+//|         in halves, or `readinto_latest` to copy out the newest samples.
+//|
+//|         Unlike `readinto`, 16-bit samples are stored in the buffer as the raw 12-bit
+//|         ADC values. `readinto_latest` scales them to the standard 16 bit range.
+//|
+//|         :param ~circuitpython_typing.WriteableBuffer buffer: ring buffer for samples, of the same types as `readinto`"""
+//|         ...
+//|
+STATIC mp_obj_t analogbufio_bufferedin_obj_start(mp_obj_t self_in, mp_obj_t buffer_obj) {
+    analogbufio_bufferedin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_obj, &bufinfo, MP_BUFFER_WRITE);
+    uint8_t bytes_per_sample = get_bytes_per_sample(&bufinfo);
+    mp_arg_validate_length_min(bufinfo.len / bytes_per_sample, 2, MP_QSTR_buffer);
+
+    if (common_hal_analogbufio_bufferedin_get_running(self)) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Already running"));
+    }
+
+    common_hal_analogbufio_bufferedin_start(self, buffer_obj, bufinfo.buf, bufinfo.len, bytes_per_sample);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(analogbufio_bufferedin_start_obj, analogbufio_bufferedin_obj_start);
+
+//|     def stop(self) -> None:
+//|         """Stop a continuous capture started by `start`. Does nothing if none is running."""
+//|         ...
+//|
+STATIC mp_obj_t analogbufio_bufferedin_obj_stop(mp_obj_t self_in) {
+    analogbufio_bufferedin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_analogbufio_bufferedin_stop(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(analogbufio_bufferedin_stop_obj, analogbufio_bufferedin_obj_stop);
+
+//|     running: bool
+//|     """True while a continuous capture started by `start` is running."""
+STATIC mp_obj_t analogbufio_bufferedin_obj_get_running(mp_obj_t self_in) {
+    analogbufio_bufferedin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_bool(common_hal_analogbufio_bufferedin_get_running(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(analogbufio_bufferedin_get_running_obj, analogbufio_bufferedin_obj_get_running);
+
+MP_PROPERTY_GETTER(analogbufio_bufferedin_running_obj,
+    (mp_obj_t)&analogbufio_bufferedin_get_running_obj);
+
+//|     def wait(self, *, half: bool = False) -> Optional[int]:
+//|         """Wait until the continuous capture fills the ring buffer, or half of it
+//|         if ``half`` is True, and return the index of the first sample of the part
+//|         just completed: 0 or ``len(buffer) // 2``. That part can be processed
+//|         while the capture fills the rest of the buffer.
+//|
+//|         Returns None if interrupted by Ctrl-C.
+//|
+//|         The buffer is checked between background tasks, so it must hold enough
+//|         samples that each half takes longer to fill than other work keeps the
+//|         caller from checking."""
+//|         ...
+//|
+STATIC mp_obj_t analogbufio_bufferedin_obj_wait(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_half };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_half, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+    analogbufio_bufferedin_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    check_for_running(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    uint32_t completed_start;
+    if (!common_hal_analogbufio_bufferedin_wait(self, args[ARG_half].u_bool, &completed_start)) {
+        return mp_const_none;
+    }
+    return MP_OBJ_NEW_SMALL_INT(completed_start);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(analogbufio_bufferedin_wait_obj, 1, analogbufio_bufferedin_obj_wait);
+
+//|     def readinto_latest(self, buffer: WriteableBuffer) -> int:
+//|         """Copy the newest samples of the continuous capture into ``buffer``, oldest first,
+//|         without stopping the capture. Returns the number of samples copied, which is
+//|         less than ``len(buffer)`` only when the ring buffer is smaller.
+//|
+//|         ``buffer`` must have the same element size as the buffer passed to `start`.
+//|
+//|         :param ~circuitpython_typing.WriteableBuffer buffer: buffer: A buffer for samples"""
+//|         ...
+//|
+STATIC mp_obj_t analogbufio_bufferedin_obj_readinto_latest(mp_obj_t self_in, mp_obj_t buffer_obj) {
+    analogbufio_bufferedin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    check_for_running(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_obj, &bufinfo, MP_BUFFER_WRITE);
+    uint8_t bytes_per_sample = get_bytes_per_sample(&bufinfo);
+
+    mp_uint_t copied = common_hal_analogbufio_bufferedin_readinto_latest(self, bufinfo.buf, bufinfo.len, bytes_per_sample);
+    return MP_OBJ_NEW_SMALL_INT(copied);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(analogbufio_bufferedin_readinto_latest_obj, analogbufio_bufferedin_obj_readinto_latest);
+
 STATIC const mp_rom_map_elem_t analogbufio_bufferedin_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR___del__),    MP_ROM_PTR(&analogbufio_bufferedin_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR_deinit),     MP_ROM_PTR(&analogbufio_bufferedin_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__),  MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__),   MP_ROM_PTR(&analogbufio_bufferedin___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_readinto),       MP_ROM_PTR(&analogbufio_bufferedin_readinto_obj)},
+    { MP_ROM_QSTR(MP_QSTR_start),          MP_ROM_PTR(&analogbufio_bufferedin_start_obj)},
+    { MP_ROM_QSTR(MP_QSTR_stop),           MP_ROM_PTR(&analogbufio_bufferedin_stop_obj)},
+    { MP_ROM_QSTR(MP_QSTR_running),        MP_ROM_PTR(&analogbufio_bufferedin_running_obj)},
+    { MP_ROM_QSTR(MP_QSTR_wait),           MP_ROM_PTR(&analogbufio_bufferedin_wait_obj)},
+    { MP_ROM_QSTR(MP_QSTR_readinto_latest), MP_ROM_PTR(&analogbufio_bufferedin_readinto_latest_obj)},
 
 };
 
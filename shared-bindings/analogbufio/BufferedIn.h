@@ -37,4 +37,11 @@ void common_hal_analogbufio_bufferedin_deinit(analogbufio_bufferedin_obj_t *self
 bool common_hal_analogbufio_bufferedin_deinited(analogbufio_bufferedin_obj_t *self);
 uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t *self, uint8_t *buffer, uint32_t len, uint8_t bytes_per_sample);
 
+// Continuous capture into a ring buffer.
+void common_hal_analogbufio_bufferedin_start(analogbufio_bufferedin_obj_t *self, mp_obj_t buffer_obj, uint8_t *buffer, uint32_t len, uint8_t bytes_per_sample);
+void common_hal_analogbufio_bufferedin_stop(analogbufio_bufferedin_obj_t *self);
+bool common_hal_analogbufio_bufferedin_get_running(analogbufio_bufferedin_obj_t *self);
+bool common_hal_analogbufio_bufferedin_wait(analogbufio_bufferedin_obj_t *self, bool half, uint32_t *completed_start);
+uint32_t common_hal_analogbufio_bufferedin_readinto_latest(analogbufio_bufferedin_obj_t *self, uint8_t *buffer, uint32_t len, uint8_t bytes_per_sample);
+
 #endif  // __MICROPY_INCLUDED_SHARED_BINDINGS_ANALOGBUFIO_BUFFEREDIN_H__
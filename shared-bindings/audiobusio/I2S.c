@@ -0,0 +1,220 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/binary.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/microcontroller/Pin.h"
+#include "shared-bindings/audiobusio/I2S.h"
+#include "shared-bindings/util.h"
+
+//| class I2S:
+//|     """Stream raw I2S audio in and out at the same time"""
+//|
+//|     def __init__(
+//|         self,
+//|         bit_clock: microcontroller.Pin,
+//|         word_select: microcontroller.Pin,
+//|         data_out: Optional[microcontroller.Pin],
+//|         data_in: Optional[microcontroller.Pin],
+//|         *,
+//|         main_clock: Optional[microcontroller.Pin] = None,
+//|         sample_rate: int = 48000,
+//|         buffer_size: int = 128,
+//|         left_justified: bool = False
+//|     ) -> None:
+//|         """Create an I2S object associated with the given pins. Both directions share the
+//|         clocks, so input and output stay in step.
+//|
+//|         Samples are signed 16-bit stereo, interleaved left then right, moved with `write`
+//|         and `readinto` straight between Python buffers and the DMA buffers. There are two
+//|         DMA buffers each way, so the latency through the board is about four buffers.
+//|
+//|         :param ~microcontroller.Pin bit_clock: The bit clock (or serial clock) pin
+//|         :param ~microcontroller.Pin word_select: The word select (or left/right clock) pin
+//|         :param ~microcontroller.Pin data_out: The data pin to the codec or amplifier, or None
+//|         :param ~microcontroller.Pin data_in: The data pin from the codec or microphone, or None
+//|         :param ~microcontroller.Pin main_clock: The main clock pin
+//|         :param int sample_rate: The sample rate in both directions
+//|         :param int buffer_size: The number of stereo frames in each DMA buffer
+//|         :param bool left_justified: True when data bits are aligned with the word select clock. False
+//|           when they are shifted by one to match classic I2S protocol.
+//|
+//|         Pass the microphone through to the speaker::
+//|
+//|           import array
+//|           import audiobusio
+//|           import board
+//|
+//|           buffer = array.array("h", [0] * 256)
+//|           with audiobusio.I2S(board.I2S_BCLK, board.I2S_LRCLK, board.I2S_DOUT, board.I2S_DIN) as i2s:
+//|               while True:
+//|                   count = i2s.readinto(buffer)
+//|                   i2s.write(memoryview(buffer)[:count])"""
+//|         ...
+STATIC mp_obj_t audiobusio_i2s_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_bit_clock, ARG_word_select, ARG_data_out, ARG_data_in, ARG_main_clock, ARG_sample_rate, ARG_buffer_size, ARG_left_justified };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_bit_clock, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_word_select, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_data_out, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_data_in, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_main_clock, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 48000} },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 128} },
+        { MP_QSTR_left_justified, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    const mcu_pin_obj_t *bit_clock = validate_obj_is_free_pin(args[ARG_bit_clock].u_obj, MP_QSTR_bit_clock);
+    const mcu_pin_obj_t *word_select = validate_obj_is_free_pin(args[ARG_word_select].u_obj, MP_QSTR_word_select);
+    const mcu_pin_obj_t *data_out = validate_obj_is_free_pin_or_none(args[ARG_data_out].u_obj, MP_QSTR_data_out);
+    const mcu_pin_obj_t *data_in = validate_obj_is_free_pin_or_none(args[ARG_data_in].u_obj, MP_QSTR_data_in);
+    const mcu_pin_obj_t *main_clock = validate_obj_is_free_pin_or_none(args[ARG_main_clock].u_obj, MP_QSTR_main_clock);
+    if (data_out == NULL && data_in == NULL) {
+        mp_arg_error_invalid(MP_QSTR_data_out);
+    }
+    uint32_t sample_rate = mp_arg_validate_int_min(args[ARG_sample_rate].u_int, 1, MP_QSTR_sample_rate);
+    uint16_t buffer_size = mp_arg_validate_int_range(args[ARG_buffer_size].u_int, 8, 1023, MP_QSTR_buffer_size);
+
+    audiobusio_i2s_obj_t *self = m_new_obj_with_finaliser(audiobusio_i2s_obj_t);
+    self->base.type = &audiobusio_i2s_type;
+    common_hal_audiobusio_i2s_construct(self, bit_clock, word_select, data_out, data_in, main_clock,
+        sample_rate, buffer_size, args[ARG_left_justified].u_bool);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the I2S and releases any hardware resources for reuse."""
+//|         ...
+STATIC mp_obj_t audiobusio_i2s_deinit(mp_obj_t self_in) {
+    audiobusio_i2s_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audiobusio_i2s_deinit(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_i2s_deinit_obj, audiobusio_i2s_deinit);
+
+STATIC void check_for_deinit(audiobusio_i2s_obj_t *self) {
+    if (common_hal_audiobusio_i2s_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+//|     def __enter__(self) -> I2S:
+//|         """No-op used by Context Managers."""
+//|         ...
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes the hardware when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+STATIC mp_obj_t audiobusio_i2s_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_audiobusio_i2s_deinit(args[0]);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audiobusio_i2s___exit___obj, 4, 4, audiobusio_i2s_obj___exit__);
+
+STATIC mp_buffer_info_t *get_sample_buffer(mp_obj_t buffer, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    mp_get_buffer_raise(buffer, bufinfo, flags);
+    if (bufinfo->typecode != 'h') {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be array of type 'h'"), MP_QSTR_buffer);
+    }
+    return bufinfo;
+}
+
+//|     def write(self, buffer: ReadableBuffer) -> int:
+//|         """Queues as many whole frames from ``buffer`` as there is DMA buffer space for.
+//|         This does not wait for space. The output is silent whenever nothing is queued.
+//|
+//|         :return: The number of samples queued"""
+//|         ...
+STATIC mp_obj_t audiobusio_i2s_obj_write(mp_obj_t self_in, mp_obj_t buffer) {
+    audiobusio_i2s_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_buffer_info_t bufinfo;
+    get_sample_buffer(buffer, &bufinfo, MP_BUFFER_READ);
+    size_t count = common_hal_audiobusio_i2s_write(self, bufinfo.buf, bufinfo.len / sizeof(int16_t));
+    return MP_OBJ_NEW_SMALL_INT(count);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(audiobusio_i2s_write_obj, audiobusio_i2s_obj_write);
+
+//|     def readinto(self, buffer: WriteableBuffer) -> int:
+//|         """Moves as many whole received frames as are available and fit into ``buffer``.
+//|         This does not wait for more. When they aren't read in time, the oldest are dropped.
+//|
+//|         :return: The number of samples read"""
+//|         ...
+STATIC mp_obj_t audiobusio_i2s_obj_readinto(mp_obj_t self_in, mp_obj_t buffer) {
+    audiobusio_i2s_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_buffer_info_t bufinfo;
+    get_sample_buffer(buffer, &bufinfo, MP_BUFFER_WRITE);
+    size_t count = common_hal_audiobusio_i2s_readinto(self, bufinfo.buf, bufinfo.len / sizeof(int16_t));
+    return MP_OBJ_NEW_SMALL_INT(count);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(audiobusio_i2s_readinto_obj, audiobusio_i2s_obj_readinto);
+
+//|     sample_rate: int
+//|     """The sample rate in both directions. (read-only)"""
+//|
+STATIC mp_obj_t audiobusio_i2s_obj_get_sample_rate(mp_obj_t self_in) {
+    audiobusio_i2s_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audiobusio_i2s_get_sample_rate(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_i2s_get_sample_rate_obj, audiobusio_i2s_obj_get_sample_rate);
+
+MP_PROPERTY_GETTER(audiobusio_i2s_sample_rate_obj,
+    (mp_obj_t)&audiobusio_i2s_get_sample_rate_obj);
+
+STATIC const mp_rom_map_elem_t audiobusio_i2s_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&audiobusio_i2s_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiobusio_i2s_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audiobusio_i2s___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&audiobusio_i2s_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&audiobusio_i2s_readinto_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audiobusio_i2s_sample_rate_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(audiobusio_i2s_locals_dict, audiobusio_i2s_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    audiobusio_i2s_type,
+    MP_QSTR_I2S,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, audiobusio_i2s_make_new,
+    locals_dict, &audiobusio_i2s_locals_dict
+    );
@@ -0,0 +1,45 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "common-hal/audiobusio/I2S.h"
+#include "common-hal/microcontroller/Pin.h"
+
+extern const mp_obj_type_t audiobusio_i2s_type;
+
+// Either data pin may be NULL to only stream in one direction.
+void common_hal_audiobusio_i2s_construct(audiobusio_i2s_obj_t *self,
+    const mcu_pin_obj_t *bit_clock, const mcu_pin_obj_t *word_select,
+    const mcu_pin_obj_t *data_out, const mcu_pin_obj_t *data_in, const mcu_pin_obj_t *main_clock,
+    uint32_t sample_rate, uint16_t buffer_size, bool left_justified);
+void common_hal_audiobusio_i2s_deinit(audiobusio_i2s_obj_t *self);
+bool common_hal_audiobusio_i2s_deinited(audiobusio_i2s_obj_t *self);
+uint32_t common_hal_audiobusio_i2s_get_sample_rate(audiobusio_i2s_obj_t *self);
+// These never wait. They return how many of the interleaved stereo samples they moved, always
+// a whole number of frames.
+size_t common_hal_audiobusio_i2s_write(audiobusio_i2s_obj_t *self, const int16_t *samples, size_t count);
+size_t common_hal_audiobusio_i2s_readinto(audiobusio_i2s_obj_t *self, int16_t *samples, size_t count);
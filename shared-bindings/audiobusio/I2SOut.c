@@ -251,6 +251,24 @@ MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_i2sout_get_paused_obj, audiobusio_i2sout_ob
 
 MP_PROPERTY_GETTER(audiobusio_i2sout_paused_obj,
     (mp_obj_t)&audiobusio_i2sout_get_paused_obj);
+
+//|     stats: audiocore.OutputStats
+//|     """Underruns, rendering load and fill latency since the current sample started playing.
+//|     Raises `NotImplementedError` on ports that don't keep them. (read-only)"""
+//|
+STATIC mp_obj_t audiobusio_i2sout_obj_get_stats(mp_obj_t self_in) {
+    audiobusio_i2sout_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return common_hal_audiobusio_i2sout_get_stats(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_i2sout_get_stats_obj, audiobusio_i2sout_obj_get_stats);
+
+MP_PROPERTY_GETTER(audiobusio_i2sout_stats_obj,
+    (mp_obj_t)&audiobusio_i2sout_get_stats_obj);
+
+MP_WEAK mp_obj_t common_hal_audiobusio_i2sout_get_stats(audiobusio_i2sout_obj_t *self) {
+    mp_raise_NotImplementedError(NULL);
+}
 #endif // CIRCUITPY_AUDIOBUSIO_I2SOUT
 
 STATIC const mp_rom_map_elem_t audiobusio_i2sout_locals_dict_table[] = {
@@ -268,6 +286,7 @@ STATIC const mp_rom_map_elem_t audiobusio_i2sout_locals_dict_table[] = {
     // Properties
     { MP_ROM_QSTR(MP_QSTR_playing), MP_ROM_PTR(&audiobusio_i2sout_playing_obj) },
     { MP_ROM_QSTR(MP_QSTR_paused), MP_ROM_PTR(&audiobusio_i2sout_paused_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&audiobusio_i2sout_stats_obj) },
     #endif // CIRCUITPY_AUDIOBUSIO_I2SOUT
 };
 STATIC MP_DEFINE_CONST_DICT(audiobusio_i2sout_locals_dict, audiobusio_i2sout_locals_dict_table);
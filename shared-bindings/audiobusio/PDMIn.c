@@ -214,6 +214,87 @@ STATIC mp_obj_t audiobusio_pdmin_obj_record(mp_obj_t self_obj, mp_obj_t destinat
 }
 MP_DEFINE_CONST_FUN_OBJ_3(audiobusio_pdmin_record_obj, audiobusio_pdmin_obj_record);
 
+//|     def start_recording(self, buffer_length: int) -> None:
+//|         """Starts recording in the background. Samples are kept in an internal buffer of
+//|         ``buffer_length`` samples until `readinto` collects them. When it is full the oldest
+//|         samples are dropped, so call `readinto` often enough to keep up. Samples are also
+//|         lost if background tasks are held off for much longer than a few milliseconds.
+//|
+//|         Not every port can record in the background. Those raise `NotImplementedError`."""
+//|         ...
+STATIC mp_obj_t audiobusio_pdmin_obj_start_recording(mp_obj_t self_obj, mp_obj_t buffer_length) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_obj);
+    check_for_deinit(self);
+    common_hal_audiobusio_pdmin_start_recording(self,
+        mp_arg_validate_int_min(mp_obj_get_int(buffer_length), 1, MP_QSTR_buffer_length));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiobusio_pdmin_start_recording_obj, audiobusio_pdmin_obj_start_recording);
+
+//|     def readinto(self, buffer: WriteableBuffer) -> int:
+//|         """Moves as many of the oldest recorded samples as are available and fit into
+//|         ``buffer``. This does not wait for more samples.
+//|
+//|         ``buffer`` has the same type requirements as the destination of `record`.
+//|
+//|         :return: The number of samples read"""
+//|         ...
+STATIC mp_obj_t audiobusio_pdmin_obj_readinto(mp_obj_t self_obj, mp_obj_t buffer) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_obj);
+    check_for_deinit(self);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_WRITE);
+    uint8_t bit_depth = common_hal_audiobusio_pdmin_get_bit_depth(self);
+    if (bufinfo.typecode != 'H' && bit_depth == 16) {
+        mp_raise_ValueError(MP_ERROR_TEXT("destination buffer must be an array of type 'H' for bit_depth = 16"));
+    } else if (bufinfo.typecode != 'B' && bufinfo.typecode != BYTEARRAY_TYPECODE && bit_depth == 8) {
+        mp_raise_ValueError(MP_ERROR_TEXT("destination buffer must be a bytearray or array of type 'B' for bit_depth = 8"));
+    }
+    uint32_t length = bufinfo.len / (bit_depth / 8);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audiobusio_pdmin_read_recording(self, bufinfo.buf, length));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiobusio_pdmin_readinto_obj, audiobusio_pdmin_obj_readinto);
+
+//|     def stop_recording(self) -> None:
+//|         """Stops recording in the background and frees its buffer. Samples that have not
+//|         been read are lost."""
+//|         ...
+STATIC mp_obj_t audiobusio_pdmin_obj_stop_recording(mp_obj_t self_obj) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_obj);
+    check_for_deinit(self);
+    common_hal_audiobusio_pdmin_stop_recording(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_pdmin_stop_recording_obj, audiobusio_pdmin_obj_stop_recording);
+
+//|     recording: bool
+//|     """True while recording in the background. (read-only)"""
+//|
+STATIC mp_obj_t audiobusio_pdmin_obj_get_recording(mp_obj_t self_in) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_bool(common_hal_audiobusio_pdmin_get_recording(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_pdmin_get_recording_obj, audiobusio_pdmin_obj_get_recording);
+
+MP_PROPERTY_GETTER(audiobusio_pdmin_recording_obj,
+    (mp_obj_t)&audiobusio_pdmin_get_recording_obj);
+
+MP_WEAK void common_hal_audiobusio_pdmin_start_recording(audiobusio_pdmin_obj_t *self, uint32_t buffer_length) {
+    mp_raise_NotImplementedError(NULL);
+}
+
+MP_WEAK void common_hal_audiobusio_pdmin_stop_recording(audiobusio_pdmin_obj_t *self) {
+}
+
+MP_WEAK bool common_hal_audiobusio_pdmin_get_recording(audiobusio_pdmin_obj_t *self) {
+    return false;
+}
+
+MP_WEAK uint32_t common_hal_audiobusio_pdmin_read_recording(audiobusio_pdmin_obj_t *self, void *buffer, uint32_t length) {
+    mp_raise_RuntimeError(MP_ERROR_TEXT("Not running"));
+}
+
 //|     sample_rate: int
 //|     """The actual sample_rate of the recording. This may not match the constructed
 //|     sample rate due to internal clock limitations."""
@@ -234,6 +315,10 @@ STATIC const mp_rom_map_elem_t audiobusio_pdmin_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audiobusio_pdmin___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_record), MP_ROM_PTR(&audiobusio_pdmin_record_obj) },
+    { MP_ROM_QSTR(MP_QSTR_start_recording), MP_ROM_PTR(&audiobusio_pdmin_start_recording_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&audiobusio_pdmin_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop_recording), MP_ROM_PTR(&audiobusio_pdmin_stop_recording_obj) },
+    { MP_ROM_QSTR(MP_QSTR_recording), MP_ROM_PTR(&audiobusio_pdmin_recording_obj) },
     { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audiobusio_pdmin_sample_rate_obj) }
 };
 STATIC MP_DEFINE_CONST_DICT(audiobusio_pdmin_locals_dict, audiobusio_pdmin_locals_dict_table);
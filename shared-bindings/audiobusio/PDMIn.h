@@ -43,6 +43,12 @@ uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t *se
     uint16_t *buffer, uint32_t length);
 uint8_t common_hal_audiobusio_pdmin_get_bit_depth(audiobusio_pdmin_obj_t *self);
 uint32_t common_hal_audiobusio_pdmin_get_sample_rate(audiobusio_pdmin_obj_t *self);
+// Continuous recording. Ports without it raise NotImplementedError from start_recording.
+void common_hal_audiobusio_pdmin_start_recording(audiobusio_pdmin_obj_t *self, uint32_t buffer_length);
+void common_hal_audiobusio_pdmin_stop_recording(audiobusio_pdmin_obj_t *self);
+bool common_hal_audiobusio_pdmin_get_recording(audiobusio_pdmin_obj_t *self);
+// Copies up to length of the oldest recorded samples to buffer and returns how many it copied.
+uint32_t common_hal_audiobusio_pdmin_read_recording(audiobusio_pdmin_obj_t *self, void *buffer, uint32_t length);
 // TODO(tannewt): Add record to file
 #endif
 
@@ -32,6 +32,9 @@
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/audiobusio/__init__.h"
 #include "shared-bindings/audiobusio/I2SOut.h"
+#if CIRCUITPY_AUDIOBUSIO_I2S
+#include "shared-bindings/audiobusio/I2S.h"
+#endif
 #include "shared-bindings/audiobusio/PDMIn.h"
 
 //| """Support for audio input and output over digital buses
@@ -48,6 +51,9 @@
 STATIC const mp_rom_map_elem_t audiobusio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_audiobusio) },
     { MP_ROM_QSTR(MP_QSTR_I2SOut), MP_ROM_PTR(&audiobusio_i2sout_type) },
+    #if CIRCUITPY_AUDIOBUSIO_I2S
+    { MP_ROM_QSTR(MP_QSTR_I2S), MP_ROM_PTR(&audiobusio_i2s_type) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_PDMIn), MP_ROM_PTR(&audiobusio_pdmin_type) },
 };
 
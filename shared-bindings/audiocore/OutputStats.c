@@ -0,0 +1,66 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/audiocore/OutputStats.h"
+
+#include "py/obj.h"
+
+//| class OutputStats:
+//|     """Playback statistics of an audio output since it started playing its current sample.
+//|     Loads are the time spent rendering a buffer divided by the time the buffer takes to play,
+//|     so values approaching 1.0 mean the output is about to underrun."""
+//|
+//|     underruns: int
+//|     """Number of times the output needed a buffer before one was ready"""
+//|
+//|     buffers: int
+//|     """Number of buffers rendered"""
+//|
+//|     max_load: float
+//|     """The highest load of a single buffer"""
+//|
+//|     average_load: float
+//|     """Moving average of the load over roughly the last sixteen buffers"""
+//|
+//|     max_fill_latency_us: int
+//|     """The longest time in microseconds from the output asking for a buffer to rendering starting"""
+//|
+//|     average_fill_latency_us: int
+//|     """Moving average of the fill latency in microseconds"""
+//|
+
+const mp_obj_namedtuple_type_t audiocore_outputstats_type_obj = {
+    NAMEDTUPLE_TYPE_BASE_AND_SLOTS(MP_QSTR_OutputStats),
+    .n_fields = 6,
+    .fields = {
+        MP_QSTR_underruns,
+        MP_QSTR_buffers,
+        MP_QSTR_max_load,
+        MP_QSTR_average_load,
+        MP_QSTR_max_fill_latency_us,
+        MP_QSTR_average_fill_latency_us,
+    },
+};
@@ -37,7 +37,12 @@
 //|     """A raw audio sample buffer in memory"""
 //|
 //|     def __init__(
-//|         self, buffer: ReadableBuffer, *, channel_count: int = 1, sample_rate: int = 8000
+//|         self,
+//|         buffer: ReadableBuffer,
+//|         *,
+//|         channel_count: int = 1,
+//|         sample_rate: int = 8000,
+//|         single_buffer: bool = True
 //|     ) -> None:
 //|         """Create a RawSample based on the given buffer of values. If channel_count is more than
 //|         1 then each channel's samples should alternate. In other words, for a two channel buffer, the
@@ -47,6 +52,10 @@
 //|         :param ~circuitpython_typing.ReadableBuffer buffer: A buffer with samples
 //|         :param int channel_count: The number of channels in the buffer
 //|         :param int sample_rate: The desired playback sample rate
+//|         :param bool single_buffer: When False, the two halves of ``buffer`` play one after
+//|           the other without stopping, until playback is stopped. Samples are read in place,
+//|           so a half can be refilled, for instance from a capture ring buffer, while the
+//|           other half plays. ``loop`` has no effect on such a sample.
 //|
 //|         Simple 8ksps 440 Hz sin wave::
 //|
@@ -70,11 +79,12 @@
 //|           dac.stop()"""
 //|         ...
 STATIC mp_obj_t audioio_rawsample_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    enum { ARG_buffer, ARG_channel_count, ARG_sample_rate };
+    enum { ARG_buffer, ARG_channel_count, ARG_sample_rate, ARG_single_buffer };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_buffer, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL } },
         { MP_QSTR_channel_count, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1 } },
         { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 8000} },
+        { MP_QSTR_single_buffer, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = true} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -89,9 +99,14 @@ STATIC mp_obj_t audioio_rawsample_make_new(const mp_obj_type_t *type, size_t n_a
     } else if (bufinfo.typecode != 'b' && bufinfo.typecode != 'B' && bufinfo.typecode != BYTEARRAY_TYPECODE) {
         mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be a bytearray or array of type 'h', 'H', 'b', or 'B'"), MP_QSTR_buffer);
     }
+    mp_int_t channel_count = mp_arg_validate_int_min(args[ARG_channel_count].u_int, 1, MP_QSTR_channel_count);
+    bool single_buffer = args[ARG_single_buffer].u_bool;
+    if (!single_buffer) {
+        mp_arg_validate_length_min(bufinfo.len, 2 * bytes_per_sample * channel_count, MP_QSTR_buffer);
+    }
     common_hal_audioio_rawsample_construct(self, ((uint8_t *)bufinfo.buf), bufinfo.len,
-        bytes_per_sample, signed_samples, args[ARG_channel_count].u_int,
-        args[ARG_sample_rate].u_int);
+        bytes_per_sample, signed_samples, channel_count,
+        args[ARG_sample_rate].u_int, single_buffer);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -40,14 +40,27 @@
 //|     be 8 bit unsigned or 16 bit signed. If a buffer is provided, it will be used instead of allocating
 //|     an internal buffer, which can prevent memory fragmentation."""
 //|
-//|     def __init__(self, file: Union[str, typing.BinaryIO], buffer: WriteableBuffer) -> None:
+//|     def __init__(
+//|         self,
+//|         file: Union[str, typing.BinaryIO],
+//|         buffer: Optional[WriteableBuffer] = None,
+//|         *,
+//|         buffer_count: int = 2,
+//|     ) -> None:
 //|         """Load a .wav file for playback with `audioio.AudioOut` or `audiobusio.I2SOut`.
 //|
+//|         Data is read from the file ahead of playback in the background, so that a slow
+//|         filesystem doesn't interrupt the audio. Looping playback continues from data that has
+//|         already been read.
+//|
 //|         :param Union[str, typing.BinaryIO] file: The name of a wave file (preferred) or an already opened wave file
 //|         :param ~circuitpython_typing.WriteableBuffer buffer: Optional pre-allocated buffer,
-//|           that will be split in half and used for double-buffering of the data.
-//|           The buffer must be 8 to 1024 bytes long.
-//|           If not provided, two 256 byte buffers are initially allocated internally.
+//|           that will be split into ``buffer_count`` pieces. One is played while the others are
+//|           filled from the file. The buffer may be allocated anywhere, such as PSRAM.
+//|           It must be 4 to 512 bytes long per piece.
+//|           If not provided, ``buffer_count`` 256 byte pieces are allocated internally.
+//|         :param int buffer_count: Number of pieces to split the buffer into, from 2 to 8.
+//|           Use more on slow filesystems such as SD cards.
 //|
 //|         Playing a wave file from flash::
 //|
@@ -70,28 +83,37 @@
 //|           print("stopped")
 //|         """
 //|         ...
-STATIC mp_obj_t audioio_wavefile_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
-    mp_arg_check_num(n_args, n_kw, 1, 2, false);
-    mp_obj_t arg = args[0];
+STATIC mp_obj_t audioio_wavefile_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_file, ARG_buffer, ARG_buffer_count };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_file, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_buffer, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_buffer_count, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 2} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t arg = args[ARG_file].u_obj;
 
     if (mp_obj_is_str(arg)) {
         arg = mp_call_function_2(MP_OBJ_FROM_PTR(&mp_builtin_open_obj), arg, MP_ROM_QSTR(MP_QSTR_rb));
     }
 
-    audioio_wavefile_obj_t *self = mp_obj_malloc(audioio_wavefile_obj_t, &audioio_wavefile_type);
     if (!mp_obj_is_type(arg, &mp_type_vfs_fat_fileio)) {
         mp_raise_TypeError(MP_ERROR_TEXT("file must be a file opened in byte mode"));
     }
+    uint8_t buffer_count = mp_arg_validate_int_range(args[ARG_buffer_count].u_int, 2, AUDIOIO_WAVEFILE_MAX_BUFFERS, MP_QSTR_buffer_count);
     uint8_t *buffer = NULL;
     size_t buffer_size = 0;
-    if (n_args >= 2) {
+    if (args[ARG_buffer].u_obj != mp_const_none) {
         mp_buffer_info_t bufinfo;
-        mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_WRITE);
+        mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_WRITE);
         buffer = bufinfo.buf;
-        buffer_size = mp_arg_validate_length_range(bufinfo.len, 8, 1024, MP_QSTR_buffer);
+        buffer_size = mp_arg_validate_length_range(bufinfo.len, 4 * buffer_count, 512 * buffer_count, MP_QSTR_buffer);
     }
+    audioio_wavefile_obj_t *self = mp_obj_malloc(audioio_wavefile_obj_t, &audioio_wavefile_type);
     common_hal_audioio_wavefile_construct(self, MP_OBJ_TO_PTR(arg),
-        buffer, buffer_size);
+        buffer, buffer_size, buffer_count);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -164,7 +186,6 @@ MP_PROPERTY_GETTER(audioio_wavefile_bits_per_sample_obj,
     (mp_obj_t)&audioio_wavefile_get_bits_per_sample_obj);
 //|     channel_count: int
 //|     """Number of audio channels. (read only)"""
-//|
 STATIC mp_obj_t audioio_wavefile_obj_get_channel_count(mp_obj_t self_in) {
     audioio_wavefile_obj_t *self = MP_OBJ_TO_PTR(self_in);
     check_for_deinit(self);
@@ -175,6 +196,20 @@ MP_DEFINE_CONST_FUN_OBJ_1(audioio_wavefile_get_channel_count_obj, audioio_wavefi
 MP_PROPERTY_GETTER(audioio_wavefile_channel_count_obj,
     (mp_obj_t)&audioio_wavefile_get_channel_count_obj);
 
+//|     underruns: int
+//|     """Number of times playback needed data before it was read ahead from the file. Each one
+//|     may be heard as a glitch. Try a larger ``buffer_count`` if this keeps increasing. (read only)"""
+//|
+STATIC mp_obj_t audioio_wavefile_obj_get_underruns(mp_obj_t self_in) {
+    audioio_wavefile_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_audioio_wavefile_get_underruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_wavefile_get_underruns_obj, audioio_wavefile_obj_get_underruns);
+
+MP_PROPERTY_GETTER(audioio_wavefile_underruns_obj,
+    (mp_obj_t)&audioio_wavefile_get_underruns_obj);
+
 
 STATIC const mp_rom_map_elem_t audioio_wavefile_locals_dict_table[] = {
     // Methods
@@ -186,6 +221,7 @@ STATIC const mp_rom_map_elem_t audioio_wavefile_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audioio_wavefile_sample_rate_obj) },
     { MP_ROM_QSTR(MP_QSTR_bits_per_sample), MP_ROM_PTR(&audioio_wavefile_bits_per_sample_obj) },
     { MP_ROM_QSTR(MP_QSTR_channel_count), MP_ROM_PTR(&audioio_wavefile_channel_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_underruns), MP_ROM_PTR(&audioio_wavefile_underruns_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(audioio_wavefile_locals_dict, audioio_wavefile_locals_dict_table);
 
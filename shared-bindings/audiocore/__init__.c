@@ -31,6 +31,7 @@
 #include "py/runtime.h"
 
 #include "shared-bindings/audiocore/__init__.h"
+#include "shared-bindings/audiocore/OutputStats.h"
 #include "shared-bindings/audiocore/RawSample.h"
 #include "shared-bindings/audiocore/WaveFile.h"
 // #include "shared-bindings/audiomixer/Mixer.h"
@@ -96,6 +97,7 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_1(audiocore_reset_buffer_obj, audiocore_reset_buf
 
 STATIC const mp_rom_map_elem_t audiocore_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_audiocore) },
+    { MP_ROM_QSTR(MP_QSTR_OutputStats), MP_ROM_PTR(&audiocore_outputstats_type_obj) },
     { MP_ROM_QSTR(MP_QSTR_RawSample), MP_ROM_PTR(&audioio_rawsample_type) },
     { MP_ROM_QSTR(MP_QSTR_WaveFile), MP_ROM_PTR(&audioio_wavefile_type) },
     #if CIRCUITPY_AUDIOCORE_DEBUG
@@ -0,0 +1,242 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/audiofx/Delay.h"
+#include "shared-bindings/util.h"
+
+//| class Delay:
+//|     """An echo effect that repeats its input after a delay"""
+//|
+//|     def __init__(
+//|         self,
+//|         max_delay_ms: int = 500,
+//|         delay_ms: int = 250,
+//|         feedback: float = 0.5,
+//|         mix: float = 0.5,
+//|         buffer_size: int = 512,
+//|         channel_count: int = 1,
+//|         sample_rate: int = 8000,
+//|     ) -> None:
+//|         """Create a Delay effect. The input is stored in a ring buffer and played back
+//|         ``delay_ms`` later. Part of each echo is fed back into the buffer so that it
+//|         repeats and fades out.
+//|
+//|         :param int max_delay_ms: The longest delay that ``delay_ms`` may be set to. This sets the
+//|           size of the delay buffer: 2 bytes per sample per channel.
+//|         :param int delay_ms: The time between echoes in milliseconds
+//|         :param float feedback: How much of each echo is repeated, from 0.0 to 1.0
+//|         :param float mix: How much of the output is echo instead of input, from 0.0 to 1.0
+//|         :param int buffer_size: The total size in bytes of each of the two output buffers
+//|         :param int channel_count: The number of channels the source samples contain. 1 = mono; 2 = stereo.
+//|         :param int sample_rate: The sample rate to be used for all samples
+//|
+//|         Adding an echo to a synthesizer::
+//|
+//|           import audiofx
+//|           import audiopwmio
+//|           import board
+//|           import synthio
+//|
+//|           audio = audiopwmio.PWMAudioOut(board.GP10)
+//|           synth = synthio.Synthesizer(sample_rate=22050)
+//|           echo = audiofx.Delay(delay_ms=300, feedback=0.6, sample_rate=22050)
+//|           echo.play(synth)
+//|           audio.play(echo)
+//|           synth.press(60)"""
+//|         ...
+STATIC mp_obj_t audiofx_delay_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_max_delay_ms, ARG_delay_ms, ARG_feedback, ARG_mix, ARG_buffer_size, ARG_channel_count, ARG_sample_rate };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_max_delay_ms, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 500} },
+        { MP_QSTR_delay_ms, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 250} },
+        { MP_QSTR_feedback, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_NONE} },
+        { MP_QSTR_mix, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_NONE} },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 512} },
+        { MP_QSTR_channel_count, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
+        { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 8000} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t max_delay_ms = mp_arg_validate_int_range(args[ARG_max_delay_ms].u_int, 1, 10000, MP_QSTR_max_delay_ms);
+    mp_int_t channel_count = mp_arg_validate_int_range(args[ARG_channel_count].u_int, 1, 2, MP_QSTR_channel_count);
+    mp_int_t sample_rate = mp_arg_validate_int_range(args[ARG_sample_rate].u_int, 1, 192000, MP_QSTR_sample_rate);
+    mp_int_t buffer_size = mp_arg_validate_int_min(args[ARG_buffer_size].u_int, 4, MP_QSTR_buffer_size);
+    mp_float_t feedback = args[ARG_feedback].u_obj == MP_ROM_NONE ? MICROPY_FLOAT_CONST(0.5) : mp_obj_get_float(args[ARG_feedback].u_obj);
+    mp_float_t mix = args[ARG_mix].u_obj == MP_ROM_NONE ? MICROPY_FLOAT_CONST(0.5) : mp_obj_get_float(args[ARG_mix].u_obj);
+
+    audiofx_delay_obj_t *self = mp_obj_malloc(audiofx_delay_obj_t, &audiofx_delay_type);
+    common_hal_audiofx_delay_construct(self, max_delay_ms, args[ARG_delay_ms].u_int, feedback, mix,
+        buffer_size, channel_count, sample_rate);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the Delay and releases its buffers for reuse."""
+//|         ...
+STATIC mp_obj_t audiofx_delay_deinit(mp_obj_t self_in) {
+    audiofx_delay_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audiofx_delay_deinit(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(audiofx_delay_deinit_obj, audiofx_delay_deinit);
+
+//|     def __enter__(self) -> Delay:
+//|         """No-op used by Context Managers."""
+//|         ...
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes the effect when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+STATIC mp_obj_t audiofx_delay_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_audiofx_delay_deinit(args[0]);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audiofx_delay___exit___obj, 4, 4, audiofx_delay_obj___exit__);
+
+//|     delay_ms: int
+//|     """The time between echoes in milliseconds, up to ``max_delay_ms``."""
+STATIC mp_obj_t audiofx_delay_obj_get_delay_ms(mp_obj_t self_in) {
+    audiofx_effect_check_for_deinit(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audiofx_delay_get_delay_ms(MP_OBJ_TO_PTR(self_in)));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_delay_get_delay_ms_obj, audiofx_delay_obj_get_delay_ms);
+
+STATIC mp_obj_t audiofx_delay_obj_set_delay_ms(mp_obj_t self_in, mp_obj_t delay_ms) {
+    audiofx_effect_check_for_deinit(self_in);
+    common_hal_audiofx_delay_set_delay_ms(MP_OBJ_TO_PTR(self_in), mp_obj_get_int(delay_ms));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofx_delay_set_delay_ms_obj, audiofx_delay_obj_set_delay_ms);
+
+MP_PROPERTY_GETSET(audiofx_delay_delay_ms_obj,
+    (mp_obj_t)&audiofx_delay_get_delay_ms_obj,
+    (mp_obj_t)&audiofx_delay_set_delay_ms_obj);
+
+//|     feedback: float
+//|     """How much of each echo is repeated, from 0.0 to 1.0."""
+STATIC mp_obj_t audiofx_delay_obj_get_feedback(mp_obj_t self_in) {
+    audiofx_effect_check_for_deinit(self_in);
+    return mp_obj_new_float(common_hal_audiofx_delay_get_feedback(MP_OBJ_TO_PTR(self_in)));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_delay_get_feedback_obj, audiofx_delay_obj_get_feedback);
+
+STATIC mp_obj_t audiofx_delay_obj_set_feedback(mp_obj_t self_in, mp_obj_t feedback) {
+    audiofx_effect_check_for_deinit(self_in);
+    common_hal_audiofx_delay_set_feedback(MP_OBJ_TO_PTR(self_in), mp_obj_get_float(feedback));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofx_delay_set_feedback_obj, audiofx_delay_obj_set_feedback);
+
+MP_PROPERTY_GETSET(audiofx_delay_feedback_obj,
+    (mp_obj_t)&audiofx_delay_get_feedback_obj,
+    (mp_obj_t)&audiofx_delay_set_feedback_obj);
+
+//|     mix: float
+//|     """How much of the output is echo instead of input, from 0.0 to 1.0."""
+STATIC mp_obj_t audiofx_delay_obj_get_mix(mp_obj_t self_in) {
+    audiofx_effect_check_for_deinit(self_in);
+    return mp_obj_new_float(common_hal_audiofx_delay_get_mix(MP_OBJ_TO_PTR(self_in)));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_delay_get_mix_obj, audiofx_delay_obj_get_mix);
+
+STATIC mp_obj_t audiofx_delay_obj_set_mix(mp_obj_t self_in, mp_obj_t mix) {
+    audiofx_effect_check_for_deinit(self_in);
+    common_hal_audiofx_delay_set_mix(MP_OBJ_TO_PTR(self_in), mp_obj_get_float(mix));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofx_delay_set_mix_obj, audiofx_delay_obj_set_mix);
+
+MP_PROPERTY_GETSET(audiofx_delay_mix_obj,
+    (mp_obj_t)&audiofx_delay_get_mix_obj,
+    (mp_obj_t)&audiofx_delay_set_mix_obj);
+
+//|     playing: bool
+//|     """True when a sample is being fed into the effect. (read-only)"""
+//|
+//|     sample_rate: int
+//|     """The sample rate of the input and output in Hertz. (read-only)"""
+//|
+//|     channel_count: int
+//|     """The number of channels of the input and output. (read-only)"""
+//|
+//|     def play(self, sample: circuitpython_typing.AudioSample, *, loop: bool = False) -> None:
+//|         """Feeds the sample through the effect, once when loop=False and continuously when
+//|         loop=True. Does not block. Use `playing` to block.
+//|
+//|         The sample must be 16 bit signed and match the effect's ``sample_rate`` and
+//|         ``channel_count``."""
+//|         ...
+//|
+//|     def stop(self) -> None:
+//|         """Stops feeding the sample into the effect. Echoes of it still play out."""
+//|         ...
+//|
+STATIC const mp_rom_map_elem_t audiofx_delay_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiofx_delay_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audiofx_delay___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_play), MP_ROM_PTR(&audiofx_effect_play_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop), MP_ROM_PTR(&audiofx_effect_stop_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_playing), MP_ROM_PTR(&audiofx_effect_playing_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audiofx_effect_sample_rate_obj) },
+    { MP_ROM_QSTR(MP_QSTR_channel_count), MP_ROM_PTR(&audiofx_effect_channel_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_delay_ms), MP_ROM_PTR(&audiofx_delay_delay_ms_obj) },
+    { MP_ROM_QSTR(MP_QSTR_feedback), MP_ROM_PTR(&audiofx_delay_feedback_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mix), MP_ROM_PTR(&audiofx_delay_mix_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(audiofx_delay_locals_dict, audiofx_delay_locals_dict_table);
+
+STATIC const audiosample_p_t audiofx_delay_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .sample_rate = (audiosample_sample_rate_fun)common_hal_audiofx_effect_get_sample_rate,
+    .bits_per_sample = (audiosample_bits_per_sample_fun)common_hal_audiofx_effect_get_bits_per_sample,
+    .channel_count = (audiosample_channel_count_fun)common_hal_audiofx_effect_get_channel_count,
+    .reset_buffer = (audiosample_reset_buffer_fun)audiofx_delay_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audiofx_delay_get_buffer,
+    .get_buffer_structure = (audiosample_get_buffer_structure_fun)audiofx_effect_get_buffer_structure,
+};
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    audiofx_delay_type,
+    MP_QSTR_Delay,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, audiofx_delay_make_new,
+    locals_dict, &audiofx_delay_locals_dict,
+    protocol, &audiofx_delay_proto
+    );
@@ -0,0 +1,44 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "shared-bindings/audiofx/__init__.h"
+#include "shared-module/audiofx/Delay.h"
+
+extern const mp_obj_type_t audiofx_delay_type;
+
+void common_hal_audiofx_delay_construct(audiofx_delay_obj_t *self, uint32_t max_delay_ms,
+    uint32_t delay_ms, mp_float_t feedback, mp_float_t mix,
+    uint32_t buffer_size, uint8_t channel_count, uint32_t sample_rate);
+void common_hal_audiofx_delay_deinit(audiofx_delay_obj_t *self);
+
+uint32_t common_hal_audiofx_delay_get_delay_ms(audiofx_delay_obj_t *self);
+void common_hal_audiofx_delay_set_delay_ms(audiofx_delay_obj_t *self, uint32_t delay_ms);
+mp_float_t common_hal_audiofx_delay_get_feedback(audiofx_delay_obj_t *self);
+void common_hal_audiofx_delay_set_feedback(audiofx_delay_obj_t *self, mp_float_t feedback);
+mp_float_t common_hal_audiofx_delay_get_mix(audiofx_delay_obj_t *self);
+void common_hal_audiofx_delay_set_mix(audiofx_delay_obj_t *self, mp_float_t mix);
@@ -0,0 +1,223 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/audiofx/Reverb.h"
+#include "shared-bindings/util.h"
+
+//| class Reverb:
+//|     """A reverb effect that simulates the reflections of a room"""
+//|
+//|     def __init__(
+//|         self,
+//|         room_size: float = 0.5,
+//|         damping: float = 0.5,
+//|         mix: float = 0.25,
+//|         buffer_size: int = 512,
+//|         channel_count: int = 1,
+//|         sample_rate: int = 8000,
+//|     ) -> None:
+//|         """Create a Reverb effect modelled on Freeverb: damped comb filters in parallel
+//|         followed by allpass filters in series. Stereo input is reverberated as mono and the
+//|         result is added to both channels. The filters use about 11 kB at 22050 Hz.
+//|
+//|         :param float room_size: How long the reverb lasts, from 0.0 to 1.0
+//|         :param float damping: How quickly high frequencies fade, from 0.0 to 1.0
+//|         :param float mix: How much of the output is reverb instead of input, from 0.0 to 1.0
+//|         :param int buffer_size: The total size in bytes of each of the two output buffers
+//|         :param int channel_count: The number of channels the source samples contain. 1 = mono; 2 = stereo.
+//|         :param int sample_rate: The sample rate to be used for all samples"""
+//|         ...
+STATIC mp_obj_t audiofx_reverb_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_room_size, ARG_damping, ARG_mix, ARG_buffer_size, ARG_channel_count, ARG_sample_rate };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_room_size, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_NONE} },
+        { MP_QSTR_damping, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_NONE} },
+        { MP_QSTR_mix, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_NONE} },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 512} },
+        { MP_QSTR_channel_count, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
+        { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 8000} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t channel_count = mp_arg_validate_int_range(args[ARG_channel_count].u_int, 1, 2, MP_QSTR_channel_count);
+    mp_int_t sample_rate = mp_arg_validate_int_range(args[ARG_sample_rate].u_int, 1, 192000, MP_QSTR_sample_rate);
+    mp_int_t buffer_size = mp_arg_validate_int_min(args[ARG_buffer_size].u_int, 4, MP_QSTR_buffer_size);
+    mp_float_t room_size = args[ARG_room_size].u_obj == MP_ROM_NONE ? MICROPY_FLOAT_CONST(0.5) : mp_obj_get_float(args[ARG_room_size].u_obj);
+    mp_float_t damping = args[ARG_damping].u_obj == MP_ROM_NONE ? MICROPY_FLOAT_CONST(0.5) : mp_obj_get_float(args[ARG_damping].u_obj);
+    mp_float_t mix = args[ARG_mix].u_obj == MP_ROM_NONE ? MICROPY_FLOAT_CONST(0.25) : mp_obj_get_float(args[ARG_mix].u_obj);
+
+    audiofx_reverb_obj_t *self = mp_obj_malloc(audiofx_reverb_obj_t, &audiofx_reverb_type);
+    common_hal_audiofx_reverb_construct(self, room_size, damping, mix, buffer_size, channel_count, sample_rate);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the Reverb and releases its buffers for reuse."""
+//|         ...
+STATIC mp_obj_t audiofx_reverb_deinit(mp_obj_t self_in) {
+    audiofx_reverb_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audiofx_reverb_deinit(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(audiofx_reverb_deinit_obj, audiofx_reverb_deinit);
+
+//|     def __enter__(self) -> Reverb:
+//|         """No-op used by Context Managers."""
+//|         ...
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes the effect when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+STATIC mp_obj_t audiofx_reverb_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_audiofx_reverb_deinit(args[0]);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audiofx_reverb___exit___obj, 4, 4, audiofx_reverb_obj___exit__);
+
+//|     room_size: float
+//|     """How long the reverb lasts, from 0.0 to 1.0."""
+STATIC mp_obj_t audiofx_reverb_obj_get_room_size(mp_obj_t self_in) {
+    audiofx_effect_check_for_deinit(self_in);
+    return mp_obj_new_float(common_hal_audiofx_reverb_get_room_size(MP_OBJ_TO_PTR(self_in)));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_reverb_get_room_size_obj, audiofx_reverb_obj_get_room_size);
+
+STATIC mp_obj_t audiofx_reverb_obj_set_room_size(mp_obj_t self_in, mp_obj_t room_size) {
+    audiofx_effect_check_for_deinit(self_in);
+    common_hal_audiofx_reverb_set_room_size(MP_OBJ_TO_PTR(self_in), mp_obj_get_float(room_size));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofx_reverb_set_room_size_obj, audiofx_reverb_obj_set_room_size);
+
+MP_PROPERTY_GETSET(audiofx_reverb_room_size_obj,
+    (mp_obj_t)&audiofx_reverb_get_room_size_obj,
+    (mp_obj_t)&audiofx_reverb_set_room_size_obj);
+
+//|     damping: float
+//|     """How quickly high frequencies fade, from 0.0 to 1.0."""
+STATIC mp_obj_t audiofx_reverb_obj_get_damping(mp_obj_t self_in) {
+    audiofx_effect_check_for_deinit(self_in);
+    return mp_obj_new_float(common_hal_audiofx_reverb_get_damping(MP_OBJ_TO_PTR(self_in)));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_reverb_get_damping_obj, audiofx_reverb_obj_get_damping);
+
+STATIC mp_obj_t audiofx_reverb_obj_set_damping(mp_obj_t self_in, mp_obj_t damping) {
+    audiofx_effect_check_for_deinit(self_in);
+    common_hal_audiofx_reverb_set_damping(MP_OBJ_TO_PTR(self_in), mp_obj_get_float(damping));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofx_reverb_set_damping_obj, audiofx_reverb_obj_set_damping);
+
+MP_PROPERTY_GETSET(audiofx_reverb_damping_obj,
+    (mp_obj_t)&audiofx_reverb_get_damping_obj,
+    (mp_obj_t)&audiofx_reverb_set_damping_obj);
+
+//|     mix: float
+//|     """How much of the output is reverb instead of input, from 0.0 to 1.0."""
+STATIC mp_obj_t audiofx_reverb_obj_get_mix(mp_obj_t self_in) {
+    audiofx_effect_check_for_deinit(self_in);
+    return mp_obj_new_float(common_hal_audiofx_reverb_get_mix(MP_OBJ_TO_PTR(self_in)));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_reverb_get_mix_obj, audiofx_reverb_obj_get_mix);
+
+STATIC mp_obj_t audiofx_reverb_obj_set_mix(mp_obj_t self_in, mp_obj_t mix) {
+    audiofx_effect_check_for_deinit(self_in);
+    common_hal_audiofx_reverb_set_mix(MP_OBJ_TO_PTR(self_in), mp_obj_get_float(mix));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofx_reverb_set_mix_obj, audiofx_reverb_obj_set_mix);
+
+MP_PROPERTY_GETSET(audiofx_reverb_mix_obj,
+    (mp_obj_t)&audiofx_reverb_get_mix_obj,
+    (mp_obj_t)&audiofx_reverb_set_mix_obj);
+
+//|     playing: bool
+//|     """True when a sample is being fed into the effect. (read-only)"""
+//|
+//|     sample_rate: int
+//|     """The sample rate of the input and output in Hertz. (read-only)"""
+//|
+//|     channel_count: int
+//|     """The number of channels of the input and output. (read-only)"""
+//|
+//|     def play(self, sample: circuitpython_typing.AudioSample, *, loop: bool = False) -> None:
+//|         """Feeds the sample through the effect, once when loop=False and continuously when
+//|         loop=True. Does not block. Use `playing` to block.
+//|
+//|         The sample must be 16 bit signed and match the effect's ``sample_rate`` and
+//|         ``channel_count``."""
+//|         ...
+//|
+//|     def stop(self) -> None:
+//|         """Stops feeding the sample into the effect. Its reverb still fades out."""
+//|         ...
+//|
+STATIC const mp_rom_map_elem_t audiofx_reverb_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiofx_reverb_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audiofx_reverb___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_play), MP_ROM_PTR(&audiofx_effect_play_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop), MP_ROM_PTR(&audiofx_effect_stop_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_playing), MP_ROM_PTR(&audiofx_effect_playing_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audiofx_effect_sample_rate_obj) },
+    { MP_ROM_QSTR(MP_QSTR_channel_count), MP_ROM_PTR(&audiofx_effect_channel_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_room_size), MP_ROM_PTR(&audiofx_reverb_room_size_obj) },
+    { MP_ROM_QSTR(MP_QSTR_damping), MP_ROM_PTR(&audiofx_reverb_damping_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mix), MP_ROM_PTR(&audiofx_reverb_mix_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(audiofx_reverb_locals_dict, audiofx_reverb_locals_dict_table);
+
+STATIC const audiosample_p_t audiofx_reverb_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .sample_rate = (audiosample_sample_rate_fun)common_hal_audiofx_effect_get_sample_rate,
+    .bits_per_sample = (audiosample_bits_per_sample_fun)common_hal_audiofx_effect_get_bits_per_sample,
+    .channel_count = (audiosample_channel_count_fun)common_hal_audiofx_effect_get_channel_count,
+    .reset_buffer = (audiosample_reset_buffer_fun)audiofx_reverb_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audiofx_reverb_get_buffer,
+    .get_buffer_structure = (audiosample_get_buffer_structure_fun)audiofx_effect_get_buffer_structure,
+};
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    audiofx_reverb_type,
+    MP_QSTR_Reverb,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, audiofx_reverb_make_new,
+    locals_dict, &audiofx_reverb_locals_dict,
+    protocol, &audiofx_reverb_proto
+    );
@@ -0,0 +1,119 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+
+#include "py/obj.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/audiofx/__init__.h"
+#include "shared-bindings/audiofx/Chorus.h"
+#include "shared-bindings/audiofx/Delay.h"
+#include "shared-bindings/audiofx/Reverb.h"
+#include "shared-bindings/util.h"
+
+//| """Audio effects
+//|
+//| The `audiofx` module contains audio sources that process another source, such as a
+//| `synthio.Synthesizer` or `audiomixer.Mixer`, as it plays. Effects can be chained by
+//| playing one effect into another. Input samples must be 16 bit signed and match the
+//| effect's ``sample_rate`` and ``channel_count``.
+//|
+//| Each effect keeps producing output after its input stops so that echoes and reverb tails
+//| fade out naturally."""
+//|
+
+void audiofx_effect_check_for_deinit(mp_obj_t self_in) {
+    if (common_hal_audiofx_effect_deinited(MP_OBJ_TO_PTR(self_in))) {
+        raise_deinited_error();
+    }
+}
+
+STATIC mp_obj_t audiofx_effect_obj_play(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_sample, ARG_loop };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample,    MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_loop,      MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+    };
+    audiofx_effect_check_for_deinit(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    common_hal_audiofx_effect_play(MP_OBJ_TO_PTR(pos_args[0]), args[ARG_sample].u_obj, args[ARG_loop].u_bool);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(audiofx_effect_play_obj, 1, audiofx_effect_obj_play);
+
+STATIC mp_obj_t audiofx_effect_obj_stop(mp_obj_t self_in) {
+    audiofx_effect_check_for_deinit(self_in);
+    common_hal_audiofx_effect_stop(MP_OBJ_TO_PTR(self_in));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_effect_stop_obj, audiofx_effect_obj_stop);
+
+STATIC mp_obj_t audiofx_effect_obj_get_playing(mp_obj_t self_in) {
+    audiofx_effect_check_for_deinit(self_in);
+    return mp_obj_new_bool(common_hal_audiofx_effect_get_playing(MP_OBJ_TO_PTR(self_in)));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_effect_get_playing_obj, audiofx_effect_obj_get_playing);
+
+MP_PROPERTY_GETTER(audiofx_effect_playing_obj,
+    (mp_obj_t)&audiofx_effect_get_playing_obj);
+
+STATIC mp_obj_t audiofx_effect_obj_get_sample_rate(mp_obj_t self_in) {
+    audiofx_effect_check_for_deinit(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audiofx_effect_get_sample_rate(MP_OBJ_TO_PTR(self_in)));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_effect_get_sample_rate_obj, audiofx_effect_obj_get_sample_rate);
+
+MP_PROPERTY_GETTER(audiofx_effect_sample_rate_obj,
+    (mp_obj_t)&audiofx_effect_get_sample_rate_obj);
+
+STATIC mp_obj_t audiofx_effect_obj_get_channel_count(mp_obj_t self_in) {
+    audiofx_effect_check_for_deinit(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audiofx_effect_get_channel_count(MP_OBJ_TO_PTR(self_in)));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofx_effect_get_channel_count_obj, audiofx_effect_obj_get_channel_count);
+
+MP_PROPERTY_GETTER(audiofx_effect_channel_count_obj,
+    (mp_obj_t)&audiofx_effect_get_channel_count_obj);
+
+STATIC const mp_rom_map_elem_t audiofx_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_audiofx) },
+    { MP_ROM_QSTR(MP_QSTR_Chorus), MP_ROM_PTR(&audiofx_chorus_type) },
+    { MP_ROM_QSTR(MP_QSTR_Delay), MP_ROM_PTR(&audiofx_delay_type) },
+    { MP_ROM_QSTR(MP_QSTR_Reverb), MP_ROM_PTR(&audiofx_reverb_type) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(audiofx_module_globals, audiofx_module_globals_table);
+
+const mp_obj_module_t audiofx_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&audiofx_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_audiofx, audiofx_module);
@@ -0,0 +1,51 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "py/obj.h"
+#include "py/objproperty.h"
+
+#include "shared-module/audiofx/__init__.h"
+
+bool common_hal_audiofx_effect_deinited(audiofx_effect_obj_t *self);
+void common_hal_audiofx_effect_play(audiofx_effect_obj_t *self, mp_obj_t sample, bool loop);
+void common_hal_audiofx_effect_stop(audiofx_effect_obj_t *self);
+bool common_hal_audiofx_effect_get_playing(audiofx_effect_obj_t *self);
+uint32_t common_hal_audiofx_effect_get_sample_rate(audiofx_effect_obj_t *self);
+uint8_t common_hal_audiofx_effect_get_channel_count(audiofx_effect_obj_t *self);
+uint8_t common_hal_audiofx_effect_get_bits_per_sample(audiofx_effect_obj_t *self);
+
+// Raises an error when the effect, which may be any audiofx type, has been deinitialized.
+void audiofx_effect_check_for_deinit(mp_obj_t self_in);
+
+// Methods and properties shared by every effect type. Each effect object starts with an
+// audiofx_effect_obj_t so these work on all of them.
+extern const mp_obj_fun_builtin_var_t audiofx_effect_play_obj;
+extern const mp_obj_fun_builtin_fixed_t audiofx_effect_stop_obj;
+extern const mp_obj_property_getter_t audiofx_effect_playing_obj;
+extern const mp_obj_property_getter_t audiofx_effect_sample_rate_obj;
+extern const mp_obj_property_getter_t audiofx_effect_channel_count_obj;
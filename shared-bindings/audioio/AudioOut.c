@@ -242,6 +242,24 @@ MP_DEFINE_CONST_FUN_OBJ_1(audioio_audioout_get_paused_obj, audioio_audioout_obj_
 MP_PROPERTY_GETTER(audioio_audioout_paused_obj,
     (mp_obj_t)&audioio_audioout_get_paused_obj);
 
+//|     stats: audiocore.OutputStats
+//|     """Underruns, rendering load and fill latency since the current sample started playing.
+//|     Raises `NotImplementedError` on ports that don't keep them. (read-only)"""
+//|
+STATIC mp_obj_t audioio_audioout_obj_get_stats(mp_obj_t self_in) {
+    audioio_audioout_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return common_hal_audioio_audioout_get_stats(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_audioout_get_stats_obj, audioio_audioout_obj_get_stats);
+
+MP_PROPERTY_GETTER(audioio_audioout_stats_obj,
+    (mp_obj_t)&audioio_audioout_get_stats_obj);
+
+MP_WEAK mp_obj_t common_hal_audioio_audioout_get_stats(audioio_audioout_obj_t *self) {
+    mp_raise_NotImplementedError(NULL);
+}
+
 STATIC const mp_rom_map_elem_t audioio_audioout_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audioio_audioout_deinit_obj) },
@@ -255,6 +273,7 @@ STATIC const mp_rom_map_elem_t audioio_audioout_locals_dict_table[] = {
     // Properties
     { MP_ROM_QSTR(MP_QSTR_playing), MP_ROM_PTR(&audioio_audioout_playing_obj) },
     { MP_ROM_QSTR(MP_QSTR_paused), MP_ROM_PTR(&audioio_audioout_paused_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&audioio_audioout_stats_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(audioio_audioout_locals_dict, audioio_audioout_locals_dict_table);
 
@@ -47,7 +47,8 @@
 //|         samples_signed: bool = True,
 //|         sample_rate: int = 8000,
 //|     ) -> None:
-//|         """Create a Mixer object that can mix multiple channels with the same sample rate.
+//|         """Create a Mixer object that can mix multiple channels together. Samples with a different
+//|         sample rate or channel count than the mixer are converted as they play.
 //|         Samples are accessed and controlled with the mixer's `audiomixer.MixerVoice` objects.
 //|
 //|         :param int voice_count: The maximum number of voices to mix
@@ -189,21 +190,28 @@ MP_PROPERTY_GETTER(audiomixer_mixer_voice_obj,
     (mp_obj_t)&audiomixer_mixer_get_voice_obj);
 
 //|     def play(
-//|         self, sample: circuitpython_typing.AudioSample, *, voice: int = 0, loop: bool = False
+//|         self,
+//|         sample: circuitpython_typing.AudioSample,
+//|         *,
+//|         voice: int = 0,
+//|         loop: bool = False,
+//|         polyphase: bool = False,
 //|     ) -> None:
 //|         """Plays the sample once when loop=False and continuously when loop=True.
 //|         Does not block. Use `playing` to block.
 //|
 //|         Sample must be an `audiocore.WaveFile`, `audiocore.RawSample`, `audiomixer.Mixer` or `audiomp3.MP3Decoder`.
 //|
-//|         The sample must match the Mixer's encoding settings given in the constructor."""
+//|         The sample must match the Mixer's ``bits_per_sample`` and ``samples_signed``. See
+//|         `audiomixer.MixerVoice.play` for how other sample rates and channel counts are converted."""
 //|         ...
 STATIC mp_obj_t audiomixer_mixer_obj_play(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_sample, ARG_voice, ARG_loop };
+    enum { ARG_sample, ARG_voice, ARG_loop, ARG_polyphase };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_sample,    MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
         { MP_QSTR_voice,     MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
         { MP_QSTR_loop,      MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+        { MP_QSTR_polyphase, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
     };
     audiomixer_mixer_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
     check_for_deinit(self);
@@ -216,7 +224,7 @@ STATIC mp_obj_t audiomixer_mixer_obj_play(size_t n_args, const mp_obj_t *pos_arg
     }
     audiomixer_mixervoice_obj_t *voice = MP_OBJ_TO_PTR(self->voice[v]);
     mp_obj_t sample = args[ARG_sample].u_obj;
-    common_hal_audiomixer_mixervoice_play(voice, sample, args[ARG_loop].u_bool);
+    common_hal_audiomixer_mixervoice_play(voice, sample, args[ARG_loop].u_bool, args[ARG_polyphase].u_bool);
 
     return mp_const_none;
 }
@@ -52,27 +52,36 @@ STATIC mp_obj_t audiomixer_mixervoice_make_new(const mp_obj_type_t *type, size_t
     return MP_OBJ_FROM_PTR(self);
 }
 
-//|     def play(self, sample: circuitpython_typing.AudioSample, *, loop: bool = False) -> None:
+//|     def play(
+//|         self, sample: circuitpython_typing.AudioSample, *, loop: bool = False, polyphase: bool = False
+//|     ) -> None:
 //|         """Plays the sample once when ``loop=False``, and continuously when ``loop=True``.
 //|         Does not block. Use `playing` to block.
 //|
 //|         Sample must be an `audiocore.WaveFile`, `audiocore.RawSample`, `audiomixer.Mixer` or `audiomp3.MP3Decoder`.
 //|
-//|         The sample must match the `audiomixer.Mixer`'s encoding settings given in the constructor.
+//|         The sample must match the `audiomixer.Mixer`'s ``bits_per_sample`` and ``samples_signed``.
+//|         A sample with a different ``sample_rate`` is resampled, and a mono sample is played on both
+//|         channels of a stereo mixer. Converting a sample takes more time than mixing one that matches
+//|         the mixer.
+//|
+//|         :param bool polyphase: Resample with an 8 tap polyphase filter instead of linear interpolation.
+//|           This sounds cleaner, especially when reducing the sample rate, but takes more time.
 //|         """
 //|         ...
 STATIC mp_obj_t audiomixer_mixervoice_obj_play(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_sample, ARG_loop };
+    enum { ARG_sample, ARG_loop, ARG_polyphase };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_sample,    MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
         { MP_QSTR_loop,      MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+        { MP_QSTR_polyphase, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
     };
     audiomixer_mixervoice_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
     mp_obj_t sample = args[ARG_sample].u_obj;
-    common_hal_audiomixer_mixervoice_play(self, sample, args[ARG_loop].u_bool);
+    common_hal_audiomixer_mixervoice_play(self, sample, args[ARG_loop].u_bool, args[ARG_polyphase].u_bool);
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(audiomixer_mixervoice_play_obj, 1, audiomixer_mixervoice_obj_play);
@@ -43,11 +43,18 @@
 //|         https://learn.adafruit.com/Memory-saving-tips-for-CircuitPython/reducing-memory-fragmentation
 //|     """
 //|
-//|     def __init__(self, file: Union[str, typing.BinaryIO], buffer: WriteableBuffer) -> None:
+//|     def __init__(
+//|         self,
+//|         file: Union[str, typing.BinaryIO],
+//|         buffer: WriteableBuffer,
+//|         *,
+//|         input_buffer_size: int = 2048,
+//|     ) -> None:
 //|         """Load a .mp3 file for playback with `audioio.AudioOut` or `audiobusio.I2SOut`.
 //|
 //|         :param Union[str, typing.BinaryIO] file: The name of a mp3 file (preferred) or an already opened mp3 file
 //|         :param ~circuitpython_typing.WriteableBuffer buffer: Optional pre-allocated buffer, that will be split in half and used for double-buffering of the data. If not provided, two buffers are allocated internally.  The specific buffer size required depends on the mp3 file.
+//|         :param int input_buffer_size: Size in bytes of the buffer of compressed data read ahead from the file. Compressed data is read in the background, so a larger buffer rides out slower reads, such as an SD card that occasionally takes a long time to return a block. Must be at least 2048.
 //|
 //|         Playback of mp3 audio is CPU intensive, and the
 //|         exact limit depends on many factors such as the particular
@@ -64,6 +71,10 @@
 //|         displayio screen if audio is playing. Disable auto-refresh
 //|         and explicitly call refresh.
 //|
+//|         If playback glitches while reading from a slow card, check
+//|         `underruns` and `max_read_time`, and try a larger
+//|         ``input_buffer_size``.
+//|
 //|         Playing a mp3 file from flash::
 //|
 //|           import board
@@ -86,9 +97,20 @@
 //|         """
 //|         ...
 
-STATIC mp_obj_t audiomp3_mp3file_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
-    mp_arg_check_num(n_args, n_kw, 1, 2, false);
-    mp_obj_t arg = args[0];
+STATIC mp_obj_t audiomp3_mp3file_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_file, ARG_buffer, ARG_input_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_file, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_buffer, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_input_buffer_size, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = AUDIOMP3_MIN_INPUT_BUFFER_SIZE} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    size_t input_buffer_size = mp_arg_validate_int_min(args[ARG_input_buffer_size].u_int,
+        AUDIOMP3_MIN_INPUT_BUFFER_SIZE, MP_QSTR_input_buffer_size);
+
+    mp_obj_t arg = args[ARG_file].u_obj;
 
     if (mp_obj_is_str(arg)) {
         arg = mp_call_function_2(MP_OBJ_FROM_PTR(&mp_builtin_open_obj), arg, MP_ROM_QSTR(MP_QSTR_rb));
@@ -100,14 +122,14 @@ STATIC mp_obj_t audiomp3_mp3file_make_new(const mp_obj_type_t *type, size_t n_ar
     }
     uint8_t *buffer = NULL;
     size_t buffer_size = 0;
-    if (n_args >= 2) {
+    if (args[ARG_buffer].u_obj != mp_const_none) {
         mp_buffer_info_t bufinfo;
-        mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_WRITE);
+        mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_WRITE);
         buffer = bufinfo.buf;
         buffer_size = bufinfo.len;
     }
     common_hal_audiomp3_mp3file_construct(self, MP_OBJ_TO_PTR(arg),
-        buffer, buffer_size);
+        buffer, buffer_size, input_buffer_size);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -245,7 +267,6 @@ MP_PROPERTY_GETTER(audiomp3_mp3file_rms_level_obj,
 
 //|     samples_decoded: int
 //|     """The number of audio samples decoded from the current file. (read only)"""
-//|
 STATIC mp_obj_t audiomp3_mp3file_obj_get_samples_decoded(mp_obj_t self_in) {
     audiomp3_mp3file_obj_t *self = MP_OBJ_TO_PTR(self_in);
     check_for_deinit(self);
@@ -256,6 +277,32 @@ MP_DEFINE_CONST_FUN_OBJ_1(audiomp3_mp3file_get_samples_decoded_obj, audiomp3_mp3
 MP_PROPERTY_GETTER(audiomp3_mp3file_samples_decoded_obj,
     (mp_obj_t)&audiomp3_mp3file_get_samples_decoded_obj);
 
+//|     underruns: int
+//|     """The number of times decoding the current file had to wait for the file to be read
+//|     because reading ahead had fallen behind. Each one risks an audible glitch. (read only)"""
+STATIC mp_obj_t audiomp3_mp3file_obj_get_underruns(mp_obj_t self_in) {
+    audiomp3_mp3file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_audiomp3_mp3file_get_underruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiomp3_mp3file_get_underruns_obj, audiomp3_mp3file_obj_get_underruns);
+
+MP_PROPERTY_GETTER(audiomp3_mp3file_underruns_obj,
+    (mp_obj_t)&audiomp3_mp3file_get_underruns_obj);
+
+//|     max_read_time: float
+//|     """The longest time, in seconds, that a single read of the current file has taken. (read only)"""
+//|
+STATIC mp_obj_t audiomp3_mp3file_obj_get_max_read_time(mp_obj_t self_in) {
+    audiomp3_mp3file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_float(common_hal_audiomp3_mp3file_get_max_read_time(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiomp3_mp3file_get_max_read_time_obj, audiomp3_mp3file_obj_get_max_read_time);
+
+MP_PROPERTY_GETTER(audiomp3_mp3file_max_read_time_obj,
+    (mp_obj_t)&audiomp3_mp3file_get_max_read_time_obj);
+
 STATIC const mp_rom_map_elem_t audiomp3_mp3file_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_open), MP_ROM_PTR(&audiomp3_mp3file_open_obj) },
@@ -270,6 +317,8 @@ STATIC const mp_rom_map_elem_t audiomp3_mp3file_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_channel_count), MP_ROM_PTR(&audiomp3_mp3file_channel_count_obj) },
     { MP_ROM_QSTR(MP_QSTR_rms_level), MP_ROM_PTR(&audiomp3_mp3file_rms_level_obj) },
     { MP_ROM_QSTR(MP_QSTR_samples_decoded), MP_ROM_PTR(&audiomp3_mp3file_samples_decoded_obj) },
+    { MP_ROM_QSTR(MP_QSTR_underruns), MP_ROM_PTR(&audiomp3_mp3file_underruns_obj) },
+    { MP_ROM_QSTR(MP_QSTR_max_read_time), MP_ROM_PTR(&audiomp3_mp3file_max_read_time_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(audiomp3_mp3file_locals_dict, audiomp3_mp3file_locals_dict_table);
 
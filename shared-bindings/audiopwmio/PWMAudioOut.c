@@ -251,6 +251,24 @@ MP_DEFINE_CONST_FUN_OBJ_1(audiopwmio_pwmaudioout_get_paused_obj, audiopwmio_pwma
 MP_PROPERTY_GETTER(audiopwmio_pwmaudioout_paused_obj,
     (mp_obj_t)&audiopwmio_pwmaudioout_get_paused_obj);
 
+//|     stats: audiocore.OutputStats
+//|     """Underruns, rendering load and fill latency since the current sample started playing.
+//|     Raises `NotImplementedError` on ports that don't keep them. (read-only)"""
+//|
+STATIC mp_obj_t audiopwmio_pwmaudioout_obj_get_stats(mp_obj_t self_in) {
+    audiopwmio_pwmaudioout_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return common_hal_audiopwmio_pwmaudioout_get_stats(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiopwmio_pwmaudioout_get_stats_obj, audiopwmio_pwmaudioout_obj_get_stats);
+
+MP_PROPERTY_GETTER(audiopwmio_pwmaudioout_stats_obj,
+    (mp_obj_t)&audiopwmio_pwmaudioout_get_stats_obj);
+
+MP_WEAK mp_obj_t common_hal_audiopwmio_pwmaudioout_get_stats(audiopwmio_pwmaudioout_obj_t *self) {
+    mp_raise_NotImplementedError(NULL);
+}
+
 STATIC const mp_rom_map_elem_t audiopwmio_pwmaudioout_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiopwmio_pwmaudioout_deinit_obj) },
@@ -265,6 +283,7 @@ STATIC const mp_rom_map_elem_t audiopwmio_pwmaudioout_locals_dict_table[] = {
     // Properties
     { MP_ROM_QSTR(MP_QSTR_playing), MP_ROM_PTR(&audiopwmio_pwmaudioout_playing_obj) },
     { MP_ROM_QSTR(MP_QSTR_paused), MP_ROM_PTR(&audiopwmio_pwmaudioout_paused_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&audiopwmio_pwmaudioout_stats_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(audiopwmio_pwmaudioout_locals_dict, audiopwmio_pwmaudioout_locals_dict_table);
 
@@ -54,15 +54,20 @@
 //|     useful ``weights`` values, see `wikipedia's article on the
 //|     subject <https://en.wikipedia.org/wiki/Kernel_(image_processing)>`_.
 //|
-//|     The ``bitmap``, which must be in RGB565_SWAPPED format, is modified
-//|     according to the ``weights``. Then a scaling factor ``mul`` and an
-//|     offset factor ``add`` are applied.
+//|     The ``bitmap``, which must be in RGB565_SWAPPED format or 8-bit
+//|     grayscale, is modified according to the ``weights``. Then a scaling
+//|     factor ``mul`` and an offset factor ``add`` are applied.
 //|
 //|     The ``weights`` must be a sequence of integers. The length of the tuple
 //|     must be the square of an odd number, usually 9 and sometimes 25.
 //|     Specific weights create different effects. For instance, these
 //|     weights represent a 3x3 gaussian blur: ``[1, 2, 1, 2, 4, 2, 1, 2, 1]``
 //|
+//|     Weights that are the product of a row and a column of integers, such
+//|     as the gaussian blur above or a box blur where every weight is the
+//|     same, are applied as a horizontal pass followed by a vertical one.
+//|     This gives the same result much faster, especially for larger kernels.
+//|
 //|     ``mul`` is number to multiply the convolution pixel results by.
 //|     If `None` (the default) is passed, the value of ``1/sum(weights)``
 //|     is used (or ``1`` if ``sum(weights)`` is ``0``). For most weights, his
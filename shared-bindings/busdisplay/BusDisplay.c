@@ -85,7 +85,9 @@
 //|         auto_refresh: bool = True,
 //|         native_frames_per_second: int = 60,
 //|         backlight_on_high: bool = True,
-//|         SH1107_addressing: bool = False
+//|         SH1107_addressing: bool = False,
+//|         backlight_pwm_frequency: int = 50000,
+//|         pixel_buffer_size: int = 128
 //|     ) -> None:
 //|         r"""Create a Display object on the given display bus (`FourWire`, `paralleldisplaybus.ParallelBus` or `I2CDisplayBus`).
 //|
@@ -143,6 +145,9 @@
 //|         :param bool SH1107_addressing: Special quirk for SH1107, use upper/lower column set and page set
 //|         :param int set_vertical_scroll: This parameter is accepted but ignored for backwards compatibility. It will be removed in a future release.
 //|         :param int backlight_pwm_frequency: The frequency to use to drive the PWM for backlight brightness control. Default is 50000.
+//|         :param int pixel_buffer_size: The number of 32-bit words used to buffer pixels while refreshing. Larger
+//|             buffers reduce the number of bus transactions per refresh at the cost of stack space. Must be
+//|             between 32 and 1024.
 //|         """
 //|         ...
 STATIC mp_obj_t busdisplay_busdisplay_make_new(const mp_obj_type_t *type, size_t n_args,
@@ -154,7 +159,7 @@ STATIC mp_obj_t busdisplay_busdisplay_make_new(const mp_obj_type_t *type, size_t
            ARG_set_vertical_scroll, ARG_backlight_pin, ARG_brightness_command,
            ARG_brightness, ARG_single_byte_bounds, ARG_data_as_commands,
            ARG_auto_refresh, ARG_native_frames_per_second, ARG_backlight_on_high,
-           ARG_SH1107_addressing, ARG_backlight_pwm_frequency };
+           ARG_SH1107_addressing, ARG_backlight_pwm_frequency, ARG_pixel_buffer_size };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_display_bus, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_init_sequence, MP_ARG_REQUIRED | MP_ARG_OBJ },
@@ -182,7 +187,8 @@ STATIC mp_obj_t busdisplay_busdisplay_make_new(const mp_obj_type_t *type, size_t
         { MP_QSTR_native_frames_per_second, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 60} },
         { MP_QSTR_backlight_on_high, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = true} },
         { MP_QSTR_SH1107_addressing, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
-        { MP_QSTR_backlight_pwm_frequency, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 50000} }
+        { MP_QSTR_backlight_pwm_frequency, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 50000} },
+        { MP_QSTR_pixel_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = BUSDISPLAY_DEFAULT_PIXEL_BUFFER_SIZE} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -208,6 +214,9 @@ STATIC mp_obj_t busdisplay_busdisplay_make_new(const mp_obj_type_t *type, size_t
         mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be 1 when %q is True"), MP_QSTR_color_depth, MP_QSTR_SH1107_addressing);
     }
 
+    const mp_int_t pixel_buffer_size = mp_arg_validate_int_range(args[ARG_pixel_buffer_size].u_int,
+        BUSDISPLAY_MIN_PIXEL_BUFFER_SIZE, BUSDISPLAY_MAX_PIXEL_BUFFER_SIZE, MP_QSTR_pixel_buffer_size);
+
     primary_display_t *disp = allocate_display_or_raise();
     busdisplay_busdisplay_obj_t *self = &disp->display;
 
@@ -234,6 +243,7 @@ STATIC mp_obj_t busdisplay_busdisplay_make_new(const mp_obj_type_t *type, size_t
         sh1107_addressing,
         args[ARG_backlight_pwm_frequency].u_int
         );
+    common_hal_busdisplay_busdisplay_set_pixel_buffer_size(self, pixel_buffer_size);
 
     return self;
 }
@@ -410,6 +420,17 @@ MP_DEFINE_CONST_FUN_OBJ_1(busdisplay_busdisplay_get_bus_obj, busdisplay_busdispl
 MP_PROPERTY_GETTER(busdisplay_busdisplay_bus_obj,
     (mp_obj_t)&busdisplay_busdisplay_get_bus_obj);
 
+//|     stats: displayio.DisplayStats
+//|     """Refresh timing and counters for the most recent frame. Cheap enough to read every frame."""
+STATIC mp_obj_t busdisplay_busdisplay_obj_get_stats(mp_obj_t self_in) {
+    busdisplay_busdisplay_obj_t *self = native_display(self_in);
+    return common_hal_busdisplay_busdisplay_get_stats(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(busdisplay_busdisplay_get_stats_obj, busdisplay_busdisplay_obj_get_stats);
+
+MP_PROPERTY_GETTER(busdisplay_busdisplay_stats_obj,
+    (mp_obj_t)&busdisplay_busdisplay_get_stats_obj);
+
 //|     root_group: displayio.Group
 //|     """The root group on the display.
 //|     If the root group is set to `displayio.CIRCUITPYTHON_TERMINAL`, the default CircuitPython terminal will be shown.
@@ -438,6 +459,81 @@ MP_PROPERTY_GETSET(busdisplay_busdisplay_root_group_obj,
     (mp_obj_t)&busdisplay_busdisplay_set_root_group_obj);
 
 
+//|     def set_scroll_area(
+//|         self, top: int = 0, height: Optional[int] = None, *, memory_height: Optional[int] = None
+//|     ) -> None:
+//|         """Set the rows that `scroll` moves using the controller's vertical scrolling
+//|         commands (MIPI VSCRDEF and VSCSAD). Rows above and below the area stay fixed.
+//|         Only supported when `rotation` is 0.
+//|
+//|         :param int top: The first display row of the scroll area
+//|         :param int height: The number of rows in the scroll area. Defaults to the rest of the display. 0 turns scrolling off.
+//|         :param int memory_height: The number of rows in the controller's frame memory. Defaults to the display height plus
+//|           its ``rowstart``. Set this when the controller has more rows than are visible, such as a 240x240 panel on a
+//|           320 row ST7789.
+//|         """
+//|         ...
+//|
+STATIC mp_obj_t busdisplay_busdisplay_obj_set_scroll_area(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_top, ARG_height, ARG_memory_height };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_top, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_height, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_memory_height, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    busdisplay_busdisplay_obj_t *self = native_display(pos_args[0]);
+
+    if (common_hal_busdisplay_busdisplay_get_rotation(self) != 0) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be %d"), MP_QSTR_rotation, 0);
+    }
+    uint16_t display_height = common_hal_busdisplay_busdisplay_get_height(self);
+    mp_int_t top = mp_arg_validate_int_range(args[ARG_top].u_int, 0, display_height - 1, MP_QSTR_top);
+    mp_int_t height = display_height - top;
+    if (args[ARG_height].u_obj != mp_const_none) {
+        height = mp_arg_validate_int_range(mp_obj_get_int(args[ARG_height].u_obj), 0, display_height - top, MP_QSTR_height);
+    }
+    mp_int_t memory_height = self->bus.rowstart + display_height;
+    if (args[ARG_memory_height].u_obj != mp_const_none) {
+        memory_height = mp_arg_validate_int_range(mp_obj_get_int(args[ARG_memory_height].u_obj),
+            self->bus.rowstart + display_height, 0xffff, MP_QSTR_memory_height);
+    }
+
+    if (!common_hal_busdisplay_busdisplay_set_scroll_area(self, top, height, memory_height)) {
+        mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q in use"), MP_QSTR_bus);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(busdisplay_busdisplay_set_scroll_area_obj, 1, busdisplay_busdisplay_obj_set_scroll_area);
+
+//|     def scroll(self, lines: int) -> None:
+//|         """Scroll the area set by `set_scroll_area` up by ``lines`` rows, or down when negative.
+//|         The move happens in the controller so only the rows that scroll into view are sent
+//|         on the next refresh.
+//|
+//|         Move the content of `root_group` inside the scroll area by the same number of rows
+//|         before the next refresh, for example by changing a `displayio.Group`'s ``y``, so that
+//|         the newly exposed rows are drawn from matching content. Other changes inside the
+//|         scroll area are not redrawn on the refresh that follows a scroll.
+//|
+//|         :param int lines: The number of rows to scroll
+//|         """
+//|         ...
+//|
+STATIC mp_obj_t busdisplay_busdisplay_obj_scroll(mp_obj_t self_in, mp_obj_t lines_in) {
+    busdisplay_busdisplay_obj_t *self = native_display(self_in);
+    mp_int_t lines = mp_obj_get_int(lines_in);
+    if (self->scroll_height == 0) {
+        mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q() without %q()"), MP_QSTR_scroll, MP_QSTR_set_scroll_area);
+    }
+    if (!common_hal_busdisplay_busdisplay_scroll(self, lines)) {
+        mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q in use"), MP_QSTR_bus);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(busdisplay_busdisplay_scroll_obj, busdisplay_busdisplay_obj_scroll);
+
 //|     def fill_row(self, y: int, buffer: WriteableBuffer) -> WriteableBuffer:
 //|         """Extract the pixels from a single row
 //|
@@ -501,6 +597,8 @@ STATIC const mp_rom_map_elem_t busdisplay_busdisplay_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_show), MP_ROM_PTR(&busdisplay_busdisplay_show_obj) },
     { MP_ROM_QSTR(MP_QSTR_refresh), MP_ROM_PTR(&busdisplay_busdisplay_refresh_obj) },
     { MP_ROM_QSTR(MP_QSTR_fill_row), MP_ROM_PTR(&busdisplay_busdisplay_fill_row_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set_scroll_area), MP_ROM_PTR(&busdisplay_busdisplay_set_scroll_area_obj) },
+    { MP_ROM_QSTR(MP_QSTR_scroll), MP_ROM_PTR(&busdisplay_busdisplay_scroll_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_auto_refresh), MP_ROM_PTR(&busdisplay_busdisplay_auto_refresh_obj) },
 
@@ -510,6 +608,7 @@ STATIC const mp_rom_map_elem_t busdisplay_busdisplay_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&busdisplay_busdisplay_height_obj) },
     { MP_ROM_QSTR(MP_QSTR_rotation), MP_ROM_PTR(&busdisplay_busdisplay_rotation_obj) },
     { MP_ROM_QSTR(MP_QSTR_bus), MP_ROM_PTR(&busdisplay_busdisplay_bus_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&busdisplay_busdisplay_stats_obj) },
     { MP_ROM_QSTR(MP_QSTR_root_group), MP_ROM_PTR(&busdisplay_busdisplay_root_group_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(busdisplay_busdisplay_locals_dict, busdisplay_busdisplay_locals_dict_table);
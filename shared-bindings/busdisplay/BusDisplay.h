@@ -36,6 +36,12 @@ extern const mp_obj_type_t busdisplay_busdisplay_type;
 #define NO_BRIGHTNESS_COMMAND 0x100
 #define NO_FPS_LIMIT 0xffffffff
 
+// Size of the pixel buffer used for each refresh chunk, in uint32_ts. The buffer lives on the
+// stack during a refresh so the maximum is kept modest.
+#define BUSDISPLAY_DEFAULT_PIXEL_BUFFER_SIZE 128
+#define BUSDISPLAY_MIN_PIXEL_BUFFER_SIZE 32
+#define BUSDISPLAY_MAX_PIXEL_BUFFER_SIZE 1024
+
 void common_hal_busdisplay_busdisplay_construct(busdisplay_busdisplay_obj_t *self,
     mp_obj_t bus, uint16_t width, uint16_t height,
     int16_t colstart, int16_t rowstart, uint16_t rotation, uint16_t color_depth, bool grayscale,
@@ -46,6 +52,9 @@ void common_hal_busdisplay_busdisplay_construct(busdisplay_busdisplay_obj_t *sel
     bool single_byte_bounds, bool data_as_commands, bool auto_refresh, uint16_t native_frames_per_second,
     bool backlight_on_high, bool SH1107_addressing, uint16_t backlight_pwm_frequency);
 
+uint16_t common_hal_busdisplay_busdisplay_get_pixel_buffer_size(busdisplay_busdisplay_obj_t *self);
+void common_hal_busdisplay_busdisplay_set_pixel_buffer_size(busdisplay_busdisplay_obj_t *self, uint16_t pixel_buffer_size);
+
 bool common_hal_busdisplay_busdisplay_refresh(busdisplay_busdisplay_obj_t *self, uint32_t target_ms_per_frame, uint32_t maximum_ms_per_real_frame);
 
 bool common_hal_busdisplay_busdisplay_get_auto_refresh(busdisplay_busdisplay_obj_t *self);
@@ -59,9 +68,13 @@ void common_hal_busdisplay_busdisplay_set_rotation(busdisplay_busdisplay_obj_t *
 bool common_hal_busdisplay_busdisplay_get_dither(busdisplay_busdisplay_obj_t *self);
 void common_hal_busdisplay_busdisplay_set_dither(busdisplay_busdisplay_obj_t *self, bool dither);
 
+bool common_hal_busdisplay_busdisplay_set_scroll_area(busdisplay_busdisplay_obj_t *self, uint16_t top, uint16_t height, uint16_t memory_height);
+bool common_hal_busdisplay_busdisplay_scroll(busdisplay_busdisplay_obj_t *self, mp_int_t lines);
+
 mp_float_t common_hal_busdisplay_busdisplay_get_brightness(busdisplay_busdisplay_obj_t *self);
 bool common_hal_busdisplay_busdisplay_set_brightness(busdisplay_busdisplay_obj_t *self, mp_float_t brightness);
 
 mp_obj_t common_hal_busdisplay_busdisplay_get_bus(busdisplay_busdisplay_obj_t *self);
+mp_obj_t common_hal_busdisplay_busdisplay_get_stats(busdisplay_busdisplay_obj_t *self);
 mp_obj_t common_hal_busdisplay_busdisplay_get_root_group(busdisplay_busdisplay_obj_t *self);
 mp_obj_t common_hal_busdisplay_busdisplay_set_root_group(busdisplay_busdisplay_obj_t *self, displayio_group_t *root_group);
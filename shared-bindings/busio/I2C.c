@@ -372,6 +372,88 @@ STATIC mp_obj_t busio_i2c_writeto_then_readfrom(size_t n_args, const mp_obj_t *p
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(busio_i2c_writeto_then_readfrom_obj, 1, busio_i2c_writeto_then_readfrom);
 
+MP_WEAK uint8_t common_hal_busio_i2c_transact(busio_i2c_obj_t *self, const busio_i2c_step_t *steps, size_t num_steps) {
+    for (size_t i = 0; i < num_steps; i++) {
+        const busio_i2c_step_t *step = &steps[i];
+        uint8_t status;
+        if (step->data_in == NULL) {
+            status = common_hal_busio_i2c_write(self, step->address, step->data_out, step->out_len);
+        } else if (step->data_out == NULL) {
+            status = common_hal_busio_i2c_read(self, step->address, step->data_in, step->in_len);
+        } else {
+            status = common_hal_busio_i2c_write_read(self, step->address,
+                (uint8_t *)step->data_out, step->out_len, step->data_in, step->in_len);
+        }
+        if (status != 0) {
+            return status;
+        }
+    }
+    return 0;
+}
+
+//|     def transact(
+//|         self,
+//|         steps: Sequence[Tuple[int, Optional[ReadableBuffer], Optional[WriteableBuffer]]],
+//|     ) -> None:
+//|         """Run a list of transfers, to one or more devices, back to back without
+//|         returning to Python in between. The I2C object must be locked.
+//|
+//|         Each step is a tuple ``(address, out_buffer, in_buffer)``. ``out_buffer`` is
+//|         written to the device, then ``in_buffer`` is filled from it after a repeated
+//|         start, as in `writeto_then_readfrom`. Either buffer may be ``None`` or left off
+//|         the end of the tuple, to only read or only write. Reading register values from
+//|         several sensors into slices of one preallocated buffer (using `memoryview`)
+//|         takes a single call.
+//|
+//|         All of the steps are checked before any data is sent. On some ports the whole list
+//|         is queued to the I2C hardware at once. If a step fails, the steps after it are not
+//|         run, and `OSError` is raised."""
+//|         ...
+STATIC mp_obj_t busio_i2c_transact(mp_obj_t self_in, mp_obj_t steps_in) {
+    busio_i2c_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    check_lock(self);
+
+    size_t num_steps;
+    mp_obj_t *step_objs;
+    mp_obj_get_array(steps_in, &num_steps, &step_objs);
+    busio_i2c_step_t *steps = m_new(busio_i2c_step_t, num_steps);
+    for (size_t i = 0; i < num_steps; i++) {
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_get_array(step_objs[i], &len, &items);
+        mp_arg_validate_length_range(len, 1, 3, MP_QSTR_steps);
+
+        busio_i2c_step_t *step = &steps[i];
+        step->address = mp_arg_validate_int_range(mp_obj_get_int(items[0]), 0, 0x7f, MP_QSTR_address);
+        step->data_out = NULL;
+        step->out_len = 0;
+        step->data_in = NULL;
+        step->in_len = 0;
+
+        mp_buffer_info_t bufinfo;
+        if (len > 1 && items[1] != mp_const_none) {
+            mp_get_buffer_raise(items[1], &bufinfo, MP_BUFFER_READ);
+            step->data_out = bufinfo.buf;
+            step->out_len = bufinfo.len;
+        }
+        if (len > 2 && items[2] != mp_const_none) {
+            mp_get_buffer_raise(items[2], &bufinfo, MP_BUFFER_WRITE);
+            mp_arg_validate_length_min(bufinfo.len, 1, MP_QSTR_in_buffer);
+            step->data_in = bufinfo.buf;
+            step->in_len = bufinfo.len;
+        }
+    }
+
+    uint8_t status = common_hal_busio_i2c_transact(self, steps, num_steps);
+    m_del(busio_i2c_step_t, steps, num_steps);
+    if (status != 0) {
+        mp_raise_OSError(status);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(busio_i2c_transact_obj, busio_i2c_transact);
+
 STATIC const mp_rom_map_elem_t busio_i2c_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&busio_i2c_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
@@ -384,6 +466,7 @@ STATIC const mp_rom_map_elem_t busio_i2c_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_readfrom_into), MP_ROM_PTR(&busio_i2c_readfrom_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_writeto), MP_ROM_PTR(&busio_i2c_writeto_obj) },
     { MP_ROM_QSTR(MP_QSTR_writeto_then_readfrom), MP_ROM_PTR(&busio_i2c_writeto_then_readfrom_obj) },
+    { MP_ROM_QSTR(MP_QSTR_transact), MP_ROM_PTR(&busio_i2c_transact_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(busio_i2c_locals_dict, busio_i2c_locals_dict_table);
@@ -64,5 +64,21 @@ extern uint8_t common_hal_busio_i2c_read(busio_i2c_obj_t *self, uint16_t address
 uint8_t common_hal_busio_i2c_write_read(busio_i2c_obj_t *self, uint16_t address,
     uint8_t *out_data, size_t out_len, uint8_t *in_data, size_t in_len);
 
+// One step of I2C.transact(): write data_out, then read into data_in after a repeated
+// start. data_out and data_in may each be NULL. When both are NULL the step is a
+// zero-length write.
+typedef struct {
+    const uint8_t *data_out;
+    uint8_t *data_in;
+    size_t out_len;
+    size_t in_len;
+    uint16_t address;
+} busio_i2c_step_t;
+
+// Runs the steps back to back and returns 0 on success or the error code of the
+// first step that failed. The default implementation calls write, read or
+// write_read for each step; ports may override it to queue the whole list at once.
+extern uint8_t common_hal_busio_i2c_transact(busio_i2c_obj_t *self, const busio_i2c_step_t *steps, size_t num_steps);
+
 // This is used by the supervisor to claim I2C devices indefinitely.
 extern void common_hal_busio_i2c_never_reset(busio_i2c_obj_t *self);
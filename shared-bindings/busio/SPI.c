@@ -29,8 +29,10 @@
 
 #include <string.h>
 
+#include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/busio/SPI.h"
+#include "shared-bindings/digitalio/DigitalInOut.h"
 #include "shared-bindings/util.h"
 
 #include "shared/runtime/buffer_helper.h"
@@ -454,6 +456,145 @@ STATIC mp_obj_t busio_spi_write_readinto(size_t n_args, const mp_obj_t *pos_args
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(busio_spi_write_readinto_obj, 1, busio_spi_write_readinto);
 
+MP_WEAK bool common_hal_busio_spi_transact(busio_spi_obj_t *self, const busio_spi_step_t *steps, size_t num_steps,
+    digitalio_digitalinout_obj_t *dc) {
+    for (size_t i = 0; i < num_steps; i++) {
+        const busio_spi_step_t *step = &steps[i];
+        if (step->dc >= 0) {
+            common_hal_digitalio_digitalinout_set_value(dc, step->dc);
+        }
+        bool ok = true;
+        if (step->len > 0) {
+            if (step->data_out != NULL && step->data_in != NULL) {
+                ok = common_hal_busio_spi_transfer(self, step->data_out, step->data_in, step->len);
+            } else if (step->data_out != NULL) {
+                ok = common_hal_busio_spi_write(self, step->data_out, step->len);
+            } else {
+                ok = common_hal_busio_spi_read(self, step->data_in, step->len, 0);
+            }
+        }
+        if (!ok) {
+            return false;
+        }
+        if (step->delay_us > 0) {
+            common_hal_mcu_delay_us(step->delay_us);
+        }
+    }
+    return true;
+}
+
+//|     def transact(
+//|         self,
+//|         steps: Sequence[
+//|             Tuple[
+//|                 Optional[ReadableBuffer],
+//|                 Optional[WriteableBuffer],
+//|                 Optional[bool],
+//|                 int,
+//|             ]
+//|         ],
+//|         *,
+//|         cs: Optional[digitalio.DigitalInOut] = None,
+//|         dc: Optional[digitalio.DigitalInOut] = None
+//|     ) -> None:
+//|         """Run a list of transfers back to back without returning to Python in between.
+//|         The SPI object must be locked.
+//|
+//|         Each step is a tuple ``(out_buffer, in_buffer, dc_value, delay_us)``. Items may be
+//|         left off the end of the tuple, and take their defaults:
+//|
+//|         * ``out_buffer``: bytes to write, or ``None`` to write zeros while reading
+//|         * ``in_buffer``: buffer to read into, or ``None`` (the default) to only write.
+//|           When both buffers are given they must be the same length.
+//|         * ``dc_value``: the value to set ``dc`` to before the step, or ``None`` (the default)
+//|           to leave it alone. Useful for displays that take commands and data on the same bus.
+//|         * ``delay_us``: microseconds to wait after the step, default 0
+//|
+//|         All of the steps are checked before any data is sent. On some ports the whole list
+//|         is queued to the SPI hardware at once.
+//|
+//|         :param digitalio.DigitalInOut cs: an output pin that is set low for the whole
+//|           list and high again afterwards, or ``None`` to manage chip select yourself.
+//|         :param digitalio.DigitalInOut dc: an output pin for the ``dc_value`` of each step.
+//|           Required if any step sets ``dc_value``."""
+//|         ...
+
+STATIC mp_obj_t busio_spi_transact(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_steps, ARG_cs, ARG_dc };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_steps, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_cs, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_dc, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    busio_spi_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    check_lock(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    digitalio_digitalinout_obj_t *cs = NULL;
+    if (args[ARG_cs].u_obj != mp_const_none) {
+        cs = mp_arg_validate_type(args[ARG_cs].u_obj, &digitalio_digitalinout_type, MP_QSTR_cs);
+    }
+    digitalio_digitalinout_obj_t *dc = NULL;
+
+    size_t num_steps;
+    mp_obj_t *step_objs;
+    mp_obj_get_array(args[ARG_steps].u_obj, &num_steps, &step_objs);
+    busio_spi_step_t *steps = m_new(busio_spi_step_t, num_steps);
+    for (size_t i = 0; i < num_steps; i++) {
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_get_array(step_objs[i], &len, &items);
+        mp_arg_validate_length_range(len, 1, 4, MP_QSTR_steps);
+
+        busio_spi_step_t *step = &steps[i];
+        step->data_out = NULL;
+        step->data_in = NULL;
+        step->len = 0;
+        step->dc = -1;
+        step->delay_us = 0;
+
+        mp_buffer_info_t bufinfo;
+        if (items[0] != mp_const_none) {
+            mp_get_buffer_raise(items[0], &bufinfo, MP_BUFFER_READ);
+            step->data_out = bufinfo.buf;
+            step->len = bufinfo.len;
+        }
+        if (len > 1 && items[1] != mp_const_none) {
+            mp_get_buffer_raise(items[1], &bufinfo, MP_BUFFER_WRITE);
+            if (step->data_out != NULL && bufinfo.len != step->len) {
+                mp_raise_ValueError(MP_ERROR_TEXT("buffer slices must be of equal length"));
+            }
+            step->data_in = bufinfo.buf;
+            step->len = bufinfo.len;
+        }
+        if (len > 2 && items[2] != mp_const_none) {
+            if (dc == NULL) {
+                dc = mp_arg_validate_type(args[ARG_dc].u_obj, &digitalio_digitalinout_type, MP_QSTR_dc);
+            }
+            step->dc = mp_obj_is_true(items[2]);
+        }
+        if (len > 3) {
+            step->delay_us = mp_arg_validate_int_min(mp_obj_get_int(items[3]), 0, MP_QSTR_delay_us);
+        }
+    }
+
+    if (cs != NULL) {
+        common_hal_digitalio_digitalinout_set_value(cs, false);
+    }
+    bool ok = common_hal_busio_spi_transact(self, steps, num_steps, dc);
+    if (cs != NULL) {
+        common_hal_digitalio_digitalinout_set_value(cs, true);
+    }
+    m_del(busio_spi_step_t, steps, num_steps);
+    if (!ok) {
+        mp_raise_OSError(MP_EIO);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(busio_spi_transact_obj, 1, busio_spi_transact);
+
 //|     frequency: int
 //|     """The actual SPI bus frequency. This may not match the frequency requested
 //|     due to internal limitations."""
@@ -482,6 +623,7 @@ STATIC const mp_rom_map_elem_t busio_spi_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_unlock), MP_ROM_PTR(&busio_spi_unlock_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&busio_spi_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_transact), MP_ROM_PTR(&busio_spi_transact_obj) },
     { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&busio_spi_write_obj) },
     { MP_ROM_QSTR(MP_QSTR_write_readinto), MP_ROM_PTR(&busio_spi_write_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_frequency), MP_ROM_PTR(&busio_spi_frequency_obj) }
@@ -31,6 +31,7 @@
 
 #include "common-hal/microcontroller/Pin.h"
 #include "common-hal/busio/SPI.h"
+#include "common-hal/digitalio/DigitalInOut.h"
 
 // Type object used in Python. Should be shared between ports.
 extern const mp_obj_type_t busio_spi_type;
@@ -58,6 +59,21 @@ extern bool common_hal_busio_spi_read(busio_spi_obj_t *self, uint8_t *data, size
 // Reads and write len bytes simultaneously.
 extern bool common_hal_busio_spi_transfer(busio_spi_obj_t *self, const uint8_t *data_out, uint8_t *data_in, size_t len);
 
+// One step of SPI.transact(). data_out and data_in may each be NULL, but not both.
+typedef struct {
+    const uint8_t *data_out;
+    uint8_t *data_in;
+    size_t len;
+    int8_t dc; // -1 to leave the DC pin alone, otherwise its value during the step
+    uint32_t delay_us; // wait after the step
+} busio_spi_step_t;
+
+// Runs the steps back to back. dc may be NULL if no step sets it. The default
+// implementation calls write, read or transfer for each step; ports may override
+// it to queue the whole list in hardware.
+extern bool common_hal_busio_spi_transact(busio_spi_obj_t *self, const busio_spi_step_t *steps, size_t num_steps,
+    digitalio_digitalinout_obj_t *dc);
+
 // Return actual SPI bus frequency.
 uint32_t common_hal_busio_spi_get_frequency(busio_spi_obj_t *self);
 
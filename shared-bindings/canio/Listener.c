@@ -63,6 +63,36 @@ STATIC mp_obj_t canio_listener_receive(mp_obj_t self_in) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(canio_listener_receive_obj, canio_listener_receive);
 
+//|     def receive_into(self, buffer: WriteableBuffer) -> int:
+//|         """Reads all waiting messages that fit into ``buffer``, after waiting up
+//|         to ``self.timeout`` seconds for the first one
+//|
+//|         Each message takes 16 bytes, laid out like the `struct` format
+//|         ``"<IHBB8s"``: the id, a timestamp, flags, the data length and 8 bytes
+//|         of data. Bit 0 of the flags is set for an extended id, and bit 1 for
+//|         a remote transmission request. The timestamp is the CAN peripheral's
+//|         16-bit time counter when the message arrived, which counts bit times,
+//|         or 0 on ports whose peripheral doesn't have one.
+//|
+//|         Unlike `receive`, nothing is allocated, so a busy bus can be logged
+//|         by reusing the same buffer.
+//|
+//|         :return: the number of messages stored, 0 if none arrived in time
+//|         :rtype: int"""
+//|         ...
+STATIC mp_obj_t canio_listener_receive_into(mp_obj_t self_in, mp_obj_t buffer) {
+    canio_listener_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_canio_listener_check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_WRITE);
+    size_t count = bufinfo.len / sizeof(canio_listener_record_t);
+    mp_arg_validate_length_min(count, 1, MP_QSTR_buffer);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_canio_listener_receive_into(self, bufinfo.buf, count));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(canio_listener_receive_into_obj, canio_listener_receive_into);
+
 //|     def in_waiting(self) -> int:
 //|         """Returns the number of messages (including remote
 //|         transmission requests) waiting"""
@@ -163,6 +193,7 @@ STATIC const mp_rom_map_elem_t canio_listener_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&canio_listener_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR_in_waiting), MP_ROM_PTR(&canio_listener_in_waiting_obj) },
     { MP_ROM_QSTR(MP_QSTR_receive), MP_ROM_PTR(&canio_listener_receive_obj) },
+    { MP_ROM_QSTR(MP_QSTR_receive_into), MP_ROM_PTR(&canio_listener_receive_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_timeout), MP_ROM_PTR(&canio_listener_timeout_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(canio_listener_locals_dict, canio_listener_locals_dict_table);
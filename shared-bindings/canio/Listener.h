@@ -34,10 +34,23 @@ extern const mp_obj_type_t canio_listener_type;
 
 typedef struct canio_listener_obj canio_listener_obj_t;
 
+// One message in a Listener.receive_into() buffer, laid out like the struct format "<IHBB8s".
+typedef struct {
+    uint32_t id;
+    uint16_t timestamp;
+    uint8_t flags;
+    uint8_t size;
+    uint8_t data[8];
+} __attribute__((packed)) canio_listener_record_t;
+
+#define CANIO_LISTENER_RECORD_EXTENDED (1)
+#define CANIO_LISTENER_RECORD_RTR (2)
+
 void common_hal_canio_listener_construct(canio_listener_obj_t *self, canio_can_obj_t *can, size_t nmatch, canio_match_obj_t **matches, float timeout);
 void common_hal_canio_listener_check_for_deinit(canio_listener_obj_t *self);
 void common_hal_canio_listener_deinit(canio_listener_obj_t *self);
 mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self);
+size_t common_hal_canio_listener_receive_into(canio_listener_obj_t *self, canio_listener_record_t *records, size_t count);
 int common_hal_canio_listener_in_waiting(canio_listener_obj_t *self);
 float common_hal_canio_listener_get_timeout(canio_listener_obj_t *self);
 void common_hal_canio_listener_set_timeout(canio_listener_obj_t *self, float timeout);
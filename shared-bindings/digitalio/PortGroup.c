@@ -0,0 +1,252 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared/runtime/context_manager_helpers.h"
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/microcontroller/Pin.h"
+#include "shared-bindings/digitalio/DigitalInOut.h"
+#include "shared-bindings/digitalio/Direction.h"
+#include "shared-bindings/digitalio/PortGroup.h"
+#include "shared-bindings/digitalio/Pull.h"
+#include "shared-bindings/util.h"
+
+#if CIRCUITPY_DIGITALIO_PORTGROUP
+
+//| class PortGroup:
+//|     """Digital input and output on several pins at once
+//|
+//|     A PortGroup reads and writes its pins together as one integer, with bit
+//|     ``i`` for ``pins[i]``. Pins that share a GPIO port are read or written
+//|     with a single register access, so parallel buses and button arrays run
+//|     much faster than with a `DigitalInOut` per pin. Pins that are consecutive
+//|     and in order on a port are the cheapest to pack. On ports without direct
+//|     register access each pin is still accessed one at a time."""
+//|
+//|     def __init__(self, pins: Sequence[microcontroller.Pin]) -> None:
+//|         """Create a new PortGroup for up to 32 pins. Defaults to input with no
+//|         pull. Use :py:meth:`switch_to_input` and :py:meth:`switch_to_output` to
+//|         change the direction.
+//|
+//|         :param Sequence[microcontroller.Pin] pins: The pins to control, least
+//|           significant bit first
+//|
+//|         Example usage::
+//|
+//|           import digitalio
+//|           import board
+//|
+//|           bus = digitalio.PortGroup((board.D0, board.D1, board.D2, board.D3))
+//|           bus.switch_to_output()
+//|           bus.value = 0b1010"""
+//|         ...
+STATIC mp_obj_t digitalio_portgroup_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_pins };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_pins, MP_ARG_REQUIRED | MP_ARG_OBJ },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t pins = args[ARG_pins].u_obj;
+    validate_no_duplicate_pins(pins, MP_QSTR_pins);
+    // mp_obj_len() will be >= 0.
+    const size_t num_pins = mp_arg_validate_length_range((size_t)MP_OBJ_SMALL_INT_VALUE(mp_obj_len(pins)),
+        1, DIGITALIO_PORTGROUP_MAX_PINS, MP_QSTR_pins);
+
+    const mcu_pin_obj_t *pins_array[num_pins];
+    for (size_t i = 0; i < num_pins; i++) {
+        pins_array[i] =
+            validate_obj_is_free_pin(mp_obj_subscr(pins, MP_OBJ_NEW_SMALL_INT(i), MP_OBJ_SENTINEL), MP_QSTR_pin);
+    }
+
+    digitalio_portgroup_obj_t *self = mp_obj_malloc(digitalio_portgroup_obj_t, &digitalio_portgroup_type);
+    common_hal_digitalio_portgroup_construct(self, num_pins, pins_array);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Turn off the PortGroup and release the pins for other use."""
+//|         ...
+STATIC mp_obj_t digitalio_portgroup_obj_deinit(mp_obj_t self_in) {
+    digitalio_portgroup_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_digitalio_portgroup_deinit(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(digitalio_portgroup_deinit_obj, digitalio_portgroup_obj_deinit);
+
+//|     def __enter__(self) -> PortGroup:
+//|         """No-op used by Context Managers."""
+//|         ...
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes the hardware when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+STATIC mp_obj_t digitalio_portgroup_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_digitalio_portgroup_deinit(MP_OBJ_TO_PTR(args[0]));
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(digitalio_portgroup_obj___exit___obj, 4, 4, digitalio_portgroup_obj___exit__);
+
+STATIC inline void check_for_deinit(digitalio_portgroup_obj_t *self) {
+    if (common_hal_digitalio_portgroup_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+//|     def switch_to_output(self, value: int = 0) -> None:
+//|         """Set the values and then switch all of the pins to push-pull outputs.
+//|
+//|         :param int value: default values to set upon switching
+//|         """
+//|         ...
+STATIC mp_obj_t digitalio_portgroup_switch_to_output(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_value };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_value, MP_ARG_OBJ, {.u_obj = MP_OBJ_NEW_SMALL_INT(0)} },
+    };
+    digitalio_portgroup_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    uint32_t value = mp_obj_get_int_truncated(args[ARG_value].u_obj);
+    digitalio_digitalinout_check_result(common_hal_digitalio_portgroup_switch_to_output(self, value));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(digitalio_portgroup_switch_to_output_obj, 1, digitalio_portgroup_switch_to_output);
+
+//|     def switch_to_input(self, pull: Optional[Pull] = None) -> None:
+//|         """Set the pull and then switch all of the pins to read in digital values.
+//|
+//|         :param Pull pull: pull configuration for the inputs"""
+//|         ...
+STATIC mp_obj_t digitalio_portgroup_switch_to_input(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_pull };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_pull, MP_ARG_OBJ, {.u_rom_obj = mp_const_none} },
+    };
+    digitalio_portgroup_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    digitalio_digitalinout_check_result(common_hal_digitalio_portgroup_switch_to_input(self, validate_pull(args[ARG_pull].u_rom_obj, MP_QSTR_pull)));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(digitalio_portgroup_switch_to_input_obj, 1, digitalio_portgroup_switch_to_input);
+
+//|     direction: Direction
+//|     """The direction of the pins.
+//|
+//|     Setting this will use the defaults from the corresponding
+//|     :py:meth:`switch_to_input` or :py:meth:`switch_to_output` method."""
+STATIC mp_obj_t digitalio_portgroup_obj_get_direction(mp_obj_t self_in) {
+    digitalio_portgroup_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    if (common_hal_digitalio_portgroup_get_output(self)) {
+        return MP_OBJ_FROM_PTR(&digitalio_direction_output_obj);
+    }
+    return MP_OBJ_FROM_PTR(&digitalio_direction_input_obj);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(digitalio_portgroup_get_direction_obj, digitalio_portgroup_obj_get_direction);
+
+STATIC mp_obj_t digitalio_portgroup_obj_set_direction(mp_obj_t self_in, mp_obj_t value) {
+    digitalio_portgroup_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    if (value == MP_ROM_PTR(&digitalio_direction_input_obj)) {
+        digitalio_digitalinout_check_result(common_hal_digitalio_portgroup_switch_to_input(self, PULL_NONE));
+    } else if (value == MP_ROM_PTR(&digitalio_direction_output_obj)) {
+        digitalio_digitalinout_check_result(common_hal_digitalio_portgroup_switch_to_output(self, 0));
+    } else {
+        mp_arg_error_invalid(MP_QSTR_direction);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(digitalio_portgroup_set_direction_obj, digitalio_portgroup_obj_set_direction);
+
+MP_PROPERTY_GETSET(digitalio_portgroup_direction_obj,
+    (mp_obj_t)&digitalio_portgroup_get_direction_obj,
+    (mp_obj_t)&digitalio_portgroup_set_direction_obj);
+
+//|     value: int
+//|     """The digital logic levels of the pins, packed with bit ``i`` for ``pins[i]``.
+//|     Outputs read back the value they were last set to. Bits beyond the number
+//|     of pins are ignored when setting."""
+//|
+STATIC mp_obj_t digitalio_portgroup_obj_get_value(mp_obj_t self_in) {
+    digitalio_portgroup_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_digitalio_portgroup_get_value(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(digitalio_portgroup_get_value_obj, digitalio_portgroup_obj_get_value);
+
+STATIC mp_obj_t digitalio_portgroup_obj_set_value(mp_obj_t self_in, mp_obj_t value) {
+    digitalio_portgroup_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    if (!common_hal_digitalio_portgroup_get_output(self)) {
+        mp_raise_AttributeError(MP_ERROR_TEXT("Cannot set value when direction is input."));
+        return mp_const_none;
+    }
+    common_hal_digitalio_portgroup_set_value(self, mp_obj_get_int_truncated(value));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(digitalio_portgroup_set_value_obj, digitalio_portgroup_obj_set_value);
+
+MP_PROPERTY_GETSET(digitalio_portgroup_value_obj,
+    (mp_obj_t)&digitalio_portgroup_get_value_obj,
+    (mp_obj_t)&digitalio_portgroup_set_value_obj);
+
+STATIC const mp_rom_map_elem_t digitalio_portgroup_locals_dict_table[] = {
+    // instance methods
+    { MP_ROM_QSTR(MP_QSTR_deinit),             MP_ROM_PTR(&digitalio_portgroup_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__),          MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__),           MP_ROM_PTR(&digitalio_portgroup_obj___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_switch_to_output),   MP_ROM_PTR(&digitalio_portgroup_switch_to_output_obj) },
+    { MP_ROM_QSTR(MP_QSTR_switch_to_input),    MP_ROM_PTR(&digitalio_portgroup_switch_to_input_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_direction),          MP_ROM_PTR(&digitalio_portgroup_direction_obj) },
+    { MP_ROM_QSTR(MP_QSTR_value),              MP_ROM_PTR(&digitalio_portgroup_value_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(digitalio_portgroup_locals_dict, digitalio_portgroup_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    digitalio_portgroup_type,
+    MP_QSTR_PortGroup,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, digitalio_portgroup_make_new,
+    locals_dict, &digitalio_portgroup_locals_dict
+    );
+
+#endif // CIRCUITPY_DIGITALIO_PORTGROUP
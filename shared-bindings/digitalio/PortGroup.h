@@ -0,0 +1,42 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "common-hal/microcontroller/Pin.h"
+#include "shared-bindings/digitalio/DigitalInOut.h"
+#include "shared-module/digitalio/PortGroup.h"
+
+extern const mp_obj_type_t digitalio_portgroup_type;
+
+void common_hal_digitalio_portgroup_construct(digitalio_portgroup_obj_t *self, mp_uint_t num_pins, const mcu_pin_obj_t *pins[]);
+void common_hal_digitalio_portgroup_deinit(digitalio_portgroup_obj_t *self);
+bool common_hal_digitalio_portgroup_deinited(digitalio_portgroup_obj_t *self);
+digitalinout_result_t common_hal_digitalio_portgroup_switch_to_input(digitalio_portgroup_obj_t *self, digitalio_pull_t pull);
+digitalinout_result_t common_hal_digitalio_portgroup_switch_to_output(digitalio_portgroup_obj_t *self, uint32_t value);
+bool common_hal_digitalio_portgroup_get_output(digitalio_portgroup_obj_t *self);
+uint32_t common_hal_digitalio_portgroup_get_value(digitalio_portgroup_obj_t *self);
+void common_hal_digitalio_portgroup_set_value(digitalio_portgroup_obj_t *self, uint32_t value);
@@ -34,6 +34,7 @@
 #include "shared-bindings/digitalio/DigitalInOut.h"
 #include "shared-bindings/digitalio/Direction.h"
 #include "shared-bindings/digitalio/DriveMode.h"
+#include "shared-bindings/digitalio/PortGroup.h"
 #include "shared-bindings/digitalio/Pull.h"
 
 #include "py/runtime.h"
@@ -83,6 +84,9 @@
 STATIC const mp_rom_map_elem_t digitalio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_digitalio) },
     { MP_ROM_QSTR(MP_QSTR_DigitalInOut),  MP_ROM_PTR(&digitalio_digitalinout_type) },
+    #if CIRCUITPY_DIGITALIO_PORTGROUP
+    { MP_ROM_QSTR(MP_QSTR_PortGroup),     MP_ROM_PTR(&digitalio_portgroup_type) },
+    #endif
 
     // Enum-like Classes.
     { MP_ROM_QSTR(MP_QSTR_Direction),          MP_ROM_PTR(&digitalio_direction_type) },
@@ -0,0 +1,81 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/displayio/DisplayStats.h"
+
+#include "py/obj.h"
+
+//| class DisplayStats:
+//|     """Refresh timing and counters for a display. Times are in microseconds and all values
+//|     other than `frames`, `skipped_frames` and `average_frame_us` describe the most recent frame."""
+//|
+//|     frames: int
+//|     """Number of refreshes finished since the display was created"""
+//|
+//|     skipped_frames: int
+//|     """Number of refreshes that didn't start because the display bus was busy"""
+//|
+//|     frame_us: int
+//|     """Time from the start to the end of the last refresh"""
+//|
+//|     average_frame_us: int
+//|     """Moving average of the refresh time over roughly the last eight frames"""
+//|
+//|     refresh_areas: int
+//|     """Number of areas that were updated"""
+//|
+//|     refresh_areas_us: int
+//|     """Time spent finding the areas that changed"""
+//|
+//|     fill_us: int
+//|     """Time spent rendering pixels"""
+//|
+//|     transmit_us: int
+//|     """Time spent sending pixels to the display or framebuffer"""
+//|
+//|     pixels: int
+//|     """Number of pixels rendered"""
+//|
+//|     bytes: int
+//|     """Number of bytes sent"""
+//|
+
+const mp_obj_namedtuple_type_t displayio_displaystats_type_obj = {
+    NAMEDTUPLE_TYPE_BASE_AND_SLOTS(MP_QSTR_DisplayStats),
+    .n_fields = 10,
+    .fields = {
+        MP_QSTR_frames,
+        MP_QSTR_skipped_frames,
+        MP_QSTR_frame_us,
+        MP_QSTR_average_frame_us,
+        MP_QSTR_refresh_areas,
+        MP_QSTR_refresh_areas_us,
+        MP_QSTR_fill_us,
+        MP_QSTR_transmit_us,
+        MP_QSTR_pixels,
+        MP_QSTR_bytes,
+    },
+};
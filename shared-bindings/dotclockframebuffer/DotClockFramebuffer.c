@@ -301,9 +301,8 @@ STATIC mp_int_t dotclockframebuffer_framebuffer_get_buffer(mp_obj_t self_in, mp_
 // These version exists so that the prototype matches the protocol,
 // avoiding a type cast that can hide errors
 STATIC void dotclockframebuffer_framebuffer_swapbuffers(mp_obj_t self_in, uint8_t *dirty_row_bitmap) {
-    (void)dirty_row_bitmap;
     dotclockframebuffer_framebuffer_obj_t *self = (dotclockframebuffer_framebuffer_obj_t *)self_in;
-    common_hal_dotclockframebuffer_framebuffer_refresh(self);
+    common_hal_dotclockframebuffer_framebuffer_refresh_rows(self, dirty_row_bitmap);
 }
 
 STATIC void dotclockframebuffer_framebuffer_deinit_proto(mp_obj_t self_in) {
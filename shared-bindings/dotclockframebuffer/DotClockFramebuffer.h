@@ -58,3 +58,4 @@ mp_int_t common_hal_dotclockframebuffer_framebuffer_get_refresh_rate(dotclockfra
 mp_int_t common_hal_dotclockframebuffer_framebuffer_get_row_stride(dotclockframebuffer_framebuffer_obj_t *self);
 mp_int_t common_hal_dotclockframebuffer_framebuffer_get_first_pixel_offset(dotclockframebuffer_framebuffer_obj_t *self);
 void common_hal_dotclockframebuffer_framebuffer_refresh(dotclockframebuffer_framebuffer_obj_t *self);
+void common_hal_dotclockframebuffer_framebuffer_refresh_rows(dotclockframebuffer_framebuffer_obj_t *self, uint8_t *dirty_row_bitmask);
@@ -26,6 +26,8 @@
 
 #include "shared-bindings/dualbank/__init__.h"
 
+#include "py/stream.h"
+
 #if CIRCUITPY_STORAGE_EXTEND
 #include "supervisor/flash.h"
 #endif
@@ -63,6 +65,18 @@
 //|
 //|     dualbank.flash(buffer, offset)
 //|     dualbank.switch()
+//|
+//| Firmware can also be written straight from a file or socket, and checked
+//| against its expected hash before switching:
+//|
+//| .. code-block:: python
+//|
+//|     import dualbank
+//|
+//|     with open("firmware.bin", "rb") as f:
+//|         dualbank.flash_from(f)
+//|     if dualbank.sha256() == expected_sha256:
+//|         dualbank.switch()
 //| """
 //| ...
 //|
@@ -111,6 +125,93 @@ STATIC mp_obj_t dualbank_flash(size_t n_args, const mp_obj_t *pos_args, mp_map_t
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(dualbank_flash_obj, 0, dualbank_flash);
 
+// One flash sector per read.
+#define DUALBANK_STREAM_BLOCK_SIZE (4096)
+
+//| def flash_from(
+//|     stream: circuitpython_typing.ByteStream, length: int = -1, *, offset: int = 0
+//| ) -> int:
+//|     """Writes one of the two app partitions with data read from ``stream``, such as
+//|     an open file or a connected socket, without needing a buffer in Python.
+//|
+//|     Data is read and written a flash sector at a time until ``length`` bytes have
+//|     been written or the stream ends.
+//|
+//|     :param ~circuitpython_typing.ByteStream stream: The stream to read the firmware from.
+//|     :param int length: The number of bytes to write, or -1 to write until the stream ends.
+//|     :param int offset: Start writing at this offset in the app partition. As with
+//|         `flash()`, 0 continues after the data already written.
+//|     :return: The number of bytes written.
+//|     """
+//|     ...
+//|
+STATIC mp_obj_t dualbank_flash_from(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_stream, ARG_length, ARG_offset };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_stream, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_length, MP_ARG_INT, {.u_int = -1} },
+        { MP_QSTR_offset, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+    };
+
+    #if CIRCUITPY_STORAGE_EXTEND
+    raise_error_if_storage_extended();
+    #endif
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if (args[ARG_offset].u_int < 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("offset must be >= 0"));
+    }
+    mp_obj_t stream = args[ARG_stream].u_obj;
+    mp_get_stream_raise(stream, MP_STREAM_OP_READ);
+    size_t remaining = args[ARG_length].u_int < 0 ? SIZE_MAX : (size_t)args[ARG_length].u_int;
+    size_t offset = args[ARG_offset].u_int;
+
+    uint8_t *buf = m_new(uint8_t, DUALBANK_STREAM_BLOCK_SIZE);
+    size_t total = 0;
+    while (remaining > 0) {
+        int errcode;
+        mp_uint_t len = mp_stream_read_exactly(stream, buf, MIN(remaining, DUALBANK_STREAM_BLOCK_SIZE), &errcode);
+        if (errcode != 0) {
+            mp_raise_OSError(errcode);
+        }
+        if (len == 0) {
+            break;
+        }
+        common_hal_dualbank_flash(buf, len, offset == 0 ? 0 : offset + total);
+        total += len;
+        remaining -= len;
+        if (len < DUALBANK_STREAM_BLOCK_SIZE) {
+            // A short read means the stream has ended.
+            break;
+        }
+    }
+    m_del(uint8_t, buf, DUALBANK_STREAM_BLOCK_SIZE);
+
+    return mp_obj_new_int_from_uint(total);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(dualbank_flash_from_obj, 1, dualbank_flash_from);
+
+//| def sha256() -> bytes:
+//|     """Returns the SHA-256 hash of the firmware written since the last `switch()`.
+//|
+//|     The hash is computed in hardware as the data is written, so the image doesn't
+//|     need to be read back or hashed separately in Python.
+//|
+//|     :raises RuntimeError: if nothing has been written or the data was not written in order.
+//|     """
+//|     ...
+//|
+STATIC mp_obj_t dualbank_sha256(void) {
+    uint8_t digest[32];
+    if (!common_hal_dualbank_get_sha256(digest)) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Firmware was not written in order"));
+    }
+    return mp_obj_new_bytes(digest, sizeof(digest));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(dualbank_sha256_obj, dualbank_sha256);
+
 //| def switch() -> None:
 //|     """Switches to the next-update partition.
 //|
@@ -132,6 +233,8 @@ STATIC const mp_rom_map_elem_t dualbank_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_dualbank) },
     // module functions
     { MP_ROM_QSTR(MP_QSTR_flash), MP_ROM_PTR(&dualbank_flash_obj) },
+    { MP_ROM_QSTR(MP_QSTR_flash_from), MP_ROM_PTR(&dualbank_flash_from_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sha256), MP_ROM_PTR(&dualbank_sha256_obj) },
     { MP_ROM_QSTR(MP_QSTR_switch), MP_ROM_PTR(&dualbank_switch_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(dualbank_module_globals, dualbank_module_globals_table);
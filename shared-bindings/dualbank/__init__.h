@@ -31,5 +31,7 @@
 
 extern void common_hal_dualbank_switch(void);
 extern void common_hal_dualbank_flash(const void *buf, const size_t len, const size_t offset);
+// Returns false unless everything since the last switch was written in order from the start.
+extern bool common_hal_dualbank_get_sha256(uint8_t digest[32]);
 
 #endif  // MICROPY_INCLUDED_SHARED_BINDINGS_DUALBANK___INIT___H
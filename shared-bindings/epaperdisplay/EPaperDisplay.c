@@ -82,7 +82,10 @@
 //|         advanced_color_epaper: bool = False,
 //|         two_byte_sequence_length: bool = False,
 //|         start_up_time: float = 0,
-//|         address_little_endian: bool = False
+//|         address_little_endian: bool = False,
+//|         partial_refresh_display_command: Optional[Union[int, circuitpython_typing.ReadableBuffer]] = None,
+//|         partial_lut_sequence: ReadableBuffer = b"",
+//|         partial_refresh_limit: int = 10
 //|     ) -> None:
 //|         """Create a EPaperDisplay object on the given display bus (`fourwire.FourWire` or `paralleldisplaybus.ParallelBus`).
 //|
@@ -125,8 +128,29 @@
 //|         :param bool two_byte_sequence_length: When true, use two bytes to define sequence length
 //|         :param float start_up_time: Time to wait after reset before sending commands
 //|         :param bool address_little_endian: Send the least significant byte (not bit) of multi-byte addresses first. Ignored when ram is addressed with one byte
+//|         :param int partial_refresh_display_command: Command used to start a partial refresh. Single int or byte-packed command sequence. When provided, only the changed areas are written and refreshed with this command instead of ``refresh_display_command``. Requires ``set_row_window_command``.
+//|         :param ~circuitpython_typing.ReadableBuffer partial_lut_sequence: Byte-packed command sequence sent after the ``start_sequence`` to load the partial refresh waveform. The display is kept awake between partial refreshes so this is only sent again after a full refresh.
+//|         :param int partial_refresh_limit: Number of partial refreshes before a full refresh is done to clear ghosting. 0 never forces a full refresh.
 //|         """
 //|         ...
+// Accepts a single command byte or a byte-packed command sequence.
+STATIC size_t get_refresh_sequence(mp_obj_t refresh_obj, bool two_byte_sequence_length, qstr arg_name, const uint8_t **refresh_buf) {
+    mp_buffer_info_t refresh_bufinfo;
+    mp_int_t refresh_command;
+    if (mp_obj_get_int_maybe(refresh_obj, &refresh_command)) {
+        uint8_t *command_buf = m_malloc(3);
+        command_buf[0] = refresh_command;
+        command_buf[1] = 0;
+        command_buf[2] = 0;
+        *refresh_buf = command_buf;
+        return two_byte_sequence_length? 3: 2;
+    } else if (mp_get_buffer(refresh_obj, &refresh_bufinfo, MP_BUFFER_READ)) {
+        *refresh_buf = refresh_bufinfo.buf;
+        return refresh_bufinfo.len;
+    }
+    mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), arg_name);
+}
+
 STATIC mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
     enum { ARG_display_bus, ARG_start_sequence, ARG_stop_sequence, ARG_width, ARG_height,
            ARG_ram_width, ARG_ram_height, ARG_colstart, ARG_rowstart, ARG_rotation,
@@ -135,7 +159,8 @@ STATIC mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type,
            ARG_write_color_ram_command, ARG_color_bits_inverted, ARG_highlight_color,
            ARG_refresh_display_command,  ARG_refresh_time, ARG_busy_pin, ARG_busy_state,
            ARG_seconds_per_frame, ARG_always_toggle_chip_select, ARG_grayscale, ARG_advanced_color_epaper,
-           ARG_two_byte_sequence_length, ARG_start_up_time, ARG_address_little_endian };
+           ARG_two_byte_sequence_length, ARG_start_up_time, ARG_address_little_endian,
+           ARG_partial_refresh_display_command, ARG_partial_lut_sequence, ARG_partial_refresh_limit };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_display_bus, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_start_sequence, MP_ARG_REQUIRED | MP_ARG_OBJ },
@@ -167,6 +192,9 @@ STATIC mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type,
         { MP_QSTR_two_byte_sequence_length, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
         { MP_QSTR_start_up_time, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NEW_SMALL_INT(0)} },
         { MP_QSTR_address_little_endian, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+        { MP_QSTR_partial_refresh_display_command, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_partial_lut_sequence, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_empty_bytes} },
+        { MP_QSTR_partial_refresh_limit, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 10} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -201,24 +229,19 @@ STATIC mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type,
 
     bool two_byte_sequence_length = args[ARG_two_byte_sequence_length].u_bool;
 
-    mp_obj_t refresh_obj = args[ARG_refresh_display_command].u_obj;
     const uint8_t *refresh_buf;
-    mp_buffer_info_t refresh_bufinfo;
-    size_t refresh_buf_len = 0;
-    mp_int_t refresh_command;
-    if (mp_obj_get_int_maybe(refresh_obj, &refresh_command)) {
-        uint8_t *command_buf = m_malloc(3);
-        command_buf[0] = refresh_command;
-        command_buf[1] = 0;
-        command_buf[2] = 0;
-        refresh_buf = command_buf;
-        refresh_buf_len = two_byte_sequence_length? 3: 2;
-    } else if (mp_get_buffer(refresh_obj, &refresh_bufinfo, MP_BUFFER_READ)) {
-        refresh_buf = refresh_bufinfo.buf;
-        refresh_buf_len = refresh_bufinfo.len;
-    } else {
-        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_refresh_display_command);
+    size_t refresh_buf_len = get_refresh_sequence(args[ARG_refresh_display_command].u_obj,
+        two_byte_sequence_length, MP_QSTR_refresh_display_command, &refresh_buf);
+
+    const uint8_t *partial_refresh_buf = NULL;
+    size_t partial_refresh_buf_len = 0;
+    if (args[ARG_partial_refresh_display_command].u_obj != mp_const_none) {
+        partial_refresh_buf_len = get_refresh_sequence(args[ARG_partial_refresh_display_command].u_obj,
+            two_byte_sequence_length, MP_QSTR_partial_refresh_display_command, &partial_refresh_buf);
     }
+    mp_buffer_info_t partial_lut_bufinfo;
+    mp_get_buffer_raise(args[ARG_partial_lut_sequence].u_obj, &partial_lut_bufinfo, MP_BUFFER_READ);
+    mp_int_t partial_refresh_limit = mp_arg_validate_int_range(args[ARG_partial_refresh_limit].u_int, 0, 0xffff, MP_QSTR_partial_refresh_limit);
 
     self->base.type = &epaperdisplay_epaperdisplay_type;
     common_hal_epaperdisplay_epaperdisplay_construct(
@@ -235,6 +258,9 @@ STATIC mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type,
         args[ARG_always_toggle_chip_select].u_bool, args[ARG_grayscale].u_bool, args[ARG_advanced_color_epaper].u_bool,
         two_byte_sequence_length, args[ARG_address_little_endian].u_bool
         );
+    common_hal_epaperdisplay_epaperdisplay_set_partial_refresh(self,
+        partial_lut_bufinfo.buf, partial_lut_bufinfo.len,
+        partial_refresh_buf, partial_refresh_buf_len, partial_refresh_limit);
 
     return self;
 }
@@ -369,6 +395,18 @@ MP_DEFINE_CONST_FUN_OBJ_1(epaperdisplay_epaperdisplay_get_bus_obj, epaperdisplay
 MP_PROPERTY_GETTER(epaperdisplay_epaperdisplay_bus_obj,
     (mp_obj_t)&epaperdisplay_epaperdisplay_get_bus_obj);
 
+//|     stats: displayio.DisplayStats
+//|     """Refresh timing and counters for the most recent frame. Cheap enough to read every frame."""
+//|
+STATIC mp_obj_t epaperdisplay_epaperdisplay_obj_get_stats(mp_obj_t self_in) {
+    epaperdisplay_epaperdisplay_obj_t *self = native_display(self_in);
+    return common_hal_epaperdisplay_epaperdisplay_get_stats(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(epaperdisplay_epaperdisplay_get_stats_obj, epaperdisplay_epaperdisplay_obj_get_stats);
+
+MP_PROPERTY_GETTER(epaperdisplay_epaperdisplay_stats_obj,
+    (mp_obj_t)&epaperdisplay_epaperdisplay_get_stats_obj);
+
 //|     root_group: displayio.Group
 //|     """The root group on the epaper display.
 //|     If the root group is set to `displayio.CIRCUITPYTHON_TERMINAL`, the default CircuitPython terminal will be shown.
@@ -406,6 +444,7 @@ STATIC const mp_rom_map_elem_t epaperdisplay_epaperdisplay_locals_dict_table[] =
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&epaperdisplay_epaperdisplay_height_obj) },
     { MP_ROM_QSTR(MP_QSTR_rotation), MP_ROM_PTR(&epaperdisplay_epaperdisplay_rotation_obj) },
     { MP_ROM_QSTR(MP_QSTR_bus), MP_ROM_PTR(&epaperdisplay_epaperdisplay_bus_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&epaperdisplay_epaperdisplay_stats_obj) },
     { MP_ROM_QSTR(MP_QSTR_busy), MP_ROM_PTR(&epaperdisplay_epaperdisplay_busy_obj) },
     { MP_ROM_QSTR(MP_QSTR_time_to_refresh), MP_ROM_PTR(&epaperdisplay_epaperdisplay_time_to_refresh_obj) },
     { MP_ROM_QSTR(MP_QSTR_root_group), MP_ROM_PTR(&epaperdisplay_epaperdisplay_root_group_obj) },
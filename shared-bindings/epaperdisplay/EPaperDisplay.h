@@ -49,6 +49,11 @@ void common_hal_epaperdisplay_epaperdisplay_construct(epaperdisplay_epaperdispla
     bool always_toggle_chip_select, bool grayscale, bool acep, bool two_byte_sequence_length,
     bool address_little_endian);
 
+void common_hal_epaperdisplay_epaperdisplay_set_partial_refresh(epaperdisplay_epaperdisplay_obj_t *self,
+    const uint8_t *partial_lut_sequence, uint16_t partial_lut_sequence_len,
+    const uint8_t *partial_refresh_sequence, uint16_t partial_refresh_sequence_len,
+    uint16_t partial_refresh_limit);
+
 bool common_hal_epaperdisplay_epaperdisplay_refresh(epaperdisplay_epaperdisplay_obj_t *self);
 
 mp_obj_t common_hal_epaperdisplay_epaperdisplay_get_root_group(epaperdisplay_epaperdisplay_obj_t *self);
@@ -64,3 +69,4 @@ uint16_t common_hal_epaperdisplay_epaperdisplay_get_rotation(epaperdisplay_epape
 void common_hal_epaperdisplay_epaperdisplay_set_rotation(epaperdisplay_epaperdisplay_obj_t *self, int rotation);
 
 mp_obj_t common_hal_epaperdisplay_epaperdisplay_get_bus(epaperdisplay_epaperdisplay_obj_t *self);
+mp_obj_t common_hal_epaperdisplay_epaperdisplay_get_stats(epaperdisplay_epaperdisplay_obj_t *self);
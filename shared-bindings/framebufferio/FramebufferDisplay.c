@@ -261,6 +261,17 @@ MP_DEFINE_CONST_FUN_OBJ_1(framebufferio_framebufferdisplay_get_framebuffer_obj,
 MP_PROPERTY_GETTER(framebufferio_framebufferframebuffer_obj,
     (mp_obj_t)&framebufferio_framebufferdisplay_get_framebuffer_obj);
 
+//|     stats: displayio.DisplayStats
+//|     """Refresh timing and counters for the most recent frame. Cheap enough to read every frame."""
+STATIC mp_obj_t framebufferio_framebufferdisplay_obj_get_stats(mp_obj_t self_in) {
+    framebufferio_framebufferdisplay_obj_t *self = native_display(self_in);
+    return common_hal_framebufferio_framebufferdisplay_get_stats(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(framebufferio_framebufferdisplay_get_stats_obj, framebufferio_framebufferdisplay_obj_get_stats);
+
+MP_PROPERTY_GETTER(framebufferio_framebufferdisplay_stats_obj,
+    (mp_obj_t)&framebufferio_framebufferdisplay_get_stats_obj);
+
 
 //|     def fill_row(self, y: int, buffer: WriteableBuffer) -> WriteableBuffer:
 //|         """Extract the pixels from a single row
@@ -367,6 +378,7 @@ STATIC const mp_rom_map_elem_t framebufferio_framebufferdisplay_locals_dict_tabl
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&framebufferio_framebufferdisplay_height_obj) },
     { MP_ROM_QSTR(MP_QSTR_rotation), MP_ROM_PTR(&framebufferio_framebufferdisplay_rotation_obj) },
     { MP_ROM_QSTR(MP_QSTR_framebuffer), MP_ROM_PTR(&framebufferio_framebufferframebuffer_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&framebufferio_framebufferdisplay_stats_obj) },
     { MP_ROM_QSTR(MP_QSTR_root_group), MP_ROM_PTR(&framebufferio_framebufferdisplay_root_group_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(framebufferio_framebufferdisplay_locals_dict, framebufferio_framebufferdisplay_locals_dict_table);
@@ -57,6 +57,7 @@ mp_float_t common_hal_framebufferio_framebufferdisplay_get_brightness(framebuffe
 bool common_hal_framebufferio_framebufferdisplay_set_brightness(framebufferio_framebufferdisplay_obj_t *self, mp_float_t brightness);
 
 mp_obj_t common_hal_framebufferio_framebufferdisplay_framebuffer(framebufferio_framebufferdisplay_obj_t *self);
+mp_obj_t common_hal_framebufferio_framebufferdisplay_get_stats(framebufferio_framebufferdisplay_obj_t *self);
 
 mp_obj_t common_hal_framebufferio_framebufferdisplay_get_root_group(framebufferio_framebufferdisplay_obj_t *self);
 mp_obj_t common_hal_framebufferio_framebufferdisplay_set_root_group(framebufferio_framebufferdisplay_obj_t *self, displayio_group_t *root_group);
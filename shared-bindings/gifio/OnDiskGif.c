@@ -225,7 +225,11 @@ MP_PROPERTY_GETTER(gifio_ondiskgif_palette_obj,
     (mp_obj_t)&gifio_ondiskgif_get_palette_obj);
 
 //|     def next_frame(self) -> float:
-//|         """Loads the next frame. Returns expected delay before the next frame in seconds."""
+//|         """Loads the next frame. Returns expected delay before the next frame in seconds.
+//|
+//|         Only the part of `bitmap` that the frame changes is marked for refresh.
+//|         Frames using the "restore to background" disposal method are cleared
+//|         to the background before the following frame is drawn."""
 STATIC mp_obj_t gifio_ondiskgif_obj_next_frame(mp_obj_t self_in) {
     gifio_ondiskgif_t *self = MP_OBJ_TO_PTR(self_in);
 
@@ -204,11 +204,87 @@ STATIC mp_obj_t i2ctarget_i2c_target_request(size_t n_args, const mp_obj_t *pos_
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(i2ctarget_i2c_target_request_obj, 1, i2ctarget_i2c_target_request);
 
+//|     def serve_registers(
+//|         self, registers: Optional[WriteableBuffer], *, first_register: int = 0, notify: bool = False
+//|     ) -> None:
+//|         """Answer the host from a register map instead of with `request`.
+//|
+//|         The first byte of each write from the host selects a register. The rest of the write is
+//|         stored in that register and the ones after it. Reads return the selected register and
+//|         the ones after it. This is done in an interrupt handler, so the host is answered within
+//|         microseconds even while Python is busy. Registers outside ``registers`` read as 0xff
+//|         and ignore writes.
+//|
+//|         `request` can't be used while registers are served. Not all ports support this.
+//|
+//|         :param ~circuitpython_typing.WriteableBuffer registers: One byte per register. Python may
+//|           change it at any time. ``None`` stops serving registers.
+//|         :param int first_register: The register number of ``registers[0]``
+//|         :param bool notify: Record each write from the host so that `written` can return it"""
+//|         ...
+STATIC mp_obj_t i2ctarget_i2c_target_serve_registers(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    mp_check_self(mp_obj_is_type(pos_args[0], &i2ctarget_i2c_target_type));
+    i2ctarget_i2c_target_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    if (common_hal_i2ctarget_i2c_target_deinited(self)) {
+        raise_deinited_error();
+    }
+    enum { ARG_registers, ARG_first_register, ARG_notify };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_registers,      MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_first_register, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_notify,         MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t registers_obj = args[ARG_registers].u_obj;
+    if (registers_obj == mp_const_none) {
+        common_hal_i2ctarget_i2c_target_serve_registers(self, mp_const_none, NULL, 0, 0, false);
+        return mp_const_none;
+    }
+
+    mp_int_t first_register = mp_arg_validate_int_range(args[ARG_first_register].u_int, 0, 0xff, MP_QSTR_first_register);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(registers_obj, &bufinfo, MP_BUFFER_WRITE);
+    mp_arg_validate_length_range(bufinfo.len, 1, 0x100 - first_register, MP_QSTR_registers);
+
+    common_hal_i2ctarget_i2c_target_serve_registers(self, registers_obj, bufinfo.buf, bufinfo.len,
+        first_register, args[ARG_notify].u_bool);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(i2ctarget_i2c_target_serve_registers_obj, 1, i2ctarget_i2c_target_serve_registers);
+
+//|     def written(self) -> Optional[Tuple[int, int]]:
+//|         """Return the oldest write from the host that hasn't been returned yet, as
+//|         ``(first_register, length)``. Return None when there isn't one.
+//|
+//|         Writes are only recorded after ``serve_registers(..., notify=True)``. Up to 7 are
+//|         kept, and later writes aren't recorded until some are returned."""
+//|         ...
+//|
+STATIC mp_obj_t i2ctarget_i2c_target_written(mp_obj_t self_in) {
+    mp_check_self(mp_obj_is_type(self_in, &i2ctarget_i2c_target_type));
+    i2ctarget_i2c_target_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (common_hal_i2ctarget_i2c_target_deinited(self)) {
+        raise_deinited_error();
+    }
+    uint8_t first_register;
+    size_t length;
+    if (!common_hal_i2ctarget_i2c_target_pop_write(self, &first_register, &length)) {
+        return mp_const_none;
+    }
+    mp_obj_t items[2] = { MP_OBJ_NEW_SMALL_INT(first_register), MP_OBJ_NEW_SMALL_INT(length) };
+    return mp_obj_new_tuple(2, items);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(i2ctarget_i2c_target_written_obj, i2ctarget_i2c_target_written);
+
 STATIC const mp_rom_map_elem_t i2ctarget_i2c_target_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&i2ctarget_i2c_target_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&i2ctarget_i2c_target___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_request), MP_ROM_PTR(&i2ctarget_i2c_target_request_obj) },
+    { MP_ROM_QSTR(MP_QSTR_serve_registers), MP_ROM_PTR(&i2ctarget_i2c_target_serve_registers_obj) },
+    { MP_ROM_QSTR(MP_QSTR_written), MP_ROM_PTR(&i2ctarget_i2c_target_written_obj) },
 
 };
 
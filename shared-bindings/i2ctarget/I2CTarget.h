@@ -57,4 +57,10 @@ extern int common_hal_i2ctarget_i2c_target_write_byte(i2ctarget_i2c_target_obj_t
 extern void common_hal_i2ctarget_i2c_target_ack(i2ctarget_i2c_target_obj_t *self, bool ack);
 extern void common_hal_i2ctarget_i2c_target_close(i2ctarget_i2c_target_obj_t *self);
 
+// registers is NULL to go back to answering requests from Python.
+extern void common_hal_i2ctarget_i2c_target_serve_registers(i2ctarget_i2c_target_obj_t *self,
+    mp_obj_t registers_obj, uint8_t *registers, size_t length, uint8_t first_register, bool notify);
+extern bool common_hal_i2ctarget_i2c_target_pop_write(i2ctarget_i2c_target_obj_t *self,
+    uint8_t *first_register, size_t *length);
+
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_BUSIO_I2C_TARGET_H
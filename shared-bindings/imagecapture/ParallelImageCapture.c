@@ -25,6 +25,7 @@
  */
 
 #include "py/obj.h"
+#include "py/objproperty.h"
 #include "py/runtime.h"
 
 #include "shared/runtime/context_manager_helpers.h"
@@ -97,27 +98,39 @@ STATIC mp_obj_t imagecapture_parallelimagecapture_capture(mp_obj_t self_in, mp_o
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(imagecapture_parallelimagecapture_capture_obj, imagecapture_parallelimagecapture_capture);
 
 //|     def continuous_capture_start(
-//|         self, buffer1: WriteableBuffer, buffer2: WriteableBuffer, /
+//|         self, buffer1: WriteableBuffer, buffer2: WriteableBuffer, /, *buffers: WriteableBuffer
 //|     ) -> None:
 //|         """Begin capturing into the given buffers in the background.
 //|
-//|         Call `continuous_capture_get_frame` to get the next available
-//|         frame, and `continuous_capture_stop` to stop capturing.
+//|         The buffers form a ring that the hardware fills in turn. Call
+//|         `continuous_capture_acquire_frame` to take ownership of the oldest
+//|         filled frame and `continuous_capture_release_frame` to hand it back
+//|         for capturing once you are done with it. The hardware never writes
+//|         into an acquired frame. When no free buffer is left, the oldest
+//|         filled frame that is not acquired is reused (the newest one is kept)
+//|         and `dropped_frames` is incremented. With three or more buffers one
+//|         frame can be processed while capture continues without gaps.
+//|
+//|         `continuous_capture_get_frame` is a simpler alternative that
+//|         releases the frame it returned last time before acquiring the next one.
+//|         Call `continuous_capture_stop` to stop capturing.
 //|
 //|         Until `continuous_capture_stop` (or `deinit`) is called, the
-//|         `ParallelImageCapture` object keeps references to ``buffer1`` and
-//|         ``buffer2``, so the objects will not be garbage collected."""
+//|         `ParallelImageCapture` object keeps references to the buffers, so
+//|         the objects will not be garbage collected."""
 //|         ...
-STATIC mp_obj_t imagecapture_parallelimagecapture_continuous_capture_start(mp_obj_t self_in, mp_obj_t buffer1, mp_obj_t buffer2) {
-    imagecapture_parallelimagecapture_obj_t *self = (imagecapture_parallelimagecapture_obj_t *)self_in;
-    common_hal_imagecapture_parallelimagecapture_continuous_capture_start(self, buffer1, buffer2);
+STATIC mp_obj_t imagecapture_parallelimagecapture_continuous_capture_start(size_t n_args, const mp_obj_t *args) {
+    imagecapture_parallelimagecapture_obj_t *self = (imagecapture_parallelimagecapture_obj_t *)args[0];
+    common_hal_imagecapture_parallelimagecapture_continuous_capture_start(self, n_args - 1, args + 1);
 
     return mp_const_none;
 }
-STATIC MP_DEFINE_CONST_FUN_OBJ_3(imagecapture_parallelimagecapture_continuous_capture_start_obj, imagecapture_parallelimagecapture_continuous_capture_start);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR(imagecapture_parallelimagecapture_continuous_capture_start_obj, 3, imagecapture_parallelimagecapture_continuous_capture_start);
 
 //|     def continuous_capture_get_frame(self) -> WriteableBuffer:
-//|         """Return the next available frame, one of the two buffers passed to `continuous_capture_start`"""
+//|         """Return the next available frame, one of the buffers passed to `continuous_capture_start`.
+//|
+//|         The frame returned by the previous call is released back to the capture ring."""
 //|         ...
 STATIC mp_obj_t imagecapture_parallelimagecapture_continuous_capture_get_frame(mp_obj_t self_in) {
     imagecapture_parallelimagecapture_obj_t *self = (imagecapture_parallelimagecapture_obj_t *)self_in;
@@ -125,7 +138,54 @@ STATIC mp_obj_t imagecapture_parallelimagecapture_continuous_capture_get_frame(m
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(imagecapture_parallelimagecapture_continuous_capture_get_frame_obj, imagecapture_parallelimagecapture_continuous_capture_get_frame);
 
+//|     def continuous_capture_acquire_frame(
+//|         self, *, timeout: Optional[float] = None
+//|     ) -> Optional[WriteableBuffer]:
+//|         """Take ownership of the oldest filled frame.
+//|
+//|         Waits up to ``timeout`` seconds for a frame, or forever when ``timeout`` is ``None``.
+//|         Returns ``None`` if no frame was filled in time. The frame is not written
+//|         to again until it is passed to `continuous_capture_release_frame`."""
+//|         ...
+STATIC mp_obj_t imagecapture_parallelimagecapture_continuous_capture_acquire_frame(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_timeout };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_timeout, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    imagecapture_parallelimagecapture_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_float_t timeout = -1;
+    if (args[ARG_timeout].u_obj != mp_const_none) {
+        timeout = mp_arg_validate_obj_float_non_negative(args[ARG_timeout].u_obj, 0, MP_QSTR_timeout);
+    }
+    return common_hal_imagecapture_parallelimagecapture_continuous_capture_acquire_frame(self, timeout);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(imagecapture_parallelimagecapture_continuous_capture_acquire_frame_obj, 1, imagecapture_parallelimagecapture_continuous_capture_acquire_frame);
+
+//|     def continuous_capture_release_frame(self, frame: WriteableBuffer) -> None:
+//|         """Hand a frame from `continuous_capture_acquire_frame` back to the capture ring."""
+//|         ...
+STATIC mp_obj_t imagecapture_parallelimagecapture_continuous_capture_release_frame(mp_obj_t self_in, mp_obj_t frame) {
+    imagecapture_parallelimagecapture_obj_t *self = (imagecapture_parallelimagecapture_obj_t *)self_in;
+    common_hal_imagecapture_parallelimagecapture_continuous_capture_release_frame(self, frame);
+
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(imagecapture_parallelimagecapture_continuous_capture_release_frame_obj, imagecapture_parallelimagecapture_continuous_capture_release_frame);
+
+//|     dropped_frames: int
+//|     """Number of captured frames that were overwritten before they were acquired, since
+//|     `continuous_capture_start` was called. (read-only)"""
+STATIC mp_obj_t imagecapture_parallelimagecapture_get_dropped_frames(mp_obj_t self_in) {
+    imagecapture_parallelimagecapture_obj_t *self = (imagecapture_parallelimagecapture_obj_t *)self_in;
+    return mp_obj_new_int_from_uint(common_hal_imagecapture_parallelimagecapture_get_dropped_frames(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(imagecapture_parallelimagecapture_get_dropped_frames_obj, imagecapture_parallelimagecapture_get_dropped_frames);
 
+MP_PROPERTY_GETTER(imagecapture_parallelimagecapture_dropped_frames_obj,
+    (mp_obj_t)&imagecapture_parallelimagecapture_get_dropped_frames_obj);
 
 //|     def continuous_capture_stop(self) -> None:
 //|         """Stop continuous capture.
@@ -184,6 +244,9 @@ STATIC const mp_rom_map_elem_t imagecapture_parallelimagecapture_locals_dict_tab
     { MP_ROM_QSTR(MP_QSTR_continuous_capture_start), MP_ROM_PTR(&imagecapture_parallelimagecapture_continuous_capture_start_obj) },
     { MP_ROM_QSTR(MP_QSTR_continuous_capture_stop), MP_ROM_PTR(&imagecapture_parallelimagecapture_continuous_capture_stop_obj) },
     { MP_ROM_QSTR(MP_QSTR_continuous_capture_get_frame), MP_ROM_PTR(&imagecapture_parallelimagecapture_continuous_capture_get_frame_obj) },
+    { MP_ROM_QSTR(MP_QSTR_continuous_capture_acquire_frame), MP_ROM_PTR(&imagecapture_parallelimagecapture_continuous_capture_acquire_frame_obj) },
+    { MP_ROM_QSTR(MP_QSTR_continuous_capture_release_frame), MP_ROM_PTR(&imagecapture_parallelimagecapture_continuous_capture_release_frame_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dropped_frames), MP_ROM_PTR(&imagecapture_parallelimagecapture_dropped_frames_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(imagecapture_parallelimagecapture_locals_dict, imagecapture_parallelimagecapture_locals_dict_table);
@@ -191,7 +254,7 @@ STATIC MP_DEFINE_CONST_DICT(imagecapture_parallelimagecapture_locals_dict, image
 MP_DEFINE_CONST_OBJ_TYPE(
     imagecapture_parallelimagecapture_type,
     MP_QSTR_ParallelImageCapture,
-    MP_TYPE_FLAG_NONE,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
     make_new, imagecapture_parallelimagecapture_make_new,
     locals_dict, &imagecapture_parallelimagecapture_locals_dict
     );
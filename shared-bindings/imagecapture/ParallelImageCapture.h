@@ -41,6 +41,10 @@ void common_hal_imagecapture_parallelimagecapture_construct(imagecapture_paralle
 void common_hal_imagecapture_parallelimagecapture_deinit(imagecapture_parallelimagecapture_obj_t *self);
 bool common_hal_imagecapture_parallelimagecapture_deinited(imagecapture_parallelimagecapture_obj_t *self);
 void common_hal_imagecapture_parallelimagecapture_singleshot_capture(imagecapture_parallelimagecapture_obj_t *self, mp_obj_t buffer);
-void common_hal_imagecapture_parallelimagecapture_continuous_capture_start(imagecapture_parallelimagecapture_obj_t *self, mp_obj_t buffer1, mp_obj_t buffer2);
+void common_hal_imagecapture_parallelimagecapture_continuous_capture_start(imagecapture_parallelimagecapture_obj_t *self, size_t n_buffers, const mp_obj_t *buffers);
 void common_hal_imagecapture_parallelimagecapture_continuous_capture_stop(imagecapture_parallelimagecapture_obj_t *self);
 mp_obj_t common_hal_imagecapture_parallelimagecapture_continuous_capture_get_frame(imagecapture_parallelimagecapture_obj_t *self);
+// Returns mp_const_none if no frame was filled within timeout seconds. A negative timeout waits forever.
+mp_obj_t common_hal_imagecapture_parallelimagecapture_continuous_capture_acquire_frame(imagecapture_parallelimagecapture_obj_t *self, mp_float_t timeout);
+void common_hal_imagecapture_parallelimagecapture_continuous_capture_release_frame(imagecapture_parallelimagecapture_obj_t *self, mp_obj_t frame);
+uint32_t common_hal_imagecapture_parallelimagecapture_get_dropped_frames(imagecapture_parallelimagecapture_obj_t *self);
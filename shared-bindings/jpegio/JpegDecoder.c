@@ -33,6 +33,14 @@
 #include "shared-bindings/jpegio/JpegDecoder.h"
 #include "shared-module/jpegio/JpegDecoder.h"
 #include "shared-module/displayio/Bitmap.h"
+#if CIRCUITPY_BUSDISPLAY
+#include "shared-bindings/busdisplay/BusDisplay.h"
+#include "shared-module/busdisplay/BusDisplay.h"
+#endif
+#if CIRCUITPY_FRAMEBUFFERIO
+#include "shared-bindings/framebufferio/FramebufferDisplay.h"
+#include "shared-module/framebufferio/FramebufferDisplay.h"
+#endif
 
 //| class JpegDecoder:
 //|     """A JPEG decoder
@@ -105,7 +113,7 @@ MP_DEFINE_CONST_FUN_OBJ_2(jpegio_jpegdecoder_open_obj, jpegio_jpegdecoder_open);
 
 //|     def decode(
 //|         self,
-//|         bitmap: displayio.Bitmap,
+//|         bitmap: Union[displayio.Bitmap, busdisplay.BusDisplay, framebufferio.FramebufferDisplay],
 //|         scale: int = 0,
 //|         x: int = 0,
 //|         y: int = 0,
@@ -132,11 +140,21 @@ MP_DEFINE_CONST_FUN_OBJ_2(jpegio_jpegdecoder_open_obj, jpegio_jpegdecoder_open);
 //|         higher JPEG encoding quality can help, but ultimately it will not be
 //|         perfect.
 //|
+//|         Instead of a bitmap, a `busdisplay.BusDisplay` or `framebufferio.FramebufferDisplay`
+//|         with a 16-bit color depth may be given. Each row of MCUs (the 8 or 16 pixel
+//|         high blocks JPEG is encoded in) is then sent straight to the display as soon
+//|         as it is decoded, so the image never has to fit in memory as a whole.
+//|         ``x`` and ``y`` are in the display's rotated coordinates. The display's own
+//|         refresh will draw over these pixels wherever its ``root_group`` changes, so
+//|         typically ``root_group`` is ``None`` and ``auto_refresh`` is off while showing
+//|         images this way. ``skip_source_index`` and ``skip_dest_index`` are not
+//|         supported with a display.
+//|
 //|         After a call to ``decode``, you must ``open`` a new JPEG. It is not
 //|         possible to repeatedly ``decode`` the same jpeg data, even if it is to
 //|         select different scales or crop regions from it.
 //|
-//|         :param Bitmap bitmap: Optional output buffer
+//|         :param Bitmap bitmap: Output bitmap or display
 //|         :param int scale: Scale factor from 0 to 3, inclusive.
 //|         :param int x: Horizontal pixel location in bitmap where source_bitmap upper-left
 //|                       corner will be placed
@@ -152,6 +170,23 @@ MP_DEFINE_CONST_FUN_OBJ_2(jpegio_jpegdecoder_open_obj, jpegio_jpegdecoder_open);
 //|                                 by the pixels from the source
 //|         """
 //|
+#if CIRCUITPY_BUSDISPLAY || CIRCUITPY_FRAMEBUFFERIO
+// Returns the display core if obj is a display that can be decoded into directly.
+STATIC displayio_display_core_t *get_display_core(mp_obj_t obj) {
+    #if CIRCUITPY_BUSDISPLAY
+    if (mp_obj_is_type(obj, &busdisplay_busdisplay_type)) {
+        return &((busdisplay_busdisplay_obj_t *)MP_OBJ_TO_PTR(obj))->core;
+    }
+    #endif
+    #if CIRCUITPY_FRAMEBUFFERIO
+    if (mp_obj_is_type(obj, &framebufferio_framebufferdisplay_type)) {
+        return &((framebufferio_framebufferdisplay_obj_t *)MP_OBJ_TO_PTR(obj))->core;
+    }
+    #endif
+    return NULL;
+}
+#endif
+
 STATIC mp_obj_t jpegio_jpegdecoder_decode(mp_uint_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     jpegio_jpegdecoder_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
 
@@ -169,12 +204,32 @@ STATIC mp_obj_t jpegio_jpegdecoder_decode(mp_uint_t n_args, const mp_obj_t *pos_
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
     mp_obj_t bitmap_in = args[ARG_bitmap].u_obj;
-    mp_arg_validate_type(bitmap_in, &displayio_bitmap_type, MP_QSTR_bitmap);
-    displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(args[ARG_bitmap].u_obj);
 
     int scale = args[ARG_scale].u_int;
     mp_arg_validate_int_range(scale, 0, 3, MP_QSTR_scale);
 
+    #if CIRCUITPY_BUSDISPLAY || CIRCUITPY_FRAMEBUFFERIO
+    displayio_display_core_t *display_core = get_display_core(bitmap_in);
+    if (display_core) {
+        if (args[ARG_skip_source_index].u_obj != mp_const_none) {
+            mp_arg_error_invalid(MP_QSTR_skip_source_index);
+        }
+        if (args[ARG_skip_dest_index].u_obj != mp_const_none) {
+            mp_arg_error_invalid(MP_QSTR_skip_dest_index);
+        }
+        uint16_t width = displayio_display_core_get_width(display_core);
+        uint16_t height = displayio_display_core_get_height(display_core);
+        int x = mp_arg_validate_int_range(args[ARG_x].u_int, 0, width, MP_QSTR_x);
+        int y = mp_arg_validate_int_range(args[ARG_y].u_int, 0, height, MP_QSTR_y);
+        bitmaptools_rect_t lim = bitmaptools_validate_coord_range_pair(&args[ARG_x1], width, height);
+        common_hal_jpegio_jpegdecoder_decode_into_display(self, bitmap_in, scale, x, y, &lim);
+        return mp_const_none;
+    }
+    #endif
+
+    mp_arg_validate_type(bitmap_in, &displayio_bitmap_type, MP_QSTR_bitmap);
+    displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(args[ARG_bitmap].u_obj);
+
     int x = mp_arg_validate_int_range(args[ARG_x].u_int, 0, bitmap->width, MP_QSTR_x);
     int y = mp_arg_validate_int_range(args[ARG_y].u_int, 0, bitmap->height, MP_QSTR_y);
     bitmaptools_rect_t lim = bitmaptools_validate_coord_range_pair(&args[ARG_x1], bitmap->width, bitmap->height);
@@ -25,6 +25,7 @@
  */
 
 #include "py/stream.h"
+#include "py/binary.h"
 #include "py/mperrno.h"
 #include "py/objproperty.h"
 #include "py/runtime.h"
@@ -84,6 +85,48 @@ STATIC mp_obj_t keypad_eventqueue_get_into(mp_obj_t self_in, mp_obj_t event_in)
 }
 MP_DEFINE_CONST_FUN_OBJ_2(keypad_eventqueue_get_into_obj, keypad_eventqueue_get_into);
 
+//|     def readinto(self, events: WriteableBuffer, timestamps: Optional[WriteableBuffer] = None) -> int:
+//|         """Remove as many queued events as fit from the queue, and store them in ``events``,
+//|         and return how many were stored. Like `get_into`, this does not allocate storage,
+//|         and it handles a whole burst of events in one call.
+//|
+//|         Each event is stored as a 16-bit integer: the key number, plus ``0x8000``
+//|         if the key was pressed rather than released.
+//|
+//|         :param ~circuitpython_typing.WriteableBuffer events: An array with 2-byte elements,
+//|           such as ``array.array('H', ...)``.
+//|         :param ~circuitpython_typing.WriteableBuffer timestamps: If given, an array with 4-byte elements,
+//|           such as ``array.array('L', ...)``, which receives the `supervisor.ticks_ms` time of each event.
+//|           Fewer events are stored if ``timestamps`` is shorter than ``events``.
+//|         :return: The number of events stored.
+//|         :rtype: int
+//|         """
+//|         ...
+STATIC mp_obj_t keypad_eventqueue_readinto(size_t n_args, const mp_obj_t *args) {
+    keypad_eventqueue_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+
+    mp_buffer_info_t events_info;
+    mp_get_buffer_raise(args[1], &events_info, MP_BUFFER_WRITE);
+    if (mp_binary_get_size('@', events_info.typecode, NULL) != sizeof(uint16_t)) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be array of type 'H'"), MP_QSTR_events);
+    }
+    size_t max_count = events_info.len / sizeof(uint16_t);
+
+    uint32_t *timestamps = NULL;
+    if (n_args > 2 && args[2] != mp_const_none) {
+        mp_buffer_info_t timestamps_info;
+        mp_get_buffer_raise(args[2], &timestamps_info, MP_BUFFER_WRITE);
+        if (mp_binary_get_size('@', timestamps_info.typecode, NULL) != sizeof(uint32_t)) {
+            mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be array of type 'L'"), MP_QSTR_timestamps);
+        }
+        timestamps = timestamps_info.buf;
+        max_count = MIN(max_count, timestamps_info.len / sizeof(uint32_t));
+    }
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_keypad_eventqueue_readinto(self, events_info.buf, timestamps, max_count));
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(keypad_eventqueue_readinto_obj, 2, 3, keypad_eventqueue_readinto);
+
 //|     def clear(self) -> None:
 //|         """Clear any queued key transition events. Also sets `overflowed` to ``False``."""
 //|         ...
@@ -136,6 +179,7 @@ STATIC const mp_rom_map_elem_t keypad_eventqueue_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_get),        MP_ROM_PTR(&keypad_eventqueue_get_obj) },
     { MP_ROM_QSTR(MP_QSTR_get_into),   MP_ROM_PTR(&keypad_eventqueue_get_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_overflowed), MP_ROM_PTR(&keypad_eventqueue_overflowed_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto),   MP_ROM_PTR(&keypad_eventqueue_readinto_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(keypad_eventqueue_locals_dict, keypad_eventqueue_locals_dict_table);
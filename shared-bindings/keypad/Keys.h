@@ -32,7 +32,7 @@
 
 extern const mp_obj_type_t keypad_keys_type;
 
-void common_hal_keypad_keys_construct(keypad_keys_obj_t *self, mp_uint_t num_pins, const mcu_pin_obj_t *pins[], bool value_when_pressed,  bool pull, mp_float_t interval, size_t max_events);
+void common_hal_keypad_keys_construct(keypad_keys_obj_t *self, mp_uint_t num_pins, const mcu_pin_obj_t *pins[], bool value_when_pressed,  bool pull, mp_float_t interval, size_t max_events, bool interrupt_driven);
 
 void common_hal_keypad_keys_deinit(keypad_keys_obj_t *self);
 
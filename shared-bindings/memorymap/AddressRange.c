@@ -40,6 +40,10 @@
 //|
 //|     Multiple AddressRanges may overlap. There is no "claiming" of addresses.
 //|
+//|     On some ports, ranges of ordinary memory, such as flash mapped with XIP on RP2040, can
+//|     also be used as buffers directly, for example as the ``buffer`` of a `displayio.Bitmap`.
+//|     Memory-mapped flash is read-only.
+//|
 //|     Example usage on ESP32-S2::
 //|
 //|        import memorymap
@@ -229,6 +233,22 @@ STATIC mp_obj_t memorymap_addressrange_subscr(mp_obj_t self_in, mp_obj_t index_i
     }
 }
 
+// Ports override this for ranges that are ordinary memory, such as memory-mapped flash.
+MP_WEAK bool common_hal_memorymap_addressrange_get_buffer(const memorymap_addressrange_obj_t *self,
+    mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    return false;
+}
+
+// (the get_buffer protocol returns 0 for success, 1 for failure)
+STATIC mp_int_t memorymap_addressrange_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    memorymap_addressrange_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (!common_hal_memorymap_addressrange_get_buffer(self, bufinfo, flags)) {
+        return 1;
+    }
+    bufinfo->typecode = 'B';
+    return 0;
+}
+
 MP_DEFINE_CONST_OBJ_TYPE(
     memorymap_addressrange_type,
     MP_QSTR_AddressRange,
@@ -236,5 +256,6 @@ MP_DEFINE_CONST_OBJ_TYPE(
     make_new, memorymap_addressrange_make_new,
     locals_dict, (mp_obj_t)&memorymap_addressrange_locals_dict,
     subscr, memorymap_addressrange_subscr,
-    unary_op, memorymap_addressrange_unary_op
+    unary_op, memorymap_addressrange_unary_op,
+    buffer, memorymap_addressrange_get_buffer
     );
@@ -43,4 +43,9 @@ void common_hal_memorymap_addressrange_set_bytes(const memorymap_addressrange_ob
 void common_hal_memorymap_addressrange_get_bytes(const memorymap_addressrange_obj_t *self,
     size_t start_index, size_t len, uint8_t *values);
 
+// Fill in bufinfo if the range is plain memory that can be accessed directly
+// with flags (MP_BUFFER_READ and/or MP_BUFFER_WRITE). Returns false otherwise.
+bool common_hal_memorymap_addressrange_get_buffer(const memorymap_addressrange_obj_t *self,
+    mp_buffer_info_t *bufinfo, mp_uint_t flags);
+
 #endif  // MICROPY_INCLUDED_SHARED_BINDINGS_MEMORYMAP_ADDRESSRANGE_H
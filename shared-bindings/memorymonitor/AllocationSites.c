@@ -0,0 +1,181 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/memorymonitor/AllocationSites.h"
+
+#if CIRCUITPY_MEMORYMONITOR_ALLOCATION_SITES
+
+//| class AllocationSites:
+//|     def __init__(self, sample_every: int = 1) -> None:
+//|         """Records where in Python code allocations are made.
+//|
+//|         Every ``sample_every`` allocations, the source file, function and line running at the
+//|         time is recorded and counted. Up to 16 distinct sites are kept; samples from any further
+//|         sites are only counted in `dropped`. A larger ``sample_every`` makes tracking cheaper
+//|         at the cost of missing infrequent sites.
+//|
+//|         Allocations made by native code, such as ``@micropython.native`` functions, are recorded
+//|         against the Python code that called them.
+//|
+//|         Find allocation hot spots::
+//|
+//|           import memorymonitor
+//|
+//|           sites = memorymonitor.AllocationSites(sample_every=4)
+//|           with sites:
+//|             main_loop()
+//|
+//|           for source_file, function, line, count in sites:
+//|               print(source_file, function, line, count)
+//|
+//|         """
+//|         ...
+STATIC mp_obj_t memorymonitor_allocationsites_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_sample_every };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample_every, MP_ARG_INT, {.u_int = 1} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    mp_int_t sample_every = mp_arg_validate_int_min(args[ARG_sample_every].u_int, 1, MP_QSTR_sample_every);
+
+    memorymonitor_allocationsites_obj_t *self =
+        mp_obj_malloc(memorymonitor_allocationsites_obj_t, &memorymonitor_allocationsites_type);
+
+    common_hal_memorymonitor_allocationsites_construct(self, sample_every);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def __enter__(self) -> AllocationSites:
+//|         """Clears recorded sites and resumes tracking."""
+//|         ...
+STATIC mp_obj_t memorymonitor_allocationsites_obj___enter__(mp_obj_t self_in) {
+    common_hal_memorymonitor_allocationsites_clear(self_in);
+    common_hal_memorymonitor_allocationsites_resume(self_in);
+    return self_in;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(memorymonitor_allocationsites___enter___obj, memorymonitor_allocationsites_obj___enter__);
+
+//|     def __exit__(self) -> None:
+//|         """Automatically pauses allocation tracking when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+STATIC mp_obj_t memorymonitor_allocationsites_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_memorymonitor_allocationsites_pause(args[0]);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(memorymonitor_allocationsites___exit___obj, 4, 4, memorymonitor_allocationsites_obj___exit__);
+
+//|     dropped: int
+//|     """Number of sampled allocations that weren't recorded because all sites were in use."""
+STATIC mp_obj_t memorymonitor_allocationsites_obj_get_dropped(mp_obj_t self_in) {
+    memorymonitor_allocationsites_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    return mp_obj_new_int_from_uint(common_hal_memorymonitor_allocationsites_get_dropped(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(memorymonitor_allocationsites_get_dropped_obj, memorymonitor_allocationsites_obj_get_dropped);
+
+MP_PROPERTY_GETTER(memorymonitor_allocationsites_dropped_obj,
+    (mp_obj_t)&memorymonitor_allocationsites_get_dropped_obj);
+
+//|     def __len__(self) -> int:
+//|         """Returns the number of distinct sites recorded."""
+//|         ...
+STATIC mp_obj_t memorymonitor_allocationsites_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
+    memorymonitor_allocationsites_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    uint16_t len = common_hal_memorymonitor_allocationsites_get_len(self);
+    switch (op) {
+        case MP_UNARY_OP_BOOL:
+            return mp_obj_new_bool(len != 0);
+        case MP_UNARY_OP_LEN:
+            return MP_OBJ_NEW_SMALL_INT(len);
+        default:
+            return MP_OBJ_NULL;      // op not supported
+    }
+}
+
+//|     def __getitem__(self, index: int) -> Tuple[str, str, int, int]:
+//|         """Returns the source file, function, line and sample count of the given site, in the
+//|         order the sites were first seen."""
+//|         ...
+//|
+STATIC mp_obj_t memorymonitor_allocationsites_subscr(mp_obj_t self_in, mp_obj_t index_obj, mp_obj_t value) {
+    if (value == mp_const_none) {
+        // delete item
+        mp_raise_AttributeError(MP_ERROR_TEXT("Cannot delete values"));
+    } else {
+        memorymonitor_allocationsites_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+        if (mp_obj_is_type(index_obj, &mp_type_slice)) {
+            mp_raise_NotImplementedError(MP_ERROR_TEXT("Slices not supported"));
+        } else {
+            size_t index = mp_get_index(&memorymonitor_allocationsites_type, common_hal_memorymonitor_allocationsites_get_len(self), index_obj, false);
+            if (value == MP_OBJ_SENTINEL) {
+                // load
+                const memorymonitor_allocationsite_t *site = common_hal_memorymonitor_allocationsites_get_item(self, index);
+                mp_obj_t items[] = {
+                    MP_OBJ_NEW_QSTR(site->source_file),
+                    MP_OBJ_NEW_QSTR(site->function),
+                    MP_OBJ_NEW_SMALL_INT(site->line),
+                    mp_obj_new_int_from_uint(site->count),
+                };
+                return mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
+            } else {
+                mp_raise_AttributeError(MP_ERROR_TEXT("Read-only"));
+            }
+        }
+    }
+    return mp_const_none;
+}
+
+STATIC const mp_rom_map_elem_t memorymonitor_allocationsites_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&memorymonitor_allocationsites___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&memorymonitor_allocationsites___exit___obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_dropped), MP_ROM_PTR(&memorymonitor_allocationsites_dropped_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(memorymonitor_allocationsites_locals_dict, memorymonitor_allocationsites_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    memorymonitor_allocationsites_type,
+    MP_QSTR_AllocationSites,
+    MP_TYPE_FLAG_ITER_IS_GETITER | MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, memorymonitor_allocationsites_make_new,
+    subscr, memorymonitor_allocationsites_subscr,
+    unary_op, memorymonitor_allocationsites_unary_op,
+    iter, mp_obj_generic_subscript_getiter,
+    locals_dict, &memorymonitor_allocationsites_locals_dict
+    );
+
+#endif
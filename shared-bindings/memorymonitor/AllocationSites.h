@@ -0,0 +1,42 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_BINDINGS_MEMORYMONITOR_ALLOCATIONSITES_H
+#define MICROPY_INCLUDED_SHARED_BINDINGS_MEMORYMONITOR_ALLOCATIONSITES_H
+
+#include "shared-module/memorymonitor/AllocationSites.h"
+
+extern const mp_obj_type_t memorymonitor_allocationsites_type;
+
+extern void common_hal_memorymonitor_allocationsites_construct(memorymonitor_allocationsites_obj_t *self, uint32_t sample_every);
+extern void common_hal_memorymonitor_allocationsites_pause(memorymonitor_allocationsites_obj_t *self);
+extern void common_hal_memorymonitor_allocationsites_resume(memorymonitor_allocationsites_obj_t *self);
+extern void common_hal_memorymonitor_allocationsites_clear(memorymonitor_allocationsites_obj_t *self);
+extern uint16_t common_hal_memorymonitor_allocationsites_get_len(memorymonitor_allocationsites_obj_t *self);
+extern const memorymonitor_allocationsite_t *common_hal_memorymonitor_allocationsites_get_item(memorymonitor_allocationsites_obj_t *self, int16_t index);
+extern uint32_t common_hal_memorymonitor_allocationsites_get_dropped(memorymonitor_allocationsites_obj_t *self);
+
+#endif // MICROPY_INCLUDED_SHARED_BINDINGS_MEMORYMONITOR_ALLOCATIONSITES_H
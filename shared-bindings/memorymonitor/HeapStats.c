@@ -0,0 +1,169 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/memorymonitor/HeapStats.h"
+
+//| class HeapStats:
+//|     def __init__(self) -> None:
+//|         """Takes a snapshot of how the heap is used.
+//|
+//|         The snapshot is made in a single pass over the heap's allocation table when the object
+//|         is created, and doesn't change afterwards. Create a new HeapStats to see the current state.
+//|
+//|         A large total of free memory doesn't guarantee a large allocation will succeed because
+//|         the free memory may be split into many small runs. `largest_free` and `free_histogram`
+//|         show how fragmented the heap is.
+//|
+//|         Show heap usage::
+//|
+//|           import memorymonitor
+//|
+//|           stats = memorymonitor.HeapStats()
+//|           print(stats.used, stats.free, stats.largest_free)
+//|           for t, blocks in stats.type_blocks.items():
+//|               print(t, blocks * stats.bytes_per_block)
+//|
+//|         """
+//|         ...
+STATIC mp_obj_t memorymonitor_heapstats_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    mp_arg_check_num(n_args, n_kw, 0, 0, false);
+    memorymonitor_heapstats_obj_t *self =
+        mp_obj_malloc(memorymonitor_heapstats_obj_t, &memorymonitor_heapstats_type);
+
+    common_hal_memorymonitor_heapstats_construct(self);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     bytes_per_block: int
+//|     """Number of bytes per block"""
+STATIC mp_obj_t memorymonitor_heapstats_obj_get_bytes_per_block(mp_obj_t self_in) {
+    memorymonitor_heapstats_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_memorymonitor_heapstats_get_bytes_per_block(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(memorymonitor_heapstats_get_bytes_per_block_obj, memorymonitor_heapstats_obj_get_bytes_per_block);
+
+MP_PROPERTY_GETTER(memorymonitor_heapstats_bytes_per_block_obj,
+    (mp_obj_t)&memorymonitor_heapstats_get_bytes_per_block_obj);
+
+//|     free: int
+//|     """Total free bytes"""
+STATIC mp_obj_t memorymonitor_heapstats_obj_get_free(mp_obj_t self_in) {
+    memorymonitor_heapstats_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    return mp_obj_new_int_from_uint(self->free_blocks * common_hal_memorymonitor_heapstats_get_bytes_per_block(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(memorymonitor_heapstats_get_free_obj, memorymonitor_heapstats_obj_get_free);
+
+MP_PROPERTY_GETTER(memorymonitor_heapstats_free_obj,
+    (mp_obj_t)&memorymonitor_heapstats_get_free_obj);
+
+//|     used: int
+//|     """Total allocated bytes"""
+STATIC mp_obj_t memorymonitor_heapstats_obj_get_used(mp_obj_t self_in) {
+    memorymonitor_heapstats_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    return mp_obj_new_int_from_uint(self->used_blocks * common_hal_memorymonitor_heapstats_get_bytes_per_block(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(memorymonitor_heapstats_get_used_obj, memorymonitor_heapstats_obj_get_used);
+
+MP_PROPERTY_GETTER(memorymonitor_heapstats_used_obj,
+    (mp_obj_t)&memorymonitor_heapstats_get_used_obj);
+
+//|     largest_free: int
+//|     """Size in bytes of the largest contiguous free run. This is the largest allocation that can
+//|     succeed without a garbage collection."""
+STATIC mp_obj_t memorymonitor_heapstats_obj_get_largest_free(mp_obj_t self_in) {
+    memorymonitor_heapstats_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    return mp_obj_new_int_from_uint(self->largest_free_blocks * common_hal_memorymonitor_heapstats_get_bytes_per_block(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(memorymonitor_heapstats_get_largest_free_obj, memorymonitor_heapstats_obj_get_largest_free);
+
+MP_PROPERTY_GETTER(memorymonitor_heapstats_largest_free_obj,
+    (mp_obj_t)&memorymonitor_heapstats_get_largest_free_obj);
+
+//|     free_histogram: Tuple[int, ...]
+//|     """Number of free runs in power of two buckets of blocks, the same way `AllocationSize`
+//|     buckets allocations. Bucket 0 counts single free blocks and the last bucket also counts
+//|     every larger run."""
+STATIC mp_obj_t memorymonitor_heapstats_obj_get_free_histogram(mp_obj_t self_in) {
+    memorymonitor_heapstats_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    mp_obj_t items[HEAP_STATS_FREE_BUCKETS];
+    for (size_t i = 0; i < HEAP_STATS_FREE_BUCKETS; i++) {
+        items[i] = mp_obj_new_int_from_uint(self->free_runs[i]);
+    }
+    return mp_obj_new_tuple(HEAP_STATS_FREE_BUCKETS, items);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(memorymonitor_heapstats_get_free_histogram_obj, memorymonitor_heapstats_obj_get_free_histogram);
+
+MP_PROPERTY_GETTER(memorymonitor_heapstats_free_histogram_obj,
+    (mp_obj_t)&memorymonitor_heapstats_get_free_histogram_obj);
+
+//|     type_blocks: Dict[Optional[type], int]
+//|     """Blocks used by objects of each type. Only built-in types and classes are recognized and
+//|     only the first 16 types seen are counted separately. Everything else, including the
+//|     buffers owned by objects such as the contents of a `list`, is counted under ``None``."""
+//|
+STATIC mp_obj_t memorymonitor_heapstats_obj_get_type_blocks(mp_obj_t self_in) {
+    memorymonitor_heapstats_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    mp_obj_t dict = mp_obj_new_dict(HEAP_STATS_TYPES + 1);
+    for (size_t i = 0; i < HEAP_STATS_TYPES && self->types[i] != NULL; i++) {
+        mp_obj_dict_store(dict, MP_OBJ_FROM_PTR(self->types[i]), mp_obj_new_int_from_uint(self->type_blocks[i]));
+    }
+    mp_obj_dict_store(dict, mp_const_none, mp_obj_new_int_from_uint(self->other_blocks));
+    return dict;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(memorymonitor_heapstats_get_type_blocks_obj, memorymonitor_heapstats_obj_get_type_blocks);
+
+MP_PROPERTY_GETTER(memorymonitor_heapstats_type_blocks_obj,
+    (mp_obj_t)&memorymonitor_heapstats_get_type_blocks_obj);
+
+STATIC const mp_rom_map_elem_t memorymonitor_heapstats_locals_dict_table[] = {
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_bytes_per_block), MP_ROM_PTR(&memorymonitor_heapstats_bytes_per_block_obj) },
+    { MP_ROM_QSTR(MP_QSTR_free), MP_ROM_PTR(&memorymonitor_heapstats_free_obj) },
+    { MP_ROM_QSTR(MP_QSTR_used), MP_ROM_PTR(&memorymonitor_heapstats_used_obj) },
+    { MP_ROM_QSTR(MP_QSTR_largest_free), MP_ROM_PTR(&memorymonitor_heapstats_largest_free_obj) },
+    { MP_ROM_QSTR(MP_QSTR_free_histogram), MP_ROM_PTR(&memorymonitor_heapstats_free_histogram_obj) },
+    { MP_ROM_QSTR(MP_QSTR_type_blocks), MP_ROM_PTR(&memorymonitor_heapstats_type_blocks_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(memorymonitor_heapstats_locals_dict, memorymonitor_heapstats_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    memorymonitor_heapstats_type,
+    MP_QSTR_HeapStats,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, memorymonitor_heapstats_make_new,
+    locals_dict, &memorymonitor_heapstats_locals_dict
+    );
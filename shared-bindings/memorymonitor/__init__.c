@@ -24,6 +24,7 @@
  * THE SOFTWARE.
  */
 
+#include <stdarg.h>
 #include <stdint.h>
 
 #include "py/obj.h"
@@ -31,7 +32,9 @@
 
 #include "shared-bindings/memorymonitor/__init__.h"
 #include "shared-bindings/memorymonitor/AllocationAlarm.h"
+#include "shared-bindings/memorymonitor/AllocationSites.h"
 #include "shared-bindings/memorymonitor/AllocationSize.h"
+#include "shared-bindings/memorymonitor/HeapStats.h"
 
 //| """Memory monitoring helpers"""
 //|
@@ -54,7 +57,11 @@ NORETURN void mp_raise_memorymonitor_AllocationError(mp_rom_error_text_t fmt, ..
 STATIC const mp_rom_map_elem_t memorymonitor_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_memorymonitor) },
     { MP_ROM_QSTR(MP_QSTR_AllocationAlarm), MP_ROM_PTR(&memorymonitor_allocationalarm_type) },
+    #if CIRCUITPY_MEMORYMONITOR_ALLOCATION_SITES
+    { MP_ROM_QSTR(MP_QSTR_AllocationSites), MP_ROM_PTR(&memorymonitor_allocationsites_type) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_AllocationSize), MP_ROM_PTR(&memorymonitor_allocationsize_type) },
+    { MP_ROM_QSTR(MP_QSTR_HeapStats), MP_ROM_PTR(&memorymonitor_heapstats_type) },
 
     // Errors
     { MP_ROM_QSTR(MP_QSTR_AllocationError),      MP_ROM_PTR(&mp_type_memorymonitor_AllocationError) },
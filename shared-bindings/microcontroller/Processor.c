@@ -38,6 +38,7 @@
 #include "py/objtype.h"
 #include "py/objproperty.h"
 #include "py/runtime.h"
+#include "supervisor/shared/cpu_governor.h"
 
 
 //| class Processor:
@@ -68,6 +69,8 @@
 //|
 //|     **Limitations:** On most boards, ``frequency`` is read-only. Setting
 //|     the ``frequency`` is possible on RP2040 boards and some i.MX boards.
+//|     Builds with the CPU governor lower the frequency while the VM is mostly
+//|     idle. Setting ``frequency`` turns the governor off until the next reload.
 //|
 //|     .. warning:: Overclocking likely voids your warranties and may reduce
 //|       the lifetime of the chip.
@@ -80,6 +83,9 @@
 #if CIRCUITPY_SETTABLE_PROCESSOR_FREQUENCY
 STATIC mp_obj_t mcu_processor_set_frequency(mp_obj_t self, mp_obj_t freq) {
     uint32_t value_of_freq = (uint32_t)mp_arg_validate_int_min(mp_obj_get_int(freq), 0, MP_QSTR_frequency);
+    #if CIRCUITPY_CPU_GOVERNOR
+    supervisor_cpu_governor_stop();
+    #endif
     common_hal_mcu_processor_set_frequency(self, value_of_freq);
     return mp_const_none;
 }
@@ -0,0 +1,155 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/msgpack/Unpacker.h"
+
+#define MP_OBJ_IS_METH(o) (mp_obj_is_obj(o) && (((mp_obj_base_t *)MP_OBJ_TO_PTR(o))->type->name == MP_QSTR_bound_method))
+
+//| class Unpacker:
+//|     """Incrementally unpack a sequence of msgpack objects
+//|
+//|     Data is supplied with `feed`, or read from a stream in chunks of ``read_size``
+//|     bytes, and complete objects are returned by iterating over the Unpacker. An
+//|     object that has only partly arrived stays buffered until the rest of it does,
+//|     so the data may be split anywhere, such as wherever a socket read ends.
+//|
+//|     Example::
+//|
+//|        import msgpack
+//|
+//|        unpacker = msgpack.Unpacker()
+//|        while True:
+//|            unpacker.feed(sock.recv(256))
+//|            for obj in unpacker:
+//|                print(obj)
+//|     """
+//|
+//|     def __init__(
+//|         self,
+//|         stream: Optional[circuitpython_typing.ByteStream] = None,
+//|         *,
+//|         read_size: int = 256,
+//|         ext_hook: Union[Callable[[int, bytes], object], None] = None,
+//|         use_list: bool = True,
+//|         use_memoryview: bool = False
+//|     ) -> None:
+//|         """Create an Unpacker.
+//|
+//|         :param ~circuitpython_typing.ByteStream stream: stream to read from when
+//|           the buffered data has no complete object, or ``None`` to use only `feed`.
+//|           A non-blocking stream with no data ready ends the iteration.
+//|         :param int read_size: the number of bytes to read from ``stream`` at once
+//|         :param Optional[~circuitpython_typing.Callable[[int, bytes], object]] ext_hook: function called for objects in
+//|            msgpack ext format.
+//|         :param bool use_list: return array as list or tuple (use_list=False).
+//|         :param bool use_memoryview: return bin payloads as read-only `memoryview` objects
+//|           into the Unpacker's buffer instead of copying them to `bytes`. A view keeps
+//|           the buffer it points into allocated, so hold onto views only as long as needed.
+//|         """
+//|         ...
+STATIC mp_obj_t msgpack_unpacker_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_stream, ARG_read_size, ARG_ext_hook, ARG_use_list, ARG_use_memoryview };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_stream, MP_ARG_OBJ, { .u_obj = mp_const_none } },
+        { MP_QSTR_read_size, MP_ARG_KW_ONLY | MP_ARG_INT, { .u_int = 256 } },
+        { MP_QSTR_ext_hook, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = mp_const_none } },
+        { MP_QSTR_use_list, MP_ARG_KW_ONLY | MP_ARG_BOOL, { .u_bool = true } },
+        { MP_QSTR_use_memoryview, MP_ARG_KW_ONLY | MP_ARG_BOOL, { .u_bool = false } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t hook = args[ARG_ext_hook].u_obj;
+    if (hook != mp_const_none && !mp_obj_is_fun(hook) && !MP_OBJ_IS_METH(hook)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("ext_hook is not a function"));
+    }
+    mp_int_t read_size = mp_arg_validate_int_min(args[ARG_read_size].u_int, 1, MP_QSTR_read_size);
+
+    msgpack_unpacker_obj_t *self = mp_obj_malloc(msgpack_unpacker_obj_t, &msgpack_unpacker_type);
+    common_hal_msgpack_unpacker_construct(self, args[ARG_stream].u_obj, read_size, hook,
+        args[ARG_use_list].u_bool, args[ARG_use_memoryview].u_bool);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def feed(self, data: ReadableBuffer) -> None:
+//|         """Add data to the end of the buffered data to be unpacked."""
+//|         ...
+STATIC mp_obj_t msgpack_unpacker_feed(mp_obj_t self_in, mp_obj_t data) {
+    msgpack_unpacker_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    common_hal_msgpack_unpacker_feed(self, bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(msgpack_unpacker_feed_obj, msgpack_unpacker_feed);
+
+//|     in_waiting: int
+//|     """The number of bytes buffered that have not been unpacked yet. (read-only)"""
+STATIC mp_obj_t msgpack_unpacker_obj_get_in_waiting(mp_obj_t self_in) {
+    msgpack_unpacker_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_msgpack_unpacker_get_in_waiting(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(msgpack_unpacker_get_in_waiting_obj, msgpack_unpacker_obj_get_in_waiting);
+
+MP_PROPERTY_GETTER(msgpack_unpacker_in_waiting_obj,
+    (mp_obj_t)&msgpack_unpacker_get_in_waiting_obj);
+
+//|     def __iter__(self) -> Iterator[object]:
+//|         """Returns itself since it is the iterator."""
+//|         ...
+//|
+//|     def __next__(self) -> object:
+//|         """Returns the next complete object. Raises `StopIteration` if the buffered data
+//|         does not hold one and no more can be read from the stream."""
+//|         ...
+//|
+STATIC mp_obj_t msgpack_unpacker_iternext(mp_obj_t self_in) {
+    msgpack_unpacker_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_obj_t result;
+    if (common_hal_msgpack_unpacker_next(self, &result)) {
+        return result;
+    }
+    return MP_OBJ_STOP_ITERATION;
+}
+
+STATIC const mp_rom_map_elem_t msgpack_unpacker_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_feed), MP_ROM_PTR(&msgpack_unpacker_feed_obj) },
+    { MP_ROM_QSTR(MP_QSTR_in_waiting), MP_ROM_PTR(&msgpack_unpacker_in_waiting_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(msgpack_unpacker_locals_dict, msgpack_unpacker_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    msgpack_unpacker_type,
+    MP_QSTR_Unpacker,
+    MP_TYPE_FLAG_ITER_IS_ITERNEXT | MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, msgpack_unpacker_make_new,
+    locals_dict, &msgpack_unpacker_locals_dict,
+    iter, msgpack_unpacker_iternext
+    );
@@ -104,32 +104,68 @@ STATIC void check_for_deinit(digitalio_digitalinout_obj_t *self) {
 //|
 //| """
 //|
-//| def neopixel_write(digitalinout: digitalio.DigitalInOut, buf: ReadableBuffer) -> None:
+//| def neopixel_write(digitalinout: digitalio.DigitalInOut, buf: ReadableBuffer, *, background: bool = False) -> None:
 //|     """Write buf out on the given DigitalInOut.
 //|
 //|     :param ~digitalio.DigitalInOut digitalinout: the DigitalInOut to output with
 //|     :param ~circuitpython_typing.ReadableBuffer buf: The bytes to clock out. No assumption is made about color order
+//|     :param bool background: When True, buf is copied and sent while the call returns so that the
+//|       next frame can be prepared at the same time. A later write to the same pin waits for the
+//|       previous one to finish. The pin is used for the write until the code stops or a foreground
+//|       write is done to it. Ports that can't write in the background send buf before returning.
 //|     """
 //|     ...
 //|
-STATIC mp_obj_t neopixel_write_neopixel_write_(mp_obj_t digitalinout_obj, mp_obj_t buf) {
+STATIC mp_obj_t neopixel_write_neopixel_write_(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_digitalinout, ARG_buf, ARG_background };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_digitalinout, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_buf, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_background, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
     const digitalio_digitalinout_obj_t *digitalinout =
-        mp_arg_validate_type(digitalinout_obj, &digitalio_digitalinout_type, MP_QSTR_digitalinout);
+        mp_arg_validate_type(args[ARG_digitalinout].u_obj, &digitalio_digitalinout_type, MP_QSTR_digitalinout);
 
     // Check to see if the NeoPixel has been deinited before writing to it.
-    check_for_deinit(digitalinout_obj);
+    check_for_deinit(args[ARG_digitalinout].u_obj);
 
     mp_buffer_info_t bufinfo;
-    mp_get_buffer_raise(buf, &bufinfo, MP_BUFFER_READ);
+    mp_get_buffer_raise(args[ARG_buf].u_obj, &bufinfo, MP_BUFFER_READ);
+    #if CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND
+    if (args[ARG_background].u_bool &&
+        common_hal_neopixel_write_background(digitalinout, (uint8_t *)bufinfo.buf, bufinfo.len)) {
+        return mp_const_none;
+    }
+    #endif
     // Call platform's neopixel write function with provided buffer and options.
     common_hal_neopixel_write(digitalinout, (uint8_t *)bufinfo.buf, bufinfo.len);
     return mp_const_none;
 }
-STATIC MP_DEFINE_CONST_FUN_OBJ_2(neopixel_write_neopixel_write_obj, neopixel_write_neopixel_write_);
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(neopixel_write_neopixel_write_obj, 2, neopixel_write_neopixel_write_);
+
+//| def writing(digitalinout: digitalio.DigitalInOut) -> bool:
+//|     """True while a background `neopixel_write` to the given DigitalInOut is still being sent."""
+//|     ...
+//|
+STATIC mp_obj_t neopixel_write_writing(mp_obj_t digitalinout_obj) {
+    const digitalio_digitalinout_obj_t *digitalinout =
+        mp_arg_validate_type(digitalinout_obj, &digitalio_digitalinout_type, MP_QSTR_digitalinout);
+    #if CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND
+    return mp_obj_new_bool(common_hal_neopixel_write_get_writing(digitalinout));
+    #else
+    (void)digitalinout;
+    return mp_const_false;
+    #endif
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(neopixel_write_writing_obj, neopixel_write_writing);
 
 STATIC const mp_rom_map_elem_t neopixel_write_module_globals_table[] = {
     { MP_OBJ_NEW_QSTR(MP_QSTR___name__), MP_OBJ_NEW_QSTR(MP_QSTR_neopixel_write) },
     { MP_OBJ_NEW_QSTR(MP_QSTR_neopixel_write), (mp_obj_t)&neopixel_write_neopixel_write_obj },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_writing), (mp_obj_t)&neopixel_write_writing_obj },
 };
 
 STATIC MP_DEFINE_CONST_DICT(neopixel_write_module_globals, neopixel_write_module_globals_table);
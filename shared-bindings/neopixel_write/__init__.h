@@ -34,4 +34,13 @@
 
 extern void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *gpio, uint8_t *pixels, uint32_t numBytes);
 
+#if CIRCUITPY_NEOPIXEL_WRITE_BACKGROUND
+// Copies pixels and starts sending them, after waiting for any earlier background write to the
+// same pin to finish. Returns false if the port can't start a background write right now.
+extern bool common_hal_neopixel_write_background(const digitalio_digitalinout_obj_t *gpio, uint8_t *pixels, uint32_t numBytes);
+extern bool common_hal_neopixel_write_get_writing(const digitalio_digitalinout_obj_t *gpio);
+// Stops background writes when the VM ends.
+extern void neopixel_write_reset(void);
+#endif
+
 #endif  // MICROPY_INCLUDED_SHARED_BINDINGS_NEOPIXEL_WRITE_H
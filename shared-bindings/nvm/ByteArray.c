@@ -28,18 +28,25 @@
 #include "py/runtime.h"
 #include "py/runtime0.h"
 #include "shared-bindings/nvm/ByteArray.h"
+#include "shared-module/nvm/ByteArray.h"
 
 //| class ByteArray:
 //|     r"""Presents a stretch of non-volatile memory as a bytearray.
 //|
 //|     Non-volatile memory is available as a byte array that persists over reloads
 //|     and power cycles. Each assignment causes an erase and write cycle so its recommended to assign
-//|     all values to change at once.
+//|     all values to change at once, or to stage several assignments with `begin` and write them
+//|     with a single `commit`. Bytes that already hold their value aren't rewritten.
 //|
 //|     Usage::
 //|
 //|        import microcontroller
 //|        microcontroller.nvm[0:3] = b"\xcc\x10\x00"
+//|
+//|        # Write both changes at once. They are discarded if the block raises an exception.
+//|        with microcontroller.nvm:
+//|            microcontroller.nvm[0] = 1
+//|            microcontroller.nvm[8:10] = b"\x12\x34"
 //|     """
 //|
 
@@ -64,7 +71,69 @@ STATIC mp_obj_t nvm_bytearray_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
     }
 }
 
+//|     def begin(self) -> None:
+//|         """Stage assignments in RAM instead of writing them. Reads return the staged values.
+//|         Staged assignments are discarded if they aren't committed before the VM ends."""
+//|         ...
+STATIC mp_obj_t nvm_bytearray_begin(mp_obj_t self_in) {
+    nvm_bytearray_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    shared_module_nvm_bytearray_begin(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(nvm_bytearray_begin_obj, nvm_bytearray_begin);
+
+//|     def commit(self) -> None:
+//|         """Write the assignments staged since `begin` and stop staging. Only the span from the
+//|         first to the last changed byte is written."""
+//|         ...
+STATIC mp_obj_t nvm_bytearray_commit(mp_obj_t self_in) {
+    nvm_bytearray_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (!shared_module_nvm_bytearray_commit(self)) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Unable to write to nvm."));
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(nvm_bytearray_commit_obj, nvm_bytearray_commit);
+
+//|     def discard(self) -> None:
+//|         """Drop the assignments staged since `begin` and stop staging."""
+//|         ...
+STATIC mp_obj_t nvm_bytearray_discard(mp_obj_t self_in) {
+    nvm_bytearray_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    shared_module_nvm_bytearray_discard(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(nvm_bytearray_discard_obj, nvm_bytearray_discard);
+
+//|     def __enter__(self) -> ByteArray:
+//|         """Calls `begin`."""
+//|         ...
+STATIC mp_obj_t nvm_bytearray___enter__(mp_obj_t self_in) {
+    nvm_bytearray_begin(self_in);
+    return self_in;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(nvm_bytearray___enter___obj, nvm_bytearray___enter__);
+
+//|     def __exit__(self) -> None:
+//|         """Calls `commit`, or `discard` when the block raised an exception. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+STATIC mp_obj_t nvm_bytearray___exit__(size_t n_args, const mp_obj_t *args) {
+    if (args[1] == mp_const_none) {
+        nvm_bytearray_commit(args[0]);
+    } else {
+        nvm_bytearray_discard(args[0]);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(nvm_bytearray___exit___obj, 4, 4, nvm_bytearray___exit__);
+
 STATIC const mp_rom_map_elem_t nvm_bytearray_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_begin), MP_ROM_PTR(&nvm_bytearray_begin_obj) },
+    { MP_ROM_QSTR(MP_QSTR_commit), MP_ROM_PTR(&nvm_bytearray_commit_obj) },
+    { MP_ROM_QSTR(MP_QSTR_discard), MP_ROM_PTR(&nvm_bytearray_discard_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&nvm_bytearray___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&nvm_bytearray___exit___obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(nvm_bytearray_locals_dict, nvm_bytearray_locals_dict_table);
@@ -120,7 +189,7 @@ STATIC mp_obj_t nvm_bytearray_subscr(mp_obj_t self_in, mp_obj_t index_in, mp_obj
                     mp_raise_NotImplementedError(MP_ERROR_TEXT("array/bytes required on right side"));
                 }
 
-                if (!common_hal_nvm_bytearray_set_bytes(self, slice.start, src_items, src_len)) {
+                if (!shared_module_nvm_bytearray_set_bytes(self, slice.start, src_items, src_len)) {
                     mp_raise_RuntimeError(MP_ERROR_TEXT("Unable to write to nvm."));
                 }
                 return mp_const_none;
@@ -131,7 +200,7 @@ STATIC mp_obj_t nvm_bytearray_subscr(mp_obj_t self_in, mp_obj_t index_in, mp_obj
                 // Read slice.
                 size_t len = slice.stop - slice.start;
                 uint8_t *items = m_new(uint8_t, len);
-                common_hal_nvm_bytearray_get_bytes(self, slice.start, len, items);
+                shared_module_nvm_bytearray_get_bytes(self, slice.start, len, items);
                 return mp_obj_new_bytearray_by_ref(len, items);
             }
         #endif
@@ -142,7 +211,7 @@ STATIC mp_obj_t nvm_bytearray_subscr(mp_obj_t self_in, mp_obj_t index_in, mp_obj
             if (value == MP_OBJ_SENTINEL) {
                 // load
                 uint8_t value_out;
-                common_hal_nvm_bytearray_get_bytes(self, index, 1, &value_out);
+                shared_module_nvm_bytearray_get_bytes(self, index, 1, &value_out);
                 return MP_OBJ_NEW_SMALL_INT(value_out);
             } else {
                 // store
@@ -150,7 +219,7 @@ STATIC mp_obj_t nvm_bytearray_subscr(mp_obj_t self_in, mp_obj_t index_in, mp_obj
                 mp_arg_validate_int_range(byte_value, 0, 255, MP_QSTR_bytes);
 
                 uint8_t short_value = byte_value;
-                if (!common_hal_nvm_bytearray_set_bytes(self, index, &short_value, 1)) {
+                if (!shared_module_nvm_bytearray_set_bytes(self, index, &short_value, 1)) {
                     mp_raise_RuntimeError(MP_ERROR_TEXT("Unable to write to nvm."));
                 }
                 return mp_const_none;
@@ -26,7 +26,12 @@
 
 #include <stdint.h>
 
+#include "shared/runtime/buffer_helper.h"
 #include "shared/runtime/context_manager_helpers.h"
+#include "shared/runtime/interrupt_char.h"
+#include "py/binary.h"
+#include "py/mperrno.h"
+#include "py/objlist.h"
 #include "py/runtime.h"
 #include "py/runtime0.h"
 #include "shared-bindings/microcontroller/Pin.h"
@@ -130,7 +135,6 @@ MP_DEFINE_CONST_FUN_OBJ_1(onewireio_onewire_read_bit_obj, onewireio_onewire_obj_
 //|     def write_bit(self, value: bool) -> None:
 //|         """Write out a bit based on value."""
 //|         ...
-//|
 STATIC mp_obj_t onewireio_onewire_obj_write_bit(mp_obj_t self_in, mp_obj_t bool_obj) {
     onewireio_onewire_obj_t *self = MP_OBJ_TO_PTR(self_in);
     check_for_deinit(self);
@@ -140,6 +144,180 @@ STATIC mp_obj_t onewireio_onewire_obj_write_bit(mp_obj_t self_in, mp_obj_t bool_
 }
 MP_DEFINE_CONST_FUN_OBJ_2(onewireio_onewire_write_bit_obj, onewireio_onewire_obj_write_bit);
 
+//|     def readinto(self, buffer: WriteableBuffer, *, start: int = 0, end: int = sys.maxsize) -> None:
+//|         """Read bytes into ``buffer``, least significant bit first.
+//|
+//|         If ``start`` or ``end`` is provided, then the buffer will be sliced
+//|         as if ``buffer[start:end]`` were passed.
+//|
+//|         :param WriteableBuffer buffer: read bytes into this buffer
+//|         :param int start: beginning of buffer slice
+//|         :param int end: end of buffer slice; if not specified, use ``len(buffer)``"""
+//|         ...
+STATIC mp_obj_t onewireio_onewire_obj_readinto(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_start, ARG_end };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer,     MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_start,      MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_end,        MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = INT_MAX} },
+    };
+    onewireio_onewire_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_WRITE);
+    int stride_in_bytes = mp_binary_get_size('@', bufinfo.typecode, NULL);
+    // Compute bounds in terms of elements, not bytes.
+    int32_t start = args[ARG_start].u_int;
+    size_t length = bufinfo.len / stride_in_bytes;
+    normalize_buffer_bounds(&start, args[ARG_end].u_int, &length);
+
+    common_hal_onewireio_onewire_readinto(self, ((uint8_t *)bufinfo.buf) + start * stride_in_bytes, length * stride_in_bytes);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(onewireio_onewire_readinto_obj, 1, onewireio_onewire_obj_readinto);
+
+//|     def write(self, buffer: ReadableBuffer, *, start: int = 0, end: int = sys.maxsize) -> None:
+//|         """Write the bytes in ``buffer``, least significant bit first.
+//|
+//|         If ``start`` or ``end`` is provided, then the buffer will be sliced
+//|         as if ``buffer[start:end]`` were passed, but without copying the data.
+//|
+//|         :param ReadableBuffer buffer: buffer containing the bytes to write
+//|         :param int start: beginning of buffer slice
+//|         :param int end: end of buffer slice; if not specified, use ``len(buffer)``"""
+//|         ...
+STATIC mp_obj_t onewireio_onewire_obj_write(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_start, ARG_end };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer,     MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_start,      MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_end,        MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = INT_MAX} },
+    };
+    onewireio_onewire_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_READ);
+    int stride_in_bytes = mp_binary_get_size('@', bufinfo.typecode, NULL);
+    // Compute bounds in terms of elements, not bytes.
+    int32_t start = args[ARG_start].u_int;
+    size_t length = bufinfo.len / stride_in_bytes;
+    normalize_buffer_bounds(&start, args[ARG_end].u_int, &length);
+
+    common_hal_onewireio_onewire_write(self, ((uint8_t *)bufinfo.buf) + start * stride_in_bytes, length * stride_in_bytes);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(onewireio_onewire_write_obj, 1, onewireio_onewire_obj_write);
+
+//|     def search(self) -> List[bytes]:
+//|         """Find the ROM of every device on the bus.
+//|
+//|         :returns: one 8 byte ROM per device, family code first. The CRC in
+//|           the last byte is not checked.
+//|         :rtype: List[bytes]"""
+//|         ...
+STATIC mp_obj_t onewireio_onewire_obj_search(mp_obj_t self_in) {
+    onewireio_onewire_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    mp_obj_t roms = mp_obj_new_list(0, NULL);
+    onewireio_onewire_search_t search;
+    common_hal_onewireio_onewire_search_start(&search);
+    while (common_hal_onewireio_onewire_search_next(self, &search)) {
+        mp_obj_list_append(roms, mp_obj_new_bytes(search.rom, ONEWIREIO_ROM_LENGTH));
+    }
+    return roms;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(onewireio_onewire_search_obj, onewireio_onewire_obj_search);
+
+//|     def read_scratchpads(
+//|         self,
+//|         roms: Sequence[ReadableBuffer],
+//|         buffer: WriteableBuffer,
+//|         *,
+//|         convert: bool = True,
+//|         timeout: float = 1.0
+//|     ) -> None:
+//|         """Start a conversion on every device at once, wait for them all to finish and then
+//|         read the 9 byte scratchpad of each device in ``roms`` into consecutive slices of
+//|         ``buffer``. This suits DS18B20 and similar temperature sensors, which otherwise
+//|         take up to 750ms each to convert.
+//|
+//|         The end of the conversion is found by polling the bus, so parasite powered
+//|         devices are not supported with ``convert=True``.
+//|
+//|         :param Sequence[ReadableBuffer] roms: the 8 byte ROM of each device to read,
+//|           as returned by `search`
+//|         :param WriteableBuffer buffer: at least ``9 * len(roms)`` bytes to read into
+//|         :param bool convert: send Convert T (``0x44``) to every device before reading
+//|         :param float timeout: the longest time to wait for the conversion, in seconds
+//|
+//|         Raises ``OSError`` with ``ENODEV`` when no device answers a reset and
+//|         ``TimeoutError`` when the conversion doesn't finish in time."""
+//|         ...
+//|
+STATIC mp_obj_t onewireio_onewire_obj_read_scratchpads(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_roms, ARG_buffer, ARG_convert, ARG_timeout };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_roms,       MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_buffer,     MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_convert,    MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
+        { MP_QSTR_timeout,    MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+    };
+    onewireio_onewire_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    size_t rom_count;
+    mp_obj_t *roms;
+    mp_obj_get_array(args[ARG_roms].u_obj, &rom_count, &roms);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_WRITE);
+    mp_arg_validate_length_min(bufinfo.len, ONEWIREIO_SCRATCHPAD_LENGTH * rom_count, MP_QSTR_buffer);
+    mp_float_t timeout = mp_arg_validate_obj_float_non_negative(args[ARG_timeout].u_obj, 1.0f, MP_QSTR_timeout);
+    for (size_t i = 0; i < rom_count; i++) {
+        mp_buffer_info_t rominfo;
+        mp_get_buffer_raise(roms[i], &rominfo, MP_BUFFER_READ);
+        mp_arg_validate_length(rominfo.len, ONEWIREIO_ROM_LENGTH, MP_QSTR_roms);
+    }
+
+    if (args[ARG_convert].u_bool) {
+        if (!common_hal_onewireio_onewire_select(self, NULL)) {
+            mp_raise_OSError(MP_ENODEV);
+        }
+        const uint8_t convert_t = ONEWIREIO_CONVERT_T;
+        common_hal_onewireio_onewire_write(self, &convert_t, 1);
+        if (!common_hal_onewireio_onewire_wait_for_ready(self, (uint32_t)(timeout * 1000))) {
+            // A ctrl-C raises on its own once we return to the VM.
+            if (mp_hal_is_interrupted()) {
+                return mp_const_none;
+            }
+            mp_raise_msg(&mp_type_TimeoutError, NULL);
+        }
+    }
+
+    uint8_t *scratchpad = bufinfo.buf;
+    for (size_t i = 0; i < rom_count; i++) {
+        mp_buffer_info_t rominfo;
+        mp_get_buffer_raise(roms[i], &rominfo, MP_BUFFER_READ);
+        if (!common_hal_onewireio_onewire_select(self, rominfo.buf)) {
+            mp_raise_OSError(MP_ENODEV);
+        }
+        const uint8_t read_scratchpad = ONEWIREIO_READ_SCRATCHPAD;
+        common_hal_onewireio_onewire_write(self, &read_scratchpad, 1);
+        common_hal_onewireio_onewire_readinto(self, scratchpad, ONEWIREIO_SCRATCHPAD_LENGTH);
+        scratchpad += ONEWIREIO_SCRATCHPAD_LENGTH;
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(onewireio_onewire_read_scratchpads_obj, 1, onewireio_onewire_obj_read_scratchpads);
+
 STATIC const mp_rom_map_elem_t onewireio_onewire_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&onewireio_onewire_deinit_obj) },
@@ -148,6 +326,10 @@ STATIC const mp_rom_map_elem_t onewireio_onewire_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_reset), MP_ROM_PTR(&onewireio_onewire_reset_obj) },
     { MP_ROM_QSTR(MP_QSTR_read_bit), MP_ROM_PTR(&onewireio_onewire_read_bit_obj) },
     { MP_ROM_QSTR(MP_QSTR_write_bit), MP_ROM_PTR(&onewireio_onewire_write_bit_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&onewireio_onewire_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&onewireio_onewire_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_search), MP_ROM_PTR(&onewireio_onewire_search_obj) },
+    { MP_ROM_QSTR(MP_QSTR_read_scratchpads), MP_ROM_PTR(&onewireio_onewire_read_scratchpads_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(onewireio_onewire_locals_dict, onewireio_onewire_locals_dict_table);
 
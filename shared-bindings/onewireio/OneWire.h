@@ -39,5 +39,16 @@ extern bool common_hal_onewireio_onewire_deinited(onewireio_onewire_obj_t *self)
 extern bool common_hal_onewireio_onewire_reset(onewireio_onewire_obj_t *self);
 extern bool common_hal_onewireio_onewire_read_bit(onewireio_onewire_obj_t *self);
 extern void common_hal_onewireio_onewire_write_bit(onewireio_onewire_obj_t *self, bool bit);
+extern void common_hal_onewireio_onewire_write(onewireio_onewire_obj_t *self, const uint8_t *data, size_t len);
+extern void common_hal_onewireio_onewire_readinto(onewireio_onewire_obj_t *self, uint8_t *data, size_t len);
+// Resets the bus and addresses the device with the given ROM, or every device
+// when rom is NULL. Returns false when no device is present.
+extern bool common_hal_onewireio_onewire_select(onewireio_onewire_obj_t *self, const uint8_t *rom);
+// Waits for the addressed devices to read back a one, such as at the end of a
+// conversion. Returns false on timeout or ctrl-C.
+extern bool common_hal_onewireio_onewire_wait_for_ready(onewireio_onewire_obj_t *self, uint32_t timeout_ms);
+extern void common_hal_onewireio_onewire_search_start(onewireio_onewire_search_t *search);
+// Finds the next device ROM and stores it in search->rom. Returns false when there are no more.
+extern bool common_hal_onewireio_onewire_search_next(onewireio_onewire_obj_t *self, onewireio_onewire_search_t *search);
 
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_ONEWIREIO_ONEWIRE_H
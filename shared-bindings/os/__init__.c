@@ -36,6 +36,7 @@
 #include "py/objstr.h"
 #include "py/runtime.h"
 #include "shared-bindings/os/__init__.h"
+#include "supervisor/filesystem.h"
 
 //| """functions that an OS normally provides
 //|
@@ -243,7 +244,8 @@ STATIC mp_obj_t os_statvfs(mp_obj_t path_in) {
 MP_DEFINE_CONST_FUN_OBJ_1(os_statvfs_obj, os_statvfs);
 
 //| def sync() -> None:
-//|     """Sync all filesystems."""
+//|     """Sync all filesystems. On boards that write CIRCUITPY behind, this also
+//|     waits until everything written to it is on the flash."""
 //|     ...
 //|
 STATIC mp_obj_t os_sync(void) {
@@ -251,6 +253,9 @@ STATIC mp_obj_t os_sync(void) {
         // this assumes that vfs->obj is fs_user_mount_t with block device functions
         disk_ioctl(MP_OBJ_TO_PTR(vfs->obj), CTRL_SYNC, NULL);
     }
+    #if CIRCUITPY_FILESYSTEM_WRITE_BEHIND
+    filesystem_write_behind_sync();
+    #endif
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_0(os_sync_obj, os_sync);
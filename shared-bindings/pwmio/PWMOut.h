@@ -49,6 +49,9 @@ extern void common_hal_pwmio_pwmout_deinit(pwmio_pwmout_obj_t *self);
 extern bool common_hal_pwmio_pwmout_deinited(pwmio_pwmout_obj_t *self);
 extern void common_hal_pwmio_pwmout_set_duty_cycle(pwmio_pwmout_obj_t *self, uint16_t duty);
 extern uint16_t common_hal_pwmio_pwmout_get_duty_cycle(pwmio_pwmout_obj_t *self);
+// Ports with buffered compare registers stage every duty cycle first so that
+// they take effect together at a period boundary.
+extern void common_hal_pwmio_pwmout_set_duty_cycles(pwmio_pwmout_obj_t **pwms, const uint16_t *duty_cycles, size_t count);
 extern void common_hal_pwmio_pwmout_set_frequency(pwmio_pwmout_obj_t *self, uint32_t frequency);
 extern uint32_t common_hal_pwmio_pwmout_get_frequency(pwmio_pwmout_obj_t *self);
 extern bool common_hal_pwmio_pwmout_get_variable_frequency(pwmio_pwmout_obj_t *self);
@@ -32,6 +32,7 @@
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/pwmio/__init__.h"
 #include "shared-bindings/pwmio/PWMOut.h"
+#include "shared-bindings/util.h"
 
 //| """Support for PWM based protocols
 //|
@@ -61,10 +62,53 @@
 //| For the essentials of `pwmio`, see the `CircuitPython Essentials
 //| Learn guide <https://learn.adafruit.com/circuitpython-essentials/circuitpython-pwm>`_.
 //| """
+//|
+
+//| def set_duty_cycles(pwms: Sequence[PWMOut], duty_cycles: Sequence[int]) -> None:
+//|     """Set the `PWMOut.duty_cycle` of several outputs together.
+//|
+//|     Where the hardware buffers its compare registers (SAMD TCC, RP2040 and
+//|     ESP32 LEDC) all of the new values are written before any of them are
+//|     used, and each timer switches to them at the end of its current period.
+//|     Outputs sharing a timer, or on timers running in phase, change in the
+//|     same period without glitches. Elsewhere the outputs are set in order.
+//|
+//|     :param Sequence[PWMOut] pwms: The outputs to update
+//|     :param Sequence[int] duty_cycles: The new duty cycles, one per output, from 0 to 65535"""
+//|     ...
+//|
+STATIC mp_obj_t pwmio_set_duty_cycles(mp_obj_t pwms_in, mp_obj_t duty_cycles_in) {
+    // mp_obj_len() will be >= 0.
+    const size_t count = (size_t)MP_OBJ_SMALL_INT_VALUE(mp_obj_len(pwms_in));
+    mp_arg_validate_length((size_t)MP_OBJ_SMALL_INT_VALUE(mp_obj_len(duty_cycles_in)), count, MP_QSTR_duty_cycles);
+
+    pwmio_pwmout_obj_t *pwms[count];
+    uint16_t duty_cycles[count];
+    for (size_t i = 0; i < count; i++) {
+        mp_obj_t index = MP_OBJ_NEW_SMALL_INT(i);
+        pwms[i] = MP_OBJ_TO_PTR(mp_arg_validate_type(mp_obj_subscr(pwms_in, index, MP_OBJ_SENTINEL), &pwmio_pwmout_type, MP_QSTR_pwms));
+        if (common_hal_pwmio_pwmout_deinited(pwms[i])) {
+            raise_deinited_error();
+        }
+        duty_cycles[i] = mp_arg_validate_int_range(mp_obj_get_int(mp_obj_subscr(duty_cycles_in, index, MP_OBJ_SENTINEL)),
+            0, 0xffff, MP_QSTR_duty_cycle);
+    }
+    common_hal_pwmio_pwmout_set_duty_cycles(pwms, duty_cycles, count);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(pwmio_set_duty_cycles_obj, pwmio_set_duty_cycles);
+
+// Ports without buffered compare registers set the outputs one at a time.
+MP_WEAK void common_hal_pwmio_pwmout_set_duty_cycles(pwmio_pwmout_obj_t **pwms, const uint16_t *duty_cycles, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        common_hal_pwmio_pwmout_set_duty_cycle(pwms[i], duty_cycles[i]);
+    }
+}
 
 STATIC const mp_rom_map_elem_t pwmio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_pwmio) },
     { MP_ROM_QSTR(MP_QSTR_PWMOut), MP_ROM_PTR(&pwmio_pwmout_type) },
+    { MP_ROM_QSTR(MP_QSTR_set_duty_cycles), MP_ROM_PTR(&pwmio_set_duty_cycles_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(pwmio_module_globals, pwmio_module_globals_table);
@@ -69,17 +69,53 @@ STATIC void verify_buffer_size(qrio_qrdecoder_obj_t *self, mp_obj_t *buffer, siz
     mp_get_index(mp_obj_get_type(*buffer), len, MP_OBJ_NEW_SMALL_INT(sz - 1), false);
 }
 
+STATIC void get_region(qrio_qrdecoder_obj_t *self, mp_obj_t roi, mp_int_t scale, qrio_qrdecoder_region_t *region) {
+    int width = shared_module_qrio_qrdecoder_get_width(self);
+    int height = shared_module_qrio_qrdecoder_get_height(self);
+    if (scale != 1 && scale != 2 && scale != 4) {
+        mp_arg_error_invalid(MP_QSTR_scale);
+    }
+    region->scale = scale;
+    if (roi == mp_const_none) {
+        region->x = 0;
+        region->y = 0;
+        region->width = width;
+        region->height = height;
+    } else {
+        mp_obj_t *items;
+        mp_obj_get_array_fixed_n(roi, 4, &items);
+        region->x = mp_arg_validate_int_range(mp_obj_get_int(items[0]), 0, width - 1, MP_QSTR_x);
+        region->y = mp_arg_validate_int_range(mp_obj_get_int(items[1]), 0, height - 1, MP_QSTR_y);
+        region->width = mp_arg_validate_int_range(mp_obj_get_int(items[2]), 1, width - region->x, MP_QSTR_width);
+        region->height = mp_arg_validate_int_range(mp_obj_get_int(items[3]), 1, height - region->y, MP_QSTR_height);
+    }
+    mp_arg_validate_int_min(region->width, scale, MP_QSTR_width);
+    mp_arg_validate_int_min(region->height, scale, MP_QSTR_height);
+}
+
 //|     def decode(
-//|         self, buffer: ReadableBuffer, pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE
+//|         self,
+//|         buffer: ReadableBuffer,
+//|         pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE,
+//|         *,
+//|         roi: Optional[Tuple[int, int, int, int]] = None,
+//|         scale: int = 1,
 //|     ) -> List[QRInfo]:
-//|         """Decode zero or more QR codes from the given image.  The size of the buffer must be at least ``length``×``width`` bytes for `EVERY_BYTE`, and 2×``length``×``width`` bytes for `EVEN_BYTES` or `ODD_BYTES`."""
+//|         """Decode zero or more QR codes from the given image.  The size of the buffer must be at least ``length``×``width`` bytes for `EVERY_BYTE`, and 2×``length``×``width`` bytes for `EVEN_BYTES` or `ODD_BYTES`.
+//|
+//|         :param roi: Only decode the ``(x, y, width, height)`` part of the image
+//|         :param int scale: Shrink the image by 1, 2 or 4 in each direction before decoding. Each output
+//|           pixel is the average of a block of input pixels. Shrinking is much faster and works well
+//|           when the code covers a large part of the image."""
 STATIC mp_obj_t qrio_qrdecoder_decode(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
 
-    enum { ARG_buffer, ARG_pixel_policy };
+    enum { ARG_buffer, ARG_pixel_policy, ARG_roi, ARG_scale };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_buffer, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_int = 0} },
         { MP_QSTR_pixel_policy, MP_ARG_OBJ, {.u_obj = MP_ROM_PTR((mp_obj_t *)&qrio_pixel_policy_EVERY_BYTE_obj)} },
+        { MP_QSTR_roi, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_scale, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -88,23 +124,36 @@ STATIC mp_obj_t qrio_qrdecoder_decode(size_t n_args, const mp_obj_t *pos_args, m
     mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_READ);
     qrio_pixel_policy_t policy = cp_enum_value(&qrio_pixel_policy_type, args[ARG_pixel_policy].u_obj, MP_QSTR_pixel_policy);
     verify_buffer_size(self, &args[ARG_buffer].u_obj, bufinfo.len, policy);
+    qrio_qrdecoder_region_t region;
+    get_region(self, args[ARG_roi].u_obj, args[ARG_scale].u_int, &region);
 
-    return shared_module_qrio_qrdecoder_decode(self, &bufinfo, policy);
+    return shared_module_qrio_qrdecoder_decode(self, &bufinfo, policy, &region);
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(qrio_qrdecoder_decode_obj, 1, qrio_qrdecoder_decode);
 
 
 //|     def find(
-//|         self, buffer: ReadableBuffer, pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE
+//|         self,
+//|         buffer: ReadableBuffer,
+//|         pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE,
+//|         *,
+//|         roi: Optional[Tuple[int, int, int, int]] = None,
+//|         scale: int = 1,
 //|     ) -> List[QRPosition]:
-//|         """Find all visible QR codes from the given image.  The size of the buffer must be at least ``length``×``width`` bytes for `EVERY_BYTE`, and 2×``length``×``width`` bytes for `EVEN_BYTES` or `ODD_BYTES`."""
+//|         """Find all visible QR codes from the given image.  The size of the buffer must be at least ``length``×``width`` bytes for `EVERY_BYTE`, and 2×``length``×``width`` bytes for `EVEN_BYTES` or `ODD_BYTES`.
+//|
+//|         :param roi: Only search the ``(x, y, width, height)`` part of the image
+//|         :param int scale: Shrink the image by 1, 2 or 4 in each direction before searching. Positions
+//|           are always reported in coordinates of the full image."""
 STATIC mp_obj_t qrio_qrdecoder_find(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
 
-    enum { ARG_buffer, ARG_pixel_policy };
+    enum { ARG_buffer, ARG_pixel_policy, ARG_roi, ARG_scale };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_buffer, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_int = 0} },
         { MP_QSTR_pixel_policy, MP_ARG_OBJ, {.u_obj = MP_ROM_PTR((mp_obj_t *)&qrio_pixel_policy_EVERY_BYTE_obj)} },
+        { MP_QSTR_roi, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_scale, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -113,8 +162,10 @@ STATIC mp_obj_t qrio_qrdecoder_find(size_t n_args, const mp_obj_t *pos_args, mp_
     mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_READ);
     qrio_pixel_policy_t policy = cp_enum_value(&qrio_pixel_policy_type, args[ARG_pixel_policy].u_obj, MP_QSTR_pixel_policy);
     verify_buffer_size(self, &args[ARG_buffer].u_obj, bufinfo.len, policy);
+    qrio_qrdecoder_region_t region;
+    get_region(self, args[ARG_roi].u_obj, args[ARG_scale].u_int, &region);
 
-    return shared_module_qrio_qrdecoder_find(self, &bufinfo, policy);
+    return shared_module_qrio_qrdecoder_find(self, &bufinfo, policy, &region);
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(qrio_qrdecoder_find_obj, 1, qrio_qrdecoder_find);
 
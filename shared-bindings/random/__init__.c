@@ -73,6 +73,19 @@ STATIC mp_obj_t random_getrandbits(mp_obj_t num_in) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(random_getrandbits_obj, random_getrandbits);
 
+//| def randbytes_into(buffer: WriteableBuffer) -> None:
+//|     """Fills *buffer* with random bytes. This is much faster than filling it a byte at a time
+//|     with `getrandbits`."""
+//|     ...
+//|
+STATIC mp_obj_t random_randbytes_into(mp_obj_t buffer_in) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_WRITE);
+    shared_modules_random_randbytes_into(bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(random_randbytes_into_obj, random_randbytes_into);
+
 //| @overload
 //| def randrange(stop: int) -> int: ...
 //| @overload
@@ -174,6 +187,7 @@ STATIC const mp_rom_map_elem_t mp_module_random_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_random) },
     { MP_ROM_QSTR(MP_QSTR_seed), MP_ROM_PTR(&random_seed_obj) },
     { MP_ROM_QSTR(MP_QSTR_getrandbits), MP_ROM_PTR(&random_getrandbits_obj) },
+    { MP_ROM_QSTR(MP_QSTR_randbytes_into), MP_ROM_PTR(&random_randbytes_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_randrange), MP_ROM_PTR(&random_randrange_obj) },
     { MP_ROM_QSTR(MP_QSTR_randint), MP_ROM_PTR(&random_randint_obj) },
     { MP_ROM_QSTR(MP_QSTR_choice), MP_ROM_PTR(&random_choice_obj) },
@@ -33,6 +33,7 @@
 
 void shared_modules_random_seed(mp_uint_t seed);
 mp_uint_t shared_modules_random_getrandbits(uint8_t n);
+void shared_modules_random_randbytes_into(uint8_t *buffer, size_t length);
 mp_int_t shared_modules_random_randrange(mp_int_t start, mp_int_t stop, mp_int_t step);
 mp_float_t shared_modules_random_random(void);
 mp_float_t shared_modules_random_uniform(mp_float_t a, mp_float_t b);
@@ -199,6 +199,28 @@ STATIC mp_obj_t _sdioio_sdcard_writeblocks(mp_obj_t self_in, mp_obj_t start_bloc
 
 MP_DEFINE_CONST_FUN_OBJ_3(sdioio_sdcard_writeblocks_obj, _sdioio_sdcard_writeblocks);
 
+//|     def sync(self) -> None:
+//|         """Finish any writes that `writeblocks` has not yet sent to the card.
+//|
+//|         Some ports return from `writeblocks` once the data is queued. The
+//|         filesystem calls this when it syncs.
+//|
+//|         :return: None"""
+STATIC mp_obj_t _sdioio_sdcard_sync(mp_obj_t self_in) {
+    sdioio_sdcard_obj_t *self = (sdioio_sdcard_obj_t *)self_in;
+    int result = common_hal_sdioio_sdcard_sync(self);
+    if (result < 0) {
+        mp_raise_OSError(-result);
+    }
+    return mp_const_none;
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(sdioio_sdcard_sync_obj, _sdioio_sdcard_sync);
+
+MP_WEAK int common_hal_sdioio_sdcard_sync(sdioio_sdcard_obj_t *self) {
+    return 0;
+}
+
 //|     frequency: int
 //|     """The actual SDIO bus frequency. This may not match the frequency
 //|     requested due to internal limitations."""
@@ -264,6 +286,7 @@ STATIC const mp_rom_map_elem_t sdioio_sdcard_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_count), MP_ROM_PTR(&sdioio_sdcard_count_obj) },
     { MP_ROM_QSTR(MP_QSTR_readblocks), MP_ROM_PTR(&sdioio_sdcard_readblocks_obj) },
     { MP_ROM_QSTR(MP_QSTR_writeblocks), MP_ROM_PTR(&sdioio_sdcard_writeblocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sync), MP_ROM_PTR(&sdioio_sdcard_sync_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(sdioio_sdcard_locals_dict, sdioio_sdcard_locals_dict_table);
 
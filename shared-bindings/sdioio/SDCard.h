@@ -60,6 +60,9 @@ uint32_t common_hal_sdioio_sdcard_get_count(sdioio_sdcard_obj_t *self);
 int common_hal_sdioio_sdcard_readblocks(sdioio_sdcard_obj_t *self, uint32_t start_block, mp_buffer_info_t *bufinfo);
 int common_hal_sdioio_sdcard_writeblocks(sdioio_sdcard_obj_t *self, uint32_t start_block, mp_buffer_info_t *bufinfo);
 
+// Send any queued writes to the card and wait for them to be programmed
+int common_hal_sdioio_sdcard_sync(sdioio_sdcard_obj_t *self);
+
 // This is used by the supervisor to claim SDIO devices indefinitely.
 extern void common_hal_sdioio_sdcard_never_reset(sdioio_sdcard_obj_t *self);
 
@@ -32,6 +32,7 @@
 
 #include "py/mperrno.h"
 #include "py/objlist.h"
+#include "py/objproperty.h"
 #include "py/objtuple.h"
 #include "py/runtime.h"
 #include "py/stream.h"
@@ -401,6 +402,25 @@ STATIC mp_obj_t socketpool_socket_settimeout(mp_obj_t self_in, mp_obj_t timeout_
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_settimeout_obj, socketpool_socket_settimeout);
 
+#if CIRCUITPY_NETWORK_STATS
+//|     stats: SocketStats
+//|     """Traffic and wait times since the socket was created or accepted. Raises
+//|     `NotImplementedError` on ports that don't keep them. (read-only)"""
+//|
+STATIC mp_obj_t socketpool_socket_get_stats(mp_obj_t self_in) {
+    socketpool_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_socketpool_socket_get_stats(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(socketpool_socket_get_stats_obj, socketpool_socket_get_stats);
+
+MP_PROPERTY_GETTER(socketpool_socket_stats_obj,
+    (mp_obj_t)&socketpool_socket_get_stats_obj);
+
+MP_WEAK mp_obj_t common_hal_socketpool_socket_get_stats(socketpool_socket_obj_t *self) {
+    mp_raise_NotImplementedError(NULL);
+}
+#endif
+
 STATIC const mp_rom_map_elem_t socketpool_socket_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&socketpool_socket___exit___obj) },
@@ -419,6 +439,10 @@ STATIC const mp_rom_map_elem_t socketpool_socket_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_setblocking), MP_ROM_PTR(&socketpool_socket_setblocking_obj) },
     { MP_ROM_QSTR(MP_QSTR_setsockopt), MP_ROM_PTR(&socketpool_socket_setsockopt_obj) },
     { MP_ROM_QSTR(MP_QSTR_settimeout), MP_ROM_PTR(&socketpool_socket_settimeout_obj) },
+
+    #if CIRCUITPY_NETWORK_STATS
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&socketpool_socket_stats_obj) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(socketpool_socket_locals_dict, socketpool_socket_locals_dict_table);
@@ -476,3 +500,41 @@ MP_DEFINE_CONST_OBJ_TYPE(
     locals_dict, &socketpool_socket_locals_dict,
     protocol, &socket_stream_p
     );
+
+#if CIRCUITPY_NETWORK_STATS
+//| class SocketStats:
+//|     """Traffic through one socket. Times are in milliseconds and counters wrap around at
+//|     2**32."""
+//|
+//|     bytes_sent: int
+//|     """Bytes handed to the network stack"""
+//|
+//|     bytes_received: int
+//|     """Bytes read from the network stack"""
+//|
+//|     send_stalls: int
+//|     """Sends that couldn't queue anything because the send buffer was full, usually because
+//|     the peer's receive window was closed"""
+//|
+//|     recv_wait_ms: int
+//|     """Total time receives spent waiting for data"""
+//|
+//|     max_recv_wait_ms: int
+//|     """Longest time a single receive waited for data"""
+//|
+//|     connect_ms: int
+//|     """Time taken by `Socket.connect`, or 0"""
+//|
+const mp_obj_namedtuple_type_t socketpool_socket_stats_type = {
+    NAMEDTUPLE_TYPE_BASE_AND_SLOTS(MP_QSTR_SocketStats),
+    .n_fields = 6,
+    .fields = {
+        MP_QSTR_bytes_sent,
+        MP_QSTR_bytes_received,
+        MP_QSTR_send_stalls,
+        MP_QSTR_recv_wait_ms,
+        MP_QSTR_max_recv_wait_ms,
+        MP_QSTR_connect_ms,
+    },
+};
+#endif
@@ -29,7 +29,10 @@
 
 #include "common-hal/socketpool/Socket.h"
 
+#include "py/objnamedtuple.h"
+
 extern const mp_obj_type_t socketpool_socket_type;
+extern const mp_obj_namedtuple_type_t socketpool_socket_stats_type;
 
 socketpool_socket_obj_t *common_hal_socketpool_socket_accept(socketpool_socket_obj_t *self, uint8_t *ip, uint32_t *port);
 size_t common_hal_socketpool_socket_bind(socketpool_socket_obj_t *self, const char *host, size_t hostlen, uint32_t port);
@@ -49,6 +52,8 @@ void common_hal_socketpool_socket_settimeout(socketpool_socket_obj_t *self, uint
 int common_hal_socketpool_socket_setsockopt(socketpool_socket_obj_t *self, int level, int optname, const void *value, size_t optlen);
 bool common_hal_socketpool_readable(socketpool_socket_obj_t *self);
 bool common_hal_socketpool_writable(socketpool_socket_obj_t *self);
+// Returns a socketpool_socket_stats_type namedtuple.
+mp_obj_t common_hal_socketpool_socket_get_stats(socketpool_socket_obj_t *self);
 
 // Non-allocating versions for internal use.
 int socketpool_socket_accept(socketpool_socket_obj_t *self, uint8_t *ip, uint32_t *port, socketpool_socket_obj_t *accepted);
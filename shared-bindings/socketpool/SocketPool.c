@@ -35,6 +35,7 @@
 #include "shared-bindings/ipaddress/__init__.h"
 #include "shared-bindings/socketpool/Socket.h"
 #include "shared-bindings/socketpool/SocketPool.h"
+#include "supervisor/shared/tick.h"
 
 //| class SocketPool:
 //|     """A pool of socket resources available for the given radio. Only one
@@ -70,6 +71,67 @@ STATIC mp_obj_t socketpool_socketpool_make_new(const mp_obj_type_t *type, size_t
 //|
 MP_DEFINE_EXCEPTION(gaierror, OSError)
 
+// lwIP caches successful lookups for their TTL, but not failures, so a name
+// that doesn't resolve is looked up again on every retry. Remember a few of
+// them briefly.
+#ifndef SOCKETPOOL_NEGATIVE_CACHE_SIZE
+#define SOCKETPOOL_NEGATIVE_CACHE_SIZE (4)
+#endif
+#ifndef SOCKETPOOL_NEGATIVE_CACHE_MS
+#define SOCKETPOOL_NEGATIVE_CACHE_MS (10000)
+#endif
+
+typedef struct {
+    uint32_t host_hash;
+    uint32_t failed_at;
+    bool used;
+} socketpool_negative_entry_t;
+
+STATIC socketpool_negative_entry_t negative_cache[SOCKETPOOL_NEGATIVE_CACHE_SIZE];
+STATIC uint8_t negative_cache_next;
+
+STATIC uint32_t hash_host(const char *host) {
+    uint32_t hash = 2166136261u;
+    while (*host) {
+        hash = (hash ^ (uint8_t)*host++) * 16777619u;
+    }
+    return hash;
+}
+
+STATIC socketpool_negative_entry_t *find_negative(uint32_t host_hash) {
+    for (size_t i = 0; i < SOCKETPOOL_NEGATIVE_CACHE_SIZE; i++) {
+        socketpool_negative_entry_t *entry = &negative_cache[i];
+        if (entry->used && entry->host_hash == host_hash) {
+            if (supervisor_ticks_ms32() - entry->failed_at < SOCKETPOOL_NEGATIVE_CACHE_MS) {
+                return entry;
+            }
+            entry->used = false;
+        }
+    }
+    return NULL;
+}
+
+STATIC mp_obj_t gethostbyname_cached(socketpool_socketpool_obj_t *self, const char *host) {
+    uint32_t host_hash = hash_host(host);
+    if (find_negative(host_hash) != NULL) {
+        common_hal_socketpool_socketpool_raise_gaierror_noname();
+    }
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_obj_t ip_str = common_hal_socketpool_socketpool_gethostbyname_raise(self, host);
+        nlr_pop();
+        return ip_str;
+    }
+    if (mp_obj_is_subclass_fast(MP_OBJ_FROM_PTR(((mp_obj_base_t *)nlr.ret_val)->type), MP_OBJ_FROM_PTR(&mp_type_gaierror))) {
+        socketpool_negative_entry_t *entry = &negative_cache[negative_cache_next];
+        negative_cache_next = (negative_cache_next + 1) % SOCKETPOOL_NEGATIVE_CACHE_SIZE;
+        entry->host_hash = host_hash;
+        entry->failed_at = supervisor_ticks_ms32();
+        entry->used = true;
+    }
+    nlr_jump(nlr.ret_val);
+}
+
 //|
 //|     AF_INET: int
 //|     AF_INET6: int
@@ -144,7 +206,10 @@ MP_DEFINE_CONST_FUN_OBJ_KW(socketpool_socketpool_socket_obj, 1, socketpool_socke
 //|
 //|         Returns the appropriate family, socket type, socket protocol and
 //|         address information to call socket.socket() and socket.connect() with,
-//|         as a tuple."""
+//|         as a tuple.
+//|
+//|         Answers are cached for their DNS TTL. A host that fails to resolve
+//|         raises `gaierror` again without a lookup for the next 10 seconds."""
 //|         ...
 //|
 STATIC mp_obj_t socketpool_socketpool_getaddrinfo(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
@@ -171,7 +236,7 @@ STATIC mp_obj_t socketpool_socketpool_getaddrinfo(size_t n_args, const mp_obj_t
     }
 
     if (ip_str == mp_const_none) {
-        ip_str = common_hal_socketpool_socketpool_gethostbyname_raise(self, host);
+        ip_str = gethostbyname_cached(self, host);
     }
 
     mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(mp_obj_new_tuple(5, NULL));
@@ -45,6 +45,9 @@ STATIC const mp_rom_map_elem_t socketpool_globals_table[] = {
 
     { MP_ROM_QSTR(MP_QSTR_SocketPool), MP_ROM_PTR(&socketpool_socketpool_type) },
     { MP_ROM_QSTR(MP_QSTR_Socket), MP_ROM_PTR(&socketpool_socket_type) },
+    #if CIRCUITPY_NETWORK_STATS
+    { MP_ROM_QSTR(MP_QSTR_SocketStats), MP_ROM_PTR(&socketpool_socket_stats_type) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(socketpool_globals, socketpool_globals_table);
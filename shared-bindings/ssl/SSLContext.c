@@ -168,6 +168,47 @@ MP_PROPERTY_GETSET(ssl_sslcontext_check_hostname_obj,
     (mp_obj_t)&ssl_sslcontext_get_check_hostname_obj,
     (mp_obj_t)&ssl_sslcontext_set_check_hostname_obj);
 
+//|     def save_sessions(self) -> bytes:
+//|         """Return the TLS sessions cached by this context, so they can be kept
+//|         somewhere that survives deep sleep such as `alarm.sleep_memory` or
+//|         `microcontroller.nvm`.
+//|
+//|         Client sockets wrapped with a ``server_hostname`` offer the last session
+//|         negotiated with that host, which lets the server skip the full handshake.
+//|         The data includes session secrets, so treat it like a private key."""
+
+STATIC mp_obj_t ssl_sslcontext_save_sessions(mp_obj_t self_in) {
+    ssl_sslcontext_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    return common_hal_ssl_sslcontext_save_sessions(self);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(ssl_sslcontext_save_sessions_obj, ssl_sslcontext_save_sessions);
+
+//|     def load_sessions(self, data: ReadableBuffer) -> None:
+//|         """Add sessions returned by `save_sessions` to this context's cache.
+//|         Sessions the server no longer accepts fall back to a full handshake."""
+
+STATIC mp_obj_t ssl_sslcontext_load_sessions(mp_obj_t self_in, mp_obj_t data) {
+    ssl_sslcontext_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    common_hal_ssl_sslcontext_load_sessions(self, bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(ssl_sslcontext_load_sessions_obj, ssl_sslcontext_load_sessions);
+
+//|     def clear_sessions(self) -> None:
+//|         """Forget all cached TLS sessions."""
+
+STATIC mp_obj_t ssl_sslcontext_clear_sessions(mp_obj_t self_in) {
+    ssl_sslcontext_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    common_hal_ssl_sslcontext_clear_sessions(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(ssl_sslcontext_clear_sessions_obj, ssl_sslcontext_clear_sessions);
+
 //|     def wrap_socket(
 //|         self,
 //|         sock: socketpool.Socket,
@@ -212,6 +253,9 @@ STATIC const mp_rom_map_elem_t ssl_sslcontext_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_load_verify_locations), MP_ROM_PTR(&ssl_sslcontext_load_verify_locations_obj) },
     { MP_ROM_QSTR(MP_QSTR_set_default_verify_paths), MP_ROM_PTR(&ssl_sslcontext_set_default_verify_paths_obj) },
     { MP_ROM_QSTR(MP_QSTR_check_hostname), MP_ROM_PTR(&ssl_sslcontext_check_hostname_obj) },
+    { MP_ROM_QSTR(MP_QSTR_save_sessions), MP_ROM_PTR(&ssl_sslcontext_save_sessions_obj) },
+    { MP_ROM_QSTR(MP_QSTR_load_sessions), MP_ROM_PTR(&ssl_sslcontext_load_sessions_obj) },
+    { MP_ROM_QSTR(MP_QSTR_clear_sessions), MP_ROM_PTR(&ssl_sslcontext_clear_sessions_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(ssl_sslcontext_locals_dict, ssl_sslcontext_locals_dict_table);
@@ -52,4 +52,8 @@ bool common_hal_ssl_sslcontext_get_check_hostname(ssl_sslcontext_obj_t *self);
 void common_hal_ssl_sslcontext_set_check_hostname(ssl_sslcontext_obj_t *self, bool value);
 void common_hal_ssl_sslcontext_load_cert_chain(ssl_sslcontext_obj_t *self, mp_buffer_info_t *cert_buf, mp_buffer_info_t *key_buf);
 
+mp_obj_t common_hal_ssl_sslcontext_save_sessions(ssl_sslcontext_obj_t *self);
+void common_hal_ssl_sslcontext_load_sessions(ssl_sslcontext_obj_t *self, const uint8_t *buf, size_t len);
+void common_hal_ssl_sslcontext_clear_sessions(ssl_sslcontext_obj_t *self);
+
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_SSL_SSLCONTEXT_H
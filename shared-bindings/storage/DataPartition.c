@@ -0,0 +1,159 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "extmod/vfs.h"
+#include "py/runtime.h"
+#include "shared-bindings/storage/DataPartition.h"
+
+#if CIRCUITPY_STORAGE_DATA_PARTITION_SIZE > 0
+
+//| class DataPartition:
+//|     """Block device for the flash kept out of CIRCUITPY
+//|
+//|     Some boards keep the end of their filesystem flash out of CIRCUITPY. USB
+//|     never sees this partition, so it can hold a littlefs filesystem. littlefs
+//|     appends small writes to erased flash instead of rewriting whole sectors
+//|     the way FAT does, which makes logs faster to write and wears the flash
+//|     much less. It also survives losing power in the middle of a write.
+//|
+//|     Use a read and program size of 512 bytes so that each write fills whole
+//|     flash blocks.
+//|
+//|     Example usage:
+//|
+//|     .. code-block:: python
+//|
+//|         import storage
+//|
+//|         data = storage.DataPartition()
+//|         try:
+//|             vfs = storage.VfsLfs2(data, readsize=512, progsize=512)
+//|         except OSError:
+//|             storage.VfsLfs2.mkfs(data, readsize=512, progsize=512)
+//|             vfs = storage.VfsLfs2(data, readsize=512, progsize=512)
+//|         # /data must be an existing directory on CIRCUITPY.
+//|         storage.mount(vfs, "/data")
+//|
+//|         with open("/data/log.txt", "a") as f:
+//|             f.write("hello\n")"""
+//|
+//|     def __init__(self) -> None:
+//|         """Returns the singleton data partition."""
+//|         ...
+STATIC const mp_obj_base_t storage_datapartition_obj = {&storage_datapartition_type};
+
+STATIC mp_obj_t storage_datapartition_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 0, 0, false);
+    return MP_OBJ_FROM_PTR(&storage_datapartition_obj);
+}
+
+//|     def readblocks(self, block_num: int, buf: WriteableBuffer, offset: int = 0) -> None:
+//|         """Read from the partition
+//|
+//|         :param int block_num: The 4096 byte block to start reading from
+//|         :param ~circuitpython_typing.WriteableBuffer buf: The buffer to read into
+//|         :param int offset: The byte within the block to start at
+//|
+//|         :return: None"""
+STATIC mp_obj_t storage_datapartition_readblocks(size_t n_args, const mp_obj_t *args) {
+    uint32_t block_num = mp_arg_validate_int_min(mp_obj_get_int(args[1]), 0, MP_QSTR_block_num);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[2], &bufinfo, MP_BUFFER_WRITE);
+    uint32_t offset = n_args > 3 ? mp_arg_validate_int_min(mp_obj_get_int(args[3]), 0, MP_QSTR_offset) : 0;
+    int result = common_hal_storage_datapartition_readblocks(block_num, offset, &bufinfo);
+    if (result < 0) {
+        mp_raise_OSError(-result);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(storage_datapartition_readblocks_obj, 3, 4, storage_datapartition_readblocks);
+
+//|     def writeblocks(self, block_num: int, buf: ReadableBuffer, offset: int = 0) -> None:
+//|         """Write to the partition. Writes into erased flash go straight to
+//|         it. Others rewrite the flash sector through the flash cache.
+//|
+//|         :param int block_num: The 4096 byte block to start writing to
+//|         :param ~circuitpython_typing.ReadableBuffer buf: The buffer to write from
+//|         :param int offset: The byte within the block to start at
+//|
+//|         :return: None"""
+STATIC mp_obj_t storage_datapartition_writeblocks(size_t n_args, const mp_obj_t *args) {
+    uint32_t block_num = mp_arg_validate_int_min(mp_obj_get_int(args[1]), 0, MP_QSTR_block_num);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[2], &bufinfo, MP_BUFFER_READ);
+    uint32_t offset = n_args > 3 ? mp_arg_validate_int_min(mp_obj_get_int(args[3]), 0, MP_QSTR_offset) : 0;
+    int result = common_hal_storage_datapartition_writeblocks(block_num, offset, &bufinfo);
+    if (result < 0) {
+        mp_raise_OSError(-result);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(storage_datapartition_writeblocks_obj, 3, 4, storage_datapartition_writeblocks);
+
+//|     def ioctl(self, op: int, arg: int) -> Optional[int]:
+//|         """Block device control, as used by `storage.VfsLfs2`"""
+//|         ...
+//|
+STATIC mp_obj_t storage_datapartition_ioctl(mp_obj_t self_in, mp_obj_t op_in, mp_obj_t arg_in) {
+    mp_int_t arg = mp_obj_get_int(arg_in);
+    int result = 0;
+    switch (mp_obj_get_int(op_in)) {
+        case MP_BLOCKDEV_IOCTL_INIT:
+            break;
+        case MP_BLOCKDEV_IOCTL_DEINIT:
+        case MP_BLOCKDEV_IOCTL_SYNC:
+            common_hal_storage_datapartition_sync();
+            break;
+        case MP_BLOCKDEV_IOCTL_BLOCK_COUNT:
+            return MP_OBJ_NEW_SMALL_INT(common_hal_storage_datapartition_get_block_count());
+        case MP_BLOCKDEV_IOCTL_BLOCK_SIZE:
+            return MP_OBJ_NEW_SMALL_INT(STORAGE_DATAPARTITION_BLOCK_SIZE);
+        case MP_BLOCKDEV_IOCTL_BLOCK_ERASE:
+            result = common_hal_storage_datapartition_erase(arg);
+            break;
+        default:
+            return mp_const_none;
+    }
+    return MP_OBJ_NEW_SMALL_INT(result);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(storage_datapartition_ioctl_obj, storage_datapartition_ioctl);
+
+STATIC const mp_rom_map_elem_t storage_datapartition_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_readblocks), MP_ROM_PTR(&storage_datapartition_readblocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_writeblocks), MP_ROM_PTR(&storage_datapartition_writeblocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ioctl), MP_ROM_PTR(&storage_datapartition_ioctl_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(storage_datapartition_locals_dict, storage_datapartition_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    storage_datapartition_type,
+    MP_QSTR_DataPartition,
+    MP_TYPE_FLAG_NONE,
+    make_new, storage_datapartition_make_new,
+    locals_dict, &storage_datapartition_locals_dict
+    );
+
+#endif
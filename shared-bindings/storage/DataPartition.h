@@ -0,0 +1,41 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_BINDINGS_STORAGE_DATAPARTITION_H
+#define MICROPY_INCLUDED_SHARED_BINDINGS_STORAGE_DATAPARTITION_H
+
+#include "shared-module/storage/DataPartition.h"
+
+extern const mp_obj_type_t storage_datapartition_type;
+
+// These return 0 on success or a negative errno.
+extern uint32_t common_hal_storage_datapartition_get_block_count(void);
+extern int common_hal_storage_datapartition_readblocks(uint32_t block_num, uint32_t offset, mp_buffer_info_t *buf);
+extern int common_hal_storage_datapartition_writeblocks(uint32_t block_num, uint32_t offset, mp_buffer_info_t *buf);
+extern int common_hal_storage_datapartition_erase(uint32_t block_num);
+extern void common_hal_storage_datapartition_sync(void);
+
+#endif // MICROPY_INCLUDED_SHARED_BINDINGS_STORAGE_DATAPARTITION_H
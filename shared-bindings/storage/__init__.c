@@ -29,10 +29,12 @@
 #include <string.h>
 
 #include "extmod/vfs_fat.h"
+#include "extmod/vfs_lfs.h"
 #include "py/obj.h"
 #include "py/objnamedtuple.h"
 #include "py/runtime.h"
 #include "shared-bindings/storage/__init__.h"
+#include "shared-bindings/storage/DataPartition.h"
 #include "supervisor/flash.h"
 
 //| """Storage management
@@ -312,6 +314,36 @@ STATIC const mp_rom_map_elem_t storage_module_globals_table[] = {
 //|         ...
 //|
     { MP_ROM_QSTR(MP_QSTR_VfsFat), MP_ROM_PTR(&mp_fat_vfs_type) },
+
+//| class VfsLfs2:
+//|     def __init__(
+//|         self,
+//|         block_device: BlockDevice,
+//|         readsize: int = 32,
+//|         progsize: int = 32,
+//|         lookahead: int = 32,
+//|         mtime: bool = True,
+//|     ) -> None:
+//|         """Mount the littlefs filesystem on the given block device. Only on
+//|         boards with a `DataPartition`.
+//|
+//|         :param block_device: Block device the the filesystem lives on
+//|         :param int readsize: Smallest read, in bytes
+//|         :param int progsize: Smallest write, in bytes
+//|         :param int lookahead: Size of the free block lookahead, in bytes
+//|         :param bool mtime: Whether to record when files are modified"""
+//|     @staticmethod
+//|     def mkfs(
+//|         block_device: BlockDevice, readsize: int = 32, progsize: int = 32, lookahead: int = 32
+//|     ) -> None:
+//|         """Format the block device, deleting any data that may have been there."""
+//|
+    #if CIRCUITPY_STORAGE_DATA_PARTITION_SIZE > 0
+    { MP_ROM_QSTR(MP_QSTR_DataPartition), MP_ROM_PTR(&storage_datapartition_type) },
+    #endif
+    #if MICROPY_VFS_LFS2
+    { MP_ROM_QSTR(MP_QSTR_VfsLfs2), MP_ROM_PTR(&mp_type_vfs_lfs2) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(storage_module_globals, storage_module_globals_table);
@@ -0,0 +1,207 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <string.h>
+
+#include "py/objlist.h"
+#include "py/objproperty.h"
+#include "py/objtuple.h"
+#include "py/runtime.h"
+#include "shared-bindings/struct/Struct.h"
+
+//| class Struct:
+//|     """A compiled struct format
+//|
+//|     |see_cpython| :class:`cpython:struct.Struct`.
+//|
+//|     The format string is parsed once, when the object is created, so packing and
+//|     unpacking do not re-read it on every call. Formats that are a single run of
+//|     integers, such as ``"<hhh"`` or ``">4H"``, use an even faster path."""
+//|
+//|     def __init__(self, format: str) -> None:
+//|         """Compile the given format.
+//|
+//|         :param str format: the format string, as used by the `struct` functions"""
+//|         ...
+STATIC mp_obj_t struct_struct_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_format };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_format, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t format = args[ARG_format].u_obj;
+    size_t num_fields = shared_module_struct_struct_count_fields(format);
+    struct_struct_obj_t *self = mp_obj_malloc_var(struct_struct_obj_t, struct_struct_field_t, num_fields, &struct_struct_type);
+    shared_module_struct_struct_construct(self, format);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+// Find the start of the struct in the buffer. Negative offsets are relative to the end.
+STATIC byte *struct_struct_get_buffer(struct_struct_obj_t *self, mp_obj_t buffer, mp_int_t offset, mp_uint_t flags, mp_rom_error_text_t too_small) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, flags);
+    if (offset < 0) {
+        offset = (mp_int_t)bufinfo.len + offset;
+        if (offset < 0) {
+            mp_raise_RuntimeError(MP_ERROR_TEXT("Buffer too small"));
+        }
+    }
+    if ((mp_uint_t)offset + shared_module_struct_struct_get_size(self) > bufinfo.len) {
+        mp_raise_RuntimeError(too_small);
+    }
+    return (byte *)bufinfo.buf + offset;
+}
+
+//|     format: str
+//|     """The format string used to create this object. (read-only)"""
+STATIC mp_obj_t struct_struct_obj_get_format(mp_obj_t self_in) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return shared_module_struct_struct_get_format(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(struct_struct_get_format_obj, struct_struct_obj_get_format);
+
+MP_PROPERTY_GETTER(struct_struct_format_obj,
+    (mp_obj_t)&struct_struct_get_format_obj);
+
+//|     size: int
+//|     """The number of bytes packed by this format, as `struct.calcsize` would return. (read-only)"""
+STATIC mp_obj_t struct_struct_obj_get_size(mp_obj_t self_in) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(shared_module_struct_struct_get_size(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(struct_struct_get_size_obj, struct_struct_obj_get_size);
+
+MP_PROPERTY_GETTER(struct_struct_size_obj,
+    (mp_obj_t)&struct_struct_get_size_obj);
+
+//|     def pack(self, *values: Any) -> bytes:
+//|         """Pack the values according to the format.
+//|         The return value is a bytes object encoding the values."""
+//|         ...
+STATIC mp_obj_t struct_struct_pack(size_t n_args, const mp_obj_t *args) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_uint_t size = shared_module_struct_struct_get_size(self);
+    vstr_t vstr;
+    vstr_init_len(&vstr, size);
+    byte *p = (byte *)vstr.buf;
+    memset(p, 0, size);
+    shared_module_struct_struct_pack_into(self, p, n_args - 1, &args[1]);
+    return mp_obj_new_bytes_from_vstr(&vstr);
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_struct_pack_obj, 1, MP_OBJ_FUN_ARGS_MAX, struct_struct_pack);
+
+//|     def pack_into(self, buffer: WriteableBuffer, offset: int, *values: Any) -> None:
+//|         """Pack the values according to the format into a buffer
+//|         starting at offset. offset may be negative to count from the end of buffer."""
+//|         ...
+STATIC mp_obj_t struct_struct_pack_into(size_t n_args, const mp_obj_t *args) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    byte *p = struct_struct_get_buffer(self, args[1], mp_obj_get_int(args[2]), MP_BUFFER_WRITE,
+        MP_ERROR_TEXT("Buffer too small"));
+    shared_module_struct_struct_pack_into(self, p, n_args - 3, &args[3]);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_struct_pack_into_obj, 3, MP_OBJ_FUN_ARGS_MAX, struct_struct_pack_into);
+
+//|     def unpack(self, data: ReadableBuffer) -> Tuple[Any, ...]:
+//|         """Unpack from the data according to the format. The return value
+//|         is a tuple of the unpacked values. The buffer size must match `size`."""
+//|         ...
+STATIC mp_obj_t struct_struct_unpack(mp_obj_t self_in, mp_obj_t data) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    if (bufinfo.len != shared_module_struct_struct_get_size(self)) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("buffer size must match format"));
+    }
+    mp_obj_tuple_t *res = MP_OBJ_TO_PTR(mp_obj_new_tuple(shared_module_struct_struct_get_num_items(self), NULL));
+    shared_module_struct_struct_unpack_into(self, bufinfo.buf, res->items);
+    return MP_OBJ_FROM_PTR(res);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(struct_struct_unpack_obj, struct_struct_unpack);
+
+//|     def unpack_from(
+//|         self, data: ReadableBuffer, offset: int = 0, *, into: Optional[List[Any]] = None
+//|     ) -> Union[Tuple[Any, ...], List[Any]]:
+//|         """Unpack from the data starting at offset according to the format.
+//|         offset may be negative to count from the end of buffer. The buffer must
+//|         be at least `size` bytes long past offset.
+//|
+//|         :param list into: if given, a list with one entry per unpacked value. Its
+//|           entries are replaced with the values and it is returned instead of a new tuple,
+//|           so a loop that unpacks records repeatedly need not allocate a tuple each time.
+//|         :return: a tuple of the unpacked values, or ``into``"""
+//|         ...
+//|
+STATIC mp_obj_t struct_struct_unpack_from(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_offset, ARG_into };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_offset, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_into, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    const byte *p = struct_struct_get_buffer(self, args[ARG_buffer].u_obj, args[ARG_offset].u_int, MP_BUFFER_READ,
+        MP_ERROR_TEXT("buffer too small"));
+    mp_uint_t num_items = shared_module_struct_struct_get_num_items(self);
+
+    mp_obj_t into = args[ARG_into].u_obj;
+    if (into == mp_const_none) {
+        mp_obj_tuple_t *res = MP_OBJ_TO_PTR(mp_obj_new_tuple(num_items, NULL));
+        shared_module_struct_struct_unpack_into(self, p, res->items);
+        return MP_OBJ_FROM_PTR(res);
+    }
+
+    mp_obj_list_t *list = MP_OBJ_TO_PTR(mp_arg_validate_type(into, &mp_type_list, MP_QSTR_into));
+    (void)mp_arg_validate_length(list->len, num_items, MP_QSTR_into);
+    shared_module_struct_struct_unpack_into(self, p, list->items);
+    return into;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(struct_struct_unpack_from_obj, 1, struct_struct_unpack_from);
+
+STATIC const mp_rom_map_elem_t struct_struct_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_format), MP_ROM_PTR(&struct_struct_format_obj) },
+    { MP_ROM_QSTR(MP_QSTR_size), MP_ROM_PTR(&struct_struct_size_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pack), MP_ROM_PTR(&struct_struct_pack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pack_into), MP_ROM_PTR(&struct_struct_pack_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack), MP_ROM_PTR(&struct_struct_unpack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack_from), MP_ROM_PTR(&struct_struct_unpack_from_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(struct_struct_locals_dict, struct_struct_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    struct_struct_type,
+    MP_QSTR_Struct,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, struct_struct_make_new,
+    locals_dict, &struct_struct_locals_dict
+    );
@@ -0,0 +1,45 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef MICROPY_INCLUDED_SHARED_BINDINGS_STRUCT_STRUCT_H
+#define MICROPY_INCLUDED_SHARED_BINDINGS_STRUCT_STRUCT_H
+
+#include "shared-module/struct/Struct.h"
+
+extern const mp_obj_type_t struct_struct_type;
+
+size_t shared_module_struct_struct_count_fields(mp_obj_t format);
+void shared_module_struct_struct_construct(struct_struct_obj_t *self, mp_obj_t format);
+mp_uint_t shared_module_struct_struct_get_size(struct_struct_obj_t *self);
+mp_obj_t shared_module_struct_struct_get_format(struct_struct_obj_t *self);
+mp_uint_t shared_module_struct_struct_get_num_items(struct_struct_obj_t *self);
+// items must have room for get_num_items() objects.
+void shared_module_struct_struct_unpack_into(struct_struct_obj_t *self, const byte *p, mp_obj_t *items);
+// p must have room for get_size() bytes.
+void shared_module_struct_struct_pack_into(struct_struct_obj_t *self, byte *p, size_t n_args, const mp_obj_t *args);
+
+#endif // MICROPY_INCLUDED_SHARED_BINDINGS_STRUCT_STRUCT_H
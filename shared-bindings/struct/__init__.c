@@ -35,6 +35,7 @@
 #include "py/binary.h"
 #include "py/parsenum.h"
 #include "shared-bindings/struct/__init__.h"
+#include "shared-bindings/struct/Struct.h"
 #include "shared-module/struct/__init__.h"
 
 //| """Manipulation of c-style data
@@ -163,6 +164,7 @@ MP_DEFINE_CONST_FUN_OBJ_KW(struct_unpack_from_obj, 0, struct_unpack_from);
 
 STATIC const mp_rom_map_elem_t mp_module_struct_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_struct) },
+    { MP_ROM_QSTR(MP_QSTR_Struct), MP_ROM_PTR(&struct_struct_type) },
     { MP_ROM_QSTR(MP_QSTR_calcsize), MP_ROM_PTR(&struct_calcsize_obj) },
     { MP_ROM_QSTR(MP_QSTR_pack), MP_ROM_PTR(&struct_pack_obj) },
     { MP_ROM_QSTR(MP_QSTR_pack_into), MP_ROM_PTR(&struct_pack_into_obj) },
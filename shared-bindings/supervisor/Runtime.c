@@ -25,6 +25,7 @@
  */
 
 #include <stdbool.h>
+#include <string.h>
 #include "py/obj.h"
 #include "py/enum.h"
 #include "py/runtime.h"
@@ -34,10 +35,14 @@
 #include "shared-bindings/supervisor/Runtime.h"
 #include "shared-bindings/supervisor/SafeModeReason.h"
 
+#include "supervisor/background_callback.h"
+#include "supervisor/port.h"
 #include "supervisor/shared/reload.h"
 #include "supervisor/shared/stack.h"
 #include "supervisor/shared/status_leds.h"
 #include "supervisor/shared/bluetooth/bluetooth.h"
+#include "supervisor/shared/boot_trace.h"
+#include "supervisor/shared/profiler.h"
 
 #if (CIRCUITPY_USB)
 #include "tusb.h"
@@ -211,6 +216,128 @@ MP_PROPERTY_GETSET(supervisor_runtime_rgb_status_brightness_obj,
     (mp_obj_t)&supervisor_runtime_get_rgb_status_brightness_obj,
     (mp_obj_t)&supervisor_runtime_set_rgb_status_brightness_obj);
 
+#if CIRCUITPY_BOOT_TRACE
+//|     boot_trace: Tuple[Tuple[str, int], ...]
+//|     """When each phase of startup after the last reset finished, as ``(phase, ms)`` tuples in the
+//|     order they happened. ``ms`` counts milliseconds from reset. The last entry is when the VM for
+//|     code.py was ready, just before it ran. Phases that don't apply to a board are left out.
+//|     (read-only)"""
+//|
+STATIC mp_obj_t supervisor_runtime_get_boot_trace(mp_obj_t self) {
+    size_t count;
+    const supervisor_boot_trace_mark_t *marks = supervisor_boot_trace_get(&count);
+    mp_obj_tuple_t *trace = MP_OBJ_TO_PTR(mp_obj_new_tuple(count, NULL));
+    for (size_t i = 0; i < count; i++) {
+        mp_obj_t mark[2] = {
+            mp_obj_new_str(marks[i].phase, strlen(marks[i].phase)),
+            mp_obj_new_int_from_uint(marks[i].ms),
+        };
+        trace->items[i] = mp_obj_new_tuple(2, mark);
+    }
+    return MP_OBJ_FROM_PTR(trace);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(supervisor_runtime_get_boot_trace_obj, supervisor_runtime_get_boot_trace);
+
+MP_PROPERTY_GETTER(supervisor_runtime_boot_trace_obj,
+    (mp_obj_t)&supervisor_runtime_get_boot_trace_obj);
+#endif
+
+#if CIRCUITPY_SAMPLING_PROFILER
+//|     profiling: bool
+//|     """Set to ``True`` to discard any previous samples and start recording which Python function
+//|     is running on every supervisor tick (about 1000 times a second). Set to ``False`` to stop
+//|     and keep the samples. The samples can also be read from the web workflow's
+//|     ``/cp/profile.json``. They are discarded, and recording stops, when the VM finishes."""
+//|
+STATIC mp_obj_t supervisor_runtime_get_profiling(mp_obj_t self) {
+    return mp_obj_new_bool(supervisor_profiler_running());
+}
+MP_DEFINE_CONST_FUN_OBJ_1(supervisor_runtime_get_profiling_obj, supervisor_runtime_get_profiling);
+
+STATIC mp_obj_t supervisor_runtime_set_profiling(mp_obj_t self, mp_obj_t state_in) {
+    if (mp_obj_is_true(state_in)) {
+        supervisor_profiler_start();
+    } else {
+        supervisor_profiler_stop();
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(supervisor_runtime_set_profiling_obj, supervisor_runtime_set_profiling);
+
+MP_PROPERTY_GETSET(supervisor_runtime_profiling_obj,
+    (mp_obj_t)&supervisor_runtime_get_profiling_obj,
+    (mp_obj_t)&supervisor_runtime_set_profiling_obj);
+
+//|     profile_samples: Tuple[Tuple[str, str, int], ...]
+//|     """The most recent samples recorded while `profiling` was on, oldest first, as
+//|     ``(file, function, offset)`` tuples. ``offset`` is the position of the running opcode in
+//|     the function's bytecode. Ticks spent outside of Python code aren't recorded. (read-only)"""
+//|
+STATIC mp_obj_t supervisor_runtime_get_profile_samples(mp_obj_t self) {
+    mp_obj_tuple_t *result = MP_OBJ_TO_PTR(mp_obj_new_tuple(CIRCUITPY_SAMPLING_PROFILER_SAMPLES, NULL));
+    // Sampling this code would overwrite the samples being read.
+    supervisor_profiler_hold(true);
+    size_t count = supervisor_profiler_sample_count();
+    for (size_t i = 0; i < count; i++) {
+        const supervisor_profiler_sample_t *sample = supervisor_profiler_get_sample(i);
+        mp_obj_t items[3] = {
+            MP_OBJ_NEW_QSTR(sample->source_file),
+            MP_OBJ_NEW_QSTR(sample->function),
+            MP_OBJ_NEW_SMALL_INT(sample->offset),
+        };
+        result->items[i] = mp_obj_new_tuple(3, items);
+    }
+    supervisor_profiler_hold(false);
+    result->len = count;
+    return MP_OBJ_FROM_PTR(result);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(supervisor_runtime_get_profile_samples_obj, supervisor_runtime_get_profile_samples);
+
+MP_PROPERTY_GETTER(supervisor_runtime_profile_samples_obj,
+    (mp_obj_t)&supervisor_runtime_get_profile_samples_obj);
+#endif
+
+#if CIRCUITPY_BACKGROUND_TASK_STATS
+//|     background_task_stats: Tuple[Tuple[str, int, int, int], ...]
+//|     """Time spent in each background task since power on, as ``(name, calls, total_cycles,
+//|     max_cycles)`` tuples. ``name`` is the C function run by the task. Divide cycles by
+//|     `background_task_cycles_per_second` to get seconds. The same table can be read from the web
+//|     workflow's ``/cp/background.json``. (read-only)"""
+//|
+STATIC mp_obj_t supervisor_runtime_get_background_task_stats(mp_obj_t self) {
+    size_t count = background_callback_stats_count();
+    mp_obj_tuple_t *result = MP_OBJ_TO_PTR(mp_obj_new_tuple(count, NULL));
+    for (size_t i = 0; i < count; i++) {
+        const background_callback_stats_t *stats = background_callback_get_stats(i);
+        const char *name = stats->name != NULL ? stats->name : "?";
+        mp_obj_t items[4] = {
+            mp_obj_new_str(name, strlen(name)),
+            mp_obj_new_int_from_uint(stats->calls),
+            mp_obj_new_int_from_ull(stats->total_cycles),
+            mp_obj_new_int_from_uint(stats->max_cycles),
+        };
+        result->items[i] = mp_obj_new_tuple(4, items);
+    }
+    return MP_OBJ_FROM_PTR(result);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(supervisor_runtime_get_background_task_stats_obj, supervisor_runtime_get_background_task_stats);
+
+MP_PROPERTY_GETTER(supervisor_runtime_background_task_stats_obj,
+    (mp_obj_t)&supervisor_runtime_get_background_task_stats_obj);
+
+//|     background_task_cycles_per_second: int
+//|     """The rate of the counter used for `background_task_stats`. This is the CPU frequency when
+//|     the chip can count CPU cycles. (read-only)"""
+//|
+STATIC mp_obj_t supervisor_runtime_get_background_task_cycles_per_second(mp_obj_t self) {
+    return mp_obj_new_int_from_uint(port_get_cycle_count_frequency());
+}
+MP_DEFINE_CONST_FUN_OBJ_1(supervisor_runtime_get_background_task_cycles_per_second_obj, supervisor_runtime_get_background_task_cycles_per_second);
+
+MP_PROPERTY_GETTER(supervisor_runtime_background_task_cycles_per_second_obj,
+    (mp_obj_t)&supervisor_runtime_get_background_task_cycles_per_second_obj);
+#endif
+
 STATIC const mp_rom_map_elem_t supervisor_runtime_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_usb_connected), MP_ROM_PTR(&supervisor_runtime_usb_connected_obj) },
     { MP_ROM_QSTR(MP_QSTR_serial_connected), MP_ROM_PTR(&supervisor_runtime_serial_connected_obj) },
@@ -220,6 +347,17 @@ STATIC const mp_rom_map_elem_t supervisor_runtime_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_autoreload), MP_ROM_PTR(&supervisor_runtime_autoreload_obj) },
     { MP_ROM_QSTR(MP_QSTR_ble_workflow),  MP_ROM_PTR(&supervisor_runtime_ble_workflow_obj) },
     { MP_ROM_QSTR(MP_QSTR_rgb_status_brightness),  MP_ROM_PTR(&supervisor_runtime_rgb_status_brightness_obj) },
+    #if CIRCUITPY_BOOT_TRACE
+    { MP_ROM_QSTR(MP_QSTR_boot_trace),  MP_ROM_PTR(&supervisor_runtime_boot_trace_obj) },
+    #endif
+    #if CIRCUITPY_SAMPLING_PROFILER
+    { MP_ROM_QSTR(MP_QSTR_profiling),  MP_ROM_PTR(&supervisor_runtime_profiling_obj) },
+    { MP_ROM_QSTR(MP_QSTR_profile_samples),  MP_ROM_PTR(&supervisor_runtime_profile_samples_obj) },
+    #endif
+    #if CIRCUITPY_BACKGROUND_TASK_STATS
+    { MP_ROM_QSTR(MP_QSTR_background_task_stats),  MP_ROM_PTR(&supervisor_runtime_background_task_stats_obj) },
+    { MP_ROM_QSTR(MP_QSTR_background_task_cycles_per_second),  MP_ROM_PTR(&supervisor_runtime_background_task_cycles_per_second_obj) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(supervisor_runtime_locals_dict, supervisor_runtime_locals_dict_table);
@@ -0,0 +1,178 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/obj.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/supervisor/Stopwatch.h"
+
+//| class Stopwatch:
+//|     """Accumulates the time spent in a stretch of code without allocating.
+//|
+//|     `start()` and `stop()` only update storage inside the object, so they can be
+//|     called in a tight loop without creating objects or triggering a garbage
+//|     collection. Time is counted with the same counter as `ticks_cycles()`, CPU cycles
+//|     on boards that can count them. Read the totals once timing is done.
+//|
+//|     Usage::
+//|
+//|        import supervisor
+//|
+//|        sw = supervisor.Stopwatch()
+//|        for i in range(1000):
+//|            with sw:
+//|                work()
+//|        print(sw.microseconds / sw.laps, "us per call")
+//|     """
+//|
+//|     def __init__(self) -> None:
+//|         """Create a stopped Stopwatch with no laps."""
+//|         ...
+STATIC mp_obj_t supervisor_stopwatch_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    mp_arg_check_num(n_args, n_kw, 0, 0, false);
+    supervisor_stopwatch_obj_t *self = mp_obj_malloc(supervisor_stopwatch_obj_t, &supervisor_stopwatch_type);
+    shared_module_supervisor_stopwatch_construct(self);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def start(self) -> None:
+//|         """Start a lap. Restarts the lap if one is already running."""
+//|         ...
+STATIC mp_obj_t supervisor_stopwatch_start(mp_obj_t self_in) {
+    supervisor_stopwatch_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    shared_module_supervisor_stopwatch_start(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(supervisor_stopwatch_start_obj, supervisor_stopwatch_start);
+
+//|     def stop(self) -> None:
+//|         """End the running lap and add it to the totals. Does nothing when no lap is
+//|         running. A lap must be shorter than 2**32 counts to be measured correctly."""
+//|         ...
+STATIC mp_obj_t supervisor_stopwatch_stop(mp_obj_t self_in) {
+    supervisor_stopwatch_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    shared_module_supervisor_stopwatch_stop(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(supervisor_stopwatch_stop_obj, supervisor_stopwatch_stop);
+
+//|     def reset(self) -> None:
+//|         """Stop and clear the totals."""
+//|         ...
+STATIC mp_obj_t supervisor_stopwatch_reset(mp_obj_t self_in) {
+    supervisor_stopwatch_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    shared_module_supervisor_stopwatch_reset(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(supervisor_stopwatch_reset_obj, supervisor_stopwatch_reset);
+
+//|     def __enter__(self) -> Stopwatch:
+//|         """Starts a lap."""
+//|         ...
+STATIC mp_obj_t supervisor_stopwatch___enter__(mp_obj_t self_in) {
+    supervisor_stopwatch_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    shared_module_supervisor_stopwatch_start(self);
+    return self_in;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(supervisor_stopwatch___enter___obj, supervisor_stopwatch___enter__);
+
+//|     def __exit__(self) -> None:
+//|         """Ends the lap. See Context Managers.
+//|         https://docs.python.org/3/reference/datamodel.html#context-managers"""
+//|         ...
+STATIC mp_obj_t supervisor_stopwatch___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    shared_module_supervisor_stopwatch_stop(MP_OBJ_TO_PTR(args[0]));
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(supervisor_stopwatch___exit___obj, 4, 4, supervisor_stopwatch___exit__);
+
+//|     running: bool
+//|     """True while a lap is running. (read-only)"""
+STATIC mp_obj_t supervisor_stopwatch_get_running(mp_obj_t self_in) {
+    supervisor_stopwatch_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(shared_module_supervisor_stopwatch_get_running(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(supervisor_stopwatch_get_running_obj, supervisor_stopwatch_get_running);
+
+MP_PROPERTY_GETTER(supervisor_stopwatch_running_obj,
+    (mp_obj_t)&supervisor_stopwatch_get_running_obj);
+
+//|     laps: int
+//|     """Number of laps finished since creation or the last `reset()`. (read-only)"""
+STATIC mp_obj_t supervisor_stopwatch_get_laps(mp_obj_t self_in) {
+    supervisor_stopwatch_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(shared_module_supervisor_stopwatch_get_laps(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(supervisor_stopwatch_get_laps_obj, supervisor_stopwatch_get_laps);
+
+MP_PROPERTY_GETTER(supervisor_stopwatch_laps_obj,
+    (mp_obj_t)&supervisor_stopwatch_get_laps_obj);
+
+//|     cycles: int
+//|     """Total length of the finished laps, in `ticks_cycles()` counts. Divide by
+//|     `cycles_per_second()` to get seconds. (read-only)"""
+STATIC mp_obj_t supervisor_stopwatch_get_cycles(mp_obj_t self_in) {
+    supervisor_stopwatch_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_ull(shared_module_supervisor_stopwatch_get_cycles(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(supervisor_stopwatch_get_cycles_obj, supervisor_stopwatch_get_cycles);
+
+MP_PROPERTY_GETTER(supervisor_stopwatch_cycles_obj,
+    (mp_obj_t)&supervisor_stopwatch_get_cycles_obj);
+
+//|     microseconds: int
+//|     """Total length of the finished laps, in microseconds. (read-only)"""
+//|
+STATIC mp_obj_t supervisor_stopwatch_get_microseconds(mp_obj_t self_in) {
+    supervisor_stopwatch_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_ull(shared_module_supervisor_stopwatch_get_microseconds(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(supervisor_stopwatch_get_microseconds_obj, supervisor_stopwatch_get_microseconds);
+
+MP_PROPERTY_GETTER(supervisor_stopwatch_microseconds_obj,
+    (mp_obj_t)&supervisor_stopwatch_get_microseconds_obj);
+
+STATIC const mp_rom_map_elem_t supervisor_stopwatch_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_start), MP_ROM_PTR(&supervisor_stopwatch_start_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop), MP_ROM_PTR(&supervisor_stopwatch_stop_obj) },
+    { MP_ROM_QSTR(MP_QSTR_reset), MP_ROM_PTR(&supervisor_stopwatch_reset_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&supervisor_stopwatch___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&supervisor_stopwatch___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_running), MP_ROM_PTR(&supervisor_stopwatch_running_obj) },
+    { MP_ROM_QSTR(MP_QSTR_laps), MP_ROM_PTR(&supervisor_stopwatch_laps_obj) },
+    { MP_ROM_QSTR(MP_QSTR_cycles), MP_ROM_PTR(&supervisor_stopwatch_cycles_obj) },
+    { MP_ROM_QSTR(MP_QSTR_microseconds), MP_ROM_PTR(&supervisor_stopwatch_microseconds_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(supervisor_stopwatch_locals_dict, supervisor_stopwatch_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    supervisor_stopwatch_type,
+    MP_QSTR_Stopwatch,
+    MP_TYPE_FLAG_NONE,
+    make_new, supervisor_stopwatch_make_new,
+    locals_dict, &supervisor_stopwatch_locals_dict
+    );
@@ -0,0 +1,48 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_BINDINGS_SUPERVISOR_STOPWATCH_H
+#define MICROPY_INCLUDED_SHARED_BINDINGS_SUPERVISOR_STOPWATCH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "py/obj.h"
+#include "shared-module/supervisor/Stopwatch.h"
+
+extern const mp_obj_type_t supervisor_stopwatch_type;
+
+void shared_module_supervisor_stopwatch_construct(supervisor_stopwatch_obj_t *self);
+void shared_module_supervisor_stopwatch_start(supervisor_stopwatch_obj_t *self);
+void shared_module_supervisor_stopwatch_stop(supervisor_stopwatch_obj_t *self);
+void shared_module_supervisor_stopwatch_reset(supervisor_stopwatch_obj_t *self);
+
+bool shared_module_supervisor_stopwatch_get_running(supervisor_stopwatch_obj_t *self);
+uint32_t shared_module_supervisor_stopwatch_get_laps(supervisor_stopwatch_obj_t *self);
+uint64_t shared_module_supervisor_stopwatch_get_cycles(supervisor_stopwatch_obj_t *self);
+uint64_t shared_module_supervisor_stopwatch_get_microseconds(supervisor_stopwatch_obj_t *self);
+
+#endif // MICROPY_INCLUDED_SHARED_BINDINGS_SUPERVISOR_STOPWATCH_H
@@ -45,6 +45,7 @@
 #include "shared-bindings/time/__init__.h"
 #include "shared-bindings/supervisor/Runtime.h"
 #include "shared-bindings/supervisor/StatusBar.h"
+#include "shared-bindings/supervisor/Stopwatch.h"
 
 //| """Supervisor settings"""
 
@@ -191,34 +192,77 @@ MP_DEFINE_CONST_FUN_OBJ_KW(supervisor_set_next_code_file_obj, 0, supervisor_set_
 //|     not for long term events like counting down the time until a holiday.
 //|
 //|     Addition, subtraction, and comparison of ticks values can be done
-//|     with routines like the following::
+//|     with `ticks_add`, `ticks_diff` and `ticks_less`."""
+//|     ...
 //|
-//|         _TICKS_PERIOD = const(1<<29)
-//|         _TICKS_MAX = const(_TICKS_PERIOD-1)
-//|         _TICKS_HALFPERIOD = const(_TICKS_PERIOD//2)
+uint32_t supervisor_ticks_ms_raw(void) {
+    uint64_t ticks_ms = common_hal_time_monotonic_ms();
+    return (ticks_ms + 0x1fff0000) % SUPERVISOR_TICKS_PERIOD;
+}
+
+mp_obj_t supervisor_ticks_ms(void) {
+    return MP_OBJ_NEW_SMALL_INT(supervisor_ticks_ms_raw());
+}
+MP_DEFINE_CONST_FUN_OBJ_0(supervisor_ticks_ms_obj, supervisor_ticks_ms);
+
+//| def ticks_cycles() -> int:
+//|     """Return a free running counter of CPU cycles, wrapping after 2**29 counts.
 //|
-//|         def ticks_add(ticks, delta):
-//|             "Add a delta to a base number of ticks, performing wraparound at 2**29ms."
-//|             return (ticks + delta) % _TICKS_PERIOD
+//|     Boards that can't count CPU cycles count microseconds or 1/32768 second
+//|     subticks instead. `cycles_per_second` gives the rate. Like `ticks_ms`, the value
+//|     is always a small int, so reading it never allocates, and it wraps quickly
+//|     (about every 2 seconds at 240MHz). Use `ticks_diff` to measure stretches of code
+//|     shorter than half the wrap time, or `Stopwatch` for longer ones."""
+//|     ...
 //|
-//|         def ticks_diff(ticks1, ticks2):
-//|             "Compute the signed difference between two ticks values, assuming that they are within 2**28 ticks"
-//|             diff = (ticks1 - ticks2) & _TICKS_MAX
-//|             diff = ((diff + _TICKS_HALFPERIOD) & _TICKS_MAX) - _TICKS_HALFPERIOD
-//|             return diff
+STATIC mp_obj_t supervisor_ticks_cycles(void) {
+    return MP_OBJ_NEW_SMALL_INT(port_get_cycle_count() & SUPERVISOR_TICKS_MAX);
+}
+MP_DEFINE_CONST_FUN_OBJ_0(supervisor_ticks_cycles_obj, supervisor_ticks_cycles);
+
+//| def cycles_per_second() -> int:
+//|     """Return the rate of `ticks_cycles`. This is the CPU frequency when the chip can
+//|     count CPU cycles."""
+//|     ...
 //|
-//|         def ticks_less(ticks1, ticks2):
-//|             "Return true iff ticks1 is less than ticks2, assuming that they are within 2**28 ticks"
-//|             return ticks_diff(ticks1, ticks2) < 0
+STATIC mp_obj_t supervisor_cycles_per_second(void) {
+    return mp_obj_new_int_from_uint(port_get_cycle_count_frequency());
+}
+MP_DEFINE_CONST_FUN_OBJ_0(supervisor_cycles_per_second_obj, supervisor_cycles_per_second);
+
+//| def ticks_add(ticks: int, delta: int) -> int:
+//|     """Add a delta to a `ticks_ms` or `ticks_cycles` value, wrapping at 2**29."""
+//|     ...
 //|
-//|     """
+STATIC mp_obj_t supervisor_ticks_add(mp_obj_t ticks_in, mp_obj_t delta_in) {
+    return MP_OBJ_NEW_SMALL_INT((mp_obj_get_int(ticks_in) + mp_obj_get_int(delta_in)) & SUPERVISOR_TICKS_MAX);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(supervisor_ticks_add_obj, supervisor_ticks_add);
+
+STATIC mp_int_t ticks_diff(mp_obj_t ticks1_in, mp_obj_t ticks2_in) {
+    mp_int_t diff = (mp_obj_get_int(ticks1_in) - mp_obj_get_int(ticks2_in)) & SUPERVISOR_TICKS_MAX;
+    return ((diff + SUPERVISOR_TICKS_HALFPERIOD) & SUPERVISOR_TICKS_MAX) - SUPERVISOR_TICKS_HALFPERIOD;
+}
+
+//| def ticks_diff(ticks1: int, ticks2: int) -> int:
+//|     """Return the signed difference ``ticks1 - ticks2`` between two `ticks_ms` or
+//|     `ticks_cycles` values, assuming that they are within 2**28 ticks of each other."""
 //|     ...
 //|
-mp_obj_t supervisor_ticks_ms(void) {
-    uint64_t ticks_ms = common_hal_time_monotonic_ms();
-    return mp_obj_new_int((ticks_ms + 0x1fff0000) % (1 << 29));
+STATIC mp_obj_t supervisor_ticks_diff(mp_obj_t ticks1_in, mp_obj_t ticks2_in) {
+    return MP_OBJ_NEW_SMALL_INT(ticks_diff(ticks1_in, ticks2_in));
 }
-MP_DEFINE_CONST_FUN_OBJ_0(supervisor_ticks_ms_obj, supervisor_ticks_ms);
+MP_DEFINE_CONST_FUN_OBJ_2(supervisor_ticks_diff_obj, supervisor_ticks_diff);
+
+//| def ticks_less(ticks1: int, ticks2: int) -> bool:
+//|     """Return true if ``ticks1`` is before ``ticks2``, assuming that they are within
+//|     2**28 ticks of each other."""
+//|     ...
+//|
+STATIC mp_obj_t supervisor_ticks_less(mp_obj_t ticks1_in, mp_obj_t ticks2_in) {
+    return mp_obj_new_bool(ticks_diff(ticks1_in, ticks2_in) < 0);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(supervisor_ticks_less_obj, supervisor_ticks_less);
 
 //| def get_previous_traceback() -> Optional[str]:
 //|     """If the last vm run ended with an exception (including the KeyboardInterrupt caused by
@@ -342,6 +386,12 @@ STATIC const mp_rom_map_elem_t supervisor_module_globals_table[] = {
     #endif
     { MP_ROM_QSTR(MP_QSTR_set_next_code_file),  MP_ROM_PTR(&supervisor_set_next_code_file_obj) },
     { MP_ROM_QSTR(MP_QSTR_ticks_ms),  MP_ROM_PTR(&supervisor_ticks_ms_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ticks_cycles),  MP_ROM_PTR(&supervisor_ticks_cycles_obj) },
+    { MP_ROM_QSTR(MP_QSTR_cycles_per_second),  MP_ROM_PTR(&supervisor_cycles_per_second_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ticks_add),  MP_ROM_PTR(&supervisor_ticks_add_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ticks_diff),  MP_ROM_PTR(&supervisor_ticks_diff_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ticks_less),  MP_ROM_PTR(&supervisor_ticks_less_obj) },
+    { MP_ROM_QSTR(MP_QSTR_Stopwatch),  MP_ROM_PTR(&supervisor_stopwatch_type) },
     { MP_ROM_QSTR(MP_QSTR_get_previous_traceback),  MP_ROM_PTR(&supervisor_get_previous_traceback_obj) },
     { MP_ROM_QSTR(MP_QSTR_reset_terminal),  MP_ROM_PTR(&supervisor_reset_terminal_obj) },
     { MP_ROM_QSTR(MP_QSTR_set_usb_identification),  MP_ROM_PTR(&supervisor_set_usb_identification_obj) },
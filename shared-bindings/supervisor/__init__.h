@@ -41,7 +41,15 @@ typedef struct {
 
 extern const super_runtime_obj_t common_hal_supervisor_runtime_obj;
 extern supervisor_status_bar_obj_t shared_module_supervisor_status_bar_obj;
+// supervisor.ticks_ms() and supervisor.ticks_cycles() wrap at this value, so that they
+// always fit in a small int.
+#define SUPERVISOR_TICKS_PERIOD (1 << 29)
+#define SUPERVISOR_TICKS_MAX (SUPERVISOR_TICKS_PERIOD - 1)
+#define SUPERVISOR_TICKS_HALFPERIOD (SUPERVISOR_TICKS_PERIOD / 2)
+
 extern mp_obj_t supervisor_ticks_ms(void);
+// The value of supervisor.ticks_ms(), which always fits in a small int.
+extern uint32_t supervisor_ticks_ms_raw(void);
 
 extern char *prev_traceback_string;
 
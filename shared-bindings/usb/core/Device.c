@@ -180,6 +180,11 @@ MP_DEFINE_CONST_FUN_OBJ_KW(usb_core_device_write_obj, 2, usb_core_device_write);
 //|     ) -> int:
 //|         """Read data from the endpoint.
 //|
+//|         After the first read from an interrupt IN endpoint, such as a HID or
+//|         MIDI device's, the endpoint keeps being polled in the background. Each
+//|         read then returns the oldest report received since. A few hundred bytes
+//|         of reports are kept, and the oldest are dropped when more arrive.
+//|
 //|         :param int endpoint: the bEndpointAddress you want to communicate with.
 //|         :param array.array size_or_buffer: the array to read data into. PyUSB also allows size but CircuitPython only support array to force deliberate memory use.
 //|         :param int timeout: Time to wait specified in milliseconds. (Different from most CircuitPython!)
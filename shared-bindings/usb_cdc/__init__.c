@@ -75,13 +75,17 @@ STATIC mp_obj_t usb_cdc_disable(void) {
 }
 MP_DEFINE_CONST_FUN_OBJ_0(usb_cdc_disable_obj, usb_cdc_disable);
 
-//| def enable(*, console: bool = True, data: bool = False) -> None:
+//| def enable(*, console: bool = True, data: bool = False, data_bulk_size: int = 0) -> None:
 //|     """Enable or disable each CDC device. Can be called in ``boot.py``, before USB is connected.
 //|
 //|     :param console bool: Enable or disable the `console` USB serial device.
 //|       True to enable; False to disable. Enabled by default.
 //|     :param data bool: Enable or disable the `data` USB serial device.
 //|       True to enable; False to disable. *Disabled* by default.
+//|     :param data_bulk_size int: When nonzero, writes to `data` of at least this many bytes
+//|       from a `bytearray` or other buffer in RAM are sent straight from that buffer
+//|       as USB transfers of up to this size, instead of passing through the small
+//|       serial output buffer. Between 0 and 32768. 0 (the default) disables this.
 //|
 //|     If you enable too many devices at once, you will run out of USB endpoints.
 //|     The number of available endpoints varies by microcontroller.
@@ -91,15 +95,19 @@ MP_DEFINE_CONST_FUN_OBJ_0(usb_cdc_disable_obj, usb_cdc_disable);
 //|     ...
 //|
 STATIC mp_obj_t usb_cdc_enable(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_console, ARG_data };
+    enum { ARG_console, ARG_data, ARG_data_bulk_size };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_console, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true } },
         { MP_QSTR_data, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false } },
+        { MP_QSTR_data_bulk_size, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0 } },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
-    if (!common_hal_usb_cdc_enable(args[ARG_console].u_bool, args[ARG_data].u_bool)) {
+    const uint16_t data_bulk_size =
+        (uint16_t)mp_arg_validate_int_range(args[ARG_data_bulk_size].u_int, 0, 32768, MP_QSTR_data_bulk_size);
+
+    if (!common_hal_usb_cdc_enable(args[ARG_console].u_bool, args[ARG_data].u_bool, data_bulk_size)) {
         mp_raise_RuntimeError(MP_ERROR_TEXT("Cannot change USB devices now"));
     }
     return mp_const_none;
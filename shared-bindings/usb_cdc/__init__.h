@@ -34,6 +34,6 @@ void usb_cdc_set_console(mp_obj_t serial_obj);
 void usb_cdc_set_data(mp_obj_t serial_obj);
 
 extern bool common_hal_usb_cdc_disable(void);
-extern bool common_hal_usb_cdc_enable(bool console, bool data);
+extern bool common_hal_usb_cdc_enable(bool console, bool data, uint16_t data_bulk_size);
 
 #endif  // MICROPY_INCLUDED_SHARED_BINDINGS_USB_CDC___INIT___H
@@ -165,11 +165,23 @@ STATIC mp_obj_t usb_hid_device_make_new(const mp_obj_type_t *type, size_t n_args
 }
 
 
-//|     def send_report(self, report: ReadableBuffer, report_id: Optional[int] = None) -> None:
+//|     def send_report(
+//|         self, report: ReadableBuffer, report_id: Optional[int] = None, *, coalesce: bool = False
+//|     ) -> None:
 //|         """Send an HID report. If the device descriptor specifies zero or one report id's,
 //|         you can supply `None` (the default) as the value of ``report_id``.
 //|         Otherwise you must specify which report id to use when sending the report.
 //|
+//|         If the host has not yet collected the previous report, ``report`` is queued
+//|         and `send_report()` returns without waiting. All devices share one short queue;
+//|         `send_report()` only waits when it is full.
+//|
+//|         :param bool coalesce: If ``True``, replace a queued, not yet sent report with the same
+//|           report id instead of adding another one, so the host gets the newest state
+//|           without lagging behind. Use this for reports that carry the full state,
+//|           such as gamepad axes and buttons. Relative mouse movement in a replaced report is lost,
+//|           so add it into the new report yourself if it matters.
+//|
 //|         If the USB host is suspended (sleeping), then `send_report()` will request that the host wake up.
 //|         The ``report`` itself will be discarded, to prevent unwanted extraneous characters,
 //|         mouse clicks, etc.
@@ -184,10 +196,11 @@ STATIC mp_obj_t usb_hid_device_make_new(const mp_obj_type_t *type, size_t n_args
 STATIC mp_obj_t usb_hid_device_send_report(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     usb_hid_device_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
 
-    enum { ARG_report, ARG_report_id };
+    enum { ARG_report, ARG_report_id, ARG_coalesce };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_report, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_report_id, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_coalesce, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -203,7 +216,7 @@ STATIC mp_obj_t usb_hid_device_send_report(size_t n_args, const mp_obj_t *pos_ar
     }
     const uint8_t report_id = common_hal_usb_hid_device_validate_report_id(self, report_id_arg);
 
-    common_hal_usb_hid_device_send_report(self, ((uint8_t *)bufinfo.buf), bufinfo.len, report_id);
+    common_hal_usb_hid_device_send_report(self, ((uint8_t *)bufinfo.buf), bufinfo.len, report_id, args[ARG_coalesce].u_bool);
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(usb_hid_device_send_report_obj, 1, usb_hid_device_send_report);
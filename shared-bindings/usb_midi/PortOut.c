@@ -52,6 +52,23 @@
 //|         :rtype: int or None"""
 //|         ...
 //|
+//|     def write_packets(self, buf: ReadableBuffer) -> int:
+//|         """Queue whole 4 byte USB-MIDI event packets from ``buf``, as read by
+//|         `PortIn.read_packets_into`, without parsing them as a byte stream.
+//|         Stops early when the transmit buffer is full. Bytes after the last
+//|         whole packet are ignored.
+//|
+//|         :return: the number of packets queued"""
+//|         ...
+//|
+STATIC mp_obj_t usb_midi_portout_write_packets(mp_obj_t self_in, mp_obj_t buf_in) {
+    usb_midi_portout_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_READ);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_usb_midi_portout_write_packets(self, bufinfo.buf, bufinfo.len / 4));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(usb_midi_portout_write_packets_obj, usb_midi_portout_write_packets);
+
 
 STATIC mp_uint_t usb_midi_portout_write(mp_obj_t self_in, const void *buf_in, mp_uint_t size, int *errcode) {
     usb_midi_portout_obj_t *self = MP_OBJ_TO_PTR(self_in);
@@ -79,6 +96,8 @@ STATIC mp_uint_t usb_midi_portout_ioctl(mp_obj_t self_in, mp_uint_t request, mp_
 STATIC const mp_rom_map_elem_t usb_midi_portout_locals_dict_table[] = {
     // Standard stream methods.
     { MP_OBJ_NEW_QSTR(MP_QSTR_write),    MP_ROM_PTR(&mp_stream_write_obj) },
+
+    { MP_ROM_QSTR(MP_QSTR_write_packets), MP_ROM_PTR(&usb_midi_portout_write_packets_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(usb_midi_portout_locals_dict, usb_midi_portout_locals_dict_table);
 
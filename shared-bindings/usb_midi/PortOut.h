@@ -35,6 +35,10 @@ extern const mp_obj_type_t usb_midi_portout_type;
 extern size_t common_hal_usb_midi_portout_write(usb_midi_portout_obj_t *self,
     const uint8_t *data, size_t len, int *errcode);
 
+// Write whole 4 byte USB-MIDI event packets. Returns how many were queued.
+extern size_t common_hal_usb_midi_portout_write_packets(usb_midi_portout_obj_t *self,
+    const uint8_t *packets, size_t count);
+
 extern bool common_hal_usb_midi_portout_ready_to_tx(usb_midi_portout_obj_t *self);
 
 #endif  // MICROPY_INCLUDED_SHARED_BINDINGS_USB_MIDI_PORTOUT_H
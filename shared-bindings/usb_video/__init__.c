@@ -67,7 +67,7 @@
 //| versions of CircuitPython."""
 //|
 
-//| def enable_framebuffer(width: int, height: int) -> None:
+//| def enable_framebuffer(width: int, height: int, *, mjpeg: bool = False, quality: int = 75) -> None:
 //|     """Enable a USB video framebuffer, setting the given width & height
 //|
 //|     This function may only be used from ``boot.py``.
@@ -77,14 +77,23 @@
 //|     After boot.py completes, the framebuffer will be allocated. Total storage
 //|     of 4×``width``×``height`` bytes is required, reducing the amount available
 //|     for Python objects. If the allocation fails, a MemoryError is raised.
-//|     This message can be seen in ``boot_out.txt``."""
+//|     This message can be seen in ``boot_out.txt``.
+//|
+//|     :param bool mjpeg: Send frames as MJPEG instead of uncompressed YUY2. Frames are
+//|       encoded on the device, and are much smaller, so larger sizes and frame rates fit
+//|       in the USB bandwidth. Only the rows that changed are encoded again, and a frame is
+//|       only sent when something changed, or once a second to keep the stream alive.
+//|       Storage is about the same as without it.
+//|     :param int quality: JPEG quality, from 1 to 100. Only used with ``mjpeg``."""
 //|
 
 STATIC mp_obj_t usb_video_enable_framebuffer(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_width, ARG_height };
+    enum { ARG_width, ARG_height, ARG_mjpeg, ARG_quality };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_width, MP_ARG_REQUIRED | MP_ARG_INT, { .u_int = 0 } },
         { MP_QSTR_height, MP_ARG_REQUIRED | MP_ARG_INT, { .u_int = 0 } },
+        { MP_QSTR_mjpeg, MP_ARG_KW_ONLY | MP_ARG_BOOL, { .u_bool = false } },
+        { MP_QSTR_quality, MP_ARG_KW_ONLY | MP_ARG_INT, { .u_int = 75 } },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -92,7 +101,8 @@ STATIC mp_obj_t usb_video_enable_framebuffer(size_t n_args, const mp_obj_t *pos_
     // (but note that most devices will not be able to allocate this much memory.
     uint32_t width = mp_arg_validate_int_range(args[ARG_width].u_int, 0, 32767, MP_QSTR_width);
     uint32_t height = mp_arg_validate_int_range(args[ARG_height].u_int, 0, 32767, MP_QSTR_height);
-    if (!shared_module_usb_video_enable(width, height)) {
+    mp_int_t quality = mp_arg_validate_int_range(args[ARG_quality].u_int, 1, 100, MP_QSTR_quality);
+    if (!shared_module_usb_video_enable(width, height, args[ARG_mjpeg].u_bool, quality)) {
         mp_raise_RuntimeError(MP_ERROR_TEXT("Cannot change USB devices now"));
     }
 
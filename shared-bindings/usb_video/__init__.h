@@ -27,6 +27,7 @@
 #pragma once
 
 #include "shared-module/displayio/Bitmap.h"
-bool shared_module_usb_video_enable(mp_int_t frame_width, mp_int_t frame_height);
+bool shared_module_usb_video_enable(mp_int_t frame_width, mp_int_t frame_height, bool mjpeg, mp_int_t quality);
 bool shared_module_usb_video_disable(void);
-void shared_module_usb_video_swapbuffers(void);
+// dirty_row_bitmask marks the rows to convert for the next frame; NULL means all of them.
+void shared_module_usb_video_swapbuffers(uint8_t *dirty_row_bitmask);
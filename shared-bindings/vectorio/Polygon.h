@@ -12,6 +12,7 @@ void common_hal_vectorio_polygon_set_on_dirty(vectorio_polygon_t *self, vectorio
 
 
 uint32_t common_hal_vectorio_polygon_get_pixel(void *polygon, int16_t x, int16_t y);
+void common_hal_vectorio_polygon_prepare_scanline(void *polygon, int16_t x, int16_t y, bool column);
 
 void common_hal_vectorio_polygon_get_area(void *polygon, displayio_area_t *out_area);
 
@@ -33,14 +33,20 @@ mp_obj_t vectorio_vector_shape_make_new(const mp_obj_t shape, const mp_obj_t pix
         ishape.shape = shape;
         ishape.get_area = &common_hal_vectorio_polygon_get_area;
         ishape.get_pixel = &common_hal_vectorio_polygon_get_pixel;
+        ishape.prepare_scanline = &common_hal_vectorio_polygon_prepare_scanline;
+        ishape.get_span = NULL;
     } else if (mp_obj_is_type(shape, &vectorio_rectangle_type)) {
         ishape.shape = shape;
         ishape.get_area = &common_hal_vectorio_rectangle_get_area;
         ishape.get_pixel = &common_hal_vectorio_rectangle_get_pixel;
+        ishape.prepare_scanline = NULL;
+        ishape.get_span = &common_hal_vectorio_rectangle_get_span;
     } else if (mp_obj_is_type(shape, &vectorio_circle_type)) {
         ishape.shape = shape;
         ishape.get_area = &common_hal_vectorio_circle_get_area;
         ishape.get_pixel = &common_hal_vectorio_circle_get_pixel;
+        ishape.prepare_scanline = NULL;
+        ishape.get_span = &common_hal_vectorio_circle_get_span;
     } else {
         mp_raise_TypeError_varg(MP_ERROR_TEXT("unsupported %q type"), MP_QSTR_shape);
     }
@@ -428,6 +428,7 @@ MP_PROPERTY_GETTER(wifi_radio_ap_active_obj,
 //|         channel: int = 0,
 //|         bssid: Optional[Union[str | ReadableBuffer]] = None,
 //|         timeout: Optional[float] = None,
+//|         fast_connect: bool = False,
 //|     ) -> None:
 //|         """Connects to the given ssid and waits for an ip address. Reconnections are handled
 //|         automatically once one connection succeeds.
@@ -443,16 +444,28 @@ MP_PROPERTY_GETTER(wifi_radio_ap_active_obj,
 //|         significantly because a full scan doesn't occur.
 //|
 //|         If ``bssid`` is given and not None, the scan will start at the first channel or the one given and
-//|         connect to the AP with the given ``bssid`` and ``ssid``."""
+//|         connect to the AP with the given ``bssid`` and ``ssid``.
+//|
+//|         If ``fast_connect`` is True, a successful connection remembers the AP, channel, key and
+//|         address it got, and the next ``fast_connect`` connection with the same ``ssid`` and
+//|         ``password`` uses them to skip the scan, key derivation and DHCP. The address is then
+//|         used as a static one and is not renewed. If that connection fails, it forgets them and
+//|         connects normally. The web workflow does the same when ``CIRCUITPY_WIFI_FAST_CONNECT``
+//|         is ``1`` in ``settings.toml``.
+//|
+//|         **Limitations:** ``fast_connect`` is only implemented on Espressif, where it is
+//|         remembered in RTC memory across deep sleep but not a power cycle. Elsewhere it is
+//|         ignored."""
 //|         ...
 STATIC mp_obj_t wifi_radio_connect(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_ssid, ARG_password, ARG_channel, ARG_bssid, ARG_timeout };
+    enum { ARG_ssid, ARG_password, ARG_channel, ARG_bssid, ARG_timeout, ARG_fast_connect };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_ssid, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_password,  MP_ARG_OBJ, {.u_obj = mp_const_empty_bytes} },
         { MP_QSTR_channel, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
         { MP_QSTR_bssid, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
         { MP_QSTR_timeout, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_fast_connect, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
     };
 
     wifi_radio_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
@@ -493,7 +506,7 @@ STATIC mp_obj_t wifi_radio_connect(size_t n_args, const mp_obj_t *pos_args, mp_m
         }
     }
 
-    wifi_radio_error_t error = common_hal_wifi_radio_connect(self, ssid.buf, ssid.len, password.buf, password.len, args[ARG_channel].u_int, timeout, bssid.buf, bssid.len);
+    wifi_radio_error_t error = common_hal_wifi_radio_connect(self, ssid.buf, ssid.len, password.buf, password.len, args[ARG_channel].u_int, timeout, bssid.buf, bssid.len, args[ARG_fast_connect].u_bool);
     if (error == WIFI_RADIO_ERROR_AUTH_FAIL) {
         mp_raise_ConnectionError(MP_ERROR_TEXT("Authentication failure"));
     } else if (error == WIFI_RADIO_ERROR_NO_AP_FOUND) {
@@ -746,6 +759,25 @@ STATIC mp_obj_t wifi_radio_ping(size_t n_args, const mp_obj_t *pos_args, mp_map_
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(wifi_radio_ping_obj, 1, wifi_radio_ping);
 
+#if CIRCUITPY_NETWORK_STATS
+//|     stats: NetworkStats
+//|     """Counters kept by the network stack since the radio was first started. They are shared by
+//|     the station and the access point. Raises `NotImplementedError` on ports that don't keep
+//|     them. (read-only)"""
+//|
+STATIC mp_obj_t wifi_radio_get_stats(mp_obj_t self) {
+    return common_hal_wifi_radio_get_stats(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(wifi_radio_get_stats_obj, wifi_radio_get_stats);
+
+MP_PROPERTY_GETTER(wifi_radio_stats_obj,
+    (mp_obj_t)&wifi_radio_get_stats_obj);
+
+MP_WEAK mp_obj_t common_hal_wifi_radio_get_stats(wifi_radio_obj_t *self) {
+    mp_raise_NotImplementedError(NULL);
+}
+#endif
+
 STATIC const mp_rom_map_elem_t wifi_radio_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_enabled), MP_ROM_PTR(&wifi_radio_enabled_obj) },
 
@@ -788,6 +820,10 @@ STATIC const mp_rom_map_elem_t wifi_radio_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_set_ipv4_address_ap),    MP_ROM_PTR(&wifi_radio_set_ipv4_address_ap_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_ping), MP_ROM_PTR(&wifi_radio_ping_obj) },
+
+    #if CIRCUITPY_NETWORK_STATS
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&wifi_radio_stats_obj) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(wifi_radio_locals_dict, wifi_radio_locals_dict_table);
@@ -808,3 +844,55 @@ const mp_obj_namedtuple_type_t wifi_radio_station_type = {
         MP_QSTR_ipv4_address,
     },
 };
+
+#if CIRCUITPY_NETWORK_STATS
+//| class NetworkStats:
+//|     """Packet counters from the network stack. Counters wrap around at 2**32."""
+//|
+//|     tcp_sent: int
+//|     """TCP segments sent, including retransmissions"""
+//|
+//|     tcp_received: int
+//|     """TCP segments received"""
+//|
+//|     tcp_retransmits: Optional[int]
+//|     """TCP segments sent again because they weren't acknowledged in time, or None when the network
+//|     stack doesn't count them"""
+//|
+//|     tcp_dropped: int
+//|     """TCP segments dropped, for example because of a bad checksum or a full receive window"""
+//|
+//|     ip_dropped: int
+//|     """IP packets dropped before reaching TCP or UDP"""
+//|
+//|     link_dropped: int
+//|     """Packets dropped by the network interface"""
+//|
+//|     pbuf_exhausted: Optional[int]
+//|     """Times a packet buffer was needed while the pool was empty, or None when the network stack
+//|     allocates packet buffers from the heap"""
+//|
+//|     tcp_segment_exhausted: Optional[int]
+//|     """Times an outgoing TCP segment couldn't be queued because the segment pool was empty, or None
+//|     when the network stack allocates segments from the heap"""
+//|
+//|     memory_errors: Optional[int]
+//|     """Failed allocations from the network stack's own heap, or None when it uses the system
+//|     heap"""
+//|
+const mp_obj_namedtuple_type_t wifi_radio_stats_type = {
+    NAMEDTUPLE_TYPE_BASE_AND_SLOTS(MP_QSTR_NetworkStats),
+    .n_fields = 9,
+    .fields = {
+        MP_QSTR_tcp_sent,
+        MP_QSTR_tcp_received,
+        MP_QSTR_tcp_retransmits,
+        MP_QSTR_tcp_dropped,
+        MP_QSTR_ip_dropped,
+        MP_QSTR_link_dropped,
+        MP_QSTR_pbuf_exhausted,
+        MP_QSTR_tcp_segment_exhausted,
+        MP_QSTR_memory_errors,
+    },
+};
+#endif
@@ -36,6 +36,7 @@
 
 extern const mp_obj_type_t wifi_radio_type;
 extern const mp_obj_namedtuple_type_t wifi_radio_station_type;
+extern const mp_obj_namedtuple_type_t wifi_radio_stats_type;
 
 typedef enum {
     // 0 is circuitpython-specific; 1-53 are IEEE; 200+ are Espressif
@@ -105,7 +106,7 @@ extern void common_hal_wifi_radio_stop_dhcp_client(wifi_radio_obj_t *self);
 extern void common_hal_wifi_radio_start_dhcp_server(wifi_radio_obj_t *self);
 extern void common_hal_wifi_radio_stop_dhcp_server(wifi_radio_obj_t *self);
 
-extern wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t channel, mp_float_t timeout, uint8_t *bssid, size_t bssid_len);
+extern wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t channel, mp_float_t timeout, uint8_t *bssid, size_t bssid_len, bool fast_connect);
 extern bool common_hal_wifi_radio_get_connected(wifi_radio_obj_t *self);
 
 extern mp_obj_t common_hal_wifi_radio_get_ap_info(wifi_radio_obj_t *self);
@@ -124,4 +125,7 @@ extern void common_hal_wifi_radio_set_ipv4_address_ap(wifi_radio_obj_t *self, mp
 
 extern mp_int_t common_hal_wifi_radio_ping(wifi_radio_obj_t *self, mp_obj_t ip_address, mp_float_t timeout);
 
+// Returns a wifi_radio_stats_type namedtuple.
+extern mp_obj_t common_hal_wifi_radio_get_stats(wifi_radio_obj_t *self);
+
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_WIFI_RADIO_H
@@ -57,6 +57,9 @@ STATIC const mp_rom_map_elem_t wifi_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_AuthMode),    MP_ROM_PTR(&wifi_authmode_type) },
     { MP_ROM_QSTR(MP_QSTR_Monitor),     MP_ROM_PTR(&wifi_monitor_type) },
     { MP_ROM_QSTR(MP_QSTR_Network),     MP_ROM_PTR(&wifi_network_type) },
+    #if CIRCUITPY_NETWORK_STATS
+    { MP_ROM_QSTR(MP_QSTR_NetworkStats), MP_ROM_PTR(&wifi_radio_stats_type) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_Packet),      MP_ROM_PTR(&wifi_packet_type) },
     { MP_ROM_QSTR(MP_QSTR_Radio),       MP_ROM_PTR(&wifi_radio_type) },
     { MP_ROM_QSTR(MP_QSTR_Station),     MP_ROM_PTR(&wifi_radio_station_type) },
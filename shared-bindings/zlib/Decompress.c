@@ -0,0 +1,145 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/zlib/Decompress.h"
+
+//| class Decompress:
+//|     """Incrementally decompress a DEFLATE, zlib or gzip stream
+//|
+//|     Compressed data is supplied in chunks with `feed`, and decompressed data is
+//|     read out into caller-supplied buffers with `readinto`, so neither the input
+//|     nor the output has to fit in memory at once. The dictionary window may be
+//|     supplied too, so it can be a long-lived buffer or live in PSRAM.
+//|
+//|     Example::
+//|
+//|        import zlib
+//|
+//|        d = zlib.Decompress(31)
+//|        chunk = bytearray(1024)
+//|        out = bytearray(512)
+//|        with open("/firmware.bin.gz", "rb") as src, open("/firmware.bin", "wb") as dest:
+//|            while n := src.readinto(chunk):
+//|                d.feed(memoryview(chunk)[:n])
+//|                while n := d.readinto(out):
+//|                    dest.write(memoryview(out)[:n])
+//|            d.finish()
+//|            while n := d.readinto(out):
+//|                dest.write(memoryview(out)[:n])
+//|     """
+//|
+//|     def __init__(self, wbits: int = 15, *, window: Optional[WriteableBuffer] = None) -> None:
+//|         """Create a decompressor.
+//|
+//|         :param int wbits: the stream format and window size, as for `zlib.decompress`.
+//|           For zlib streams the window size is taken from the stream header.
+//|         :param ~circuitpython_typing.WriteableBuffer window: buffer for the
+//|           dictionary window, at least as large as the stream's window (32768 bytes
+//|           for most streams). It must not be resized while in use. If ``None``, the
+//|           window is allocated once its size is known.
+//|         """
+//|         ...
+STATIC mp_obj_t zlib_decompress_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_wbits, ARG_window };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_wbits, MP_ARG_INT, { .u_int = 15 } },
+        { MP_QSTR_window, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = mp_const_none } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    zlib_decompress_obj_t *self = mp_obj_malloc(zlib_decompress_obj_t, &zlib_decompress_type);
+    common_hal_zlib_decompress_construct(self, args[ARG_wbits].u_int, args[ARG_window].u_obj);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def feed(self, data: ReadableBuffer) -> None:
+//|         """Add compressed data. ``data`` is decompressed in place, so it must not be
+//|         changed until `readinto` has returned 0. The last few hundred bytes are
+//|         copied so the buffer can then be reused."""
+//|         ...
+STATIC mp_obj_t zlib_decompress_feed(mp_obj_t self_in, mp_obj_t data) {
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_zlib_decompress_feed(self, data);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(zlib_decompress_feed_obj, zlib_decompress_feed);
+
+//|     def finish(self) -> None:
+//|         """Mark the end of the compressed data. Until then, `readinto` holds back
+//|         the last part of the data fed so far in case the rest of a block follows."""
+//|         ...
+STATIC mp_obj_t zlib_decompress_finish(mp_obj_t self_in) {
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_zlib_decompress_finish(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(zlib_decompress_finish_obj, zlib_decompress_finish);
+
+//|     def readinto(self, buf: WriteableBuffer) -> int:
+//|         """Decompress into ``buf`` and return the number of bytes written. Returns 0
+//|         once more data must be fed, or the end of the stream has been reached.
+//|         Raises `ValueError` if the data is not valid."""
+//|         ...
+STATIC mp_obj_t zlib_decompress_readinto(mp_obj_t self_in, mp_obj_t buf_in) {
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_WRITE);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_zlib_decompress_readinto(self, bufinfo.buf, bufinfo.len));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(zlib_decompress_readinto_obj, zlib_decompress_readinto);
+
+//|     eof: bool
+//|     """True once the end of the compressed stream has been reached. (read-only)"""
+//|
+STATIC mp_obj_t zlib_decompress_obj_get_eof(mp_obj_t self_in) {
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_zlib_decompress_get_eof(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(zlib_decompress_get_eof_obj, zlib_decompress_obj_get_eof);
+
+MP_PROPERTY_GETTER(zlib_decompress_eof_obj,
+    (mp_obj_t)&zlib_decompress_get_eof_obj);
+
+STATIC const mp_rom_map_elem_t zlib_decompress_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_feed), MP_ROM_PTR(&zlib_decompress_feed_obj) },
+    { MP_ROM_QSTR(MP_QSTR_finish), MP_ROM_PTR(&zlib_decompress_finish_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&zlib_decompress_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_eof), MP_ROM_PTR(&zlib_decompress_eof_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(zlib_decompress_locals_dict, zlib_decompress_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    zlib_decompress_type,
+    MP_QSTR_Decompress,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, zlib_decompress_make_new,
+    locals_dict, &zlib_decompress_locals_dict
+    );
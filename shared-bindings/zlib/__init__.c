@@ -38,6 +38,7 @@
 #include "py/parsenum.h"
 
 #include "shared-bindings/zlib/__init__.h"
+#include "shared-bindings/zlib/Decompress.h"
 
 //| """zlib decompression functionality
 //|
@@ -78,9 +79,16 @@ STATIC mp_obj_t zlib_decompress(size_t n_args, const mp_obj_t *args) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(zlib_decompress_obj, 1, 3, zlib_decompress);
 
+//| def decompressobj(wbits: int = 15, *, window: Optional[WriteableBuffer] = None) -> Decompress:
+//|     """Return a `Decompress` object for decompressing a stream in chunks. Same as `Decompress`."""
+//|     ...
+//|
+
 STATIC const mp_rom_map_elem_t zlib_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_zlib) },
     { MP_ROM_QSTR(MP_QSTR_decompress), MP_ROM_PTR(&zlib_decompress_obj) },
+    { MP_ROM_QSTR(MP_QSTR_decompressobj), MP_ROM_PTR(&zlib_decompress_type) },
+    { MP_ROM_QSTR(MP_QSTR_Decompress), MP_ROM_PTR(&zlib_decompress_type) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(zlib_globals, zlib_globals_table);
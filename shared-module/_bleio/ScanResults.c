@@ -33,16 +33,138 @@
 #include "py/runtime.h"
 #include "shared-bindings/_bleio/ScanEntry.h"
 #include "shared-bindings/_bleio/ScanResults.h"
+#include "shared-bindings/microcontroller/__init__.h"
 
-bleio_scanresults_obj_t *shared_module_bleio_new_scanresults(size_t buffer_size, uint8_t *prefixes, size_t prefixes_len, mp_int_t minimum_rssi) {
+// Advertising data types checked by the filters.
+#define AD_TYPE_INCOMPLETE_UUID16 (0x02)
+#define AD_TYPE_COMPLETE_UUID16 (0x03)
+#define AD_TYPE_INCOMPLETE_UUID128 (0x06)
+#define AD_TYPE_COMPLETE_UUID128 (0x07)
+#define AD_TYPE_SERVICE_DATA_UUID16 (0x16)
+#define AD_TYPE_SERVICE_DATA_UUID128 (0x21)
+#define AD_TYPE_MANUFACTURER_DATA (0xff)
+
+// Each packet in the ring buffer is its data length, then this many bytes of
+// type, time, rssi and address, then the data.
+#define PACKET_HEADER_SIZE (sizeof(uint8_t) + sizeof(uint64_t) + sizeof(int8_t) + NUM_BLEIO_ADDRESS_BYTES + sizeof(uint8_t))
+
+bleio_scanresults_obj_t *shared_module_bleio_new_scanresults(size_t buffer_size, uint8_t *prefixes, size_t prefixes_len, mp_int_t minimum_rssi, const bleio_scan_filter_t *filter) {
     bleio_scanresults_obj_t *self = mp_obj_malloc(bleio_scanresults_obj_t, &bleio_scanresults_type);
     ringbuf_alloc(&self->buf, buffer_size);
     self->prefixes = prefixes;
     self->prefix_length = prefixes_len;
     self->minimum_rssi = minimum_rssi;
+    if (filter != NULL) {
+        self->filter = *filter;
+    } else {
+        memset(&self->filter, 0, sizeof(self->filter));
+    }
+    self->duplicates = NULL;
+    if (self->filter.duplicate_timeout_ms > 0) {
+        self->duplicates = m_malloc(BLEIO_SCAN_DUPLICATE_SLOTS * sizeof(bleio_scan_duplicate_t));
+        memset(self->duplicates, 0, BLEIO_SCAN_DUPLICATE_SLOTS * sizeof(bleio_scan_duplicate_t));
+    }
     return self;
 }
 
+STATIC uint32_t fnv1a(const uint8_t *data, size_t len) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// Steps through the advertising structures in data. Returns false when there
+// are no more whole ones.
+STATIC bool next_field(const uint8_t *data, size_t len, size_t *i, uint8_t *type, const uint8_t **field, size_t *field_len) {
+    if (*i >= len) {
+        return false;
+    }
+    uint8_t structure_length = data[*i];
+    if (structure_length == 0 || *i + 1 + structure_length > len) {
+        return false;
+    }
+    *type = data[*i + 1];
+    *field = data + *i + 2;
+    *field_len = structure_length - 1;
+    *i += 1 + structure_length;
+    return true;
+}
+
+STATIC bool matches_address(const bleio_scan_filter_t *filter, const uint8_t *peer_addr) {
+    for (size_t i = 0; i < filter->address_count; i++) {
+        if (memcmp(filter->addresses + i * NUM_BLEIO_ADDRESS_BYTES, peer_addr, NUM_BLEIO_ADDRESS_BYTES) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+STATIC bool matches_manufacturer_id(const bleio_scan_filter_t *filter, const uint8_t *data, size_t len) {
+    size_t i = 0;
+    uint8_t type;
+    const uint8_t *field;
+    size_t field_len;
+    while (next_field(data, len, &i, &type, &field, &field_len)) {
+        if (type != AD_TYPE_MANUFACTURER_DATA || field_len < 2) {
+            continue;
+        }
+        uint16_t company_id = field[0] | (field[1] << 8);
+        for (size_t j = 0; j < filter->manufacturer_id_count; j++) {
+            if (filter->manufacturer_ids[j] == company_id) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+STATIC bool matches_service_uuid(const bleio_scan_filter_t *filter, const uint8_t *data, size_t len) {
+    size_t i = 0;
+    uint8_t type;
+    const uint8_t *field;
+    size_t field_len;
+    while (next_field(data, len, &i, &type, &field, &field_len)) {
+        size_t uuid_size;
+        switch (type) {
+            case AD_TYPE_INCOMPLETE_UUID16:
+            case AD_TYPE_COMPLETE_UUID16:
+                uuid_size = 2;
+                break;
+            case AD_TYPE_SERVICE_DATA_UUID16:
+                // Only the leading UUID; the rest is service data.
+                uuid_size = 2;
+                field_len = MIN(field_len, uuid_size);
+                break;
+            case AD_TYPE_INCOMPLETE_UUID128:
+            case AD_TYPE_COMPLETE_UUID128:
+                uuid_size = 16;
+                break;
+            case AD_TYPE_SERVICE_DATA_UUID128:
+                uuid_size = 16;
+                field_len = MIN(field_len, uuid_size);
+                break;
+            default:
+                continue;
+        }
+        for (size_t offset = 0; offset + uuid_size <= field_len; offset += uuid_size) {
+            for (size_t j = 0; j < filter->service_uuid_count; j++) {
+                const uint8_t *uuid = filter->service_uuids + j * BLEIO_SCAN_UUID_ENTRY_SIZE;
+                if (uuid[0] == uuid_size && memcmp(field + offset, uuid + 1, uuid_size) == 0) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+STATIC bleio_scan_duplicate_t *duplicate_slot(bleio_scanresults_obj_t *self, const uint8_t *peer_addr, bool scan_response) {
+    uint32_t hash = fnv1a(peer_addr, NUM_BLEIO_ADDRESS_BYTES) ^ scan_response;
+    return &self->duplicates[hash % BLEIO_SCAN_DUPLICATE_SLOTS];
+}
+
 mp_obj_t common_hal_bleio_scanresults_next(bleio_scanresults_obj_t *self) {
     while (ringbuf_num_filled(&self->buf) == 0 && !self->done && !mp_hal_is_interrupted()) {
         RUN_BACKGROUND_TASKS;
@@ -56,6 +178,8 @@ mp_obj_t common_hal_bleio_scanresults_next(bleio_scanresults_obj_t *self) {
     // Remove data atomically.
     common_hal_mcu_disable_interrupts();
 
+    uint16_t len;
+    ringbuf_get_n(&self->buf, (uint8_t *)&len, sizeof(len));
     uint8_t type = ringbuf_get(&self->buf);
     bool connectable = (type & (1 << 0)) != 0;
     bool scan_response = (type & (1 << 1)) != 0;
@@ -65,8 +189,6 @@ mp_obj_t common_hal_bleio_scanresults_next(bleio_scanresults_obj_t *self) {
     uint8_t peer_addr[NUM_BLEIO_ADDRESS_BYTES];
     ringbuf_get_n(&self->buf, peer_addr, sizeof(peer_addr));
     uint8_t addr_type = ringbuf_get(&self->buf);
-    uint16_t len;
-    ringbuf_get_n(&self->buf, (uint8_t *)&len, sizeof(len));
     mp_obj_str_t *o = MP_OBJ_TO_PTR(mp_obj_new_bytes_of_zeros(len));
     ringbuf_get_n(&self->buf, (uint8_t *)o->data, len);
 
@@ -87,6 +209,58 @@ mp_obj_t common_hal_bleio_scanresults_next(bleio_scanresults_obj_t *self) {
     return MP_OBJ_FROM_PTR(entry);
 }
 
+size_t common_hal_bleio_scanresults_read_into(bleio_scanresults_obj_t *self, uint8_t *buf, size_t len) {
+    size_t written = 0;
+    while (true) {
+        // Remove each packet atomically.
+        common_hal_mcu_disable_interrupts();
+        if (ringbuf_num_filled(&self->buf) == 0) {
+            common_hal_mcu_enable_interrupts();
+            break;
+        }
+        // Peek at the data length to see whether the record fits.
+        ringbuf_t *r = &self->buf;
+        uint16_t data_len = r->buf[r->next_read] | (r->buf[(r->next_read + 1) % r->size] << 8);
+        size_t record_size = BLEIO_SCAN_RECORD_HEADER_SIZE + data_len;
+        if (record_size > len) {
+            // It will never fit, so drop it rather than stall.
+            for (size_t i = 0; i < sizeof(data_len) + PACKET_HEADER_SIZE + data_len; i++) {
+                ringbuf_get(r);
+            }
+            common_hal_mcu_enable_interrupts();
+            continue;
+        }
+        if (record_size > len - written) {
+            common_hal_mcu_enable_interrupts();
+            break;
+        }
+
+        ringbuf_get_n(r, (uint8_t *)&data_len, sizeof(data_len));
+        uint8_t type = ringbuf_get(r);
+        uint64_t ticks_ms;
+        ringbuf_get_n(r, (uint8_t *)&ticks_ms, sizeof(ticks_ms));
+        int8_t rssi = ringbuf_get(r);
+        uint8_t *record = buf + written;
+        ringbuf_get_n(r, record + 5, NUM_BLEIO_ADDRESS_BYTES);
+        uint8_t addr_type = ringbuf_get(r);
+        ringbuf_get_n(r, record + BLEIO_SCAN_RECORD_HEADER_SIZE, data_len);
+
+        common_hal_mcu_enable_interrupts();
+
+        // Laid out as struct "<HBbB6sxI".
+        record[0] = data_len & 0xff;
+        record[1] = data_len >> 8;
+        record[2] = type;
+        record[3] = rssi;
+        record[4] = addr_type;
+        record[11] = 0;
+        uint32_t time_ms = ticks_ms;
+        memcpy(record + 12, &time_ms, sizeof(time_ms));
+        written += record_size;
+    }
+    return written;
+}
+
 
 void shared_module_bleio_scanresults_append(bleio_scanresults_obj_t *self,
     uint64_t ticks_ms,
@@ -106,6 +280,29 @@ void shared_module_bleio_scanresults_append(bleio_scanresults_obj_t *self,
     if (!bleio_scanentry_data_matches(data, len, self->prefixes, self->prefix_length, true)) {
         return;
     }
+    const bleio_scan_filter_t *filter = &self->filter;
+    if (filter->address_count > 0 && !matches_address(filter, peer_addr)) {
+        return;
+    }
+    if (filter->manufacturer_id_count > 0 && !matches_manufacturer_id(filter, data, len)) {
+        return;
+    }
+    if (filter->service_uuid_count > 0 && !matches_service_uuid(filter, data, len)) {
+        return;
+    }
+    bleio_scan_duplicate_t *duplicate = NULL;
+    uint32_t data_hash = 0;
+    if (self->duplicates != NULL) {
+        duplicate = duplicate_slot(self, peer_addr, scan_response);
+        data_hash = fnv1a(data, len);
+        if (duplicate->used &&
+            duplicate->scan_response == scan_response &&
+            duplicate->data_hash == data_hash &&
+            (uint32_t)ticks_ms - duplicate->time_ms < filter->duplicate_timeout_ms &&
+            memcmp(duplicate->address, peer_addr, NUM_BLEIO_ADDRESS_BYTES) == 0) {
+            return;
+        }
+    }
     uint8_t type = 0;
     if (connectable) {
         type |= 1 << 0;
@@ -118,19 +315,26 @@ void shared_module_bleio_scanresults_append(bleio_scanresults_obj_t *self,
     common_hal_mcu_disable_interrupts();
 
     // Check whether  will fit.
-    int32_t packet_size = sizeof(uint8_t) + sizeof(ticks_ms) + sizeof(rssi) + NUM_BLEIO_ADDRESS_BYTES +
-        sizeof(addr_type) + sizeof(len) + len;
+    int32_t packet_size = sizeof(len) + PACKET_HEADER_SIZE + len;
     int32_t empty_space = self->buf.size - ringbuf_num_filled(&self->buf);
 
     if (packet_size <= empty_space) {
         // Packet will fit.
+        ringbuf_put_n(&self->buf, (uint8_t *)&len, sizeof(len));
         ringbuf_put(&self->buf, type);
         ringbuf_put_n(&self->buf, (uint8_t *)&ticks_ms, sizeof(ticks_ms));
         ringbuf_put(&self->buf, rssi);
         ringbuf_put_n(&self->buf, peer_addr, NUM_BLEIO_ADDRESS_BYTES);
         ringbuf_put(&self->buf, addr_type);
-        ringbuf_put_n(&self->buf, (uint8_t *)&len, sizeof(len));
         ringbuf_put_n(&self->buf, data, len);
+
+        if (duplicate != NULL) {
+            duplicate->time_ms = ticks_ms;
+            duplicate->data_hash = data_hash;
+            memcpy(duplicate->address, peer_addr, NUM_BLEIO_ADDRESS_BYTES);
+            duplicate->scan_response = scan_response;
+            duplicate->used = true;
+        }
     }
 
     common_hal_mcu_enable_interrupts();
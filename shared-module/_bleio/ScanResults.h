@@ -32,6 +32,44 @@
 
 #include "py/obj.h"
 #include "py/ringbuf.h"
+#include "shared-module/_bleio/Address.h"
+
+// Number of addresses remembered for duplicate_timeout. Addresses that hash to
+// the same slot replace each other, which lets a duplicate through.
+#ifndef BLEIO_SCAN_DUPLICATE_SLOTS
+#define BLEIO_SCAN_DUPLICATE_SLOTS (128)
+#endif
+
+// Size of each service UUID in bleio_scan_filter_t.
+#define BLEIO_SCAN_UUID_ENTRY_SIZE (17)
+
+// Size of each record header written by read_into.
+#define BLEIO_SCAN_RECORD_HEADER_SIZE (16)
+
+// Filters applied to each packet as it arrives, before it is buffered. An
+// empty list doesn't filter. A packet must match every non-empty list, and any
+// entry within a list.
+typedef struct {
+    // NUM_BLEIO_ADDRESS_BYTES per address.
+    const uint8_t *addresses;
+    size_t address_count;
+    const uint16_t *manufacturer_ids;
+    size_t manufacturer_id_count;
+    // A size byte of 2 or 16 followed by 16 bytes of little endian UUID, per UUID.
+    const uint8_t *service_uuids;
+    size_t service_uuid_count;
+    // Drop a packet with the same address, type and data as one buffered this
+    // recently. 0 keeps them all.
+    uint32_t duplicate_timeout_ms;
+} bleio_scan_filter_t;
+
+typedef struct {
+    uint32_t time_ms;
+    uint32_t data_hash;
+    uint8_t address[NUM_BLEIO_ADDRESS_BYTES];
+    bool scan_response;
+    bool used;
+} bleio_scan_duplicate_t;
 
 typedef struct {
     mp_obj_base_t base;
@@ -42,11 +80,15 @@ typedef struct {
     uint8_t *prefixes;
     size_t prefix_length;
     mp_int_t minimum_rssi;
+    bleio_scan_filter_t filter;
+    // BLEIO_SCAN_DUPLICATE_SLOTS entries when filter.duplicate_timeout_ms is set.
+    bleio_scan_duplicate_t *duplicates;
     bool active;
     bool done;
 } bleio_scanresults_obj_t;
 
-bleio_scanresults_obj_t *shared_module_bleio_new_scanresults(size_t buffer_size, uint8_t *prefixes, size_t prefixes_len, mp_int_t minimum_rssi);
+// filter may be NULL. Its lists must stay on the heap until the scan is done.
+bleio_scanresults_obj_t *shared_module_bleio_new_scanresults(size_t buffer_size, uint8_t *prefixes, size_t prefixes_len, mp_int_t minimum_rssi, const bleio_scan_filter_t *filter);
 
 bool shared_module_bleio_scanresults_get_done(bleio_scanresults_obj_t *self);
 void shared_module_bleio_scanresults_set_done(bleio_scanresults_obj_t *self, bool done);
@@ -29,8 +29,80 @@
 #include "py/runtime.h"
 #include "shared-bindings/_eve/__init__.h"
 #include "shared-module/_eve/__init__.h"
+#include "shared/runtime/interrupt_char.h"
+
+#if EVE_NATIVE_SPI
+// FT81x and BT81x registers for writing the coprocessor FIFO in bulk.
+#define EVE_REG_CMDB_SPACE (0x302574)
+#define EVE_REG_CMDB_WRITE (0x302578)
+
+STATIC void spi_begin(common_hal__eve_t *eve, uint32_t addr, bool writing, bool *locked) {
+    // The owner may be holding the lock between our flushes, which is fine too.
+    *locked = common_hal_busio_spi_try_lock(eve->spi);
+    common_hal_digitalio_digitalinout_set_value(eve->cs, false);
+    uint8_t header[4] = {
+        (writing ? 0x80 : 0x00) | ((addr >> 16) & 0x3f), (addr >> 8) & 0xff, addr & 0xff, 0
+    };
+    // Reads need a dummy byte after the address.
+    common_hal_busio_spi_write(eve->spi, header, writing ? 3 : 4);
+}
+
+STATIC void spi_end(common_hal__eve_t *eve, bool locked) {
+    common_hal_digitalio_digitalinout_set_value(eve->cs, true);
+    if (locked) {
+        common_hal_busio_spi_unlock(eve->spi);
+    }
+}
+
+STATIC uint32_t read_cmdb_space(common_hal__eve_t *eve) {
+    bool locked;
+    uint8_t value[4];
+    spi_begin(eve, EVE_REG_CMDB_SPACE, false, &locked);
+    common_hal_busio_spi_read(eve->spi, value, sizeof(value), 0);
+    spi_end(eve, locked);
+    return (value[0] | (value[1] << 8)) & 0xfff;
+}
+
+// Send commands to the FIFO in transfers as large as it has room for. Each goes out with a
+// single SPI write, which uses DMA where the port has it.
+STATIC void spi_write(common_hal__eve_t *eve, size_t len, const uint8_t *buf) {
+    while (len > 0) {
+        if (eve->space == 0) {
+            eve->space = read_cmdb_space(eve);
+        }
+        if (eve->space == 0) {
+            RUN_BACKGROUND_TASKS;
+            // Give up on the rest rather than hang if the coprocessor has stopped.
+            if (mp_hal_is_interrupted()) {
+                return;
+            }
+            continue;
+        }
+        size_t chunk = MIN(len, eve->space);
+        bool locked;
+        spi_begin(eve, EVE_REG_CMDB_WRITE, true, &locked);
+        common_hal_busio_spi_write(eve->spi, buf, chunk);
+        spi_end(eve, locked);
+        eve->space -= chunk;
+        buf += chunk;
+        len -= chunk;
+    }
+}
+
+void common_hal__eve_register_spi(common_hal__eve_t *eve, busio_spi_obj_t *spi, digitalio_digitalinout_obj_t *cs) {
+    eve->spi = spi;
+    eve->cs = cs;
+    eve->space = 0;
+}
+#endif
 
 STATIC void write(common_hal__eve_t *eve, size_t len, void *buf) {
+    #if EVE_NATIVE_SPI
+    if (eve->spi != NULL) {
+        spi_write(eve, len, buf);
+        return;
+    }
+    #endif
     eve->dest[2] = mp_obj_new_bytearray_by_ref(len, buf);
     mp_call_method_n_kw(1, 0, eve->dest);
 }
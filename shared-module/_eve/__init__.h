@@ -27,11 +27,29 @@
 #ifndef MICROPY_INCLUDED_SHARED_MODULE__EVE___INIT___H
 #define MICROPY_INCLUDED_SHARED_MODULE__EVE___INIT___H
 
+#include "py/mpconfig.h"
+
+#if CIRCUITPY_BUSIO_SPI && CIRCUITPY_DIGITALIO
+#include "shared-bindings/busio/SPI.h"
+#include "shared-bindings/digitalio/DigitalInOut.h"
+#define EVE_NATIVE_SPI (1)
+#else
+#define EVE_NATIVE_SPI (0)
+#endif
+
+// The largest the coprocessor FIFO ever has free, so a full buffer can go in one transfer.
+#define EVE_COMMAND_BUFFER_SIZE (4092)
+
 typedef struct _common_hal__eve_t {
     mp_obj_t dest[3];           // Own 'write' method, plus argument
+    #if EVE_NATIVE_SPI
+    busio_spi_obj_t *spi;       // When set, flush straight to REG_CMDB_WRITE instead of 'write'
+    digitalio_digitalinout_obj_t *cs;
+    uint32_t space;             // Free FIFO bytes as of the last REG_CMDB_SPACE read, less what was sent
+    #endif
     int vscale;                 // fixed-point scaling used for Vertex2f
     size_t n;                   // Current size of command buffer
-    uint8_t buf[512];           // Command buffer
+    uint8_t buf[EVE_COMMAND_BUFFER_SIZE]; // Command buffer
 } common_hal__eve_t;
 
 #endif // MICROPY_INCLUDED_SHARED_MODULE__EVE___INIT___H
@@ -24,6 +24,9 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
+#include "py/misc.h"
 #include "Layer.h"
 #include "__init__.h"
 
@@ -103,3 +106,44 @@ uint16_t get_layer_pixel(layer_obj_t *layer, int16_t x, int16_t y) {
     // Convert to 16-bit color using the palette.
     return layer->palette[pixel << 1] | layer->palette[(pixel << 1) + 1] << 8;
 }
+
+// Mark the cells that changed since the last call, and remember the layer as it is now.
+void layer_update_dirty(layer_obj_t *layer, stage_dirty_t *dirty) {
+    int16_t width = layer->width << 4;
+    int16_t height = layer->height << 4;
+    bool whole = !layer->rendered ||
+        layer->x != layer->last_x || layer->y != layer->last_y ||
+        layer->rotation != layer->last_rotation ||
+        (layer->map == NULL && layer->frame != layer->last_frame);
+    if (whole) {
+        if (layer->rendered) {
+            stage_dirty_mark(dirty, layer->last_x, layer->last_y, width, height);
+        }
+        stage_dirty_mark(dirty, layer->x, layer->y, width, height);
+    }
+
+    if (layer->map) {
+        size_t size = (layer->width * layer->height + 1) / 2;
+        if (layer->last_map == NULL) {
+            layer->last_map = m_malloc(size);
+        } else if (!whole) {
+            for (uint8_t ty = 0; ty < layer->height; ++ty) {
+                for (uint8_t tx = 0; tx < layer->width; ++tx) {
+                    // Pick the nibble the same way get_layer_pixel does.
+                    size_t i = (ty * layer->width + tx) >> 1;
+                    uint8_t mask = (tx & 0x01) ? 0x0f : 0xf0;
+                    if ((layer->map[i] ^ layer->last_map[i]) & mask) {
+                        stage_dirty_mark(dirty, layer->x + (tx << 4), layer->y + (ty << 4), 16, 16);
+                    }
+                }
+            }
+        }
+        memcpy(layer->last_map, layer->map, size);
+    }
+
+    layer->last_x = layer->x;
+    layer->last_y = layer->y;
+    layer->last_frame = layer->frame;
+    layer->last_rotation = layer->rotation;
+    layer->rendered = true;
+}
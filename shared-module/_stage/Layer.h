@@ -31,6 +31,7 @@
 #include <stdbool.h>
 
 #include "py/obj.h"
+#include "shared-module/_stage/__init__.h"
 
 typedef struct {
     mp_obj_base_t base;
@@ -41,8 +42,15 @@ typedef struct {
     uint8_t width, height;
     uint8_t frame;
     uint8_t rotation;
+    // The layer as it was at the last render_stage_dirty.
+    uint8_t *last_map;
+    int16_t last_x, last_y;
+    uint8_t last_frame;
+    uint8_t last_rotation;
+    bool rendered;
 } layer_obj_t;
 
 uint16_t get_layer_pixel(layer_obj_t *layer, int16_t x, int16_t y);
+void layer_update_dirty(layer_obj_t *layer, stage_dirty_t *dirty);
 
 #endif  // MICROPY_INCLUDED_SHARED_MODULE__STAGE_LAYER
@@ -24,6 +24,9 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
+#include "py/misc.h"
 #include "Text.h"
 #include "__init__.h"
 
@@ -65,3 +68,29 @@ uint16_t get_text_pixel(text_obj_t *text, int16_t x, int16_t y) {
     // Convert to 16-bit color using the palette.
     return text->palette[pixel << 1] | text->palette[(pixel << 1) + 1] << 8;
 }
+
+// Mark the cells that changed since the last call, and remember the text as it is now.
+void text_update_dirty(text_obj_t *text, stage_dirty_t *dirty) {
+    size_t size = text->width * text->height;
+    bool whole = text->last_chars == NULL ||
+        text->x != text->last_x || text->y != text->last_y;
+    if (whole) {
+        if (text->last_chars != NULL) {
+            stage_dirty_mark(dirty, text->last_x, text->last_y, text->width << 3, text->height << 3);
+        } else {
+            text->last_chars = m_malloc(size);
+        }
+        stage_dirty_mark(dirty, text->x, text->y, text->width << 3, text->height << 3);
+    } else {
+        for (size_t i = 0; i < size; ++i) {
+            if (text->chars[i] != text->last_chars[i]) {
+                stage_dirty_mark(dirty,
+                    text->x + ((i % text->width) << 3),
+                    text->y + ((i / text->width) << 3), 8, 8);
+            }
+        }
+    }
+    memcpy(text->last_chars, text->chars, size);
+    text->last_x = text->x;
+    text->last_y = text->y;
+}
@@ -31,6 +31,7 @@
 #include <stdbool.h>
 
 #include "py/obj.h"
+#include "shared-module/_stage/__init__.h"
 
 typedef struct {
     mp_obj_base_t base;
@@ -39,8 +40,12 @@ typedef struct {
     uint8_t *palette;
     int16_t x, y;
     uint8_t width, height;
+    // The text as it was at the last render_stage_dirty.
+    uint8_t *last_chars;
+    int16_t last_x, last_y;
 } text_obj_t;
 
 uint16_t get_text_pixel(text_obj_t *text, int16_t x, int16_t y);
+void text_update_dirty(text_obj_t *text, stage_dirty_t *dirty);
 
 #endif  // MICROPY_INCLUDED_SHARED_MODULE__STAGE_TEXT
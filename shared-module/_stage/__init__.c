@@ -24,6 +24,8 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "Layer.h"
 #include "Text.h"
 #include "__init__.h"
@@ -96,3 +98,74 @@ void render_stage(
 
     displayio_display_bus_end_transaction(&display->bus);
 }
+
+void stage_dirty_mark(stage_dirty_t *dirty, int16_t x, int16_t y, int16_t width, int16_t height) {
+    int32_t left = x - dirty->x0;
+    int32_t top = y - dirty->y0;
+    int32_t right = MIN(left + width, dirty->columns << STAGE_CELL_SHIFT);
+    int32_t bottom = MIN(top + height, dirty->row_count << STAGE_CELL_SHIFT);
+    left = MAX(left, 0);
+    top = MAX(top, 0);
+    if (left >= right || top >= bottom) {
+        return;
+    }
+    uint8_t first = left >> STAGE_CELL_SHIFT;
+    uint8_t last = (right - 1) >> STAGE_CELL_SHIFT;
+    // Shifting 2 past bit 31 wraps to 0, which still gives the right mask.
+    uint32_t mask = ((2u << last) - 1) & ~((1u << first) - 1);
+    for (int32_t row = top >> STAGE_CELL_SHIFT; row <= (bottom - 1) >> STAGE_CELL_SHIFT; ++row) {
+        dirty->rows[row] |= mask;
+    }
+}
+
+size_t render_stage_dirty(
+    uint16_t x0, uint16_t y0,
+    uint16_t x1, uint16_t y1,
+    int16_t vx, int16_t vy,
+    mp_obj_t *layers, size_t layers_size,
+    uint16_t *buffer, size_t buffer_size,
+    busdisplay_busdisplay_obj_t *display,
+    uint8_t scale, uint16_t background) {
+
+    stage_dirty_t dirty;
+    memset(dirty.rows, 0, sizeof(dirty.rows));
+    dirty.x0 = x0 + vx;
+    dirty.y0 = y0 + vy;
+    dirty.columns = (x1 - x0 + (1 << STAGE_CELL_SHIFT) - 1) >> STAGE_CELL_SHIFT;
+    dirty.row_count = (y1 - y0 + (1 << STAGE_CELL_SHIFT) - 1) >> STAGE_CELL_SHIFT;
+
+    for (size_t layer = 0; layer < layers_size; ++layer) {
+        layer_obj_t *obj = MP_OBJ_TO_PTR(layers[layer]);
+        if (obj->base.type == &mp_type_layer) {
+            layer_update_dirty(obj, &dirty);
+        } else if (obj->base.type == &mp_type_text) {
+            text_update_dirty((text_obj_t *)obj, &dirty);
+        }
+    }
+
+    // Send the dirty cells as rectangles, each a run of cells in a row grown down over the
+    // rows where the same run is dirty too.
+    size_t count = 0;
+    for (uint8_t row = 0; row < dirty.row_count; ++row) {
+        while (dirty.rows[row]) {
+            uint8_t first = __builtin_ctz(dirty.rows[row]);
+            uint8_t last = first;
+            while (last + 1 < dirty.columns && (dirty.rows[row] & (1u << (last + 1)))) {
+                ++last;
+            }
+            uint32_t mask = ((2u << last) - 1) & ~((1u << first) - 1);
+            uint8_t end_row = row + 1;
+            while (end_row < dirty.row_count && (dirty.rows[end_row] & mask) == mask) {
+                dirty.rows[end_row] &= ~mask;
+                ++end_row;
+            }
+            dirty.rows[row] &= ~mask;
+            render_stage(x0 + (first << STAGE_CELL_SHIFT), y0 + (row << STAGE_CELL_SHIFT),
+                MIN(x0 + ((last + 1) << STAGE_CELL_SHIFT), x1),
+                MIN(y0 + (end_row << STAGE_CELL_SHIFT), y1),
+                vx, vy, layers, layers_size, buffer, buffer_size, display, scale, background);
+            ++count;
+        }
+    }
+    return count;
+}
@@ -33,6 +33,21 @@
 
 #define TRANSPARENT (0x1ff8)
 
+// render_stage_dirty splits the area into square cells of 16 pixels.
+#define STAGE_CELL_SHIFT (4)
+#define STAGE_DIRTY_MAX_CELLS (32)
+
+// One bit per cell and one word per row of cells.
+typedef struct {
+    uint32_t rows[STAGE_DIRTY_MAX_CELLS];
+    // The top left corner of the area, in layer coordinates.
+    int16_t x0, y0;
+    uint8_t columns, row_count;
+} stage_dirty_t;
+
+// Marks the cells under a rectangle given in layer coordinates.
+void stage_dirty_mark(stage_dirty_t *dirty, int16_t x, int16_t y, int16_t width, int16_t height);
+
 void render_stage(
     uint16_t x0, uint16_t y0,
     uint16_t x1, uint16_t y1,
@@ -41,3 +56,14 @@ void render_stage(
     uint16_t *buffer, size_t buffer_size,
     busdisplay_busdisplay_obj_t *display,
     uint8_t scale, uint16_t background);
+
+// Renders only the parts of the area where layers changed since the last call, and returns
+// the number of rectangles sent.
+size_t render_stage_dirty(
+    uint16_t x0, uint16_t y0,
+    uint16_t x1, uint16_t y1,
+    int16_t vx, int16_t vy,
+    mp_obj_t *layers, size_t layers_size,
+    uint16_t *buffer, size_t buffer_size,
+    busdisplay_busdisplay_obj_t *display,
+    uint8_t scale, uint16_t background);
@@ -125,13 +125,17 @@ void common_hal_adafruit_pixelbuf_pixelbuf_set_brightness(mp_obj_t self_in, mp_f
         if (self->pre_brightness_buffer == NULL) {
             self->pre_brightness_buffer = m_malloc(pixel_len);
             memcpy(self->pre_brightness_buffer, self->post_brightness_buffer, pixel_len);
+            self->brightness_lut = m_malloc(256);
+        }
+        for (size_t i = 0; i < 256; i++) {
+            self->brightness_lut[i] = (i * self->scaled_brightness) / 256;
         }
         for (size_t i = 0; i < pixel_len; i++) {
             // Don't adjust per-pixel luminance bytes in dotstar mode
             if (self->byteorder.is_dotstar && i % 4 == 0) {
                 continue;
             }
-            self->post_brightness_buffer[i] = (self->pre_brightness_buffer[i] * self->scaled_brightness) / 256;
+            self->post_brightness_buffer[i] = self->brightness_lut[self->pre_brightness_buffer[i]];
         }
 
         if (self->auto_write) {
@@ -228,15 +232,16 @@ static void pixelbuf_set_pixel_color(pixelbuf_pixelbuf_obj_t *self, size_t index
     unscaled_buffer[rgbw_order->b] = b;
 
     if (scaled_buffer) {
+        const uint8_t *lut = self->brightness_lut;
         if (self->bytes_per_pixel == 4) {
             if (!self->byteorder.is_dotstar) {
-                w = (w * self->scaled_brightness) / 256;
+                w = lut[w];
             }
             scaled_buffer[rgbw_order->w] = w;
         }
-        scaled_buffer[rgbw_order->r] = (r * self->scaled_brightness) / 256;
-        scaled_buffer[rgbw_order->g] = (g * self->scaled_brightness) / 256;
-        scaled_buffer[rgbw_order->b] = (b * self->scaled_brightness) / 256;
+        scaled_buffer[rgbw_order->r] = lut[r];
+        scaled_buffer[rgbw_order->g] = lut[g];
+        scaled_buffer[rgbw_order->b] = lut[b];
     }
 }
 void common_hal_adafruit_pixelbuf_pixelbuf_set_pixel_color(mp_obj_t self_in, size_t index, uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
@@ -281,7 +286,21 @@ void common_hal_adafruit_pixelbuf_pixelbuf_set_pixels(mp_obj_t self_in, size_t s
     }
 }
 
-
+void common_hal_adafruit_pixelbuf_pixelbuf_set_pixels_from_buffer(mp_obj_t self_in, size_t start, mp_int_t step, size_t slice_len, const uint8_t *values) {
+    pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
+    // values holds bpp bytes per pixel in R, G, B[, W] order, the same as flattened tuples.
+    uint8_t bpp = self->byteorder.bpp;
+    uint8_t default_w = self->byteorder.is_dotstar ? 255 : 0;
+    for (size_t i = 0; i < slice_len; i++) {
+        uint8_t w = bpp == 4 ? values[PIXEL_W] : default_w;
+        pixelbuf_set_pixel_color(self, start, values[PIXEL_R], values[PIXEL_G], values[PIXEL_B], w);
+        values += bpp;
+        start += step;
+    }
+    if (self->auto_write) {
+        common_hal_adafruit_pixelbuf_pixelbuf_show(self_in);
+    }
+}
 
 void common_hal_adafruit_pixelbuf_pixelbuf_set_pixel(mp_obj_t self_in, size_t index, mp_obj_t value) {
     pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
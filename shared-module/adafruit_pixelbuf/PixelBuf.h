@@ -56,6 +56,9 @@ typedef struct {
     // account for any header.
     uint8_t *post_brightness_buffer;
     uint8_t *pre_brightness_buffer;
+    // Maps each color value to its brightness adjusted value. Allocated along with
+    // pre_brightness_buffer.
+    uint8_t *brightness_lut;
     bool auto_write;
 } pixelbuf_pixelbuf_obj_t;
 
@@ -15,13 +15,48 @@ void common_hal_aesio_aes_construct(aesio_aes_obj_t *self, const uint8_t *key,
 
 void common_hal_aesio_aes_rekey(aesio_aes_obj_t *self, const uint8_t *key,
     uint32_t key_length, const uint8_t *iv) {
+    #if CIRCUITPY_AESIO_MBEDTLS
+    mbedtls_aes_init(&self->encrypt_ctx);
+    mbedtls_aes_init(&self->decrypt_ctx);
+    // The binding has already checked the key length.
+    mbedtls_aes_setkey_enc(&self->encrypt_ctx, key, key_length * 8);
+    mbedtls_aes_setkey_dec(&self->decrypt_ctx, key, key_length * 8);
+    if (iv != NULL) {
+        memcpy(self->iv, iv, AES_BLOCKLEN);
+    } else {
+        memset(self->iv, 0, AES_BLOCKLEN);
+    }
+    #else
     memset(&self->ctx, 0, sizeof(self->ctx));
     if (iv != NULL) {
         AES_init_ctx_iv(&self->ctx, key, key_length, iv);
     } else {
         AES_init_ctx(&self->ctx, key, key_length);
     }
+    #endif
+}
+
+#if CIRCUITPY_AESIO_MBEDTLS
+// Matches the tinyaes behavior: CBC and CTR carry the IV or counter across
+// calls, and each CTR call starts on a fresh keystream block.
+STATIC void aes_crypt_mbedtls(aesio_aes_obj_t *self, int direction, uint8_t *buffer, size_t length) {
+    mbedtls_aes_context *ctx = direction == MBEDTLS_AES_ENCRYPT ? &self->encrypt_ctx : &self->decrypt_ctx;
+    switch (self->mode) {
+        case AES_MODE_ECB:
+            mbedtls_aes_crypt_ecb(ctx, direction, buffer, buffer);
+            break;
+        case AES_MODE_CBC:
+            mbedtls_aes_crypt_cbc(ctx, direction, length, self->iv, buffer, buffer);
+            break;
+        case AES_MODE_CTR: {
+            // CTR only ever runs the cipher forward.
+            size_t nc_off = 0;
+            mbedtls_aes_crypt_ctr(&self->encrypt_ctx, length, &nc_off, self->iv, self->stream_block, buffer, buffer);
+            break;
+        }
+    }
 }
+#endif
 
 void common_hal_aesio_aes_set_mode(aesio_aes_obj_t *self, int mode) {
     self->mode = mode;
@@ -29,6 +64,9 @@ void common_hal_aesio_aes_set_mode(aesio_aes_obj_t *self, int mode) {
 
 void common_hal_aesio_aes_encrypt(aesio_aes_obj_t *self, uint8_t *buffer,
     size_t length) {
+    #if CIRCUITPY_AESIO_MBEDTLS
+    aes_crypt_mbedtls(self, MBEDTLS_AES_ENCRYPT, buffer, length);
+    #else
     switch (self->mode) {
         case AES_MODE_ECB:
             AES_ECB_encrypt(&self->ctx, buffer);
@@ -40,10 +78,14 @@ void common_hal_aesio_aes_encrypt(aesio_aes_obj_t *self, uint8_t *buffer,
             AES_CTR_xcrypt_buffer(&self->ctx, buffer, length);
             break;
     }
+    #endif
 }
 
 void common_hal_aesio_aes_decrypt(aesio_aes_obj_t *self, uint8_t *buffer,
     size_t length) {
+    #if CIRCUITPY_AESIO_MBEDTLS
+    aes_crypt_mbedtls(self, MBEDTLS_AES_DECRYPT, buffer, length);
+    #else
     switch (self->mode) {
         case AES_MODE_ECB:
             AES_ECB_decrypt(&self->ctx, buffer);
@@ -55,4 +97,5 @@ void common_hal_aesio_aes_decrypt(aesio_aes_obj_t *self, uint8_t *buffer,
             AES_CTR_xcrypt_buffer(&self->ctx, buffer, length);
             break;
     }
+    #endif
 }
@@ -35,6 +35,10 @@
 
 #include "shared-module/aesio/aes.h"
 
+#if CIRCUITPY_AESIO_MBEDTLS
+#include "mbedtls/aes.h"
+#endif
+
 // These values were chosen to correspond with the values
 // present in pycrypto.
 enum AES_MODE {
@@ -46,8 +50,16 @@ enum AES_MODE {
 typedef struct {
     mp_obj_base_t base;
 
+    #if CIRCUITPY_AESIO_MBEDTLS
+    // mbedtls keeps the key schedule for each direction separately
+    mbedtls_aes_context encrypt_ctx;
+    mbedtls_aes_context decrypt_ctx;
+    uint8_t iv[AES_BLOCKLEN];
+    uint8_t stream_block[AES_BLOCKLEN];
+    #else
     // The tinyaes context
     struct AES_ctx ctx;
+    #endif
 
     // Which AES mode this instance of the object is configured to use
     enum AES_MODE mode;
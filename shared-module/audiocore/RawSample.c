@@ -36,13 +36,22 @@ void common_hal_audioio_rawsample_construct(audioio_rawsample_obj_t *self,
     uint8_t bytes_per_sample,
     bool samples_signed,
     uint8_t channel_count,
-    uint32_t sample_rate) {
+    uint32_t sample_rate,
+    bool single_buffer) {
     self->buffer = buffer;
     self->bits_per_sample = bytes_per_sample * 8;
     self->samples_signed = samples_signed;
-    self->len = len;
     self->channel_count = channel_count;
     self->sample_rate = sample_rate;
+    self->single_buffer = single_buffer;
+    self->buffer_index = 0;
+    if (single_buffer) {
+        self->len = len;
+    } else {
+        // Each half holds whole frames.
+        uint32_t frame_size = bytes_per_sample * channel_count;
+        self->len = len / (2 * frame_size) * frame_size;
+    }
 }
 
 void common_hal_audioio_rawsample_deinit(audioio_rawsample_obj_t *self) {
@@ -69,6 +78,7 @@ uint8_t common_hal_audioio_rawsample_get_channel_count(audioio_rawsample_obj_t *
 void audioio_rawsample_reset_buffer(audioio_rawsample_obj_t *self,
     bool single_channel_output,
     uint8_t channel) {
+    self->buffer_index = 0;
 }
 
 audioio_get_buffer_result_t audioio_rawsample_get_buffer(audioio_rawsample_obj_t *self,
@@ -77,18 +87,23 @@ audioio_get_buffer_result_t audioio_rawsample_get_buffer(audioio_rawsample_obj_t
     uint8_t **buffer,
     uint32_t *buffer_length) {
     *buffer_length = self->len;
+    uint8_t *start = self->buffer;
+    if (!self->single_buffer) {
+        start += self->len * self->buffer_index;
+        self->buffer_index = 1 - self->buffer_index;
+    }
     if (single_channel_output) {
-        *buffer = self->buffer + (channel % self->channel_count) * (self->bits_per_sample / 8);
+        *buffer = start + (channel % self->channel_count) * (self->bits_per_sample / 8);
     } else {
-        *buffer = self->buffer;
+        *buffer = start;
     }
-    return GET_BUFFER_DONE;
+    return self->single_buffer ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
 }
 
 void audioio_rawsample_get_buffer_structure(audioio_rawsample_obj_t *self, bool single_channel_output,
     bool *single_buffer, bool *samples_signed,
     uint32_t *max_buffer_length, uint8_t *spacing) {
-    *single_buffer = true;
+    *single_buffer = self->single_buffer;
     *samples_signed = self->samples_signed;
     *max_buffer_length = self->len;
     if (single_channel_output) {
@@ -39,6 +39,9 @@ typedef struct {
     bool samples_signed;
     uint8_t channel_count;
     uint32_t sample_rate;
+    // When not single_buffer, the two halves of buffer play alternately, forever.
+    bool single_buffer;
+    uint8_t buffer_index;
 } audioio_rawsample_obj_t;
 
 
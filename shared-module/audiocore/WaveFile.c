@@ -33,6 +33,7 @@
 #include "py/runtime.h"
 
 #include "shared-module/audiocore/WaveFile.h"
+#include "supervisor/background_callback.h"
 
 struct wave_format_chunk {
     uint16_t audio_format;
@@ -47,7 +48,8 @@ struct wave_format_chunk {
 void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
     pyb_file_obj_t *file,
     uint8_t *buffer,
-    size_t buffer_size) {
+    size_t buffer_size,
+    uint8_t buffer_count) {
     // Load the wave
     self->file = file;
     uint8_t chunk_header[16];
@@ -109,31 +111,30 @@ void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
     self->file_length = data_length;
     self->data_start = self->file->fp.fptr;
 
-    // Try to allocate two buffers, one will be loaded from file and the other
-    // DMAed to DAC.
+    // Split the buffer into word aligned slots. One is being played while the others are
+    // read ahead from the file.
+    self->buffer_count = buffer_count;
     if (buffer_size) {
-        self->len = buffer_size / 2;
+        self->len = (buffer_size / buffer_count) & ~(sizeof(uint32_t) - 1);
         self->buffer = buffer;
-        self->second_buffer = buffer + self->len;
     } else {
         self->len = 256;
-        self->buffer = m_malloc(self->len);
+        self->buffer = m_malloc(self->len * buffer_count);
         if (self->buffer == NULL) {
             common_hal_audioio_wavefile_deinit(self);
-            m_malloc_fail(self->len);
-        }
-
-        self->second_buffer = m_malloc(self->len);
-        if (self->second_buffer == NULL) {
-            common_hal_audioio_wavefile_deinit(self);
-            m_malloc_fail(self->len);
+            m_malloc_fail(self->len * buffer_count);
         }
     }
+    self->next_offset = 0;
+    self->load_count = 0;
+    self->read_count = 0;
+    self->left_read_count = 0;
+    self->right_read_count = 0;
+    self->underruns = 0;
 }
 
 void common_hal_audioio_wavefile_deinit(audioio_wavefile_obj_t *self) {
     self->buffer = NULL;
-    self->second_buffer = NULL;
 }
 
 bool common_hal_audioio_wavefile_deinited(audioio_wavefile_obj_t *self) {
@@ -157,19 +158,99 @@ uint8_t common_hal_audioio_wavefile_get_channel_count(audioio_wavefile_obj_t *se
     return self->channel_count;
 }
 
+uint32_t common_hal_audioio_wavefile_get_underruns(audioio_wavefile_obj_t *self) {
+    return self->underruns;
+}
+
+// Reads the next piece of the data into slot load_count. Reading continues at the start of the
+// data after the end so that a looping sample never waits on a seek.
+STATIC bool _load_slot(audioio_wavefile_obj_t *self) {
+    if (self->next_offset >= self->file_length) {
+        if (f_lseek(&self->file->fp, self->data_start) != FR_OK) {
+            return false;
+        }
+        self->next_offset = 0;
+    }
+    uint32_t slot = self->load_count % self->buffer_count;
+    uint8_t *buffer = self->buffer + slot * self->len;
+    uint32_t num_bytes_to_load = self->len;
+    if (num_bytes_to_load > self->file_length - self->next_offset) {
+        num_bytes_to_load = self->file_length - self->next_offset;
+    }
+    UINT length_read;
+    if (f_read(&self->file->fp, buffer, num_bytes_to_load, &length_read) != FR_OK || length_read != num_bytes_to_load) {
+        return false;
+    }
+    self->slot_offset[slot] = self->next_offset;
+    self->next_offset += length_read;
+    self->last_slots &= ~(1 << slot);
+    if (self->next_offset == self->file_length) {
+        self->last_slots |= 1 << slot;
+        // Pad the last buffer to word align it.
+        if (length_read % sizeof(uint32_t) != 0) {
+            uint32_t pad = sizeof(uint32_t) - length_read % sizeof(uint32_t);
+            length_read += pad;
+            if (self->bits_per_sample == 8) {
+                for (uint32_t i = 0; i < pad; i++) {
+                    buffer[length_read - i - 1] = 0x80;
+                }
+            } else if (self->bits_per_sample == 16) {
+                // Slots are word aligned within the buffer.
+                #pragma GCC diagnostic push
+                #pragma GCC diagnostic ignored "-Wcast-align"
+                ((int16_t *)buffer)[length_read / sizeof(int16_t) - 1] = 0;
+                #pragma GCC diagnostic pop
+            }
+        }
+    }
+    self->slot_length[slot] = length_read;
+    self->load_count += 1;
+    return true;
+}
+
+// The slot last handed to the slowest channel may still be playing so it must not be reloaded.
+STATIC bool _can_load(audioio_wavefile_obj_t *self) {
+    uint32_t next_needed = self->left_read_count;
+    if (self->single_channel_output && self->right_channel_used &&
+        self->right_read_count < next_needed) {
+        next_needed = self->right_read_count;
+    }
+    return self->file_length > 0 && self->load_count + 1 < next_needed + self->buffer_count;
+}
+
+STATIC void _read_ahead(audioio_wavefile_obj_t *self) {
+    while (_can_load(self) && _load_slot(self)) {
+    }
+}
+
+STATIC void _read_ahead_cb(void *data) {
+    audioio_wavefile_obj_t *self = data;
+    if (common_hal_audioio_wavefile_deinited(self)) {
+        return;
+    }
+    _read_ahead(self);
+}
+
 void audioio_wavefile_reset_buffer(audioio_wavefile_obj_t *self,
     bool single_channel_output,
     uint8_t channel) {
     if (single_channel_output && channel == 1) {
         return;
     }
-    // We don't reset the buffer index in case we're looping and we have an odd number of buffer
-    // loads
-    self->bytes_remaining = self->file_length;
-    f_lseek(&self->file->fp, self->data_start);
-    self->read_count = 0;
-    self->left_read_count = 0;
-    self->right_read_count = 0;
+    self->single_channel_output = single_channel_output;
+    self->right_channel_used = false;
+    self->ended = false;
+    self->left_read_count = self->read_count;
+    self->right_read_count = self->read_count;
+    // Keep what was read ahead when it continues from the start of the data, which is the case
+    // when looping.
+    if (self->load_count == self->read_count ||
+        self->slot_offset[self->read_count % self->buffer_count] != 0) {
+        self->load_count = self->read_count;
+        self->next_offset = 0;
+        f_lseek(&self->file->fp, self->data_start);
+        _read_ahead(self);
+    }
 }
 
 audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *self,
@@ -181,77 +262,42 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *
         channel = 0;
     }
 
-    uint32_t channel_read_count = self->left_read_count;
+    uint32_t *channel_read_count = &self->left_read_count;
     if (channel == 1) {
-        channel_read_count = self->right_read_count;
+        channel_read_count = &self->right_read_count;
+        self->right_channel_used = true;
     }
 
-    bool need_more_data = self->read_count == channel_read_count;
-
-    if (self->bytes_remaining == 0 && need_more_data) {
-        *buffer = NULL;
-        *buffer_length = 0;
-        return GET_BUFFER_DONE;
-    }
-
-    if (need_more_data) {
-        uint32_t num_bytes_to_load = self->len;
-        if (num_bytes_to_load > self->bytes_remaining) {
-            num_bytes_to_load = self->bytes_remaining;
-        }
-        UINT length_read;
-        if (self->buffer_index % 2 == 1) {
-            *buffer = self->second_buffer;
-        } else {
-            *buffer = self->buffer;
+    uint32_t index = *channel_read_count;
+    if (index == self->read_count) {
+        if (self->ended || self->file_length == 0) {
+            *buffer = NULL;
+            *buffer_length = 0;
+            return GET_BUFFER_DONE;
         }
-        if (f_read(&self->file->fp, *buffer, num_bytes_to_load, &length_read) != FR_OK || length_read != num_bytes_to_load) {
-            return GET_BUFFER_ERROR;
-        }
-        self->bytes_remaining -= length_read;
-        // Pad the last buffer to word align it.
-        if (self->bytes_remaining == 0 && length_read % sizeof(uint32_t) != 0) {
-            uint32_t pad = length_read % sizeof(uint32_t);
-            length_read += pad;
-            if (self->bits_per_sample == 8) {
-                for (uint32_t i = 0; i < pad; i++) {
-                    ((uint8_t *)(*buffer))[length_read / sizeof(uint8_t) - i - 1] = 0x80;
-                }
-            } else if (self->bits_per_sample == 16) {
-                // We know the buffer is aligned because we allocated it onto the heap ourselves.
-                #pragma GCC diagnostic push
-                #pragma GCC diagnostic ignored "-Wcast-align"
-                ((int16_t *)(*buffer))[length_read / sizeof(int16_t) - 1] = 0;
-                #pragma GCC diagnostic pop
+        if (self->load_count == self->read_count) {
+            // The read ahead fell behind so load the slot now.
+            self->underruns += 1;
+            if (!_load_slot(self)) {
+                return GET_BUFFER_ERROR;
             }
         }
-        *buffer_length = length_read;
-        if (self->buffer_index % 2 == 1) {
-            self->second_buffer_length = length_read;
-        } else {
-            self->buffer_length = length_read;
+        if (self->last_slots & (1 << (self->read_count % self->buffer_count))) {
+            self->ended = true;
         }
-        self->buffer_index += 1;
         self->read_count += 1;
+        background_callback_add(&self->read_ahead_cb, _read_ahead_cb, self);
     }
 
-    uint32_t buffers_back = self->read_count - 1 - channel_read_count;
-    if ((self->buffer_index - buffers_back) % 2 == 0) {
-        *buffer = self->second_buffer;
-        *buffer_length = self->second_buffer_length;
-    } else {
-        *buffer = self->buffer;
-        *buffer_length = self->buffer_length;
-    }
-
-    if (channel == 0) {
-        self->left_read_count += 1;
-    } else if (channel == 1) {
-        self->right_read_count += 1;
+    uint32_t slot = index % self->buffer_count;
+    *buffer = self->buffer + slot * self->len;
+    *buffer_length = self->slot_length[slot];
+    *channel_read_count += 1;
+    if (channel == 1) {
         *buffer = *buffer + self->bits_per_sample / 8;
     }
 
-    return self->bytes_remaining == 0 ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
+    return (self->last_slots & (1 << slot)) ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
 }
 
 void audioio_wavefile_get_buffer_structure(audioio_wavefile_obj_t *self, bool single_channel_output,
@@ -31,28 +31,45 @@
 #include "py/obj.h"
 
 #include "shared-module/audiocore/__init__.h"
+#include "supervisor/background_callback.h"
+
+// Number of buffer slots that may be read ahead of playback.
+#define AUDIOIO_WAVEFILE_MAX_BUFFERS (8)
 
 typedef struct {
     mp_obj_base_t base;
+    // buffer_count slots of len bytes each, filled in order and used as a ring.
     uint8_t *buffer;
-    uint32_t buffer_length;
-    uint8_t *second_buffer;
-    uint32_t second_buffer_length;
+    uint32_t slot_length[AUDIOIO_WAVEFILE_MAX_BUFFERS];
+    // Offset of each slot's data from data_start, so a loop can tell whether the start of
+    // the data has already been read ahead.
+    uint32_t slot_offset[AUDIOIO_WAVEFILE_MAX_BUFFERS];
     uint32_t file_length; // In bytes
     uint16_t data_start; // Where the data values start
     uint8_t bits_per_sample;
-    uint16_t buffer_index;
-    uint32_t bytes_remaining;
+    uint8_t buffer_count;
+    // Bit n is set when slot n holds the end of the data.
+    uint8_t last_slots;
+    bool single_channel_output;
+    bool right_channel_used;
+    bool ended; // The slot holding the end of the data has been handed out.
 
     uint8_t channel_count;
     uint32_t sample_rate;
 
-    uint32_t len;
+    uint32_t len; // Length of one slot in bytes
     pyb_file_obj_t *file;
 
+    // Offset of the next read from data_start.
+    uint32_t next_offset;
+    // Slots loaded and slots handed out so far. Slot n % buffer_count holds load n.
+    uint32_t load_count;
     uint32_t read_count;
     uint32_t left_read_count;
     uint32_t right_read_count;
+    // Times playback needed data that the read ahead hadn't loaded yet.
+    uint32_t underruns;
+    background_callback_t read_ahead_cb;
 } audioio_wavefile_obj_t;
 
 // These are not available from Python because it may be called in an interrupt.
@@ -24,9 +24,13 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "shared-module/audioio/__init__.h"
 
 #include "py/obj.h"
+#include "py/objnamedtuple.h"
+#include "shared-bindings/audiocore/OutputStats.h"
 #include "shared-bindings/audiocore/RawSample.h"
 #include "shared-bindings/audiocore/WaveFile.h"
 #include "shared-module/audiocore/RawSample.h"
@@ -71,6 +75,49 @@ void audiosample_get_buffer_structure(mp_obj_t sample_obj, bool single_channel_o
         samples_signed, max_buffer_length, spacing);
 }
 
+void audiosample_output_stats_reset(audiosample_output_stats_t *stats) {
+    memset(stats, 0, sizeof(*stats));
+}
+
+// Moves average a sixteenth of the way towards value.
+STATIC void update_average(uint32_t *average, uint32_t value, uint32_t count) {
+    if (count == 0) {
+        *average = value;
+    } else {
+        *average += ((int32_t)value - (int32_t)*average) / 16;
+    }
+}
+
+void audiosample_output_stats_record_buffer(audiosample_output_stats_t *stats, uint32_t render_us,
+    uint32_t frames, uint32_t sample_rate) {
+    if (frames == 0) {
+        return;
+    }
+    // render_us / (frames * 1000000 / sample_rate) in 16.16 fixed point.
+    uint32_t load = ((uint64_t)render_us * sample_rate << 16) / ((uint64_t)frames * 1000000);
+    update_average(&stats->average_load, load, stats->buffers);
+    stats->max_load = MAX(stats->max_load, load);
+    stats->buffers++;
+}
+
+void audiosample_output_stats_record_fill_latency(audiosample_output_stats_t *stats, uint32_t latency_us) {
+    // Latency is recorded before the buffer it delays, so buffers counts the earlier ones.
+    update_average(&stats->average_fill_latency_us, latency_us, stats->buffers);
+    stats->max_fill_latency_us = MAX(stats->max_fill_latency_us, latency_us);
+}
+
+mp_obj_t audiosample_output_stats_get(const audiosample_output_stats_t *stats) {
+    mp_obj_t items[] = {
+        mp_obj_new_int_from_uint(stats->underruns),
+        mp_obj_new_int_from_uint(stats->buffers),
+        mp_obj_new_float((mp_float_t)stats->max_load / 65536),
+        mp_obj_new_float((mp_float_t)stats->average_load / 65536),
+        mp_obj_new_int_from_uint(stats->max_fill_latency_us),
+        mp_obj_new_int_from_uint(stats->average_fill_latency_us),
+    };
+    return namedtuple_make_new((const mp_obj_type_t *)&audiocore_outputstats_type_obj, MP_ARRAY_SIZE(items), 0, items);
+}
+
 void audiosample_convert_u8m_s16s(int16_t *buffer_out, const uint8_t *buffer_in, size_t nframes) {
     for (; nframes--;) {
         int16_t sample = (*buffer_in++ - 0x80) << 8;
@@ -74,6 +74,24 @@ void audiosample_get_buffer_structure(mp_obj_t sample_obj, bool single_channel_o
     bool *single_buffer, bool *samples_signed,
     uint32_t *max_buffer_length, uint8_t *spacing);
 
+// Counters kept by an audio output since it started playing its sample. Loads are the time spent
+// rendering a buffer divided by the time it takes to play, in 16.16 fixed point.
+typedef struct {
+    uint32_t underruns; // Buffers the output needed before one was ready.
+    uint32_t buffers;
+    uint32_t max_load;
+    uint32_t average_load;
+    // Time from the output asking for a buffer to rendering starting.
+    uint32_t max_fill_latency_us;
+    uint32_t average_fill_latency_us;
+} audiosample_output_stats_t;
+
+void audiosample_output_stats_reset(audiosample_output_stats_t *stats);
+void audiosample_output_stats_record_buffer(audiosample_output_stats_t *stats, uint32_t render_us,
+    uint32_t frames, uint32_t sample_rate);
+void audiosample_output_stats_record_fill_latency(audiosample_output_stats_t *stats, uint32_t latency_us);
+mp_obj_t audiosample_output_stats_get(const audiosample_output_stats_t *stats);
+
 void audiosample_convert_u8m_s16s(int16_t *buffer_out, const uint8_t *buffer_in, size_t nframes);
 void audiosample_convert_u8s_s16s(int16_t *buffer_out, const uint8_t *buffer_in, size_t nframes);
 void audiosample_convert_s8m_s16s(int16_t *buffer_out, const int8_t *buffer_in, size_t nframes);
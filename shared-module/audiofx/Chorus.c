@@ -0,0 +1,159 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/audiofx/Chorus.h"
+
+#include <string.h>
+
+#include "py/runtime.h"
+
+STATIC uint32_t ms_to_frames_q8(audiofx_chorus_obj_t *self, mp_float_t ms) {
+    return (uint32_t)(ms * self->effect.sample_rate * 256 / 1000);
+}
+
+void common_hal_audiofx_chorus_construct(audiofx_chorus_obj_t *self, uint32_t max_delay_ms,
+    mp_float_t delay_ms, mp_float_t depth_ms, mp_float_t rate, mp_float_t mix,
+    uint32_t buffer_size, uint8_t channel_count, uint32_t sample_rate) {
+    audiofx_effect_construct(&self->effect, buffer_size, channel_count, sample_rate);
+
+    // Room for the longest delay, the frame being written and the frame interpolated with.
+    self->max_delay_ms = max_delay_ms;
+    self->delay_frames = (uint64_t)max_delay_ms * sample_rate / 1000 + 3;
+    size_t size = self->delay_frames * channel_count * sizeof(int16_t);
+    self->delay_buffer = m_malloc(size);
+    if (self->delay_buffer == NULL) {
+        common_hal_audiofx_chorus_deinit(self);
+        m_malloc_fail(size);
+    }
+    audiofx_chorus_reset_buffer(self, false, 0);
+
+    common_hal_audiofx_chorus_set_delay_ms(self, delay_ms);
+    common_hal_audiofx_chorus_set_depth_ms(self, depth_ms);
+    common_hal_audiofx_chorus_set_rate(self, rate);
+    common_hal_audiofx_chorus_set_mix(self, mix);
+}
+
+void common_hal_audiofx_chorus_deinit(audiofx_chorus_obj_t *self) {
+    audiofx_effect_deinit(&self->effect);
+    self->delay_buffer = NULL;
+}
+
+mp_float_t common_hal_audiofx_chorus_get_delay_ms(audiofx_chorus_obj_t *self) {
+    return self->delay_ms;
+}
+
+void common_hal_audiofx_chorus_set_delay_ms(audiofx_chorus_obj_t *self, mp_float_t delay_ms) {
+    self->delay_ms = mp_arg_validate_float_range(delay_ms, 0, self->max_delay_ms, MP_QSTR_delay_ms);
+    self->delay = ms_to_frames_q8(self, self->delay_ms);
+}
+
+mp_float_t common_hal_audiofx_chorus_get_depth_ms(audiofx_chorus_obj_t *self) {
+    return self->depth_ms;
+}
+
+void common_hal_audiofx_chorus_set_depth_ms(audiofx_chorus_obj_t *self, mp_float_t depth_ms) {
+    self->depth_ms = mp_arg_validate_float_range(depth_ms, 0, self->max_delay_ms, MP_QSTR_depth_ms);
+    self->depth = ms_to_frames_q8(self, self->depth_ms);
+}
+
+mp_float_t common_hal_audiofx_chorus_get_rate(audiofx_chorus_obj_t *self) {
+    return self->rate;
+}
+
+void common_hal_audiofx_chorus_set_rate(audiofx_chorus_obj_t *self, mp_float_t rate) {
+    self->rate = mp_arg_validate_float_range(rate, 0, 20, MP_QSTR_rate);
+    self->phase_step = (uint32_t)(self->rate / self->effect.sample_rate * MICROPY_FLOAT_CONST(4294967296.));
+}
+
+mp_float_t common_hal_audiofx_chorus_get_mix(audiofx_chorus_obj_t *self) {
+    return audiofx_q15_to_float(self->mix);
+}
+
+void common_hal_audiofx_chorus_set_mix(audiofx_chorus_obj_t *self, mp_float_t mix) {
+    self->mix = audiofx_float_to_q15(mix, MP_QSTR_mix);
+}
+
+void audiofx_chorus_reset_buffer(audiofx_chorus_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel) {
+    if (!single_channel_output || channel == 0) {
+        memset(self->delay_buffer, 0, self->delay_frames * self->effect.channel_count * sizeof(int16_t));
+        self->write_frame = 0;
+        self->phase = 0;
+    }
+    audiofx_effect_reset_buffer(&self->effect, single_channel_output, channel);
+}
+
+// Triangle wave from 0 to 32767 over one cycle of phase.
+static inline uint32_t triangle_q15(uint32_t phase) {
+    uint32_t p = phase >> 16;
+    return p < 32768 ? p : 65535 - p;
+}
+
+STATIC void chorus_process(audiofx_effect_obj_t *effect, int16_t *buffer, uint32_t length) {
+    audiofx_chorus_obj_t *self = (audiofx_chorus_obj_t *)effect;
+    uint8_t channel_count = effect->channel_count;
+    int16_t *delay_buffer = self->delay_buffer;
+    uint32_t delay_frames = self->delay_frames;
+    uint32_t write_frame = self->write_frame;
+    uint32_t phase = self->phase;
+    uint16_t mix = self->mix;
+    // delay_ms + depth_ms may exceed max_delay_ms, so limit the sweep to the ring.
+    uint32_t max_delay = (delay_frames - 3) << 8;
+
+    for (uint32_t i = 0; i < length; i += channel_count) {
+        for (uint8_t c = 0; c < channel_count; c++) {
+            delay_buffer[write_frame * channel_count + c] = buffer[i + c];
+        }
+        for (uint8_t c = 0; c < channel_count; c++) {
+            // The right channel sweeps in the opposite direction to widen the stereo image.
+            uint32_t sweep = triangle_q15(phase + (c ? 0x80000000 : 0));
+            uint32_t delay = MIN(self->delay + (uint32_t)(((uint64_t)self->depth * sweep) >> 15), max_delay) + 256;
+            uint32_t whole = delay >> 8;
+            int32_t fraction = delay & 0xff;
+            uint32_t newer = (write_frame + delay_frames - whole) % delay_frames;
+            uint32_t older = (newer + delay_frames - 1) % delay_frames;
+            int32_t a = delay_buffer[newer * channel_count + c];
+            int32_t b = delay_buffer[older * channel_count + c];
+            int32_t wet = a + (((b - a) * fraction) >> 8);
+            buffer[i + c] = audiofx_mix(buffer[i + c], wet, mix);
+        }
+        phase += self->phase_step;
+        if (++write_frame == delay_frames) {
+            write_frame = 0;
+        }
+    }
+    self->write_frame = write_frame;
+    self->phase = phase;
+}
+
+audioio_get_buffer_result_t audiofx_chorus_get_buffer(audiofx_chorus_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length) {
+    return audiofx_effect_get_buffer(&self->effect, single_channel_output, channel, buffer, buffer_length, chorus_process);
+}
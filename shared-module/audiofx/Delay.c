@@ -0,0 +1,129 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/audiofx/Delay.h"
+
+#include <string.h>
+
+#include "py/runtime.h"
+
+STATIC uint32_t delay_ms_to_length(audiofx_delay_obj_t *self, uint32_t delay_ms) {
+    uint32_t frames = (uint64_t)delay_ms * self->effect.sample_rate / 1000;
+    return MAX(frames, 1) * self->effect.channel_count;
+}
+
+void common_hal_audiofx_delay_construct(audiofx_delay_obj_t *self, uint32_t max_delay_ms,
+    uint32_t delay_ms, mp_float_t feedback, mp_float_t mix,
+    uint32_t buffer_size, uint8_t channel_count, uint32_t sample_rate) {
+    audiofx_effect_construct(&self->effect, buffer_size, channel_count, sample_rate);
+
+    self->max_delay_ms = max_delay_ms;
+    self->max_delay_length = delay_ms_to_length(self, max_delay_ms);
+    self->delay_buffer = m_malloc(self->max_delay_length * sizeof(int16_t));
+    if (self->delay_buffer == NULL) {
+        common_hal_audiofx_delay_deinit(self);
+        m_malloc_fail(self->max_delay_length * sizeof(int16_t));
+    }
+    memset(self->delay_buffer, 0, self->max_delay_length * sizeof(int16_t));
+    self->delay_position = 0;
+
+    common_hal_audiofx_delay_set_delay_ms(self, delay_ms);
+    common_hal_audiofx_delay_set_feedback(self, feedback);
+    common_hal_audiofx_delay_set_mix(self, mix);
+}
+
+void common_hal_audiofx_delay_deinit(audiofx_delay_obj_t *self) {
+    audiofx_effect_deinit(&self->effect);
+    self->delay_buffer = NULL;
+}
+
+uint32_t common_hal_audiofx_delay_get_delay_ms(audiofx_delay_obj_t *self) {
+    return self->delay_ms;
+}
+
+void common_hal_audiofx_delay_set_delay_ms(audiofx_delay_obj_t *self, uint32_t delay_ms) {
+    mp_arg_validate_int_range(delay_ms, 0, self->max_delay_ms, MP_QSTR_delay_ms);
+    uint32_t delay_length = delay_ms_to_length(self, delay_ms);
+    self->delay_ms = delay_ms;
+    self->delay_length = delay_length;
+    if (self->delay_position >= delay_length) {
+        self->delay_position = 0;
+    }
+}
+
+mp_float_t common_hal_audiofx_delay_get_feedback(audiofx_delay_obj_t *self) {
+    return audiofx_q15_to_float(self->feedback);
+}
+
+void common_hal_audiofx_delay_set_feedback(audiofx_delay_obj_t *self, mp_float_t feedback) {
+    self->feedback = audiofx_float_to_q15(feedback, MP_QSTR_feedback);
+}
+
+mp_float_t common_hal_audiofx_delay_get_mix(audiofx_delay_obj_t *self) {
+    return audiofx_q15_to_float(self->mix);
+}
+
+void common_hal_audiofx_delay_set_mix(audiofx_delay_obj_t *self, mp_float_t mix) {
+    self->mix = audiofx_float_to_q15(mix, MP_QSTR_mix);
+}
+
+void audiofx_delay_reset_buffer(audiofx_delay_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel) {
+    if (!single_channel_output || channel == 0) {
+        memset(self->delay_buffer, 0, self->max_delay_length * sizeof(int16_t));
+        self->delay_position = 0;
+    }
+    audiofx_effect_reset_buffer(&self->effect, single_channel_output, channel);
+}
+
+STATIC void delay_process(audiofx_effect_obj_t *effect, int16_t *buffer, uint32_t length) {
+    audiofx_delay_obj_t *self = (audiofx_delay_obj_t *)effect;
+    int16_t *delay_buffer = self->delay_buffer;
+    uint32_t position = self->delay_position;
+    uint32_t delay_length = self->delay_length;
+    int32_t feedback = self->feedback;
+    uint16_t mix = self->mix;
+
+    for (uint32_t i = 0; i < length; i++) {
+        int32_t dry = buffer[i];
+        int32_t echo = delay_buffer[position];
+        delay_buffer[position] = audiofx_saturate16(dry + ((echo * feedback) >> 15));
+        buffer[i] = audiofx_mix(dry, echo, mix);
+        if (++position == delay_length) {
+            position = 0;
+        }
+    }
+    self->delay_position = position;
+}
+
+audioio_get_buffer_result_t audiofx_delay_get_buffer(audiofx_delay_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length) {
+    return audiofx_effect_get_buffer(&self->effect, single_channel_output, channel, buffer, buffer_length, delay_process);
+}
@@ -0,0 +1,54 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "shared-module/audiofx/__init__.h"
+
+typedef struct {
+    audiofx_effect_obj_t effect;
+    // Ring buffer of interleaved samples, holding the input mixed with fed back echoes.
+    int16_t *delay_buffer;
+    uint32_t max_delay_length; // in samples
+    uint32_t delay_length; // in samples
+    uint32_t delay_position;
+    uint32_t max_delay_ms;
+    uint32_t delay_ms;
+    uint16_t feedback; // Q15
+    uint16_t mix; // Q15
+} audiofx_delay_obj_t;
+
+// These are not available from Python because it may be called in an interrupt.
+void audiofx_delay_reset_buffer(audiofx_delay_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel);
+audioio_get_buffer_result_t audiofx_delay_get_buffer(audiofx_delay_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length);                                                      // length in bytes
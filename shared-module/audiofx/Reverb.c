@@ -0,0 +1,187 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/audiofx/Reverb.h"
+
+#include <string.h>
+
+#include "py/runtime.h"
+
+// Freeverb's line lengths in samples at 44.1kHz. They are scaled to the sample rate.
+STATIC const uint16_t comb_tuning[AUDIOFX_REVERB_COMBS] = { 1116, 1188, 1277, 1356 };
+STATIC const uint16_t allpass_tuning[AUDIOFX_REVERB_ALLPASSES] = { 556, 441 };
+
+STATIC uint32_t scale_tuning(uint16_t tuning, uint32_t sample_rate) {
+    uint32_t length = (uint64_t)tuning * sample_rate / 44100;
+    return MAX(length, 1);
+}
+
+void common_hal_audiofx_reverb_construct(audiofx_reverb_obj_t *self, mp_float_t room_size,
+    mp_float_t damping, mp_float_t mix, uint32_t buffer_size, uint8_t channel_count,
+    uint32_t sample_rate) {
+    audiofx_effect_construct(&self->effect, buffer_size, channel_count, sample_rate);
+
+    uint32_t total = 0;
+    for (size_t i = 0; i < AUDIOFX_REVERB_COMBS; i++) {
+        total += scale_tuning(comb_tuning[i], sample_rate);
+    }
+    for (size_t i = 0; i < AUDIOFX_REVERB_ALLPASSES; i++) {
+        total += scale_tuning(allpass_tuning[i], sample_rate);
+    }
+    self->line_buffer_length = total;
+    self->line_buffer = m_malloc(total * sizeof(int16_t));
+    if (self->line_buffer == NULL) {
+        common_hal_audiofx_reverb_deinit(self);
+        m_malloc_fail(total * sizeof(int16_t));
+    }
+
+    int16_t *line = self->line_buffer;
+    for (size_t i = 0; i < AUDIOFX_REVERB_COMBS; i++) {
+        self->comb[i].buffer = line;
+        self->comb[i].length = scale_tuning(comb_tuning[i], sample_rate);
+        line += self->comb[i].length;
+    }
+    for (size_t i = 0; i < AUDIOFX_REVERB_ALLPASSES; i++) {
+        self->allpass[i].buffer = line;
+        self->allpass[i].length = scale_tuning(allpass_tuning[i], sample_rate);
+        line += self->allpass[i].length;
+    }
+    audiofx_reverb_reset_buffer(self, false, 0);
+
+    common_hal_audiofx_reverb_set_room_size(self, room_size);
+    common_hal_audiofx_reverb_set_damping(self, damping);
+    common_hal_audiofx_reverb_set_mix(self, mix);
+}
+
+void common_hal_audiofx_reverb_deinit(audiofx_reverb_obj_t *self) {
+    audiofx_effect_deinit(&self->effect);
+    self->line_buffer = NULL;
+    for (size_t i = 0; i < AUDIOFX_REVERB_COMBS; i++) {
+        self->comb[i].buffer = NULL;
+    }
+    for (size_t i = 0; i < AUDIOFX_REVERB_ALLPASSES; i++) {
+        self->allpass[i].buffer = NULL;
+    }
+}
+
+mp_float_t common_hal_audiofx_reverb_get_room_size(audiofx_reverb_obj_t *self) {
+    return audiofx_q15_to_float(self->room_size);
+}
+
+void common_hal_audiofx_reverb_set_room_size(audiofx_reverb_obj_t *self, mp_float_t room_size) {
+    self->room_size = audiofx_float_to_q15(room_size, MP_QSTR_room_size);
+    // Freeverb maps the room size onto comb feedback from 0.7 to 0.98.
+    self->comb_feedback = (uint16_t)(AUDIOFX_UNITY * 7 / 10 + ((uint32_t)self->room_size * (AUDIOFX_UNITY * 28 / 100) >> 15));
+}
+
+mp_float_t common_hal_audiofx_reverb_get_damping(audiofx_reverb_obj_t *self) {
+    return audiofx_q15_to_float(self->damping);
+}
+
+void common_hal_audiofx_reverb_set_damping(audiofx_reverb_obj_t *self, mp_float_t damping) {
+    self->damping = audiofx_float_to_q15(damping, MP_QSTR_damping);
+    // Freeverb scales damping by 0.4.
+    self->comb_damping = (uint16_t)(((uint32_t)self->damping * 2) / 5);
+}
+
+mp_float_t common_hal_audiofx_reverb_get_mix(audiofx_reverb_obj_t *self) {
+    return audiofx_q15_to_float(self->mix);
+}
+
+void common_hal_audiofx_reverb_set_mix(audiofx_reverb_obj_t *self, mp_float_t mix) {
+    self->mix = audiofx_float_to_q15(mix, MP_QSTR_mix);
+}
+
+void audiofx_reverb_reset_buffer(audiofx_reverb_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel) {
+    if (!single_channel_output || channel == 0) {
+        memset(self->line_buffer, 0, self->line_buffer_length * sizeof(int16_t));
+        for (size_t i = 0; i < AUDIOFX_REVERB_COMBS; i++) {
+            self->comb[i].position = 0;
+            self->comb[i].filter_store = 0;
+        }
+        for (size_t i = 0; i < AUDIOFX_REVERB_ALLPASSES; i++) {
+            self->allpass[i].position = 0;
+        }
+    }
+    audiofx_effect_reset_buffer(&self->effect, single_channel_output, channel);
+}
+
+static inline int32_t comb_process(audiofx_reverb_line_t *comb, int32_t input, int32_t feedback, int32_t damping) {
+    int32_t output = comb->buffer[comb->position];
+    comb->filter_store = (output * (AUDIOFX_UNITY - damping) + comb->filter_store * damping) >> 15;
+    comb->buffer[comb->position] = audiofx_saturate16(input + ((comb->filter_store * feedback) >> 15));
+    if (++comb->position == comb->length) {
+        comb->position = 0;
+    }
+    return output;
+}
+
+static inline int32_t allpass_process(audiofx_reverb_line_t *allpass, int32_t input) {
+    int32_t delayed = allpass->buffer[allpass->position];
+    allpass->buffer[allpass->position] = audiofx_saturate16(input + (delayed >> 1));
+    if (++allpass->position == allpass->length) {
+        allpass->position = 0;
+    }
+    return delayed - input;
+}
+
+STATIC void reverb_process(audiofx_effect_obj_t *effect, int16_t *buffer, uint32_t length) {
+    audiofx_reverb_obj_t *self = (audiofx_reverb_obj_t *)effect;
+    uint8_t channel_count = effect->channel_count;
+    int32_t feedback = self->comb_feedback;
+    int32_t damping = self->comb_damping;
+    uint16_t mix = self->mix;
+
+    for (uint32_t i = 0; i < length; i += channel_count) {
+        int32_t input = buffer[i];
+        if (channel_count == 2) {
+            input = (input + buffer[i + 1]) / 2;
+        }
+        // Scale the input down so the resonating combs rarely saturate.
+        input >>= 2;
+        int32_t wet = 0;
+        for (size_t c = 0; c < AUDIOFX_REVERB_COMBS; c++) {
+            wet += comb_process(&self->comb[c], input, feedback, damping);
+        }
+        wet = audiofx_saturate16(wet / AUDIOFX_REVERB_COMBS * 2);
+        for (size_t a = 0; a < AUDIOFX_REVERB_ALLPASSES; a++) {
+            wet = audiofx_saturate16(allpass_process(&self->allpass[a], wet));
+        }
+        for (uint8_t c = 0; c < channel_count; c++) {
+            buffer[i + c] = audiofx_mix(buffer[i + c], wet, mix);
+        }
+    }
+}
+
+audioio_get_buffer_result_t audiofx_reverb_get_buffer(audiofx_reverb_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length) {
+    return audiofx_effect_get_buffer(&self->effect, single_channel_output, channel, buffer, buffer_length, reverb_process);
+}
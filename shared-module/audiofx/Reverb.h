@@ -0,0 +1,66 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "shared-module/audiofx/__init__.h"
+
+#define AUDIOFX_REVERB_COMBS (4)
+#define AUDIOFX_REVERB_ALLPASSES (2)
+
+typedef struct {
+    int16_t *buffer;
+    uint32_t length;
+    uint32_t position;
+    int32_t filter_store; // Comb filters only: the damping low pass state
+} audiofx_reverb_line_t;
+
+typedef struct {
+    audiofx_effect_obj_t effect;
+    // Freeverb style: parallel damped comb filters into series allpass filters, on the mono sum
+    // of the input. All lines share one allocation.
+    int16_t *line_buffer;
+    uint32_t line_buffer_length; // in samples
+    audiofx_reverb_line_t comb[AUDIOFX_REVERB_COMBS];
+    audiofx_reverb_line_t allpass[AUDIOFX_REVERB_ALLPASSES];
+    uint16_t room_size; // Q15
+    uint16_t damping; // Q15
+    uint16_t mix; // Q15
+    uint16_t comb_feedback; // Q15, from room_size
+    uint16_t comb_damping; // Q15, from damping
+} audiofx_reverb_obj_t;
+
+// These are not available from Python because it may be called in an interrupt.
+void audiofx_reverb_reset_buffer(audiofx_reverb_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel);
+audioio_get_buffer_result_t audiofx_reverb_get_buffer(audiofx_reverb_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length);                                                      // length in bytes
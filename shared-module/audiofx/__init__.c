@@ -0,0 +1,210 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/audiofx/__init__.h"
+#include "shared-module/audiofx/__init__.h"
+
+#include <string.h>
+
+#include "py/runtime.h"
+
+uint16_t audiofx_float_to_q15(mp_float_t value, qstr arg_name) {
+    value = mp_arg_validate_float_range(value, 0, 1, arg_name);
+    return (uint16_t)(value * AUDIOFX_UNITY);
+}
+
+mp_float_t audiofx_q15_to_float(uint16_t value) {
+    return (mp_float_t)value / AUDIOFX_UNITY;
+}
+
+void audiofx_effect_construct(audiofx_effect_obj_t *self, uint32_t buffer_size,
+    uint8_t channel_count, uint32_t sample_rate) {
+    // Whole frames of 16 bit samples, so the channels stay interleaved across buffers.
+    self->buffer_length = buffer_size / (sizeof(int16_t) * channel_count) * channel_count;
+    self->channel_count = channel_count;
+    self->sample_rate = sample_rate;
+
+    // The output DMA reads these, so keep them out of PSRAM when possible.
+    for (size_t i = 0; i < 2; i++) {
+        self->buffer[i] = m_malloc_fast(self->buffer_length * sizeof(int16_t));
+        if (self->buffer[i] == NULL) {
+            audiofx_effect_deinit(self);
+            m_malloc_fail(self->buffer_length * sizeof(int16_t));
+        }
+    }
+    self->sample = NULL;
+}
+
+void audiofx_effect_deinit(audiofx_effect_obj_t *self) {
+    self->buffer[0] = NULL;
+    self->buffer[1] = NULL;
+    self->sample = NULL;
+}
+
+bool common_hal_audiofx_effect_deinited(audiofx_effect_obj_t *self) {
+    return self->buffer[0] == NULL;
+}
+
+void common_hal_audiofx_effect_play(audiofx_effect_obj_t *self, mp_obj_t sample, bool loop) {
+    if (audiosample_sample_rate(sample) != self->sample_rate) {
+        mp_raise_ValueError(MP_ERROR_TEXT("The sample's sample rate does not match the effect's"));
+    }
+    if (audiosample_channel_count(sample) != self->channel_count) {
+        mp_raise_ValueError(MP_ERROR_TEXT("The sample's channel count does not match the effect's"));
+    }
+    if (audiosample_bits_per_sample(sample) != 16) {
+        mp_raise_ValueError(MP_ERROR_TEXT("The sample's bits_per_sample does not match the effect's"));
+    }
+    bool single_buffer;
+    bool samples_signed;
+    uint32_t max_buffer_length;
+    uint8_t spacing;
+    audiosample_get_buffer_structure(sample, false, &single_buffer, &samples_signed,
+        &max_buffer_length, &spacing);
+    if (!samples_signed) {
+        mp_raise_ValueError(MP_ERROR_TEXT("The sample's signedness does not match the effect's"));
+    }
+    self->sample = sample;
+    self->loop = loop;
+
+    audiosample_reset_buffer(sample, false, 0);
+    audioio_get_buffer_result_t result = audiosample_get_buffer(sample, false, 0, (uint8_t **)&self->remaining_buffer, &self->remaining_length);
+    // Track length in terms of samples.
+    self->remaining_length /= sizeof(int16_t);
+    self->more_data = result == GET_BUFFER_MORE_DATA;
+}
+
+void common_hal_audiofx_effect_stop(audiofx_effect_obj_t *self) {
+    self->sample = NULL;
+}
+
+bool common_hal_audiofx_effect_get_playing(audiofx_effect_obj_t *self) {
+    return self->sample != NULL;
+}
+
+uint32_t common_hal_audiofx_effect_get_sample_rate(audiofx_effect_obj_t *self) {
+    return self->sample_rate;
+}
+
+uint8_t common_hal_audiofx_effect_get_channel_count(audiofx_effect_obj_t *self) {
+    return self->channel_count;
+}
+
+uint8_t common_hal_audiofx_effect_get_bits_per_sample(audiofx_effect_obj_t *self) {
+    return 16;
+}
+
+void audiofx_effect_reset_buffer(audiofx_effect_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel) {
+    if (single_channel_output && channel == 1) {
+        return;
+    }
+    self->read_count = 0;
+    self->left_read_count = 0;
+    self->right_read_count = 0;
+}
+
+// Copy the dry input into buffer, filling with silence after the sample ends so that the
+// effect's tail still plays out.
+static void load_input(audiofx_effect_obj_t *self, int16_t *buffer, uint32_t length) {
+    while (length != 0) {
+        if (self->sample == NULL) {
+            memset(buffer, 0, length * sizeof(int16_t));
+            return;
+        }
+        if (self->remaining_length == 0) {
+            if (!self->more_data) {
+                if (self->loop) {
+                    audiosample_reset_buffer(self->sample, false, 0);
+                } else {
+                    self->sample = NULL;
+                    continue;
+                }
+            }
+            audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, (uint8_t **)&self->remaining_buffer, &self->remaining_length);
+            self->remaining_length /= sizeof(int16_t);
+            self->more_data = result == GET_BUFFER_MORE_DATA;
+            if (result == GET_BUFFER_ERROR) {
+                self->sample = NULL;
+                continue;
+            }
+        }
+        uint32_t n = MIN(self->remaining_length, length);
+        memcpy(buffer, self->remaining_buffer, n * sizeof(int16_t));
+        buffer += n;
+        length -= n;
+        self->remaining_buffer += n;
+        self->remaining_length -= n;
+    }
+}
+
+audioio_get_buffer_result_t audiofx_effect_get_buffer(audiofx_effect_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length,
+    audiofx_process_fun process) {
+    if (!single_channel_output) {
+        channel = 0;
+    }
+
+    uint32_t channel_read_count = self->left_read_count;
+    if (channel == 1) {
+        channel_read_count = self->right_read_count;
+    }
+    *buffer_length = self->buffer_length * sizeof(int16_t);
+
+    if (self->read_count == channel_read_count) {
+        self->buffer_index = !self->buffer_index;
+        int16_t *output = self->buffer[self->buffer_index];
+        load_input(self, output, self->buffer_length);
+        process(self, output, self->buffer_length);
+        self->read_count += 1;
+    }
+    *buffer = (uint8_t *)self->buffer[self->buffer_index];
+
+    if (channel == 0) {
+        self->left_read_count += 1;
+    } else if (channel == 1) {
+        self->right_read_count += 1;
+        *buffer = *buffer + sizeof(int16_t);
+    }
+    return GET_BUFFER_MORE_DATA;
+}
+
+void audiofx_effect_get_buffer_structure(audiofx_effect_obj_t *self, bool single_channel_output,
+    bool *single_buffer, bool *samples_signed,
+    uint32_t *max_buffer_length, uint8_t *spacing) {
+    *single_buffer = false;
+    *samples_signed = true;
+    *max_buffer_length = self->buffer_length * sizeof(int16_t);
+    if (single_channel_output) {
+        *spacing = self->channel_count;
+    } else {
+        *spacing = 1;
+    }
+}
@@ -0,0 +1,94 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "shared-module/audiocore/__init__.h"
+
+// Q15 value that leaves samples unchanged.
+#define AUDIOFX_UNITY (1 << 15)
+
+// State shared by every effect: the sample being processed and the double buffered output.
+// Each effect type starts with one of these so the common functions can take any effect.
+typedef struct audiofx_effect_obj {
+    mp_obj_base_t base;
+    int16_t *buffer[2];
+    uint32_t buffer_length; // in samples
+    uint32_t sample_rate;
+    uint8_t channel_count;
+    uint8_t buffer_index;
+
+    uint32_t read_count;
+    uint32_t left_read_count;
+    uint32_t right_read_count;
+
+    mp_obj_t sample;
+    int16_t *remaining_buffer;
+    uint32_t remaining_length; // in samples
+    bool loop;
+    bool more_data;
+} audiofx_effect_obj_t;
+
+// Processes length interleaved samples in place. buffer holds the dry input on entry.
+typedef void (*audiofx_process_fun)(audiofx_effect_obj_t *self, int16_t *buffer, uint32_t length);
+
+static inline int16_t audiofx_saturate16(int32_t value) {
+    if (value > INT16_MAX) {
+        return INT16_MAX;
+    }
+    if (value < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return value;
+}
+
+// Blend dry and wet by mix, a Q15 fraction of the wet signal.
+static inline int16_t audiofx_mix(int32_t dry, int32_t wet, uint16_t mix) {
+    return audiofx_saturate16((dry * (AUDIOFX_UNITY - mix) + wet * mix) >> 15);
+}
+
+uint16_t audiofx_float_to_q15(mp_float_t value, qstr arg_name);
+mp_float_t audiofx_q15_to_float(uint16_t value);
+
+void audiofx_effect_construct(audiofx_effect_obj_t *self, uint32_t buffer_size,
+    uint8_t channel_count, uint32_t sample_rate);
+void audiofx_effect_deinit(audiofx_effect_obj_t *self);
+
+// These are not available from Python because it may be called in an interrupt.
+void audiofx_effect_reset_buffer(audiofx_effect_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel);
+audioio_get_buffer_result_t audiofx_effect_get_buffer(audiofx_effect_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length,
+    audiofx_process_fun process);
+void audiofx_effect_get_buffer_structure(audiofx_effect_obj_t *self, bool single_channel_output,
+    bool *single_buffer, bool *samples_signed,
+    uint32_t *max_buffer_length, uint8_t *spacing);
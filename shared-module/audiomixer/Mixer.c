@@ -30,6 +30,7 @@
 #include "shared-bindings/audiomixer/MixerVoice.h"
 
 #include <stdint.h>
+#include <string.h>
 
 #include "py/runtime.h"
 #include "shared-module/audiocore/__init__.h"
@@ -38,6 +39,17 @@
 #include "cmsis_compiler.h"
 #endif
 
+// Use the packed SIMD instructions of the DSP extension when the core has them. This
+// covers ARMv7E-M (Cortex-M4/M7) and ARMv8-M Mainline cores built with DSP (Cortex-M33).
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define MIXER_USE_DSP (1)
+#else
+#define MIXER_USE_DSP (0)
+#endif
+
+// Voice level that leaves samples unchanged.
+#define MIXER_UNITY_LEVEL (1 << 15)
+
 void common_hal_audiomixer_mixer_construct(audiomixer_mixer_obj_t *self,
     uint8_t voice_count,
     uint32_t buffer_size,
@@ -47,13 +59,14 @@ void common_hal_audiomixer_mixer_construct(audiomixer_mixer_obj_t *self,
     uint32_t sample_rate) {
     self->len = buffer_size / 2 / sizeof(uint32_t) * sizeof(uint32_t);
 
-    self->first_buffer = m_malloc(self->len);
+    // The output DMA reads these, so keep them out of PSRAM when possible.
+    self->first_buffer = m_malloc_fast(self->len);
     if (self->first_buffer == NULL) {
         common_hal_audiomixer_mixer_deinit(self);
         m_malloc_fail(self->len);
     }
 
-    self->second_buffer = m_malloc(self->len);
+    self->second_buffer = m_malloc_fast(self->len);
     if (self->second_buffer == NULL) {
         common_hal_audiomixer_mixer_deinit(self);
         m_malloc_fail(self->len);
@@ -106,7 +119,7 @@ void audiomixer_mixer_reset_buffer(audiomixer_mixer_obj_t *self,
 
 __attribute__((always_inline))
 static inline uint32_t add16signed(uint32_t a, uint32_t b) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_USE_DSP
     return __QADD16(a, b);
     #else
     uint32_t result = 0;
@@ -127,7 +140,7 @@ static inline uint32_t add16signed(uint32_t a, uint32_t b) {
 
 __attribute__((always_inline))
 static inline uint32_t mult16signed(uint32_t val, int32_t mul) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_USE_DSP
     mul <<= 16;
     int32_t hi, lo;
     enum { bits = 16 }; // saturate to 16 bits
@@ -139,11 +152,11 @@ static inline uint32_t mult16signed(uint32_t val, int32_t mul) {
     asm volatile ("pkhbt %0, %1, %2, lsl #16" : "=r" (val) : "r" (lo), "r" (hi)); // pack
     return val;
     #else
+    // Same Q15 fixed point scaling as the DSP path, so both produce identical samples.
     uint32_t result = 0;
-    float mod_mul = (float)mul / (float)((1 << 15) - 1);
     for (int8_t i = 0; i < 2; i++) {
         int16_t ai = (val >> (sizeof(uint16_t) * 8 * i));
-        int32_t intermediate = (int32_t)(ai * mod_mul);
+        int32_t intermediate = (ai * mul) >> 15;
         if (intermediate > SHRT_MAX) {
             intermediate = SHRT_MAX;
         } else if (intermediate < SHRT_MIN) {
@@ -157,7 +170,7 @@ static inline uint32_t mult16signed(uint32_t val, int32_t mul) {
 }
 
 static inline uint32_t tounsigned8(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_USE_DSP
     return __UADD8(val, 0x80808080);
     #else
     return val ^ 0x80808080;
@@ -165,7 +178,7 @@ static inline uint32_t tounsigned8(uint32_t val) {
 }
 
 static inline uint32_t tounsigned16(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_USE_DSP
     return __UADD16(val, 0x80008000);
     #else
     return val ^ 0x80008000;
@@ -173,7 +186,7 @@ static inline uint32_t tounsigned16(uint32_t val) {
 }
 
 static inline uint32_t tosigned16(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_USE_DSP
     return __UADD16(val, 0x80008000);
     #else
     return val ^ 0x80008000;
@@ -188,9 +201,136 @@ static inline uint32_t pack8(uint32_t val) {
     return ((val & 0xff000000) >> 16) | ((val & 0xff00) >> 8);
 }
 
+static inline int16_t saturate16(int32_t value) {
+    return MIN(MAX(value, INT16_MIN), INT16_MAX);
+}
+
+static void push_frame(audiomixer_mixer_obj_t *self, audiomixer_mixervoice_obj_t *voice, const int16_t *frame) {
+    for (uint8_t c = 0; c < self->channel_count; c++) {
+        int16_t *history = voice->history[c];
+        memmove(history, history + 1, (AUDIOMIXER_RESAMPLE_TAPS - 1) * sizeof(int16_t));
+        history[AUDIOMIXER_RESAMPLE_TAPS - 1] = frame[c];
+    }
+}
+
+// Appends the next input frame to the voice's history in the mixer's channel layout. Returns
+// false when the sample has ended and its last frame has been output.
+static bool load_input_frame(audiomixer_mixer_obj_t *self, audiomixer_mixervoice_obj_t *voice) {
+    uint8_t bytes_per_sample = self->bits_per_sample / 8;
+    uint32_t frame_size = voice->input_channel_count * bytes_per_sample;
+    int16_t frame[2] = { 0, 0 };
+    while (voice->input_length < frame_size) {
+        if (!voice->more_data) {
+            if (voice->loop) {
+                audiosample_reset_buffer(voice->sample, false, 0);
+            } else if (voice->tail_frames < AUDIOMIXER_RESAMPLE_TAPS / 2) {
+                // Follow the sample with silence until its last frame has been output.
+                voice->tail_frames++;
+                push_frame(self, voice, frame);
+                return true;
+            } else {
+                voice->sample = NULL;
+                return false;
+            }
+        }
+        audioio_get_buffer_result_t result = audiosample_get_buffer(voice->sample, false, 0, &voice->input, &voice->input_length);
+        voice->more_data = result == GET_BUFFER_MORE_DATA;
+    }
+
+    for (uint8_t c = 0; c < voice->input_channel_count; c++) {
+        if (bytes_per_sample == 2) {
+            uint16_t value = ((uint16_t *)voice->input)[c];
+            if (!self->samples_signed) {
+                value ^= 0x8000;
+            }
+            frame[c] = value;
+        } else {
+            uint8_t value = voice->input[c];
+            if (!self->samples_signed) {
+                value ^= 0x80;
+            }
+            frame[c] = (int8_t)value * 256;
+        }
+    }
+    voice->input += frame_size;
+    voice->input_length -= frame_size;
+
+    if (voice->input_channel_count == 1) {
+        frame[1] = frame[0];
+    } else if (self->channel_count == 1) {
+        frame[0] = (frame[0] + frame[1]) / 2;
+    }
+    push_frame(self, voice, frame);
+    return true;
+}
+
+static int32_t resample(audiomixer_mixervoice_obj_t *voice, uint8_t channel) {
+    const int16_t *history = voice->history[channel];
+    uint32_t fraction = voice->position;
+    if (voice->filter == NULL) {
+        int32_t before = history[AUDIOMIXER_RESAMPLE_TAPS / 2 - 1];
+        int32_t after = history[AUDIOMIXER_RESAMPLE_TAPS / 2];
+        return before + (((after - before) * (int32_t)(fraction >> 1)) >> 15);
+    }
+    const int16_t *taps = voice->filter + (fraction / (AUDIOMIXER_RESAMPLE_ONE / AUDIOMIXER_RESAMPLE_PHASES)) * AUDIOMIXER_RESAMPLE_TAPS;
+    int32_t sum = 0;
+    for (size_t i = 0; i < AUDIOMIXER_RESAMPLE_TAPS; i++) {
+        sum += history[i] * taps[i];
+    }
+    return sum >> 15;
+}
+
+// Mixes a voice whose sample rate or channel count differs from the mixer's. This works a
+// frame at a time, so it is slower than mix_down_one_voice's word at a time loops.
+static void mix_down_converted_voice(audiomixer_mixer_obj_t *self,
+    audiomixer_mixervoice_obj_t *voice, bool voices_active,
+    uint32_t *word_buffer, uint32_t length) {
+    uint8_t channel_count = self->channel_count;
+    uint32_t sample_count = length * sizeof(uint32_t) / (self->bits_per_sample / 8);
+    uint32_t frame_count = sample_count / channel_count;
+    int16_t *hword_buffer = (int16_t *)word_buffer;
+    int8_t *byte_buffer = (int8_t *)word_buffer;
+    uint16_t level = voice->level;
+
+    uint32_t i = 0;
+    for (uint32_t frame = 0; frame < frame_count; frame++) {
+        while (voice->position >= AUDIOMIXER_RESAMPLE_ONE) {
+            if (!load_input_frame(self, voice)) {
+                goto done;
+            }
+            voice->position -= AUDIOMIXER_RESAMPLE_ONE;
+        }
+        for (uint8_t c = 0; c < channel_count; c++, i++) {
+            int32_t sample = saturate16(resample(voice, c));
+            sample = (sample * level) >> 15;
+            if (self->bits_per_sample == 16) {
+                if (voices_active) {
+                    sample += hword_buffer[i];
+                }
+                hword_buffer[i] = saturate16(sample);
+            } else {
+                sample >>= 8;
+                if (voices_active) {
+                    sample += byte_buffer[i];
+                }
+                byte_buffer[i] = MIN(MAX(sample, INT8_MIN), INT8_MAX);
+            }
+        }
+        voice->position += voice->step;
+    }
+done:
+    if (!voices_active) {
+        memset(byte_buffer + i * (self->bits_per_sample / 8), 0, (sample_count - i) * (self->bits_per_sample / 8));
+    }
+}
+
 static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
     audiomixer_mixervoice_obj_t *voice, bool voices_active,
     uint32_t *word_buffer, uint32_t length) {
+    if (voice->convert) {
+        mix_down_converted_voice(self, voice, voices_active, word_buffer, length);
+        return;
+    }
     while (length != 0) {
         if (voice->buffer_length == 0) {
             if (!voice->more_data) {
@@ -216,7 +356,16 @@ static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
 
         // First active voice gets copied over verbatim.
         if (!voices_active) {
-            if (MP_LIKELY(self->bits_per_sample == 16)) {
+            if (MP_LIKELY(self->bits_per_sample == 16) && level == MIXER_UNITY_LEVEL) {
+                // Full volume needs no scaling, just a copy.
+                if (MP_LIKELY(self->samples_signed)) {
+                    memcpy(word_buffer, src, n * sizeof(uint32_t));
+                } else {
+                    for (uint32_t i = 0; i < n; i++) {
+                        word_buffer[i] = tosigned16(src[i]);
+                    }
+                }
+            } else if (MP_LIKELY(self->bits_per_sample == 16)) {
                 if (MP_LIKELY(self->samples_signed)) {
                     for (uint32_t i = 0; i < n; i++) {
                         uint32_t v = src[i];
@@ -242,7 +391,17 @@ static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
                 }
             }
         } else {
-            if (MP_LIKELY(self->bits_per_sample == 16)) {
+            if (MP_LIKELY(self->bits_per_sample == 16) && level == MIXER_UNITY_LEVEL) {
+                if (MP_LIKELY(self->samples_signed)) {
+                    for (uint32_t i = 0; i < n; i++) {
+                        word_buffer[i] = add16signed(src[i], word_buffer[i]);
+                    }
+                } else {
+                    for (uint32_t i = 0; i < n; i++) {
+                        word_buffer[i] = add16signed(tosigned16(src[i]), word_buffer[i]);
+                    }
+                }
+            } else if (MP_LIKELY(self->bits_per_sample == 16)) {
                 if (MP_LIKELY(self->samples_signed)) {
                     for (uint32_t i = 0; i < n; i++) {
                         uint32_t word = src[i];
@@ -27,7 +27,9 @@
 #include "shared-bindings/audiomixer/MixerVoice.h"
 #include "shared-module/audiomixer/MixerVoice.h"
 
+#include <math.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "py/runtime.h"
 #include "shared-module/audiomixer/__init__.h"
@@ -50,14 +52,43 @@ void common_hal_audiomixer_mixervoice_set_level(audiomixer_mixervoice_obj_t *sel
     self->level = (uint16_t)(level * (1 << 15));
 }
 
-void common_hal_audiomixer_mixervoice_play(audiomixer_mixervoice_obj_t *self, mp_obj_t sample, bool loop) {
-    if (audiosample_sample_rate(sample) != self->parent->sample_rate) {
-        mp_raise_ValueError(MP_ERROR_TEXT("The sample's sample rate does not match the mixer's"));
-    }
-    if (audiosample_channel_count(sample) != self->parent->channel_count) {
-        mp_raise_ValueError(MP_ERROR_TEXT("The sample's channel count does not match the mixer's"));
+// Windowed sinc low pass for every phase of the polyphase resampler. The cutoff is the lower
+// of the two Nyquist frequencies so that downsampling doesn't alias.
+STATIC int16_t *make_resample_filter(uint32_t input_rate, uint32_t output_rate) {
+    const mp_float_t pi = MICROPY_FLOAT_CONST(3.14159265358979323846);
+    size_t count = AUDIOMIXER_RESAMPLE_PHASES * AUDIOMIXER_RESAMPLE_TAPS;
+    int16_t *filter = m_malloc(count * sizeof(int16_t));
+    mp_float_t cutoff = MIN((mp_float_t)output_rate / input_rate, MICROPY_FLOAT_CONST(1.0));
+
+    for (size_t phase = 0; phase < AUDIOMIXER_RESAMPLE_PHASES; phase++) {
+        mp_float_t taps[AUDIOMIXER_RESAMPLE_TAPS];
+        mp_float_t sum = 0;
+        mp_float_t fraction = (mp_float_t)phase / AUDIOMIXER_RESAMPLE_PHASES;
+        for (size_t i = 0; i < AUDIOMIXER_RESAMPLE_TAPS; i++) {
+            // Distance in input frames from the output frame, which lies fraction of the way
+            // from the tap at AUDIOMIXER_RESAMPLE_TAPS / 2 - 1 to the next.
+            mp_float_t distance = (mp_float_t)i - (AUDIOMIXER_RESAMPLE_TAPS / 2 - 1) - fraction;
+            mp_float_t x = pi * cutoff * distance;
+            mp_float_t sinc = x == 0 ? 1 : MICROPY_FLOAT_C_FUN(sin)(x) / x;
+            // Blackman window spanning the taps.
+            mp_float_t u = 2 * pi * (distance + AUDIOMIXER_RESAMPLE_TAPS / 2) / AUDIOMIXER_RESAMPLE_TAPS;
+            mp_float_t window = MICROPY_FLOAT_CONST(0.42) - MICROPY_FLOAT_CONST(0.5) * MICROPY_FLOAT_C_FUN(cos)(u)
+                + MICROPY_FLOAT_CONST(0.08) * MICROPY_FLOAT_C_FUN(cos)(2 * u);
+            taps[i] = sinc * window;
+            sum += taps[i];
+        }
+        // Normalize each phase to unity gain so that constant input stays constant.
+        for (size_t i = 0; i < AUDIOMIXER_RESAMPLE_TAPS; i++) {
+            int32_t coefficient = (int32_t)MICROPY_FLOAT_C_FUN(round)(taps[i] / sum * (1 << 15));
+            filter[phase * AUDIOMIXER_RESAMPLE_TAPS + i] = MIN(coefficient, INT16_MAX);
+        }
     }
-    if (audiosample_bits_per_sample(sample) != self->parent->bits_per_sample) {
+    return filter;
+}
+
+void common_hal_audiomixer_mixervoice_play(audiomixer_mixervoice_obj_t *self, mp_obj_t sample, bool loop, bool polyphase) {
+    audiomixer_mixer_obj_t *parent = self->parent;
+    if (audiosample_bits_per_sample(sample) != parent->bits_per_sample) {
         mp_raise_ValueError(MP_ERROR_TEXT("The sample's bits_per_sample does not match the mixer's"));
     }
     bool single_buffer;
@@ -66,17 +97,46 @@ void common_hal_audiomixer_mixervoice_play(audiomixer_mixervoice_obj_t *self, mp
     uint8_t spacing;
     audiosample_get_buffer_structure(sample, false, &single_buffer, &samples_signed,
         &max_buffer_length, &spacing);
-    if (samples_signed != self->parent->samples_signed) {
+    if (samples_signed != parent->samples_signed) {
         mp_raise_ValueError(MP_ERROR_TEXT("The sample's signedness does not match the mixer's"));
     }
-    self->sample = sample;
+
+    uint32_t sample_rate = audiosample_sample_rate(sample);
+    uint8_t channel_count = audiosample_channel_count(sample);
+    bool convert = sample_rate != parent->sample_rate || channel_count != parent->channel_count;
+    // Allocate before touching the voice because the mixer may be reading it in the background.
+    int16_t *filter = NULL;
+    if (polyphase && sample_rate != parent->sample_rate) {
+        filter = make_resample_filter(sample_rate, parent->sample_rate);
+    }
+    self->sample = NULL;
+
+    self->convert = convert;
+    if (convert) {
+        self->input_channel_count = channel_count;
+        self->tail_frames = 0;
+        self->step = ((uint64_t)sample_rate << 16) / parent->sample_rate;
+        // Load enough frames for the first output frame to land on the first input frame.
+        self->position = (AUDIOMIXER_RESAMPLE_TAPS / 2 + 1) * AUDIOMIXER_RESAMPLE_ONE;
+        self->filter = filter;
+        memset(self->history, 0, sizeof(self->history));
+    }
     self->loop = loop;
 
     audiosample_reset_buffer(sample, false, 0);
-    audioio_get_buffer_result_t result = audiosample_get_buffer(sample, false, 0, (uint8_t **)&self->remaining_buffer, &self->buffer_length);
-    // Track length in terms of words.
-    self->buffer_length /= sizeof(uint32_t);
+    uint8_t *buffer;
+    uint32_t buffer_length;
+    audioio_get_buffer_result_t result = audiosample_get_buffer(sample, false, 0, &buffer, &buffer_length);
+    if (convert) {
+        self->input = buffer;
+        self->input_length = buffer_length;
+    } else {
+        self->remaining_buffer = (uint32_t *)buffer;
+        // Track length in terms of words.
+        self->buffer_length = buffer_length / sizeof(uint32_t);
+    }
     self->more_data = result == GET_BUFFER_MORE_DATA;
+    self->sample = sample;
 }
 
 bool common_hal_audiomixer_mixervoice_get_playing(audiomixer_mixervoice_obj_t *self) {
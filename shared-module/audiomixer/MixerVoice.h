@@ -31,6 +31,12 @@
 #include "shared-module/audiomixer/__init__.h"
 #include "shared-module/audiomixer/Mixer.h"
 
+// Polyphase resampling filter size. Linear interpolation uses the middle two taps of the history.
+#define AUDIOMIXER_RESAMPLE_TAPS (8)
+#define AUDIOMIXER_RESAMPLE_PHASES (32)
+// 1.0 in the 16.16 fixed point used for resampling positions.
+#define AUDIOMIXER_RESAMPLE_ONE (1 << 16)
+
 typedef struct {
     mp_obj_base_t base;
     audiomixer_mixer_obj_t *parent;
@@ -40,6 +46,20 @@ typedef struct {
     uint32_t *remaining_buffer;
     uint32_t buffer_length;
     uint16_t level;
+
+    // Set when the sample's sample rate or channel count differs from the mixer's. The sample
+    // is then read a frame at a time from input and converted instead of mixed a word at a time.
+    bool convert;
+    uint8_t input_channel_count;
+    uint8_t tail_frames; // silent frames loaded after the sample ended
+    uint8_t *input;
+    uint32_t input_length; // in bytes
+    uint32_t step; // input frames per output frame, 16.16 fixed point
+    uint32_t position; // of the next output frame past history[][TAPS / 2 - 1], 16.16 fixed point
+    // Q15 coefficients, AUDIOMIXER_RESAMPLE_TAPS per phase. NULL for linear interpolation.
+    int16_t *filter;
+    // The most recent input frames in the mixer's channel layout, oldest first.
+    int16_t history[2][AUDIOMIXER_RESAMPLE_TAPS];
 } audiomixer_mixervoice_obj_t;
 
 
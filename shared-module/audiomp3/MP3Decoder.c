@@ -36,6 +36,7 @@
 
 #include "shared-module/audiomp3/MP3Decoder.h"
 #include "supervisor/background_callback.h"
+#include "supervisor/shared/tick.h"
 #include "lib/mp3/src/mp3common.h"
 
 #define MAX_BUFFER_LEN (MAX_NSAMP * MAX_NGRAN * MAX_NCHAN * sizeof(int16_t))
@@ -64,10 +65,12 @@ STATIC bool mp3file_update_inbuf_always(audiomp3_mp3file_obj_t *self) {
         UINT to_read = end_of_buffer - new_end_of_data;
         UINT bytes_read = 0;
         memset(new_end_of_data, 0, to_read);
+        uint32_t start_ms = supervisor_ticks_ms32();
         if (f_read(&self->file->fp, new_end_of_data, to_read, &bytes_read) != FR_OK) {
             self->eof = true;
             mp_raise_OSError(MP_EIO);
         }
+        self->max_read_ms = MAX(self->max_read_ms, supervisor_ticks_ms32() - start_ms);
 
         if (bytes_read == 0) {
             self->eof = true;
@@ -93,6 +96,18 @@ STATIC void mp3file_update_inbuf_cb(void *self) {
     mp3file_update_inbuf_always(self);
 }
 
+/** Read ahead from a background callback once a quarter of the input buffer
+ * has been consumed, so the decoder rarely has to wait on the file itself.
+ */
+STATIC void mp3file_schedule_read_ahead(audiomp3_mp3file_obj_t *self) {
+    if (!self->eof && self->inbuf_offset >= self->inbuf_length / 4) {
+        background_callback_add(
+            &self->inbuf_fill_cb,
+            mp3file_update_inbuf_cb,
+            self);
+    }
+}
+
 /** Fill the input buffer if it is less than half full.
  *
  * Returns the same as mp3file_update_inbuf_always.
@@ -176,7 +191,8 @@ STATIC bool mp3file_get_next_frame_info(audiomp3_mp3file_obj_t *self, MP3FrameIn
 void common_hal_audiomp3_mp3file_construct(audiomp3_mp3file_obj_t *self,
     pyb_file_obj_t *file,
     uint8_t *buffer,
-    size_t buffer_size) {
+    size_t buffer_size,
+    size_t input_buffer_size) {
     // XXX Adafruit_MP3 uses a 2kB input buffer and two 4kB output buffers.
     // for a whopping total of 10kB buffers (+mp3 decoder state and frame buffer)
     // At 44kHz, that's 23ms of output audio data.
@@ -187,7 +203,8 @@ void common_hal_audiomp3_mp3file_construct(audiomp3_mp3file_obj_t *self,
     // than the two 4kB output buffers, except that the alignment allows to
     // never allocate that extra frame buffer.
 
-    self->inbuf_length = 2048;
+    // The input buffer is on the heap, so it lands in PSRAM on boards whose heap is there.
+    self->inbuf_length = input_buffer_size;
     self->inbuf_offset = self->inbuf_length;
     self->inbuf = m_malloc(self->inbuf_length);
     if (self->inbuf == NULL) {
@@ -255,6 +272,8 @@ void common_hal_audiomp3_mp3file_set_file(audiomp3_mp3file_obj_t *self, pyb_file
     self->frame_buffer_size = fi.outputSamps * sizeof(int16_t);
     self->len = 2 * self->frame_buffer_size;
     self->samples_decoded = 0;
+    self->underruns = 0;
+    self->max_read_ms = 0;
 }
 
 void common_hal_audiomp3_mp3file_deinit(audiomp3_mp3file_obj_t *self) {
@@ -337,6 +356,11 @@ audioio_get_buffer_result_t audiomp3_mp3file_get_buffer(audiomp3_mp3file_obj_t *
     int16_t *buffer = (int16_t *)(void *)self->buffers[self->buffer_index];
     *bufptr = (uint8_t *)buffer;
 
+    if (!self->eof && self->inbuf_offset >= self->inbuf_length / 2) {
+        // Read-ahead fell behind, so the file is about to be read synchronously.
+        self->underruns++;
+    }
+
     mp3file_skip_id3v2(self);
     if (!mp3file_find_sync_word(self)) {
         *buffer_length = 0;
@@ -357,12 +381,7 @@ audioio_get_buffer_result_t audiomp3_mp3file_get_buffer(audiomp3_mp3file_obj_t *
     mp3file_skip_id3v2(self);
     int result = mp3file_find_sync_word(self) ? GET_BUFFER_MORE_DATA : GET_BUFFER_DONE;
 
-    if (self->inbuf_offset >= 512) {
-        background_callback_add(
-            &self->inbuf_fill_cb,
-            mp3file_update_inbuf_cb,
-            self);
-    }
+    mp3file_schedule_read_ahead(self);
 
     return result;
 }
@@ -393,3 +412,11 @@ float common_hal_audiomp3_mp3file_get_rms_level(audiomp3_mp3file_obj_t *self) {
 uint32_t common_hal_audiomp3_mp3file_get_samples_decoded(audiomp3_mp3file_obj_t *self) {
     return self->samples_decoded;
 }
+
+uint32_t common_hal_audiomp3_mp3file_get_underruns(audiomp3_mp3file_obj_t *self) {
+    return self->underruns;
+}
+
+mp_float_t common_hal_audiomp3_mp3file_get_max_read_time(audiomp3_mp3file_obj_t *self) {
+    return self->max_read_ms / MICROPY_FLOAT_CONST(1000.0);
+}
@@ -34,6 +34,9 @@
 
 #include "shared-module/audiocore/__init__.h"
 
+// Smallest input buffer that is guaranteed to hold a whole frame.
+#define AUDIOMP3_MIN_INPUT_BUFFER_SIZE (2048)
+
 typedef struct {
     mp_obj_base_t base;
     struct _MP3DecInfo *decoder;
@@ -56,6 +59,10 @@ typedef struct {
     int8_t other_buffer_index;
 
     uint32_t samples_decoded;
+
+    // Read-ahead statistics for the current file.
+    uint32_t underruns;
+    uint32_t max_read_ms;
 } audiomp3_mp3file_obj_t;
 
 // These are not available from Python because it may be called in an interrupt.
@@ -35,6 +35,34 @@
 
 #define MAX_BAUDRATE (common_hal_mcu_get_clock_frequency() / 48)
 
+STATIC bool spi_get_reg(digitalio_digitalinout_obj_t *pin, digitalinout_reg_op_t op, bitbangio_spi_reg_t *reg) {
+    reg->reg = common_hal_digitalio_digitalinout_get_reg(pin, op, &reg->mask);
+    return reg->reg != NULL;
+}
+
+// Looks up the pins' registers once so each transfer doesn't need to.
+STATIC void spi_find_regs(bitbangio_spi_obj_t *self) {
+    self->has_regs = false;
+    if (!common_hal_digitalio_has_reg_op(DIGITALINOUT_REG_SET) ||
+        !common_hal_digitalio_has_reg_op(DIGITALINOUT_REG_RESET) ||
+        !common_hal_digitalio_has_reg_op(DIGITALINOUT_REG_READ)) {
+        return;
+    }
+    if (!spi_get_reg(&self->clock, DIGITALINOUT_REG_SET, &self->clock_set) ||
+        !spi_get_reg(&self->clock, DIGITALINOUT_REG_RESET, &self->clock_reset)) {
+        return;
+    }
+    if (self->has_mosi &&
+        (!spi_get_reg(&self->mosi, DIGITALINOUT_REG_SET, &self->mosi_set) ||
+         !spi_get_reg(&self->mosi, DIGITALINOUT_REG_RESET, &self->mosi_reset))) {
+        return;
+    }
+    if (self->has_miso && !spi_get_reg(&self->miso, DIGITALINOUT_REG_READ, &self->miso_read)) {
+        return;
+    }
+    self->has_regs = true;
+}
+
 void shared_module_bitbangio_spi_construct(bitbangio_spi_obj_t *self,
     const mcu_pin_obj_t *clock, const mcu_pin_obj_t *mosi,
     const mcu_pin_obj_t *miso) {
@@ -69,6 +97,7 @@ void shared_module_bitbangio_spi_construct(bitbangio_spi_obj_t *self,
     self->delay_half = 5;
     self->polarity = 0;
     self->phase = 0;
+    spi_find_regs(self);
 }
 
 bool shared_module_bitbangio_spi_deinited(bitbangio_spi_obj_t *self) {
@@ -90,10 +119,16 @@ void shared_module_bitbangio_spi_deinit(bitbangio_spi_obj_t *self) {
 
 void shared_module_bitbangio_spi_configure(bitbangio_spi_obj_t *self,
     uint32_t baudrate, uint8_t polarity, uint8_t phase, uint8_t bits) {
-    self->delay_half = 500000 / baudrate;
-    // round delay_half up so that: actual_baudrate <= requested_baudrate
-    if (500000 % baudrate != 0) {
-        self->delay_half += 1;
+    // Rates over what one microsecond delays allow run as fast as possible,
+    // limited only by CPU speed and GPIO time.
+    if (baudrate > 500000) {
+        self->delay_half = 0;
+    } else {
+        self->delay_half = 500000 / baudrate;
+        // round delay_half up so that: actual_baudrate <= requested_baudrate
+        if (500000 % baudrate != 0) {
+            self->delay_half += 1;
+        }
     }
 
     if (polarity != self->polarity) {
@@ -124,97 +159,117 @@ void shared_module_bitbangio_spi_unlock(bitbangio_spi_obj_t *self) {
     self->locked = false;
 }
 
-// Writes out the given data.
-bool shared_module_bitbangio_spi_write(bitbangio_spi_obj_t *self, const uint8_t *data, size_t len) {
-    if (len > 0 && !self->has_mosi) {
-        mp_raise_ValueError_varg(MP_ERROR_TEXT("No %q pin"), MP_QSTR_mosi);
-    }
-    uint32_t delay_half = self->delay_half;
+// Drives one pin through its registers.
+typedef struct {
+    volatile uint32_t *set_reg;
+    volatile uint32_t *reset_reg;
+    uint32_t set_mask;
+    uint32_t reset_mask;
+} spi_fast_pin_t;
 
-    // only MSB transfer is implemented
+// Everything the register loops need, with the clock edges already picked
+// for the polarity.
+typedef struct {
+    spi_fast_pin_t clock;
+    spi_fast_pin_t mosi;
+    volatile uint32_t *miso_reg;
+    uint32_t miso_mask;
+    bool has_mosi;
+} spi_fast_pins_t;
 
-    // If a port defines MICROPY_PY_MACHINE_SPI_MIN_DELAY, and the configured
-    // delay_half is equal to this value, then the software SPI implementation
-    // will run as fast as possible, limited only by CPU speed and GPIO time.
-    #ifdef MICROPY_PY_MACHINE_SPI_MIN_DELAY
-    if (delay_half <= MICROPY_PY_MACHINE_SPI_MIN_DELAY) {
-        for (size_t i = 0; i < len; ++i) {
-            uint8_t data_out = data[i];
-            for (int j = 0; j < 8; ++j, data_out <<= 1) {
-                common_hal_digitalio_digitalinout_set_value(&self->mosi, (data_out >> 7) & 1);
-                common_hal_digitalio_digitalinout_set_value(&self->clock, 1 - self->polarity);
-                common_hal_digitalio_digitalinout_set_value(&self->clock, self->polarity);
-            }
-            if (dest != NULL) {
-                dest[i] = data_in;
-            }
-        }
-        return true;
+MP_ALWAYSINLINE static inline void spi_fast_set(const spi_fast_pin_t *pin, bool value) {
+    if (value) {
+        *pin->set_reg = pin->set_mask;
+    } else {
+        *pin->reset_reg = pin->reset_mask;
     }
-    #endif
+}
 
-    for (size_t i = 0; i < len; ++i) {
-        uint8_t data_out = data[i];
-        for (int j = 0; j < 8; ++j, data_out <<= 1) {
-            common_hal_digitalio_digitalinout_set_value(&self->mosi, (data_out >> 7) & 1);
-            if (self->phase == 0) {
+// Shifts one byte out and in, MSB first. Inlined with a constant phase and
+// delay this becomes a straight run of register accesses.
+MP_ALWAYSINLINE static inline uint8_t spi_fast_byte(const spi_fast_pins_t *pins, uint8_t data_out,
+    bool phase, uint32_t delay_half) {
+    uint8_t data_in = 0;
+    #pragma GCC unroll 8
+    for (int j = 0; j < 8; ++j, data_out <<= 1) {
+        if (pins->has_mosi) {
+            spi_fast_set(&pins->mosi, data_out & 0x80);
+        }
+        if (phase == 0) {
+            if (delay_half) {
                 common_hal_mcu_delay_us(delay_half);
-                common_hal_digitalio_digitalinout_set_value(&self->clock, 1 - self->polarity);
+            }
+            // Active edge. The data doesn't change until the idle edge.
+            *pins->clock.set_reg = pins->clock.set_mask;
+            data_in = (data_in << 1) | ((*pins->miso_reg & pins->miso_mask) != 0);
+            if (delay_half) {
                 common_hal_mcu_delay_us(delay_half);
-                common_hal_digitalio_digitalinout_set_value(&self->clock, self->polarity);
-            } else {
-                common_hal_digitalio_digitalinout_set_value(&self->clock, 1 - self->polarity);
+            }
+            *pins->clock.reset_reg = pins->clock.reset_mask;
+        } else {
+            // Active edge. The peripheral changes its data here.
+            *pins->clock.set_reg = pins->clock.set_mask;
+            if (delay_half) {
                 common_hal_mcu_delay_us(delay_half);
-                common_hal_digitalio_digitalinout_set_value(&self->clock, self->polarity);
+            }
+            *pins->clock.reset_reg = pins->clock.reset_mask;
+            data_in = (data_in << 1) | ((*pins->miso_reg & pins->miso_mask) != 0);
+            if (delay_half) {
                 common_hal_mcu_delay_us(delay_half);
             }
         }
-
-        // Some ports need a regular callback, but probably we don't need
-        // to do this every byte, or even at all.
-        #ifdef MICROPY_EVENT_POLL_HOOK
-        MICROPY_EVENT_POLL_HOOK;
-        #endif
     }
-    return true;
+    return data_in;
 }
 
-// Reads in len bytes while outputting zeroes.
-bool shared_module_bitbangio_spi_read(bitbangio_spi_obj_t *self, uint8_t *data, size_t len, uint8_t write_data) {
-    if (len > 0 && !self->has_miso) {
-        mp_raise_ValueError_varg(MP_ERROR_TEXT("No %q pin"), MP_QSTR_miso);
-    }
+STATIC void spi_fast_transfer(bitbangio_spi_obj_t *self, const uint8_t *dout, uint8_t write_value,
+    uint8_t *din, size_t len) {
+    spi_fast_pins_t pins;
+    // clock.set_reg always moves the clock to its active level.
+    const bitbangio_spi_reg_t *active = self->polarity ? &self->clock_reset : &self->clock_set;
+    const bitbangio_spi_reg_t *idle = self->polarity ? &self->clock_set : &self->clock_reset;
+    pins.clock.set_reg = active->reg;
+    pins.clock.set_mask = active->mask;
+    pins.clock.reset_reg = idle->reg;
+    pins.clock.reset_mask = idle->mask;
+    pins.has_mosi = self->has_mosi;
+    pins.mosi.set_reg = self->mosi_set.reg;
+    pins.mosi.set_mask = self->mosi_set.mask;
+    pins.mosi.reset_reg = self->mosi_reset.reg;
+    pins.mosi.reset_mask = self->mosi_reset.mask;
+    // Without MISO, read the clock's own level instead and discard it.
+    pins.miso_reg = self->has_miso ? self->miso_read.reg : self->clock_set.reg;
+    pins.miso_mask = self->has_miso ? self->miso_read.mask : 0;
 
     uint32_t delay_half = self->delay_half;
-
-    // only MSB transfer is implemented
-
-    // If a port defines MICROPY_PY_MACHINE_SPI_MIN_DELAY, and the configured
-    // delay_half is equal to this value, then the software SPI implementation
-    // will run as fast as possible, limited only by CPU speed and GPIO time.
-    #ifdef MICROPY_PY_MACHINE_SPI_MIN_DELAY
-    if (delay_half <= MICROPY_PY_MACHINE_SPI_MIN_DELAY) {
-        // Clock out zeroes while we read.
-        if (self->has_mosi) {
-            common_hal_digitalio_digitalinout_set_value(&self->mosi, false);
+    for (size_t i = 0; i < len; ++i) {
+        uint8_t data_out = dout != NULL ? dout[i] : write_value;
+        uint8_t data_in;
+        if (delay_half != 0) {
+            data_in = spi_fast_byte(&pins, data_out, self->phase, delay_half);
+        } else if (self->phase == 0) {
+            data_in = spi_fast_byte(&pins, data_out, 0, 0);
+        } else {
+            data_in = spi_fast_byte(&pins, data_out, 1, 0);
         }
-        for (size_t i = 0; i < len; ++i) {
-            uint8_t data_in = 0;
-            for (int j = 0; j < 8; ++j, data_out <<= 1) {
-                common_hal_digitalio_digitalinout_set_value(&self->clock, 1 - self->polarity);
-                data_in = (data_in << 1) | common_hal_digitalio_digitalinout_get_value(&self->miso);
-                common_hal_digitalio_digitalinout_set_value(&self->clock, self->polarity);
-            }
-            data[i] = data_in;
+        if (din != NULL) {
+            din[i] = data_in;
         }
-        return true;
     }
-    #endif
-    if (self->has_mosi) {
-        common_hal_digitalio_digitalinout_set_value(&self->mosi, false);
+}
+
+// Shifts out dout, or write_value for every byte when it is NULL, while
+// shifting into din when it isn't NULL. Only MSB first is implemented.
+STATIC void spi_transfer(bitbangio_spi_obj_t *self, const uint8_t *dout, uint8_t write_value,
+    uint8_t *din, size_t len) {
+    if (self->has_regs) {
+        spi_fast_transfer(self, dout, write_value, din, len);
+        return;
     }
+
+    uint32_t delay_half = self->delay_half;
     for (size_t i = 0; i < len; ++i) {
-        uint8_t data_out = write_data;
+        uint8_t data_out = dout != NULL ? dout[i] : write_value;
         uint8_t data_in = 0;
         for (int j = 0; j < 8; ++j, data_out <<= 1) {
             if (self->has_mosi) {
@@ -227,7 +282,9 @@ bool shared_module_bitbangio_spi_read(bitbangio_spi_obj_t *self, uint8_t *data,
                 common_hal_digitalio_digitalinout_set_value(&self->clock, 1 - self->polarity);
                 common_hal_mcu_delay_us(delay_half);
             }
-            data_in = (data_in << 1) | common_hal_digitalio_digitalinout_get_value(&self->miso);
+            if (din != NULL) {
+                data_in = (data_in << 1) | common_hal_digitalio_digitalinout_get_value(&self->miso);
+            }
             if (self->phase == 0) {
                 common_hal_mcu_delay_us(delay_half);
                 common_hal_digitalio_digitalinout_set_value(&self->clock, self->polarity);
@@ -236,7 +293,9 @@ bool shared_module_bitbangio_spi_read(bitbangio_spi_obj_t *self, uint8_t *data,
                 common_hal_mcu_delay_us(delay_half);
             }
         }
-        data[i] = data_in;
+        if (din != NULL) {
+            din[i] = data_in;
+        }
 
         // Some ports need a regular callback, but probably we don't need
         // to do this every byte, or even at all.
@@ -244,6 +303,26 @@ bool shared_module_bitbangio_spi_read(bitbangio_spi_obj_t *self, uint8_t *data,
         MICROPY_EVENT_POLL_HOOK;
         #endif
     }
+}
+
+// Writes out the given data.
+bool shared_module_bitbangio_spi_write(bitbangio_spi_obj_t *self, const uint8_t *data, size_t len) {
+    if (len > 0 && !self->has_mosi) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("No %q pin"), MP_QSTR_mosi);
+    }
+    spi_transfer(self, data, 0, NULL, len);
+    return true;
+}
+
+// Reads in len bytes while outputting write_data.
+bool shared_module_bitbangio_spi_read(bitbangio_spi_obj_t *self, uint8_t *data, size_t len, uint8_t write_data) {
+    if (len > 0 && !self->has_miso) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("No %q pin"), MP_QSTR_miso);
+    }
+    if (self->has_mosi) {
+        common_hal_digitalio_digitalinout_set_value(&self->mosi, false);
+    }
+    spi_transfer(self, NULL, write_data, data, len);
     return true;
 }
 
@@ -255,62 +334,6 @@ bool shared_module_bitbangio_spi_transfer(bitbangio_spi_obj_t *self, const uint8
     if (!self->has_miso && din != NULL) {
         mp_raise_ValueError_varg(MP_ERROR_TEXT("No %q pin"), MP_QSTR_miso);
     }
-    uint32_t delay_half = self->delay_half;
-
-    // only MSB transfer is implemented
-
-    // If a port defines MICROPY_PY_MACHINE_SPI_MIN_DELAY, and the configured
-    // delay_half is equal to this value, then the software SPI implementation
-    // will run as fast as possible, limited only by CPU speed and GPIO time.
-    #ifdef MICROPY_PY_MACHINE_SPI_MIN_DELAY
-    if (delay_half <= MICROPY_PY_MACHINE_SPI_MIN_DELAY) {
-        for (size_t i = 0; i < len; ++i) {
-            uint8_t data_out = dout[i];
-            uint8_t data_in = 0;
-            for (int j = 0; j < 8; ++j, data_out <<= 1) {
-                common_hal_digitalio_digitalinout_set_value(&self->mosi, (data_out >> 7) & 1);
-                common_hal_digitalio_digitalinout_set_value(&self->clock, 1 - self->polarity);
-                data_in = (data_in << 1) | common_hal_digitalio_digitalinout_get_value(&self->miso);
-                common_hal_digitalio_digitalinout_set_value(&self->clock, self->polarity);
-            }
-            din[i] = data_in;
-
-            if (dest != NULL) {
-                dest[i] = data_in;
-            }
-        }
-        return true;
-    }
-    #endif
-
-    for (size_t i = 0; i < len; ++i) {
-        uint8_t data_out = dout[i];
-        uint8_t data_in = 0;
-        for (int j = 0; j < 8; ++j, data_out <<= 1) {
-            common_hal_digitalio_digitalinout_set_value(&self->mosi, (data_out >> 7) & 1);
-            if (self->phase == 0) {
-                common_hal_mcu_delay_us(delay_half);
-                common_hal_digitalio_digitalinout_set_value(&self->clock, 1 - self->polarity);
-            } else {
-                common_hal_digitalio_digitalinout_set_value(&self->clock, 1 - self->polarity);
-                common_hal_mcu_delay_us(delay_half);
-            }
-            data_in = (data_in << 1) | common_hal_digitalio_digitalinout_get_value(&self->miso);
-            if (self->phase == 0) {
-                common_hal_mcu_delay_us(delay_half);
-                common_hal_digitalio_digitalinout_set_value(&self->clock, self->polarity);
-            } else {
-                common_hal_digitalio_digitalinout_set_value(&self->clock, self->polarity);
-                common_hal_mcu_delay_us(delay_half);
-            }
-        }
-        din[i] = data_in;
-
-        // Some ports need a regular callback, but probably we don't need
-        // to do this every byte, or even at all.
-        #ifdef MICROPY_EVENT_POLL_HOOK
-        MICROPY_EVENT_POLL_HOOK;
-        #endif
-    }
+    spi_transfer(self, dout, 0, din, len);
     return true;
 }
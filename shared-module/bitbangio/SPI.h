@@ -31,14 +31,28 @@
 
 #include "py/obj.h"
 
+// A port register and the bits of it that belong to one pin.
+typedef struct {
+    volatile uint32_t *reg;
+    uint32_t mask;
+} bitbangio_spi_reg_t;
+
 typedef struct {
     mp_obj_base_t base;
     digitalio_digitalinout_obj_t clock;
     digitalio_digitalinout_obj_t mosi;
     digitalio_digitalinout_obj_t miso;
-    uint32_t delay_half;
+    // Registers for the pins when the port provides all of them. The
+    // transfer loops then skip common-hal for each edge.
+    bitbangio_spi_reg_t clock_set;
+    bitbangio_spi_reg_t clock_reset;
+    bitbangio_spi_reg_t mosi_set;
+    bitbangio_spi_reg_t mosi_reset;
+    bitbangio_spi_reg_t miso_read;
+    uint32_t delay_half; // 0 runs as fast as the pins can be toggled.
     bool has_miso : 1;
     bool has_mosi : 1;
+    bool has_regs : 1;
     uint8_t polarity : 1;
     uint8_t phase : 1;
     volatile bool locked : 1;
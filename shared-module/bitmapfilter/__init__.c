@@ -8,6 +8,8 @@
  */
 
 #include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
 #include "py/runtime.h"
@@ -89,6 +91,232 @@ uint16_t imlib_yuv_to_rgb(uint8_t y, int8_t u, int8_t v) {
     return COLOR_R8_G8_B8_TO_RGB565(r, g, b);
 }
 
+static void scratch_bitmap8(displayio_bitmap_t *buf, int rows, int cols) {
+    int stride = (cols + 3) / 4;
+    size_t sz = rows * stride * sizeof(uint32_t);
+    void *data = scratchpad_alloc(sz);
+    buf->width = cols;
+    buf->height = rows;
+    buf->stride = stride;
+    buf->data = data;
+}
+
+static int morph_gcd(int a, int b) {
+    while (b) {
+        int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+// Returns true if the n x n kernel is the outer product of the integer vectors
+// col and row, so it can be applied as a horizontal pass followed by a vertical
+// one with exactly the same result.
+static bool morph_separate(int n, const int *krn, int *col, int *row) {
+    int pivot = 0;
+    while (pivot < n * n && krn[pivot] == 0) {
+        pivot++;
+    }
+    if (pivot == n * n) {
+        return false;
+    }
+    const int *pivot_row = &krn[pivot / n * n];
+    int g = 0;
+    for (int k = 0; k < n; k++) {
+        g = morph_gcd(g, abs(pivot_row[k]));
+    }
+    for (int k = 0; k < n; k++) {
+        row[k] = pivot_row[k] / g;
+    }
+    int r = row[pivot % n];
+    for (int j = 0; j < n; j++) {
+        int v = krn[j * n + pivot % n];
+        if (v % r) {
+            return false;
+        }
+        col[j] = v / r;
+        for (int k = 0; k < n; k++) {
+            if (krn[j * n + k] != col[j] * row[k]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool morph_all_equal(int n, const int *v) {
+    for (int i = 1; i < n; i++) {
+        if (v[i] != v[0]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Unpacks source row y into one plane per channel, each width + 2 * ksize long
+// and padded by repeating the edge pixels.
+static void morph_unpack_row(displayio_bitmap_t *bitmap, int y, int ksize, int32_t *planes) {
+    int width = bitmap->width;
+    int pw = width + 2 * ksize;
+    if (bitmap->bits_per_value == 16) {
+        uint16_t *row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
+        int32_t *r = planes, *g = planes + pw, *b = planes + 2 * pw;
+        for (int i = 0; i < pw; i++) {
+            int pixel = IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, IM_MIN(IM_MAX(i - ksize, 0), width - 1));
+            r[i] = COLOR_RGB565_TO_R5(pixel);
+            g[i] = COLOR_RGB565_TO_G6(pixel);
+            b[i] = COLOR_RGB565_TO_B5(pixel);
+        }
+    } else {
+        uint8_t *row_ptr = IMAGE_COMPUTE_GRAYSCALE_PIXEL_ROW_PTR(bitmap, y);
+        for (int i = 0; i < pw; i++) {
+            planes[i] = IMAGE_GET_GRAYSCALE_PIXEL_FAST(row_ptr, IM_MIN(IM_MAX(i - ksize, 0), width - 1));
+        }
+    }
+}
+
+// Applies the horizontal kernel to one padded plane. A box kernel keeps a
+// running sum, so its cost doesn't depend on the kernel size.
+static void morph_filter_row(const int32_t *src, int32_t *dst, int width, int n, const int *row, bool box) {
+    if (box) {
+        int32_t sum = 0;
+        for (int i = 0; i < n; i++) {
+            sum += src[i];
+        }
+        for (int x = 0; x < width - 1; x++) {
+            dst[x] = sum * row[0];
+            sum += src[x + n] - src[x];
+        }
+        dst[width - 1] = sum * row[0];
+        return;
+    }
+    memset(dst, 0, width * sizeof(int32_t));
+    for (int i = 0; i < n; i++) {
+        const int32_t w = row[i];
+        const int32_t *s = src + i;
+        for (int x = 0; x < width; x++) {
+            dst[x] += w * s[x];
+        }
+    }
+}
+
+static void morph_separable(
+    displayio_bitmap_t *bitmap,
+    displayio_bitmap_t *mask,
+    const int ksize,
+    const int *col,
+    const int *row,
+    const int32_t m_int,
+    const int32_t b_int,
+    bool threshold,
+    int offset,
+    bool invert) {
+
+    const int n = 2 * ksize + 1;
+    const int width = bitmap->width, height = bitmap->height;
+    const int channels = bitmap->bits_per_value == 16 ? 3 : 1;
+    const int pw = width + 2 * ksize;
+    const int rw = channels * width;
+    // Horizontally filtered rows, enough for the vertical window and the row
+    // that a box kernel's running sum drops.
+    const int ring_rows = n + 1;
+    const bool box = morph_all_equal(n, row) && morph_all_equal(n, col);
+
+    int32_t *planes = scratchpad_alloc((channels * pw + (ring_rows + 1) * rw) * sizeof(int32_t));
+    int32_t *ring = planes + channels * pw;
+    int32_t *acc = ring + ring_rows * rw;
+
+    int next = 0; // next source row to filter horizontally
+    for (int y = 0; y < height; y++) {
+        for (int last = IM_MIN(y + ksize, height - 1); next <= last; next++) {
+            morph_unpack_row(bitmap, next, ksize, planes);
+            int32_t *dst = ring + (next % ring_rows) * rw;
+            for (int c = 0; c < channels; c++) {
+                morph_filter_row(planes + c * pw, dst + c * width, width, n, row, box);
+            }
+        }
+
+        if (box) {
+            // acc holds the plain sum of the vertical window.
+            if (y == 0) {
+                memset(acc, 0, rw * sizeof(int32_t));
+                for (int j = -ksize; j <= ksize; j++) {
+                    const int32_t *h = ring + (IM_MIN(IM_MAX(j, 0), height - 1) % ring_rows) * rw;
+                    for (int x = 0; x < rw; x++) {
+                        acc[x] += h[x];
+                    }
+                }
+            } else {
+                const int32_t *h_in = ring + (IM_MIN(y + ksize, height - 1) % ring_rows) * rw;
+                const int32_t *h_out = ring + (IM_MAX(y - 1 - ksize, 0) % ring_rows) * rw;
+                for (int x = 0; x < rw; x++) {
+                    acc[x] += h_in[x] - h_out[x];
+                }
+            }
+        } else {
+            memset(acc, 0, rw * sizeof(int32_t));
+            for (int j = -ksize; j <= ksize; j++) {
+                const int32_t w = col[j + ksize];
+                const int32_t *h = ring + (IM_MIN(IM_MAX(y + j, 0), height - 1) % ring_rows) * rw;
+                for (int x = 0; x < rw; x++) {
+                    acc[x] += w * h[x];
+                }
+            }
+        }
+        const int32_t scale = box ? col[0] : 1;
+
+        // Row y has been filtered horizontally and isn't needed again, so the
+        // result goes straight back into the bitmap.
+        if (channels == 3) {
+            uint16_t *row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
+            const int32_t *r = acc, *g = acc + width, *b = acc + 2 * width;
+            for (int x = 0; x < width; x++) {
+                if (mask && common_hal_displayio_bitmap_get_pixel(mask, x, y)) {
+                    continue;
+                }
+                int32_t r_acc = (r[x] * scale * m_int + b_int) >> 16;
+                r_acc = IM_MIN(IM_MAX(r_acc, 0), COLOR_R5_MAX);
+                int32_t g_acc = (g[x] * scale * m_int + b_int * 2) >> 16;
+                g_acc = IM_MIN(IM_MAX(g_acc, 0), COLOR_G6_MAX);
+                int32_t b_acc = (b[x] * scale * m_int + b_int) >> 16;
+                b_acc = IM_MIN(IM_MAX(b_acc, 0), COLOR_B5_MAX);
+
+                int pixel = COLOR_R5_G6_B5_TO_RGB565(r_acc, g_acc, b_acc);
+
+                if (threshold) {
+                    if (((COLOR_RGB565_TO_Y(pixel) - offset) < COLOR_RGB565_TO_Y(IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x))) ^ invert) {
+                        pixel = COLOR_RGB565_BINARY_MAX;
+                    } else {
+                        pixel = COLOR_RGB565_BINARY_MIN;
+                    }
+                }
+
+                IMAGE_PUT_RGB565_PIXEL_FAST(row_ptr, x, pixel);
+            }
+        } else {
+            uint8_t *row_ptr = IMAGE_COMPUTE_GRAYSCALE_PIXEL_ROW_PTR(bitmap, y);
+            for (int x = 0; x < width; x++) {
+                if (mask && common_hal_displayio_bitmap_get_pixel(mask, x, y)) {
+                    continue;
+                }
+                int32_t y_acc = (acc[x] * scale * m_int + b_int) >> 16;
+                int pixel = IM_MIN(IM_MAX(y_acc, COLOR_GRAYSCALE_MIN), COLOR_GRAYSCALE_MAX);
+
+                if (threshold) {
+                    if (((pixel - offset) < IMAGE_GET_GRAYSCALE_PIXEL_FAST(row_ptr, x)) ^ invert) {
+                        pixel = COLOR_GRAYSCALE_BINARY_MAX;
+                    } else {
+                        pixel = COLOR_GRAYSCALE_BINARY_MIN;
+                    }
+                }
+
+                IMAGE_PUT_GRAYSCALE_PIXEL_FAST(row_ptr, x, pixel);
+            }
+        }
+    }
+}
+
 void shared_module_bitmapfilter_morph(
     displayio_bitmap_t *bitmap,
     displayio_bitmap_t *mask,
@@ -102,12 +330,21 @@ void shared_module_bitmapfilter_morph(
 
     int brows = ksize + 1;
 
+    if (bitmap->bits_per_value != 16 && bitmap->bits_per_value != 8) {
+        mp_raise_ValueError(MP_ERROR_TEXT("unsupported bitmap depth"));
+    }
+
     const int32_t m_int = (int32_t)MICROPY_FLOAT_C_FUN(round)(65536 * m);
-    const int32_t b_int = (int32_t)MICROPY_FLOAT_C_FUN(round)(65536 * COLOR_G6_MAX * b);
+    const int32_t b_int = (int32_t)MICROPY_FLOAT_C_FUN(round)(65536 * (bitmap->bits_per_value == 8 ? COLOR_GRAYSCALE_MAX : COLOR_G6_MAX) * b);
+
+    int n = 2 * ksize + 1;
+    int col[n], row[n];
+    if (morph_separate(n, krn, col, row)) {
+        morph_separable(bitmap, mask, ksize, col, row, m_int, b_int, threshold, offset, invert);
+        return;
+    }
 
     switch (bitmap->bits_per_value) {
-        default:
-            mp_raise_ValueError(MP_ERROR_TEXT("unsupported bitmap depth"));
         case 16: {
             displayio_bitmap_t buf;
             scratch_bitmap16(&buf, brows, bitmap->width);
@@ -193,6 +430,59 @@ void shared_module_bitmapfilter_morph(
                     IMAGE_RGB565_LINE_LEN_BYTES(bitmap));
             }
 
+            break;
+        }
+        case 8: {
+            displayio_bitmap_t buf;
+            scratch_bitmap8(&buf, brows, bitmap->width);
+
+            for (int y = 0, yy = bitmap->height; y < yy; y++) {
+                uint8_t *row_ptr = IMAGE_COMPUTE_GRAYSCALE_PIXEL_ROW_PTR(bitmap, y);
+                uint8_t *buf_row_ptr = IMAGE_COMPUTE_GRAYSCALE_PIXEL_ROW_PTR(&buf, (y % brows));
+
+                for (int x = 0, xx = bitmap->width; x < xx; x++) {
+                    if (mask && common_hal_displayio_bitmap_get_pixel(mask, x, y)) {
+                        IMAGE_PUT_GRAYSCALE_PIXEL_FAST(buf_row_ptr, x, IMAGE_GET_GRAYSCALE_PIXEL_FAST(row_ptr, x));
+                        continue; // Short circuit.
+                    }
+                    int32_t acc = 0, ptr = 0;
+
+                    for (int j = -ksize; j <= ksize; j++) {
+                        uint8_t *k_row_ptr = IMAGE_COMPUTE_GRAYSCALE_PIXEL_ROW_PTR(bitmap,
+                            IM_MIN(IM_MAX(y + j, 0), (bitmap->height - 1)));
+                        for (int k = -ksize; k <= ksize; k++) {
+                            acc += krn[ptr++] * IMAGE_GET_GRAYSCALE_PIXEL_FAST(k_row_ptr,
+                                IM_MIN(IM_MAX(x + k, 0), (bitmap->width - 1)));
+                        }
+                    }
+                    acc = (acc * m_int + b_int) >> 16;
+                    int pixel = IM_MIN(IM_MAX(acc, COLOR_GRAYSCALE_MIN), COLOR_GRAYSCALE_MAX);
+
+                    if (threshold) {
+                        if (((pixel - offset) < IMAGE_GET_GRAYSCALE_PIXEL_FAST(row_ptr, x)) ^ invert) {
+                            pixel = COLOR_GRAYSCALE_BINARY_MAX;
+                        } else {
+                            pixel = COLOR_GRAYSCALE_BINARY_MIN;
+                        }
+                    }
+
+                    IMAGE_PUT_GRAYSCALE_PIXEL_FAST(buf_row_ptr, x, pixel);
+                }
+
+                if (y >= ksize) {     // Transfer buffer lines...
+                    memcpy(IMAGE_COMPUTE_GRAYSCALE_PIXEL_ROW_PTR(bitmap, (y - ksize)),
+                        IMAGE_COMPUTE_GRAYSCALE_PIXEL_ROW_PTR(&buf, ((y - ksize) % brows)),
+                        bitmap->width);
+                }
+            }
+
+            // Copy any remaining lines from the buffer image...
+            for (int y = IM_MAX(bitmap->height - ksize, 0), yy = bitmap->height; y < yy; y++) {
+                memcpy(IMAGE_COMPUTE_GRAYSCALE_PIXEL_ROW_PTR(bitmap, y),
+                    IMAGE_COMPUTE_GRAYSCALE_PIXEL_ROW_PTR(&buf, (y % brows)),
+                    bitmap->width);
+            }
+
             break;
         }
     }
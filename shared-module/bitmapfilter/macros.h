@@ -27,6 +27,12 @@
     __builtin_bswap16((rowptr)[(x)])
 #define IMAGE_PUT_RGB565_PIXEL_FAST(rowptr, x, val) \
     ((rowptr)[(x)] = __builtin_bswap16((val)))
+#define IMAGE_COMPUTE_GRAYSCALE_PIXEL_ROW_PTR(bitmap, y) \
+    (uint8_t *)(&(bitmap)->data[(bitmap)->stride * (y)])
+#define IMAGE_GET_GRAYSCALE_PIXEL_FAST(rowptr, x) \
+    ((rowptr)[(x)])
+#define IMAGE_PUT_GRAYSCALE_PIXEL_FAST(rowptr, x, val) \
+    ((rowptr)[(x)] = (val))
 #define COLOR_R5_G6_B5_TO_RGB565(r, g, b) \
     (((r) << 11) | ((g) << 5) | (b))
 #define COLOR_R8_G8_B8_TO_RGB565(r8, g8, b8)    ((((r8) & 0xF8) << 8) | (((g8) & 0xFC) << 3) | ((b8) >> 3))
@@ -66,6 +72,10 @@
 
 #define COLOR_RGB565_BINARY_MAX (0xffff)
 #define COLOR_RGB565_BINARY_MIN (0x0000)
+#define COLOR_GRAYSCALE_MIN (0)
+#define COLOR_GRAYSCALE_MAX (255)
+#define COLOR_GRAYSCALE_BINARY_MAX (0xff)
+#define COLOR_GRAYSCALE_BINARY_MIN (0x00)
 
 #define COLOR_RGB888_TO_Y(r8, g8, b8) ((((r8) * 38) + ((g8) * 75) + ((b8) * 15)) >> 7) // 0.299R + 0.587G + 0.114B
 #define COLOR_RGB565_TO_Y(rgb565) \
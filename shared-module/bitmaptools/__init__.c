@@ -43,6 +43,35 @@
 #define BITMAP_DEBUG(...) (void)0
 // #define BITMAP_DEBUG(...) mp_printf(&mp_plat_print, __VA_ARGS__)
 
+// Narrows [*minx, *maxx] to the destination columns where start + x * step falls in
+// [clip0, clip1). The range is widened by a pixel so rounding never loses an edge pixel;
+// callers still check each pixel. Returns false if no columns are left.
+STATIC bool rotozoom_clip_row(mp_float_t start, mp_float_t step, int16_t clip0, int16_t clip1, int16_t *minx, int16_t *maxx) {
+    if (step == 0) {
+        return start >= clip0 && start < clip1;
+    }
+    mp_float_t first = (clip0 - start) / step;
+    mp_float_t last = (clip1 - start) / step;
+    if (step < 0) {
+        mp_float_t swap = first;
+        first = last;
+        last = swap;
+    }
+    if (first > *minx) {
+        if (first > *maxx) {
+            return false;
+        }
+        *minx = (int16_t)first;
+    }
+    if (last < *maxx) {
+        if (last < *minx) {
+            return false;
+        }
+        *maxx = (int16_t)last + 1;
+    }
+    return *minx <= *maxx;
+}
+
 void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16_t oy,
     int16_t dest_clip0_x, int16_t dest_clip0_y,
     int16_t dest_clip1_x, int16_t dest_clip1_y,
@@ -206,21 +235,137 @@ void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16
     displayio_area_t dirty_area = {minx, miny, maxx + 1, maxy + 1, NULL};
     displayio_bitmap_set_dirty_area(self, &dirty_area);
 
-    for (y = miny; y <= maxy; y++) {
-        mp_float_t u = rowu + minx * duRow;
-        mp_float_t v = rowv + minx * dvRow;
-        for (x = minx; x <= maxx; x++) {
-            if (u >= source_clip0_x && u < source_clip1_x && v >= source_clip0_y && v < source_clip1_y) {
-                uint32_t c = common_hal_displayio_bitmap_get_pixel(source, (int)u, (int)v);
-                if ((skip_index_none) || (c != skip_index)) {
-                    displayio_bitmap_write_pixel(self, x, y, c);
+    // Step through the source in 16.16 fixed point along each row. The start of every row
+    // comes from the float values so rounding doesn't build up from row to row. The start is
+    // nudged forward by 1/256 of a pixel so that the stepping error along a row can't drop a
+    // coordinate that lands exactly on a pixel edge into the pixel before it.
+    const int32_t du = (int32_t)MICROPY_FLOAT_C_FUN(floor)(duRow * 65536 + MICROPY_FLOAT_CONST(0.5));
+    const int32_t dv = (int32_t)MICROPY_FLOAT_C_FUN(floor)(dvRow * 65536 + MICROPY_FLOAT_CONST(0.5));
+    const int32_t bias = 256;
+    const int32_t clip0_u = source_clip0_x * 65536;
+    const int32_t clip1_u = source_clip1_x * 65536;
+    const int32_t clip0_v = source_clip0_y * 65536;
+    const int32_t clip1_v = source_clip1_y * 65536;
+
+    // Same depth 8 and 16 bit bitmaps are read and written in place.
+    uint8_t direct_bits = 0;
+    if (source->bits_per_value == self->bits_per_value &&
+        (self->bits_per_value == 8 || self->bits_per_value == 16)) {
+        direct_bits = self->bits_per_value;
+    }
+
+    for (y = miny; y <= maxy; y++, rowu += duCol, rowv += dvCol) {
+        int16_t row_minx = minx;
+        int16_t row_maxx = maxx;
+        if (!rotozoom_clip_row(rowu + bias / MICROPY_FLOAT_CONST(65536.0), duRow, source_clip0_x, source_clip1_x, &row_minx, &row_maxx) ||
+            !rotozoom_clip_row(rowv + bias / MICROPY_FLOAT_CONST(65536.0), dvRow, source_clip0_y, source_clip1_y, &row_minx, &row_maxx)) {
+            continue;
+        }
+        int32_t u = (int32_t)MICROPY_FLOAT_C_FUN(floor)((rowu + row_minx * duRow) * 65536) + bias;
+        int32_t v = (int32_t)MICROPY_FLOAT_C_FUN(floor)((rowv + row_minx * dvRow) * 65536) + bias;
+
+        if (direct_bits == 8) {
+            uint8_t *dest_row = (uint8_t *)(self->data + y * self->stride);
+            for (x = row_minx; x <= row_maxx; x++, u += du, v += dv) {
+                if (u >= clip0_u && u < clip1_u && v >= clip0_v && v < clip1_v) {
+                    uint8_t c = ((uint8_t *)(source->data + (v >> 16) * source->stride))[u >> 16];
+                    if ((skip_index_none) || (c != skip_index)) {
+                        dest_row[x] = c;
+                    }
+                }
+            }
+        } else if (direct_bits == 16) {
+            uint16_t *dest_row = (uint16_t *)(self->data + y * self->stride);
+            for (x = row_minx; x <= row_maxx; x++, u += du, v += dv) {
+                if (u >= clip0_u && u < clip1_u && v >= clip0_v && v < clip1_v) {
+                    uint16_t c = ((uint16_t *)(source->data + (v >> 16) * source->stride))[u >> 16];
+                    if ((skip_index_none) || (c != skip_index)) {
+                        dest_row[x] = c;
+                    }
+                }
+            }
+        } else {
+            for (x = row_minx; x <= row_maxx; x++, u += du, v += dv) {
+                if (u >= clip0_u && u < clip1_u && v >= clip0_v && v < clip1_v) {
+                    uint32_t c = common_hal_displayio_bitmap_get_pixel(source, u >> 16, v >> 16);
+                    if ((skip_index_none) || (c != skip_index)) {
+                        displayio_bitmap_write_pixel(self, x, y, c);
+                    }
                 }
             }
-            u += duRow;
-            v += dvRow;
         }
-        rowu += duCol;
-        rowv += dvCol;
+    }
+}
+
+// Sub-byte bitmaps pack pixels into uint32_t words starting at the most significant bit.
+// Returns the `count` (1-32) bits starting at bit `bit` of `row`, left aligned.
+static inline uint32_t read_row_bits(const uint32_t *row, uint32_t bit, uint8_t count) {
+    uint32_t index = bit / 32;
+    uint8_t offset = bit % 32;
+    uint32_t bits = row[index] << offset;
+    if (offset != 0 && offset + count > 32) {
+        bits |= row[index + 1] >> (32 - offset);
+    }
+    return bits;
+}
+
+// Replaces `count` (1-32) bits starting at bit `bit` of `row` with the top bits of `bits`.
+// The bits must not straddle a word.
+static inline void write_row_bits(uint32_t *row, uint32_t bit, uint8_t count, uint32_t bits) {
+    uint8_t offset = bit % 32;
+    uint32_t mask = (count == 32 ? 0xffffffff : ~(0xffffffff >> count)) >> offset;
+    row[bit / 32] = (row[bit / 32] & ~mask) | ((bits >> offset) & mask);
+}
+
+// Copies `bit_count` bits between packed rows one destination word at a time. Rows may
+// overlap; the copy runs backwards when the destination is after the source.
+static void copy_row_bits(uint32_t *dest, uint32_t dest_bit, const uint32_t *src, uint32_t src_bit, uint32_t bit_count) {
+    bool backwards = dest == src && dest_bit > src_bit;
+    uint32_t done = 0;
+    while (done < bit_count) {
+        uint32_t chunk_start;
+        uint8_t count;
+        if (backwards) {
+            uint32_t end = dest_bit + bit_count - done;
+            uint32_t word_start = (end - 1) & ~31u;
+            chunk_start = MAX(word_start, dest_bit);
+            count = end - chunk_start;
+        } else {
+            chunk_start = dest_bit + done;
+            count = MIN(32 - chunk_start % 32, bit_count - done);
+        }
+        uint32_t bits = read_row_bits(src, src_bit + (chunk_start - dest_bit), count);
+        write_row_bits(dest, chunk_start, count, bits);
+        done += count;
+    }
+}
+
+// Fills `count` pixels of a packed row starting at pixel x with the repeated `word`.
+static void fill_packed_row(displayio_bitmap_t *bitmap, uint32_t *row, int16_t x, int16_t count, uint32_t value, uint32_t word) {
+    switch (bitmap->bits_per_value) {
+        case 8:
+            memset((uint8_t *)row + x, value, count);
+            break;
+        case 16:
+            for (uint16_t *p = (uint16_t *)row + x, *end = p + count; p < end; p++) {
+                *p = value;
+            }
+            break;
+        case 32:
+            for (uint32_t *p = row + x, *end = p + count; p < end; p++) {
+                *p = value;
+            }
+            break;
+        default: {
+            uint32_t bit = x * bitmap->bits_per_value;
+            uint32_t end = bit + count * bitmap->bits_per_value;
+            while (bit < end) {
+                uint8_t chunk = MIN(32 - bit % 32, end - bit);
+                write_row_bits(row, bit, chunk, word);
+                bit += chunk;
+            }
+            break;
+        }
     }
 }
 
@@ -241,12 +386,21 @@ void common_hal_bitmaptools_fill_region(displayio_bitmap_t *destination,
     // update the dirty rectangle
     displayio_bitmap_set_dirty_area(destination, &area);
 
-    int16_t x, y;
-    for (x = area.x1; x < area.x2; x++) {
-        for (y = area.y1; y < area.y2; y++) {
-            displayio_bitmap_write_pixel(destination, x, y, value);
+    if (area.x1 >= area.x2) {
+        return;
+    }
+
+    // build the packed word for sub-byte depths
+    uint32_t word = 0;
+    if (destination->bits_per_value < 8) {
+        for (uint8_t i = 0; i < 32 / destination->bits_per_value; i++) {
+            word |= (value & destination->bitmask) << (32 - ((i + 1) * destination->bits_per_value));
         }
     }
+
+    for (int16_t y = area.y1; y < area.y2; y++) {
+        fill_packed_row(destination, destination->data + y * destination->stride, area.x1, area.x2 - area.x1, value, word);
+    }
 }
 
 void common_hal_bitmaptools_boundary_fill(displayio_bitmap_t *destination,
@@ -1090,6 +1244,35 @@ void common_hal_bitmaptools_blit(displayio_bitmap_t *destination, displayio_bitm
         y_reverse = true;
     }
 
+    if (skip_source_index_none && skip_dest_index_none &&
+        source->bits_per_value == destination->bits_per_value) {
+        // Nothing is skipped so copy whole rows of packed data at once.
+        int16_t left_clip = MAX(0, -x);
+        int16_t top_clip = MAX(0, -y);
+        int16_t width = MIN(x2 - x1, destination->width - x) - left_clip;
+        int16_t height = MIN(y2 - y1, destination->height - y) - top_clip;
+        if (width <= 0 || height <= 0) {
+            return;
+        }
+        uint8_t bits_per_value = destination->bits_per_value;
+        for (int16_t j = 0; j < height; j++) {
+            // Same rule as below: go bottom up when moving data down within a bitmap.
+            int16_t row = y_reverse ? height - j - 1 : j;
+            const uint32_t *src_row = source->data + (y1 + top_clip + row) * source->stride;
+            uint32_t *dest_row = destination->data + (y + top_clip + row) * destination->stride;
+            if (bits_per_value >= 8) {
+                uint8_t bytes_per_value = bits_per_value / 8;
+                memmove((uint8_t *)dest_row + (x + left_clip) * bytes_per_value,
+                    (const uint8_t *)src_row + (x1 + left_clip) * bytes_per_value,
+                    width * bytes_per_value);
+            } else {
+                copy_row_bits(dest_row, (x + left_clip) * bits_per_value,
+                    src_row, (x1 + left_clip) * bits_per_value, width * bits_per_value);
+            }
+        }
+        return;
+    }
+
     // simplest version - use internal functions for get/set pixels
     for (int16_t i = 0; i < (x2 - x1); i++) {
 
@@ -40,6 +40,7 @@
 #include "shared-bindings/time/__init__.h"
 #include "shared-module/displayio/__init__.h"
 #include "shared-module/displayio/display_core.h"
+#include "shared-module/displayio/mipi_constants.h"
 #include "supervisor/shared/display.h"
 #include "supervisor/shared/tick.h"
 #include "supervisor/usb.h"
@@ -76,10 +77,15 @@ void common_hal_busdisplay_busdisplay_construct(busdisplay_busdisplay_obj_t *sel
     self->write_ram_command = write_ram_command;
     self->brightness_command = brightness_command;
     self->first_manual_refresh = !auto_refresh;
+    self->deferred_area = (displayio_area_t) { 0 };
+    self->refresh_deadline = 0;
     self->backlight_on_high = backlight_on_high;
 
     self->native_frames_per_second = native_frames_per_second;
     self->native_ms_per_frame = 1000 / native_frames_per_second;
+    self->pixel_buffer_size = BUSDISPLAY_DEFAULT_PIXEL_BUFFER_SIZE;
+    self->scroll_height = 0;
+    self->scroll_pending = false;
 
     uint32_t i = 0;
     while (i < init_sequence_len) {
@@ -153,6 +159,14 @@ uint16_t common_hal_busdisplay_busdisplay_get_height(busdisplay_busdisplay_obj_t
     return displayio_display_core_get_height(&self->core);
 }
 
+uint16_t common_hal_busdisplay_busdisplay_get_pixel_buffer_size(busdisplay_busdisplay_obj_t *self) {
+    return self->pixel_buffer_size;
+}
+
+void common_hal_busdisplay_busdisplay_set_pixel_buffer_size(busdisplay_busdisplay_obj_t *self, uint16_t pixel_buffer_size) {
+    self->pixel_buffer_size = pixel_buffer_size;
+}
+
 mp_float_t common_hal_busdisplay_busdisplay_get_brightness(busdisplay_busdisplay_obj_t *self) {
     return self->current_brightness;
 }
@@ -202,10 +216,101 @@ bool common_hal_busdisplay_busdisplay_set_brightness(busdisplay_busdisplay_obj_t
     return ok;
 }
 
+STATIC bool _send_command(busdisplay_busdisplay_obj_t *self, uint8_t command, const uint8_t *data, uint8_t data_length) {
+    if (!displayio_display_bus_begin_transaction(&self->bus)) {
+        return false;
+    }
+    if (self->bus.data_as_commands) {
+        uint8_t full_command[data_length + 1];
+        full_command[0] = command;
+        memcpy(full_command + 1, data, data_length);
+        self->bus.send(self->bus.bus, DISPLAY_COMMAND, CHIP_SELECT_TOGGLE_EVERY_BYTE, full_command, data_length + 1);
+    } else {
+        self->bus.send(self->bus.bus, DISPLAY_COMMAND, CHIP_SELECT_TOGGLE_EVERY_BYTE, &command, 1);
+        self->bus.send(self->bus.bus, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED, data, data_length);
+    }
+    displayio_display_bus_end_transaction(&self->bus);
+    return true;
+}
+
+// Send the scroll definition and start line for the current scroll state. With
+// scrolling off the whole memory is one scroll area scrolled to 0, which is the
+// controller's normal addressing.
+STATIC bool _send_scroll(busdisplay_busdisplay_obj_t *self, bool send_area) {
+    uint16_t top_fixed = 0;
+    uint16_t height = self->scroll_memory_height;
+    uint16_t start = 0;
+    if (self->scroll_height > 0) {
+        top_fixed = self->bus.rowstart + self->scroll_top;
+        height = self->scroll_height;
+        start = top_fixed + self->scroll_offset;
+    }
+    uint16_t bottom_fixed = self->scroll_memory_height - top_fixed - height;
+    if (send_area) {
+        uint8_t area[6] = {
+            top_fixed >> 8, top_fixed & 0xff,
+            height >> 8, height & 0xff,
+            bottom_fixed >> 8, bottom_fixed & 0xff,
+        };
+        if (!_send_command(self, MIPI_COMMAND_SET_SCROLL_AREA, area, sizeof(area))) {
+            return false;
+        }
+    }
+    uint8_t start_line[2] = { start >> 8, start & 0xff };
+    return _send_command(self, MIPI_COMMAND_SET_SCROLL_START, start_line, sizeof(start_line));
+}
+
+bool common_hal_busdisplay_busdisplay_set_scroll_area(busdisplay_busdisplay_obj_t *self, uint16_t top, uint16_t height, uint16_t memory_height) {
+    self->scroll_top = top;
+    self->scroll_height = height;
+    self->scroll_memory_height = memory_height;
+    self->scroll_offset = 0;
+    self->scroll_exposed = 0;
+    self->scroll_pending = false;
+    return _send_scroll(self, true);
+}
+
+bool common_hal_busdisplay_busdisplay_scroll(busdisplay_busdisplay_obj_t *self, mp_int_t lines) {
+    int16_t height = self->scroll_height;
+    mp_int_t shift = lines % height;
+    if (shift < 0) {
+        shift += height;
+    }
+    uint16_t old_offset = self->scroll_offset;
+    self->scroll_offset = (old_offset + shift) % height;
+    if (!_send_scroll(self, false)) {
+        self->scroll_offset = old_offset;
+        return false;
+    }
+
+    // Track which rows no longer show what root_group has there. Scrolling back
+    // and forth exposes rows at both ends, so then the whole area is redrawn.
+    int16_t exposed = self->scroll_exposed;
+    if (lines >= height || lines <= -height || (exposed > 0 && lines < 0) || (exposed < 0 && lines > 0)) {
+        exposed = height;
+    } else {
+        exposed += lines;
+    }
+    self->scroll_exposed = exposed;
+    self->scroll_pending = true;
+    if (!displayio_area_empty(&self->deferred_area)) {
+        // Rows still waiting to be drawn moved with the scroll so redraw the whole scroll area.
+        displayio_area_t scroll_area = self->core.area;
+        scroll_area.y1 = self->scroll_top;
+        scroll_area.y2 = self->scroll_top + height;
+        displayio_area_union(&self->deferred_area, &scroll_area, &self->deferred_area);
+    }
+    return true;
+}
+
 mp_obj_t common_hal_busdisplay_busdisplay_get_bus(busdisplay_busdisplay_obj_t *self) {
     return self->bus.bus;
 }
 
+mp_obj_t common_hal_busdisplay_busdisplay_get_stats(busdisplay_busdisplay_obj_t *self) {
+    return displayio_display_core_get_stats(&self->core);
+}
+
 mp_obj_t common_hal_busdisplay_busdisplay_get_root_group(busdisplay_busdisplay_obj_t *self) {
     if (self->core.current_group == NULL) {
         return mp_const_none;
@@ -224,20 +329,48 @@ STATIC const displayio_area_t *_get_refresh_areas(busdisplay_busdisplay_obj_t *s
 }
 
 STATIC void _send_pixels(busdisplay_busdisplay_obj_t *self, uint8_t *pixels, uint32_t length) {
+    uint64_t start_us = displayio_display_core_stats_time_us();
     if (!self->bus.data_as_commands) {
         self->bus.send(self->bus.bus, DISPLAY_COMMAND, CHIP_SELECT_TOGGLE_EVERY_BYTE, &self->write_ram_command, 1);
     }
     self->bus.send(self->bus.bus, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED, pixels, length);
+    displayio_display_core_record_transmit(&self->core, start_us, length);
+}
+
+bool busdisplay_busdisplay_send_area(busdisplay_busdisplay_obj_t *self, displayio_area_t *area, uint8_t *pixels, uint32_t length) {
+    if (!displayio_display_bus_is_free(&self->bus)) {
+        return false;
+    }
+    displayio_display_bus_set_region_to_update(&self->bus, &self->core, area);
+
+    displayio_display_bus_begin_transaction(&self->bus);
+    _send_pixels(self, pixels, length);
+    displayio_display_bus_end_transaction(&self->bus);
+    return true;
 }
 
-STATIC bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_area_t *area) {
-    uint16_t buffer_size = 128; // In uint32_ts
+// Leave the rows of clipped from y1 down for the next refresh.
+STATIC void _defer_area(busdisplay_busdisplay_obj_t *self, const displayio_area_t *clipped, int16_t y1) {
+    displayio_area_t rest = *clipped;
+    rest.y1 = y1;
+    displayio_area_union(&self->deferred_area, &rest, &self->deferred_area);
+    self->deferred_area.next = NULL;
+}
+
+// ram_dy is added to the rows sent to the controller, to account for hardware scrolling.
+STATIC bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_area_t *area, int16_t ram_dy) {
+    uint16_t buffer_size = self->pixel_buffer_size; // In uint32_ts
 
     displayio_area_t clipped;
     // Clip the area to the display by overlapping the areas. If there is no overlap then we're done.
     if (!displayio_display_core_clip_area(&self->core, area, &clipped)) {
         return true;
     }
+    if (!displayio_area_empty(&self->deferred_area)) {
+        // This refresh already stopped early.
+        _defer_area(self, &clipped, clipped.y1);
+        return false;
+    }
     uint16_t rows_per_buffer = displayio_area_height(&clipped);
     uint8_t pixels_per_word = (sizeof(uint32_t) * 8) / self->core.colorspace.depth;
     uint16_t pixels_per_buffer = displayio_area_size(&clipped);
@@ -290,7 +423,16 @@ STATIC bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_are
         }
         remaining_rows -= rows_per_buffer;
 
-        displayio_display_bus_set_region_to_update(&self->bus, &self->core, &subrectangle);
+        // Give other displays a turn once this refresh has used up its time.
+        if (j > 0 && self->refresh_deadline != 0 && supervisor_ticks_ms64() > self->refresh_deadline) {
+            _defer_area(self, &clipped, subrectangle.y1);
+            return false;
+        }
+
+        displayio_area_t ram_area = subrectangle;
+        ram_area.y1 += ram_dy;
+        ram_area.y2 += ram_dy;
+        displayio_display_bus_set_region_to_update(&self->bus, &self->core, &ram_area);
 
         uint16_t subrectangle_size_bytes;
         if (self->core.colorspace.depth >= 8) {
@@ -304,8 +446,9 @@ STATIC bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_are
 
         displayio_display_core_fill_area(&self->core, &subrectangle, mask, buffer);
 
-        // Can't acquire display bus; skip the rest of the data.
+        // Can't acquire display bus; draw the rest of the data next time.
         if (!displayio_display_bus_is_free(&self->bus)) {
+            _defer_area(self, &clipped, subrectangle.y1);
             return false;
         }
 
@@ -322,17 +465,74 @@ STATIC bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_are
     return true;
 }
 
-STATIC void _refresh_display(busdisplay_busdisplay_obj_t *self) {
+// Refresh an area while hardware scrolling is on. Rows inside the scroll area are
+// sent to the controller rows they currently map to, split where the mapping
+// wraps. Right after a scroll only the exposed rows of the scroll area are
+// redrawn because the rest already moved in hardware.
+STATIC void _refresh_scrolled_area(busdisplay_busdisplay_obj_t *self, const displayio_area_t *area) {
+    int16_t top = self->scroll_top;
+    int16_t bottom = top + self->scroll_height;
+    int16_t offset = self->scroll_offset;
+    int16_t wrap = bottom - offset;
+
+    int16_t exposed_y1 = top;
+    int16_t exposed_y2 = bottom;
+    if (self->scroll_pending && !self->core.full_refresh) {
+        if (self->scroll_exposed > 0) {
+            exposed_y1 = MAX(top, bottom - self->scroll_exposed);
+        } else {
+            exposed_y2 = MIN(bottom, top - self->scroll_exposed);
+        }
+    }
+
+    const struct {
+        int16_t y1, y2, ram_dy;
+    } bands[] = {
+        { area->y1, top, 0 },
+        { MAX(top, exposed_y1), MIN(wrap, exposed_y2), offset },
+        { MAX(wrap, exposed_y1), MIN(bottom, exposed_y2), offset - self->scroll_height },
+        { bottom, area->y2, 0 },
+    };
+    for (size_t i = 0; i < MP_ARRAY_SIZE(bands); i++) {
+        displayio_area_t band = *area;
+        band.y1 = MAX(band.y1, bands[i].y1);
+        band.y2 = MIN(band.y2, bands[i].y2);
+        band.next = NULL;
+        if (band.y1 < band.y2) {
+            _refresh_area(self, &band, bands[i].ram_dy);
+        }
+    }
+}
+
+STATIC void _refresh_display(busdisplay_busdisplay_obj_t *self, uint32_t budget_ms) {
     if (!displayio_display_bus_is_free(&self->bus)) {
         // A refresh on this bus is already in progress.  Try next display.
+        displayio_display_core_record_skipped_frame(&self->core);
         return;
     }
     displayio_display_core_start_refresh(&self->core);
+    self->refresh_deadline = budget_ms > 0 ? supervisor_ticks_ms64() + budget_ms : 0;
+    // Whatever the last refresh left behind goes first. Anything this refresh can't
+    // finish is collected into deferred_area again.
+    displayio_area_t resumed = self->deferred_area;
+    self->deferred_area = (displayio_area_t) { 0 };
+    uint64_t areas_start_us = displayio_display_core_stats_time_us();
     const displayio_area_t *current_area = _get_refresh_areas(self);
+    displayio_display_core_record_refresh_areas(&self->core, current_area, areas_start_us);
+    if (!displayio_area_empty(&resumed) && !self->core.full_refresh) {
+        resumed.next = current_area;
+        current_area = &resumed;
+    }
     while (current_area != NULL) {
-        _refresh_area(self, current_area);
+        if (self->scroll_height > 0) {
+            _refresh_scrolled_area(self, current_area);
+        } else {
+            _refresh_area(self, current_area, 0);
+        }
         current_area = current_area->next;
     }
+    self->scroll_exposed = 0;
+    self->scroll_pending = false;
     displayio_display_core_finish_refresh(&self->core);
 }
 
@@ -345,6 +545,10 @@ void common_hal_busdisplay_busdisplay_set_rotation(busdisplay_busdisplay_obj_t *
         self->core.height = tmp;
     }
     displayio_display_core_set_rotation(&self->core, rotation);
+    if (self->scroll_height > 0) {
+        // Hardware scrolling follows controller rows, which only match display rows at rotation 0.
+        common_hal_busdisplay_busdisplay_set_scroll_area(self, 0, 0, self->scroll_memory_height);
+    }
     if (self == &displays[0].display) {
         supervisor_stop_terminal();
         supervisor_start_terminal(self->core.width, self->core.height);
@@ -380,7 +584,7 @@ bool common_hal_busdisplay_busdisplay_refresh(busdisplay_busdisplay_obj_t *self,
         }
     }
     self->first_manual_refresh = false;
-    _refresh_display(self);
+    _refresh_display(self, 0);
     return true;
 }
 
@@ -409,9 +613,14 @@ mp_obj_t common_hal_busdisplay_busdisplay_set_root_group(busdisplay_busdisplay_o
     return mp_const_none;
 }
 
-void busdisplay_busdisplay_background(busdisplay_busdisplay_obj_t *self) {
-    if (self->auto_refresh && (supervisor_ticks_ms64() - self->core.last_refresh) > self->native_ms_per_frame) {
-        _refresh_display(self);
+void busdisplay_busdisplay_background(busdisplay_busdisplay_obj_t *self, uint32_t budget_ms) {
+    if (!self->auto_refresh) {
+        return;
+    }
+    // Finish a deferred refresh right away instead of waiting out another frame.
+    if (!displayio_area_empty(&self->deferred_area) ||
+        (supervisor_ticks_ms64() - self->core.last_refresh) > self->native_ms_per_frame) {
+        _refresh_display(self, budget_ms);
     }
 }
 
@@ -51,13 +51,34 @@ typedef struct {
     uint16_t brightness_command;
     uint16_t native_frames_per_second;
     uint16_t native_ms_per_frame;
+    uint16_t pixel_buffer_size; // In uint32_ts
+    // Hardware vertical scrolling, in display rows. scroll_height is 0 when it is off.
+    uint16_t scroll_top;
+    uint16_t scroll_height;
+    uint16_t scroll_offset;
+    uint16_t scroll_memory_height;
+    // Rows of the scroll area exposed since the last refresh: positive at the
+    // bottom of the area, negative at the top.
+    int16_t scroll_exposed;
+    bool scroll_pending;
+    // Part of an auto refresh that ran out of time or lost the bus. It is drawn at the
+    // start of the next refresh. Empty when nothing is waiting.
+    displayio_area_t deferred_area;
+    // Refreshes stop between subrectangles after this tick. 0 means no limit.
+    uint64_t refresh_deadline;
     uint8_t write_ram_command;
     bool auto_refresh;
     bool first_manual_refresh;
     bool backlight_on_high;
 } busdisplay_busdisplay_obj_t;
 
-void busdisplay_busdisplay_background(busdisplay_busdisplay_obj_t *self);
+// budget_ms limits how long one auto refresh may use the bus before the rest is left
+// for the next call. 0 means no limit.
+void busdisplay_busdisplay_background(busdisplay_busdisplay_obj_t *self, uint32_t budget_ms);
 void release_busdisplay(busdisplay_busdisplay_obj_t *self);
 void reset_busdisplay(busdisplay_busdisplay_obj_t *self);
 void busdisplay_busdisplay_collect_ptrs(busdisplay_busdisplay_obj_t *self);
+
+// Send already-formatted pixels for a native-coordinate area, bypassing the group tree.
+// Returns false without sending anything if the bus is in use.
+bool busdisplay_busdisplay_send_area(busdisplay_busdisplay_obj_t *self, displayio_area_t *area, uint8_t *pixels, uint32_t length);
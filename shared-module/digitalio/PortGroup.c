@@ -0,0 +1,245 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/runtime.h"
+#include "shared-bindings/digitalio/DigitalInOut.h"
+#include "shared-bindings/digitalio/PortGroup.h"
+
+#if CIRCUITPY_DIGITALIO_PORTGROUP
+
+STATIC inline uint32_t portgroup_shift(uint32_t bits, int shift) {
+    return shift >= 0 ? bits << shift : bits >> -shift;
+}
+
+STATIC inline digitalio_digitalinout_obj_t *portgroup_dio(digitalio_portgroup_obj_t *self, size_t i) {
+    return MP_OBJ_TO_PTR(self->digitalinouts->items[i]);
+}
+
+// Group the pins by the port register they are read from so that each port is
+// read once. Leaves num_banks at 0 if the port doesn't provide its registers.
+STATIC void portgroup_find_banks(digitalio_portgroup_obj_t *self) {
+    self->num_banks = 0;
+    self->can_write = common_hal_digitalio_has_reg_op(DIGITALINOUT_REG_SET) &&
+        common_hal_digitalio_has_reg_op(DIGITALINOUT_REG_RESET);
+    if (!common_hal_digitalio_has_reg_op(DIGITALINOUT_REG_READ)) {
+        return;
+    }
+
+    size_t num_banks = 0;
+    for (size_t i = 0; i < self->digitalinouts->len; i++) {
+        digitalio_digitalinout_obj_t *dio = portgroup_dio(self, i);
+        uint32_t mask;
+        volatile uint32_t *read_reg = common_hal_digitalio_digitalinout_get_reg(dio, DIGITALINOUT_REG_READ, &mask);
+        if (read_reg == NULL) {
+            return;
+        }
+        int bit = __builtin_ctz(mask);
+
+        volatile uint32_t *set_reg = NULL;
+        volatile uint32_t *reset_reg = NULL;
+        int set_shift = 0;
+        int reset_shift = 0;
+        if (self->can_write) {
+            uint32_t set_mask, reset_mask;
+            set_reg = common_hal_digitalio_digitalinout_get_reg(dio, DIGITALINOUT_REG_SET, &set_mask);
+            reset_reg = common_hal_digitalio_digitalinout_get_reg(dio, DIGITALINOUT_REG_RESET, &reset_mask);
+            if (set_reg == NULL || reset_reg == NULL) {
+                self->can_write = false;
+            } else {
+                set_shift = __builtin_ctz(set_mask) - bit;
+                reset_shift = __builtin_ctz(reset_mask) - bit;
+            }
+        }
+
+        size_t b = 0;
+        while (b < num_banks && self->banks[b].read_reg != read_reg) {
+            b++;
+        }
+        digitalio_portgroup_bank_t *bank = &self->banks[b];
+        if (b == num_banks) {
+            if (num_banks == DIGITALIO_PORTGROUP_MAX_BANKS) {
+                return;
+            }
+            num_banks++;
+            bank->read_reg = read_reg;
+            bank->set_reg = set_reg;
+            bank->reset_reg = reset_reg;
+            bank->mask = 0;
+            bank->shift = (int)i - bit;
+            bank->set_shift = set_shift;
+            bank->reset_shift = reset_shift;
+            bank->linear = true;
+        } else if (bank->set_reg != set_reg || bank->reset_reg != reset_reg ||
+                   bank->set_shift != set_shift || bank->reset_shift != reset_shift) {
+            self->can_write = false;
+        }
+        bank->mask |= mask;
+        // Runs of pins that keep their port order are moved with one shift.
+        if (bank->shift != (int)i - bit) {
+            bank->linear = false;
+        }
+        self->pin_bank[i] = b;
+        self->pin_bit[i] = bit;
+    }
+    self->num_banks = num_banks;
+}
+
+void common_hal_digitalio_portgroup_construct(digitalio_portgroup_obj_t *self, mp_uint_t num_pins, const mcu_pin_obj_t *pins[]) {
+    mp_obj_t dios[num_pins];
+
+    for (size_t i = 0; i < num_pins; i++) {
+        digitalio_digitalinout_obj_t *dio =
+            mp_obj_malloc(digitalio_digitalinout_obj_t, &digitalio_digitalinout_type);
+        common_hal_digitalio_digitalinout_construct(dio, pins[i]);
+        dios[i] = dio;
+    }
+
+    self->digitalinouts = mp_obj_new_tuple(num_pins, dios);
+    self->output = false;
+    self->output_value = 0;
+    portgroup_find_banks(self);
+}
+
+bool common_hal_digitalio_portgroup_deinited(digitalio_portgroup_obj_t *self) {
+    return self->digitalinouts == NULL;
+}
+
+void common_hal_digitalio_portgroup_deinit(digitalio_portgroup_obj_t *self) {
+    if (common_hal_digitalio_portgroup_deinited(self)) {
+        return;
+    }
+    for (size_t i = 0; i < self->digitalinouts->len; i++) {
+        common_hal_digitalio_digitalinout_deinit(portgroup_dio(self, i));
+    }
+    self->digitalinouts = NULL;
+}
+
+digitalinout_result_t common_hal_digitalio_portgroup_switch_to_input(digitalio_portgroup_obj_t *self, digitalio_pull_t pull) {
+    self->output = false;
+    for (size_t i = 0; i < self->digitalinouts->len; i++) {
+        digitalinout_result_t result = common_hal_digitalio_digitalinout_switch_to_input(portgroup_dio(self, i), pull);
+        if (result != DIGITALINOUT_OK) {
+            return result;
+        }
+    }
+    return DIGITALINOUT_OK;
+}
+
+digitalinout_result_t common_hal_digitalio_portgroup_switch_to_output(digitalio_portgroup_obj_t *self, uint32_t value) {
+    for (size_t i = 0; i < self->digitalinouts->len; i++) {
+        digitalinout_result_t result = common_hal_digitalio_digitalinout_switch_to_output(portgroup_dio(self, i),
+            (value >> i) & 1, DRIVE_MODE_PUSH_PULL);
+        if (result != DIGITALINOUT_OK) {
+            return result;
+        }
+    }
+    self->output = true;
+    self->output_value = value;
+    return DIGITALINOUT_OK;
+}
+
+bool common_hal_digitalio_portgroup_get_output(digitalio_portgroup_obj_t *self) {
+    return self->output;
+}
+
+uint32_t common_hal_digitalio_portgroup_get_value(digitalio_portgroup_obj_t *self) {
+    // Output pins may not be readable, so return what they were set to.
+    if (self->output) {
+        return self->output_value;
+    }
+
+    size_t num_pins = self->digitalinouts->len;
+    uint32_t value = 0;
+    if (self->num_banks == 0) {
+        for (size_t i = 0; i < num_pins; i++) {
+            if (common_hal_digitalio_digitalinout_get_value(portgroup_dio(self, i))) {
+                value |= 1u << i;
+            }
+        }
+        return value;
+    }
+
+    uint32_t levels[DIGITALIO_PORTGROUP_MAX_BANKS];
+    bool linear = true;
+    for (size_t b = 0; b < self->num_banks; b++) {
+        const digitalio_portgroup_bank_t *bank = &self->banks[b];
+        levels[b] = *bank->read_reg & bank->mask;
+        if (bank->linear) {
+            value |= portgroup_shift(levels[b], bank->shift);
+        } else {
+            linear = false;
+        }
+    }
+    if (!linear) {
+        for (size_t i = 0; i < num_pins; i++) {
+            uint8_t b = self->pin_bank[i];
+            if (!self->banks[b].linear && (levels[b] >> self->pin_bit[i]) & 1) {
+                value |= 1u << i;
+            }
+        }
+    }
+    return value;
+}
+
+void common_hal_digitalio_portgroup_set_value(digitalio_portgroup_obj_t *self, uint32_t value) {
+    size_t num_pins = self->digitalinouts->len;
+    if (num_pins < DIGITALIO_PORTGROUP_MAX_PINS) {
+        value &= (1u << num_pins) - 1;
+    }
+    self->output_value = value;
+
+    if (self->num_banks == 0 || !self->can_write) {
+        for (size_t i = 0; i < num_pins; i++) {
+            common_hal_digitalio_digitalinout_set_value(portgroup_dio(self, i), (value >> i) & 1);
+        }
+        return;
+    }
+
+    for (size_t b = 0; b < self->num_banks; b++) {
+        const digitalio_portgroup_bank_t *bank = &self->banks[b];
+        uint32_t bits = 0;
+        if (bank->linear) {
+            bits = portgroup_shift(value, -bank->shift) & bank->mask;
+        } else {
+            for (size_t i = 0; i < num_pins; i++) {
+                if (self->pin_bank[i] == b && (value >> i) & 1) {
+                    bits |= 1u << self->pin_bit[i];
+                }
+            }
+        }
+        uint32_t set = portgroup_shift(bits, bank->set_shift);
+        uint32_t reset = portgroup_shift(~bits & bank->mask, bank->reset_shift);
+        if (bank->set_reg == bank->reset_reg) {
+            // One write changes every pin of the bank at once.
+            *bank->set_reg = set | reset;
+        } else {
+            *bank->set_reg = set;
+            *bank->reset_reg = reset;
+        }
+    }
+}
+
+#endif // CIRCUITPY_DIGITALIO_PORTGROUP
@@ -0,0 +1,58 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "py/obj.h"
+#include "py/objtuple.h"
+
+// Pins are packed into the bits of a uint32_t value.
+#define DIGITALIO_PORTGROUP_MAX_PINS (32)
+// Groups spanning more GPIO ports than this are accessed one pin at a time.
+#define DIGITALIO_PORTGROUP_MAX_BANKS (4)
+
+typedef struct {
+    volatile uint32_t *read_reg;
+    volatile uint32_t *set_reg;
+    volatile uint32_t *reset_reg;
+    uint32_t mask; // Bits of read_reg that belong to the group.
+    int8_t shift; // Group bit = register bit + shift, when linear.
+    int8_t set_shift; // Set and reset register bits, relative to read_reg.
+    int8_t reset_shift;
+    bool linear;
+} digitalio_portgroup_bank_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    mp_obj_tuple_t *digitalinouts;
+    uint32_t output_value;
+    uint8_t num_banks; // 0 when the pins are accessed one at a time.
+    bool output;
+    bool can_write; // Every bank has set and reset registers.
+    uint8_t pin_bank[DIGITALIO_PORTGROUP_MAX_PINS];
+    uint8_t pin_bit[DIGITALIO_PORTGROUP_MAX_PINS];
+    digitalio_portgroup_bank_t banks[DIGITALIO_PORTGROUP_MAX_BANKS];
+} digitalio_portgroup_obj_t;
@@ -51,11 +51,13 @@ void common_hal_displayio_bitmap_construct_from_buffer(displayio_bitmap_t *self,
     self->stride = stride(width, bits_per_value);
     self->data_alloc = false;
     if (!data) {
-        data = m_malloc(self->stride * height * sizeof(uint32_t));
+        // Drawing into a bitmap in PSRAM is several times slower so prefer fast RAM.
+        data = m_malloc_fast(self->stride * height * sizeof(uint32_t));
         self->data_alloc = true;
     }
     self->data = data;
     self->read_only = read_only;
+    self->buffer = MP_OBJ_NULL;
     self->bits_per_value = bits_per_value;
 
     if (bits_per_value > 8 && bits_per_value != 16 && bits_per_value != 32) {
@@ -80,6 +82,24 @@ void common_hal_displayio_bitmap_construct_from_buffer(displayio_bitmap_t *self,
     self->dirty_area.x2 = width;
     self->dirty_area.y1 = 0;
     self->dirty_area.y2 = height;
+    self->changes = 0;
+}
+
+void common_hal_displayio_bitmap_construct_over_buffer(displayio_bitmap_t *self, uint32_t width,
+    uint32_t height, uint32_t bits_per_value, mp_obj_t buffer) {
+    // Writable buffers make a writable bitmap. Read-only ones, such as bytes in
+    // flash or memory-mapped flash, are read in place with no copy to RAM.
+    mp_buffer_info_t bufinfo;
+    bool read_only = !mp_get_buffer(buffer, &bufinfo, MP_BUFFER_WRITE);
+    if (read_only) {
+        mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_READ);
+    }
+    mp_arg_validate_length_min(bufinfo.len, stride(width, bits_per_value) * height * sizeof(uint32_t), MP_QSTR_buffer);
+    if ((uintptr_t)bufinfo.buf % sizeof(uint32_t) != 0) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be 4-byte aligned"), MP_QSTR_buffer);
+    }
+    common_hal_displayio_bitmap_construct_from_buffer(self, width, height, bits_per_value, bufinfo.buf, read_only);
+    self->buffer = buffer;
 }
 
 void common_hal_displayio_bitmap_deinit(displayio_bitmap_t *self) {
@@ -87,6 +107,7 @@ void common_hal_displayio_bitmap_deinit(displayio_bitmap_t *self) {
         gc_free(self->data);
     }
     self->data = NULL;
+    self->buffer = MP_OBJ_NULL;
 }
 
 bool common_hal_displayio_bitmap_deinited(displayio_bitmap_t *self) {
@@ -138,6 +159,7 @@ void displayio_bitmap_set_dirty_area(displayio_bitmap_t *self, const displayio_a
     displayio_area_union(&area, &self->dirty_area, &area);
     displayio_area_t bitmap_area = {0, 0, self->width, self->height, NULL};
     displayio_area_compute_overlap(&area, &bitmap_area, &self->dirty_area);
+    self->changes++;
 }
 
 void displayio_bitmap_write_pixel(displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t value) {
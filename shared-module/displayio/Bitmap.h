@@ -43,9 +43,11 @@ typedef struct {
     uint8_t x_shift;
     size_t x_mask;
     displayio_area_t dirty_area;
+    uint32_t changes; // Incremented each time an area is marked dirty.
     uint16_t bitmask;
     bool read_only;
     bool data_alloc; // did bitmap allocate data or someone else
+    mp_obj_t buffer; // object that owns data when it was passed in from Python, or NULL
 } displayio_bitmap_t;
 
 void displayio_bitmap_finish_refresh(displayio_bitmap_t *self);
@@ -46,6 +46,7 @@ void common_hal_displayio_colorconverter_construct(displayio_colorconverter_t *s
     self->transparent_color = NO_TRANSPARENT_COLOR;
     self->input_colorspace = input_colorspace;
     self->output_colorspace.depth = 16;
+    self->path_colorspace = NULL;
 }
 
 uint16_t displayio_colorconverter_compute_rgb565(uint32_t color_rgb888) {
@@ -179,6 +180,7 @@ void common_hal_displayio_colorconverter_convert(displayio_colorconverter_t *sel
 
 void common_hal_displayio_colorconverter_set_dither(displayio_colorconverter_t *self, bool dither) {
     self->dither = dither;
+    self->path_colorspace = NULL;
 }
 
 bool common_hal_displayio_colorconverter_get_dither(displayio_colorconverter_t *self) {
@@ -335,6 +337,26 @@ void displayio_convert_color(const _displayio_colorspace_t *colorspace, bool dit
     output_color->opaque = false;
 }
 
+// Pick the cheapest conversion that gives the same result as displayio_convert_color.
+// 565 input survives the RGB888 round trip unchanged, so 16-bit output is at
+// most a byte swap of it.
+STATIC displayio_colorconverter_path_t displayio_colorconverter_select_path(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace) {
+    if (self->dither || colorspace->depth != 16) {
+        return DISPLAYIO_COLORCONVERTER_PATH_GENERIC;
+    }
+    bool swapped_output = colorspace->reverse_bytes_in_word;
+    switch (self->input_colorspace) {
+        case DISPLAYIO_COLORSPACE_RGB565:
+            return swapped_output ? DISPLAYIO_COLORCONVERTER_PATH_SWAP16 : DISPLAYIO_COLORCONVERTER_PATH_COPY16;
+        case DISPLAYIO_COLORSPACE_RGB565_SWAPPED:
+            return swapped_output ? DISPLAYIO_COLORCONVERTER_PATH_COPY16 : DISPLAYIO_COLORCONVERTER_PATH_SWAP16;
+        case DISPLAYIO_COLORSPACE_RGB888:
+            return swapped_output ? DISPLAYIO_COLORCONVERTER_PATH_RGB888_TO_RGB565_SWAPPED : DISPLAYIO_COLORCONVERTER_PATH_RGB888_TO_RGB565;
+        default:
+            return DISPLAYIO_COLORCONVERTER_PATH_GENERIC;
+    }
+}
+
 void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
     uint32_t pixel = input_pixel->pixel;
 
@@ -343,6 +365,31 @@ void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _d
         return;
     }
 
+    if (self->path_colorspace != colorspace) {
+        self->path = displayio_colorconverter_select_path(self, colorspace);
+        self->path_colorspace = colorspace;
+    }
+    switch (self->path) {
+        case DISPLAYIO_COLORCONVERTER_PATH_COPY16:
+            output_color->pixel = pixel & 0xffff;
+            output_color->opaque = true;
+            return;
+        case DISPLAYIO_COLORCONVERTER_PATH_SWAP16:
+            output_color->pixel = __builtin_bswap16(pixel);
+            output_color->opaque = true;
+            return;
+        case DISPLAYIO_COLORCONVERTER_PATH_RGB888_TO_RGB565:
+            output_color->pixel = displayio_colorconverter_compute_rgb565(pixel);
+            output_color->opaque = true;
+            return;
+        case DISPLAYIO_COLORCONVERTER_PATH_RGB888_TO_RGB565_SWAPPED:
+            output_color->pixel = __builtin_bswap16(displayio_colorconverter_compute_rgb565(pixel));
+            output_color->opaque = true;
+            return;
+        case DISPLAYIO_COLORCONVERTER_PATH_GENERIC:
+            break;
+    }
+
     if (!self->dither && self->cached_colorspace == colorspace && self->cached_input_pixel == input_pixel->pixel) {
         output_color->pixel = self->cached_output_color;
         return;
@@ -361,10 +408,11 @@ void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _d
 
 
 
-// Currently no refresh logic is needed for a ColorConverter.
 bool displayio_colorconverter_needs_refresh(displayio_colorconverter_t *self) {
     return false;
 }
 
 void displayio_colorconverter_finish_refresh(displayio_colorconverter_t *self) {
+    // The conversion path is chosen for a colorspace on first use in each refresh.
+    self->path_colorspace = NULL;
 }
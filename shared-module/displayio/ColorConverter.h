@@ -33,6 +33,15 @@
 #include "py/obj.h"
 #include "shared-module/displayio/Palette.h"
 
+// Conversions that skip the general RGB888 round trip in displayio_convert_color.
+typedef enum {
+    DISPLAYIO_COLORCONVERTER_PATH_GENERIC,
+    DISPLAYIO_COLORCONVERTER_PATH_COPY16,
+    DISPLAYIO_COLORCONVERTER_PATH_SWAP16,
+    DISPLAYIO_COLORCONVERTER_PATH_RGB888_TO_RGB565,
+    DISPLAYIO_COLORCONVERTER_PATH_RGB888_TO_RGB565_SWAPPED,
+} displayio_colorconverter_path_t;
+
 typedef struct displayio_colorconverter {
     mp_obj_base_t base;
     bool dither;
@@ -44,6 +53,10 @@ typedef struct displayio_colorconverter {
     const _displayio_colorspace_t *cached_colorspace;
     uint32_t cached_input_pixel;
     uint32_t cached_output_color;
+
+    // Conversion chosen for path_colorspace. Picked again after each refresh.
+    const _displayio_colorspace_t *path_colorspace;
+    displayio_colorconverter_path_t path;
 } displayio_colorconverter_t;
 
 bool displayio_colorconverter_needs_refresh(displayio_colorconverter_t *self);
@@ -345,14 +345,67 @@ static void _remove_layer(displayio_group_t *self, size_t index) {
     self->item_removed = true;
 }
 
+// Displays refresh in bands of rows, so members are bucketed by the rows they cover. Band
+// indices wrap around, which only causes extra members to be visited.
+#define GROUP_BAND_SHIFT (4)
+#define GROUP_BAND_COUNT (32)
+
+// Groups whose bands_generation matches this collected their bands during the current refresh.
+STATIC uint32_t bands_generation = 1;
+
+void displayio_group_discard_bands(void) {
+    bands_generation++;
+    if (bands_generation == 0) {
+        bands_generation = 1;
+    }
+}
+
+STATIC bool _bands_valid(const displayio_group_t *self) {
+    return self->bands_generation == bands_generation;
+}
+
+STATIC uint32_t _area_bands(const displayio_area_t *area) {
+    if (area->x1 >= area->x2 || area->y1 >= area->y2) {
+        return 0;
+    }
+    int32_t first = area->y1 >> GROUP_BAND_SHIFT;
+    int32_t last = (area->y2 - 1) >> GROUP_BAND_SHIFT;
+    if (last - first >= GROUP_BAND_COUNT - 1) {
+        return 0xffffffff;
+    }
+    uint32_t bands = 0;
+    for (int32_t band = first; band <= last; band++) {
+        bands |= 1u << (band & (GROUP_BAND_COUNT - 1));
+    }
+    return bands;
+}
+
+STATIC void _members_changed(displayio_group_t *self) {
+    self->bands_generation = 0;
+    size_t len = self->members->len;
+    if (len <= self->member_bands_alloc) {
+        return;
+    }
+    // Without room for every member, refreshes simply visit all of them.
+    size_t alloc = len + 4;
+    uint32_t *member_bands = m_renew_maybe(uint32_t, self->member_bands, self->member_bands_alloc, alloc, true);
+    if (member_bands != NULL) {
+        self->member_bands = member_bands;
+        self->member_bands_alloc = alloc;
+    }
+}
+
 void common_hal_displayio_group_insert(displayio_group_t *self, size_t index, mp_obj_t layer) {
     _add_layer(self, layer);
     mp_obj_list_insert(self->members, index, layer);
+    _members_changed(self);
 }
 
 mp_obj_t common_hal_displayio_group_pop(displayio_group_t *self, size_t index) {
     _remove_layer(self, index);
-    return mp_obj_list_pop(self->members, index);
+    mp_obj_t layer = mp_obj_list_pop(self->members, index);
+    _members_changed(self);
+    return layer;
 }
 
 mp_int_t common_hal_displayio_group_index(displayio_group_t *self, mp_obj_t layer) {
@@ -374,6 +427,7 @@ void common_hal_displayio_group_set(displayio_group_t *self, size_t index, mp_ob
     _add_layer(self, layer);
     _remove_layer(self, index);
     mp_obj_list_store(self->members, MP_OBJ_NEW_SMALL_INT(index), layer);
+    _members_changed(self);
 }
 
 void displayio_group_construct(displayio_group_t *self, mp_obj_list_t *members, uint32_t scale, mp_int_t x, mp_int_t y) {
@@ -384,18 +438,79 @@ void displayio_group_construct(displayio_group_t *self, mp_obj_list_t *members,
     self->scale = scale;
     self->in_group = false;
     self->readonly = false;
+    self->member_bands = NULL;
+    self->member_bands_alloc = 0;
+    _members_changed(self);
+}
+
+// Number of opaque layers remembered while filling an area. Layers completely underneath one of
+// them are skipped without calling their fill function.
+#define GROUP_OCCLUDER_COUNT (2)
+
+STATIC bool _occluded(const displayio_area_t *occluders, uint8_t occluder_count,
+    const displayio_area_t *area, const displayio_area_t *layer_area) {
+    displayio_area_t overlap;
+    if (!displayio_area_compute_overlap(area, layer_area, &overlap)) {
+        return false;
+    }
+    for (uint8_t i = 0; i < occluder_count; i++) {
+        if (displayio_area_contains(&occluders[i], &overlap)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Remembers an opaque area. When full, the smallest remembered area is replaced if the new one is larger.
+STATIC void _add_occluder(displayio_area_t *occluders, uint8_t *occluder_count, const displayio_area_t *covered) {
+    uint8_t index = *occluder_count;
+    if (index == GROUP_OCCLUDER_COUNT) {
+        index = 0;
+        for (uint8_t i = 1; i < GROUP_OCCLUDER_COUNT; i++) {
+            if (displayio_area_size(&occluders[i]) < displayio_area_size(&occluders[index])) {
+                index = i;
+            }
+        }
+        if (displayio_area_size(covered) <= displayio_area_size(&occluders[index])) {
+            return;
+        }
+    } else {
+        (*occluder_count)++;
+    }
+    displayio_area_copy_coords(covered, &occluders[index]);
 }
 
 bool displayio_group_fill_area(displayio_group_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
     // Track if any of the layers finishes filling in the given area. We can ignore any remaining
     // layers at that point.
     if (self->hidden == false) {
+        bool bands_valid = _bands_valid(self);
+        uint32_t area_bands = 0;
+        if (bands_valid) {
+            area_bands = _area_bands(area);
+            if ((self->bands & area_bands) == 0) {
+                return false;
+            }
+        }
+        // Portions of area already covered by opaque layers above the current one.
+        displayio_area_t occluders[GROUP_OCCLUDER_COUNT];
+        uint8_t occluder_count = 0;
         for (int32_t i = self->members->len - 1; i >= 0; i--) {
+            if (bands_valid && (self->member_bands[i] & area_bands) == 0) {
+                continue;
+            }
             mp_obj_t layer;
             #if CIRCUITPY_VECTORIO
             const vectorio_draw_protocol_t *draw_protocol = mp_proto_get(MP_QSTR_protocol_draw, self->members->items[i]);
             if (draw_protocol != NULL) {
                 layer = draw_protocol->draw_get_protocol_self(self->members->items[i]);
+                if (occluder_count > 0) {
+                    displayio_area_t layer_area;
+                    draw_protocol->draw_protocol_impl->draw_get_dirty_area(layer, &layer_area);
+                    if (_occluded(occluders, occluder_count, area, &layer_area)) {
+                        continue;
+                    }
+                }
                 if (draw_protocol->draw_protocol_impl->draw_fill_area(layer, colorspace, area, mask, buffer)) {
                     return true;
                 }
@@ -405,9 +520,18 @@ bool displayio_group_fill_area(displayio_group_t *self, const _displayio_colorsp
             layer = mp_obj_cast_to_native_base(
                 self->members->items[i], &displayio_tilegrid_type);
             if (layer != MP_OBJ_NULL) {
-                if (displayio_tilegrid_fill_area(layer, colorspace, area, mask, buffer)) {
+                displayio_tilegrid_t *tilegrid = layer;
+                if (_occluded(occluders, occluder_count, area, &tilegrid->current_area)) {
+                    continue;
+                }
+                if (displayio_tilegrid_fill_area(tilegrid, colorspace, area, mask, buffer)) {
                     return true;
                 }
+                displayio_area_t covered;
+                if (displayio_area_compute_overlap(area, &tilegrid->current_area, &covered) &&
+                    displayio_tilegrid_is_opaque(tilegrid, colorspace)) {
+                    _add_occluder(occluders, &occluder_count, &covered);
+                }
                 continue;
             }
             layer = mp_obj_cast_to_native_base(
@@ -450,37 +574,56 @@ void displayio_group_finish_refresh(displayio_group_t *self) {
     }
 }
 
+STATIC void _set_member_bands(displayio_group_t *self, size_t index, uint32_t bands) {
+    if (self->member_bands_alloc >= self->members->len) {
+        self->member_bands[index] = bands;
+    }
+    self->bands |= bands;
+}
+
 displayio_area_t *displayio_group_get_refresh_areas(displayio_group_t *self, displayio_area_t *tail) {
     if (self->item_removed) {
         self->dirty_area.next = tail;
         tail = &self->dirty_area;
     }
 
+    // Bucket the members while visiting them so that filling each area of this refresh only
+    // visits the members that may draw in it.
+    self->bands = 0;
     for (int32_t i = self->members->len - 1; i >= 0; i--) {
         mp_obj_t layer;
+        displayio_area_t layer_area;
         #if CIRCUITPY_VECTORIO
         const vectorio_draw_protocol_t *draw_protocol = mp_proto_get(MP_QSTR_protocol_draw, self->members->items[i]);
         if (draw_protocol != NULL) {
             layer = draw_protocol->draw_get_protocol_self(self->members->items[i]);
             tail = draw_protocol->draw_protocol_impl->draw_get_refresh_areas(layer, tail);
+            draw_protocol->draw_protocol_impl->draw_get_dirty_area(layer, &layer_area);
+            _set_member_bands(self, i, _area_bands(&layer_area));
             continue;
         }
         #endif
         layer = mp_obj_cast_to_native_base(
             self->members->items[i], &displayio_tilegrid_type);
         if (layer != MP_OBJ_NULL) {
-            if (!displayio_tilegrid_get_rendered_hidden(layer)) {
-                tail = displayio_tilegrid_get_refresh_areas(layer, tail);
+            displayio_tilegrid_t *tilegrid = layer;
+            if (!displayio_tilegrid_get_rendered_hidden(tilegrid)) {
+                tail = displayio_tilegrid_get_refresh_areas(tilegrid, tail);
             }
+            _set_member_bands(self, i, _area_bands(&tilegrid->current_area));
             continue;
         }
         layer = mp_obj_cast_to_native_base(
             self->members->items[i], &displayio_group_type);
         if (layer != MP_OBJ_NULL) {
-            tail = displayio_group_get_refresh_areas(layer, tail);
+            displayio_group_t *group = layer;
+            tail = displayio_group_get_refresh_areas(group, tail);
+            _set_member_bands(self, i, _bands_valid(group) ? group->bands : 0xffffffff);
             continue;
         }
+        _set_member_bands(self, i, 0xffffffff);
     }
+    self->bands_generation = self->member_bands_alloc >= self->members->len ? bands_generation : 0;
 
     return tail;
 }
@@ -40,6 +40,12 @@ typedef struct {
     mp_obj_list_t *members;
     displayio_buffer_transform_t absolute_transform;
     displayio_area_t dirty_area; // Catch all for changed area
+    // Bitmask of the display row bands each member covered when refresh areas were last
+    // collected. Only valid while bands_generation matches the current refresh.
+    uint32_t *member_bands;
+    size_t member_bands_alloc;
+    uint32_t bands; // Union of member_bands
+    uint32_t bands_generation;
     int16_t x;
     int16_t y;
     uint16_t scale;
@@ -58,5 +64,8 @@ bool displayio_group_fill_area(displayio_group_t *group, const _displayio_colors
 void displayio_group_update_transform(displayio_group_t *group, const displayio_buffer_transform_t *parent_transform);
 void displayio_group_finish_refresh(displayio_group_t *self);
 displayio_area_t *displayio_group_get_refresh_areas(displayio_group_t *self, displayio_area_t *tail);
+// Forget the member bands collected by displayio_group_get_refresh_areas. Must be called when a
+// refresh finishes or is abandoned, since members may move before the next one.
+void displayio_group_discard_bands(void);
 
 #endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_GROUP_H
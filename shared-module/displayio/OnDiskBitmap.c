@@ -146,6 +146,26 @@ void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self,
         self->stride = (bit_stride / 8);
     }
 
+    self->row_cache_rows = MIN(self->height, MAX(1, DISPLAYIO_ONDISKBITMAP_ROW_CACHE_SIZE / self->stride));
+    self->row_cache = m_malloc_maybe(self->row_cache_rows * self->stride);
+    self->row_cache_first = 0;
+    self->row_cache_count = 0;
+}
+
+// Read the rows from y down, as far as fits in the cache, with one f_read.
+STATIC void fill_row_cache(displayio_ondiskbitmap_t *self, uint16_t y) {
+    uint16_t rows = MIN(self->row_cache_rows, self->height - y);
+    // Rows are stored bottom up, so the last of these comes first in the file.
+    uint32_t location = self->data_offset + (self->height - y - rows) * self->stride;
+    self->row_cache_count = 0;
+    UINT bytes_read;
+    if (f_lseek(&self->file->fp, location) != FR_OK ||
+        f_read(&self->file->fp, self->row_cache, rows * self->stride, &bytes_read) != FR_OK ||
+        bytes_read != rows * self->stride) {
+        return;
+    }
+    self->row_cache_first = y;
+    self->row_cache_count = rows;
 }
 
 
@@ -155,19 +175,32 @@ uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *s
         return 0;
     }
 
-    uint32_t location;
+    uint32_t column;
     uint8_t bytes_per_pixel = (self->bits_per_pixel / 8)  ? (self->bits_per_pixel / 8) : 1;
     uint8_t pixels_per_byte = 8 / self->bits_per_pixel;
     if (pixels_per_byte == 0) {
-        location = self->data_offset + (self->height - y - 1) * self->stride + x * bytes_per_pixel;
+        column = x * bytes_per_pixel;
     } else {
-        location = self->data_offset + (self->height - y - 1) * self->stride + x / pixels_per_byte;
+        column = x / pixels_per_byte;
     }
-    // We don't cache here because the underlying FS caches sectors.
-    f_lseek(&self->file->fp, location);
-    UINT bytes_read;
     uint32_t pixel_data = 0;
-    uint32_t result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
+    uint32_t result;
+    if (self->row_cache != NULL) {
+        if (y < self->row_cache_first || y >= self->row_cache_first + self->row_cache_count) {
+            fill_row_cache(self, y);
+        }
+        result = FR_DISK_ERR;
+        if (self->row_cache_count > 0) {
+            uint16_t cache_row = self->row_cache_first + self->row_cache_count - 1 - y;
+            memcpy(&pixel_data, self->row_cache + cache_row * self->stride + column, bytes_per_pixel);
+            result = FR_OK;
+        }
+    } else {
+        uint32_t location = self->data_offset + (self->height - y - 1) * self->stride + column;
+        f_lseek(&self->file->fp, location);
+        UINT bytes_read;
+        result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
+    }
     if (result == FR_OK) {
         uint32_t tmp = 0;
         uint8_t red;
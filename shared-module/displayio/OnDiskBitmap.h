@@ -34,6 +34,12 @@
 
 #include "extmod/vfs_fat.h"
 
+// Room for whole rows of file data read ahead in one go. Displays refresh in
+// sub-rectangles a few rows tall, so most pixel fetches hit rows already read.
+#ifndef DISPLAYIO_ONDISKBITMAP_ROW_CACHE_SIZE
+#define DISPLAYIO_ONDISKBITMAP_ROW_CACHE_SIZE (4096)
+#endif
+
 typedef struct {
     mp_obj_base_t base;
     uint16_t width;
@@ -49,6 +55,12 @@ typedef struct {
         struct displayio_palette *palette;
         struct displayio_colorconverter *colorconverter;
     };
+    // Rows row_cache_first to row_cache_first + row_cache_count - 1, in file order
+    // (bottom row first). NULL if there wasn't memory for even one row.
+    uint8_t *row_cache;
+    uint16_t row_cache_rows;
+    uint16_t row_cache_first;
+    uint16_t row_cache_count;
     bool bitfield_compressed;
     uint8_t bits_per_pixel;
 } displayio_ondiskbitmap_t;
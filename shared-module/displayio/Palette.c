@@ -32,10 +32,19 @@ void common_hal_displayio_palette_construct(displayio_palette_t *self, uint16_t
     self->color_count = color_count;
     self->colors = (_displayio_color_t *)m_malloc(color_count * sizeof(_displayio_color_t));
     self->dither = dither;
+    self->lut_colorspace = NULL;
+    self->dirty_indices = 0;
+}
+
+STATIC void _mark_dirty(displayio_palette_t *self, uint32_t palette_index) {
+    self->lut_colorspace = NULL;
+    self->dirty_indices |= 1u << (palette_index % 32);
+    self->needs_refresh = true;
 }
 
 void common_hal_displayio_palette_set_dither(displayio_palette_t *self, bool dither) {
     self->dither = dither;
+    self->lut_colorspace = NULL;
 }
 
 bool common_hal_displayio_palette_get_dither(displayio_palette_t *self) {
@@ -44,12 +53,12 @@ bool common_hal_displayio_palette_get_dither(displayio_palette_t *self) {
 
 void common_hal_displayio_palette_make_opaque(displayio_palette_t *self, uint32_t palette_index) {
     self->colors[palette_index].transparent = false;
-    self->needs_refresh = true;
+    _mark_dirty(self, palette_index);
 }
 
 void common_hal_displayio_palette_make_transparent(displayio_palette_t *self, uint32_t palette_index) {
     self->colors[palette_index].transparent = true;
-    self->needs_refresh = true;
+    _mark_dirty(self, palette_index);
 }
 
 bool common_hal_displayio_palette_is_transparent(displayio_palette_t *self, uint32_t palette_index) {
@@ -66,7 +75,7 @@ void common_hal_displayio_palette_set_color(displayio_palette_t *self, uint32_t
     }
     self->colors[palette_index].rgb888 = color;
     self->colors[palette_index].cached_colorspace = NULL;
-    self->needs_refresh = true;
+    _mark_dirty(self, palette_index);
 }
 
 uint32_t common_hal_displayio_palette_get_color(displayio_palette_t *self, uint32_t palette_index) {
@@ -103,10 +112,40 @@ void displayio_palette_get_color(displayio_palette_t *self, const _displayio_col
     }
 }
 
+bool displayio_palette_prepare_lut(displayio_palette_t *self, const _displayio_colorspace_t *colorspace) {
+    if (self->lut_colorspace == colorspace &&
+        self->lut_grayscale_bit == colorspace->grayscale_bit &&
+        self->lut_grayscale == colorspace->grayscale) {
+        return true;
+    }
+    if (self->dither) {
+        return false;
+    }
+    displayio_input_pixel_t input_pixel = { 0 };
+    displayio_output_pixel_t output_pixel;
+    for (uint32_t i = 0; i < self->color_count; i++) {
+        if (self->colors[i].transparent) {
+            return false;
+        }
+        input_pixel.pixel = i;
+        output_pixel.opaque = true;
+        displayio_palette_get_color(self, colorspace, &input_pixel, &output_pixel);
+    }
+    self->lut_colorspace = colorspace;
+    self->lut_grayscale_bit = colorspace->grayscale_bit;
+    self->lut_grayscale = colorspace->grayscale;
+    return true;
+}
+
 bool displayio_palette_needs_refresh(displayio_palette_t *self) {
     return self->needs_refresh;
 }
 
+uint32_t displayio_palette_get_dirty_indices(displayio_palette_t *self) {
+    return self->dirty_indices;
+}
+
 void displayio_palette_finish_refresh(displayio_palette_t *self) {
     self->needs_refresh = false;
+    self->dirty_indices = 0;
 }
@@ -74,6 +74,13 @@ typedef struct displayio_palette {
     mp_obj_base_t base;
     _displayio_color_t *colors;
     uint32_t color_count;
+    // Colorspace that every color's cached_color was last converted into. NULL when any color
+    // changed since then or a color is transparent.
+    const _displayio_colorspace_t *lut_colorspace;
+    // Bit (index % 32) is set for each color changed since the last refresh.
+    uint32_t dirty_indices;
+    uint8_t lut_grayscale_bit;
+    bool lut_grayscale;
     bool needs_refresh;
     bool dither;
 } displayio_palette_t;
@@ -81,7 +88,12 @@ typedef struct displayio_palette {
 
 void displayio_palette_get_color(displayio_palette_t *palette, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color);
 ;
+// Converts every color into the colorspace so that cached_color can be used as a
+// lookup table. Returns false when that isn't possible because of dithering or transparency.
+bool displayio_palette_prepare_lut(displayio_palette_t *self, const _displayio_colorspace_t *colorspace);
 bool displayio_palette_needs_refresh(displayio_palette_t *self);
+// Returns the indices changed since the last refresh, folded into 32 bits like dirty_indices.
+uint32_t displayio_palette_get_dirty_indices(displayio_palette_t *self);
 void displayio_palette_finish_refresh(displayio_palette_t *self);
 
 #endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_PALLETE_H
@@ -26,6 +26,8 @@
 
 #include "shared-bindings/displayio/TileGrid.h"
 
+#include <string.h>
+
 #include "py/runtime.h"
 #include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/displayio/ColorConverter.h"
@@ -74,6 +76,7 @@ void common_hal_displayio_tilegrid_construct(displayio_tilegrid_t *self, mp_obj_
     self->flip_y = false;
     self->transpose_xy = false;
     self->absolute_transform = NULL;
+    self->palette_usage_valid = false;
 }
 
 
@@ -233,6 +236,7 @@ mp_obj_t common_hal_displayio_tilegrid_get_bitmap(displayio_tilegrid_t *self) {
 void common_hal_displayio_tilegrid_set_bitmap(displayio_tilegrid_t *self, mp_obj_t bitmap) {
     self->bitmap = bitmap;
     self->full_change = true;
+    self->palette_usage_valid = false;
 }
 
 uint16_t common_hal_displayio_tilegrid_get_width(displayio_tilegrid_t *self) {
@@ -262,6 +266,61 @@ uint8_t common_hal_displayio_tilegrid_get_tile(displayio_tilegrid_t *self, uint1
     return tiles[y * self->width_in_tiles + x];
 }
 
+// Adds the relative area to the list of dirty areas. Areas are kept separate while there is room
+// so that distant changes don't force everything in between to be redrawn. Once the list is full,
+// the new area is merged into whichever existing area grows the least.
+STATIC void _add_dirty_area(displayio_tilegrid_t *self, const displayio_area_t *area) {
+    if (!self->partial_change) {
+        self->dirty_area_count = 0;
+    }
+    self->partial_change = true;
+
+    uint8_t best = 0;
+    uint32_t best_growth = 0xffffffff;
+    for (uint8_t i = 0; i < self->dirty_area_count; i++) {
+        displayio_area_t u;
+        displayio_area_union(&self->dirty_area[i], area, &u);
+        uint32_t growth = displayio_area_size(&u) - displayio_area_size(&self->dirty_area[i]);
+        if (growth < best_growth) {
+            best = i;
+            best_growth = growth;
+        }
+    }
+    // Keep the area separate when merging would redraw pixels that aren't dirty.
+    if (self->dirty_area_count < CIRCUITPY_TILEGRID_DIRTY_AREAS &&
+        (self->dirty_area_count == 0 || best_growth > displayio_area_size(area))) {
+        displayio_area_copy(area, &self->dirty_area[self->dirty_area_count]);
+        self->dirty_area_count++;
+        return;
+    }
+    displayio_area_union(&self->dirty_area[best], area, &self->dirty_area[best]);
+}
+
+// Marks count tiles starting at x, y dirty. The run may wrap around the right edge of the grid
+// when top_left_x is not zero so it can take two areas.
+STATIC void _mark_tiles_dirty(displayio_tilegrid_t *self, uint16_t x, uint16_t y, uint16_t count) {
+    displayio_area_t tile_area;
+    int16_t tx = (x - self->top_left_x) % self->width_in_tiles;
+    if (tx < 0) {
+        tx += self->width_in_tiles;
+    }
+    int16_t ty = (y - self->top_left_y) % self->height_in_tiles;
+    if (ty < 0) {
+        ty += self->height_in_tiles;
+    }
+    tile_area.y1 = ty * self->tile_height;
+    tile_area.y2 = tile_area.y1 + self->tile_height;
+    uint16_t first_count = MIN(count, self->width_in_tiles - tx);
+    tile_area.x1 = tx * self->tile_width;
+    tile_area.x2 = tile_area.x1 + first_count * self->tile_width;
+    _add_dirty_area(self, &tile_area);
+    if (first_count < count) {
+        tile_area.x1 = 0;
+        tile_area.x2 = (count - first_count) * self->tile_width;
+        _add_dirty_area(self, &tile_area);
+    }
+}
+
 void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t x, uint16_t y, uint8_t tile_index) {
     if (tile_index >= self->tiles_in_bitmap) {
         mp_raise_ValueError(MP_ERROR_TEXT("Tile index out of bounds"));
@@ -274,31 +333,39 @@ void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t
         return;
     }
     tiles[y * self->width_in_tiles + x] = tile_index;
-    displayio_area_t temp_area;
-    displayio_area_t *tile_area;
-    if (!self->partial_change) {
-        tile_area = &self->dirty_area;
-    } else {
-        tile_area = &temp_area;
+    _mark_tiles_dirty(self, x, y, 1);
+}
+
+void displayio_tilegrid_set_tiles(displayio_tilegrid_t *self, uint16_t x, uint16_t y, const uint8_t *tile_indices, uint16_t count) {
+    for (uint16_t i = 0; i < count; i++) {
+        if (tile_indices[i] >= self->tiles_in_bitmap) {
+            mp_raise_ValueError(MP_ERROR_TEXT("Tile index out of bounds"));
+        }
     }
-    int16_t tx = (x - self->top_left_x) % self->width_in_tiles;
-    if (tx < 0) {
-        tx += self->width_in_tiles;
+    uint8_t *tiles = self->tiles;
+    if (self->inline_tiles) {
+        tiles = (uint8_t *)&self->tiles;
     }
-    tile_area->x1 = tx * self->tile_width;
-    tile_area->x2 = tile_area->x1 + self->tile_width;
-    int16_t ty = (y - self->top_left_y) % self->height_in_tiles;
-    if (ty < 0) {
-        ty += self->height_in_tiles;
+    if (tiles == NULL || count == 0) {
+        return;
     }
-    tile_area->y1 = ty * self->tile_height;
-    tile_area->y2 = tile_area->y1 + self->tile_height;
+    memcpy(tiles + y * self->width_in_tiles + x, tile_indices, count);
+    _mark_tiles_dirty(self, x, y, count);
+}
 
-    if (self->partial_change) {
-        displayio_area_union(&self->dirty_area, &temp_area, &self->dirty_area);
+void displayio_tilegrid_fill_tiles(displayio_tilegrid_t *self, uint16_t x, uint16_t y, uint16_t count, uint8_t tile_index) {
+    if (tile_index >= self->tiles_in_bitmap) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Tile index out of bounds"));
     }
-
-    self->partial_change = true;
+    uint8_t *tiles = self->tiles;
+    if (self->inline_tiles) {
+        tiles = (uint8_t *)&self->tiles;
+    }
+    if (tiles == NULL || count == 0) {
+        return;
+    }
+    memset(tiles + y * self->width_in_tiles + x, tile_index, count);
+    _mark_tiles_dirty(self, x, y, count);
 }
 
 void common_hal_displayio_tilegrid_set_all_tiles(displayio_tilegrid_t *self, uint8_t tile_index) {
@@ -376,9 +443,109 @@ bool common_hal_displayio_tilegrid_contains(displayio_tilegrid_t *self, uint16_t
 }
 
 void common_hal_displayio_tilegrid_set_top_left(displayio_tilegrid_t *self, uint16_t x, uint16_t y) {
+    uint8_t *tiles = self->tiles;
+    if (self->inline_tiles) {
+        tiles = (uint8_t *)&self->tiles;
+    }
+    uint16_t old_x = self->top_left_x;
+    uint16_t old_y = self->top_left_y;
     self->top_left_x = x;
     self->top_left_y = y;
-    self->full_change = true;
+    if (old_x == x && old_y == y) {
+        return;
+    }
+    if (self->full_change || tiles == NULL || old_x != x) {
+        self->full_change = true;
+        return;
+    }
+    // Vertical scrolling only changes the rows whose content differs from what was shown at the
+    // same position before. Anything already dirty stays dirty because those areas are relative
+    // to the grid rather than to the tiles.
+    displayio_area_t row_area;
+    row_area.x1 = 0;
+    row_area.x2 = self->width_in_tiles * self->tile_width;
+    for (uint16_t row = 0; row < self->height_in_tiles; row++) {
+        const uint8_t *old_row = tiles + ((old_y + row) % self->height_in_tiles) * self->width_in_tiles;
+        const uint8_t *new_row = tiles + ((y + row) % self->height_in_tiles) * self->width_in_tiles;
+        if (memcmp(old_row, new_row, self->width_in_tiles) != 0) {
+            row_area.y1 = row * self->tile_height;
+            row_area.y2 = row_area.y1 + self->tile_height;
+            _add_dirty_area(self, &row_area);
+        }
+    }
+}
+
+// Reads a value from a bitmap row without the bounds checks of common_hal_displayio_bitmap_get_pixel.
+static inline uint32_t _bitmap_row_get(const displayio_bitmap_t *bitmap, const uint32_t *row, int16_t x) {
+    switch (bitmap->bits_per_value) {
+        case 8:
+            return ((const uint8_t *)row)[x];
+        case 16:
+            return ((const uint16_t *)row)[x];
+        case 32:
+            return row[x];
+        default: {
+            uint32_t word = row[x >> bitmap->x_shift];
+            return (word >> (sizeof(uint32_t) * 8 - ((x & bitmap->x_mask) + 1) * bitmap->bits_per_value)) & bitmap->bitmask;
+        }
+    }
+}
+
+// Fills the overlap for an unscaled TileGrid with no flips or transposes that shows an in-memory
+// Bitmap through an opaque Palette. Each tile row run is translated through the palette's cached
+// colors and written directly into the buffer. Returns false if any value had no palette entry.
+STATIC bool _fill_area_untransformed_palette(displayio_tilegrid_t *self, const uint8_t *tiles,
+    const _displayio_colorspace_t *colorspace, const displayio_area_t *area,
+    const displayio_area_t *overlap, uint32_t *mask, uint32_t *buffer) {
+    const displayio_bitmap_t *bitmap = self->bitmap;
+    const displayio_palette_t *palette = self->pixel_shader;
+    const _displayio_color_t *colors = palette->colors;
+    uint16_t area_width = displayio_area_width(area);
+    int16_t start_x = overlap->x1 - self->current_area.x1;
+    int16_t end_x = overlap->x2 - self->current_area.x1;
+    bool opaque = true;
+
+    for (int16_t y = overlap->y1; y < overlap->y2; y++) {
+        int16_t local_y = y - self->current_area.y1;
+        uint32_t tile_row = ((local_y / self->tile_height + self->top_left_y) % self->height_in_tiles) * self->width_in_tiles;
+        uint16_t tile_y = local_y % self->tile_height;
+        uint32_t offset = (y - area->y1) * area_width + (overlap->x1 - area->x1); // in pixels
+
+        int16_t local_x = start_x;
+        while (local_x < end_x) {
+            uint8_t tile = tiles[tile_row + (local_x / self->tile_width + self->top_left_x) % self->width_in_tiles];
+            uint16_t tile_x = local_x % self->tile_width;
+            uint16_t run = self->tile_width - tile_x;
+            if (run > end_x - local_x) {
+                run = end_x - local_x;
+            }
+            int16_t bitmap_x = (tile % self->bitmap_width_in_tiles) * self->tile_width + tile_x;
+            int16_t bitmap_y = (tile / self->bitmap_width_in_tiles) * self->tile_height + tile_y;
+            const uint32_t *row = bitmap->data + bitmap_y * bitmap->stride;
+
+            for (uint16_t i = 0; i < run; i++, offset++) {
+                if ((mask[offset / 32] & (1 << (offset % 32))) != 0) {
+                    continue;
+                }
+                uint32_t value = _bitmap_row_get(bitmap, row, bitmap_x + i);
+                if (value >= palette->color_count) {
+                    opaque = false;
+                    continue;
+                }
+                uint32_t pixel = colors[value].cached_color;
+                mask[offset / 32] |= 1 << (offset % 32);
+                if (colorspace->depth == 16) {
+                    ((uint16_t *)buffer)[offset] = pixel;
+                } else if (colorspace->depth == 32) {
+                    buffer[offset] = pixel;
+                } else {
+                    ((uint8_t *)buffer)[offset] = pixel;
+                }
+            }
+            local_x += run;
+        }
+    }
+    return opaque;
 }
 
 bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
@@ -429,6 +596,19 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     // layers at that point.
     bool full_coverage = displayio_area_equal(area, &overlap);
 
+    if (!flip_x && !flip_y && !self->transpose_xy &&
+        self->absolute_transform->dx == 1 && self->absolute_transform->dy == 1 &&
+        !self->absolute_transform->transpose_xy && self->absolute_transform->scale == 1 &&
+        (colorspace->depth == 8 || colorspace->depth == 16 || colorspace->depth == 32) &&
+        mp_obj_is_type(self->bitmap, &displayio_bitmap_type) &&
+        mp_obj_is_type(self->pixel_shader, &displayio_palette_type) &&
+        displayio_palette_prepare_lut(self->pixel_shader, colorspace)) {
+        if (!_fill_area_untransformed_palette(self, tiles, colorspace, area, &overlap, mask, buffer)) {
+            full_coverage = false;
+        }
+        return full_coverage;
+    }
+
     // TODO(tannewt): Skip coverage tracking if all pixels outside the overlap have already been
     // set and our palette is all opaque.
 
@@ -551,6 +731,21 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     return full_coverage;
 }
 
+bool displayio_tilegrid_is_opaque(displayio_tilegrid_t *self, const _displayio_colorspace_t *colorspace) {
+    if (self->hidden || self->hidden_by_parent ||
+        !mp_obj_is_type(self->bitmap, &displayio_bitmap_type) ||
+        !mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+        return false;
+    }
+    // Every value the bitmap can hold must map to a palette entry and none may be transparent.
+    displayio_bitmap_t *bitmap = self->bitmap;
+    displayio_palette_t *palette = self->pixel_shader;
+    if (bitmap->bits_per_value >= 16 || (1U << bitmap->bits_per_value) > palette->color_count) {
+        return false;
+    }
+    return displayio_palette_prepare_lut(palette, colorspace);
+}
+
 void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self) {
     bool first_draw = self->previous_area.x1 == self->previous_area.x2;
     bool hidden = self->hidden || self->hidden_by_parent;
@@ -578,6 +773,77 @@ void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self) {
     // That way they won't change during a refresh and tear.
 }
 
+// Converts a dirty area relative to the TileGrid into absolute screen coordinates.
+STATIC void _transform_dirty_area(displayio_tilegrid_t *self, displayio_area_t *dirty_area) {
+    int16_t x = self->x;
+    int16_t y = self->y;
+    if (self->absolute_transform->transpose_xy) {
+        int16_t temp = y;
+        y = x;
+        x = temp;
+    }
+    int16_t x1 = dirty_area->x1;
+    int16_t x2 = dirty_area->x2;
+    if (self->flip_x) {
+        x1 = self->pixel_width - x1;
+        x2 = self->pixel_width - x2;
+    }
+    int16_t y1 = dirty_area->y1;
+    int16_t y2 = dirty_area->y2;
+    if (self->flip_y) {
+        y1 = self->pixel_height - y1;
+        y2 = self->pixel_height - y2;
+    }
+    if (self->transpose_xy != self->absolute_transform->transpose_xy) {
+        int16_t temp1 = y1, temp2 = y2;
+        y1 = x1;
+        x1 = temp1;
+        y2 = x2;
+        x2 = temp2;
+    }
+    dirty_area->x1 = self->absolute_transform->x + self->absolute_transform->dx * (x + x1);
+    dirty_area->y1 = self->absolute_transform->y + self->absolute_transform->dy * (y + y1);
+    dirty_area->x2 = self->absolute_transform->x + self->absolute_transform->dx * (x + x2);
+    dirty_area->y2 = self->absolute_transform->y + self->absolute_transform->dy * (y + y2);
+    if (dirty_area->y2 < dirty_area->y1) {
+        int16_t temp = dirty_area->y2;
+        dirty_area->y2 = dirty_area->y1;
+        dirty_area->y1 = temp;
+    }
+    if (dirty_area->x2 < dirty_area->x1) {
+        int16_t temp = dirty_area->x2;
+        dirty_area->x2 = dirty_area->x1;
+        dirty_area->x1 = temp;
+    }
+}
+
+// Returns true if the palette colors changed since the last refresh may be visible. The palette
+// indices in the bitmap are only gathered, with one scan, the first time a palette change needs
+// checking after the bitmap changed.
+STATIC bool _palette_change_visible(displayio_tilegrid_t *self) {
+    displayio_palette_t *palette = self->pixel_shader;
+    if (!mp_obj_is_type(self->bitmap, &displayio_bitmap_type)) {
+        return true;
+    }
+    displayio_bitmap_t *bitmap = self->bitmap;
+    if (!self->palette_usage_valid || self->palette_usage_changes != bitmap->changes) {
+        uint32_t all_indices = 0xffffffff;
+        if (palette->color_count < 32) {
+            all_indices = (1u << palette->color_count) - 1;
+        }
+        uint32_t usage = 0;
+        for (uint16_t y = 0; y < bitmap->height && usage != all_indices; y++) {
+            for (uint16_t x = 0; x < bitmap->width; x++) {
+                usage |= 1u << (common_hal_displayio_bitmap_get_pixel(bitmap, x, y) % 32);
+            }
+        }
+        self->palette_usage = usage;
+        self->palette_usage_changes = bitmap->changes;
+        self->palette_usage_valid = true;
+    }
+    return (self->palette_usage & displayio_palette_get_dirty_indices(palette)) != 0;
+}
+
 displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *self, displayio_area_t *tail) {
     bool first_draw = self->previous_area.x1 == self->previous_area.x2;
     bool hidden = self->hidden || self->hidden_by_parent;
@@ -591,10 +857,10 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
             return tail;
         }
     } else if (self->moved && !first_draw) {
-        displayio_area_union(&self->previous_area, &self->current_area, &self->dirty_area);
-        if (displayio_area_size(&self->dirty_area) <= 2U * self->pixel_width * self->pixel_height) {
-            self->dirty_area.next = tail;
-            return &self->dirty_area;
+        displayio_area_union(&self->previous_area, &self->current_area, &self->dirty_area[0]);
+        if (displayio_area_size(&self->dirty_area[0]) <= 2U * self->pixel_width * self->pixel_height) {
+            self->dirty_area[0].next = tail;
+            return &self->dirty_area[0];
         }
         self->previous_area.next = tail;
         self->current_area.next = &self->previous_area;
@@ -608,8 +874,8 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
             // Special case a TileGrid that shows a full bitmap and use its
             // dirty area. Copy it to ours so we can transform it.
             if (self->tiles_in_bitmap == 1) {
-                displayio_area_copy(refresh_area, &self->dirty_area);
-                self->partial_change = true;
+                self->partial_change = false;
+                _add_dirty_area(self, refresh_area);
             } else {
                 self->full_change = true;
             }
@@ -618,7 +884,8 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
 
     self->full_change = self->full_change ||
         (mp_obj_is_type(self->pixel_shader, &displayio_palette_type) &&
-            displayio_palette_needs_refresh(self->pixel_shader)) ||
+            displayio_palette_needs_refresh(self->pixel_shader) &&
+            _palette_change_visible(self)) ||
         (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type) &&
             displayio_colorconverter_needs_refresh(self->pixel_shader));
     if (self->full_change || first_draw) {
@@ -627,49 +894,11 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
     }
 
     if (self->partial_change) {
-        int16_t x = self->x;
-        int16_t y = self->y;
-        if (self->absolute_transform->transpose_xy) {
-            int16_t temp = y;
-            y = x;
-            x = temp;
+        for (uint8_t i = 0; i < self->dirty_area_count; i++) {
+            _transform_dirty_area(self, &self->dirty_area[i]);
+            self->dirty_area[i].next = tail;
+            tail = &self->dirty_area[i];
         }
-        int16_t x1 = self->dirty_area.x1;
-        int16_t x2 = self->dirty_area.x2;
-        if (self->flip_x) {
-            x1 = self->pixel_width - x1;
-            x2 = self->pixel_width - x2;
-        }
-        int16_t y1 = self->dirty_area.y1;
-        int16_t y2 = self->dirty_area.y2;
-        if (self->flip_y) {
-            y1 = self->pixel_height - y1;
-            y2 = self->pixel_height - y2;
-        }
-        if (self->transpose_xy != self->absolute_transform->transpose_xy) {
-            int16_t temp1 = y1, temp2 = y2;
-            y1 = x1;
-            x1 = temp1;
-            y2 = x2;
-            x2 = temp2;
-        }
-        self->dirty_area.x1 = self->absolute_transform->x + self->absolute_transform->dx * (x + x1);
-        self->dirty_area.y1 = self->absolute_transform->y + self->absolute_transform->dy * (y + y1);
-        self->dirty_area.x2 = self->absolute_transform->x + self->absolute_transform->dx * (x + x2);
-        self->dirty_area.y2 = self->absolute_transform->y + self->absolute_transform->dy * (y + y2);
-        if (self->dirty_area.y2 < self->dirty_area.y1) {
-            int16_t temp = self->dirty_area.y2;
-            self->dirty_area.y2 = self->dirty_area.y1;
-            self->dirty_area.y1 = temp;
-        }
-        if (self->dirty_area.x2 < self->dirty_area.x1) {
-            int16_t temp = self->dirty_area.x2;
-            self->dirty_area.x2 = self->dirty_area.x1;
-            self->dirty_area.x1 = temp;
-        }
-
-        self->dirty_area.next = tail;
-        return &self->dirty_area;
     }
     return tail;
 }
@@ -52,10 +52,17 @@ typedef struct {
     uint16_t top_left_x;
     uint16_t top_left_y;
     uint8_t *tiles;
+    uint8_t dirty_area_count;
     const displayio_buffer_transform_t *absolute_transform;
-    displayio_area_t dirty_area; // Stored as a relative area until the refresh area is fetched.
+    // Stored as relative areas until the refresh areas are fetched. Only the first
+    // dirty_area_count are valid.
+    displayio_area_t dirty_area[CIRCUITPY_TILEGRID_DIRTY_AREAS];
     displayio_area_t previous_area; // Stored as an absolute area.
     displayio_area_t current_area; // Stored as an absolute area so it applies across frames.
+    // Palette indices present in the bitmap, folded into 32 bits like a palette's dirty indices.
+    // Valid while palette_usage_valid is set and the bitmap's change count matches.
+    uint32_t palette_usage;
+    uint32_t palette_usage_changes;
     bool partial_change : 1;
     bool full_change : 1;
     bool moved : 1;
@@ -67,11 +74,17 @@ typedef struct {
     bool hidden : 1;
     bool hidden_by_parent : 1;
     bool rendered_hidden : 1;
-    uint8_t padding : 6;
+    bool palette_usage_valid : 1;
+    uint8_t padding : 5;
 } displayio_tilegrid_t;
 
 void displayio_tilegrid_set_hidden_by_parent(displayio_tilegrid_t *self, bool hidden);
 
+// Set a run of count tiles in row y starting at x and mark them dirty as one area. The run must
+// not go past the end of the row.
+void displayio_tilegrid_set_tiles(displayio_tilegrid_t *self, uint16_t x, uint16_t y, const uint8_t *tile_indices, uint16_t count);
+void displayio_tilegrid_fill_tiles(displayio_tilegrid_t *self, uint16_t x, uint16_t y, uint16_t count, uint8_t tile_index);
+
 // Updating the screen is a three stage process.
 
 // The first stage is used to determine i
@@ -89,4 +102,8 @@ void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self);
 
 bool displayio_tilegrid_get_rendered_hidden(displayio_tilegrid_t *self);
 
+// Returns true when every pixel of current_area will be drawn opaque in the given colorspace, so
+// that anything underneath it can be skipped.
+bool displayio_tilegrid_is_opaque(displayio_tilegrid_t *self, const _displayio_colorspace_t *colorspace);
+
 #endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_TILEGRID_H
@@ -98,7 +98,28 @@ void displayio_background(void) {
         return;
     }
 
+    // Displays that talk over a bus may share it with each other. Then each bus display
+    // only gets one of its frame times per pass and picks up where it stopped on the
+    // next pass, and the display that goes first rotates, so that one slow refresh
+    // doesn't hold the others back.
+    uint8_t bus_displays = 0;
     for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_LIMIT; i++) {
+        mp_const_obj_t display_type = displays[i].display_base.type;
+        if (false) {
+        #if CIRCUITPY_BUSDISPLAY
+        } else if (display_type == &busdisplay_busdisplay_type) {
+            bus_displays++;
+        #endif
+        #if CIRCUITPY_EPAPERDISPLAY
+        } else if (display_type == &epaperdisplay_epaperdisplay_type) {
+            bus_displays++;
+        #endif
+        }
+    }
+
+    static uint8_t first_display = 0;
+    for (uint8_t n = 0; n < CIRCUITPY_DISPLAY_LIMIT; n++) {
+        uint8_t i = (first_display + n) % CIRCUITPY_DISPLAY_LIMIT;
         mp_const_obj_t display_type = displays[i].display_base.type;
         if (display_type == NULL || display_type == &mp_type_NoneType) {
             // Skip null display.
@@ -107,7 +128,8 @@ void displayio_background(void) {
         if (false) {
         #if CIRCUITPY_BUSDISPLAY
         } else if (display_type == &busdisplay_busdisplay_type) {
-            busdisplay_busdisplay_background(&displays[i].display);
+            busdisplay_busdisplay_obj_t *display = &displays[i].display;
+            busdisplay_busdisplay_background(display, bus_displays > 1 ? display->native_ms_per_frame : 0);
         #endif
         #if CIRCUITPY_FRAMEBUFFERIO
         } else if (display_type == &framebufferio_framebufferdisplay_type) {
@@ -119,7 +141,9 @@ void displayio_background(void) {
         #endif
         }
     }
-
+    if (bus_displays > 1) {
+        first_display = (first_display + 1) % CIRCUITPY_DISPLAY_LIMIT;
+    }
 }
 
 void common_hal_displayio_release_displays(void) {
@@ -131,6 +131,17 @@ bool displayio_area_equal(const displayio_area_t *a, const displayio_area_t *b)
            a->y2 == b->y2;
 }
 
+// Returns true when inner lies entirely within outer. Empty areas are contained by anything.
+bool displayio_area_contains(const displayio_area_t *outer, const displayio_area_t *inner) {
+    if (displayio_area_empty(inner)) {
+        return true;
+    }
+    return inner->x1 >= outer->x1 &&
+           inner->y1 >= outer->y1 &&
+           inner->x2 <= outer->x2 &&
+           inner->y2 <= outer->y2;
+}
+
 // Original and whole must be in the same coordinate space.
 void displayio_area_transform_within(bool mirror_x, bool mirror_y, bool transpose_xy,
     const displayio_area_t *original,
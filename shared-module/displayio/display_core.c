@@ -27,10 +27,13 @@
 #include "shared-module/displayio/display_core.h"
 
 #include "py/gc.h"
+#include "py/objnamedtuple.h"
 #include "py/runtime.h"
+#include "shared-bindings/displayio/DisplayStats.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/time/__init__.h"
 #include "shared-module/displayio/__init__.h"
+#include "supervisor/port.h"
 #include "supervisor/shared/display.h"
 #include "supervisor/shared/tick.h"
 
@@ -53,6 +56,8 @@ void displayio_display_core_construct(displayio_display_core_t *self,
     self->colorspace.dither = false;
     self->current_group = NULL;
     self->last_refresh = 0;
+    memset(&self->stats, 0, sizeof(self->stats));
+    memset(&self->frame_stats, 0, sizeof(self->frame_stats));
 
     supervisor_start_terminal(width, height);
 
@@ -166,6 +171,7 @@ bool displayio_display_core_start_refresh(displayio_display_core_t *self) {
     }
     self->refresh_in_progress = true;
     self->last_refresh = supervisor_ticks_ms64();
+    self->refresh_start_us = displayio_display_core_stats_time_us();
     return true;
 }
 
@@ -174,9 +180,22 @@ void displayio_display_core_finish_refresh(displayio_display_core_t *self) {
         DISPLAYIO_CORE_DEBUG("displayiocore group_finish_refresh\n");
         displayio_group_finish_refresh(self->current_group);
     }
+    displayio_group_discard_bands();
     self->full_refresh = false;
     self->refresh_in_progress = false;
     self->last_refresh = supervisor_ticks_ms64();
+
+    displayio_display_stats_t *stats = &self->stats;
+    stats->frame_us = displayio_display_core_stats_time_us() - self->refresh_start_us;
+    if (stats->frames == 0) {
+        stats->average_frame_us = stats->frame_us;
+    } else {
+        // Moving average over roughly the last eight frames.
+        stats->average_frame_us += ((int32_t)stats->frame_us - (int32_t)stats->average_frame_us) / 8;
+    }
+    stats->frames++;
+    stats->last_frame = self->frame_stats;
+    memset(&self->frame_stats, 0, sizeof(self->frame_stats));
 }
 
 void release_display_core(displayio_display_core_t *self) {
@@ -190,10 +209,54 @@ void displayio_display_core_collect_ptrs(displayio_display_core_t *self) {
 }
 
 bool displayio_display_core_fill_area(displayio_display_core_t *self, displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
-    if (self->current_group != NULL) {
-        return displayio_group_fill_area(self->current_group, &self->colorspace, area, mask, buffer);
+    if (self->current_group == NULL) {
+        return false;
+    }
+    uint64_t start_us = displayio_display_core_stats_time_us();
+    bool full_coverage = displayio_group_fill_area(self->current_group, &self->colorspace, area, mask, buffer);
+    self->frame_stats.fill_us += displayio_display_core_stats_time_us() - start_us;
+    self->frame_stats.pixels += displayio_area_size(area);
+    return full_coverage;
+}
+
+uint64_t displayio_display_core_stats_time_us(void) {
+    uint8_t subticks = 0;
+    uint64_t ticks = port_get_raw_ticks(&subticks);
+    // A tick is 1/1024 s and a subtick 1/32 of that. 1e6 / 1024 is 15625 / 16.
+    return ((ticks * 32 + subticks) * 15625) >> 9;
+}
+
+void displayio_display_core_record_refresh_areas(displayio_display_core_t *self, const displayio_area_t *areas, uint64_t start_us) {
+    self->frame_stats.refresh_areas_us += displayio_display_core_stats_time_us() - start_us;
+    for (const displayio_area_t *area = areas; area != NULL; area = area->next) {
+        self->frame_stats.refresh_areas++;
     }
-    return false;
+}
+
+void displayio_display_core_record_transmit(displayio_display_core_t *self, uint64_t start_us, uint32_t length) {
+    self->frame_stats.transmit_us += displayio_display_core_stats_time_us() - start_us;
+    self->frame_stats.bytes += length;
+}
+
+void displayio_display_core_record_skipped_frame(displayio_display_core_t *self) {
+    self->stats.skipped_frames++;
+}
+
+mp_obj_t displayio_display_core_get_stats(displayio_display_core_t *self) {
+    const displayio_display_stats_t *stats = &self->stats;
+    mp_obj_t items[] = {
+        mp_obj_new_int_from_uint(stats->frames),
+        mp_obj_new_int_from_uint(stats->skipped_frames),
+        mp_obj_new_int_from_uint(stats->frame_us),
+        mp_obj_new_int_from_uint(stats->average_frame_us),
+        mp_obj_new_int_from_uint(stats->last_frame.refresh_areas),
+        mp_obj_new_int_from_uint(stats->last_frame.refresh_areas_us),
+        mp_obj_new_int_from_uint(stats->last_frame.fill_us),
+        mp_obj_new_int_from_uint(stats->last_frame.transmit_us),
+        mp_obj_new_int_from_uint(stats->last_frame.pixels),
+        mp_obj_new_int_from_uint(stats->last_frame.bytes),
+    };
+    return namedtuple_make_new((const mp_obj_type_t *)&displayio_displaystats_type_obj, MP_ARRAY_SIZE(items), 0, items);
 }
 
 bool displayio_display_core_clip_area(displayio_display_core_t *self, const displayio_area_t *area, displayio_area_t *clipped) {
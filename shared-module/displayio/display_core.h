@@ -33,6 +33,25 @@
 
 #define NO_COMMAND 0x100
 
+// Refresh counters that are cheap enough to always keep. Times are in microseconds.
+typedef struct {
+    uint32_t refresh_areas;
+    uint32_t refresh_areas_us; // Finding what changed in the group tree.
+    uint32_t fill_us; // Rendering pixels into the buffer.
+    uint32_t transmit_us; // Sending pixels to the display or framebuffer.
+    uint32_t pixels;
+    uint32_t bytes;
+} displayio_frame_stats_t;
+
+typedef struct {
+    uint32_t frames;
+    // Refreshes that didn't start because another display was using the bus.
+    uint32_t skipped_frames;
+    uint32_t frame_us;
+    uint32_t average_frame_us;
+    displayio_frame_stats_t last_frame;
+} displayio_display_stats_t;
+
 typedef struct {
     displayio_group_t *current_group;
     uint64_t last_refresh;
@@ -43,6 +62,10 @@ typedef struct {
     uint16_t rotation;
     _displayio_colorspace_t colorspace;
 
+    displayio_display_stats_t stats;
+    displayio_frame_stats_t frame_stats; // Collected for the next finish_refresh.
+    uint64_t refresh_start_us;
+
     bool full_refresh; // New group means we need to refresh the whole display.
     bool refresh_in_progress;
 } displayio_display_core_t;
@@ -71,3 +94,13 @@ void displayio_display_core_collect_ptrs(displayio_display_core_t *self);
 bool displayio_display_core_fill_area(displayio_display_core_t *self, displayio_area_t *area, uint32_t *mask, uint32_t *buffer);
 
 bool displayio_display_core_clip_area(displayio_display_core_t *self, const displayio_area_t *area, displayio_area_t *clipped);
+
+// Microsecond clock for the refresh statistics.
+uint64_t displayio_display_core_stats_time_us(void);
+// Records the areas that the group tree traversal started at start_us returned.
+void displayio_display_core_record_refresh_areas(displayio_display_core_t *self, const displayio_area_t *areas, uint64_t start_us);
+// Records sending length bytes, which started at start_us.
+void displayio_display_core_record_transmit(displayio_display_core_t *self, uint64_t start_us, uint32_t length);
+void displayio_display_core_record_skipped_frame(displayio_display_core_t *self);
+// Returns a displayio.DisplayStats snapshot of the counters.
+mp_obj_t displayio_display_core_get_stats(displayio_display_core_t *self);
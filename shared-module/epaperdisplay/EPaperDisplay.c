@@ -96,6 +96,14 @@ void common_hal_epaperdisplay_epaperdisplay_construct(epaperdisplay_epaperdispla
     self->stop_sequence_len = stop_sequence_len;
     self->refresh_sequence = refresh_sequence;
     self->refresh_sequence_len = refresh_sequence_len;
+    self->partial_lut_sequence = NULL;
+    self->partial_lut_sequence_len = 0;
+    self->partial_refresh_sequence = NULL;
+    self->partial_refresh_sequence_len = 0;
+    self->partial_refresh_limit = 0;
+    self->partial_refresh_count = 0;
+    self->partial_refreshing = false;
+    self->partial_lut_loaded = false;
 
     self->busy.base.type = &mp_type_NoneType;
     self->two_byte_sequence_length = two_byte_sequence_length;
@@ -115,6 +123,18 @@ void common_hal_epaperdisplay_epaperdisplay_construct(epaperdisplay_epaperdispla
     common_hal_epaperdisplay_epaperdisplay_set_root_group(self, &circuitpython_splash);
 }
 
+void common_hal_epaperdisplay_epaperdisplay_set_partial_refresh(epaperdisplay_epaperdisplay_obj_t *self,
+    const uint8_t *partial_lut_sequence, uint16_t partial_lut_sequence_len,
+    const uint8_t *partial_refresh_sequence, uint16_t partial_refresh_sequence_len,
+    uint16_t partial_refresh_limit) {
+    self->partial_lut_sequence = partial_lut_sequence;
+    self->partial_lut_sequence_len = partial_lut_sequence_len;
+    self->partial_refresh_sequence = partial_refresh_sequence;
+    self->partial_refresh_sequence_len = partial_refresh_sequence_len;
+    self->partial_refresh_limit = partial_refresh_limit;
+    self->partial_refresh_count = 0;
+}
+
 bool common_hal_epaperdisplay_epaperdisplay_set_root_group(epaperdisplay_epaperdisplay_obj_t *self, displayio_group_t *root_group) {
     return displayio_display_core_set_root_group(&self->core, root_group);
 }
@@ -136,6 +156,17 @@ STATIC const displayio_area_t *epaperdisplay_epaperdisplay_get_refresh_areas(epa
     return first_area;
 }
 
+// True when the next refresh can push only the dirty areas and trigger the partial waveform.
+STATIC bool epaperdisplay_epaperdisplay_use_partial_refresh(epaperdisplay_epaperdisplay_obj_t *self) {
+    if (self->partial_refresh_sequence_len == 0 ||
+        self->core.full_refresh ||
+        self->bus.row_command == NO_COMMAND ||
+        self->acep) {
+        return false;
+    }
+    return self->partial_refresh_limit == 0 || self->partial_refresh_count < self->partial_refresh_limit;
+}
+
 uint16_t common_hal_epaperdisplay_epaperdisplay_get_width(epaperdisplay_epaperdisplay_obj_t *self) {
     return displayio_display_core_get_width(&self->core);
 }
@@ -194,20 +225,31 @@ void epaperdisplay_epaperdisplay_change_refresh_mode_parameters(epaperdisplay_ep
     self->start_sequence = (uint8_t *)start_sequence->buf;
     self->start_sequence_len = start_sequence->len;
     self->milliseconds_per_frame = seconds_per_frame * 1000;
+    // Make the next refresh run the new start sequence.
+    self->partial_lut_loaded = false;
 }
 
-STATIC void epaperdisplay_epaperdisplay_start_refresh(epaperdisplay_epaperdisplay_obj_t *self) {
+STATIC void epaperdisplay_epaperdisplay_start_refresh(epaperdisplay_epaperdisplay_obj_t *self, bool partial) {
     if (!displayio_display_bus_is_free(&self->bus)) {
         // Can't acquire display bus; skip updating this display. Try next display.
         return;
     }
 
-    // run start sequence
-    self->bus.bus_reset(self->bus.bus);
+    // The controller is still awake from the last partial refresh with the partial
+    // waveform loaded so skip straight to writing pixels.
+    if (!partial || !self->partial_lut_loaded) {
+        // run start sequence
+        self->bus.bus_reset(self->bus.bus);
 
-    common_hal_time_delay_ms(self->start_up_time_ms);
+        common_hal_time_delay_ms(self->start_up_time_ms);
 
-    send_command_sequence(self, true, self->start_sequence, self->start_sequence_len);
+        send_command_sequence(self, true, self->start_sequence, self->start_sequence_len);
+        self->partial_lut_loaded = false;
+        if (partial) {
+            send_command_sequence(self, true, self->partial_lut_sequence, self->partial_lut_sequence_len);
+            self->partial_lut_loaded = true;
+        }
+    }
     displayio_display_core_start_refresh(&self->core);
 }
 
@@ -215,6 +257,10 @@ uint32_t common_hal_epaperdisplay_epaperdisplay_get_time_to_refresh(epaperdispla
     if (self->core.last_refresh == 0) {
         return 0;
     }
+    // Partial refreshes are quick and don't wear the panel so they aren't rate limited.
+    if (epaperdisplay_epaperdisplay_use_partial_refresh(self)) {
+        return 0;
+    }
     // Refresh at seconds per frame rate.
     uint32_t elapsed_time = supervisor_ticks_ms64() - self->core.last_refresh;
     if (elapsed_time > self->milliseconds_per_frame) {
@@ -223,20 +269,43 @@ uint32_t common_hal_epaperdisplay_epaperdisplay_get_time_to_refresh(epaperdispla
     return self->milliseconds_per_frame - elapsed_time;
 }
 
-STATIC void epaperdisplay_epaperdisplay_finish_refresh(epaperdisplay_epaperdisplay_obj_t *self) {
+STATIC void epaperdisplay_epaperdisplay_finish_refresh(epaperdisplay_epaperdisplay_obj_t *self, bool partial) {
     // Actually refresh the display now that all pixel RAM has been updated.
-    send_command_sequence(self, false, self->refresh_sequence, self->refresh_sequence_len);
+    if (partial) {
+        send_command_sequence(self, false, self->partial_refresh_sequence, self->partial_refresh_sequence_len);
+        self->partial_refresh_count++;
+    } else {
+        send_command_sequence(self, false, self->refresh_sequence, self->refresh_sequence_len);
+        self->partial_refresh_count = 0;
+    }
 
     supervisor_enable_tick();
     self->refreshing = true;
+    self->partial_refreshing = partial;
 
     displayio_display_core_finish_refresh(&self->core);
 }
 
+STATIC void epaperdisplay_epaperdisplay_refresh_done(epaperdisplay_epaperdisplay_obj_t *self) {
+    supervisor_disable_tick();
+    self->refreshing = false;
+    if (self->partial_refreshing && self->partial_lut_loaded) {
+        // Stay awake so the next partial refresh doesn't need to reload the waveform.
+        return;
+    }
+    self->partial_lut_loaded = false;
+    // Run stop sequence but don't wait for busy because busy is set when sleeping.
+    send_command_sequence(self, false, self->stop_sequence, self->stop_sequence_len);
+}
+
 mp_obj_t common_hal_epaperdisplay_epaperdisplay_get_bus(epaperdisplay_epaperdisplay_obj_t *self) {
     return self->bus.bus;
 }
 
+mp_obj_t common_hal_epaperdisplay_epaperdisplay_get_stats(epaperdisplay_epaperdisplay_obj_t *self) {
+    return displayio_display_core_get_stats(&self->core);
+}
+
 void common_hal_epaperdisplay_epaperdisplay_set_rotation(epaperdisplay_epaperdisplay_obj_t *self, int rotation) {
     bool transposed = (self->core.rotation == 90 || self->core.rotation == 270);
     bool will_transposed = (rotation == 90 || rotation == 270);
@@ -367,8 +436,10 @@ STATIC bool epaperdisplay_epaperdisplay_refresh_area(epaperdisplay_epaperdisplay
                 // Can't acquire display bus; skip the rest of the data. Try next display.
                 return false;
             }
+            uint64_t send_start_us = displayio_display_core_stats_time_us();
             self->bus.send(self->bus.bus, DISPLAY_DATA, self->chip_select, (uint8_t *)buffer, subrectangle_size_bytes);
             displayio_display_bus_end_transaction(&self->bus);
+            displayio_display_core_record_transmit(&self->core, send_start_us, subrectangle_size_bytes);
 
             // TODO(tannewt): Make refresh displays faster so we don't starve other
             // background tasks.
@@ -415,10 +486,7 @@ bool common_hal_epaperdisplay_epaperdisplay_refresh(epaperdisplay_epaperdisplay_
 
     if (self->refreshing && self->busy.base.type == &digitalio_digitalinout_type) {
         if (common_hal_digitalio_digitalinout_get_value(&self->busy) != self->busy_state) {
-            supervisor_disable_tick();
-            self->refreshing = false;
-            // Run stop sequence but don't wait for busy because busy is set when sleeping.
-            send_command_sequence(self, false, self->stop_sequence, self->stop_sequence_len);
+            epaperdisplay_epaperdisplay_refresh_done(self);
         } else {
             return false;
         }
@@ -430,32 +498,48 @@ bool common_hal_epaperdisplay_epaperdisplay_refresh(epaperdisplay_epaperdisplay_
     if (common_hal_epaperdisplay_epaperdisplay_get_time_to_refresh(self) > 0) {
         return false;
     }
+    // Partial refreshes aren't rate limited so wait out the previous refresh when there
+    // is no busy pin to do it above.
+    if (common_hal_epaperdisplay_epaperdisplay_get_busy(self)) {
+        return false;
+    }
     if (!displayio_display_bus_is_free(&self->bus)) {
         // Can't acquire display bus; skip updating this display. Try next display.
+        displayio_display_core_record_skipped_frame(&self->core);
         return false;
     }
+    uint64_t areas_start_us = displayio_display_core_stats_time_us();
     const displayio_area_t *current_area = epaperdisplay_epaperdisplay_get_refresh_areas(self);
+    displayio_display_core_record_refresh_areas(&self->core, current_area, areas_start_us);
     if (current_area == NULL) {
+        displayio_group_discard_bands();
         return true;
     }
+    bool partial = epaperdisplay_epaperdisplay_use_partial_refresh(self);
+    if (self->partial_refresh_sequence_len > 0 && !partial) {
+        // Redraw everything so the full waveform clears the ghosting left by partial refreshes.
+        self->core.area.next = NULL;
+        current_area = &self->core.area;
+    }
     if (self->acep) {
-        epaperdisplay_epaperdisplay_start_refresh(self);
+        epaperdisplay_epaperdisplay_start_refresh(self, false);
         _clean_area(self);
-        epaperdisplay_epaperdisplay_finish_refresh(self);
+        epaperdisplay_epaperdisplay_finish_refresh(self, false);
         while (self->refreshing && !mp_hal_is_interrupted()) {
             RUN_BACKGROUND_TASKS;
         }
     }
     if (mp_hal_is_interrupted()) {
+        displayio_group_discard_bands();
         return false;
     }
 
-    epaperdisplay_epaperdisplay_start_refresh(self);
+    epaperdisplay_epaperdisplay_start_refresh(self, partial);
     while (current_area != NULL) {
         epaperdisplay_epaperdisplay_refresh_area(self, current_area);
         current_area = current_area->next;
     }
-    epaperdisplay_epaperdisplay_finish_refresh(self);
+    epaperdisplay_epaperdisplay_finish_refresh(self, partial);
     return true;
 }
 
@@ -469,10 +553,7 @@ void epaperdisplay_epaperdisplay_background(epaperdisplay_epaperdisplay_obj_t *s
             refresh_done = supervisor_ticks_ms64() - self->core.last_refresh > self->refresh_time;
         }
         if (refresh_done) {
-            supervisor_disable_tick();
-            self->refreshing = false;
-            // Run stop sequence but don't wait for busy because busy is set when sleeping.
-            send_command_sequence(self, false, self->stop_sequence, self->stop_sequence_len);
+            epaperdisplay_epaperdisplay_refresh_done(self);
         }
     }
 }
@@ -487,8 +568,13 @@ void release_epaperdisplay(epaperdisplay_epaperdisplay_obj_t *self) {
         wait_for_busy(self);
         supervisor_disable_tick();
         self->refreshing = false;
+        self->partial_lut_loaded = false;
         // Run stop sequence but don't wait for busy because busy is set when sleeping.
         send_command_sequence(self, false, self->stop_sequence, self->stop_sequence_len);
+    } else if (self->partial_lut_loaded) {
+        // Put the controller to sleep that was left awake after a partial refresh.
+        self->partial_lut_loaded = false;
+        send_command_sequence(self, false, self->stop_sequence, self->stop_sequence_len);
     }
 
     release_display_core(&self->core);
@@ -508,6 +594,8 @@ void epaperdisplay_epaperdisplay_collect_ptrs(epaperdisplay_epaperdisplay_obj_t
     gc_collect_ptr((void *)self->start_sequence);
     gc_collect_ptr((void *)self->stop_sequence);
     gc_collect_ptr((void *)self->refresh_sequence);
+    gc_collect_ptr((void *)self->partial_lut_sequence);
+    gc_collect_ptr((void *)self->partial_refresh_sequence);
 }
 
 size_t maybe_refresh_epaperdisplay(void) {
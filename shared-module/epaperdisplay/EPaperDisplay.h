@@ -42,9 +42,15 @@ typedef struct {
     const uint8_t *start_sequence;
     const uint8_t *stop_sequence;
     const uint8_t *refresh_sequence;
+    const uint8_t *partial_lut_sequence;
+    const uint8_t *partial_refresh_sequence;
     uint16_t start_sequence_len;
     uint16_t stop_sequence_len;
     uint16_t refresh_sequence_len;
+    uint16_t partial_lut_sequence_len;
+    uint16_t partial_refresh_sequence_len;
+    uint16_t partial_refresh_limit;
+    uint16_t partial_refresh_count;
     uint16_t start_up_time_ms;
     uint16_t refresh_time;
     uint16_t write_black_ram_command;
@@ -54,6 +60,9 @@ typedef struct {
     bool black_bits_inverted;
     bool color_bits_inverted;
     bool refreshing;
+    bool partial_refreshing;
+    // The controller was left awake with the partial waveform loaded.
+    bool partial_lut_loaded;
     bool grayscale;
     bool acep;
     bool two_byte_sequence_length;
@@ -28,6 +28,7 @@
 
 #include "shared-bindings/time/__init__.h"
 #include "shared-bindings/floppyio/__init__.h"
+#include "shared-module/floppyio/__init__.h"
 #include "common-hal/floppyio/__init__.h"
 #include "shared-bindings/digitalio/DigitalInOut.h"
 
@@ -42,7 +43,7 @@
 #include "lib/adafruit_floppy/src/mfm_impl.h"
 
 __attribute__((optimize("O3")))
-int common_hal_floppyio_flux_readinto(void *buf, size_t len, digitalio_digitalinout_obj_t *data, digitalio_digitalinout_obj_t *index) {
+int floppyio_flux_readinto_polled(void *buf, size_t len, digitalio_digitalinout_obj_t *data, digitalio_digitalinout_obj_t *index) {
     uint32_t index_mask;
     volatile uint32_t *index_port = common_hal_digitalio_digitalinout_get_reg(index, DIGITALINOUT_REG_READ, &index_mask);
 
@@ -96,6 +97,10 @@ int common_hal_floppyio_flux_readinto(void *buf, size_t len, digitalio_digitalin
     return pulses_ptr - pulses;
 }
 
+MP_WEAK int common_hal_floppyio_flux_readinto(void *buf, size_t len, digitalio_digitalinout_obj_t *data, digitalio_digitalinout_obj_t *index) {
+    return floppyio_flux_readinto_polled(buf, len, data, index);
+}
+
 int common_hal_floppyio_mfm_readinto(void *buf, size_t n_sectors, digitalio_digitalinout_obj_t *data, digitalio_digitalinout_obj_t *index) {
     mfm_io_t io;
     io.index_port = common_hal_digitalio_digitalinout_get_reg(index, DIGITALINOUT_REG_READ, &io.index_mask);
@@ -46,16 +46,19 @@ uint8_t fontio_builtinfont_get_glyph_index(const fontio_builtinfont_t *self, mp_
     if (codepoint >= 0x20 && codepoint <= 0x7e) {
         return codepoint - 0x20;
     }
-    // Do a linear search of the mapping for unicode.
-    const byte *j = self->unicode_characters;
-    uint8_t k = 0;
-    while (j < self->unicode_characters + self->unicode_characters_len) {
-        unichar potential_c = utf8_get_char(j);
-        j = utf8_next_char(j);
+    // Binary search the sorted unicode mapping.
+    size_t lo = 0;
+    size_t hi = self->unicode_characters_len;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        mp_uint_t potential_c = self->unicode_characters[mid];
         if (codepoint == potential_c) {
-            return 0x7f - 0x20 + k;
+            return 0x7f - 0x20 + mid;
+        } else if (codepoint < potential_c) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
         }
-        k++;
     }
     return 0xff;
 }
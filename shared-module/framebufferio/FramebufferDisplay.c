@@ -122,6 +122,10 @@ mp_obj_t common_hal_framebufferio_framebufferdisplay_get_framebuffer(framebuffer
     return self->framebuffer;
 }
 
+mp_obj_t common_hal_framebufferio_framebufferdisplay_get_stats(framebufferio_framebufferdisplay_obj_t *self) {
+    return displayio_display_core_get_stats(&self->core);
+}
+
 STATIC const displayio_area_t *_get_refresh_areas(framebufferio_framebufferdisplay_obj_t *self) {
     if (self->core.full_refresh) {
         self->core.area.next = NULL;
@@ -210,6 +214,7 @@ STATIC bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const di
         uint8_t *src = (uint8_t *)buffer;
         size_t rowsize = (subrectangle.x2 - subrectangle.x1) * self->core.colorspace.depth / 8;
 
+        uint64_t copy_start_us = displayio_display_core_stats_time_us();
         for (uint16_t i = subrectangle.y1; i < subrectangle.y2; i++) {
             assert(dest >= buf && dest < endbuf && dest + rowsize <= endbuf);
             MARK_ROW_DIRTY(i);
@@ -217,6 +222,7 @@ STATIC bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const di
             dest += rowstride;
             src += rowsize;
         }
+        displayio_display_core_record_transmit(&self->core, copy_start_us, rowsize * displayio_area_height(&subrectangle));
 
         // TODO(tannewt): Make refresh displays faster so we don't starve other
         // background tasks.
@@ -233,7 +239,9 @@ STATIC void _refresh_display(framebufferio_framebufferdisplay_obj_t *self) {
         return;
     }
     displayio_display_core_start_refresh(&self->core);
+    uint64_t areas_start_us = displayio_display_core_stats_time_us();
     const displayio_area_t *current_area = _get_refresh_areas(self);
+    displayio_display_core_record_refresh_areas(&self->core, current_area, areas_start_us);
     if (current_area) {
         bool transposed = (self->core.rotation == 90 || self->core.rotation == 270);
         int row_count = transposed ? self->core.width : self->core.height;
@@ -244,7 +252,9 @@ STATIC void _refresh_display(framebufferio_framebufferdisplay_obj_t *self) {
             _refresh_area(self, current_area, dirty_row_bitmask);
             current_area = current_area->next;
         }
+        uint64_t swap_start_us = displayio_display_core_stats_time_us();
         self->framebuffer_protocol->swapbuffers(self->framebuffer, dirty_row_bitmask);
+        displayio_display_core_record_transmit(&self->core, swap_start_us, 0);
     }
     displayio_display_core_finish_refresh(&self->core);
 }
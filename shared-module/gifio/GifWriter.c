@@ -36,7 +36,20 @@
 #include "shared-bindings/displayio/ColorConverter.h"
 #include "shared-bindings/util.h"
 
-#define BLOCK_SIZE (126) // (2^7) - 2 // (DO NOT CHANGE!)
+// The image data uses 7-bit pixels, so codes 0-127 are pixel values and the
+// two after them are the LZW control codes.
+#define LZW_MIN_CODE_SIZE (7)
+#define LZW_CLEAR_CODE (1 << LZW_MIN_CODE_SIZE)
+#define LZW_END_CODE (LZW_CLEAR_CODE + 1)
+#define LZW_FIRST_CODE (LZW_CLEAR_CODE + 2)
+#define LZW_MAX_CODE_SIZE (12)
+
+// Bounds for the number of dictionary hash table entries. The dictionary is
+// cleared once it is 3/4 full, which keeps probe sequences short.
+#define LZW_TABLE_MIN (256)
+#define LZW_TABLE_MAX (4096)
+
+#define DATA_SIZE (512)
 
 static void handle_error(gifio_gifwriter_t *self) {
     if (self->error != 0) {
@@ -56,12 +69,20 @@ static void flush_data(gifio_gifwriter_t *self) {
     }
 }
 
-// These "write" calls _MUST_ have enough buffer space available!  This is
-// ensured by allocating the proper buffer size in construct.
+// Data is staged in a small buffer which is written to the file whenever it
+// fills, so a frame never has to fit in memory all at once. Errors are
+// recorded and raised by handle_error once the caller is done writing.
 static void write_data(gifio_gifwriter_t *self, const void *data, size_t size) {
-    assert(self->cur + size <= self->size);
-    memcpy(self->data + self->cur, data, size);
-    self->cur += size;
+    while (size > 0) {
+        if (self->cur == self->size) {
+            flush_data(self);
+        }
+        size_t chunk = MIN(size, self->size - self->cur);
+        memcpy(self->data + self->cur, data, chunk);
+        self->cur += chunk;
+        data = (const uint8_t *)data + chunk;
+        size -= chunk;
+    }
 }
 
 static void write_byte(gifio_gifwriter_t *self, uint8_t value) {
@@ -76,6 +97,107 @@ static void write_word(gifio_gifwriter_t *self, uint16_t value) {
     write_data(self, &value, sizeof(value));
 }
 
+// Each dictionary entry is packed into one word: the code in the low 12 bits,
+// and the 7-bit pixel and 12-bit prefix code it extends above that. Every
+// code added is at least LZW_FIRST_CODE, so 0 marks an empty slot.
+typedef struct {
+    gifio_gifwriter_t *writer;
+    uint32_t *table;
+    uint32_t table_mask;
+    uint32_t bits;
+    int nbits;
+    int code_size;
+    int next_code;
+    int limit;
+    int prefix;
+    // A data sub-block: a length byte followed by up to 255 bytes
+    uint8_t block[256];
+} lzw_encoder_t;
+
+static void lzw_write_code(lzw_encoder_t *enc, int code) {
+    enc->bits |= (uint32_t)code << enc->nbits;
+    enc->nbits += enc->code_size;
+    while (enc->nbits >= 8) {
+        enc->block[++enc->block[0]] = enc->bits & 0xff;
+        if (enc->block[0] == 255) {
+            write_data(enc->writer, enc->block, 256);
+            enc->block[0] = 0;
+        }
+        enc->bits >>= 8;
+        enc->nbits -= 8;
+    }
+}
+
+static void lzw_clear(lzw_encoder_t *enc) {
+    lzw_write_code(enc, LZW_CLEAR_CODE);
+    memset(enc->table, 0, (enc->table_mask + 1) * sizeof(uint32_t));
+    enc->code_size = LZW_MIN_CODE_SIZE + 1;
+    enc->next_code = LZW_FIRST_CODE;
+}
+
+static void lzw_start(lzw_encoder_t *enc, gifio_gifwriter_t *self) {
+    enc->writer = self;
+    enc->table = self->lzw_table;
+    enc->table_mask = self->lzw_table_size - 1;
+    enc->limit = self->lzw_table_size / 4 * 3;
+    enc->bits = 0;
+    enc->nbits = 0;
+    enc->block[0] = 0;
+    enc->prefix = -1;
+    enc->code_size = LZW_MIN_CODE_SIZE + 1;
+    lzw_clear(enc);
+}
+
+// Emit the current prefix, widening codes at the same point the decoder does.
+static void lzw_write_prefix(lzw_encoder_t *enc) {
+    lzw_write_code(enc, enc->prefix);
+    if (enc->next_code >= (1 << enc->code_size) && enc->code_size < LZW_MAX_CODE_SIZE) {
+        enc->code_size++;
+    }
+}
+
+static inline void lzw_add_pixel(lzw_encoder_t *enc, uint8_t pixel) {
+    if (enc->prefix < 0) {
+        enc->prefix = pixel;
+        return;
+    }
+    uint32_t key = ((uint32_t)enc->prefix << LZW_MIN_CODE_SIZE) | pixel;
+    uint32_t i = (key * 2654435761u) >> 16;
+    for (;;) {
+        i &= enc->table_mask;
+        uint32_t entry = enc->table[i];
+        if (entry == 0) {
+            break;
+        }
+        if ((entry >> LZW_MAX_CODE_SIZE) == key) {
+            enc->prefix = entry & ((1 << LZW_MAX_CODE_SIZE) - 1);
+            return;
+        }
+        i++;
+    }
+    lzw_write_prefix(enc);
+    if (enc->next_code < enc->limit) {
+        enc->table[i] = (key << LZW_MAX_CODE_SIZE) | enc->next_code++;
+    } else {
+        lzw_clear(enc);
+    }
+    enc->prefix = pixel;
+}
+
+static void lzw_finish(lzw_encoder_t *enc) {
+    if (enc->prefix >= 0) {
+        lzw_write_prefix(enc);
+    }
+    lzw_write_code(enc, LZW_END_CODE);
+    if (enc->nbits > 0) {
+        enc->block[++enc->block[0]] = enc->bits & 0xff;
+    }
+    if (enc->block[0] > 0) {
+        write_data(enc->writer, enc->block, enc->block[0] + 1);
+    }
+    write_byte(enc->writer, 0); // block terminator
+}
+
 void shared_module_gifio_gifwriter_construct(gifio_gifwriter_t *self, mp_obj_t *file, int width, int height, displayio_colorspace_t colorspace, bool loop, bool dither, bool own_file) {
     self->file = file;
     self->file_proto = mp_get_stream_raise(file, MP_STREAM_OP_WRITE | MP_STREAM_OP_IOCTL);
@@ -88,9 +210,24 @@ void shared_module_gifio_gifwriter_construct(gifio_gifwriter_t *self, mp_obj_t *
     self->dither = dither;
     self->own_file = own_file;
 
-    size_t nblocks = (width * height + 125) / 126;
-    self->size = nblocks * 128 + 4;
+    self->size = DATA_SIZE;
     self->data = m_malloc(self->size);
+
+    // One frame adds at most one dictionary entry per pixel, so small images
+    // get a smaller table. If memory is short, settle for clearing it more often.
+    size_t table_size = LZW_TABLE_MIN;
+    while (table_size < LZW_TABLE_MAX && table_size / 4 * 3 < (size_t)(width * height) + LZW_FIRST_CODE) {
+        table_size *= 2;
+    }
+    self->lzw_table = m_malloc_maybe(table_size * sizeof(uint32_t));
+    while (self->lzw_table == NULL && table_size > LZW_TABLE_MIN) {
+        table_size /= 2;
+        self->lzw_table = m_malloc_maybe(table_size * sizeof(uint32_t));
+    }
+    if (self->lzw_table == NULL) {
+        self->lzw_table = m_malloc(table_size * sizeof(uint32_t));
+    }
+    self->lzw_table_size = table_size;
     self->cur = 0;
     self->error = 0;
 
@@ -188,82 +325,59 @@ void shared_module_gifio_gifwriter_add_frame(gifio_gifwriter_t *self, const mp_b
     write_data(self, (uint8_t []) {0x00, 0x07}, 2); // 7-bits
 
     int pixel_count = self->width * self->height;
-    int blocks = (pixel_count + BLOCK_SIZE - 1) / BLOCK_SIZE;
 
-    uint8_t *data = self->data + self->cur;
+    lzw_encoder_t enc;
+    lzw_start(&enc, self);
 
     if (self->colorspace == DISPLAYIO_COLORSPACE_L8) {
         mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(pixel_count - 1), false);
 
         uint8_t *pixels = bufinfo->buf;
-        for (int i = 0; i < blocks; i++) {
-            assert(pixel_count >= 0);
-            int block_size = MIN(BLOCK_SIZE, pixel_count);
-            pixel_count -= block_size;
-            *data++ = 1 + block_size;
-            *data++ = 0x80;
-            for (int j = 0; j < block_size; j++) {
-                *data++ = (*pixels++) >> 1;
-            }
+        for (int i = 0; i < pixel_count; i++) {
+            lzw_add_pixel(&enc, (*pixels++) >> 1);
         }
     } else if (!self->dither) {
         mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(2 * pixel_count - 1), false);
 
         uint16_t *pixels = bufinfo->buf;
-        for (int i = 0; i < blocks; i++) {
-            int block_size = MIN(BLOCK_SIZE, pixel_count);
-            pixel_count -= block_size;
-
-            *data++ = 1 + block_size;
-            *data++ = 0x80;
-            for (int j = 0; j < block_size; j++) {
-                int pixel = *pixels++;
-                if (self->byteswap) {
-                    pixel = __builtin_bswap16(pixel);
-                }
-                int red = (pixel >> (11 + (5 - 2))) & 0x3;
-                int green = (pixel >> (5 + (6 - 3))) & 0x7;
-                int blue = (pixel >> (0 + (5 - 2))) & 0x3;
-                *data++ = (red << 5) | (green << 2) | blue;
+        for (int i = 0; i < pixel_count; i++) {
+            int pixel = *pixels++;
+            if (self->byteswap) {
+                pixel = __builtin_bswap16(pixel);
             }
+            int red = (pixel >> (11 + (5 - 2))) & 0x3;
+            int green = (pixel >> (5 + (6 - 3))) & 0x7;
+            int blue = (pixel >> (0 + (5 - 2))) & 0x3;
+            lzw_add_pixel(&enc, (red << 5) | (green << 2) | blue);
         }
     } else {
         mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(2 * pixel_count - 1), false);
 
         uint16_t *pixels = bufinfo->buf;
         int x = 0, y = 0;
-        for (int i = 0; i < blocks; i++) {
-            int block_size = MIN(BLOCK_SIZE, pixel_count);
-            pixel_count -= block_size;
-
-            *data++ = 1 + block_size;
-            *data++ = 0x80;
-            for (int j = 0; j < block_size; j++) {
-                int pixel = *pixels++;
-                if (self->byteswap) {
-                    pixel = __builtin_bswap16(pixel);
-                }
-                int red = (pixel >> 8) & 0xf8;
-                int green = (pixel >> 3) & 0xfc;
-                int blue = (pixel << 3) & 0xf8;
-
-                red = MAX(0, red - rb_bayer[x % 4][y % 4]);
-                green = MAX(0, green - g_bayer[x % 4][(y + 2) % 4]);
-                blue = MAX(0, blue - rb_bayer[(x + 2) % 4][y % 4]);
-                x++;
-                if (x == self->width) {
-                    x = 0;
-                    y++;
-                }
-
-                *data++ = ((red >> 1) & 0x60) | ((green >> 3) & 0x1c) | (blue >> 6);
+        for (int i = 0; i < pixel_count; i++) {
+            int pixel = *pixels++;
+            if (self->byteswap) {
+                pixel = __builtin_bswap16(pixel);
+            }
+            int red = (pixel >> 8) & 0xf8;
+            int green = (pixel >> 3) & 0xfc;
+            int blue = (pixel << 3) & 0xf8;
+
+            red = MAX(0, red - rb_bayer[x % 4][y % 4]);
+            green = MAX(0, green - g_bayer[x % 4][(y + 2) % 4]);
+            blue = MAX(0, blue - rb_bayer[(x + 2) % 4][y % 4]);
+            x++;
+            if (x == self->width) {
+                x = 0;
+                y++;
             }
+
+            lzw_add_pixel(&enc, ((red >> 1) & 0x60) | ((green >> 3) & 0x1c) | (blue >> 6));
         }
     }
 
-    self->cur = data - self->data;
-
-    write_data(self, (uint8_t []) {0x01, 0x81, 0x00}, 3); // end code
+    lzw_finish(&enc);
     flush_data(self);
     handle_error(self);
 }
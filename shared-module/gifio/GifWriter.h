@@ -39,6 +39,8 @@ typedef struct gifio_gifwriter {
     int error;
     uint8_t *data;
     size_t cur, size;
+    uint32_t *lzw_table;
+    size_t lzw_table_size;
     bool own_file;
     bool byteswap;
     bool dither;
@@ -100,14 +100,24 @@ static void GIFDraw(GIFDRAW *pDraw) {
     int32_t row_start = (pDraw->y + pDraw->iY) * bitmap->stride;
     uint32_t *row = bitmap->data + row_start;
 
-    if (pDraw->ucDisposalMethod == 2) { // restore to background color
-        // Not supported currently. Need to reset the area the previous frame occupied
-        // to the background color before the previous frame was drawn
-        // See: https://github.com/bitbank2/AnimatedGIF/issues/3
-
-        // To workaround clear the gif.bitmap object yourself as required.
+    // Remember how to dispose of this frame before the next one is drawn.
+    // Restoring to the background (method 2) is done by next_frame; restoring
+    // to the previous frame (method 3) is not supported.
+    ondiskgif->disposal_method = pDraw->ucDisposalMethod;
+    if (palette != NULL) {
+        ondiskgif->dispose_value = pDraw->ucHasTransparency ? pDraw->ucTransparent : pDraw->ucBackground;
+    } else {
+        ondiskgif->dispose_value = pDraw->pPalette[pDraw->ucBackground];
     }
 
+    displayio_area_t line_area = {
+        .x1 = pDraw->iX,
+        .y1 = pDraw->iY + pDraw->y,
+        .x2 = pDraw->iX + iWidth,
+        .y2 = pDraw->iY + pDraw->y + 1,
+    };
+    displayio_area_union(&ondiskgif->frame_area, &line_area, &ondiskgif->frame_area);
+
     if (palette != NULL) {
         uint8_t *s = pDraw->pPixels;
         uint8_t *d = (uint8_t *)row;
@@ -192,6 +202,9 @@ void common_hal_gifio_ondiskgif_construct(gifio_ondiskgif_t *self, pyb_file_obj_
     displayio_bitmap_t *bitmap = mp_obj_malloc(displayio_bitmap_t, &displayio_bitmap_type);
     common_hal_displayio_bitmap_construct(bitmap, self->gif.iCanvasWidth, self->gif.iCanvasHeight, bpp);
     self->bitmap = bitmap;
+    self->frame_area = (displayio_area_t) {0};
+    self->dispose_area = (displayio_area_t) {0};
+    self->disposal_method = 0;
 
     GIFINFO info;
     GIF_getInfo(&self->gif, &info);
@@ -247,19 +260,33 @@ int32_t common_hal_gifio_ondiskgif_get_max_delay(gifio_ondiskgif_t *self) {
     return self->max_delay;
 }
 
+static void dispose_previous_frame(gifio_ondiskgif_t *self) {
+    displayio_area_t *area = &self->dispose_area;
+    if (self->disposal_method != 2 || displayio_area_empty(area)) {
+        return;
+    }
+    for (int16_t y = area->y1; y < area->y2; y++) {
+        for (int16_t x = area->x1; x < area->x2; x++) {
+            displayio_bitmap_write_pixel(self->bitmap, x, y, self->dispose_value);
+        }
+    }
+}
+
 uint32_t common_hal_gifio_ondiskgif_next_frame(gifio_ondiskgif_t *self, bool setDirty) {
     int nextDelay = 0;
-    int result = 0;
-    result = GIF_playFrame(&self->gif, &nextDelay, self);
 
-    if ((result >= 0) && (setDirty)) {
-        displayio_area_t dirty_area = {
-            .x1 = 0,
-            .y1 = 0,
-            .x2 = self->bitmap->width,
-            .y2 = self->bitmap->height,
-        };
+    dispose_previous_frame(self);
+    // Only the rows and columns the frame actually covers are redrawn, plus
+    // whatever the previous frame's disposal cleared.
+    displayio_area_t dirty_area = self->disposal_method == 2 ? self->dispose_area : (displayio_area_t) {0};
+    self->frame_area = (displayio_area_t) {0};
+    self->disposal_method = 0;
+
+    int result = GIF_playFrame(&self->gif, &nextDelay, self);
 
+    self->dispose_area = self->frame_area;
+    displayio_area_union(&dirty_area, &self->frame_area, &dirty_area);
+    if ((result >= 0) && (setDirty) && !displayio_area_empty(&dirty_area)) {
         displayio_bitmap_set_dirty_area(self->bitmap, &dirty_area);
     }
 
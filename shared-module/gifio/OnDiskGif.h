@@ -48,6 +48,12 @@ typedef struct {
     int32_t frame_count;
     int32_t min_delay;
     int32_t max_delay;
+    // Area of the bitmap written by the frame being decoded, and the area
+    // and disposal of the previous frame to restore before the next one.
+    displayio_area_t frame_area;
+    displayio_area_t dispose_area;
+    uint32_t dispose_value;
+    uint8_t disposal_method;
 } gifio_ondiskgif_t;
 
 #endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_ONDISKGIF_H
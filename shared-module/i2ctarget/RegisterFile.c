@@ -0,0 +1,93 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-module/i2ctarget/RegisterFile.h"
+
+void i2ctarget_register_file_init(i2ctarget_register_file_t *self, mp_obj_t registers_obj,
+    uint8_t *registers, size_t length, uint8_t first_register, bool notify) {
+    self->registers = NULL;
+    self->registers_obj = registers_obj;
+    self->length = length;
+    self->first_register = first_register;
+    self->notify = notify;
+    self->pointer = first_register;
+    self->write_length = 0;
+    self->writes_head = 0;
+    self->writes_tail = 0;
+    // Set last because the interrupt handler checks it.
+    self->registers = registers;
+}
+
+void i2ctarget_register_file_select(i2ctarget_register_file_t *self, uint8_t reg) {
+    i2ctarget_register_file_end(self);
+    self->pointer = reg;
+}
+
+void i2ctarget_register_file_write(i2ctarget_register_file_t *self, uint8_t data) {
+    uint8_t index = self->pointer - self->first_register;
+    if (index < self->length) {
+        if (self->write_length == 0) {
+            self->write_start = self->pointer;
+        }
+        self->registers[index] = data;
+        self->write_length++;
+    }
+    self->pointer++;
+}
+
+uint8_t i2ctarget_register_file_read(i2ctarget_register_file_t *self) {
+    uint8_t index = self->pointer - self->first_register;
+    self->pointer++;
+    if (index < self->length) {
+        return self->registers[index];
+    }
+    return 0xff;
+}
+
+void i2ctarget_register_file_end(i2ctarget_register_file_t *self) {
+    if (self->write_length == 0) {
+        return;
+    }
+    uint8_t next = (self->writes_head + 1) % I2CTARGET_REGISTER_WRITE_QUEUE_LENGTH;
+    // Drop the write when Python has fallen behind.
+    if (self->notify && next != self->writes_tail) {
+        self->writes[self->writes_head].first_register = self->write_start;
+        self->writes[self->writes_head].length = self->write_length;
+        self->writes_head = next;
+    }
+    self->write_length = 0;
+}
+
+bool i2ctarget_register_file_pop_write(i2ctarget_register_file_t *self, uint8_t *first_register, size_t *length) {
+    uint8_t tail = self->writes_tail;
+    if (tail == self->writes_head) {
+        return false;
+    }
+    *first_register = self->writes[tail].first_register;
+    *length = self->writes[tail].length;
+    self->writes_tail = (tail + 1) % I2CTARGET_REGISTER_WRITE_QUEUE_LENGTH;
+    return true;
+}
@@ -0,0 +1,78 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "py/obj.h"
+
+// Register file served from an I2CTarget's interrupt handler, so that the host is answered
+// without waiting for Python.
+
+#define I2CTARGET_REGISTER_WRITE_QUEUE_LENGTH (8)
+
+typedef struct {
+    uint8_t first_register;
+    uint16_t length;
+} i2ctarget_register_write_t;
+
+typedef struct {
+    mp_obj_t registers_obj; // Keeps the buffer alive while it is served.
+    uint8_t *registers;
+    uint16_t length;
+    uint8_t first_register;
+    bool notify;
+    // The register that the next byte is read from or written to. The first byte of each write
+    // from the host sets it.
+    volatile uint8_t pointer;
+    // The registers stored by the write in progress.
+    uint8_t write_start;
+    uint16_t write_length;
+    // Completed writes for Python. The interrupt handler only moves head and Python only tail.
+    i2ctarget_register_write_t writes[I2CTARGET_REGISTER_WRITE_QUEUE_LENGTH];
+    volatile uint8_t writes_head;
+    volatile uint8_t writes_tail;
+} i2ctarget_register_file_t;
+
+// registers may be NULL to stop serving.
+void i2ctarget_register_file_init(i2ctarget_register_file_t *self, mp_obj_t registers_obj,
+    uint8_t *registers, size_t length, uint8_t first_register, bool notify);
+
+static inline bool i2ctarget_register_file_active(i2ctarget_register_file_t *self) {
+    return self->registers != NULL;
+}
+
+// These are called from the interrupt handler.
+void i2ctarget_register_file_select(i2ctarget_register_file_t *self, uint8_t reg);
+void i2ctarget_register_file_write(i2ctarget_register_file_t *self, uint8_t data);
+uint8_t i2ctarget_register_file_read(i2ctarget_register_file_t *self);
+// Call on every start and stop condition to finish the write in progress.
+void i2ctarget_register_file_end(i2ctarget_register_file_t *self);
+
+// Returns false when there are no unreported writes.
+bool i2ctarget_register_file_pop_write(i2ctarget_register_file_t *self, uint8_t *first_register, size_t *length);
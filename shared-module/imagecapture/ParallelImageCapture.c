@@ -29,7 +29,7 @@
 
 // If the continuous-capture mode isn't supported, then this default (weak) implementation will raise exceptions for you
 __attribute__((weak))
-void common_hal_imagecapture_parallelimagecapture_continuous_capture_start(imagecapture_parallelimagecapture_obj_t *self, mp_obj_t buffer1, mp_obj_t buffer2) {
+void common_hal_imagecapture_parallelimagecapture_continuous_capture_start(imagecapture_parallelimagecapture_obj_t *self, size_t n_buffers, const mp_obj_t *buffers) {
     mp_raise_NotImplementedError(MP_ERROR_TEXT("This microcontroller does not support continuous capture."));
 }
 
@@ -42,3 +42,18 @@ __attribute__((weak))
 mp_obj_t common_hal_imagecapture_parallelimagecapture_continuous_capture_get_frame(imagecapture_parallelimagecapture_obj_t *self) {
     mp_raise_NotImplementedError(MP_ERROR_TEXT("This microcontroller does not support continuous capture."));
 }
+
+__attribute__((weak))
+mp_obj_t common_hal_imagecapture_parallelimagecapture_continuous_capture_acquire_frame(imagecapture_parallelimagecapture_obj_t *self, mp_float_t timeout) {
+    mp_raise_NotImplementedError(MP_ERROR_TEXT("This microcontroller does not support continuous capture."));
+}
+
+__attribute__((weak))
+void common_hal_imagecapture_parallelimagecapture_continuous_capture_release_frame(imagecapture_parallelimagecapture_obj_t *self, mp_obj_t frame) {
+    mp_raise_NotImplementedError(MP_ERROR_TEXT("This microcontroller does not support continuous capture."));
+}
+
+__attribute__((weak))
+uint32_t common_hal_imagecapture_parallelimagecapture_get_dropped_frames(imagecapture_parallelimagecapture_obj_t *self) {
+    mp_raise_NotImplementedError(MP_ERROR_TEXT("This microcontroller does not support continuous capture."));
+}
@@ -209,6 +209,7 @@ void common_hal_is31fl3741_framebuffer_refresh(is31fl3741_framebuffer_obj_t *sel
                 }
             }
         }
+        common_hal_is31fl3741_send_leds(self->is31fl3741);
         common_hal_is31fl3741_end_transaction(self->is31fl3741);
     }
 }
@@ -45,6 +45,8 @@ void common_hal_is31fl3741_IS31FL3741_construct(is31fl3741_IS31FL3741_obj_t *sel
 
     self->i2c = i2c;
     self->device_address = addr;
+    self->pwm_sent_valid = false;
+    memset(self->pwm, 0, sizeof(self->pwm));
 }
 
 void common_hal_is31fl3741_IS31FL3741_deinit(is31fl3741_IS31FL3741_obj_t *self) {
@@ -64,12 +66,14 @@ void common_hal_is31fl3741_write(is31fl3741_IS31FL3741_obj_t *is31, const mp_obj
     for (size_t i = 0; i < numBytes; i += 3) {
         uint16_t ridx = mp_obj_get_int(mapping[i]);
         if (ridx != 65535) {
-            common_hal_is31fl3741_set_led(is31, ridx, IS31GammaTable[pixels[i]], 0); // red
-            common_hal_is31fl3741_set_led(is31, mp_obj_get_int(mapping[i + 1]), IS31GammaTable[pixels[i + 1]], 0); // green
-            common_hal_is31fl3741_set_led(is31, mp_obj_get_int(mapping[i + 2]), IS31GammaTable[pixels[i + 2]], 0); // blue
+            common_hal_is31fl3741_queue_led(is31, ridx, IS31GammaTable[pixels[i]]); // red
+            common_hal_is31fl3741_queue_led(is31, mp_obj_get_int(mapping[i + 1]), IS31GammaTable[pixels[i + 1]]); // green
+            common_hal_is31fl3741_queue_led(is31, mp_obj_get_int(mapping[i + 2]), IS31GammaTable[pixels[i + 2]]); // blue
         }
     }
 
+    common_hal_is31fl3741_send_leds(is31);
+
     common_hal_is31fl3741_end_transaction(is31);
 }
 
@@ -116,6 +120,10 @@ void common_hal_is31fl3741_send_reset(is31fl3741_IS31FL3741_obj_t *self) {
     common_hal_is31fl3741_set_page(self, 4);
     uint8_t rst[2] = { 0x3F, 0xAE }; // reset command
     common_hal_busio_i2c_write(self->i2c, self->device_address, rst, 2);
+
+    // Reset clears every PWM register.
+    memset(self->pwm_sent, 0, sizeof(self->pwm_sent));
+    self->pwm_sent_valid = true;
 }
 
 void common_hal_is31fl3741_set_current(is31fl3741_IS31FL3741_obj_t *self, uint8_t current) {
@@ -146,6 +154,59 @@ void common_hal_is31fl3741_set_led(is31fl3741_IS31FL3741_obj_t *self, uint16_t l
     cmd[1] = level;
 
     common_hal_busio_i2c_write(self->i2c, self->device_address, cmd, 2);
+
+    if (page == 0 && led < IS31FL3741_LED_COUNT) {
+        self->pwm[led] = level;
+        self->pwm_sent[led] = level;
+    }
+}
+
+void common_hal_is31fl3741_queue_led(is31fl3741_IS31FL3741_obj_t *self, uint16_t led, uint8_t level) {
+    if (led < IS31FL3741_LED_COUNT) {
+        self->pwm[led] = level;
+    }
+}
+
+// Gaps of up to this many unchanged registers are sent along with the changes
+// around them, since that is cheaper than starting another write.
+#define IS31FL3741_MAX_GAP (2)
+
+// Send the queued PWM levels that differ from what the chip was last sent.
+// Registers auto-increment, so each run of changes is one write.
+void common_hal_is31fl3741_send_leds(is31fl3741_IS31FL3741_obj_t *self) {
+    uint8_t cmd[1 + IS31FL3741_LEDS_PER_PAGE];
+    bool all = !self->pwm_sent_valid;
+
+    for (uint8_t page = 0; page < 2; page++) {
+        uint16_t first = page * IS31FL3741_LEDS_PER_PAGE;
+        uint16_t end = MIN(first + IS31FL3741_LEDS_PER_PAGE, IS31FL3741_LED_COUNT);
+
+        uint16_t led = first;
+        while (led < end) {
+            if (!all && self->pwm[led] == self->pwm_sent[led]) {
+                led++;
+                continue;
+            }
+            uint16_t start = led;
+            uint16_t last = led;
+            for (led++; led < end && led - last <= IS31FL3741_MAX_GAP; led++) {
+                if (all || self->pwm[led] != self->pwm_sent[led]) {
+                    last = led;
+                }
+            }
+            size_t len = last + 1 - start;
+
+            common_hal_is31fl3741_set_page(self, page);
+            cmd[0] = (uint8_t)(start - first);
+            memcpy(cmd + 1, self->pwm + start, len);
+            common_hal_busio_i2c_write(self->i2c, self->device_address, cmd, len + 1);
+            memcpy(self->pwm_sent + start, self->pwm + start, len);
+
+            led = last + 1;
+        }
+    }
+
+    self->pwm_sent_valid = true;
 }
 
 void common_hal_is31fl3741_draw_pixel(is31fl3741_IS31FL3741_obj_t *self, int16_t x, int16_t y, uint32_t color, uint16_t *mapping, uint8_t display_height) {
@@ -159,8 +220,8 @@ void common_hal_is31fl3741_draw_pixel(is31fl3741_IS31FL3741_obj_t *self, int16_t
         uint16_t gidx = mapping[x1 + 1];
         uint16_t bidx = mapping[x1 + 0];
 
-        common_hal_is31fl3741_set_led(self, ridx, r, 0);
-        common_hal_is31fl3741_set_led(self, gidx, g, 0);
-        common_hal_is31fl3741_set_led(self, bidx, b, 0);
+        common_hal_is31fl3741_queue_led(self, ridx, r);
+        common_hal_is31fl3741_queue_led(self, gidx, g);
+        common_hal_is31fl3741_queue_led(self, bidx, b);
     }
 }
@@ -30,12 +30,20 @@
 #include "lib/protomatter/src/core.h"
 #include "shared-bindings/busio/I2C.h"
 
+#define IS31FL3741_LED_COUNT (351)
+// LEDs 0-179 are on one register page, the rest on the following page.
+#define IS31FL3741_LEDS_PER_PAGE (180)
+
 extern const mp_obj_type_t is31fl3741_is31fl3741_type;
 typedef struct {
     mp_obj_base_t base;
     busio_i2c_obj_t *i2c;
     busio_i2c_obj_t inline_i2c;
     uint8_t device_address;
+    bool pwm_sent_valid;
+    // PWM levels to show, and the levels the chip was last sent.
+    uint8_t pwm[IS31FL3741_LED_COUNT];
+    uint8_t pwm_sent[IS31FL3741_LED_COUNT];
 } is31fl3741_IS31FL3741_obj_t;
 
 // Gamma correction table
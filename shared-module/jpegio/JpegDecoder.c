@@ -29,6 +29,14 @@
 #include "shared-bindings/jpegio/JpegDecoder.h"
 #include "shared-bindings/bitmaptools/__init__.h"
 #include "shared-module/jpegio/JpegDecoder.h"
+#if CIRCUITPY_BUSDISPLAY
+#include "shared-bindings/busdisplay/BusDisplay.h"
+#include "shared-module/busdisplay/BusDisplay.h"
+#endif
+#if CIRCUITPY_FRAMEBUFFERIO
+#include "shared-bindings/framebufferio/FramebufferDisplay.h"
+#include "shared-module/framebufferio/FramebufferDisplay.h"
+#endif
 
 typedef size_t (*input_func)(JDEC *jd, uint8_t *dest, size_t len);
 
@@ -230,3 +238,213 @@ void common_hal_jpegio_jpegdecoder_decode_into(
         check_jresult(result);
     }
 }
+
+#if CIRCUITPY_BUSDISPLAY || CIRCUITPY_FRAMEBUFFERIO
+// Map a pixel in display (rotated) coordinates to native display memory coordinates.
+static void display_native_xy(const displayio_buffer_transform_t *transform, int x, int y, int *native_x, int *native_y) {
+    if (transform->transpose_xy) {
+        int tmp = x;
+        x = y;
+        y = tmp;
+    }
+    *native_x = transform->dx > 0 ? transform->x + x : transform->x - x - 1;
+    *native_y = transform->dy > 0 ? transform->y + y : transform->y - y - 1;
+}
+
+static void display_native_area(const displayio_buffer_transform_t *transform, const displayio_area_t *area, displayio_area_t *native) {
+    int ax, ay, bx, by;
+    display_native_xy(transform, area->x1, area->y1, &ax, &ay);
+    display_native_xy(transform, area->x2 - 1, area->y2 - 1, &bx, &by);
+    native->x1 = MIN(ax, bx);
+    native->y1 = MIN(ay, by);
+    native->x2 = MAX(ax, bx) + 1;
+    native->y2 = MAX(ay, by) + 1;
+    native->next = NULL;
+}
+
+// Send the buffered MCU row, if any, to the display.
+static void display_flush_strip(jpegio_jpegdecoder_obj_t *self) {
+    if (self->strip_top < 0) {
+        return;
+    }
+    self->strip_top = -1;
+    #if CIRCUITPY_BUSDISPLAY
+    if (mp_obj_is_type(self->dest_display, &busdisplay_busdisplay_type)) {
+        busdisplay_busdisplay_obj_t *display = MP_OBJ_TO_PTR(self->dest_display);
+        uint32_t length = displayio_area_size(&self->strip_area) * sizeof(uint16_t);
+        if (!busdisplay_busdisplay_send_area(display, &self->strip_area, (uint8_t *)self->strip, length)) {
+            mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q in use"), MP_QSTR_bus);
+        }
+    }
+    #endif
+}
+
+static int display_output(JDEC *jd, void *data, JRECT *rect) {
+    jpegio_jpegdecoder_obj_t *self = CONTAINER_OF(jd, jpegio_jpegdecoder_obj_t, decoder);
+    const displayio_buffer_transform_t *transform = &self->dest_core->transform;
+    const displayio_area_t *dest = &self->dest_area;
+
+    // Destination rows covered by this MCU row; past the bottom nothing more can be drawn.
+    int row_y1 = self->y + rect->top - self->lim.y1;
+    int row_y2 = row_y1 + (rect->bottom - rect->top + 1);
+    if (row_y1 >= dest->y2 || rect->top >= self->lim.y2) {
+        display_flush_strip(self);
+        return DECODER_INTERRUPT;
+    }
+    row_y1 = MAX(row_y1, dest->y1);
+    row_y2 = MIN(row_y2, dest->y2);
+
+    int col_x1 = MAX(self->x + rect->left - self->lim.x1, dest->x1);
+    int col_x2 = MIN(self->x + rect->right + 1 - self->lim.x1, dest->x2);
+    if (row_y1 >= row_y2 || col_x1 >= col_x2) {
+        return DECODER_CONTINUE;
+    }
+
+    uint16_t *out;
+    int out_x1, out_y1, out_stride;
+    if (self->strip) {
+        if (self->strip_top != rect->top) {
+            // First MCU of a new row: the previous row is complete.
+            display_flush_strip(self);
+            displayio_area_t row = { .x1 = dest->x1, .y1 = row_y1, .x2 = dest->x2, .y2 = row_y2 };
+            display_native_area(transform, &row, &self->strip_area);
+            self->strip_top = rect->top;
+        }
+        out = self->strip;
+        out_x1 = self->strip_area.x1;
+        out_y1 = self->strip_area.y1;
+        out_stride = displayio_area_width(&self->strip_area);
+    #if CIRCUITPY_FRAMEBUFFERIO
+    } else {
+        framebufferio_framebufferdisplay_obj_t *display = MP_OBJ_TO_PTR(self->dest_display);
+        out = (uint16_t *)(void *)((uint8_t *)display->bufinfo.buf + display->first_pixel_offset);
+        out_x1 = 0;
+        out_y1 = 0;
+        out_stride = display->row_stride / sizeof(uint16_t);
+    #else
+    } else {
+        return DECODER_INTERRUPT;
+    #endif
+    }
+
+    // tjpgd produces byte-swapped RGB565, which is what 16-bit displays with
+    // reverse_bytes_in_word expect.
+    bool swap = !self->dest_core->colorspace.reverse_bytes_in_word;
+    int src_width = rect->right - rect->left + 1;
+    const uint16_t *src = data;
+    for (int y = row_y1; y < row_y2; y++) {
+        const uint16_t *src_row = src + (y - self->y + self->lim.y1 - rect->top) * src_width;
+        for (int x = col_x1; x < col_x2; x++) {
+            uint16_t pixel = src_row[x - self->x + self->lim.x1 - rect->left];
+            int native_x, native_y;
+            display_native_xy(transform, x, y, &native_x, &native_y);
+            out[(native_y - out_y1) * out_stride + (native_x - out_x1)] = swap ? __builtin_bswap16(pixel) : pixel;
+            if (self->dirty_row_bitmask) {
+                self->dirty_row_bitmask[native_y / 8] |= 1 << (native_y & 7);
+            }
+        }
+    }
+    return DECODER_CONTINUE;
+}
+
+void common_hal_jpegio_jpegdecoder_decode_into_display(
+    jpegio_jpegdecoder_obj_t *self,
+    mp_obj_t display, int scale, int16_t x, int16_t y,
+    bitmaptools_rect_t *lim) {
+    if (self->data_obj == MP_OBJ_NULL) {
+        mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q() without %q()"), MP_QSTR_decode, MP_QSTR_open);
+    }
+
+    displayio_display_core_t *core = NULL;
+    #if CIRCUITPY_BUSDISPLAY
+    if (mp_obj_is_type(display, &busdisplay_busdisplay_type)) {
+        core = &((busdisplay_busdisplay_obj_t *)MP_OBJ_TO_PTR(display))->core;
+    }
+    #endif
+    #if CIRCUITPY_FRAMEBUFFERIO
+    framebufferio_framebufferdisplay_obj_t *framebuffer_display = NULL;
+    if (mp_obj_is_type(display, &framebufferio_framebufferdisplay_type)) {
+        framebuffer_display = MP_OBJ_TO_PTR(display);
+        core = &framebuffer_display->core;
+        framebuffer_display->framebuffer_protocol->get_bufinfo(framebuffer_display->framebuffer, &framebuffer_display->bufinfo);
+        if (!framebuffer_display->bufinfo.buf) {
+            mp_raise_RuntimeError(MP_ERROR_TEXT("Not running"));
+        }
+    }
+    #endif
+    assert(core);
+    if (core->colorspace.depth != 16 || core->colorspace.grayscale) {
+        mp_arg_error_invalid(MP_QSTR_colorspace);
+    }
+
+    self->x = x;
+    self->y = y;
+    self->lim = *lim;
+    self->lim.x2 = MIN(self->lim.x2, self->decoder.width >> scale);
+    self->lim.y2 = MIN(self->lim.y2, self->decoder.height >> scale);
+    self->dest_display = display;
+    self->dest_core = core;
+    self->strip = NULL;
+    self->strip_top = -1;
+    self->dirty_row_bitmask = NULL;
+
+    displayio_area_t wanted = {
+        .x1 = x,
+        .y1 = y,
+        .x2 = x + MAX(0, self->lim.x2 - self->lim.x1),
+        .y2 = y + MAX(0, self->lim.y2 - self->lim.y1),
+    };
+    displayio_area_t whole = {
+        .x1 = 0,
+        .y1 = 0,
+        .x2 = displayio_display_core_get_width(core),
+        .y2 = displayio_display_core_get_height(core),
+    };
+    if (!displayio_area_compute_overlap(&wanted, &whole, &self->dest_area)) {
+        common_hal_jpegio_jpegdecoder_close(self);
+        return;
+    }
+
+    size_t strip_len = 0;
+    size_t dirty_len = 0;
+    #if CIRCUITPY_FRAMEBUFFERIO
+    if (framebuffer_display) {
+        // Pixels go straight into the framebuffer; only track which rows changed.
+        dirty_len = (displayio_area_height(&core->area) + 7) / 8;
+        self->dirty_row_bitmask = m_new(uint8_t, dirty_len);
+        memset(self->dirty_row_bitmask, 0, dirty_len);
+    } else
+    #endif
+    {
+        // One MCU row of the destination, so each row goes out as a single bus transfer.
+        int mcu_height = MAX(1, (self->decoder.msy * 8) >> scale);
+        strip_len = displayio_area_width(&self->dest_area) * mcu_height;
+        self->strip = m_new(uint16_t, strip_len);
+    }
+
+    JRESULT result = jd_decomp(&self->decoder, display_output, scale);
+    if (result == JDR_OK) {
+        display_flush_strip(self);
+    }
+
+    #if CIRCUITPY_FRAMEBUFFERIO
+    if (framebuffer_display) {
+        framebuffer_display->framebuffer_protocol->swapbuffers(framebuffer_display->framebuffer, self->dirty_row_bitmask);
+    }
+    #endif
+
+    if (self->strip) {
+        m_del(uint16_t, self->strip, strip_len);
+        self->strip = NULL;
+    }
+    if (self->dirty_row_bitmask) {
+        m_del(uint8_t, self->dirty_row_bitmask, dirty_len);
+        self->dirty_row_bitmask = NULL;
+    }
+    self->dest_display = MP_OBJ_NULL;
+    common_hal_jpegio_jpegdecoder_close(self);
+    if (result != JDR_INTR) {
+        check_jresult(result);
+    }
+}
+#endif
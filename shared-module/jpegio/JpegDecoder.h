@@ -27,6 +27,8 @@
 #include "py/obj.h"
 #include "lib/tjpgd/src/tjpgd.h"
 #include "shared-module/displayio/Bitmap.h"
+#include "shared-module/displayio/area.h"
+#include "shared-module/displayio/display_core.h"
 
 #define TJPGD_WORKSPACE_SIZE 3500
 
@@ -42,4 +44,13 @@ typedef struct jpegio_jpegdecoder_obj {
     uint32_t skip_source_index, skip_dest_index;
     bool skip_source_index_none, skip_dest_index_none;
     uint8_t scale;
+    // Used when decoding straight to a BusDisplay or FramebufferDisplay
+    // instead of a Bitmap.
+    mp_obj_t dest_display;
+    displayio_display_core_t *dest_core;
+    displayio_area_t dest_area; // In display (rotated) coordinates, clipped to the display
+    uint16_t *strip; // One MCU row of pixels in native display order (BusDisplay only)
+    displayio_area_t strip_area; // Native area covered by strip
+    int16_t strip_top; // Image row of the MCU row held in strip, or -1 if empty
+    uint8_t *dirty_row_bitmask; // FramebufferDisplay only
 } jpegio_jpegdecoder_obj_t;
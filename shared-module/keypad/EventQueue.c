@@ -33,25 +33,51 @@
 #define EVENT_PRESSED (1 << 15)
 #define EVENT_KEY_NUM_MASK ((1 << 15) - 1)
 
+// Each queued event is a packed record: the 16-bit encoded event followed by
+// the 32-bit supervisor.ticks_ms() timestamp. No objects are stored.
+#define EVENT_RECORD_SIZE (sizeof(uint16_t) + sizeof(uint32_t))
+
 void common_hal_keypad_eventqueue_construct(keypad_eventqueue_obj_t *self, size_t max_events) {
-    // Event queue is 16-bit values.
-    ringbuf_alloc(&self->encoded_events, max_events * (sizeof(uint16_t) + sizeof(mp_obj_t)));
+    ringbuf_alloc(&self->encoded_events, max_events * EVENT_RECORD_SIZE);
     self->overflowed = false;
 }
 
+STATIC bool keypad_eventqueue_get_record(keypad_eventqueue_obj_t *self, uint16_t *encoded_event, uint32_t *timestamp) {
+    int encoded = ringbuf_get16(&self->encoded_events);
+    if (encoded == -1) {
+        return false;
+    }
+    *encoded_event = encoded;
+    ringbuf_get_n(&self->encoded_events, (uint8_t *)timestamp, sizeof(*timestamp));
+    return true;
+}
+
 bool common_hal_keypad_eventqueue_get_into(keypad_eventqueue_obj_t *self, keypad_event_obj_t *event) {
-    int encoded_event = ringbuf_get16(&self->encoded_events);
-    if (encoded_event == -1) {
+    uint16_t encoded_event;
+    uint32_t timestamp;
+    if (!keypad_eventqueue_get_record(self, &encoded_event, &timestamp)) {
         return false;
     }
 
-    mp_obj_t ticks;
-    ringbuf_get_n(&self->encoded_events, (uint8_t *)&ticks, sizeof(ticks));
     // "Construct" using the existing event.
-    common_hal_keypad_event_construct(event, encoded_event & EVENT_KEY_NUM_MASK, encoded_event & EVENT_PRESSED, ticks);
+    common_hal_keypad_event_construct(event, encoded_event & EVENT_KEY_NUM_MASK, encoded_event & EVENT_PRESSED, MP_OBJ_NEW_SMALL_INT(timestamp));
     return true;
 }
 
+size_t common_hal_keypad_eventqueue_readinto(keypad_eventqueue_obj_t *self, uint16_t *encoded_events, uint32_t *timestamps, size_t max_count) {
+    size_t count = 0;
+    uint16_t encoded_event;
+    uint32_t timestamp;
+    while (count < max_count && keypad_eventqueue_get_record(self, &encoded_event, &timestamp)) {
+        encoded_events[count] = encoded_event;
+        if (timestamps) {
+            timestamps[count] = timestamp;
+        }
+        count++;
+    }
+    return count;
+}
+
 mp_obj_t common_hal_keypad_eventqueue_get(keypad_eventqueue_obj_t *self) {
     keypad_event_obj_t *event = mp_obj_malloc(keypad_event_obj_t, &keypad_event_type);
     bool result = common_hal_keypad_eventqueue_get_into(self, event);
@@ -76,11 +102,11 @@ void common_hal_keypad_eventqueue_clear(keypad_eventqueue_obj_t *self) {
 }
 
 size_t common_hal_keypad_eventqueue_get_length(keypad_eventqueue_obj_t *self) {
-    return ringbuf_num_filled(&self->encoded_events);
+    return ringbuf_num_filled(&self->encoded_events) / EVENT_RECORD_SIZE;
 }
 
-bool keypad_eventqueue_record(keypad_eventqueue_obj_t *self, mp_uint_t key_number, bool pressed, mp_obj_t timestamp) {
-    if (ringbuf_num_empty(&self->encoded_events) == 0) {
+bool keypad_eventqueue_record(keypad_eventqueue_obj_t *self, mp_uint_t key_number, bool pressed, uint32_t timestamp) {
+    if (ringbuf_num_empty(&self->encoded_events) < EVENT_RECORD_SIZE) {
         // Queue is full. Set the overflow flag. The caller will decide what else to do.
         common_hal_keypad_eventqueue_set_overflowed(self, true);
         return false;
@@ -91,7 +117,7 @@ bool keypad_eventqueue_record(keypad_eventqueue_obj_t *self, mp_uint_t key_numbe
         encoded_event |= EVENT_PRESSED;
     }
     ringbuf_put16(&self->encoded_events, encoded_event);
-    ringbuf_put_n(&self->encoded_events, (uint8_t *)&timestamp, sizeof(mp_obj_t));
+    ringbuf_put_n(&self->encoded_events, (uint8_t *)&timestamp, sizeof(timestamp));
 
     return true;
 }
@@ -37,19 +37,23 @@
 #include "supervisor/port.h"
 #include "supervisor/shared/tick.h"
 
-static void keymatrix_scan_now(void *self_in, mp_obj_t timestamp);
+static void keymatrix_scan_now(void *self_in, uint32_t timestamp);
 static size_t keymatrix_get_key_count(void *self_in);
+static bool keymatrix_idle(void *self_in);
+static void keymatrix_wake(void *self_in);
 
 static keypad_scanner_funcs_t keymatrix_funcs = {
     .scan_now = keymatrix_scan_now,
     .get_key_count = keymatrix_get_key_count,
+    .idle = keymatrix_idle,
+    .wake = keymatrix_wake,
 };
 
 static mp_uint_t row_column_to_key_number(keypad_keymatrix_obj_t *self, mp_uint_t row, mp_uint_t column) {
     return row * self->column_digitalinouts->len + column;
 }
 
-void common_hal_keypad_keymatrix_construct(keypad_keymatrix_obj_t *self, mp_uint_t num_row_pins, const mcu_pin_obj_t *row_pins[], mp_uint_t num_column_pins, const mcu_pin_obj_t *column_pins[], bool columns_to_anodes, mp_float_t interval, size_t max_events) {
+void common_hal_keypad_keymatrix_construct(keypad_keymatrix_obj_t *self, mp_uint_t num_row_pins, const mcu_pin_obj_t *row_pins[], mp_uint_t num_column_pins, const mcu_pin_obj_t *column_pins[], bool columns_to_anodes, mp_float_t interval, size_t max_events, bool interrupt_driven) {
 
     mp_obj_t row_dios[num_row_pins];
     for (size_t row = 0; row < num_row_pins; row++) {
@@ -76,6 +80,7 @@ void common_hal_keypad_keymatrix_construct(keypad_keymatrix_obj_t *self, mp_uint
     self->previously_pressed = (bool *)m_malloc(sizeof(bool) * num_row_pins * num_column_pins);
 
     self->columns_to_anodes = columns_to_anodes;
+    self->interrupt_driven = interrupt_driven;
     self->funcs = &keymatrix_funcs;
 
     keypad_construct_common((keypad_scanner_obj_t *)self, interval, max_events);
@@ -124,7 +129,53 @@ static size_t keymatrix_get_key_count(void *self_in) {
     return common_hal_keypad_keymatrix_get_column_count(self) * common_hal_keypad_keymatrix_get_row_count(self);
 }
 
-static void keymatrix_scan_now(void *self_in, mp_obj_t timestamp) {
+static const mcu_pin_obj_t *keymatrix_get_column_pin(keypad_keymatrix_obj_t *self, size_t column) {
+    digitalio_digitalinout_obj_t *dio = self->column_digitalinouts->items[column];
+    return dio->pin;
+}
+
+// Return the rows to inputs, the state that keymatrix_scan_now() expects.
+static void keymatrix_release_rows(keypad_keymatrix_obj_t *self) {
+    for (size_t row = 0; row < common_hal_keypad_keymatrix_get_row_count(self); row++) {
+        digitalio_digitalinout_obj_t *row_dio = self->row_digitalinouts->items[row];
+        common_hal_digitalio_digitalinout_set_value(row_dio, self->columns_to_anodes);
+        common_hal_digitalio_digitalinout_switch_to_input(
+            row_dio, self->columns_to_anodes ? PULL_UP : PULL_DOWN);
+    }
+}
+
+// Drive every row at once, so that pressing any key changes its column.
+static bool keymatrix_idle(void *self_in) {
+    keypad_keymatrix_obj_t *self = self_in;
+
+    for (size_t row = 0; row < common_hal_keypad_keymatrix_get_row_count(self); row++) {
+        common_hal_digitalio_digitalinout_switch_to_output(
+            self->row_digitalinouts->items[row], !self->columns_to_anodes, DRIVE_MODE_PUSH_PULL);
+    }
+
+    const size_t column_count = common_hal_keypad_keymatrix_get_column_count(self);
+    for (size_t column = 0; column < column_count; column++) {
+        if (!keypad_pin_change_enable(keymatrix_get_column_pin(self, column), !self->columns_to_anodes)) {
+            while (column-- > 0) {
+                keypad_pin_change_disable(keymatrix_get_column_pin(self, column));
+            }
+            keymatrix_release_rows(self);
+            return false;
+        }
+    }
+    return true;
+}
+
+static void keymatrix_wake(void *self_in) {
+    keypad_keymatrix_obj_t *self = self_in;
+
+    for (size_t column = 0; column < common_hal_keypad_keymatrix_get_column_count(self); column++) {
+        keypad_pin_change_disable(keymatrix_get_column_pin(self, column));
+    }
+    keymatrix_release_rows(self);
+}
+
+static void keymatrix_scan_now(void *self_in, uint32_t timestamp) {
     keypad_keymatrix_obj_t *self = self_in;
 
     // On entry, all pins are set to inputs with a pull-up or pull-down,
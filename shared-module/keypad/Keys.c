@@ -36,15 +36,19 @@
 #include "supervisor/port.h"
 #include "supervisor/shared/tick.h"
 
-static void keypad_keys_scan_now(void *self_in, mp_obj_t timestamp);
+static void keypad_keys_scan_now(void *self_in, uint32_t timestamp);
 static size_t keys_get_key_count(void *self_in);
+static bool keys_idle(void *self_in);
+static void keys_wake(void *self_in);
 
 static keypad_scanner_funcs_t keys_funcs = {
     .scan_now = keypad_keys_scan_now,
     .get_key_count = keys_get_key_count,
+    .idle = keys_idle,
+    .wake = keys_wake,
 };
 
-void common_hal_keypad_keys_construct(keypad_keys_obj_t *self, mp_uint_t num_pins, const mcu_pin_obj_t *pins[], bool value_when_pressed, bool pull, mp_float_t interval, size_t max_events) {
+void common_hal_keypad_keys_construct(keypad_keys_obj_t *self, mp_uint_t num_pins, const mcu_pin_obj_t *pins[], bool value_when_pressed, bool pull, mp_float_t interval, size_t max_events, bool interrupt_driven) {
     mp_obj_t dios[num_pins];
 
     for (size_t i = 0; i < num_pins; i++) {
@@ -61,6 +65,7 @@ void common_hal_keypad_keys_construct(keypad_keys_obj_t *self, mp_uint_t num_pin
     self->currently_pressed = (bool *)m_malloc(sizeof(bool) * num_pins);
     self->previously_pressed = (bool *)m_malloc(sizeof(bool) * num_pins);
     self->value_when_pressed = value_when_pressed;
+    self->interrupt_driven = interrupt_driven;
     self->funcs = &keys_funcs;
 
     keypad_construct_common((keypad_scanner_obj_t *)self, interval, max_events);
@@ -88,7 +93,36 @@ size_t keys_get_key_count(void *self_in) {
     return self->digitalinouts->len;
 }
 
-static void keypad_keys_scan_now(void *self_in, mp_obj_t timestamp) {
+static const mcu_pin_obj_t *keys_get_pin(keypad_keys_obj_t *self, size_t key_number) {
+    digitalio_digitalinout_obj_t *dio = self->digitalinouts->items[key_number];
+    return dio->pin;
+}
+
+static bool keys_idle(void *self_in) {
+    keypad_keys_obj_t *self = self_in;
+    size_t key_count = keys_get_key_count(self);
+
+    for (size_t key_number = 0; key_number < key_count; key_number++) {
+        if (!keypad_pin_change_enable(keys_get_pin(self, key_number), self->value_when_pressed)) {
+            while (key_number-- > 0) {
+                keypad_pin_change_disable(keys_get_pin(self, key_number));
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
+static void keys_wake(void *self_in) {
+    keypad_keys_obj_t *self = self_in;
+    size_t key_count = keys_get_key_count(self);
+
+    for (size_t key_number = 0; key_number < key_count; key_number++) {
+        keypad_pin_change_disable(keys_get_pin(self, key_number));
+    }
+}
+
+static void keypad_keys_scan_now(void *self_in, uint32_t timestamp) {
     keypad_keys_obj_t *self = self_in;
     size_t key_count = keys_get_key_count(self);
 
@@ -31,13 +31,16 @@
 #include "shared-bindings/keypad/KeyMatrix.h"
 #include "shared-bindings/keypad/ShiftRegisterKeys.h"
 #include "shared-bindings/supervisor/__init__.h"
+#include "supervisor/background_callback.h"
 #include "supervisor/port.h"
 #include "supervisor/shared/lock.h"
 #include "supervisor/shared/tick.h"
 
 supervisor_lock_t keypad_scanners_linked_list_lock;
+static background_callback_t keypad_wake_callback;
 static void keypad_scan_now(keypad_scanner_obj_t *self, uint64_t now);
 static void keypad_scan_maybe(keypad_scanner_obj_t *self, uint64_t now);
+static void keypad_wake(keypad_scanner_obj_t *self);
 
 void keypad_tick(void) {
     // Fast path. Return immediately there are no scanners.
@@ -76,8 +79,14 @@ void keypad_register_scanner(keypad_scanner_obj_t *scanner) {
 
 // Remove scanner from the list of active scanners.
 void keypad_deregister_scanner(keypad_scanner_obj_t *scanner) {
-    // One less request for ticks.
-    supervisor_disable_tick();
+    if (scanner->idle) {
+        // An idle scanner has already given up its request for ticks.
+        scanner->funcs->wake(scanner);
+        scanner->idle = false;
+    } else {
+        // One less request for ticks.
+        supervisor_disable_tick();
+    }
 
     supervisor_acquire_lock(&keypad_scanners_linked_list_lock);
     if (MP_STATE_VM(keypad_scanners_linked_list) == scanner) {
@@ -115,20 +124,76 @@ void keypad_construct_common(keypad_scanner_obj_t *self, mp_float_t interval, si
     keypad_scan_now(self, port_get_raw_ticks(NULL));
 }
 
+// Once all keys are released, stop scanning and wait for a pin change instead.
+static void keypad_maybe_idle(keypad_scanner_obj_t *self) {
+    if (!self->interrupt_driven || self->funcs->idle == NULL) {
+        return;
+    }
+    size_t key_count = common_hal_keypad_generic_get_key_count(self);
+    for (size_t key_number = 0; key_number < key_count; key_number++) {
+        if (self->currently_pressed[key_number]) {
+            return;
+        }
+    }
+    if (!self->funcs->idle(self)) {
+        return;
+    }
+    self->idle = true;
+    // Idle scanners don't need ticks, so the port can sleep between them.
+    supervisor_disable_tick();
+}
+
 static void keypad_scan_now(keypad_scanner_obj_t *self, uint64_t now) {
     self->next_scan_ticks = now + self->interval_ticks;
-    self->funcs->scan_now(self, supervisor_ticks_ms());
+    self->funcs->scan_now(self, supervisor_ticks_ms_raw());
+    keypad_maybe_idle(self);
 }
 
 static void keypad_scan_maybe(keypad_scanner_obj_t *self, uint64_t now) {
-    if (now < self->next_scan_ticks) {
+    if (self->idle || now < self->next_scan_ticks) {
         return;
     }
     keypad_scan_now(self, now);
 }
 
+static void keypad_wake(keypad_scanner_obj_t *self) {
+    if (!self->idle) {
+        return;
+    }
+    self->funcs->wake(self);
+    self->idle = false;
+    supervisor_enable_tick();
+}
+
+static void keypad_wake_idle_scanners(void *unused) {
+    supervisor_acquire_lock(&keypad_scanners_linked_list_lock);
+    uint64_t now = port_get_raw_ticks(NULL);
+    keypad_scanner_obj_t *scanner = MP_STATE_VM(keypad_scanners_linked_list);
+    while (scanner) {
+        if (scanner->idle) {
+            keypad_wake(scanner);
+            // Scan right away so the press is timestamped when it happened.
+            keypad_scan_now(scanner, now);
+        }
+        scanner = scanner->next;
+    }
+    supervisor_release_lock(&keypad_scanners_linked_list_lock);
+}
+
+void keypad_pin_changed_from_isr(void) {
+    background_callback_add(&keypad_wake_callback, keypad_wake_idle_scanners, NULL);
+}
+
+MP_WEAK bool keypad_pin_change_enable(const mcu_pin_obj_t *pin, bool value) {
+    return false;
+}
+
+MP_WEAK void keypad_pin_change_disable(const mcu_pin_obj_t *pin) {
+}
+
 void common_hal_keypad_generic_reset(void *self_in) {
     keypad_scanner_obj_t *self = self_in;
+    keypad_wake(self);
     size_t key_count = common_hal_keypad_generic_get_key_count(self);
     memset(self->previously_pressed, false, key_count);
     memset(self->currently_pressed, false, key_count);
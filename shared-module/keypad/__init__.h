@@ -28,11 +28,16 @@
 #define SHARED_MODULE_KEYPAD_H
 
 #include "py/obj.h"
+#include "common-hal/microcontroller/Pin.h"
 #include "supervisor/shared/lock.h"
 
 typedef struct _keypad_scanner_funcs_t {
-    void (*scan_now)(void *self_in, mp_obj_t timestamp);
+    void (*scan_now)(void *self_in, uint32_t timestamp);
     size_t (*get_key_count)(void *self_in);
+    // Optional. Set up the pins so that any key press interrupts, and return
+    // false if that is not possible. wake() undoes what idle() did.
+    bool (*idle)(void *self_in);
+    void (*wake)(void *self_in);
 } keypad_scanner_funcs_t;
 
 // All scanners must begin with these common fields.
@@ -46,7 +51,9 @@ typedef struct _keypad_scanner_funcs_t {
     bool *previously_pressed; \
     bool *currently_pressed; \
     struct _keypad_eventqueue_obj_t *events; \
-    mp_uint_t interval_ticks
+    mp_uint_t interval_ticks; \
+    bool interrupt_driven; \
+    volatile bool idle
 
 typedef struct _keypad_scanner_obj_t {
     KEYPAD_SCANNER_COMMON_FIELDS;
@@ -64,4 +71,12 @@ void keypad_construct_common(keypad_scanner_obj_t *scanner, mp_float_t interval,
 size_t common_hal_keypad_generic_get_key_count(void *scanner);
 void common_hal_keypad_deinit_core(void *scanner);
 
+// Ports that can interrupt when a pin reads a given value implement these.
+// The weak defaults fail, so interrupt_driven scanners keep polling.
+bool keypad_pin_change_enable(const mcu_pin_obj_t *pin, bool value);
+void keypad_pin_change_disable(const mcu_pin_obj_t *pin);
+// Called from the port's interrupt handler, after it has disabled the
+// interrupt that fired.
+void keypad_pin_changed_from_isr(void);
+
 #endif // SHARED_MODULE_KEYPAD_H
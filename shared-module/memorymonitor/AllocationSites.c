@@ -0,0 +1,155 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/memorymonitor/AllocationSites.h"
+
+#include "py/bc.h"
+#include "py/mpstate.h"
+#include "py/objfun.h"
+#include "py/runtime.h"
+
+#if CIRCUITPY_MEMORYMONITOR_ALLOCATION_SITES
+
+void common_hal_memorymonitor_allocationsites_construct(memorymonitor_allocationsites_obj_t *self, uint32_t sample_every) {
+    self->sample_every = sample_every;
+    common_hal_memorymonitor_allocationsites_clear(self);
+    self->next = NULL;
+    self->previous = NULL;
+}
+
+void common_hal_memorymonitor_allocationsites_pause(memorymonitor_allocationsites_obj_t *self) {
+    *self->previous = self->next;
+    if (self->next != NULL) {
+        self->next->previous = self->previous;
+    }
+    self->next = NULL;
+    self->previous = NULL;
+}
+
+void common_hal_memorymonitor_allocationsites_resume(memorymonitor_allocationsites_obj_t *self) {
+    if (self->previous != NULL) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Already running"));
+    }
+    self->next = MP_STATE_VM(active_allocationsites);
+    self->previous = (memorymonitor_allocationsites_obj_t **)&MP_STATE_VM(active_allocationsites);
+    if (self->next != NULL) {
+        self->next->previous = &self->next;
+    }
+    MP_STATE_VM(active_allocationsites) = self;
+}
+
+void common_hal_memorymonitor_allocationsites_clear(memorymonitor_allocationsites_obj_t *self) {
+    self->site_count = 0;
+    self->dropped = 0;
+    self->until_sample = self->sample_every;
+}
+
+uint16_t common_hal_memorymonitor_allocationsites_get_len(memorymonitor_allocationsites_obj_t *self) {
+    return self->site_count;
+}
+
+const memorymonitor_allocationsite_t *common_hal_memorymonitor_allocationsites_get_item(memorymonitor_allocationsites_obj_t *self, int16_t index) {
+    return &self->sites[index];
+}
+
+uint32_t common_hal_memorymonitor_allocationsites_get_dropped(memorymonitor_allocationsites_obj_t *self) {
+    return self->dropped;
+}
+
+STATIC void record_site(memorymonitor_allocationsites_obj_t *self, qstr source_file, qstr function, size_t line) {
+    for (size_t i = 0; i < self->site_count; i++) {
+        memorymonitor_allocationsite_t *site = &self->sites[i];
+        if (site->line == line && site->function == function && site->source_file == source_file) {
+            site->count++;
+            return;
+        }
+    }
+    if (self->site_count == ALLOCATION_SITES) {
+        self->dropped++;
+        return;
+    }
+    memorymonitor_allocationsite_t *site = &self->sites[self->site_count++];
+    site->source_file = source_file;
+    site->function = function;
+    site->line = line;
+    site->count = 1;
+}
+
+void memorymonitor_allocationsites_track_allocation(size_t block_count) {
+    (void)block_count;
+    memorymonitor_allocationsites_obj_t *as = MP_OBJ_TO_PTR(MP_STATE_VM(active_allocationsites));
+    if (as == NULL) {
+        return;
+    }
+    // Allocations from native code or before the first frame have no site.
+    const mp_code_state_t *code_state = MP_STATE_THREAD(current_code_state);
+    if (code_state == NULL) {
+        return;
+    }
+    // Only decode the line info when some tracker wants this sample.
+    bool sample = false;
+    for (memorymonitor_allocationsites_obj_t *a = as; a != NULL; a = a->next) {
+        if (--a->until_sample == 0) {
+            a->until_sample = a->sample_every;
+            sample = true;
+        }
+    }
+    if (!sample) {
+        return;
+    }
+
+    const mp_obj_fun_bc_t *fun = code_state->fun_bc;
+    const byte *ip = fun->bytecode;
+    MP_BC_PRELUDE_SIG_DECODE(ip);
+    MP_BC_PRELUDE_SIZE_DECODE(ip);
+    const byte *line_info_top = ip + n_info;
+    const byte *bytecode_start = ip + n_info + n_cell;
+    qstr function = mp_decode_uint_value(ip);
+    for (size_t i = 0; i < 1 + n_pos_args + n_kwonly_args; ++i) {
+        ip = mp_decode_uint_skip(ip);
+    }
+    #if MICROPY_EMIT_BYTECODE_USES_QSTR_TABLE
+    function = fun->context->constants.qstr_table[function];
+    qstr source_file = fun->context->constants.qstr_table[0];
+    #else
+    qstr source_file = fun->context->constants.source_file;
+    #endif
+    size_t line = mp_bytecode_get_source_line(ip, line_info_top, code_state->ip - bytecode_start);
+
+    for (; as != NULL; as = as->next) {
+        if (as->until_sample == as->sample_every) {
+            record_site(as, source_file, function, line);
+        }
+    }
+}
+
+void memorymonitor_allocationsites_reset(void) {
+    MP_STATE_VM(active_allocationsites) = NULL;
+}
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t active_allocationsites);
+
+#endif
@@ -0,0 +1,61 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_MEMORYMONITOR_ALLOCATIONSITES_H
+#define MICROPY_INCLUDED_SHARED_MODULE_MEMORYMONITOR_ALLOCATIONSITES_H
+
+#include <stdint.h>
+
+#include "py/obj.h"
+
+typedef struct _memorymonitor_allocationsites_obj_t memorymonitor_allocationsites_obj_t;
+
+#define ALLOCATION_SITES 16
+
+typedef struct {
+    qstr source_file;
+    qstr function;
+    size_t line;
+    uint32_t count;
+} memorymonitor_allocationsite_t;
+
+typedef struct _memorymonitor_allocationsites_obj_t {
+    mp_obj_base_t base;
+    memorymonitor_allocationsite_t sites[ALLOCATION_SITES];
+    uint16_t site_count;
+    // Sampled allocations that didn't fit in sites.
+    uint32_t dropped;
+    uint32_t sample_every;
+    uint32_t until_sample;
+    // Store the location that points to us so we can remove ourselves.
+    memorymonitor_allocationsites_obj_t **previous;
+    memorymonitor_allocationsites_obj_t *next;
+} memorymonitor_allocationsites_obj_t;
+
+void memorymonitor_allocationsites_track_allocation(size_t block_count);
+void memorymonitor_allocationsites_reset(void);
+
+#endif // MICROPY_INCLUDED_SHARED_MODULE_MEMORYMONITOR_ALLOCATIONSITES_H
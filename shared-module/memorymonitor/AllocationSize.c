@@ -65,7 +65,7 @@ uint16_t common_hal_memorymonitor_allocationsize_get_len(memorymonitor_allocatio
 }
 
 size_t common_hal_memorymonitor_allocationsize_get_bytes_per_block(memorymonitor_allocationsize_obj_t *self) {
-    return BYTES_PER_BLOCK;
+    return MICROPY_BYTES_PER_GC_BLOCK;
 }
 
 uint16_t common_hal_memorymonitor_allocationsize_get_item(memorymonitor_allocationsize_obj_t *self, int16_t index) {
@@ -0,0 +1,125 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "shared-bindings/memorymonitor/HeapStats.h"
+
+#include "py/gc.h"
+#include "py/mpstate.h"
+
+// The first word of an allocation is only a type pointer if the allocation is
+// an object, so it can't be dereferenced blindly. Instead, it must either be
+// one of these built-in types or a class on the heap, which we can confirm by
+// its own type.
+STATIC const mp_obj_type_t *const known_types[] = {
+    &mp_type_type,
+    &mp_type_int,
+    &mp_type_str,
+    &mp_type_bytes,
+    &mp_type_bytearray,
+    #if MICROPY_PY_BUILTINS_FLOAT
+    &mp_type_float,
+    #endif
+    &mp_type_tuple,
+    &mp_type_list,
+    &mp_type_dict,
+    #if MICROPY_PY_BUILTINS_SET
+    &mp_type_set,
+    #endif
+    #if MICROPY_PY_BUILTINS_MEMORYVIEW
+    &mp_type_memoryview,
+    #endif
+    #if MICROPY_PY_ARRAY
+    &mp_type_array,
+    #endif
+    &mp_type_fun_bc,
+    &mp_type_gen_instance,
+    &mp_type_module,
+    #if MICROPY_PY_BUILTINS_PROPERTY
+    &mp_type_property,
+    #endif
+    &mp_type_traceback,
+};
+
+STATIC const mp_obj_type_t *allocation_type(void *ptr) {
+    const mp_obj_type_t *type = ((mp_obj_base_t *)ptr)->type;
+    if (gc_ptr_on_heap((void *)type)) {
+        if (((uintptr_t)type & (MICROPY_BYTES_PER_GC_BLOCK - 1)) == 0 &&
+            type->base.type == &mp_type_type) {
+            return type;
+        }
+        return NULL;
+    }
+    for (size_t i = 0; i < MP_ARRAY_SIZE(known_types); i++) {
+        if (type == known_types[i]) {
+            return type;
+        }
+    }
+    return NULL;
+}
+
+STATIC void heapstats_count_type(memorymonitor_heapstats_obj_t *self, const mp_obj_type_t *type, size_t n_blocks) {
+    if (type != NULL) {
+        for (size_t i = 0; i < HEAP_STATS_TYPES; i++) {
+            if (self->types[i] == NULL) {
+                self->types[i] = type;
+            }
+            if (self->types[i] == type) {
+                self->type_blocks[i] += n_blocks;
+                return;
+            }
+        }
+    }
+    self->other_blocks += n_blocks;
+}
+
+STATIC void heapstats_walk(void *env, void *ptr, size_t n_blocks, bool is_free) {
+    memorymonitor_heapstats_obj_t *self = env;
+    if (!is_free) {
+        self->used_blocks += n_blocks;
+        heapstats_count_type(self, allocation_type(ptr), n_blocks);
+        return;
+    }
+    self->free_blocks += n_blocks;
+    if (n_blocks > self->largest_free_blocks) {
+        self->largest_free_blocks = n_blocks;
+    }
+    size_t power_of_two = 0;
+    for (size_t b = n_blocks >> 1; b != 0; b >>= 1) {
+        power_of_two++;
+    }
+    self->free_runs[MIN(power_of_two, HEAP_STATS_FREE_BUCKETS - 1)]++;
+}
+
+void common_hal_memorymonitor_heapstats_construct(memorymonitor_heapstats_obj_t *self) {
+    memset((byte *)self + sizeof(mp_obj_base_t), 0, sizeof(*self) - sizeof(mp_obj_base_t));
+    gc_walk(heapstats_walk, self);
+}
+
+size_t common_hal_memorymonitor_heapstats_get_bytes_per_block(memorymonitor_heapstats_obj_t *self) {
+    return MICROPY_BYTES_PER_GC_BLOCK;
+}
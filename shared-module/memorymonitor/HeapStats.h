@@ -0,0 +1,52 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_MEMORYMONITOR_HEAPSTATS_H
+#define MICROPY_INCLUDED_SHARED_MODULE_MEMORYMONITOR_HEAPSTATS_H
+
+#include <stddef.h>
+
+#include "py/obj.h"
+
+#define HEAP_STATS_FREE_BUCKETS 16
+#define HEAP_STATS_TYPES 16
+
+typedef struct _memorymonitor_heapstats_obj_t {
+    mp_obj_base_t base;
+    size_t free_blocks;
+    size_t used_blocks;
+    size_t largest_free_blocks;
+    // Number of free runs in power of two buckets, like AllocationSize.
+    size_t free_runs[HEAP_STATS_FREE_BUCKETS];
+    // Blocks used by objects of each type, in the order the types were first
+    // seen. Anything past the last slot, or not recognized as an object, is
+    // counted in other_blocks.
+    const mp_obj_type_t *types[HEAP_STATS_TYPES];
+    size_t type_blocks[HEAP_STATS_TYPES];
+    size_t other_blocks;
+} memorymonitor_heapstats_obj_t;
+
+#endif // MICROPY_INCLUDED_SHARED_MODULE_MEMORYMONITOR_HEAPSTATS_H
@@ -26,14 +26,21 @@
 
 #include "shared-module/memorymonitor/__init__.h"
 #include "shared-module/memorymonitor/AllocationAlarm.h"
+#include "shared-module/memorymonitor/AllocationSites.h"
 #include "shared-module/memorymonitor/AllocationSize.h"
 
 void memorymonitor_track_allocation(size_t block_count) {
     memorymonitor_allocationalarms_allocation(block_count);
     memorymonitor_allocationsizes_track_allocation(block_count);
+    #if CIRCUITPY_MEMORYMONITOR_ALLOCATION_SITES
+    memorymonitor_allocationsites_track_allocation(block_count);
+    #endif
 }
 
 void memorymonitor_reset(void) {
     memorymonitor_allocationalarms_reset();
     memorymonitor_allocationsizes_reset();
+    #if CIRCUITPY_MEMORYMONITOR_ALLOCATION_SITES
+    memorymonitor_allocationsites_reset();
+    #endif
 }
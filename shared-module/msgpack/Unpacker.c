@@ -0,0 +1,117 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "py/stream.h"
+
+#include "shared-bindings/msgpack/Unpacker.h"
+#include "shared-module/msgpack/__init__.h"
+
+void common_hal_msgpack_unpacker_construct(msgpack_unpacker_obj_t *self, mp_obj_t stream, size_t read_size,
+    mp_obj_t ext_hook, bool use_list, bool use_memoryview) {
+    if (stream != mp_const_none) {
+        mp_get_stream_raise(stream, MP_STREAM_OP_READ);
+    }
+    self->stream = stream;
+    self->ext_hook = ext_hook;
+    self->read_size = read_size;
+    self->use_list = use_list;
+    self->use_memoryview = use_memoryview;
+    self->alloc = read_size;
+    self->buf = m_new(byte, self->alloc);
+    self->len = 0;
+    self->pos = 0;
+}
+
+// Make room for n more bytes at buf + len.
+STATIC void unpacker_reserve(msgpack_unpacker_obj_t *self, size_t n) {
+    if (self->pos == self->len && !self->use_memoryview) {
+        // Everything has been unpacked, so start over at the beginning.
+        self->pos = 0;
+        self->len = 0;
+    }
+    if (self->alloc - self->len >= n) {
+        return;
+    }
+    size_t pending = self->len - self->pos;
+    size_t alloc = MAX(self->read_size, pending + n);
+    if (alloc < 2 * pending) {
+        alloc = 2 * pending;
+    }
+    // Always move to a new buffer rather than growing this one in place: unpacked
+    // memoryviews may still point into the old one.
+    byte *buf = m_new(byte, alloc);
+    memcpy(buf, self->buf + self->pos, pending);
+    if (!self->use_memoryview) {
+        m_del(byte, self->buf, self->alloc);
+    }
+    self->buf = buf;
+    self->alloc = alloc;
+    self->len = pending;
+    self->pos = 0;
+}
+
+void common_hal_msgpack_unpacker_feed(msgpack_unpacker_obj_t *self, const uint8_t *data, size_t len) {
+    unpacker_reserve(self, len);
+    memcpy(self->buf + self->len, data, len);
+    self->len += len;
+}
+
+// Read up to read_size more bytes from the stream. Returns false if none are available.
+STATIC bool unpacker_fill(msgpack_unpacker_obj_t *self) {
+    const mp_stream_p_t *stream_p = mp_get_stream(self->stream);
+    unpacker_reserve(self, self->read_size);
+    int errcode;
+    mp_uint_t ret = stream_p->read(self->stream, self->buf + self->len, self->read_size, &errcode);
+    if (ret == MP_STREAM_ERROR) {
+        if (mp_is_nonblocking_error(errcode)) {
+            return false;
+        }
+        mp_raise_OSError(errcode);
+    }
+    self->len += ret;
+    return ret > 0;
+}
+
+bool common_hal_msgpack_unpacker_next(msgpack_unpacker_obj_t *self, mp_obj_t *result) {
+    while (true) {
+        if (self->pos < self->len &&
+            shared_module_msgpack_unpack_buffer(self->buf, self->len, &self->pos,
+                self->ext_hook, self->use_list, self->use_memoryview, result)) {
+            return true;
+        }
+        if (self->stream == mp_const_none || !unpacker_fill(self)) {
+            return false;
+        }
+    }
+}
+
+size_t common_hal_msgpack_unpacker_get_in_waiting(msgpack_unpacker_obj_t *self) {
+    return self->len - self->pos;
+}
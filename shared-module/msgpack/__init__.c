@@ -26,6 +26,7 @@
 
 #include <stdio.h>
 #include <inttypes.h>
+#include <string.h>
 
 #include "py/obj.h"
 #include "py/binary.h"
@@ -48,21 +49,42 @@ typedef struct _msgpack_stream_t {
     mp_uint_t (*read)(mp_obj_t obj, void *buf, mp_uint_t size, int *errcode);
     mp_uint_t (*write)(mp_obj_t obj, const void *buf, mp_uint_t size, int *errcode);
     int errcode;
+    // When buf is set, data is read from buf[pos:len] instead of the stream.
+    const byte *buf;
+    size_t pos;
+    size_t len;
+    bool out_of_data;
+    // Return bin payloads as memoryviews into buf instead of copying them.
+    bool use_memoryview;
 } msgpack_stream_t;
 
 STATIC msgpack_stream_t get_stream(mp_obj_t stream_obj, int flags) {
     const mp_stream_p_t *stream_p = mp_get_stream_raise(stream_obj, flags);
-    msgpack_stream_t s = {stream_obj, stream_p->read, stream_p->write, 0};
+    msgpack_stream_t s = {stream_obj, stream_p->read, stream_p->write, 0, NULL, 0, 0, false, false};
     return s;
 }
 
 ////////////////////////////////////////////////////////////////
 // readers
 
+// Check that a buffer being unpacked holds at least size more bytes.
+STATIC void check_available(msgpack_stream_t *s, size_t size) {
+    if (s->len - s->pos < size) {
+        s->out_of_data = true;
+        mp_raise_msg(&mp_type_EOFError, NULL);
+    }
+}
+
 STATIC void read(msgpack_stream_t *s, void *buf, mp_uint_t size) {
     if (size == 0) {
         return;
     }
+    if (s->buf != NULL) {
+        check_available(s, size);
+        memcpy(buf, s->buf + s->pos, size);
+        s->pos += size;
+        return;
+    }
     mp_uint_t ret = s->read(s->stream_obj, buf, size, &s->errcode);
     if (s->errcode != 0) {
         mp_raise_OSError(s->errcode);
@@ -378,6 +400,21 @@ STATIC mp_obj_t unpack_bytes(msgpack_stream_t *s, size_t size) {
     return mp_obj_new_bytes_from_vstr(&vstr);
 }
 
+STATIC mp_obj_t unpack_bin(msgpack_stream_t *s, size_t size) {
+    #if MICROPY_PY_BUILTINS_MEMORYVIEW
+    if (s->use_memoryview) {
+        // The view keeps the whole buffer alive. Its owner never reuses memory that
+        // has been unpacked this way.
+        check_available(s, size);
+        mp_obj_array_t *view = m_new_obj(mp_obj_array_t);
+        mp_obj_memoryview_init(view, BYTEARRAY_TYPECODE, s->pos, size, (void *)s->buf);
+        s->pos += size;
+        return MP_OBJ_FROM_PTR(view);
+    }
+    #endif
+    return unpack_bytes(s, size);
+}
+
 STATIC mp_obj_t unpack_ext(msgpack_stream_t *s, size_t size, mp_obj_t ext_hook) {
     int8_t code = read1(s);
     mp_obj_t data = unpack_bytes(s, size);
@@ -414,7 +451,9 @@ STATIC mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
         size_t len = code & 0b1111;
         mp_obj_dict_t *d = MP_OBJ_TO_PTR(mp_obj_new_dict(len));
         for (size_t i = 0; i < len; i++) {
-            mp_obj_dict_store(d, unpack(s, ext_hook, use_list), unpack(s, ext_hook, use_list));
+            // The key comes first; C doesn't define the order arguments are evaluated in.
+            mp_obj_t key = unpack(s, ext_hook, use_list);
+            mp_obj_dict_store(d, key, unpack(s, ext_hook, use_list));
         }
         return MP_OBJ_FROM_PTR(d);
     }
@@ -429,7 +468,7 @@ STATIC mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
         case 0xc5:
         case 0xc6: {
             // bin 8, 16, 32
-            return unpack_bytes(s, read_size(s, code - 0xc4));
+            return unpack_bin(s, read_size(s, code - 0xc4));
         }
         case 0xcc: // uint8
             return MP_OBJ_NEW_SMALL_INT((uint8_t)read1(s));
@@ -482,7 +521,9 @@ STATIC mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
             size_t len = read_size(s, code - 0xde + 1);
             mp_obj_dict_t *d = MP_OBJ_TO_PTR(mp_obj_new_dict(len));
             for (size_t i = 0; i < len; i++) {
-                mp_obj_dict_store(d, unpack(s, ext_hook, use_list), unpack(s, ext_hook, use_list));
+                // The key comes first; C doesn't define the order arguments are evaluated in.
+                mp_obj_t key = unpack(s, ext_hook, use_list);
+                mp_obj_dict_store(d, key, unpack(s, ext_hook, use_list));
             }
             return MP_OBJ_FROM_PTR(d);
         }
@@ -522,3 +563,19 @@ mp_obj_t common_hal_msgpack_unpack(mp_obj_t stream_obj, mp_obj_t ext_hook, bool
     msgpack_stream_t stream = get_stream(stream_obj, MP_STREAM_OP_READ);
     return unpack(&stream, ext_hook, use_list);
 }
+
+bool shared_module_msgpack_unpack_buffer(const byte *buf, size_t len, size_t *pos, mp_obj_t ext_hook, bool use_list, bool use_memoryview, mp_obj_t *result) {
+    msgpack_stream_t stream = {MP_OBJ_NULL, NULL, NULL, 0, buf, *pos, len, false, use_memoryview};
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        *result = unpack(&stream, ext_hook, use_list);
+        nlr_pop();
+        *pos = stream.pos;
+        return true;
+    }
+    if (stream.out_of_data) {
+        // Incomplete object; anything allocated for it is garbage now.
+        return false;
+    }
+    nlr_jump(nlr.ret_val);
+}
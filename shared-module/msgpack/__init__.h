@@ -31,4 +31,9 @@
 void common_hal_msgpack_pack(mp_obj_t obj, mp_obj_t stream_obj, mp_obj_t default_handler);
 mp_obj_t common_hal_msgpack_unpack(mp_obj_t stream_obj, mp_obj_t ext_hook, bool use_list);
 
+// Unpack one object from buf, starting at *pos. Returns false, leaving *pos alone, if
+// buf ends before the object does. Otherwise stores the object in *result and moves
+// *pos past it.
+bool shared_module_msgpack_unpack_buffer(const byte *buf, size_t len, size_t *pos, mp_obj_t ext_hook, bool use_list, bool use_memoryview, mp_obj_t *result);
+
 #endif
@@ -0,0 +1,122 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-module/nvm/ByteArray.h"
+#include "shared-bindings/nvm/ByteArray.h"
+
+#include <string.h>
+
+#include "py/gc.h"
+#include "py/mpstate.h"
+#include "py/runtime.h"
+
+// Staged bytes cover the whole ByteArray. Only [dirty_start, dirty_end) may differ from flash.
+static uint32_t dirty_start;
+static uint32_t dirty_end;
+
+bool shared_module_nvm_bytearray_staging(const nvm_bytearray_obj_t *self) {
+    return MP_STATE_VM(nvm_staged_bytes) != NULL;
+}
+
+void shared_module_nvm_bytearray_begin(const nvm_bytearray_obj_t *self) {
+    if (shared_module_nvm_bytearray_staging(self)) {
+        return;
+    }
+    uint32_t len = common_hal_nvm_bytearray_get_length(self);
+    uint8_t *staged = m_malloc(len);
+    common_hal_nvm_bytearray_get_bytes(self, 0, len, staged);
+    MP_STATE_VM(nvm_staged_bytes) = staged;
+    dirty_start = len;
+    dirty_end = 0;
+}
+
+// Writes values to flash, leaving out the bytes at either end that already hold their value.
+STATIC bool write_changed_bytes(const nvm_bytearray_obj_t *self,
+    uint32_t start_index, uint8_t *values, uint32_t len) {
+    // Read flash once, into the heap, because some ports read the whole store for each call.
+    uint8_t *current = m_new(uint8_t, len);
+    common_hal_nvm_bytearray_get_bytes(self, start_index, len, current);
+    uint32_t first = 0;
+    while (first < len && current[first] == values[first]) {
+        first++;
+    }
+    uint32_t last = len;
+    while (last > first && current[last - 1] == values[last - 1]) {
+        last--;
+    }
+    m_del(uint8_t, current, len);
+    if (first == last) {
+        return true;
+    }
+    return common_hal_nvm_bytearray_set_bytes(self, start_index + first, values + first, last - first);
+}
+
+bool shared_module_nvm_bytearray_commit(const nvm_bytearray_obj_t *self) {
+    uint8_t *staged = MP_STATE_VM(nvm_staged_bytes);
+    if (staged == NULL) {
+        return true;
+    }
+    bool status = true;
+    if (dirty_start < dirty_end) {
+        status = write_changed_bytes(self, dirty_start, staged + dirty_start, dirty_end - dirty_start);
+    }
+    shared_module_nvm_bytearray_discard(self);
+    return status;
+}
+
+void shared_module_nvm_bytearray_discard(const nvm_bytearray_obj_t *self) {
+    uint8_t *staged = MP_STATE_VM(nvm_staged_bytes);
+    MP_STATE_VM(nvm_staged_bytes) = NULL;
+    gc_free(staged);
+}
+
+bool shared_module_nvm_bytearray_set_bytes(const nvm_bytearray_obj_t *self,
+    uint32_t start_index, uint8_t *values, uint32_t len) {
+    uint8_t *staged = MP_STATE_VM(nvm_staged_bytes);
+    if (staged == NULL) {
+        return write_changed_bytes(self, start_index, values, len);
+    }
+    memcpy(staged + start_index, values, len);
+    dirty_start = MIN(dirty_start, start_index);
+    dirty_end = MAX(dirty_end, start_index + len);
+    return true;
+}
+
+void shared_module_nvm_bytearray_get_bytes(const nvm_bytearray_obj_t *self,
+    uint32_t start_index, uint32_t len, uint8_t *values) {
+    uint8_t *staged = MP_STATE_VM(nvm_staged_bytes);
+    if (staged == NULL) {
+        common_hal_nvm_bytearray_get_bytes(self, start_index, len, values);
+        return;
+    }
+    memcpy(values, staged + start_index, len);
+}
+
+void shared_module_nvm_bytearray_reset(void) {
+    MP_STATE_VM(nvm_staged_bytes) = NULL;
+}
+
+MP_REGISTER_ROOT_POINTER(uint8_t *nvm_staged_bytes);
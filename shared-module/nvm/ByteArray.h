@@ -0,0 +1,49 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "common-hal/nvm/ByteArray.h"
+
+// Writes to an nvm.ByteArray go through here so that they can be staged in RAM between
+// begin() and commit() and so that bytes that already hold their value aren't rewritten.
+
+bool shared_module_nvm_bytearray_staging(const nvm_bytearray_obj_t *self);
+void shared_module_nvm_bytearray_begin(const nvm_bytearray_obj_t *self);
+// Returns false when the port failed to write.
+bool shared_module_nvm_bytearray_commit(const nvm_bytearray_obj_t *self);
+void shared_module_nvm_bytearray_discard(const nvm_bytearray_obj_t *self);
+
+bool shared_module_nvm_bytearray_set_bytes(const nvm_bytearray_obj_t *self,
+    uint32_t start_index, uint8_t *values, uint32_t len);
+void shared_module_nvm_bytearray_get_bytes(const nvm_bytearray_obj_t *self,
+    uint32_t start_index, uint32_t len, uint8_t *values);
+
+// Drops staged changes when the VM ends.
+void shared_module_nvm_bytearray_reset(void);
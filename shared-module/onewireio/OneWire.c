@@ -24,10 +24,18 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "common-hal/microcontroller/Pin.h"
 #include "shared-bindings/onewireio/OneWire.h"
 #include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/digitalio/DigitalInOut.h"
+#include "shared/runtime/interrupt_char.h"
+#include "supervisor/shared/tick.h"
+
+#define ONEWIRE_SEARCH_ROM 0xf0
+#define ONEWIRE_MATCH_ROM 0x55
+#define ONEWIRE_SKIP_ROM 0xcc
 
 // Durations are taken from here: https://www.maximintegrated.com/en/app-notes/index.mvp/id/126
 
@@ -89,3 +97,107 @@ void common_hal_onewireio_onewire_write_bit(onewireio_onewire_obj_t *self,
     common_hal_mcu_delay_us(bit? 64 : 10);
     common_hal_mcu_enable_interrupts();
 }
+
+// Bytes go out least significant bit first. Interrupts are only disabled for
+// each bit, as above.
+
+void common_hal_onewireio_onewire_write(onewireio_onewire_obj_t *self,
+    const uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        for (uint8_t mask = 1; mask != 0; mask <<= 1) {
+            common_hal_onewireio_onewire_write_bit(self, data[i] & mask);
+        }
+    }
+}
+
+void common_hal_onewireio_onewire_readinto(onewireio_onewire_obj_t *self,
+    uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        uint8_t value = 0;
+        for (uint8_t mask = 1; mask != 0; mask <<= 1) {
+            if (common_hal_onewireio_onewire_read_bit(self)) {
+                value |= mask;
+            }
+        }
+        data[i] = value;
+    }
+}
+
+bool common_hal_onewireio_onewire_select(onewireio_onewire_obj_t *self, const uint8_t *rom) {
+    if (common_hal_onewireio_onewire_reset(self)) {
+        return false;
+    }
+    if (rom == NULL) {
+        const uint8_t skip_rom = ONEWIRE_SKIP_ROM;
+        common_hal_onewireio_onewire_write(self, &skip_rom, 1);
+    } else {
+        const uint8_t match_rom = ONEWIRE_MATCH_ROM;
+        common_hal_onewireio_onewire_write(self, &match_rom, 1);
+        common_hal_onewireio_onewire_write(self, rom, ONEWIREIO_ROM_LENGTH);
+    }
+    return true;
+}
+
+bool common_hal_onewireio_onewire_wait_for_ready(onewireio_onewire_obj_t *self, uint32_t timeout_ms) {
+    uint64_t deadline = supervisor_ticks_ms64() + timeout_ms;
+    while (!common_hal_onewireio_onewire_read_bit(self)) {
+        if (supervisor_ticks_ms64() > deadline || mp_hal_is_interrupted()) {
+            return false;
+        }
+        RUN_BACKGROUND_TASKS;
+    }
+    return true;
+}
+
+void common_hal_onewireio_onewire_search_start(onewireio_onewire_search_t *search) {
+    memset(search->rom, 0, sizeof(search->rom));
+    search->last_discrepancy = -1;
+    search->done = false;
+}
+
+// The search algorithm from Maxim application note 187. Each pass follows the
+// zero branch at new discrepancies and the one branch at the last zero branch
+// taken by the previous pass.
+bool common_hal_onewireio_onewire_search_next(onewireio_onewire_obj_t *self,
+    onewireio_onewire_search_t *search) {
+    if (search->done || common_hal_onewireio_onewire_reset(self)) {
+        search->done = true;
+        return false;
+    }
+    const uint8_t search_rom = ONEWIRE_SEARCH_ROM;
+    common_hal_onewireio_onewire_write(self, &search_rom, 1);
+
+    int8_t last_zero = -1;
+    for (int8_t bit = 0; bit < ONEWIREIO_ROM_LENGTH * 8; bit++) {
+        uint8_t *rom_byte = &search->rom[bit / 8];
+        uint8_t mask = 1 << (bit % 8);
+        bool id_bit = common_hal_onewireio_onewire_read_bit(self);
+        bool complement_bit = common_hal_onewireio_onewire_read_bit(self);
+        bool direction;
+        if (id_bit && complement_bit) {
+            // No device answered, which only happens when the bus changes mid-search.
+            search->done = true;
+            return false;
+        } else if (id_bit != complement_bit) {
+            direction = id_bit;
+        } else {
+            if (bit < search->last_discrepancy) {
+                direction = *rom_byte & mask;
+            } else {
+                direction = bit == search->last_discrepancy;
+            }
+            if (!direction) {
+                last_zero = bit;
+            }
+        }
+        if (direction) {
+            *rom_byte |= mask;
+        } else {
+            *rom_byte &= ~mask;
+        }
+        common_hal_onewireio_onewire_write_bit(self, direction);
+    }
+    search->last_discrepancy = last_zero;
+    search->done = last_zero < 0;
+    return true;
+}
@@ -36,4 +36,19 @@ typedef struct {
     digitalio_digitalinout_obj_t pin;
 } onewireio_onewire_obj_t;
 
+#define ONEWIREIO_ROM_LENGTH (8)
+#define ONEWIREIO_SCRATCHPAD_LENGTH (9)
+
+// Function commands shared by the DS18B20 family of temperature sensors.
+#define ONEWIREIO_CONVERT_T (0x44)
+#define ONEWIREIO_READ_SCRATCHPAD (0xbe)
+
+typedef struct {
+    // The last ROM found.
+    uint8_t rom[ONEWIREIO_ROM_LENGTH];
+    // The bit where the last pass took the zero branch, or -1 when there was none.
+    int8_t last_discrepancy;
+    bool done;
+} onewireio_onewire_search_t;
+
 #endif // MICROPY_INCLUDED_SHARED_MODULE_ONEWIREIO_ONEWIRE_H
@@ -33,33 +33,25 @@
 #include "shared-module/qrio/QRDecoder.h"
 
 void shared_module_qrio_qrdecoder_construct(qrdecoder_qrdecoder_obj_t *self, int width, int height) {
+    self->width = width;
+    self->height = height;
     self->quirc = quirc_new();
     quirc_resize(self->quirc, width, height);
 }
 
 int shared_module_qrio_qrdecoder_get_height(qrdecoder_qrdecoder_obj_t *self) {
-    int height;
-    quirc_begin(self->quirc, NULL, &height);
-    return height;
+    return self->height;
 }
 
 int shared_module_qrio_qrdecoder_get_width(qrdecoder_qrdecoder_obj_t *self) {
-    int width;
-    quirc_begin(self->quirc, &width, NULL);
-    return width;
+    return self->width;
 }
 void shared_module_qrio_qrdecoder_set_height(qrdecoder_qrdecoder_obj_t *self, int height) {
-    if (height != shared_module_qrio_qrdecoder_get_height(self)) {
-        int width = shared_module_qrio_qrdecoder_get_width(self);
-        quirc_resize(self->quirc, width, height);
-    }
+    self->height = height;
 }
 
 void shared_module_qrio_qrdecoder_set_width(qrdecoder_qrdecoder_obj_t *self, int width) {
-    if (width != shared_module_qrio_qrdecoder_get_width(self)) {
-        int height = shared_module_qrio_qrdecoder_get_height(self);
-        quirc_resize(self->quirc, width, height);
-    }
+    self->width = width;
 }
 
 STATIC mp_obj_t data_type(int type) {
@@ -98,46 +90,95 @@ STATIC mp_obj_t data_type(int type) {
     return mp_obj_new_int(type);
 }
 
-STATIC void quirc_fill_buffer(qrdecoder_qrdecoder_obj_t *self, void *buf, qrio_pixel_policy_t policy) {
+static inline uint8_t gray_pixel(const uint8_t *src, qrio_pixel_policy_t policy, size_t i) {
+    switch (policy) {
+        case QRIO_RGB565:
+            return (((const uint16_t *)src)[i] >> 3) & 0xfc;
+        case QRIO_RGB565_SWAPPED:
+            return (__builtin_bswap16(((const uint16_t *)src)[i]) >> 3) & 0xfc;
+        case QRIO_EVERY_BYTE:
+            return src[i];
+        case QRIO_ODD_BYTES:
+            return src[2 * i + 1];
+        case QRIO_EVEN_BYTES:
+        default:
+            return src[2 * i];
+    }
+}
+
+STATIC void quirc_fill_buffer(qrdecoder_qrdecoder_obj_t *self, void *buf, qrio_pixel_policy_t policy, const qrio_qrdecoder_region_t *region) {
     int width, height;
+    quirc_begin(self->quirc, &width, &height);
+    int out_width = region->width / region->scale;
+    int out_height = region->height / region->scale;
+    // Keep quirc's buffers when the size is the same as last time.
+    if (width != out_width || height != out_height) {
+        quirc_resize(self->quirc, out_width, out_height);
+    }
     uint8_t *framebuffer = quirc_begin(self->quirc, &width, &height);
     uint8_t *src = buf;
 
-    switch (policy) {
-        case QRIO_RGB565: {
-            uint16_t *src16 = buf;
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = (src16[i] >> 3) & 0xfc;
+    if (region->scale == 1 && region->width == self->width && region->height == self->height) {
+        // Whole image at full resolution.
+        switch (policy) {
+            case QRIO_RGB565: {
+                uint16_t *src16 = buf;
+                for (int i = 0; i < width * height; i++) {
+                    framebuffer[i] = (src16[i] >> 3) & 0xfc;
+                }
+                break;
             }
-            break;
-        }
-        case QRIO_RGB565_SWAPPED: {
-            uint16_t *src16 = buf;
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = (__builtin_bswap16(src16[i]) >> 3) & 0xfc;
+            case QRIO_RGB565_SWAPPED: {
+                uint16_t *src16 = buf;
+                for (int i = 0; i < width * height; i++) {
+                    framebuffer[i] = (__builtin_bswap16(src16[i]) >> 3) & 0xfc;
+                }
+                break;
             }
-            break;
-        }
-        case QRIO_EVERY_BYTE:
-            memcpy(framebuffer, src, width * height);
-            break;
+            case QRIO_EVERY_BYTE:
+                memcpy(framebuffer, src, width * height);
+                break;
 
-        case QRIO_ODD_BYTES:
-            src++;
-            MP_FALLTHROUGH;
+            case QRIO_ODD_BYTES:
+                src++;
+                MP_FALLTHROUGH;
 
-        case QRIO_EVEN_BYTES:
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = src[2 * i];
+            case QRIO_EVEN_BYTES:
+                for (int i = 0; i < width * height; i++) {
+                    framebuffer[i] = src[2 * i];
+                }
+                break;
+        }
+    } else if (region->scale == 1) {
+        for (int y = 0; y < height; y++) {
+            size_t row = (size_t)(region->y + y) * self->width + region->x;
+            for (int x = 0; x < width; x++) {
+                framebuffer[y * width + x] = gray_pixel(src, policy, row + x);
             }
-            break;
+        }
+    } else {
+        // Average each scale x scale block so that thin modules aren't lost.
+        int scale = region->scale;
+        int shift = scale == 4 ? 4 : 2;
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                uint32_t sum = 0;
+                for (int dy = 0; dy < scale; dy++) {
+                    size_t row = (size_t)(region->y + y * scale + dy) * self->width + region->x + x * scale;
+                    for (int dx = 0; dx < scale; dx++) {
+                        sum += gray_pixel(src, policy, row + dx);
+                    }
+                }
+                framebuffer[y * width + x] = sum >> shift;
+            }
+        }
     }
     quirc_end(self->quirc);
 }
 
 
-mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
-    quirc_fill_buffer(self, bufinfo->buf, policy);
+mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy, const qrio_qrdecoder_region_t *region) {
+    quirc_fill_buffer(self, bufinfo->buf, policy, region);
     int count = quirc_count(self->quirc);
     mp_obj_t result = mp_obj_new_list(0, NULL);
     for (int i = 0; i < count; i++) {
@@ -157,24 +198,20 @@ mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, co
 }
 
 
-mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
-    quirc_fill_buffer(self, bufinfo->buf, policy);
+mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy, const qrio_qrdecoder_region_t *region) {
+    quirc_fill_buffer(self, bufinfo->buf, policy, region);
     int count = quirc_count(self->quirc);
     mp_obj_t result = mp_obj_new_list(0, NULL);
     for (int i = 0; i < count; i++) {
         quirc_extract(self->quirc, i, &self->code);
         mp_obj_t code_obj;
-        mp_obj_t elems[9] = {
-            mp_obj_new_int(self->code.corners[0].x),
-            mp_obj_new_int(self->code.corners[0].y),
-            mp_obj_new_int(self->code.corners[1].x),
-            mp_obj_new_int(self->code.corners[1].y),
-            mp_obj_new_int(self->code.corners[2].x),
-            mp_obj_new_int(self->code.corners[2].y),
-            mp_obj_new_int(self->code.corners[3].x),
-            mp_obj_new_int(self->code.corners[3].y),
-            mp_obj_new_int(self->code.size),
-        };
+        // Report corners in the coordinates of the source image.
+        mp_obj_t elems[9];
+        for (int c = 0; c < 4; c++) {
+            elems[2 * c] = mp_obj_new_int(self->code.corners[c].x * region->scale + region->x);
+            elems[2 * c + 1] = mp_obj_new_int(self->code.corners[c].y * region->scale + region->y);
+        }
+        elems[8] = mp_obj_new_int(self->code.size);
         code_obj = namedtuple_make_new((const mp_obj_type_t *)&qrio_qrposition_type_obj, 9, 0, elems);
         mp_obj_list_append(result, code_obj);
     }
@@ -32,15 +32,28 @@
 
 typedef struct qrio_qrdecoder_obj {
     mp_obj_base_t base;
+    // Size of the source image. quirc's own image is sized for the last region decoded and is
+    // only resized when that changes.
+    int width;
+    int height;
     struct quirc *quirc;
     struct quirc_code code;
     struct quirc_data data;
 } qrdecoder_qrdecoder_obj_t;
 
+// Part of the source image to decode, shrunk by scale (1, 2 or 4) on the way into quirc.
+typedef struct {
+    int x;
+    int y;
+    int width;
+    int height;
+    int scale;
+} qrio_qrdecoder_region_t;
+
 void shared_module_qrio_qrdecoder_construct(qrdecoder_qrdecoder_obj_t *, int width, int height);
 int shared_module_qrio_qrdecoder_get_height(qrdecoder_qrdecoder_obj_t *);
 int shared_module_qrio_qrdecoder_get_width(qrdecoder_qrdecoder_obj_t *);
 void shared_module_qrio_qrdecoder_set_height(qrdecoder_qrdecoder_obj_t *, int height);
 void shared_module_qrio_qrdecoder_set_width(qrdecoder_qrdecoder_obj_t *, int width);
-mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy);
-mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy);
+mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy, const qrio_qrdecoder_region_t *region);
+mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy, const qrio_qrdecoder_region_t *region);
@@ -33,50 +33,70 @@
 #include "shared-bindings/random/__init__.h"
 #include "shared-bindings/time/__init__.h"
 
-// Yasmarang random number generator
-// by Ilya Levin
-// http://www.literatecode.com/yasmarang
+// xoshiro128** random number generator
+// by David Blackman and Sebastiano Vigna
+// https://prng.di.unimi.it/xoshiro128starstar.c
 // Public Domain
 
-STATIC uint32_t yasmarang_pad = 0xeda4baba, yasmarang_n = 69, yasmarang_d = 233;
-STATIC uint8_t yasmarang_dat = 0;
+// All zeros is the one state that xoshiro can't leave, so it marks the generator as unseeded.
+STATIC uint32_t xoshiro_state[4];
 
-STATIC uint32_t yasmarang(void) {
-    if (yasmarang_pad == 0xeda4baba) {
-        if (!common_hal_os_urandom((uint8_t *)&yasmarang_pad, sizeof(uint32_t))) {
-            yasmarang_pad = common_hal_time_monotonic_ms() & 0xffffffff;
+STATIC uint32_t rotl(const uint32_t x, int k) {
+    return (x << k) | (x >> (32 - k));
+}
+
+// Expands a 32-bit seed into the generator state with splitmix32, so that similar seeds still
+// give unrelated sequences.
+STATIC void xoshiro_seed(uint32_t seed) {
+    for (size_t i = 0; i < MP_ARRAY_SIZE(xoshiro_state); i++) {
+        uint32_t z = (seed += 0x9e3779b9);
+        z = (z ^ (z >> 16)) * 0x85ebca6b;
+        z = (z ^ (z >> 13)) * 0xc2b2ae35;
+        xoshiro_state[i] = z ^ (z >> 16);
+    }
+}
+
+STATIC uint32_t xoshiro(void) {
+    uint32_t *s = xoshiro_state;
+    if ((s[0] | s[1] | s[2] | s[3]) == 0) {
+        if (!common_hal_os_urandom((uint8_t *)s, sizeof(xoshiro_state)) ||
+            (s[0] | s[1] | s[2] | s[3]) == 0) {
+            xoshiro_seed(common_hal_time_monotonic_ms() & 0xffffffff);
         }
     }
-    yasmarang_pad += yasmarang_dat + yasmarang_d * yasmarang_n;
-    yasmarang_pad = (yasmarang_pad << 3) + (yasmarang_pad >> 29);
-    yasmarang_n = yasmarang_pad | 2;
-    yasmarang_d ^= (yasmarang_pad << 31) + (yasmarang_pad >> 1);
-    yasmarang_dat ^= (char)yasmarang_pad ^ (yasmarang_d >> 8) ^ 1;
+    const uint32_t result = rotl(s[1] * 5, 7) * 9;
+    const uint32_t t = s[1] << 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
 
-    return yasmarang_pad ^ (yasmarang_d << 5) ^ (yasmarang_pad >> 18) ^ (yasmarang_dat << 1);
-}  /* yasmarang */
+    s[2] ^= t;
 
-// End of Yasmarang
+    s[3] = rotl(s[3], 11);
+
+    return result;
+}
+
+// End of xoshiro128**
 
 // returns an unsigned integer below the given argument
 // n must not be zero
-STATIC uint32_t yasmarang_randbelow(uint32_t n) {
+STATIC uint32_t xoshiro_randbelow(uint32_t n) {
     uint32_t mask = 1;
     while ((n & mask) < n) {
         mask = (mask << 1) | 1;
     }
     uint32_t r;
     do {
-        r = yasmarang() & mask;
+        r = xoshiro() & mask;
     } while (r >= n);
     return r;
 }
 
 void shared_modules_random_seed(mp_uint_t seed) {
-    yasmarang_pad = seed;
-    yasmarang_n = 69;
-    yasmarang_d = 233;
-    yasmarang_dat = 0;
+    xoshiro_seed(seed);
 }
 
 mp_uint_t shared_modules_random_getrandbits(uint8_t n) {
@@ -86,7 +106,20 @@ mp_uint_t shared_modules_random_getrandbits(uint8_t n) {
     uint32_t mask = ~0;
     // Beware of C undefined behavior when shifting by >= than bit size
     mask >>= (32 - n);
-    return yasmarang() & mask;
+    return xoshiro() & mask;
+}
+
+void shared_modules_random_randbytes_into(uint8_t *buffer, size_t length) {
+    while (length >= sizeof(uint32_t)) {
+        uint32_t r = xoshiro();
+        memcpy(buffer, &r, sizeof(uint32_t));
+        buffer += sizeof(uint32_t);
+        length -= sizeof(uint32_t);
+    }
+    if (length > 0) {
+        uint32_t r = xoshiro();
+        memcpy(buffer, &r, length);
+    }
 }
 
 mp_int_t shared_modules_random_randrange(mp_int_t start, mp_int_t stop, mp_int_t step) {
@@ -96,11 +129,11 @@ mp_int_t shared_modules_random_randrange(mp_int_t start, mp_int_t stop, mp_int_t
     } else {
         n = (stop - start + step + 1) / step;
     }
-    return start + step * yasmarang_randbelow(n);
+    return start + step * xoshiro_randbelow(n);
 }
 
-// returns a number in the range [0..1) using Yasmarang to fill in the fraction bits
-STATIC mp_float_t yasmarang_float(void) {
+// returns a number in the range [0..1) using xoshiro to fill in the fraction bits
+STATIC mp_float_t xoshiro_float(void) {
     #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_DOUBLE
     typedef uint64_t mp_float_int_t;
     #elif MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
@@ -119,17 +152,17 @@ STATIC mp_float_t yasmarang_float(void) {
     u.p.sgn = 0;
     u.p.exp = (1 << (MP_FLOAT_EXP_BITS - 1)) - 1;
     if (MP_FLOAT_FRAC_BITS <= 32) {
-        u.p.frc = yasmarang();
+        u.p.frc = xoshiro();
     } else {
-        u.p.frc = ((uint64_t)yasmarang() << 32) | (uint64_t)yasmarang();
+        u.p.frc = ((uint64_t)xoshiro() << 32) | (uint64_t)xoshiro();
     }
     return u.f - 1;
 }
 
 mp_float_t shared_modules_random_random(void) {
-    return yasmarang_float();
+    return xoshiro_float();
 }
 
 mp_float_t shared_modules_random_uniform(mp_float_t a, mp_float_t b) {
-    return a + (b - a) * yasmarang_float();
+    return a + (b - a) * xoshiro_float();
 }
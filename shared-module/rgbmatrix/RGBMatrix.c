@@ -236,6 +236,18 @@ void common_hal_rgbmatrix_rgbmatrix_refresh(rgbmatrix_rgbmatrix_obj_t *self) {
     }
 }
 
+void common_hal_rgbmatrix_rgbmatrix_refresh_rows(rgbmatrix_rgbmatrix_obj_t *self, uint8_t *dirty_row_bitmask) {
+    // Protomatter only converts whole frames, so the most that can be saved
+    // is the conversion when no row changed at all.
+    int height = common_hal_rgbmatrix_rgbmatrix_get_height(self);
+    for (int i = 0; i < (height + 7) / 8; i++) {
+        if (dirty_row_bitmask[i]) {
+            common_hal_rgbmatrix_rgbmatrix_refresh(self);
+            return;
+        }
+    }
+}
+
 int common_hal_rgbmatrix_rgbmatrix_get_width(rgbmatrix_rgbmatrix_obj_t *self) {
     return self->width;
 }
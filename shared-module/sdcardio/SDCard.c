@@ -96,12 +96,16 @@ static uint8_t CRC7(const uint8_t *data, uint8_t n) {
 }
 
 #define READY_TIMEOUT_NS (300 * 1000 * 1000) // 300ms
+// The card holds its output low while busy and sends 0xff once ready. Poll several bytes per
+// transfer so a long busy period (such as after a block write) costs fewer SPI transactions and
+// clock reads. Clocking extra 0xff bytes into an idle card is harmless.
+#define READY_POLL_BYTES (8)
 STATIC int wait_for_ready(sdcardio_sdcard_obj_t *self) {
     uint64_t deadline = common_hal_time_monotonic_ns() + READY_TIMEOUT_NS;
     while (common_hal_time_monotonic_ns() < deadline) {
-        uint8_t b;
-        common_hal_busio_spi_read(self->bus, &b, 1, 0xff);
-        if (b == 0xff) {
+        uint8_t b[READY_POLL_BYTES];
+        common_hal_busio_spi_read(self->bus, b, sizeof(b), 0xff);
+        if (b[sizeof(b) - 1] == 0xff) {
             return 0;
         }
     }
@@ -131,6 +135,11 @@ STATIC int exit_cmd25(sdcardio_sdcard_obj_t *self) {
     if (self->in_cmd25) {
         DEBUG_PRINT("exit cmd25\n");
         self->in_cmd25 = false;
+        // The last block written may still be programming.
+        int r = wait_for_ready(self);
+        if (r < 0) {
+            return r;
+        }
         return cmd_nodata(self, TOKEN_STOP_TRAN, 0);
     }
     return 0;
@@ -409,7 +418,11 @@ int common_hal_sdcardio_sdcard_readblocks(sdcardio_sdcard_obj_t *self, uint32_t
 }
 
 STATIC int _write(sdcardio_sdcard_obj_t *self, uint8_t token, void *buf, size_t size) {
-    wait_for_ready(self);
+    // Wait for the card to finish programming the previous block
+    int r = wait_for_ready(self);
+    if (r < 0) {
+        return r;
+    }
 
     uint8_t cmd[2];
     cmd[0] = token;
@@ -444,10 +457,9 @@ STATIC int _write(sdcardio_sdcard_obj_t *self, uint8_t token, void *buf, size_t
         }
     }
 
-    // Wait for the write to finish
-    do {
-        common_hal_busio_spi_read(self->bus, cmd, 1, 0xff);
-    } while (cmd[0] == 0);
+    // Don't wait here for the card to finish programming the block. It stays busy for a while,
+    // and meanwhile the caller can prepare the next block. Whatever next talks to the card waits
+    // for it to be ready first.
 
     // Success
     return 0;
@@ -28,6 +28,7 @@
 #include "shared-bindings/ssl/SSLSocket.h"
 #include "shared-bindings/socketpool/SocketPool.h"
 
+#include "py/objstr.h"
 #include "py/runtime.h"
 #include "py/stream.h"
 
@@ -35,6 +36,7 @@
 
 void common_hal_ssl_sslcontext_construct(ssl_sslcontext_obj_t *self) {
     common_hal_ssl_sslcontext_set_default_verify_paths(self);
+    common_hal_ssl_sslcontext_clear_sessions(self);
 }
 
 void common_hal_ssl_sslcontext_load_verify_locations(ssl_sslcontext_obj_t *self,
@@ -64,3 +66,138 @@ void common_hal_ssl_sslcontext_load_cert_chain(ssl_sslcontext_obj_t *self, mp_bu
     self->cert_buf = *cert_buf;
     self->key_buf = *key_buf;
 }
+
+STATIC ssl_session_cache_entry_t *find_session(ssl_sslcontext_obj_t *self, mp_obj_t hostname) {
+    for (size_t i = 0; i < CIRCUITPY_SSL_SESSION_CACHE_SIZE; i++) {
+        ssl_session_cache_entry_t *entry = &self->sessions[i];
+        if (entry->hostname != MP_OBJ_NULL && mp_obj_equal(entry->hostname, hostname)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+STATIC void put_session(ssl_sslcontext_obj_t *self, mp_obj_t hostname, mp_obj_t session) {
+    ssl_session_cache_entry_t *entry = find_session(self, hostname);
+    for (size_t i = 0; entry == NULL && i < CIRCUITPY_SSL_SESSION_CACHE_SIZE; i++) {
+        if (self->sessions[i].hostname == MP_OBJ_NULL) {
+            entry = &self->sessions[i];
+        }
+    }
+    if (entry == NULL) {
+        // Full, so replace the entries in the order they were filled.
+        entry = &self->sessions[self->next_session];
+        self->next_session = (self->next_session + 1) % CIRCUITPY_SSL_SESSION_CACHE_SIZE;
+    }
+    entry->hostname = hostname;
+    entry->session = session;
+}
+
+void ssl_sslcontext_restore_session(ssl_sslcontext_obj_t *self, mbedtls_ssl_context *ssl, mp_obj_t hostname) {
+    ssl_session_cache_entry_t *entry = find_session(self, hostname);
+    if (entry == NULL) {
+        return;
+    }
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(entry->session, &bufinfo, MP_BUFFER_READ);
+
+    mbedtls_ssl_session session;
+    mbedtls_ssl_session_init(&session);
+    if (mbedtls_ssl_session_load(&session, bufinfo.buf, bufinfo.len) != 0 ||
+        mbedtls_ssl_set_session(ssl, &session) != 0) {
+        // Saved by a different mbedtls build, or otherwise unusable.
+        entry->hostname = MP_OBJ_NULL;
+        entry->session = MP_OBJ_NULL;
+    }
+    mbedtls_ssl_session_free(&session);
+}
+
+void ssl_sslcontext_store_session(ssl_sslcontext_obj_t *self, mbedtls_ssl_context *ssl, mp_obj_t hostname) {
+    mbedtls_ssl_session session;
+    mbedtls_ssl_session_init(&session);
+    if (mbedtls_ssl_get_session(ssl, &session) != 0) {
+        goto cleanup;
+    }
+    size_t len = 0;
+    mbedtls_ssl_session_save(&session, NULL, 0, &len);
+    if (len == 0) {
+        goto cleanup;
+    }
+    // The connection is already up, so a full heap only means the session isn't cached.
+    mp_obj_str_t *o = m_new_obj_maybe(mp_obj_str_t);
+    byte *data = m_new_maybe(byte, len);
+    if (o == NULL || data == NULL ||
+        mbedtls_ssl_session_save(&session, data, len, &len) != 0) {
+        goto cleanup;
+    }
+    o->base.type = &mp_type_bytes;
+    o->data = data;
+    o->len = len;
+    o->hash = qstr_compute_hash(o->data, o->len);
+    put_session(self, hostname, MP_OBJ_FROM_PTR(o));
+cleanup:
+    mbedtls_ssl_session_free(&session);
+}
+
+mp_obj_t common_hal_ssl_sslcontext_save_sessions(ssl_sslcontext_obj_t *self) {
+    // Each entry is a length-prefixed hostname followed by a 16-bit
+    // little-endian length and the session data.
+    vstr_t vstr;
+    vstr_init(&vstr, 64);
+    for (size_t i = 0; i < CIRCUITPY_SSL_SESSION_CACHE_SIZE; i++) {
+        ssl_session_cache_entry_t *entry = &self->sessions[i];
+        if (entry->hostname == MP_OBJ_NULL) {
+            continue;
+        }
+        size_t hostname_len;
+        const char *hostname = mp_obj_str_get_data(entry->hostname, &hostname_len);
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(entry->session, &bufinfo, MP_BUFFER_READ);
+        if (hostname_len > 0xff || bufinfo.len > 0xffff) {
+            continue;
+        }
+        vstr_add_byte(&vstr, hostname_len);
+        vstr_add_strn(&vstr, hostname, hostname_len);
+        vstr_add_byte(&vstr, bufinfo.len & 0xff);
+        vstr_add_byte(&vstr, bufinfo.len >> 8);
+        vstr_add_strn(&vstr, bufinfo.buf, bufinfo.len);
+    }
+    return mp_obj_new_bytes_from_vstr(&vstr);
+}
+
+void common_hal_ssl_sslcontext_load_sessions(ssl_sslcontext_obj_t *self, const uint8_t *buf, size_t len) {
+    // Check the whole buffer before changing the cache.
+    size_t pos = 0;
+    while (pos < len) {
+        size_t hostname_len = buf[pos];
+        if (len - pos < hostname_len + 3) {
+            mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_data);
+        }
+        pos += hostname_len + 1;
+        size_t session_len = buf[pos] | (buf[pos + 1] << 8);
+        pos += 2;
+        if (len - pos < session_len) {
+            mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_data);
+        }
+        pos += session_len;
+    }
+
+    pos = 0;
+    while (pos < len) {
+        size_t hostname_len = buf[pos++];
+        mp_obj_t hostname = mp_obj_new_str((const char *)buf + pos, hostname_len);
+        pos += hostname_len;
+        size_t session_len = buf[pos] | (buf[pos + 1] << 8);
+        pos += 2;
+        put_session(self, hostname, mp_obj_new_bytes(buf + pos, session_len));
+        pos += session_len;
+    }
+}
+
+void common_hal_ssl_sslcontext_clear_sessions(ssl_sslcontext_obj_t *self) {
+    for (size_t i = 0; i < CIRCUITPY_SSL_SESSION_CACHE_SIZE; i++) {
+        self->sessions[i].hostname = MP_OBJ_NULL;
+        self->sessions[i].session = MP_OBJ_NULL;
+    }
+    self->next_session = 0;
+}
@@ -30,6 +30,16 @@
 #include "py/obj.h"
 #include "mbedtls/ssl.h"
 
+// Number of server hostnames whose TLS sessions are kept for resumption.
+#ifndef CIRCUITPY_SSL_SESSION_CACHE_SIZE
+#define CIRCUITPY_SSL_SESSION_CACHE_SIZE (4)
+#endif
+
+typedef struct {
+    mp_obj_t hostname; // str, or MP_OBJ_NULL for an unused entry
+    mp_obj_t session; // bytes from mbedtls_ssl_session_save()
+} ssl_session_cache_entry_t;
+
 typedef struct {
     mp_obj_base_t base;
     bool check_name, use_global_ca_store;
@@ -37,4 +47,11 @@ typedef struct {
     size_t cacert_bytes;
     int (*crt_bundle_attach)(mbedtls_ssl_config *conf);
     mp_buffer_info_t cert_buf, key_buf;
+    ssl_session_cache_entry_t sessions[CIRCUITPY_SSL_SESSION_CACHE_SIZE];
+    uint8_t next_session;
 } ssl_sslcontext_obj_t;
+
+// Offer the cached session for hostname, if any, when ssl next handshakes.
+void ssl_sslcontext_restore_session(ssl_sslcontext_obj_t *self, mbedtls_ssl_context *ssl, mp_obj_t hostname);
+// Remember the session ssl just negotiated with hostname.
+void ssl_sslcontext_store_session(ssl_sslcontext_obj_t *self, mbedtls_ssl_context *ssl, mp_obj_t hostname);
@@ -163,6 +163,11 @@ ssl_sslsocket_obj_t *common_hal_ssl_sslcontext_wrap_socket(ssl_sslcontext_obj_t
     o->base.type = &ssl_sslsocket_type;
     o->ssl_context = self;
     o->sock = socket;
+    o->session_hostname = MP_OBJ_NULL;
+    if (!server_side && server_hostname != NULL) {
+        // Key for the context's session cache; made before any mbedtls state exists to leak.
+        o->session_hostname = mp_obj_new_str(server_hostname, strlen(server_hostname));
+    }
 
     mbedtls_ssl_init(&o->ssl);
     mbedtls_ssl_config_init(&o->conf);
@@ -219,6 +224,10 @@ ssl_sslsocket_obj_t *common_hal_ssl_sslcontext_wrap_socket(ssl_sslcontext_obj_t
         if (ret != 0) {
             goto cleanup;
         }
+        if (o->session_hostname != MP_OBJ_NULL) {
+            // Resume an earlier session with this host to skip the full handshake.
+            ssl_sslcontext_restore_session(self, &o->ssl, o->session_hostname);
+        }
     }
 
     mbedtls_ssl_set_bio(&o->ssl, &o->sock, _mbedtls_ssl_send, _mbedtls_ssl_recv, NULL);
@@ -345,6 +354,9 @@ cleanup:
 void common_hal_ssl_sslsocket_connect(ssl_sslsocket_obj_t *self, const char *host, size_t hostlen, uint32_t port) {
     common_hal_socketpool_socket_connect(self->sock, host, hostlen, port);
     do_handshake(self);
+    if (self->session_hostname != MP_OBJ_NULL) {
+        ssl_sslcontext_store_session(self->ssl_context, &self->ssl, self->session_hostname);
+    }
 }
 
 bool common_hal_ssl_sslsocket_get_closed(ssl_sslsocket_obj_t *self) {
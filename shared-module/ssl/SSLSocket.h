@@ -50,5 +50,7 @@ typedef struct ssl_sslsocket_obj {
     mbedtls_x509_crt cacert;
     mbedtls_x509_crt cert;
     mbedtls_pk_context pkey;
+    // Server hostname used to cache the session, or MP_OBJ_NULL.
+    mp_obj_t session_hostname;
     bool closed;
 } ssl_sslsocket_obj_t;
@@ -0,0 +1,129 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/mperrno.h"
+#include "shared-bindings/storage/DataPartition.h"
+#include "supervisor/filesystem.h"
+#include "supervisor/flash.h"
+
+#if CIRCUITPY_STORAGE_DATA_PARTITION_SIZE > 0
+
+#define FLASH_BLOCKS_PER_BLOCK (STORAGE_DATAPARTITION_BLOCK_SIZE / FILESYSTEM_BLOCK_SIZE)
+
+uint32_t common_hal_storage_datapartition_get_block_count(void) {
+    return supervisor_flash_data_get_block_count() / FLASH_BLOCKS_PER_BLOCK;
+}
+
+// Reads or writes len bytes at address. Whole flash blocks go straight through.
+// Partial ones are read first so that the rest of the block is kept.
+static int datapartition_transfer(uint32_t address, uint8_t *buf, size_t len, bool write) {
+    if (address + len > CIRCUITPY_STORAGE_DATA_PARTITION_SIZE) {
+        return -MP_EIO;
+    }
+    while (len > 0) {
+        uint32_t block_num = address / FILESYSTEM_BLOCK_SIZE;
+        uint32_t block_offset = address % FILESYSTEM_BLOCK_SIZE;
+        size_t count;
+        mp_uint_t result;
+        if (block_offset == 0 && len >= FILESYSTEM_BLOCK_SIZE) {
+            uint32_t num_blocks = len / FILESYSTEM_BLOCK_SIZE;
+            count = num_blocks * FILESYSTEM_BLOCK_SIZE;
+            if (write) {
+                result = supervisor_flash_data_write_blocks(buf, block_num, num_blocks);
+            } else {
+                result = supervisor_flash_data_read_blocks(buf, block_num, num_blocks);
+            }
+        } else {
+            uint8_t block[FILESYSTEM_BLOCK_SIZE];
+            count = MIN(len, FILESYSTEM_BLOCK_SIZE - block_offset);
+            result = supervisor_flash_data_read_blocks(block, block_num, 1);
+            if (result == 0 && write) {
+                memcpy(block + block_offset, buf, count);
+                result = supervisor_flash_data_write_blocks(block, block_num, 1);
+            } else if (result == 0) {
+                memcpy(buf, block + block_offset, count);
+            }
+        }
+        if (result != 0) {
+            return -MP_EIO;
+        }
+        address += count;
+        buf += count;
+        len -= count;
+    }
+    return 0;
+}
+
+int common_hal_storage_datapartition_readblocks(uint32_t block_num, uint32_t offset, mp_buffer_info_t *buf) {
+    return datapartition_transfer(block_num * STORAGE_DATAPARTITION_BLOCK_SIZE + offset, buf->buf, buf->len, false);
+}
+
+int common_hal_storage_datapartition_writeblocks(uint32_t block_num, uint32_t offset, mp_buffer_info_t *buf) {
+    return datapartition_transfer(block_num * STORAGE_DATAPARTITION_BLOCK_SIZE + offset, buf->buf, buf->len, true);
+}
+
+int common_hal_storage_datapartition_erase(uint32_t block_num) {
+    if (block_num >= common_hal_storage_datapartition_get_block_count()) {
+        return -MP_EIO;
+    }
+    // There is no erase below the flash cache, so write erased blocks instead.
+    // Blocks that are already erased are skipped, so that erasing a fresh
+    // block costs no flash erase at all.
+    uint8_t block[FILESYSTEM_BLOCK_SIZE];
+    uint32_t first = block_num * FLASH_BLOCKS_PER_BLOCK;
+    for (uint32_t i = first; i < first + FLASH_BLOCKS_PER_BLOCK; i++) {
+        if (supervisor_flash_data_read_blocks(block, i, 1) != 0) {
+            return -MP_EIO;
+        }
+        bool erased = true;
+        for (size_t j = 0; j < FILESYSTEM_BLOCK_SIZE; j++) {
+            if (block[j] != 0xff) {
+                erased = false;
+                break;
+            }
+        }
+        if (erased) {
+            continue;
+        }
+        memset(block, 0xff, FILESYSTEM_BLOCK_SIZE);
+        if (supervisor_flash_data_write_blocks(block, i, 1) != 0) {
+            return -MP_EIO;
+        }
+    }
+    return 0;
+}
+
+void common_hal_storage_datapartition_sync(void) {
+    #if CIRCUITPY_FILESYSTEM_WRITE_BEHIND
+    filesystem_write_behind();
+    #else
+    supervisor_flash_flush();
+    #endif
+}
+
+#endif
@@ -0,0 +1,201 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <string.h>
+
+#include "py/binary.h"
+#include "py/objint.h"
+#include "py/runtime.h"
+#include "shared-bindings/struct/Struct.h"
+#include "shared-module/struct/__init__.h"
+
+size_t shared_module_struct_struct_count_fields(mp_obj_t format) {
+    const char *fmt = mp_obj_str_get_str(format);
+    get_fmt_type(&fmt);
+    size_t num_fields = 0;
+    while (*fmt) {
+        if (unichar_isdigit(*fmt)) {
+            get_fmt_num(&fmt);
+        }
+        // A count with no code after it is ignored, as calcsize() does.
+        if (*fmt) {
+            num_fields++;
+            fmt++;
+        }
+    }
+    return num_fields;
+}
+
+void shared_module_struct_struct_construct(struct_struct_obj_t *self, mp_obj_t format) {
+    const char *fmt = mp_obj_str_get_str(format);
+    char fmt_type = get_fmt_type(&fmt);
+
+    self->format = format;
+    self->fmt_type = fmt_type;
+    #if MP_ENDIANNESS_LITTLE
+    self->big_endian = fmt_type == '>';
+    #else
+    self->big_endian = fmt_type == '>' || fmt_type == '@';
+    #endif
+    self->num_items = 0;
+
+    mp_uint_t offset = 0;
+    size_t i = 0;
+    while (*fmt) {
+        mp_uint_t count = 1;
+        if (unichar_isdigit(*fmt)) {
+            count = get_fmt_num(&fmt);
+        }
+        if (!*fmt) {
+            break;
+        }
+        struct_validate_format(*fmt);
+
+        struct_struct_field_t *field = &self->fields[i++];
+        field->code = *fmt;
+        field->count = count;
+        field->is_signed = false;
+        if (*fmt == 's') {
+            field->item_size = 1;
+            field->offset = offset;
+            offset += count;
+            self->num_items++;
+        } else {
+            size_t align;
+            size_t size = mp_binary_get_size(fmt_type, *fmt, &align);
+            // Every code is a whole number of its alignment, so aligning the first
+            // item of a run aligns the rest of it.
+            offset = (offset + align - 1) & ~(align - 1);
+            field->item_size = size;
+            field->offset = offset;
+            offset += size * count;
+            if (*fmt != 'x') {
+                self->num_items += count;
+            }
+            // Lower case integer codes are signed.
+            field->is_signed = *fmt == 'b' || *fmt == 'h' || *fmt == 'i' || *fmt == 'l' || *fmt == 'q';
+        }
+        fmt++;
+    }
+    self->num_fields = i;
+    self->size = offset;
+
+    char code = i == 1 ? self->fields[0].code : '\0';
+    self->int_run = code != '\0' && strchr("bBhHiIlL", code) != NULL &&
+        self->fields[0].item_size <= 4;
+}
+
+mp_uint_t shared_module_struct_struct_get_size(struct_struct_obj_t *self) {
+    return self->size;
+}
+
+mp_obj_t shared_module_struct_struct_get_format(struct_struct_obj_t *self) {
+    return self->format;
+}
+
+mp_uint_t shared_module_struct_struct_get_num_items(struct_struct_obj_t *self) {
+    return self->num_items;
+}
+
+STATIC mp_obj_t unpack_int(const struct_struct_field_t *field, bool big_endian, const byte *p) {
+    long long val = mp_binary_get_int(field->item_size, field->is_signed, big_endian, p);
+    if (field->item_size <= 2) {
+        return MP_OBJ_NEW_SMALL_INT(val);
+    }
+    if (field->is_signed) {
+        return mp_obj_new_int(val);
+    }
+    return mp_obj_new_int_from_uint(val);
+}
+
+void shared_module_struct_struct_unpack_into(struct_struct_obj_t *self, const byte *p, mp_obj_t *items) {
+    if (self->int_run) {
+        const struct_struct_field_t *field = &self->fields[0];
+        for (mp_uint_t i = 0; i < field->count; i++) {
+            items[i] = unpack_int(field, self->big_endian, p);
+            p += field->item_size;
+        }
+        return;
+    }
+
+    byte *p_base = (byte *)p;
+    size_t n = 0;
+    for (size_t i = 0; i < self->num_fields; i++) {
+        const struct_struct_field_t *field = &self->fields[i];
+        byte *item_p = p_base + field->offset;
+        if (field->code == 's') {
+            items[n++] = mp_obj_new_bytes(item_p, field->count);
+        } else if (field->code != 'x') {
+            for (mp_uint_t j = 0; j < field->count; j++) {
+                items[n++] = mp_binary_get_val(self->fmt_type, field->code, p_base, &item_p);
+            }
+        }
+    }
+}
+
+STATIC void pack_int(const struct_struct_field_t *field, bool big_endian, byte *p, mp_obj_t value, char fmt_type) {
+    if (mp_obj_is_small_int(value)) {
+        mp_int_t val = MP_OBJ_SMALL_INT_VALUE(value);
+        mp_small_int_buffer_overflow_check(val, field->item_size, field->is_signed);
+        mp_binary_set_int(field->item_size, big_endian, p, val);
+    } else {
+        mp_binary_set_val(fmt_type, field->code, value, p, &p);
+    }
+}
+
+void shared_module_struct_struct_pack_into(struct_struct_obj_t *self, byte *p, size_t n_args, const mp_obj_t *args) {
+    (void)mp_arg_validate_length(n_args, self->num_items, MP_QSTR_values);
+
+    if (self->int_run) {
+        const struct_struct_field_t *field = &self->fields[0];
+        for (mp_uint_t i = 0; i < field->count; i++) {
+            pack_int(field, self->big_endian, p, args[i], self->fmt_type);
+            p += field->item_size;
+        }
+        return;
+    }
+
+    byte *p_base = p;
+    size_t n = 0;
+    for (size_t i = 0; i < self->num_fields; i++) {
+        const struct_struct_field_t *field = &self->fields[i];
+        byte *item_p = p_base + field->offset;
+        if (field->code == 's') {
+            mp_buffer_info_t bufinfo;
+            mp_get_buffer_raise(args[n++], &bufinfo, MP_BUFFER_READ);
+            mp_uint_t to_copy = MIN(bufinfo.len, field->count);
+            memcpy(item_p, bufinfo.buf, to_copy);
+            memset(item_p + to_copy, 0, field->count - to_copy);
+        } else if (field->code == 'x') {
+            memset(item_p, 0, field->item_size * field->count);
+        } else {
+            for (mp_uint_t j = 0; j < field->count; j++) {
+                mp_binary_set_val(self->fmt_type, field->code, args[n++], p_base, &item_p);
+            }
+        }
+    }
+}
@@ -0,0 +1,56 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_STRUCT_STRUCT_H
+#define MICROPY_INCLUDED_SHARED_MODULE_STRUCT_STRUCT_H
+
+#include "py/obj.h"
+
+// One run of the same format code, e.g. "3h", "2x" or "10s".
+typedef struct {
+    mp_uint_t offset; // byte offset of the first item
+    mp_uint_t count; // number of items, or the length of an 's' string
+    uint8_t item_size;
+    char code;
+    bool is_signed;
+} struct_struct_field_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    mp_obj_t format;
+    mp_uint_t size;
+    mp_uint_t num_items;
+    char fmt_type;
+    bool big_endian;
+    // True when the whole format is one run of integers no bigger than 4 bytes,
+    // e.g. "<hhh" or ">4H", which are packed and unpacked without a per-item lookup.
+    bool int_run;
+    size_t num_fields;
+    struct_struct_field_t fields[];
+} struct_struct_obj_t;
+
+#endif // MICROPY_INCLUDED_SHARED_MODULE_STRUCT_STRUCT_H
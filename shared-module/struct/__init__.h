@@ -27,6 +27,9 @@
 #ifndef MICROPY_INCLUDED_SHARED_MODULE_STRUCT___INIT___H
 #define MICROPY_INCLUDED_SHARED_MODULE_STRUCT___INIT___H
 
+#include "py/obj.h"
+
+void struct_validate_format(char fmt);
 char get_fmt_type(const char **fmt);
 mp_uint_t get_fmt_num(const char **p);
 mp_uint_t calcsize_items(const char *fmt);
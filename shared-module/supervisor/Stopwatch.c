@@ -0,0 +1,77 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/supervisor/Stopwatch.h"
+
+#include "supervisor/port.h"
+
+void shared_module_supervisor_stopwatch_construct(supervisor_stopwatch_obj_t *self) {
+    shared_module_supervisor_stopwatch_reset(self);
+}
+
+void shared_module_supervisor_stopwatch_start(supervisor_stopwatch_obj_t *self) {
+    self->running = true;
+    // Read the counter last so that the lap doesn't include this call.
+    self->lap_start = port_get_cycle_count();
+}
+
+void shared_module_supervisor_stopwatch_stop(supervisor_stopwatch_obj_t *self) {
+    // Read the counter first so that the lap doesn't include this call.
+    uint32_t now = port_get_cycle_count();
+    if (!self->running) {
+        return;
+    }
+    // Unsigned subtraction handles the counter wrapping once during the lap.
+    self->total_cycles += now - self->lap_start;
+    self->laps++;
+    self->running = false;
+}
+
+void shared_module_supervisor_stopwatch_reset(supervisor_stopwatch_obj_t *self) {
+    self->total_cycles = 0;
+    self->lap_start = 0;
+    self->laps = 0;
+    self->running = false;
+}
+
+bool shared_module_supervisor_stopwatch_get_running(supervisor_stopwatch_obj_t *self) {
+    return self->running;
+}
+
+uint32_t shared_module_supervisor_stopwatch_get_laps(supervisor_stopwatch_obj_t *self) {
+    return self->laps;
+}
+
+uint64_t shared_module_supervisor_stopwatch_get_cycles(supervisor_stopwatch_obj_t *self) {
+    return self->total_cycles;
+}
+
+uint64_t shared_module_supervisor_stopwatch_get_microseconds(supervisor_stopwatch_obj_t *self) {
+    uint32_t frequency = port_get_cycle_count_frequency();
+    // Split the division so that the multiplication can't overflow.
+    return (self->total_cycles / frequency) * 1000000 +
+           (self->total_cycles % frequency) * 1000000 / frequency;
+}
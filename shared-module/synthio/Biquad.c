@@ -111,10 +111,14 @@ void synthio_biquad_filter_assign(biquad_filter_state *st, mp_obj_t biquad_obj)
 }
 
 void synthio_biquad_filter_reset(biquad_filter_state *st) {
-    memset(&st->x, 0, 4 * sizeof(int16_t));
+    memset(&st->x, 0, sizeof(st->x));
+    memset(&st->y, 0, sizeof(st->y));
 }
 
-void synthio_biquad_filter_samples(biquad_filter_state *st, int32_t *buffer, size_t n_samples) {
+// channel_count is a constant at each call site, so mono and stereo each get their own loop
+__attribute__((always_inline))
+static inline void biquad_filter_samples_sum(biquad_filter_state *st, int32_t *out_buffer32, const int32_t *buffer,
+    size_t n_samples, const int16_t loudness[2], int channel_count) {
     int32_t a1 = st->a1;
     int32_t a2 = st->a2;
     int32_t b0 = st->b0;
@@ -134,10 +138,23 @@ void synthio_biquad_filter_samples(biquad_filter_state *st, int32_t *buffer, siz
         x0 = input;
         y1 = y0;
         y0 = output;
-        *buffer = output;
+        if (channel_count == 1) {
+            *out_buffer32++ += (output * loudness[0]) >> 16;
+        } else {
+            *out_buffer32++ += (output * loudness[0]) >> 16;
+            *out_buffer32++ += (output * loudness[1]) >> 16;
+        }
     }
     st->x[0] = x0;
     st->x[1] = x1;
     st->y[0] = y0;
     st->y[1] = y1;
 }
+
+void synthio_biquad_filter_samples_sum(biquad_filter_state *st, int32_t *out_buffer32, const int32_t *buffer, size_t n_samples, const int16_t loudness[2], int channel_count) {
+    if (channel_count == 1) {
+        biquad_filter_samples_sum(st, out_buffer32, buffer, n_samples, loudness, 1);
+    } else {
+        biquad_filter_samples_sum(st, out_buffer32, buffer, n_samples, loudness, 2);
+    }
+}
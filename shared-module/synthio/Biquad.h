@@ -35,4 +35,5 @@ typedef struct {
 
 void synthio_biquad_filter_assign(biquad_filter_state *st, mp_obj_t biquad_obj);
 void synthio_biquad_filter_reset(biquad_filter_state *st);
-void synthio_biquad_filter_samples(biquad_filter_state *st, int32_t *buffer, size_t n_samples);
+// Filters buffer, then scales the result by loudness and sums it into the (possibly stereo) out_buffer32
+void synthio_biquad_filter_samples_sum(biquad_filter_state *st, int32_t *out_buffer32, const int32_t *buffer, size_t n_samples, const int16_t loudness[2], int channel_count);
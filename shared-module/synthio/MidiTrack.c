@@ -33,20 +33,22 @@ STATIC void record_midi_stream_error(synthio_miditrack_obj_t *self) {
     self->pos = self->track.len;
 }
 
-STATIC mp_obj_t parse_note(synthio_miditrack_obj_t *self) {
+STATIC bool parse_note(synthio_miditrack_obj_t *self, uint8_t *note) {
     uint8_t *buffer = self->track.buf;
     size_t len = self->track.len;
     if (self->pos + 1 >= len) {
         record_midi_stream_error(self);
+        return false;
     }
-    uint8_t note = buffer[(self->pos)++];
-    if (note > 127 || buffer[(self->pos)++] > 127) {
+    *note = buffer[(self->pos)++];
+    if (*note > 127 || buffer[(self->pos)++] > 127) {
         record_midi_stream_error(self);
+        return false;
     }
-    return MP_OBJ_NEW_SMALL_INT(note);
+    return true;
 }
 
-static int decode_duration(synthio_miditrack_obj_t *self) {
+static uint32_t decode_duration(synthio_miditrack_obj_t *self) {
     uint8_t *buffer = self->track.buf;
     size_t len = self->track.len;
     uint8_t c;
@@ -57,34 +59,51 @@ static int decode_duration(synthio_miditrack_obj_t *self) {
         delta |= c & 0x7f;
     } while ((c & 0x80) && (self->pos < len));
 
-    // errors cannot be raised from the background task, so simply end the track.
     if (c & 0x80) {
-        self->pos = self->track.len;
         record_midi_stream_error(self);
     }
     return delta * self->synth.sample_rate / self->tempo;
 }
 
-// invariant: pointing at a MIDI message
-static void decode_until_pause(synthio_miditrack_obj_t *self) {
+STATIC void add_event(synthio_miditrack_obj_t *self, synthio_midi_event_t *events, uint32_t delay, uint8_t kind, uint8_t note) {
+    if (events) {
+        events[self->event_count] = (synthio_midi_event_t) { .delay = delay, .kind = kind, .note = note };
+    }
+    self->event_count++;
+}
+
+// Decode the whole track into events, or only count them when events is NULL. Events that
+// don't change notes are dropped and their delays carried into the next event. The last
+// event is always SYNTHIO_MIDI_EVENT_END.
+STATIC void decode_track(synthio_miditrack_obj_t *self, synthio_midi_event_t *events) {
     uint8_t *buffer = self->track.buf;
     size_t len = self->track.len;
-    do {
+    self->pos = 0;
+    self->event_count = 0;
+    self->error_location = -1;
+    uint32_t delay = 0;
+    if (len > 0) {
+        delay = decode_duration(self);
+    }
+    while (self->pos < len) {
+        uint8_t note;
         switch (buffer[self->pos++] >> 4) {
-            case 8: { // Note Off
-                mp_obj_t note = parse_note(self);
-                synthio_span_change_note(&self->synth, note, SYNTHIO_SILENCE);
+            case 8: // Note Off
+                if (parse_note(self, &note)) {
+                    add_event(self, events, delay, SYNTHIO_MIDI_EVENT_NOTE_OFF, note);
+                    delay = 0;
+                }
                 break;
-            }
-            case 9: { // Note On
-                mp_obj_t note = parse_note(self);
-                synthio_span_change_note(&self->synth, SYNTHIO_SILENCE, note);
+            case 9: // Note On
+                if (parse_note(self, &note)) {
+                    add_event(self, events, delay, SYNTHIO_MIDI_EVENT_NOTE_ON, note);
+                    delay = 0;
+                }
                 break;
-            }
             case 10:
             case 11:
             case 14: // two data bytes to ignore
-                parse_note(self);
+                parse_note(self, &note);
                 break;
             case 12:
             case 13: // one data byte to ignore
@@ -99,18 +118,33 @@ static void decode_until_pause(synthio_miditrack_obj_t *self) {
                 record_midi_stream_error(self);
         }
         if (self->pos < len) {
-            self->synth.span.dur = decode_duration(self);
+            delay += decode_duration(self);
         }
-    } while (self->pos < len && self->synth.span.dur == 0);
+    }
+    add_event(self, events, delay, SYNTHIO_MIDI_EVENT_END, 0);
 }
 
-STATIC void start_parse(synthio_miditrack_obj_t *self) {
-    self->pos = 0;
-    self->error_location = -1;
-    self->synth.span.dur = decode_duration(self);
-    if (self->synth.span.dur == 0) {
+// Apply events until one has a delay. Runs in the audio path, so it only steps through the
+// decoded events.
+STATIC void play_until_pause(synthio_miditrack_obj_t *self) {
+    do {
+        const synthio_midi_event_t *event = &self->events[self->next_event++];
+        mp_obj_t note = MP_OBJ_NEW_SMALL_INT(event->note);
+        if (event->kind == SYNTHIO_MIDI_EVENT_NOTE_ON) {
+            synthio_span_change_note(&self->synth, SYNTHIO_SILENCE, note);
+        } else {
+            synthio_span_change_note(&self->synth, note, SYNTHIO_SILENCE);
+        }
+        self->synth.span.dur = self->events[self->next_event].delay;
+    } while (self->events[self->next_event].kind != SYNTHIO_MIDI_EVENT_END && self->synth.span.dur == 0);
+}
+
+STATIC void start_playback(synthio_miditrack_obj_t *self) {
+    self->next_event = 0;
+    self->synth.span.dur = self->events[0].delay;
+    if (self->synth.span.dur == 0 && self->events[0].kind != SYNTHIO_MIDI_EVENT_END) {
         // the usual case: the file starts with some MIDI event, not a delay
-        decode_until_pause(self);
+        play_until_pause(self);
     }
 }
 
@@ -124,11 +158,15 @@ void common_hal_synthio_miditrack_construct(synthio_miditrack_obj_t *self,
 
     synthio_synth_init(&self->synth, sample_rate, 1, waveform_obj, envelope_obj);
 
-    start_parse(self);
+    decode_track(self, NULL);
+    self->events = m_malloc(self->event_count * sizeof(synthio_midi_event_t));
+    decode_track(self, self->events);
+    start_playback(self);
 }
 
 void common_hal_synthio_miditrack_deinit(synthio_miditrack_obj_t *self) {
     synthio_synth_deinit(&self->synth);
+    self->events = NULL;
 }
 
 bool common_hal_synthio_miditrack_deinited(synthio_miditrack_obj_t *self) {
@@ -152,7 +190,7 @@ uint8_t common_hal_synthio_miditrack_get_channel_count(synthio_miditrack_obj_t *
 void synthio_miditrack_reset_buffer(synthio_miditrack_obj_t *self,
     bool single_channel_output, uint8_t channel) {
     synthio_synth_reset_buffer(&self->synth, single_channel_output, channel);
-    start_parse(self);
+    start_playback(self);
 }
 
 audioio_get_buffer_result_t synthio_miditrack_get_buffer(synthio_miditrack_obj_t *self,
@@ -164,10 +202,10 @@ audioio_get_buffer_result_t synthio_miditrack_get_buffer(synthio_miditrack_obj_t
 
     synthio_synth_synthesize(&self->synth, buffer, buffer_length, single_channel_output ? 0 : channel);
     if (self->synth.span.dur == 0) {
-        if (self->pos == self->track.len) {
+        if (self->events[self->next_event].kind == SYNTHIO_MIDI_EVENT_END) {
             return GET_BUFFER_DONE;
         } else {
-            decode_until_pause(self);
+            play_until_pause(self);
         }
     }
     return GET_BUFFER_MORE_DATA;
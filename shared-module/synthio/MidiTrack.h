@@ -31,14 +31,30 @@
 
 #include "shared-module/synthio/__init__.h"
 
+typedef enum {
+    SYNTHIO_MIDI_EVENT_NOTE_OFF,
+    SYNTHIO_MIDI_EVENT_NOTE_ON,
+    SYNTHIO_MIDI_EVENT_END,
+} synthio_midi_event_kind_t;
+
+typedef struct {
+    uint32_t delay; // In samples, since the previous event
+    uint8_t kind;
+    uint8_t note;
+} synthio_midi_event_t;
+
 typedef struct {
     mp_obj_base_t base;
     synthio_synth_t synth;
     mp_buffer_info_t track;
-    // invariant: after initial startup, pos always points just after an encoded duration, i.e., at a midi message (or at EOF)
+    // Only used while decoding the track at construction
     size_t pos;
     mp_int_t error_location;
     uint32_t tempo;
+    // The track decoded into events, so that playback doesn't parse MIDI
+    synthio_midi_event_t *events;
+    size_t event_count;
+    size_t next_event;
 } synthio_miditrack_obj_t;
 
 
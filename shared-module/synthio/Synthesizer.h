@@ -35,6 +35,8 @@ typedef struct {
     mp_obj_base_t base;
     synthio_synth_t synth;
     mp_obj_t blocks;
+    // Changes to the blocks list aren't reported, so its contents are compared each buffer.
+    uintptr_t blocks_signature;
 } synthio_synthesizer_obj_t;
 
 
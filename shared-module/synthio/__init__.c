@@ -35,6 +35,9 @@
 
 mp_float_t synthio_global_rate_scale;
 uint8_t synthio_global_tick;
+uint32_t synthio_block_generation;
+// The order being recorded during the current tick, if any.
+STATIC synthio_block_order_t *synthio_block_recording;
 
 STATIC const int16_t square_wave[] = {-32768, 32767};
 
@@ -172,7 +175,22 @@ int16_t mix_down_sample(int32_t sample) {
     return sample;
 }
 
-static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *out_buffer32, int16_t dur, int16_t loudness[2]) {
+STATIC void sum_with_loudness(int32_t *out_buffer32, int32_t *tmp_buffer32, int16_t loudness[2], size_t dur, int synth_chan) {
+    if (synth_chan == 1) {
+        for (size_t i = 0; i < dur; i++) {
+            *out_buffer32++ += (*tmp_buffer32++ *loudness[0]) >> 16;
+        }
+    } else {
+        for (size_t i = 0; i < dur; i++) {
+            *out_buffer32++ += (*tmp_buffer32 * loudness[0]) >> 16;
+            *out_buffer32++ += (*tmp_buffer32++ *loudness[1]) >> 16;
+        }
+    }
+}
+
+// Renders dur samples of the note on chan into out_buffer32. If mix_buffer32 is not NULL the samples
+// are also scaled by loudness and summed into it; plain notes do this in the same pass as the oscillator.
+static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *out_buffer32, int32_t *mix_buffer32, int16_t dur, int16_t loudness[2]) {
     mp_obj_t note_obj = synth->span.note_obj[chan];
 
     int32_t sample_rate = synth->sample_rate;
@@ -243,47 +261,69 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
         accum = accum % lim + offset;
     }
 
-    // first, fill with waveform
-    for (uint16_t i = 0; i < dur; i++) {
-        accum += dds_rate;
-        // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
-        if (accum > lim) {
-            accum = accum - lim + offset;
-        }
-        int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
-        out_buffer32[i] = waveform[idx];
+    if (ring_dds_rate > lim / 2) {
+        // beyond nyquist, can't play ring (but still synth main sound)
+        ring_dds_rate = 0;
     }
-    synth->accum[chan] = accum;
 
     if (ring_dds_rate) {
-        if (ring_dds_rate > lim / 2) {
-            // beyond nyquist, can't play ring (but did synth main sound so
-            // return true)
-            return true;
-        }
-
-        // now modulate by ring and accumulate
-        accum = synth->ring_accum[chan];
-        offset = ring_waveform_start << SYNTHIO_FREQUENCY_SHIFT;
-        lim = ring_waveform_length << SYNTHIO_FREQUENCY_SHIFT;
+        uint32_t ring_offset = ring_waveform_start << SYNTHIO_FREQUENCY_SHIFT;
+        uint32_t ring_lim = ring_waveform_length << SYNTHIO_FREQUENCY_SHIFT;
+        uint32_t ring_accum = synth->ring_accum[chan];
 
         // can happen if note waveform gets set mid-note, but the expensive modulo is usually avoided
-        if (accum > lim) {
-            accum = accum % lim + offset;
+        if (ring_accum > ring_lim) {
+            ring_accum = ring_accum % ring_lim + ring_offset;
         }
 
         for (uint16_t i = 0; i < dur; i++) {
-            accum += ring_dds_rate;
+            accum += dds_rate;
             // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
             if (accum > lim) {
                 accum = accum - lim + offset;
             }
+            ring_accum += ring_dds_rate;
+            if (ring_accum > ring_lim) {
+                ring_accum = ring_accum - ring_lim + ring_offset;
+            }
             int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
-            int16_t wi = (ring_waveform[idx] * out_buffer32[i]) / 32768;
+            int16_t ring_idx = ring_accum >> SYNTHIO_FREQUENCY_SHIFT;
+            int16_t wi = (ring_waveform[ring_idx] * waveform[idx]) / 32768;
             out_buffer32[i] = wi;
         }
-        synth->ring_accum[chan] = accum;
+        synth->ring_accum[chan] = ring_accum;
+        if (mix_buffer32) {
+            sum_with_loudness(mix_buffer32, out_buffer32, loudness, dur, synth->channel_count);
+        }
+    } else if (mix_buffer32) {
+        int32_t left = loudness[0];
+        int32_t right = loudness[1];
+        for (uint16_t i = 0; i < dur; i++) {
+            accum += dds_rate;
+            if (accum > lim) {
+                accum = accum - lim + offset;
+            }
+            int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
+            int32_t sample = waveform[idx];
+            if (synth->channel_count == 1) {
+                *mix_buffer32++ += (sample * left) >> 16;
+            } else {
+                *mix_buffer32++ += (sample * left) >> 16;
+                *mix_buffer32++ += (sample * right) >> 16;
+            }
+        }
+    } else {
+        for (uint16_t i = 0; i < dur; i++) {
+            accum += dds_rate;
+            // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
+            if (accum > lim) {
+                accum = accum - lim + offset;
+            }
+            int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
+            out_buffer32[i] = waveform[idx];
+        }
     }
+    synth->accum[chan] = accum;
     return true;
 }
 
@@ -298,19 +338,6 @@ STATIC mp_obj_t synthio_synth_get_note_filter(mp_obj_t note_obj) {
     return mp_const_none;
 }
 
-STATIC void sum_with_loudness(int32_t *out_buffer32, int32_t *tmp_buffer32, int16_t loudness[2], size_t dur, int synth_chan) {
-    if (synth_chan == 1) {
-        for (size_t i = 0; i < dur; i++) {
-            *out_buffer32++ += (*tmp_buffer32++ *loudness[0]) >> 16;
-        }
-    } else {
-        for (size_t i = 0; i < dur; i++) {
-            *out_buffer32++ += (*tmp_buffer32 * loudness[0]) >> 16;
-            *out_buffer32++ += (*tmp_buffer32++ *loudness[1]) >> 16;
-        }
-    }
-}
-
 void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t *buffer_length, uint8_t channel) {
 
     if (channel == synth->other_channel) {
@@ -320,6 +347,7 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
     }
 
     shared_bindings_synthio_lfo_tick(synth->sample_rate);
+    synthio_block_order_tick(&synth->block_order);
 
     synth->buffer_index = !synth->buffer_index;
     synth->other_channel = 1 - channel;
@@ -341,25 +369,27 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
         if (synth->envelope_state[chan].level == 0) {
             // note is truly finished, but we only just noticed
             synth->span.note_obj[chan] = SYNTHIO_SILENCE;
+            synthio_block_graph_changed();
             continue;
         }
 
         int16_t loudness[2] = {synth->envelope_state[chan].level, synth->envelope_state[chan].level};
 
-        if (!synth_note_into_buffer(synth, chan, tmp_buffer32, dur, loudness)) {
+        // Without a filter the note is summed in while it is rendered
+        mp_obj_t filter_obj = synthio_synth_get_note_filter(note_obj);
+        int32_t *mix_buffer32 = filter_obj == mp_const_none ? out_buffer32 : NULL;
+
+        if (!synth_note_into_buffer(synth, chan, tmp_buffer32, mix_buffer32, dur, loudness)) {
             // for some other reason, such as being above nyquist, note
             // couldn't be synthed, so don't filter or sum it in
             continue;
         }
 
-        mp_obj_t filter_obj = synthio_synth_get_note_filter(note_obj);
         if (filter_obj != mp_const_none) {
             synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
-            synthio_biquad_filter_samples(&note->filter_state, tmp_buffer32, dur);
+            // filter, adjust loudness by envelope and sum in, all in one pass
+            synthio_biquad_filter_samples_sum(&note->filter_state, out_buffer32, tmp_buffer32, dur, loudness, synth->channel_count);
         }
-
-        // adjust loudness by envelope
-        sum_with_loudness(out_buffer32, tmp_buffer32, loudness, dur, synth->channel_count);
     }
 
     int16_t *out_buffer16 = (int16_t *)(void *)synth->buffers[synth->buffer_index];
@@ -397,6 +427,9 @@ bool synthio_synth_deinited(synthio_synth_t *synth) {
 void synthio_synth_deinit(synthio_synth_t *synth) {
     synth->buffers[0] = NULL;
     synth->buffers[1] = NULL;
+    if (synthio_block_recording == &synth->block_order) {
+        synthio_block_recording = NULL;
+    }
 }
 
 void synthio_synth_envelope_set(synthio_synth_t *synth, mp_obj_t envelope_obj) {
@@ -419,6 +452,7 @@ void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channe
     synth->waveform_obj = waveform_obj;
     synth->sample_rate = sample_rate;
     synthio_synth_envelope_set(synth, envelope_obj);
+    synth->block_order.valid = false;
 
     for (size_t i = 0; i < CIRCUITPY_SYNTHIO_MAX_CHANNELS; i++) {
         synth->span.note_obj[i] = SYNTHIO_SILENCE;
@@ -478,6 +512,7 @@ STATIC int find_channel_with_note(synthio_synth_t *synth, mp_obj_t note) {
 
 bool synthio_span_change_note(synthio_synth_t *synth, mp_obj_t old_note, mp_obj_t new_note) {
     int channel;
+    synthio_block_graph_changed();
     if (new_note != SYNTHIO_SILENCE && (channel = find_channel_with_note(synth, new_note)) != -1) {
         // note already playing, re-enter attack phase
         synth->envelope_state[channel].state = SYNTHIO_ENVELOPE_STATE_ATTACK;
@@ -512,6 +547,32 @@ uint32_t synthio_frequency_convert_scaled_to_dds(uint64_t frequency_scaled, int3
 void shared_bindings_synthio_lfo_tick(uint32_t sample_rate) {
     synthio_global_rate_scale = (mp_float_t)SYNTHIO_MAX_DUR / sample_rate;
     synthio_global_tick++;
+    synthio_block_recording = NULL;
+}
+
+void synthio_block_graph_changed(void) {
+    synthio_block_generation++;
+}
+
+void synthio_block_order_tick(synthio_block_order_t *order) {
+    if (order->valid && order->generation == synthio_block_generation) {
+        for (size_t i = 0; i < order->count; i++) {
+            synthio_block_slot_t slot = { order->block[i] };
+            (void)synthio_block_slot_get(&slot);
+        }
+        order->evaluated = true;
+        order->evaluated_tick = synthio_global_tick;
+        return;
+    }
+    order->generation = synthio_block_generation;
+    order->count = 0;
+    order->valid = true;
+    order->evaluated = false;
+    synthio_block_recording = order;
+}
+
+bool synthio_block_order_evaluated(synthio_block_order_t *order) {
+    return order->evaluated && order->evaluated_tick == synthio_global_tick;
 }
 
 mp_float_t synthio_block_slot_get(synthio_block_slot_t *slot) {
@@ -530,6 +591,16 @@ mp_float_t synthio_block_slot_get(synthio_block_slot_t *slot) {
     const synthio_block_proto_t *p = MP_OBJ_TYPE_GET_SLOT(mp_obj_get_type(slot->obj), protocol);
     mp_float_t value = p->tick(slot->obj);
     block->value = value;
+
+    // The inputs of this block finished first, so they are already in the order.
+    synthio_block_order_t *order = synthio_block_recording;
+    if (order) {
+        if (order->count < SYNTHIO_MAX_ORDERED_BLOCKS) {
+            order->block[order->count++] = slot->obj;
+        } else {
+            order->valid = false;
+        }
+    }
     return value;
 }
 
@@ -550,6 +621,7 @@ int32_t synthio_block_slot_get_scaled(synthio_block_slot_t *lfo_slot, mp_float_t
 }
 
 bool synthio_block_assign_slot_maybe(mp_obj_t obj, synthio_block_slot_t *slot) {
+    synthio_block_graph_changed();
     if (synthio_obj_is_block(obj)) {
         slot->obj = obj;
         return true;
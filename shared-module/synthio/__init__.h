@@ -33,6 +33,7 @@
 #define SYNTHIO_NOTE_IS_SIMPLE(note) (mp_obj_is_small_int(note))
 #define SYNTHIO_NOTE_IS_PLAYING(synth, i) ((synth)->envelope_state[(i)].state != SYNTHIO_ENVELOPE_STATE_RELEASE)
 #define SYNTHIO_FREQUENCY_SHIFT (16)
+#define SYNTHIO_MAX_ORDERED_BLOCKS (32)
 
 #include "shared-module/audiocore/__init__.h"
 #include "shared-bindings/synthio/__init__.h"
@@ -56,6 +57,18 @@ typedef struct {
     envelope_state_e state;
 } synthio_envelope_state_t;
 
+// The blocks evaluated during one tick, in the order they finished. Every block comes after
+// the blocks it reads, so later ticks evaluate the list front to back without recursing.
+// It is recorded again whenever synthio_block_generation changes.
+typedef struct {
+    mp_obj_t block[SYNTHIO_MAX_ORDERED_BLOCKS];
+    uint32_t generation;
+    uint8_t count;
+    uint8_t evaluated_tick;
+    bool valid;
+    bool evaluated;
+} synthio_block_order_t;
+
 typedef struct synthio_synth {
     uint32_t sample_rate;
     uint32_t total_envelope;
@@ -71,6 +84,7 @@ typedef struct synthio_synth {
     uint32_t accum[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
     uint32_t ring_accum[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
     synthio_envelope_state_t envelope_state[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
+    synthio_block_order_t block_order;
 } synthio_synth_t;
 
 typedef struct {
@@ -110,4 +124,12 @@ int synthio_sweep_in_step(synthio_lfo_state_t *state, uint16_t dur);
 
 extern mp_float_t synthio_global_rate_scale;
 extern uint8_t synthio_global_tick;
+extern uint32_t synthio_block_generation;
 void shared_bindings_synthio_lfo_tick(uint32_t sample_rate);
+
+// Call when a block input is assigned or the set of blocks being played changes.
+void synthio_block_graph_changed(void);
+// Evaluate the recorded blocks for the new tick, or record them if the graph changed.
+void synthio_block_order_tick(synthio_block_order_t *order);
+// True when every recorded block has already been evaluated for the current tick.
+bool synthio_block_order_evaluated(synthio_block_order_t *order);
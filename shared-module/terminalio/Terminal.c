@@ -100,9 +100,18 @@ size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, con
         // Always handle ASCII.
         if (c < 128) {
             if (c >= 0x20 && c <= 0x7e) {
-                uint8_t tile_index = fontio_builtinfont_get_glyph_index(self->font, c);
-                common_hal_displayio_tilegrid_set_tile(self->scroll_area, self->cursor_x, self->cursor_y, tile_index);
-                self->cursor_x++;
+                // Set the whole run of printable ASCII that fits on this line at once so that it
+                // is one dirty area instead of one per character.
+                uint8_t run[32];
+                uint16_t run_max = MIN(sizeof(run), self->scroll_area->width_in_tiles - self->cursor_x);
+                uint16_t run_len = 0;
+                run[run_len++] = fontio_builtinfont_get_glyph_index(self->font, c);
+                while (run_len < run_max && i < data + len && *i >= 0x20 && *i <= 0x7e) {
+                    run[run_len++] = fontio_builtinfont_get_glyph_index(self->font, *i);
+                    i++;
+                }
+                displayio_tilegrid_set_tiles(self->scroll_area, self->cursor_x, self->cursor_y, run, run_len);
+                self->cursor_x += run_len;
             } else if (c == '\r') {
                 self->cursor_x = 0;
             } else if (c == '\n') {
@@ -127,9 +136,8 @@ size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, con
                 if (i[0] == '[') {
                     if (i[1] == 'K') {
                         // Clear the rest of the line.
-                        for (uint16_t k = self->cursor_x; k < self->scroll_area->width_in_tiles; k++) {
-                            common_hal_displayio_tilegrid_set_tile(self->scroll_area, k, self->cursor_y, 0);
-                        }
+                        displayio_tilegrid_fill_tiles(self->scroll_area, self->cursor_x, self->cursor_y,
+                            self->scroll_area->width_in_tiles - self->cursor_x, 0);
                         i += 2;
                     } else {
                         if (c == 'D') {
@@ -203,9 +211,7 @@ size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, con
         if (self->cursor_y != start_y) {
             // clear the new row in case of scroll up
             if (self->cursor_y == self->scroll_area->top_left_y) {
-                for (uint16_t j = 0; j < self->scroll_area->width_in_tiles; j++) {
-                    common_hal_displayio_tilegrid_set_tile(self->scroll_area, j, self->cursor_y, 0);
-                }
+                displayio_tilegrid_fill_tiles(self->scroll_area, 0, self->cursor_y, self->scroll_area->width_in_tiles, 0);
                 common_hal_displayio_tilegrid_set_top_left(self->scroll_area, 0, (self->cursor_y + self->scroll_area->height_in_tiles + 1) % self->scroll_area->height_in_tiles);
             }
             start_y = self->cursor_y;
@@ -29,6 +29,7 @@
 #include "tusb_config.h"
 
 #include "lib/tinyusb/src/host/usbh.h"
+#include "py/ringbuf.h"
 #include "py/runtime.h"
 #include "shared/runtime/interrupt_char.h"
 #include "shared-bindings/usb/core/__init__.h"
@@ -44,8 +45,94 @@ void tuh_mount_cb(uint8_t dev_addr) {
     _mounted_devices |= 1 << dev_addr;
 }
 
+// Interrupt IN endpoints that have been read from keep a transfer queued all
+// the time, so that reports that arrive while Python is busy wait in a queue.
+#ifndef CIRCUITPY_USB_HOST_IN_QUEUES
+#define CIRCUITPY_USB_HOST_IN_QUEUES (4)
+#endif
+
+// Bytes of reports each queue holds. Each report also takes two bytes for its
+// length. The oldest reports are dropped when it is full.
+#ifndef CIRCUITPY_USB_HOST_IN_QUEUE_SIZE
+#define CIRCUITPY_USB_HOST_IN_QUEUE_SIZE (512)
+#endif
+
+typedef struct {
+    ringbuf_t reports;
+    uint8_t reports_storage[CIRCUITPY_USB_HOST_IN_QUEUE_SIZE];
+    // Full speed interrupt endpoints send at most 64 bytes at a time.
+    uint8_t packet[64];
+    uint16_t packet_size;
+    uint8_t device_number;
+    // 0 when the queue is unused.
+    uint8_t endpoint;
+    // The last transfer failed or stalled, so none is queued.
+    xfer_result_t error;
+} in_queue_t;
+
+STATIC in_queue_t _in_queues[CIRCUITPY_USB_HOST_IN_QUEUES];
+
+STATIC void _in_queue_done_cb(tuh_xfer_t *xfer);
+
+STATIC bool _in_queue_submit(size_t index) {
+    in_queue_t *queue = &_in_queues[index];
+    tuh_xfer_t xfer;
+    xfer.daddr = queue->device_number;
+    xfer.ep_addr = queue->endpoint;
+    xfer.buffer = queue->packet;
+    xfer.buflen = queue->packet_size;
+    xfer.complete_cb = _in_queue_done_cb;
+    xfer.user_data = index;
+    return tuh_edpt_xfer(&xfer);
+}
+
+STATIC void _in_queue_done_cb(tuh_xfer_t *xfer) {
+    in_queue_t *queue = &_in_queues[xfer->user_data];
+    if (queue->endpoint == 0) {
+        // Stopped while the transfer was queued.
+        return;
+    }
+    if (xfer->result != XFER_RESULT_SUCCESS) {
+        queue->error = xfer->result;
+        return;
+    }
+    size_t len = MIN(xfer->actual_len, queue->packet_size);
+    if (len > 0) {
+        while (ringbuf_num_empty(&queue->reports) < len + 2) {
+            int dropped = ringbuf_get16(&queue->reports);
+            for (int i = 0; i < dropped; i++) {
+                ringbuf_get(&queue->reports);
+            }
+        }
+        ringbuf_put16(&queue->reports, len);
+        ringbuf_put_n(&queue->reports, queue->packet, len);
+    }
+    if (!_in_queue_submit(xfer->user_data)) {
+        queue->error = XFER_RESULT_FAILED;
+    }
+}
+
+STATIC void _in_queue_stop(in_queue_t *queue) {
+    if (queue->endpoint != 0 && queue->error == XFER_RESULT_SUCCESS) {
+        tuh_edpt_abort_xfer(queue->device_number, queue->endpoint);
+    }
+    queue->endpoint = 0;
+}
+
+void usb_core_device_reset(void) {
+    for (size_t i = 0; i < CIRCUITPY_USB_HOST_IN_QUEUES; i++) {
+        _in_queue_stop(&_in_queues[i]);
+    }
+}
+
 void tuh_umount_cb(uint8_t dev_addr) {
     _mounted_devices &= ~(1 << dev_addr);
+    for (size_t i = 0; i < CIRCUITPY_USB_HOST_IN_QUEUES; i++) {
+        if (_in_queues[i].device_number == dev_addr) {
+            // TinyUSB has already dropped the device's transfers.
+            _in_queues[i].endpoint = 0;
+        }
+    }
 }
 
 STATIC xfer_result_t _xfer_result;
@@ -209,21 +296,7 @@ STATIC size_t _xfer(tuh_xfer_t *xfer, mp_int_t timeout) {
     return 0;
 }
 
-STATIC bool _open_endpoint(usb_core_device_obj_t *self, mp_int_t endpoint) {
-    bool endpoint_open = false;
-    size_t open_size = sizeof(self->open_endpoints);
-    size_t first_free = open_size;
-    for (size_t i = 0; i < open_size; i++) {
-        if (self->open_endpoints[i] == endpoint) {
-            endpoint_open = true;
-        } else if (first_free == open_size && self->open_endpoints[i] == 0) {
-            first_free = i;
-        }
-    }
-    if (endpoint_open) {
-        return true;
-    }
-
+STATIC tusb_desc_endpoint_t const *_find_endpoint(usb_core_device_obj_t *self, mp_int_t endpoint) {
     if (self->configuration_descriptor == NULL) {
         mp_raise_usb_core_USBError(MP_ERROR_TEXT("No configuration set"));
     }
@@ -246,9 +319,30 @@ STATIC bool _open_endpoint(usb_core_device_obj_t *self, mp_int_t endpoint) {
         p_desc = tu_desc_next(p_desc);
     }
     if (p_desc >= desc_end) {
+        return NULL;
+    }
+    return (tusb_desc_endpoint_t const *)p_desc;
+}
+
+STATIC bool _open_endpoint(usb_core_device_obj_t *self, mp_int_t endpoint) {
+    bool endpoint_open = false;
+    size_t open_size = sizeof(self->open_endpoints);
+    size_t first_free = open_size;
+    for (size_t i = 0; i < open_size; i++) {
+        if (self->open_endpoints[i] == endpoint) {
+            endpoint_open = true;
+        } else if (first_free == open_size && self->open_endpoints[i] == 0) {
+            first_free = i;
+        }
+    }
+    if (endpoint_open) {
+        return true;
+    }
+
+    tusb_desc_endpoint_t const *desc_ep = _find_endpoint(self, endpoint);
+    if (desc_ep == NULL) {
         return false;
     }
-    tusb_desc_endpoint_t const *desc_ep = (tusb_desc_endpoint_t const *)p_desc;
 
     bool open = tuh_edpt_open(self->device_number, desc_ep);
     if (open) {
@@ -269,10 +363,85 @@ mp_int_t common_hal_usb_core_device_write(usb_core_device_obj_t *self, mp_int_t
     return _xfer(&xfer, timeout);
 }
 
+// Returns the queue of the given interrupt IN endpoint, starting one if there
+// is room. Returns NULL for other endpoints.
+STATIC in_queue_t *_in_queue(usb_core_device_obj_t *self, mp_int_t endpoint) {
+    size_t free_index = CIRCUITPY_USB_HOST_IN_QUEUES;
+    for (size_t i = 0; i < CIRCUITPY_USB_HOST_IN_QUEUES; i++) {
+        in_queue_t *queue = &_in_queues[i];
+        if (queue->endpoint == endpoint && queue->device_number == self->device_number) {
+            return queue;
+        }
+        if (queue->endpoint == 0 && free_index == CIRCUITPY_USB_HOST_IN_QUEUES) {
+            free_index = i;
+        }
+    }
+    if (free_index == CIRCUITPY_USB_HOST_IN_QUEUES) {
+        return NULL;
+    }
+    tusb_desc_endpoint_t const *desc_ep = _find_endpoint(self, endpoint);
+    uint16_t packet_size = desc_ep == NULL ? 0 : tu_edpt_packet_size(desc_ep);
+    if (desc_ep == NULL ||
+        desc_ep->bmAttributes.xfer != TUSB_XFER_INTERRUPT ||
+        tu_edpt_dir(endpoint) != TUSB_DIR_IN ||
+        packet_size > sizeof(_in_queues[0].packet)) {
+        return NULL;
+    }
+    in_queue_t *queue = &_in_queues[free_index];
+    ringbuf_init(&queue->reports, queue->reports_storage, sizeof(queue->reports_storage));
+    queue->packet_size = packet_size;
+    queue->device_number = self->device_number;
+    queue->endpoint = endpoint;
+    queue->error = XFER_RESULT_SUCCESS;
+    if (!_in_queue_submit(free_index)) {
+        queue->endpoint = 0;
+        mp_raise_usb_core_USBError(NULL);
+    }
+    return queue;
+}
+
+// Reads the oldest queued report, waiting for one if needed.
+STATIC mp_int_t _in_queue_read(in_queue_t *queue, uint8_t *buffer, mp_int_t len, mp_int_t timeout) {
+    uint32_t start_time = supervisor_ticks_ms32();
+    while (ringbuf_num_filled(&queue->reports) == 0 &&
+           queue->error == XFER_RESULT_SUCCESS &&
+           (timeout == 0 || supervisor_ticks_ms32() - start_time < (uint32_t)timeout) &&
+           !mp_hal_is_interrupted()) {
+        RUN_BACKGROUND_TASKS;
+    }
+    if (ringbuf_num_filled(&queue->reports) == 0) {
+        if (mp_hal_is_interrupted()) {
+            return 0;
+        }
+        xfer_result_t error = queue->error;
+        if (error != XFER_RESULT_SUCCESS) {
+            // Stop so that the next read starts the queue again.
+            queue->endpoint = 0;
+            if (error == XFER_RESULT_STALLED) {
+                mp_raise_usb_core_USBError(MP_ERROR_TEXT("Pipe error"));
+            }
+            return 0;
+        }
+        mp_raise_usb_core_USBTimeoutError();
+    }
+    size_t report_len = ringbuf_get16(&queue->reports);
+    size_t copy_len = MIN(report_len, (size_t)len);
+    ringbuf_get_n(&queue->reports, buffer, copy_len);
+    // Drop what didn't fit, as a single transfer would.
+    for (size_t i = copy_len; i < report_len; i++) {
+        ringbuf_get(&queue->reports);
+    }
+    return copy_len;
+}
+
 mp_int_t common_hal_usb_core_device_read(usb_core_device_obj_t *self, mp_int_t endpoint, uint8_t *buffer, mp_int_t len, mp_int_t timeout) {
     if (!_open_endpoint(self, endpoint)) {
         mp_raise_usb_core_USBError(NULL);
     }
+    in_queue_t *queue = _in_queue(self, endpoint);
+    if (queue != NULL) {
+        return _in_queue_read(queue, buffer, len, timeout);
+    }
     tuh_xfer_t xfer;
     xfer.daddr = self->device_number;
     xfer.ep_addr = endpoint;
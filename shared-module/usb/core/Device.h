@@ -38,4 +38,7 @@ typedef struct {
     uint16_t first_langid;
 } usb_core_device_obj_t;
 
+// Stops the background reads of interrupt endpoints.
+void usb_core_device_reset(void);
+
 #endif // MICROPY_INCLUDED_SHARED_MODULE_USB_CORE_DEVICE_H
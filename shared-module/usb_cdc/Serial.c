@@ -29,7 +29,10 @@
 #include "shared-module/usb_cdc/Serial.h"
 #include "supervisor/shared/tick.h"
 
+#include "py/gc.h"
+
 #include "tusb.h"
+#include "device/usbd_pvt.h"
 
 size_t common_hal_usb_cdc_serial_read(usb_cdc_serial_obj_t *self, uint8_t *data, size_t len, int *errcode) {
 
@@ -78,10 +81,59 @@ size_t common_hal_usb_cdc_serial_read(usb_cdc_serial_obj_t *self, uint8_t *data,
     return total_num_read;
 }
 
+// Send data straight from the caller's buffer with endpoint transfers of up to
+// bulk_size bytes. The buffer must stay put until each transfer is done, so a
+// transfer that has started is always waited on; timeouts and ctrl-C are only
+// checked between transfers.
+STATIC size_t usb_cdc_serial_write_bulk(usb_cdc_serial_obj_t *self, const uint8_t *data, size_t len,
+    bool wait_forever, uint64_t timeout_ms) {
+    uint64_t start_ticks = supervisor_ticks_ms64();
+    size_t total_num_written = 0;
+    while (total_num_written < len) {
+        // Bytes already in the FIFO go first, and the endpoint must be idle.
+        tud_cdc_n_write_flush(self->idx);
+        if (tud_cdc_n_write_available(self->idx) < CFG_TUD_CDC_TX_BUFSIZE ||
+            !usbd_edpt_claim(TUD_OPT_RHPORT, self->ep_in)) {
+            if (!tud_cdc_n_connected(self->idx) ||
+                (!wait_forever && supervisor_ticks_ms64() - start_ticks > timeout_ms)) {
+                break;
+            }
+            RUN_BACKGROUND_TASKS;
+            if (mp_hal_is_interrupted()) {
+                break;
+            }
+            continue;
+        }
+        uint16_t num_to_write = MIN(len - total_num_written, self->bulk_size);
+        if (!usbd_edpt_xfer(TUD_OPT_RHPORT, self->ep_in, (uint8_t *)data + total_num_written, num_to_write)) {
+            usbd_edpt_release(TUD_OPT_RHPORT, self->ep_in);
+            break;
+        }
+        // A bus reset or unplug ends the transfer, so don't wait beyond that.
+        while (usbd_edpt_busy(TUD_OPT_RHPORT, self->ep_in) && tud_ready()) {
+            RUN_BACKGROUND_TASKS;
+        }
+        if (!tud_ready()) {
+            break;
+        }
+        total_num_written += num_to_write;
+    }
+    return total_num_written;
+}
+
 size_t common_hal_usb_cdc_serial_write(usb_cdc_serial_obj_t *self, const uint8_t *data, size_t len, int *errcode) {
     const bool wait_forever = self->write_timeout < 0.0f;
     const bool wait_for_timeout = self->write_timeout > 0.0f;
 
+    // Large writes from RAM can skip the FIFO. USB DMA on some chips can't read
+    // flash or unaligned addresses, so only use buffers on the heap.
+    if (self->bulk_size > 0 && len >= self->bulk_size && (wait_forever || wait_for_timeout) &&
+        gc_ptr_on_heap((void *)data) && ((uintptr_t)data & 3) == 0) {
+        return usb_cdc_serial_write_bulk(self, data, len, wait_forever,
+            // Junk value if write_timeout < 0.
+            float_to_uint64(self->write_timeout * 1000));
+    }
+
     // Write as many bytes as possible immediately.
     // The number of bytes written at once will not be larger than what can fit in the TinyUSB FIFO.
     uint32_t total_num_written = tud_cdc_n_write(self->idx, data, len);
@@ -34,6 +34,8 @@ typedef struct {
     mp_float_t timeout;       // if negative, wait forever.
     mp_float_t write_timeout; // if negative, wait forever.
     uint8_t idx;              // which CDC device?
+    uint8_t ep_in;            // address of the data IN endpoint
+    uint16_t bulk_size;       // if nonzero, large writes bypass the TinyUSB FIFO in transfers of up to this size
 } usb_cdc_serial_obj_t;
 
 #endif // SHARED_MODULE_USB_CDC_SERIAL_H
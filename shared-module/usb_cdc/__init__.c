@@ -170,7 +170,7 @@ static bool usb_cdc_data_is_enabled;
 
 void usb_cdc_set_defaults(void) {
     common_hal_usb_cdc_enable(CIRCUITPY_USB_CDC_CONSOLE_ENABLED_DEFAULT,
-        CIRCUITPY_USB_CDC_DATA_ENABLED_DEFAULT);
+        CIRCUITPY_USB_CDC_DATA_ENABLED_DEFAULT, 0);
 }
 
 bool usb_cdc_console_enabled(void) {
@@ -212,6 +212,7 @@ size_t usb_cdc_add_descriptor(uint8_t *descriptor_buf, descriptor_counts_t *desc
         ? (USB_CDC_EP_NUM_DATA_IN ? USB_CDC_EP_NUM_DATA_IN : descriptor_counts->current_endpoint)
         : (USB_CDC2_EP_NUM_DATA_IN ? USB_CDC2_EP_NUM_DATA_IN : descriptor_counts->current_endpoint));
     descriptor_counts->num_in_endpoints++;
+    (console ? &usb_cdc_console_obj : &usb_cdc_data_obj)->ep_in = descriptor_buf[CDC_DATA_IN_ENDPOINT_INDEX];
     descriptor_buf[CDC_DATA_OUT_ENDPOINT_INDEX] =
         console
         ? (USB_CDC_EP_NUM_DATA_OUT ? USB_CDC_EP_NUM_DATA_OUT : descriptor_counts->current_endpoint)
@@ -233,10 +234,10 @@ size_t usb_cdc_add_descriptor(uint8_t *descriptor_buf, descriptor_counts_t *desc
 }
 
 bool common_hal_usb_cdc_disable(void) {
-    return common_hal_usb_cdc_enable(false, false);
+    return common_hal_usb_cdc_enable(false, false, 0);
 }
 
-bool common_hal_usb_cdc_enable(bool console, bool data) {
+bool common_hal_usb_cdc_enable(bool console, bool data, uint16_t data_bulk_size) {
     // We can't change the descriptors once we're connected.
     if (tud_connected()) {
         return false;
@@ -259,6 +260,7 @@ bool common_hal_usb_cdc_enable(bool console, bool data) {
     if (data) {
         usb_cdc_data_obj.idx = idx;
     }
+    usb_cdc_data_obj.bulk_size = data_bulk_size;
 
 
     return true;
@@ -219,28 +219,117 @@ uint16_t common_hal_usb_hid_device_get_usage(usb_hid_device_obj_t *self) {
     return self->usage;
 }
 
-void common_hal_usb_hid_device_send_report(usb_hid_device_obj_t *self, uint8_t *report, uint8_t len, uint8_t report_id) {
+// All devices share one HID interface and so one IN endpoint. Reports sent while
+// the endpoint is busy wait here, in order, and go out from tud_hid_report_complete_cb().
+// Both run in the VM's context, so no locking is needed.
+typedef struct {
+    uint8_t report_id;
+    uint8_t len;
+    uint8_t data[CFG_TUD_HID_EP_BUFSIZE];
+} hid_queued_report_t;
+
+static hid_queued_report_t hid_report_queue[CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH];
+static uint8_t hid_report_queue_head;
+static uint8_t hid_report_queue_count;
+
+void usb_hid_device_report_queue_reset(void) {
+    hid_report_queue_head = 0;
+    hid_report_queue_count = 0;
+}
+
+// Start sending the oldest queued report, if the endpoint is free.
+static void hid_report_queue_submit(void) {
+    if (hid_report_queue_count == 0 || !tud_hid_ready()) {
+        return;
+    }
+    hid_queued_report_t *entry = &hid_report_queue[hid_report_queue_head];
+    if (!tud_hid_report(entry->report_id, entry->data, entry->len)) {
+        return;
+    }
+    hid_report_queue_head = (hid_report_queue_head + 1) % CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH;
+    hid_report_queue_count--;
+}
+
+// Replace a queued, unsent report with the same report id. Returns false if there is none.
+static bool hid_report_queue_coalesce(uint8_t report_id, const uint8_t *report, uint8_t len) {
+    for (size_t i = hid_report_queue_count; i > 0; i--) {
+        hid_queued_report_t *entry =
+            &hid_report_queue[(hid_report_queue_head + i - 1) % CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH];
+        if (entry->report_id == report_id) {
+            memcpy(entry->data, report, len);
+            entry->len = len;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool hid_report_queue_add(uint8_t report_id, const uint8_t *report, uint8_t len) {
+    if (hid_report_queue_count == CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH) {
+        return false;
+    }
+    hid_queued_report_t *entry =
+        &hid_report_queue[(hid_report_queue_head + hid_report_queue_count) % CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH];
+    entry->report_id = report_id;
+    entry->len = len;
+    memcpy(entry->data, report, len);
+    hid_report_queue_count++;
+    return true;
+}
+
+void common_hal_usb_hid_device_send_report(usb_hid_device_obj_t *self, uint8_t *report, uint8_t len, uint8_t report_id, bool coalesce) {
     // report_id and len have already been validated for this device.
     size_t id_idx = get_report_id_idx(self, report_id);
 
     mp_arg_validate_length(len, self->in_report_lengths[id_idx], MP_QSTR_report);
 
-    // Wait until interface is ready, timeout = 2 seconds
+    if (tud_suspended()) {
+        // Anything queued before the host slept is stale too.
+        usb_hid_device_report_queue_reset();
+        tud_remote_wakeup();
+        return;
+    }
+
+    hid_report_queue_submit();
+
+    // The endpoint buffer holds the report id byte in front of the report.
+    const bool queueable = len + (report_id != 0) <= CFG_TUD_HID_EP_BUFSIZE;
+    if (queueable) {
+        if (hid_report_queue_count == 0 && tud_hid_ready()) {
+            if (!tud_hid_report(report_id, report, len)) {
+                mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("USB error"));
+            }
+            return;
+        }
+        if (coalesce && hid_report_queue_coalesce(report_id, report, len)) {
+            return;
+        }
+    }
+
+    // Wait until there is room in the queue, or for the interface itself if the report
+    // is too long to queue. Timeout = 2 seconds.
     uint64_t end_ticks = supervisor_ticks_ms64() + 2000;
-    while ((supervisor_ticks_ms64() < end_ticks) && !tud_hid_ready()) {
+    while (supervisor_ticks_ms64() < end_ticks &&
+           (queueable ? hid_report_queue_count == CIRCUITPY_USB_HID_REPORT_QUEUE_LENGTH
+                      : hid_report_queue_count > 0 || !tud_hid_ready())) {
         RUN_BACKGROUND_TASKS;
+        hid_report_queue_submit();
     }
 
-    if (!tud_suspended()) {
-        if (!tud_hid_ready()) {
+    if (queueable) {
+        if (!hid_report_queue_add(report_id, report, len)) {
             mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("USB busy"));
         }
+        hid_report_queue_submit();
+        return;
+    }
 
-        if (!tud_hid_report(report_id, report, len)) {
-            mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("USB error"));
-        }
-    } else {
-        tud_remote_wakeup();
+    if (!tud_hid_ready()) {
+        mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("USB busy"));
+    }
+
+    if (!tud_hid_report(report_id, report, len)) {
+        mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("USB error"));
     }
 }
 
@@ -272,6 +361,14 @@ void usb_hid_device_create_report_buffers(usb_hid_device_obj_t *self) {
 }
 
 
+// Callback invoked when an IN report has been sent to the host.
+void tud_hid_report_complete_cb(uint8_t instance, uint8_t const *report, uint16_t len) {
+    (void)instance;
+    (void)report;
+    (void)len;
+    hid_report_queue_submit();
+}
+
 // Callback invoked when we receive Get_Report request through control endpoint
 uint16_t tud_hid_get_report_cb(uint8_t itf, uint8_t report_id, hid_report_type_t report_type, uint8_t *buffer, uint16_t reqlen) {
     (void)itf;
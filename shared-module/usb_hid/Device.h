@@ -53,6 +53,7 @@ extern const usb_hid_device_obj_t usb_hid_device_mouse_obj;
 extern const usb_hid_device_obj_t usb_hid_device_consumer_control_obj;
 
 void usb_hid_device_create_report_buffers(usb_hid_device_obj_t *self);
+void usb_hid_device_report_queue_reset(void);
 
 extern char *custom_usb_hid_interface_name;
 
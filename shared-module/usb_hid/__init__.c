@@ -257,6 +257,7 @@ void usb_hid_setup_devices(void) {
     }
 
     usb_hid_set_devices_from_hid_devices();
+    usb_hid_device_report_queue_reset();
 
     // Create report buffers on the heap.
     for (mp_int_t i = 0; i < num_hid_devices; i++) {
@@ -33,6 +33,14 @@ size_t common_hal_usb_midi_portin_read(usb_midi_portin_obj_t *self, uint8_t *dat
     return tud_midi_stream_read(data, len);
 }
 
+size_t common_hal_usb_midi_portin_read_packets(usb_midi_portin_obj_t *self, uint8_t *packets, size_t count) {
+    size_t i = 0;
+    while (i < count && tud_midi_packet_read(packets + i * 4)) {
+        i++;
+    }
+    return i;
+}
+
 uint32_t common_hal_usb_midi_portin_bytes_available(usb_midi_portin_obj_t *self) {
     return tud_midi_available();
 }
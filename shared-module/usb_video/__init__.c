@@ -5,12 +5,14 @@
 #include "shared-bindings/usb_video/__init__.h"
 #include "shared-module/bitmapfilter/macros.h"
 #include "shared-module/usb_video/__init__.h"
+#include "shared-module/usb_video/mjpeg.h"
 #include "shared-module/usb_video/uvc_usb_descriptors.h"
 #include "supervisor/background_callback.h"
 #include "supervisor/shared/tick.h"
 #include "device/usbd.h"
 
-static bool do_convert = true;
+// Rows of the RGB565 framebuffer changed since they were last converted to YUYV or MJPEG.
+static uint16_t convert_y1 = 0, convert_y2 = 0;
 static unsigned frame_num = 0;
 static unsigned tx_busy = 0;
 static unsigned interval_ms = 1000 / DEFAULT_FRAME_RATE;
@@ -20,9 +22,14 @@ static uint8_t *frame_buffer_yuyv;
 uint16_t *usb_video_framebuffer_rgb565;
 
 static bool usb_video_is_enabled = false;
+static bool usb_video_is_mjpeg = false;
 uint16_t usb_video_frame_width, usb_video_frame_height;
 
-bool shared_module_usb_video_enable(mp_int_t frame_width, mp_int_t frame_height) {
+// An MJPEG frame is only sent when it has changed, or at this interval so that hosts
+// don't decide the camera has stopped.
+#define MJPEG_REPEAT_INTERVAL_MS (1000)
+
+bool shared_module_usb_video_enable(mp_int_t frame_width, mp_int_t frame_height, bool mjpeg, mp_int_t quality) {
     if (tud_connected()) {
         return false;
     }
@@ -39,20 +46,31 @@ bool shared_module_usb_video_enable(mp_int_t frame_width, mp_int_t frame_height)
     usb_video_frame_height = frame_height;
 
     size_t framebuffer_size = usb_video_frame_width * usb_video_frame_height * 2;
-    frame_buffer_yuyv = port_malloc(framebuffer_size, false);
     uint32_t *frame_buffer_rgb565_uint32 = port_malloc(framebuffer_size, false);
     usb_video_framebuffer_rgb565 = (uint16_t *)frame_buffer_rgb565_uint32;
+    bool output_ok;
+    if (mjpeg) {
+        output_ok = usb_video_mjpeg_init(usb_video_frame_width, usb_video_frame_height, quality);
+    } else {
+        frame_buffer_yuyv = port_malloc(framebuffer_size, false);
+        output_ok = frame_buffer_yuyv != NULL;
+    }
 
-    if (!frame_buffer_yuyv || !usb_video_framebuffer_rgb565) {
+    if (!output_ok || !usb_video_framebuffer_rgb565) {
         // this will free either of the buffers allocated just above, in
         // case one succeeded and the other failed.
         shared_module_usb_video_disable();
-        m_malloc_fail(2 * framebuffer_size);
+        m_malloc_fail(mjpeg ? framebuffer_size + USB_VIDEO_MJPEG_MAX_FRAME_SIZE(frame_width, frame_height) : 2 * framebuffer_size);
+    }
+    if (frame_buffer_yuyv) {
+        memset(frame_buffer_yuyv, 0, framebuffer_size);
     }
-    memset(frame_buffer_yuyv, 0, framebuffer_size);
     memset(usb_video_framebuffer_rgb565, 0, framebuffer_size);
+    convert_y1 = 0;
+    convert_y2 = usb_video_frame_height;
 
     usb_video_is_enabled = true;
+    usb_video_is_mjpeg = mjpeg;
 
     return true;
 }
@@ -62,6 +80,8 @@ bool shared_module_usb_video_disable(void) {
         return false;
     }
     usb_video_is_enabled = false;
+    usb_video_is_mjpeg = false;
+    usb_video_mjpeg_deinit();
     port_free(frame_buffer_yuyv);
     port_free(usb_video_framebuffer_rgb565);
     frame_buffer_yuyv = NULL;
@@ -74,6 +94,13 @@ bool usb_video_enabled(void) {
 }
 
 size_t usb_video_descriptor_length(void) {
+    if (usb_video_is_mjpeg) {
+        #if CFG_TUD_VIDEO_STREAMING_BULK
+        return sizeof((char[]) {TUD_VIDEO_CAPTURE_DESCRIPTOR_MJPEG_BULK(0, 0, DEFAULT_FRAME_WIDTH, DEFAULT_FRAME_HEIGHT, DEFAULT_FRAME_RATE, CFG_TUD_VIDEO_STREAMING_EP_BUFSIZE, 0, 0)});
+        #else
+        return sizeof((char[]) {TUD_VIDEO_CAPTURE_DESCRIPTOR_MJPEG(0, 0, DEFAULT_FRAME_WIDTH, DEFAULT_FRAME_HEIGHT, DEFAULT_FRAME_RATE, 64, 0, 0)});
+        #endif
+    }
     #if CFG_TUD_VIDEO_STREAMING_BULK
     return sizeof((char[]) {TUD_VIDEO_CAPTURE_DESCRIPTOR_UNCOMPR_BULK(0, 0, DEFAULT_FRAME_WIDTH, DEFAULT_FRAME_HEIGHT, DEFAULT_FRAME_RATE, CFG_TUD_VIDEO_STREAMING_EP_BUFSIZE, 0, 0)});
     #else
@@ -82,15 +109,23 @@ size_t usb_video_descriptor_length(void) {
 }
 
 static void convert_framebuffer_maybe(void) {
-    if (!do_convert) {
+    if (convert_y1 >= convert_y2) {
         return; // new data not ready yet
     }
-    do_convert = false; // assumes this happens via background, not interrupt
+    // assumes this happens via background, not interrupt
+    if (usb_video_is_mjpeg) {
+        usb_video_mjpeg_encode_rows(usb_video_framebuffer_rgb565, convert_y1, convert_y2);
+        convert_y1 = convert_y2 = 0;
+        return;
+    }
+    size_t offset = convert_y1 * usb_video_frame_width;
+    size_t pixel_count = (convert_y2 - convert_y1) * usb_video_frame_width;
+    convert_y1 = convert_y2 = 0;
 
-    uint8_t *dest = frame_buffer_yuyv;
-    uint16_t *src = usb_video_framebuffer_rgb565;
+    uint8_t *dest = frame_buffer_yuyv + 2 * offset;
+    uint16_t *src = usb_video_framebuffer_rgb565 + offset;
 
-    for (int i = 0; i < usb_video_frame_width * usb_video_frame_height / 2; i++) {
+    for (size_t i = 0; i < pixel_count / 2; i++) {
         uint16_t p1 = IMAGE_GET_RGB565_PIXEL_FAST(src, 0);
         uint16_t p2 = IMAGE_GET_RGB565_PIXEL_FAST(src, 1);
         src += 2;
@@ -110,12 +145,32 @@ static void convert_framebuffer_maybe(void) {
     }
 }
 
-void shared_module_usb_video_swapbuffers(void) {
-    do_convert = true;
+void shared_module_usb_video_swapbuffers(uint8_t *dirty_row_bitmask) {
+    uint16_t y1 = convert_y1, y2 = convert_y2;
+    for (uint16_t y = 0; y < usb_video_frame_height; y++) {
+        if (dirty_row_bitmask && !(dirty_row_bitmask[y / 8] & (1 << (y & 7)))) {
+            continue;
+        }
+        if (y1 >= y2) {
+            y1 = y;
+        } else {
+            y1 = MIN(y1, y);
+        }
+        y2 = MAX(y2, y + 1);
+    }
+    convert_y1 = y1;
+    convert_y2 = y2;
 }
 
 size_t usb_video_add_descriptor(uint8_t *descriptor_buf, descriptor_counts_t *descriptor_counts, uint8_t *current_interface_string) {
     usb_add_interface_string(*current_interface_string, "CircuitPython UVC");
+    const uint8_t usb_video_mjpeg_descriptor[] = {
+        #if CFG_TUD_VIDEO_STREAMING_BULK
+        TUD_VIDEO_CAPTURE_DESCRIPTOR_MJPEG_BULK(*current_interface_string, descriptor_counts->current_endpoint | 0x80, usb_video_frame_width, usb_video_frame_height, DEFAULT_FRAME_RATE, 64, descriptor_counts->current_interface, descriptor_counts->current_interface + 1)
+        #else
+        TUD_VIDEO_CAPTURE_DESCRIPTOR_MJPEG(*current_interface_string, descriptor_counts->current_endpoint | 0x80, usb_video_frame_width, usb_video_frame_height, DEFAULT_FRAME_RATE, CFG_TUD_VIDEO_STREAMING_EP_BUFSIZE, descriptor_counts->current_interface, descriptor_counts->current_interface + 1)
+        #endif
+    };
     const uint8_t usb_video_descriptor[] = {
         #if CFG_TUD_VIDEO_STREAMING_BULK
         TUD_VIDEO_CAPTURE_DESCRIPTOR_UNCOMPR_BULK(*current_interface_string, descriptor_counts->current_endpoint | 0x80, usb_video_frame_width, usb_video_frame_height, DEFAULT_FRAME_RATE, 64, descriptor_counts->current_interface, descriptor_counts->current_interface + 1)
@@ -129,6 +184,11 @@ size_t usb_video_add_descriptor(uint8_t *descriptor_buf, descriptor_counts_t *de
     descriptor_counts->current_endpoint++;
     descriptor_counts->current_interface++;
 
+    if (usb_video_is_mjpeg) {
+        memcpy(descriptor_buf, usb_video_mjpeg_descriptor, sizeof(usb_video_mjpeg_descriptor));
+        return sizeof(usb_video_mjpeg_descriptor);
+    }
+
     memcpy(descriptor_buf, usb_video_descriptor, sizeof(usb_video_descriptor));
 
     return sizeof(usb_video_descriptor);
@@ -136,11 +196,28 @@ size_t usb_video_add_descriptor(uint8_t *descriptor_buf, descriptor_counts_t *de
 
 background_callback_t usb_video_cb;
 
+STATIC void usb_video_frame_xfer(void) {
+    convert_framebuffer_maybe();
+    bool result;
+    if (usb_video_is_mjpeg) {
+        size_t len;
+        const uint8_t *frame = usb_video_mjpeg_get_frame(&len);
+        result = tud_video_n_frame_xfer(0, 0, (void *)frame, len);
+    } else {
+        result = tud_video_n_frame_xfer(0, 0, (void *)frame_buffer_yuyv, usb_video_frame_width * usb_video_frame_height * 16 / 8);
+    }
+    // The frame must not be converted again until the host has all of it.
+    if (result) {
+        tx_busy = 1;
+    }
+}
+
 STATIC void usb_video_cb_fun(void *unused) {
     (void)unused;
 
     static unsigned start_ms = 0;
     static unsigned already_sent = 0;
+    static unsigned last_sent_ms = 0;
 
     if (!tud_video_n_streaming(0, 0)) {
         already_sent = 0;
@@ -151,9 +228,8 @@ STATIC void usb_video_cb_fun(void *unused) {
     if (!already_sent) {
         already_sent = 1;
         start_ms = supervisor_ticks_ms32();
-        convert_framebuffer_maybe();
-        bool result = tud_video_n_frame_xfer(0, 0, (void *)frame_buffer_yuyv, usb_video_frame_width * usb_video_frame_height * 16 / 8);
-        (void)result;
+        last_sent_ms = start_ms;
+        usb_video_frame_xfer();
     }
 
     unsigned cur = supervisor_ticks_ms32();
@@ -167,9 +243,14 @@ STATIC void usb_video_cb_fun(void *unused) {
     }
     start_ms += interval_ms;
 
-    convert_framebuffer_maybe();
-    bool result = tud_video_n_frame_xfer(0, 0, (void *)frame_buffer_yuyv, usb_video_frame_width * usb_video_frame_height * 16 / 8);
-    (void)result;
+    if (usb_video_is_mjpeg && convert_y1 >= convert_y2 && cur - last_sent_ms < MJPEG_REPEAT_INTERVAL_MS) {
+        // Nothing changed, so leave the link idle.
+        background_callback_add(&usb_video_cb, usb_video_cb_fun, NULL); // re-queue
+        return;
+    }
+    last_sent_ms = cur;
+
+    usb_video_frame_xfer();
 }
 
 
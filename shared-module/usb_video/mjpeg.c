@@ -0,0 +1,488 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/misc.h"
+#include "shared-module/bitmapfilter/macros.h"
+#include "shared-module/usb_video/mjpeg.h"
+#include "supervisor/port_heap.h"
+
+enum { HUFF_DC_LUMA, HUFF_AC_LUMA, HUFF_DC_CHROMA, HUFF_AC_CHROMA, HUFF_COUNT };
+
+typedef struct {
+    uint16_t width, height;
+    uint16_t mcu_cols, mcu_rows;
+    uint8_t quant[2][64];
+    uint16_t huff_code[HUFF_COUNT][256];
+    uint8_t huff_size[HUFF_COUNT][256];
+    // Start of each MCU row's entropy coded data in frame; the last entry is the end.
+    uint32_t *row_offset;
+    uint8_t *frame;
+    uint8_t *scratch;
+    // Bit writer state, writing into scratch.
+    size_t out_pos;
+    size_t out_limit;
+    uint32_t bit_buf;
+    int bit_count;
+    bool overflow;
+    int dc_pred[3];
+} mjpeg_encoder_t;
+
+static mjpeg_encoder_t *enc;
+
+// Tables from ITU-T T.81 Annex K.
+static const uint8_t std_quant_luma[64] = {
+    16, 11, 10, 16, 24, 40, 51, 61,
+    12, 12, 14, 19, 26, 58, 60, 55,
+    14, 13, 16, 24, 40, 57, 69, 56,
+    14, 17, 22, 29, 51, 87, 80, 62,
+    18, 22, 37, 56, 68, 109, 103, 77,
+    24, 35, 55, 64, 81, 104, 113, 92,
+    49, 64, 78, 87, 103, 121, 120, 101,
+    72, 92, 95, 98, 112, 100, 103, 99,
+};
+
+static const uint8_t std_quant_chroma[64] = {
+    17, 18, 24, 47, 99, 99, 99, 99,
+    18, 21, 26, 66, 99, 99, 99, 99,
+    24, 26, 56, 99, 99, 99, 99, 99,
+    47, 66, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99,
+};
+
+static const uint8_t zigzag[64] = {
+    0, 1, 8, 16, 9, 2, 3, 10, 17, 24, 32, 25, 18, 11, 4, 5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6, 7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+static const uint8_t dc_luma_bits[16] = { 0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0 };
+static const uint8_t dc_chroma_bits[16] = { 0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0 };
+static const uint8_t dc_vals[12] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+
+static const uint8_t ac_luma_bits[16] = { 0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7d };
+static const uint8_t ac_luma_vals[162] = {
+    0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07,
+    0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0,
+    0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+    0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+    0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5,
+    0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2,
+    0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+    0xf9, 0xfa,
+};
+
+static const uint8_t ac_chroma_bits[16] = { 0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77 };
+static const uint8_t ac_chroma_vals[162] = {
+    0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71,
+    0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0,
+    0x15, 0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26,
+    0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+    0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5,
+    0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3,
+    0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda,
+    0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+    0xf9, 0xfa,
+};
+
+static const struct {
+    const uint8_t *bits;
+    const uint8_t *vals;
+    uint8_t num_vals;
+    uint8_t class_id;
+} huff_tables[HUFF_COUNT] = {
+    [HUFF_DC_LUMA] = { dc_luma_bits, dc_vals, sizeof(dc_vals), 0x00 },
+    [HUFF_AC_LUMA] = { ac_luma_bits, ac_luma_vals, sizeof(ac_luma_vals), 0x10 },
+    [HUFF_DC_CHROMA] = { dc_chroma_bits, dc_vals, sizeof(dc_vals), 0x01 },
+    [HUFF_AC_CHROMA] = { ac_chroma_bits, ac_chroma_vals, sizeof(ac_chroma_vals), 0x11 },
+};
+
+static void build_huffman_codes(void) {
+    for (size_t t = 0; t < HUFF_COUNT; t++) {
+        uint16_t code = 0;
+        size_t k = 0;
+        for (size_t len = 1; len <= 16; len++) {
+            for (size_t i = 0; i < huff_tables[t].bits[len - 1]; i++) {
+                uint8_t val = huff_tables[t].vals[k++];
+                enc->huff_code[t][val] = code++;
+                enc->huff_size[t][val] = len;
+            }
+            code <<= 1;
+        }
+    }
+}
+
+static void build_quant_tables(uint8_t quality) {
+    // Same scaling as the IJG reference encoder.
+    int scale = quality < 50 ? 5000 / quality : 200 - quality * 2;
+    for (size_t i = 0; i < 64; i++) {
+        enc->quant[0][i] = MIN(MAX((std_quant_luma[i] * scale + 50) / 100, 1), 255);
+        enc->quant[1][i] = MIN(MAX((std_quant_chroma[i] * scale + 50) / 100, 1), 255);
+    }
+}
+
+static uint8_t *put_marker(uint8_t *p, uint8_t marker, uint16_t len) {
+    *p++ = 0xff;
+    *p++ = marker;
+    *p++ = len >> 8;
+    *p++ = len & 0xff;
+    return p;
+}
+
+static size_t write_header(uint8_t *start) {
+    uint8_t *p = start;
+    *p++ = 0xff;
+    *p++ = 0xd8; // SOI
+
+    static const uint8_t jfif[] = { 'J', 'F', 'I', 'F', 0, 1, 1, 0, 0, 1, 0, 1, 0, 0 };
+    p = put_marker(p, 0xe0, 2 + sizeof(jfif));
+    memcpy(p, jfif, sizeof(jfif));
+    p += sizeof(jfif);
+
+    p = put_marker(p, 0xdb, 2 + 2 * 65);
+    for (size_t t = 0; t < 2; t++) {
+        *p++ = t;
+        for (size_t i = 0; i < 64; i++) {
+            *p++ = enc->quant[t][zigzag[i]];
+        }
+    }
+
+    // Y is sampled 2x2, Cb and Cr 1x1, so an MCU is 16x16 pixels.
+    p = put_marker(p, 0xc0, 17);
+    *p++ = 8;
+    *p++ = enc->height >> 8;
+    *p++ = enc->height & 0xff;
+    *p++ = enc->width >> 8;
+    *p++ = enc->width & 0xff;
+    *p++ = 3;
+    static const uint8_t components[] = { 1, 0x22, 0, 2, 0x11, 1, 3, 0x11, 1 };
+    memcpy(p, components, sizeof(components));
+    p += sizeof(components);
+
+    uint16_t dht_len = 2;
+    for (size_t t = 0; t < HUFF_COUNT; t++) {
+        dht_len += 17 + huff_tables[t].num_vals;
+    }
+    p = put_marker(p, 0xc4, dht_len);
+    for (size_t t = 0; t < HUFF_COUNT; t++) {
+        *p++ = huff_tables[t].class_id;
+        memcpy(p, huff_tables[t].bits, 16);
+        p += 16;
+        memcpy(p, huff_tables[t].vals, huff_tables[t].num_vals);
+        p += huff_tables[t].num_vals;
+    }
+
+    // One restart interval per MCU row.
+    p = put_marker(p, 0xdd, 4);
+    *p++ = enc->mcu_cols >> 8;
+    *p++ = enc->mcu_cols & 0xff;
+
+    p = put_marker(p, 0xda, 12);
+    static const uint8_t scan[] = { 3, 1, 0x00, 2, 0x11, 3, 0x11, 0, 63, 0 };
+    memcpy(p, scan, sizeof(scan));
+    p += sizeof(scan);
+
+    return p - start;
+}
+
+static void put_byte(uint8_t b) {
+    if (enc->out_pos < enc->out_limit) {
+        enc->scratch[enc->out_pos++] = b;
+    } else {
+        enc->overflow = true;
+    }
+}
+
+static void put_bits(uint32_t bits, int count) {
+    enc->bit_buf = (enc->bit_buf << count) | (bits & ((1u << count) - 1));
+    enc->bit_count += count;
+    while (enc->bit_count >= 8) {
+        enc->bit_count -= 8;
+        uint8_t b = enc->bit_buf >> enc->bit_count;
+        put_byte(b);
+        if (b == 0xff) {
+            put_byte(0);
+        }
+    }
+}
+
+static void flush_bits(void) {
+    if (enc->bit_count > 0) {
+        // Pad with 1 bits to the next byte.
+        put_bits(0x7f, 8 - enc->bit_count);
+    }
+    enc->bit_buf = 0;
+    enc->bit_count = 0;
+}
+
+// Number of bits needed for the magnitude of v.
+static int bit_length(int v) {
+    if (v < 0) {
+        v = -v;
+    }
+    return v ? 32 - __builtin_clz(v) : 0;
+}
+
+#define CONST_BITS 13
+#define PASS1_BITS 2
+#define DESCALE(x, n) (((x) + (1 << ((n) - 1))) >> (n))
+
+// Integer forward DCT, as in the IJG jfdctint.c "slow but accurate" version.
+// The output is scaled up by 8.
+static void fdct_1d(int32_t *d, int stride, int shift, bool rows) {
+    int32_t tmp0 = d[0] + d[7 * stride];
+    int32_t tmp7 = d[0] - d[7 * stride];
+    int32_t tmp1 = d[1 * stride] + d[6 * stride];
+    int32_t tmp6 = d[1 * stride] - d[6 * stride];
+    int32_t tmp2 = d[2 * stride] + d[5 * stride];
+    int32_t tmp5 = d[2 * stride] - d[5 * stride];
+    int32_t tmp3 = d[3 * stride] + d[4 * stride];
+    int32_t tmp4 = d[3 * stride] - d[4 * stride];
+
+    int32_t tmp10 = tmp0 + tmp3;
+    int32_t tmp13 = tmp0 - tmp3;
+    int32_t tmp11 = tmp1 + tmp2;
+    int32_t tmp12 = tmp1 - tmp2;
+
+    if (rows) {
+        d[0] = (tmp10 + tmp11) * (1 << PASS1_BITS);
+        d[4 * stride] = (tmp10 - tmp11) * (1 << PASS1_BITS);
+    } else {
+        d[0] = DESCALE(tmp10 + tmp11, PASS1_BITS);
+        d[4 * stride] = DESCALE(tmp10 - tmp11, PASS1_BITS);
+    }
+
+    int32_t z1 = (tmp12 + tmp13) * 4433;
+    d[2 * stride] = DESCALE(z1 + tmp13 * 6270, shift);
+    d[6 * stride] = DESCALE(z1 - tmp12 * 15137, shift);
+
+    z1 = tmp4 + tmp7;
+    int32_t z2 = tmp5 + tmp6;
+    int32_t z3 = tmp4 + tmp6;
+    int32_t z4 = tmp5 + tmp7;
+    int32_t z5 = (z3 + z4) * 9633;
+
+    tmp4 *= 2446;
+    tmp5 *= 16819;
+    tmp6 *= 25172;
+    tmp7 *= 12299;
+    z1 *= -7373;
+    z2 *= -20995;
+    z3 = z3 * -16069 + z5;
+    z4 = z4 * -3196 + z5;
+
+    d[7 * stride] = DESCALE(tmp4 + z1 + z3, shift);
+    d[5 * stride] = DESCALE(tmp5 + z2 + z4, shift);
+    d[3 * stride] = DESCALE(tmp6 + z2 + z3, shift);
+    d[1 * stride] = DESCALE(tmp7 + z1 + z4, shift);
+}
+
+// Transform, quantize and entropy code one 8x8 block of level shifted samples.
+static void encode_block(int32_t *block, int component, bool dc_only) {
+    for (size_t i = 0; i < 64; i += 8) {
+        fdct_1d(block + i, 1, CONST_BITS - PASS1_BITS, true);
+    }
+    for (size_t i = 0; i < 8; i++) {
+        fdct_1d(block + i, 8, CONST_BITS + PASS1_BITS, false);
+    }
+
+    const uint8_t *quant = enc->quant[component ? 1 : 0];
+    const int dc_table = component ? HUFF_DC_CHROMA : HUFF_DC_LUMA;
+    const int ac_table = component ? HUFF_AC_CHROMA : HUFF_AC_LUMA;
+
+    int coef[64];
+    for (size_t k = 0; k < 64; k++) {
+        int32_t v = block[zigzag[k]];
+        int32_t q = quant[zigzag[k]] * 8;
+        coef[k] = v < 0 ? -((-v + q / 2) / q) : (v + q / 2) / q;
+    }
+
+    int diff = coef[0] - enc->dc_pred[component];
+    enc->dc_pred[component] = coef[0];
+    int nbits = bit_length(diff);
+    put_bits(enc->huff_code[dc_table][nbits], enc->huff_size[dc_table][nbits]);
+    if (nbits) {
+        put_bits(diff < 0 ? diff - 1 : diff, nbits);
+    }
+
+    int run = 0;
+    for (size_t k = 1; k < 64 && !dc_only; k++) {
+        int v = coef[k];
+        if (v == 0) {
+            run++;
+            continue;
+        }
+        while (run > 15) {
+            put_bits(enc->huff_code[ac_table][0xf0], enc->huff_size[ac_table][0xf0]);
+            run -= 16;
+        }
+        nbits = bit_length(v);
+        uint8_t symbol = (run << 4) | nbits;
+        put_bits(enc->huff_code[ac_table][symbol], enc->huff_size[ac_table][symbol]);
+        put_bits(v < 0 ? v - 1 : v, nbits);
+        run = 0;
+    }
+    if (run > 0 || dc_only) {
+        put_bits(enc->huff_code[ac_table][0x00], enc->huff_size[ac_table][0x00]);
+    }
+}
+
+static void encode_mcu(const uint16_t *rgb565, uint16_t mx, uint16_t my, bool dc_only) {
+    int32_t y_blocks[4][64];
+    int32_t cb_block[64];
+    int32_t cr_block[64];
+    memset(cb_block, 0, sizeof(cb_block));
+    memset(cr_block, 0, sizeof(cr_block));
+
+    for (int dy = 0; dy < 16; dy++) {
+        // Pixels past the edge repeat the last row and column.
+        uint16_t y = MIN(my * 16 + dy, enc->height - 1);
+        const uint16_t *row = rgb565 + y * enc->width;
+        for (int dx = 0; dx < 16; dx++) {
+            uint16_t x = MIN(mx * 16 + dx, enc->width - 1);
+            uint16_t pixel = IMAGE_GET_RGB565_PIXEL_FAST(row, x);
+            int r = COLOR_RGB565_TO_R8(pixel);
+            int g = COLOR_RGB565_TO_G8(pixel);
+            int b = COLOR_RGB565_TO_B8(pixel);
+            y_blocks[(dy / 8) * 2 + dx / 8][(dy % 8) * 8 + dx % 8] = ((77 * r + 150 * g + 29 * b + 128) >> 8) - 128;
+            int c = (dy / 2) * 8 + dx / 2;
+            cb_block[c] += -43 * r - 85 * g + 128 * b;
+            cr_block[c] += 128 * r - 107 * g - 21 * b;
+        }
+    }
+    for (size_t i = 0; i < 64; i++) {
+        // Average of four pixels, already centred on zero.
+        cb_block[i] = DESCALE(cb_block[i], 10);
+        cr_block[i] = DESCALE(cr_block[i], 10);
+    }
+
+    for (size_t i = 0; i < 4; i++) {
+        encode_block(y_blocks[i], 0, dc_only);
+    }
+    encode_block(cb_block, 1, dc_only);
+    encode_block(cr_block, 2, dc_only);
+}
+
+// Encode one MCU row into scratch, with the restart marker that precedes it.
+static size_t encode_mcu_row(const uint16_t *rgb565, uint16_t my, bool dc_only) {
+    enc->out_pos = 0;
+    enc->out_limit = USB_VIDEO_MJPEG_ROW_BUDGET(enc->width);
+    enc->bit_buf = 0;
+    enc->bit_count = 0;
+    enc->overflow = false;
+    memset(enc->dc_pred, 0, sizeof(enc->dc_pred));
+    if (my > 0) {
+        put_byte(0xff);
+        put_byte(0xd0 + ((my - 1) & 7));
+    }
+    for (uint16_t mx = 0; mx < enc->mcu_cols && !enc->overflow; mx++) {
+        encode_mcu(rgb565, mx, my, dc_only);
+    }
+    flush_bits();
+    return enc->out_pos;
+}
+
+bool usb_video_mjpeg_init(uint16_t width, uint16_t height, uint8_t quality) {
+    usb_video_mjpeg_deinit();
+    enc = port_malloc(sizeof(mjpeg_encoder_t), false);
+    if (!enc) {
+        return false;
+    }
+    memset(enc, 0, sizeof(mjpeg_encoder_t));
+    enc->width = width;
+    enc->height = height;
+    enc->mcu_cols = (width + 15) / 16;
+    enc->mcu_rows = (height + 15) / 16;
+    enc->row_offset = port_malloc((enc->mcu_rows + 1) * sizeof(uint32_t), false);
+    enc->frame = port_malloc(USB_VIDEO_MJPEG_MAX_FRAME_SIZE(width, height), false);
+    enc->scratch = port_malloc(USB_VIDEO_MJPEG_ROW_BUDGET(width), false);
+    if (!enc->row_offset || !enc->frame || !enc->scratch) {
+        usb_video_mjpeg_deinit();
+        return false;
+    }
+
+    build_huffman_codes();
+    build_quant_tables(quality);
+    size_t header_len = write_header(enc->frame);
+    // Every row starts out empty; the first encode fills them all in.
+    for (size_t i = 0; i <= enc->mcu_rows; i++) {
+        enc->row_offset[i] = header_len;
+    }
+    return true;
+}
+
+void usb_video_mjpeg_deinit(void) {
+    if (!enc) {
+        return;
+    }
+    port_free(enc->row_offset);
+    port_free(enc->frame);
+    port_free(enc->scratch);
+    port_free(enc);
+    enc = NULL;
+}
+
+void usb_video_mjpeg_encode_rows(const uint16_t *rgb565, uint16_t y1, uint16_t y2) {
+    if (!enc || y1 >= y2) {
+        return;
+    }
+    uint16_t last_row = MIN((y2 + 15) / 16, enc->mcu_rows);
+    for (uint16_t my = y1 / 16; my < last_row; my++) {
+        size_t len = encode_mcu_row(rgb565, my, false);
+        if (enc->overflow) {
+            // Too detailed for its share of the frame, so send a blurred version.
+            len = encode_mcu_row(rgb565, my, true);
+        }
+
+        // Move the rows after this one to fit the new length, then copy it in.
+        uint32_t *offset = enc->row_offset;
+        uint32_t end = offset[enc->mcu_rows];
+        int32_t delta = (int32_t)len - (int32_t)(offset[my + 1] - offset[my]);
+        memmove(enc->frame + offset[my + 1] + delta, enc->frame + offset[my + 1], end - offset[my + 1]);
+        memcpy(enc->frame + offset[my], enc->scratch, len);
+        for (size_t i = my + 1; i <= enc->mcu_rows; i++) {
+            offset[i] += delta;
+        }
+    }
+}
+
+const uint8_t *usb_video_mjpeg_get_frame(size_t *len) {
+    uint32_t end = enc->row_offset[enc->mcu_rows];
+    enc->frame[end] = 0xff;
+    enc->frame[end + 1] = 0xd9; // EOI
+    *len = end + 2;
+    return enc->frame;
+}
@@ -0,0 +1,48 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Baseline JPEG encoder for the usb_video MJPEG stream. Frames are YCbCr 4:2:0 with a
+// restart marker after every row of 16x16 MCUs, so each MCU row is entropy coded on its
+// own and only rows that changed need to be encoded again.
+
+// Worst case frame: the headers, plus 2 bytes per pixel and a restart marker per MCU row.
+// A row that would not fit in its share falls back to DC coefficients only.
+#define USB_VIDEO_MJPEG_HEADER_MAX (640)
+#define USB_VIDEO_MJPEG_ROW_BUDGET(width) (((size_t)(width) + 15) / 16 * 16 * 16 * 2 + 2)
+#define USB_VIDEO_MJPEG_MAX_FRAME_SIZE(width, height) \
+    (USB_VIDEO_MJPEG_HEADER_MAX + (((height) + 15) / 16) * USB_VIDEO_MJPEG_ROW_BUDGET(width) + 2)
+
+bool usb_video_mjpeg_init(uint16_t width, uint16_t height, uint8_t quality);
+void usb_video_mjpeg_deinit(void);
+// Encode the MCU rows covering pixel rows [y1, y2) of the byte-swapped RGB565 framebuffer.
+void usb_video_mjpeg_encode_rows(const uint16_t *rgb565, uint16_t y1, uint16_t y2);
+const uint8_t *usb_video_mjpeg_get_frame(size_t *len);
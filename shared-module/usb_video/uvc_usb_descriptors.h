@@ -156,7 +156,7 @@
     /* EP */ \
     TUD_VIDEO_DESC_EP_ISO(_epin, _epsize, 1)
 
-#define TUD_VIDEO_CAPTURE_DESCRIPTOR_MJPEG(_stridx, _epin, _width, _height, _fps, _epsize) \
+#define TUD_VIDEO_CAPTURE_DESCRIPTOR_MJPEG(_stridx, _epin, _width, _height, _fps, _epsize, _itf_num_video_control, _itf_num_video_streaming) \
     TUD_VIDEO_DESC_IAD(_itf_num_video_control, /* 2 Interfaces */ 0x02, _stridx), \
     /* Video control 0 */ \
     TUD_VIDEO_DESC_STD_VC(_itf_num_video_control, 0, _stridx), \
@@ -185,7 +185,7 @@
     /* Video stream frame format */ \
     TUD_VIDEO_DESC_CS_VS_FRM_MJPEG_CONT(/*bFrameIndex */ 1, 0, _width, _height, \
     _width * _height * 16, _width * _height * 16 * _fps, \
-    _width * _height * 16 / 8, \
+    USB_VIDEO_MJPEG_MAX_FRAME_SIZE(_width, _height), \
     (10000000 / _fps), (10000000 / _fps), (10000000 / _fps) * _fps, (10000000 / _fps)), \
     TUD_VIDEO_DESC_CS_VS_COLOR_MATCHING(VIDEO_COLOR_PRIMARIES_BT709, VIDEO_COLOR_XFER_CH_BT709, VIDEO_COLOR_COEF_SMPTE170M), \
     /* VS alt 1 */ \
@@ -228,7 +228,7 @@
     TUD_VIDEO_DESC_CS_VS_COLOR_MATCHING(VIDEO_COLOR_PRIMARIES_BT709, VIDEO_COLOR_XFER_CH_BT709, VIDEO_COLOR_COEF_SMPTE170M), \
     TUD_VIDEO_DESC_EP_BULK(_epin, _epsize, 1)
 
-#define TUD_VIDEO_CAPTURE_DESCRIPTOR_MJPEG_BULK(_stridx, _epin, _width, _height, _fps, _epsize) \
+#define TUD_VIDEO_CAPTURE_DESCRIPTOR_MJPEG_BULK(_stridx, _epin, _width, _height, _fps, _epsize, _itf_num_video_control, _itf_num_video_streaming) \
     TUD_VIDEO_DESC_IAD(_itf_num_video_control, /* 2 Interfaces */ 0x02, _stridx), \
     /* Video control 0 */ \
     TUD_VIDEO_DESC_STD_VC(_itf_num_video_control, 0, _stridx), \
@@ -257,7 +257,7 @@
     /* Video stream frame format */ \
     TUD_VIDEO_DESC_CS_VS_FRM_MJPEG_CONT(/*bFrameIndex */ 1, 0, _width, _height, \
     _width * _height * 16, _width * _height * 16 * _fps, \
-    _width * _height * 16 / 8, \
+    USB_VIDEO_MJPEG_MAX_FRAME_SIZE(_width, _height), \
     (10000000 / _fps), (10000000 / _fps), (10000000 / _fps) * _fps, (10000000 / _fps)), \
     TUD_VIDEO_DESC_CS_VS_COLOR_MATCHING(VIDEO_COLOR_PRIMARIES_BT709, VIDEO_COLOR_XFER_CH_BT709, VIDEO_COLOR_COEF_SMPTE170M), \
     /* EP */ \
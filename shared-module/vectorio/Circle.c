@@ -39,6 +39,28 @@ uint32_t common_hal_vectorio_circle_get_pixel(void *obj, int16_t x, int16_t y) {
     return pythagorasSmallerThanRadius ? self->color_index : 0;
 }
 
+// The pixels get_pixel covers are exactly those with x * x + y * y <= radius * radius, so each
+// row (or column) is covered out to the integer square root of what remains.
+uint32_t common_hal_vectorio_circle_get_span(void *obj, int16_t x, int16_t y, bool column, int16_t *start, int16_t *end) {
+    vectorio_circle_t *self = obj;
+    int32_t radius = self->radius;
+    int32_t fixed = abs(column ? x : y);
+    if (fixed > radius) {
+        return 0;
+    }
+    int32_t remaining = radius * radius - fixed * fixed;
+    int32_t half_width = 0;
+    for (int32_t bit = 1 << 14; bit > 0; bit >>= 1) {
+        int32_t candidate = half_width | bit;
+        if (candidate * candidate <= remaining) {
+            half_width = candidate;
+        }
+    }
+    *start = -half_width;
+    *end = half_width + 1;
+    return self->color_index;
+}
+
 
 void common_hal_vectorio_circle_get_area(void *circle, displayio_area_t *out_area) {
     vectorio_circle_t *self = circle;
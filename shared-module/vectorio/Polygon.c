@@ -51,6 +51,10 @@ static void _clobber_points_list(vectorio_polygon_t *self, mp_obj_t points_tuple
 
     self->points_list = points_list;
     self->len = 2 * len;
+
+    // A column crosses each edge at most twice; a row at most once.
+    self->scanline_valid = false;
+    self->scanline_crossings = gc_realloc(self->scanline_crossings, self->len * sizeof(vectorio_polygon_crossing_t), true);
 }
 
 
@@ -59,6 +63,9 @@ void common_hal_vectorio_polygon_construct(vectorio_polygon_t *self, mp_obj_t po
     VECTORIO_POLYGON_DEBUG("%p polygon_construct: ", self);
     self->points_list = NULL;
     self->len = 0;
+    self->scanline_crossings = NULL;
+    self->scanline_crossing_count = 0;
+    self->scanline_valid = false;
     self->on_dirty.obj = NULL;
     self->color_index = color_index + 1;
     _clobber_points_list(self, points_list);
@@ -144,6 +151,107 @@ __attribute__((always_inline)) static inline int line_side(int16_t x1, int16_t y
 }
 
 
+static inline int32_t floor_div(int32_t a, int32_t b) {
+    int32_t q = a / b;
+    if ((a % b != 0) && ((a < 0) != (b < 0))) {
+        --q;
+    }
+    return q;
+}
+
+static inline int32_t ceil_div(int32_t a, int32_t b) {
+    int32_t q = a / b;
+    if ((a % b != 0) && ((a < 0) == (b < 0))) {
+        ++q;
+    }
+    return q;
+}
+
+static void add_crossing(vectorio_polygon_t *self, int32_t position, int8_t winding) {
+    vectorio_polygon_crossing_t *crossings = self->scanline_crossings;
+    // Insertion sort; scanlines only cross a handful of edges.
+    uint16_t i = self->scanline_crossing_count;
+    while (i > 0 && crossings[i - 1].position > position) {
+        crossings[i] = crossings[i - 1];
+        --i;
+    }
+    crossings[i].position = position;
+    crossings[i].winding = winding;
+    ++self->scanline_crossing_count;
+}
+
+// Works out where the winding number changes along a row or column so get_pixel
+// doesn't have to walk every edge for every pixel on it. This applies the same
+// per-edge tests as the winding computation in get_pixel, solved for the moving
+// coordinate, so the result is identical pixel for pixel.
+void common_hal_vectorio_polygon_prepare_scanline(void *obj, int16_t x, int16_t y, bool column) {
+    vectorio_polygon_t *self = obj;
+    self->scanline_valid = false;
+    if (self->len == 0 || self->scanline_crossings == NULL) {
+        return;
+    }
+    self->scanline_crossing_count = 0;
+    self->scanline_base_winding = 0;
+
+    int16_t x1 = self->points_list[0];
+    int16_t y1 = self->points_list[1];
+    for (uint16_t i = 2; i <= self->len + 1; ++i) {
+        int16_t x2 = self->points_list[i % self->len];
+        ++i;
+        int16_t y2 = self->points_list[i % self->len];
+
+        // Edges wind over the rows [top, bottom). Horizontal edges never wind.
+        int8_t winding;
+        int32_t top;
+        int32_t bottom;
+        if (y1 < y2) {
+            winding = 1;
+            top = y1;
+            bottom = y2;
+        } else if (y2 < y1) {
+            winding = -1;
+            top = y2;
+            bottom = y1;
+        } else {
+            x1 = x2;
+            y1 = y2;
+            continue;
+        }
+
+        if (!column) {
+            if (top <= y && y < bottom) {
+                // Winds for every x left of where the edge crosses the row.
+                int32_t crossing = x1 + ceil_div((int32_t)(y - y1) * (x2 - x1), y2 - y1);
+                self->scanline_base_winding += winding;
+                add_crossing(self, crossing, -winding);
+            }
+        } else {
+            // Winds where the point is on the winding side of the edge, which is a half-line along the column.
+            int32_t a = (int32_t)(x - x1) * (y2 - y1);
+            int32_t b = x2 - x1;
+            if (b == 0) {
+                if (winding > 0 ? a >= 0 : a <= 0) {
+                    top = bottom;
+                }
+            } else if ((winding > 0) == (b > 0)) {
+                top = MAX(top, y1 + floor_div(a, b) + 1);
+            } else {
+                bottom = MIN(bottom, y1 + ceil_div(a, b));
+            }
+            if (top < bottom) {
+                add_crossing(self, top, winding);
+                add_crossing(self, bottom, -winding);
+            }
+        }
+
+        x1 = x2;
+        y1 = y2;
+    }
+    self->scanline = column ? x : y;
+    self->scanline_column = column;
+    self->scanline_valid = true;
+}
+
 uint32_t common_hal_vectorio_polygon_get_pixel(void *obj, int16_t x, int16_t y) {
     VECTORIO_POLYGON_DEBUG("%p polygon get_pixel %d, %d\n", obj, x, y);
     vectorio_polygon_t *self = obj;
@@ -152,6 +260,18 @@ uint32_t common_hal_vectorio_polygon_get_pixel(void *obj, int16_t x, int16_t y)
         return 0;
     }
 
+    if (self->scanline_valid && self->scanline == (self->scanline_column ? x : y)) {
+        int32_t position = self->scanline_column ? y : x;
+        int16_t winding_number = self->scanline_base_winding;
+        for (uint16_t i = 0; i < self->scanline_crossing_count; ++i) {
+            if (self->scanline_crossings[i].position > position) {
+                break;
+            }
+            winding_number += self->scanline_crossings[i].winding;
+        }
+        return winding_number == 0 ? 0 : self->color_index;
+    }
+
     int16_t winding_number = 0;
     int16_t x1 = self->points_list[0];
     int16_t y1 = self->points_list[1];
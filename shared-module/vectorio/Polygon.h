@@ -6,10 +6,24 @@
 #include "py/obj.h"
 #include "shared-module/vectorio/__init__.h"
 
+// A change in winding number at a position along a scanline.
+typedef struct {
+    int32_t position;
+    int8_t winding;
+} vectorio_polygon_crossing_t;
+
 typedef struct {
     mp_obj_base_t base;
     // An int array[ x, y, ... ]
     int16_t *points_list;
+    // Winding changes along the prepared scanline sorted by position. Room for len entries.
+    vectorio_polygon_crossing_t *scanline_crossings;
+    uint16_t scanline_crossing_count;
+    int16_t scanline_base_winding;
+    // The fixed coordinate of the prepared scanline: y for a row or x for a column.
+    int16_t scanline;
+    bool scanline_column;
+    bool scanline_valid;
     uint16_t len;
     uint16_t color_index;
     vectorio_event_t on_dirty;
@@ -27,6 +27,18 @@ uint32_t common_hal_vectorio_rectangle_get_pixel(void *obj, int16_t x, int16_t y
     return 0;
 }
 
+uint32_t common_hal_vectorio_rectangle_get_span(void *obj, int16_t x, int16_t y, bool column, int16_t *start, int16_t *end) {
+    vectorio_rectangle_t *self = obj;
+    int16_t fixed = column ? x : y;
+    int16_t length = column ? self->width : self->height;
+    if (fixed < 0 || fixed >= length) {
+        return 0;
+    }
+    *start = 0;
+    *end = column ? self->height : self->width;
+    return self->color_index;
+}
+
 
 void common_hal_vectorio_rectangle_get_area(void *rectangle, displayio_area_t *out_area) {
     vectorio_rectangle_t *self = rectangle;
@@ -315,6 +315,136 @@ void common_hal_vectorio_vector_shape_set_pixel_shader(vectorio_vector_shape_t *
     common_hal_vectorio_vector_shape_set_dirty(self);
 }
 
+inline __attribute__((always_inline))
+static void _write_pixel(const _displayio_colorspace_t *colorspace, uint32_t *buffer, uint16_t pixel_index, uint16_t linestride_px, uint32_t pixel) {
+    if (colorspace->depth == 16) {
+        *(((uint16_t *)buffer) + pixel_index) = pixel;
+    } else if (colorspace->depth == 32) {
+        *(((uint32_t *)buffer) + pixel_index) = pixel;
+    } else if (colorspace->depth == 8) {
+        *(((uint8_t *)buffer) + pixel_index) = pixel;
+    } else if (colorspace->depth < 8) {
+        uint8_t pixels_per_byte = 8 / colorspace->depth;
+        // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
+        if (!colorspace->pixels_in_byte_share_row) {
+            uint16_t row = pixel_index / linestride_px;
+            uint16_t col = pixel_index % linestride_px;
+            pixel_index = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * linestride_px + row % pixels_per_byte;
+        }
+        uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
+        if (colorspace->reverse_pixels_in_byte) {
+            // Reverse the shift by subtracting it from the leftmost shift.
+            shift = (pixels_per_byte - 1) * colorspace->depth - shift;
+        }
+        ((uint8_t *)buffer)[pixel_index / pixels_per_byte] |= pixel << shift;
+    }
+}
+
+static void _convert_pixel(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_pixel) {
+    output_pixel->pixel = 0;
+    output_pixel->opaque = true;
+    if (self->pixel_shader == mp_const_none) {
+        output_pixel->pixel = input_pixel->pixel;
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+        displayio_palette_get_color(self->pixel_shader, colorspace, input_pixel, output_pixel);
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+        displayio_colorconverter_convert(self->pixel_shader, colorspace, input_pixel, output_pixel);
+    }
+}
+
+// Fills the run of screen row y that the shape covers, given by the shape's get_span, with one
+// converted color. Dithering varies the color by position so then each pixel is converted.
+// Returns false if any unmasked pixel of the row within overlap is left uncovered.
+static bool _fill_span(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace,
+    const displayio_area_t *overlap, int16_t y, uint16_t mask_start_px, uint16_t linestride_px,
+    uint32_t *mask, uint32_t *buffer) {
+    int16_t shape_x;
+    int16_t shape_y;
+    screen_to_shape_coordinates(self, overlap->x1, y, &shape_x, &shape_y);
+    bool column = self->absolute_transform->transpose_xy;
+    int16_t span_start;
+    int16_t span_end;
+    displayio_input_pixel_t input_pixel;
+    input_pixel.pixel = self->ishape.get_span(self->ishape.shape, shape_x, shape_y, column, &span_start, &span_end);
+    int32_t start = overlap->x2;
+    int32_t end = overlap->x2;
+    if (input_pixel.pixel != 0) {
+        // Moving right on the screen steps the shape coordinate by one, backwards when mirrored.
+        int32_t origin = column ? shape_y : shape_x;
+        if (self->absolute_transform->dx < 1) {
+            start = overlap->x1 + origin - span_end + 1;
+            end = overlap->x1 + origin - span_start + 1;
+        } else {
+            start = overlap->x1 + span_start - origin;
+            end = overlap->x1 + span_end - origin;
+        }
+        start = MAX(start, overlap->x1);
+        end = MIN(end, overlap->x2);
+    }
+    bool covered = true;
+    if (start >= end) {
+        start = end = overlap->x2;
+    }
+    if (start > overlap->x1 || end < overlap->x2) {
+        // Only unmasked pixels outside the run make the area not fully covered.
+        for (int32_t x = overlap->x1; x < overlap->x2 && covered; x++) {
+            if (x == start) {
+                x = end - 1;
+                continue;
+            }
+            uint16_t pixel_index = mask_start_px + (x - overlap->x1);
+            if ((mask[pixel_index / 32] & (1u << (pixel_index % 32))) == 0) {
+                covered = false;
+            }
+        }
+    }
+    if (start >= end) {
+        return covered;
+    }
+
+    // Pull the pixel value index down to 0-base like get_pixel's values.
+    input_pixel.pixel -= 1;
+    input_pixel.y = y;
+    input_pixel.x = start;
+    displayio_output_pixel_t output_pixel;
+    _convert_pixel(self, colorspace, &input_pixel, &output_pixel);
+    bool dither = colorspace->dither ||
+        (mp_obj_is_type(self->pixel_shader, &displayio_palette_type) && common_hal_displayio_palette_get_dither(self->pixel_shader)) ||
+        (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type) && common_hal_displayio_colorconverter_get_dither(self->pixel_shader));
+    if (!output_pixel.opaque) {
+        covered = false;
+    }
+
+    uint16_t pixel_index = mask_start_px + (start - overlap->x1);
+    for (int32_t x = start; x < end; x++, pixel_index++) {
+        uint32_t *mask_doubleword = &mask[pixel_index / 32];
+        uint32_t mask_bit = 1u << (pixel_index % 32);
+        if (!dither && mask_bit == 1 && *mask_doubleword == 0 && x + 32 <= end) {
+            // A whole mask word of untouched pixels.
+            *mask_doubleword = 0xffffffff;
+            for (uint8_t i = 0; i < 32; i++) {
+                _write_pixel(colorspace, buffer, pixel_index + i, linestride_px, output_pixel.pixel);
+            }
+            x += 31;
+            pixel_index += 31;
+            continue;
+        }
+        if ((*mask_doubleword & mask_bit) != 0) {
+            continue;
+        }
+        if (dither) {
+            input_pixel.x = x;
+            _convert_pixel(self, colorspace, &input_pixel, &output_pixel);
+            if (!output_pixel.opaque) {
+                covered = false;
+            }
+        }
+        *mask_doubleword |= mask_bit;
+        _write_pixel(colorspace, buffer, pixel_index, linestride_px, output_pixel.pixel);
+    }
+    return covered;
+}
+
 bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
     // Shape areas are relative to 0,0.  This will allow rotation about a known axis.
     //   The consequence is that the area reported by the shape itself is _relative_ to 0,0.
@@ -343,7 +473,6 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
 
     bool full_coverage = displayio_area_equal(area, &overlap);
 
-    uint8_t pixels_per_byte = 8 / colorspace->depth;
     VECTORIO_SHAPE_DEBUG(" xy:(%3d %3d) tform:{x:%d y:%d dx:%d dy:%d scl:%d w:%d h:%d mx:%d my:%d tr:%d}",
         self->x, self->y,
         self->absolute_transform->x, self->absolute_transform->y, self->absolute_transform->dx, self->absolute_transform->dy, self->absolute_transform->scale,
@@ -353,8 +482,8 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
     uint16_t linestride_px = displayio_area_width(area);
     uint16_t line_dirty_offset_px = (overlap.y1 - area->y1) * linestride_px;
     uint16_t column_dirty_offset_px = overlap.x1 - area->x1;
-    VECTORIO_SHAPE_DEBUG(", linestride:%3d line_offset:%3d col_offset:%3d depth:%2d ppb:%2d shape:%s",
-        linestride_px, line_dirty_offset_px, column_dirty_offset_px, colorspace->depth, pixels_per_byte, mp_obj_get_type_str(self->ishape.shape));
+    VECTORIO_SHAPE_DEBUG(", linestride:%3d line_offset:%3d col_offset:%3d depth:%2d shape:%s",
+        linestride_px, line_dirty_offset_px, column_dirty_offset_px, colorspace->depth, mp_obj_get_type_str(self->ishape.shape));
 
     displayio_input_pixel_t input_pixel;
     displayio_output_pixel_t output_pixel;
@@ -365,6 +494,20 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
     uint16_t mask_start_px = line_dirty_offset_px;
     for (input_pixel.y = overlap.y1; input_pixel.y < overlap.y2; ++input_pixel.y) {
         mask_start_px += column_dirty_offset_px;
+        if (self->ishape.get_span != NULL) {
+            if (!_fill_span(self, colorspace, &overlap, input_pixel.y, mask_start_px, linestride_px, mask, buffer)) {
+                full_coverage = false;
+            }
+            mask_start_px += linestride_px - column_dirty_offset_px;
+            continue;
+        }
+        if (self->ishape.prepare_scanline != NULL) {
+            // A screen row is a shape column when transposed.
+            int16_t line_x;
+            int16_t line_y;
+            screen_to_shape_coordinates(self, overlap.x1, input_pixel.y, &line_x, &line_y);
+            self->ishape.prepare_scanline(self->ishape.shape, line_x, line_y, self->absolute_transform->transpose_xy);
+        }
         for (input_pixel.x = overlap.x1; input_pixel.x < overlap.x2; ++input_pixel.x) {
             // Check the mask first to see if the pixel has already been set.
             uint16_t pixel_index = mask_start_px + (input_pixel.x - overlap.x1);
@@ -401,15 +544,7 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
             } else {
                 // Pixel is not transparent. Let's pull the pixel value index down to 0-base for more error-resistant palettes.
                 input_pixel.pixel -= 1;
-                output_pixel.opaque = true;
-
-                if (self->pixel_shader == mp_const_none) {
-                    output_pixel.pixel = input_pixel.pixel;
-                } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
-                    displayio_palette_get_color(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
-                } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
-                    displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
-                }
+                _convert_pixel(self, colorspace, &input_pixel, &output_pixel);
 
                 // We double-check this to fast-path the case when a pixel is not covered by the shape & not call the color converter unnecessarily.
                 if (!output_pixel.opaque) {
@@ -418,30 +553,8 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
                 }
 
                 *mask_doubleword |= 1u << mask_bit;
-                if (colorspace->depth == 16) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 16", output_pixel.pixel);
-                    *(((uint16_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth == 32) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 32", output_pixel.pixel);
-                    *(((uint32_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth == 8) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %02x 8", output_pixel.pixel);
-                    *(((uint8_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth < 8) {
-                    // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
-                    if (!colorspace->pixels_in_byte_share_row) {
-                        uint16_t row = pixel_index / linestride_px;
-                        uint16_t col = pixel_index % linestride_px;
-                        pixel_index = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * linestride_px + row % pixels_per_byte;
-                    }
-                    uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
-                    if (colorspace->reverse_pixels_in_byte) {
-                        // Reverse the shift by subtracting it from the leftmost shift.
-                        shift = (pixels_per_byte - 1) * colorspace->depth - shift;
-                    }
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %2d %d", output_pixel.pixel, colorspace->depth);
-                    ((uint8_t *)buffer)[pixel_index / pixels_per_byte] |= output_pixel.pixel << shift;
-                }
+                VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x %d", output_pixel.pixel, colorspace->depth);
+                _write_pixel(colorspace, buffer, pixel_index, linestride_px, output_pixel.pixel);
             }
         }
         mask_start_px += linestride_px - column_dirty_offset_px;
@@ -11,6 +11,13 @@
 
 typedef void get_area_function(mp_obj_t shape, displayio_area_t *out_area);
 typedef uint32_t get_pixel_function(mp_obj_t shape, int16_t x, int16_t y);
+// Optional. Called before get_pixel is asked for every pixel along the row (or column) through x, y
+//   so the shape can do its per-line work once instead of for each pixel.
+typedef void prepare_scanline_function(mp_obj_t shape, int16_t x, int16_t y, bool column);
+// Optional. For shapes that cover a single run of each row (or column) with one value. Returns
+//   the value for the row (or column) through x, y and sets [start, end) to the x (or y) range
+//   it covers, or returns 0 when nothing on it is covered. Used instead of get_pixel.
+typedef uint32_t get_span_function(mp_obj_t shape, int16_t x, int16_t y, bool column, int16_t *start, int16_t *end);
 
 // This struct binds a shape's common Shape support functions (its vector shape interface)
 //   to its instance pointer.  We only check at construction time what the type of the
@@ -22,6 +29,8 @@ typedef struct {
     mp_obj_t shape;
     get_area_function *get_area;
     get_pixel_function *get_pixel;
+    prepare_scanline_function *prepare_scanline;
+    get_span_function *get_span;
 } vectorio_ishape_t;
 
 typedef struct {
@@ -0,0 +1,235 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <string.h>
+
+#include "py/objarray.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/zlib/Decompress.h"
+
+// Most input one dynamic Huffman block header can take.
+#define BLOCK_HEADER_MAX (640)
+// Most input one output byte can take: a full length/distance pair.
+#define SYMBOL_MAX (6)
+
+STATIC mp_int_t window_bits(mp_int_t wbits) {
+    if (wbits < 0) {
+        return -wbits;
+    }
+    if (wbits >= 16) {
+        wbits -= 16;
+    }
+    return wbits == 0 ? 15 : wbits;
+}
+
+STATIC NORETURN void raise_error(int st) {
+    mp_raise_type_arg(&mp_type_ValueError, MP_OBJ_NEW_SMALL_INT(st));
+}
+
+void common_hal_zlib_decompress_construct(zlib_decompress_obj_t *self, mp_int_t wbits, mp_obj_t window) {
+    mp_arg_validate_int_range(window_bits(wbits), 8, 15, MP_QSTR_wbits);
+    if (window != mp_const_none) {
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(window, &bufinfo, MP_BUFFER_WRITE);
+    }
+
+    memset(&self->decomp, 0, sizeof(self->decomp));
+    uzlib_uncompress_init(&self->decomp, NULL, 0);
+    self->window = window;
+    self->pending = MP_OBJ_NULL;
+    self->pending_buf = NULL;
+    self->pending_len = 0;
+    self->pending_pos = 0;
+    self->carry_len = 0;
+    self->carry_pos = 0;
+    self->carry_from_pending = 0;
+    self->wbits = wbits;
+    self->header_done = false;
+    self->finished = false;
+    self->eof = false;
+}
+
+STATIC void attach_window(zlib_decompress_obj_t *self, mp_int_t bits) {
+    size_t needed = 1 << bits;
+    if (self->window == mp_const_none) {
+        byte *buf = m_new(byte, needed);
+        memset(buf, 0, needed);
+        self->window = mp_obj_new_bytearray_by_ref(needed, buf);
+    }
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(self->window, &bufinfo, MP_BUFFER_WRITE);
+    mp_arg_validate_length_min(bufinfo.len, needed, MP_QSTR_window);
+    self->decomp.dict_ring = bufinfo.buf;
+    self->decomp.dict_size = bufinfo.len;
+}
+
+STATIC void release_pending(zlib_decompress_obj_t *self) {
+    self->pending = MP_OBJ_NULL;
+    self->pending_buf = NULL;
+    self->pending_len = 0;
+    self->pending_pos = 0;
+    self->carry_from_pending = 0;
+}
+
+void common_hal_zlib_decompress_feed(zlib_decompress_obj_t *self, mp_obj_t data) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    if (self->pending_pos < self->pending_len) {
+        // The last buffer hasn't been read out yet, so join what's left of it to this one.
+        size_t left = self->pending_len - self->pending_pos;
+        byte *joined = m_new(byte, left + bufinfo.len);
+        memcpy(joined, self->pending_buf + self->pending_pos, left);
+        memcpy(joined + left, bufinfo.buf, bufinfo.len);
+        bufinfo.buf = joined;
+        bufinfo.len += left;
+        data = mp_obj_new_bytearray_by_ref(bufinfo.len, joined);
+    }
+    release_pending(self);
+    self->pending = data;
+    self->pending_buf = bufinfo.buf;
+    self->pending_len = bufinfo.len;
+}
+
+void common_hal_zlib_decompress_finish(zlib_decompress_obj_t *self) {
+    self->finished = true;
+}
+
+bool common_hal_zlib_decompress_get_eof(zlib_decompress_obj_t *self) {
+    return self->eof;
+}
+
+// Point the decompressor at the next input and return how much is there.
+// Input comes from the carry buffer until it is nearly used up, then from the
+// fed buffer in place.
+STATIC size_t next_input(zlib_decompress_obj_t *self, bool *from_carry) {
+    size_t pending_left = self->pending_len - self->pending_pos;
+    if (self->carry_pos < self->carry_len) {
+        size_t left = self->carry_len - self->carry_pos;
+        if (left < ZLIB_DECOMPRESS_LOOKAHEAD && pending_left > 0) {
+            if (left <= self->carry_from_pending) {
+                // The rest of the carry is a copy of the fed buffer, so go back to it.
+                self->pending_pos -= left;
+                pending_left += left;
+                self->carry_len = 0;
+                self->carry_pos = 0;
+                self->carry_from_pending = 0;
+            } else {
+                memmove(self->carry, self->carry + self->carry_pos, left);
+                size_t take = MIN(sizeof(self->carry) - left, pending_left);
+                memcpy(self->carry + left, self->pending_buf + self->pending_pos, take);
+                self->carry_len = left + take;
+                self->carry_pos = 0;
+                self->carry_from_pending = take;
+                self->pending_pos += take;
+            }
+        }
+        if (self->carry_pos < self->carry_len) {
+            *from_carry = true;
+            self->decomp.source = self->carry + self->carry_pos;
+            self->decomp.source_limit = self->carry + self->carry_len;
+            return self->carry_len - self->carry_pos;
+        }
+    }
+    *from_carry = false;
+    self->decomp.source = self->pending_buf + self->pending_pos;
+    self->decomp.source_limit = self->pending_buf + self->pending_len;
+    return pending_left;
+}
+
+// Keep the unread end of the fed buffer so the caller may reuse the buffer.
+STATIC void carry_rest(zlib_decompress_obj_t *self) {
+    if (self->carry_pos == self->carry_len) {
+        size_t left = self->pending_len - self->pending_pos;
+        memcpy(self->carry, self->pending_buf + self->pending_pos, left);
+        self->carry_len = left;
+        self->carry_pos = 0;
+    }
+    release_pending(self);
+}
+
+STATIC void parse_header(zlib_decompress_obj_t *self) {
+    mp_int_t bits = window_bits(self->wbits);
+    int st = 0;
+    if (self->wbits >= 16) {
+        st = uzlib_gzip_parse_header(&self->decomp);
+    } else if (self->wbits >= 0) {
+        st = uzlib_zlib_parse_header(&self->decomp);
+        bits = st + 8;
+    }
+    if (st < 0) {
+        raise_error(st);
+    }
+    attach_window(self, bits);
+    self->header_done = true;
+}
+
+size_t common_hal_zlib_decompress_readinto(zlib_decompress_obj_t *self, uint8_t *buf, size_t len) {
+    size_t written = 0;
+    while (written < len && !self->eof) {
+        bool from_carry;
+        size_t avail = next_input(self, &from_carry);
+        if (avail == 0 || (!self->finished && avail < ZLIB_DECOMPRESS_LOOKAHEAD)) {
+            carry_rest(self);
+            break;
+        }
+        const uint8_t *start = self->decomp.source;
+
+        if (!self->header_done) {
+            parse_header(self);
+        } else {
+            size_t step = len - written;
+            if (!self->finished) {
+                // Stop while there's still enough input left for the worst case.
+                step = MIN(step, (avail - BLOCK_HEADER_MAX) / SYMBOL_MAX);
+            }
+            self->decomp.dest_start = buf + written;
+            self->decomp.dest = buf + written;
+            self->decomp.dest_limit = buf + written + step;
+            int st = uzlib_uncompress_chksum(&self->decomp);
+            written = self->decomp.dest - buf;
+            if (st < 0) {
+                raise_error(st);
+            }
+            if (st == TINF_DONE) {
+                self->eof = true;
+            }
+        }
+        if (self->decomp.eof) {
+            // Ran past the end of the input.
+            raise_error(TINF_DATA_ERROR);
+        }
+
+        size_t consumed = self->decomp.source - start;
+        if (from_carry) {
+            self->carry_pos += consumed;
+        } else {
+            self->pending_pos += consumed;
+        }
+    }
+    return written;
+}
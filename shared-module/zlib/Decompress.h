@@ -0,0 +1,62 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_ZLIB_DECOMPRESS_H
+#define MICROPY_INCLUDED_SHARED_MODULE_ZLIB_DECOMPRESS_H
+
+#include "py/obj.h"
+
+#include "lib/uzlib/uzlib.h"
+
+// Input kept back until more arrives (or finish() is called), so that one
+// decoding step never runs out of input part way through a symbol or block
+// header. uzlib can't resume from that.
+#define ZLIB_DECOMPRESS_LOOKAHEAD (1024)
+
+typedef struct {
+    mp_obj_base_t base;
+    TINF_DATA decomp;
+    // Dictionary ring buffer, caller-supplied or allocated once the window size is known.
+    mp_obj_t window;
+    // Buffer passed to feed() that hasn't been consumed yet.
+    mp_obj_t pending;
+    const uint8_t *pending_buf;
+    size_t pending_len;
+    size_t pending_pos;
+    // Input carried between feed() calls. The last carry_from_pending bytes
+    // are a copy of the bytes just before pending_pos.
+    uint16_t carry_len;
+    uint16_t carry_pos;
+    uint16_t carry_from_pending;
+    int8_t wbits;
+    bool header_done;
+    bool finished;
+    bool eof;
+    uint8_t carry[ZLIB_DECOMPRESS_LOOKAHEAD * 2];
+} zlib_decompress_obj_t;
+
+#endif // MICROPY_INCLUDED_SHARED_MODULE_ZLIB_DECOMPRESS_H
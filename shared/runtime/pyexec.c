@@ -35,6 +35,8 @@
 #include "py/repl.h"
 #include "py/gc.h"
 #include "py/frozenmod.h"
+// CIRCUITPY-CHANGE
+#include "py/persistentcode.h"
 #include "py/mphal.h"
 #if defined(MICROPY_HW_ENABLE_USB) && MICROPY_HW_ENABLE_USB
 #include "irq.h"
@@ -102,6 +104,21 @@ STATIC int parse_compile_execute(const void *source, mp_parse_input_kind_t input
                 module_fun = mp_make_function_from_raw_code(frozen->rc, ctx, NULL);
             } else
             #endif
+            // CIRCUITPY-CHANGE: code.py and boot.py use the import cache too, so
+            // a board that wakes from deep sleep doesn't recompile them.
+            #if (MICROPY_MODULE_IMPORT_CACHE || MICROPY_MODULE_IMPORT_CACHE_WARM) && MICROPY_ENABLE_COMPILER
+            if ((exec_flags & EXEC_FLAG_SOURCE_IS_FILENAME) && input_kind == MP_PARSE_FILE_INPUT) {
+                mp_module_context_t *ctx = m_new_obj(mp_module_context_t);
+                ctx->module.globals = mp_globals_get();
+                #if MICROPY_PY___FILE__
+                mp_store_global(MP_QSTR___file__, MP_OBJ_NEW_QSTR(qstr_from_str(source)));
+                #endif
+                mp_compiled_module_t cm;
+                cm.context = ctx;
+                mp_raw_code_load_file_cached(source, &cm);
+                module_fun = mp_make_function_from_raw_code(cm.rc, ctx, NULL);
+            } else
+            #endif
             {
                 #if MICROPY_ENABLE_COMPILER
                 mp_lexer_t *lex;
@@ -28,6 +28,8 @@
 #define CIRCUITPY_INCLUDED_SUPERVISOR_BACKGROUND_CALLBACK_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 /** Background callbacks are a linked list of tasks to call in the background.
  *
@@ -53,16 +55,40 @@
  * supervisor_enable_tick() and disabled with supervisor_disable_tick(). When
  * enabled, a timer will schedule a callback to supervisor_background_tick(),
  * which includes port_background_tick(), every millisecond.
+ *
+ * Callbacks always run on the core that runs the VM, between bytecodes, even
+ * on dual core chips. That is what makes them safe without locks: display
+ * refresh walks displayio objects on the GC heap that Python code changes
+ * freely, workflows call into the VM and the filesystem, and TinyUSB is not
+ * re-entrant. Running any of them on another core would need every one of
+ * those objects locked against the VM and against gc_collect(), which costs
+ * more than the refresh it would offload.
  */
 typedef void (*background_callback_fun)(void *data);
+
+/* Each pass runs realtime callbacks first, and again between any others that
+ * run after them. Idle callbacks only run in a pass that has spent little time
+ * on the rest, so they may wait several passes. Zero-initialized callbacks are
+ * normal priority. */
+typedef enum {
+    BACKGROUND_CALLBACK_NORMAL,
+    BACKGROUND_CALLBACK_REALTIME,
+    BACKGROUND_CALLBACK_IDLE,
+    BACKGROUND_CALLBACK_PRIORITY_COUNT,
+} background_callback_priority_t;
+
 typedef struct background_callback {
     background_callback_fun fun;
     void *data;
     struct background_callback *next;
     struct background_callback *prev;
+    background_callback_priority_t priority;
+    #if CIRCUITPY_BACKGROUND_TASK_STATS
+    const char *name; // Set from the function's name as it is queued.
+    #endif
 } background_callback_t;
 
-/* Add a background callback for which 'fun' and 'data' were previously set */
+/* Add a background callback for which 'fun', 'data' and 'priority' were previously set */
 void background_callback_add_core(background_callback_t *cb);
 
 /* Add a background callback to the given function with the given data.  When
@@ -74,6 +100,10 @@ void background_callback_add_core(background_callback_t *cb);
  */
 void background_callback_add(background_callback_t *cb, background_callback_fun fun, void *data);
 
+/* As background_callback_add, also setting the priority. The priority only
+ * changes when the callback isn't already queued. */
+void background_callback_add_with_priority(background_callback_t *cb, background_callback_fun fun, void *data, background_callback_priority_t priority);
+
 /* Run all background callbacks.  Normally, this is done by the supervisor
  * whenever the list is non-empty */
 void background_callback_run_all(void);
@@ -97,4 +127,32 @@ void background_callback_end_critical_section(void);
  */
 void background_callback_gc_collect(void);
 
+#if CIRCUITPY_BACKGROUND_TASK_STATS
+/* Run time of each background callback function, in port_get_cycle_count()
+ * cycles. Time in port_background_task() is kept as if it were a callback too. */
+#ifndef CIRCUITPY_BACKGROUND_TASK_STATS_ENTRIES
+#define CIRCUITPY_BACKGROUND_TASK_STATS_ENTRIES (32)
+#endif
+
+typedef struct {
+    background_callback_fun fun;
+    const char *name; // NULL when the callback was queued by background_callback_add_core.
+    uint32_t calls;
+    uint32_t max_cycles;
+    uint64_t total_cycles;
+} background_callback_stats_t;
+
+size_t background_callback_stats_count(void);
+const background_callback_stats_t *background_callback_get_stats(size_t i);
+
+background_callback_t *background_callback_set_name(background_callback_t *cb, const char *name);
+
+/* Name each callback after its function as it is queued. A macro doesn't
+ * expand inside its own expansion, so these still call the functions. */
+#define background_callback_add(cb, fun, data) \
+    background_callback_add(background_callback_set_name((cb), #fun), (fun), (data))
+#define background_callback_add_with_priority(cb, fun, data, priority) \
+    background_callback_add_with_priority(background_callback_set_name((cb), #fun), (fun), (data), (priority))
+#endif
+
 #endif
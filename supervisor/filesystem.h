@@ -36,6 +36,12 @@ void filesystem_background(void);
 void filesystem_tick(void);
 bool filesystem_init(bool create_allowed, bool force_create);
 void filesystem_flush(void);
+
+// With CIRCUITPY_FILESYSTEM_WRITE_BEHIND, syncing CIRCUITPY only queues its
+// cached sectors, and background tasks write them to flash a little at a time.
+// filesystem_write_behind_sync() waits until they are all written.
+void filesystem_write_behind(void);
+void filesystem_write_behind_sync(void);
 bool filesystem_present(void);
 void filesystem_set_internal_writable_by_usb(bool usb_writable);
 void filesystem_set_internal_concurrent_write_protection(bool concurrent_write_protection);
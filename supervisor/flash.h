@@ -48,8 +48,19 @@ mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t block_num,
 struct _fs_user_mount_t;
 void supervisor_flash_init_vfs(struct _fs_user_mount_t *vfs);
 void supervisor_flash_flush(void);
+// Does a bounded part of supervisor_flash_flush(). Returns true when it is done.
+bool supervisor_flash_flush_step(void);
 void supervisor_flash_release_cache(void);
 
+#if CIRCUITPY_STORAGE_DATA_PARTITION_SIZE > 0
+// The data partition is the last CIRCUITPY_STORAGE_DATA_PARTITION_SIZE bytes of
+// the flash filesystem area, which CIRCUITPY and USB don't see. Block numbers
+// start at the beginning of the partition. These return 0 on success.
+uint32_t supervisor_flash_data_get_block_count(void);
+mp_uint_t supervisor_flash_data_read_blocks(uint8_t *dest, uint32_t block_num, uint32_t num_blocks);
+mp_uint_t supervisor_flash_data_write_blocks(const uint8_t *src, uint32_t block_num, uint32_t num_blocks);
+#endif
+
 void supervisor_flash_set_extended(bool extended);
 bool supervisor_flash_get_extended(void);
 void supervisor_flash_update_extended(void);
@@ -125,6 +125,12 @@ void port_post_boot_py(bool heap_valid);
 // A default weak implementation is provided that does nothing.
 void port_boot_info(void);
 
+// A free running 32 bit counter for timing short stretches of code, ideally
+// counting CPU cycles. port_get_cycle_count_frequency() returns its rate.
+// A default weak implementation counts 1/32768 second subticks.
+uint32_t port_get_cycle_count(void);
+uint32_t port_get_cycle_count_frequency(void);
+
 // Some ports want to mark additional pointers as gc roots.
 // A default weak implementation is provided that does nothing.
 void port_gc_collect(void);
@@ -42,6 +42,13 @@ void port_heap_init(void);
 
 void *port_malloc(size_t size, bool dma_capable);
 
+// Allocate from the port's fastest RAM, such as internal SRAM when there is
+// also PSRAM. Returns NULL rather than falling back to slower RAM.
+void *port_malloc_fast(size_t size);
+
+// True when ptr is in the port's fastest RAM.
+bool port_heap_is_fast(void *ptr);
+
 void port_free(void *ptr);
 
 void *port_realloc(void *ptr, size_t size);
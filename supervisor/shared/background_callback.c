@@ -34,7 +34,19 @@
 #include "supervisor/shared/tick.h"
 #include "shared-bindings/microcontroller/__init__.h"
 
-STATIC volatile background_callback_t *volatile callback_head, *volatile callback_tail;
+#if CIRCUITPY_BACKGROUND_TASK_STATS
+// Define the functions themselves rather than the naming wrappers.
+#undef background_callback_add
+#undef background_callback_add_with_priority
+#endif
+
+// One queue per priority. A callback is queued when its prev is set or it is
+// the head of its queue.
+STATIC volatile background_callback_t *volatile callback_head[BACKGROUND_CALLBACK_PRIORITY_COUNT];
+STATIC volatile background_callback_t *volatile callback_tail[BACKGROUND_CALLBACK_PRIORITY_COUNT];
+// True when any queue is non-empty. Kept separately so RUN_BACKGROUND_TASKS can
+// check it inline, from every VM loop iteration, without a call.
+volatile bool background_callback_queued;
 
 #ifndef CALLBACK_CRITICAL_BEGIN
 #define CALLBACK_CRITICAL_BEGIN (common_hal_mcu_disable_interrupts())
@@ -43,67 +55,185 @@ STATIC volatile background_callback_t *volatile callback_head, *volatile callbac
 #define CALLBACK_CRITICAL_END (common_hal_mcu_enable_interrupts())
 #endif
 
+// Idle callbacks are left for a later pass once this many 1/1024 second ticks
+// have been spent on the other priorities.
+#ifndef CIRCUITPY_BACKGROUND_CALLBACK_IDLE_BUDGET_TICKS
+#define CIRCUITPY_BACKGROUND_CALLBACK_IDLE_BUDGET_TICKS (2)
+#endif
+
 MP_WEAK void PLACE_IN_ITCM(port_wake_main_task)(void) {
 }
 
-void PLACE_IN_ITCM(background_callback_add_core)(background_callback_t * cb) {
+STATIC void PLACE_IN_ITCM(callback_add)(background_callback_t * cb, bool set_priority, background_callback_priority_t priority) {
     CALLBACK_CRITICAL_BEGIN;
-    if (cb->prev || callback_head == cb) {
+    if (cb->prev || callback_head[cb->priority] == cb) {
         CALLBACK_CRITICAL_END;
         return;
     }
+    if (set_priority) {
+        cb->priority = priority;
+    }
+    priority = cb->priority;
     cb->next = 0;
-    cb->prev = (background_callback_t *)callback_tail;
-    if (callback_tail) {
-        callback_tail->next = cb;
+    cb->prev = (background_callback_t *)callback_tail[priority];
+    if (callback_tail[priority]) {
+        callback_tail[priority]->next = cb;
     }
-    if (!callback_head) {
-        callback_head = cb;
+    if (!callback_head[priority]) {
+        callback_head[priority] = cb;
     }
-    callback_tail = cb;
+    callback_tail[priority] = cb;
+    background_callback_queued = true;
     CALLBACK_CRITICAL_END;
 
     port_wake_main_task();
 }
 
+void PLACE_IN_ITCM(background_callback_add_core)(background_callback_t * cb) {
+    callback_add(cb, false, BACKGROUND_CALLBACK_NORMAL);
+}
+
 void PLACE_IN_ITCM(background_callback_add)(background_callback_t * cb, background_callback_fun fun, void *data) {
     cb->fun = fun;
     cb->data = data;
-    background_callback_add_core(cb);
+    callback_add(cb, false, BACKGROUND_CALLBACK_NORMAL);
+}
+
+void PLACE_IN_ITCM(background_callback_add_with_priority)(background_callback_t * cb, background_callback_fun fun, void *data, background_callback_priority_t priority) {
+    cb->fun = fun;
+    cb->data = data;
+    callback_add(cb, true, priority);
 }
 
 inline bool background_callback_pending(void) {
-    return callback_head != NULL;
+    return background_callback_queued;
 }
 
-static bool in_background_callback;
-void PLACE_IN_ITCM(background_callback_run_all)() {
-    port_background_task();
-    if (!background_callback_pending()) {
-        return;
+#if CIRCUITPY_BACKGROUND_TASK_STATS
+// The first entry is port_background_task() and the last collects every
+// function that doesn't fit.
+STATIC background_callback_stats_t callback_stats[CIRCUITPY_BACKGROUND_TASK_STATS_ENTRIES] = {
+    { .name = "port_background_task" },
+};
+STATIC size_t callback_stats_used = 1;
+
+background_callback_t *background_callback_set_name(background_callback_t *cb, const char *name) {
+    cb->name = name;
+    return cb;
+}
+
+STATIC void add_cycles(background_callback_stats_t *stats, uint32_t cycles) {
+    stats->calls++;
+    stats->total_cycles += cycles;
+    stats->max_cycles = MAX(stats->max_cycles, cycles);
+}
+
+STATIC void record_stats(background_callback_fun fun, const char *name, uint32_t cycles) {
+    background_callback_stats_t *stats = NULL;
+    for (size_t i = 1; i < callback_stats_used; i++) {
+        if (callback_stats[i].fun == fun) {
+            stats = &callback_stats[i];
+            break;
+        }
     }
-    CALLBACK_CRITICAL_BEGIN;
-    if (in_background_callback) {
-        CALLBACK_CRITICAL_END;
-        return;
+    if (stats == NULL) {
+        if (callback_stats_used < CIRCUITPY_BACKGROUND_TASK_STATS_ENTRIES - 1) {
+            stats = &callback_stats[callback_stats_used++];
+            stats->fun = fun;
+        } else {
+            stats = &callback_stats[CIRCUITPY_BACKGROUND_TASK_STATS_ENTRIES - 1];
+            callback_stats_used = CIRCUITPY_BACKGROUND_TASK_STATS_ENTRIES;
+            name = "(other)";
+        }
     }
-    in_background_callback = true;
-    background_callback_t *cb = (background_callback_t *)callback_head;
-    callback_head = NULL;
-    callback_tail = NULL;
+    if (stats->name == NULL) {
+        stats->name = name;
+    }
+    add_cycles(stats, cycles);
+}
+
+size_t background_callback_stats_count(void) {
+    return callback_stats_used;
+}
+
+const background_callback_stats_t *background_callback_get_stats(size_t i) {
+    return &callback_stats[i];
+}
+
+STATIC void PLACE_IN_ITCM(run_callback)(background_callback_fun fun, void *data, const char *name) {
+    uint32_t start = port_get_cycle_count();
+    fun(data);
+    record_stats(fun, name, port_get_cycle_count() - start);
+}
+
+STATIC void PLACE_IN_ITCM(run_port_background_task)(void) {
+    uint32_t start = port_get_cycle_count();
+    port_background_task();
+    add_cycles(&callback_stats[0], port_get_cycle_count() - start);
+}
+#else
+#define run_callback(fun, data, name) fun(data)
+#define run_port_background_task() port_background_task()
+#endif
+
+// Must be called with the critical section held.
+STATIC void update_queued(void) {
+    bool queued = false;
+    for (size_t i = 0; i < BACKGROUND_CALLBACK_PRIORITY_COUNT; i++) {
+        queued |= callback_head[i] != NULL;
+    }
+    background_callback_queued = queued;
+}
+
+// Run everything queued at one priority. Called and returns with the critical
+// section held. Realtime callbacks queued while a lower priority one ran go
+// before the next lower priority one.
+STATIC void PLACE_IN_ITCM(run_queue)(background_callback_priority_t priority) {
+    background_callback_t *cb = (background_callback_t *)callback_head[priority];
+    callback_head[priority] = NULL;
+    callback_tail[priority] = NULL;
     while (cb) {
         background_callback_t *next = cb->next;
         cb->next = cb->prev = NULL;
         background_callback_fun fun = cb->fun;
         void *data = cb->data;
+        #if CIRCUITPY_BACKGROUND_TASK_STATS
+        const char *name = cb->name;
+        #endif
         CALLBACK_CRITICAL_END;
         // Leave the critical section in order to run the callback function
         if (fun) {
-            fun(data);
+            run_callback(fun, data, name);
         }
         CALLBACK_CRITICAL_BEGIN;
+        if (priority != BACKGROUND_CALLBACK_REALTIME && callback_head[BACKGROUND_CALLBACK_REALTIME]) {
+            run_queue(BACKGROUND_CALLBACK_REALTIME);
+        }
         cb = next;
     }
+}
+
+static bool in_background_callback;
+void PLACE_IN_ITCM(background_callback_run_all)() {
+    run_port_background_task();
+    if (!background_callback_pending()) {
+        return;
+    }
+    CALLBACK_CRITICAL_BEGIN;
+    if (in_background_callback) {
+        CALLBACK_CRITICAL_END;
+        return;
+    }
+    in_background_callback = true;
+    uint64_t start_ticks = port_get_raw_ticks(NULL);
+    run_queue(BACKGROUND_CALLBACK_REALTIME);
+    run_queue(BACKGROUND_CALLBACK_NORMAL);
+    // Idle work stays queued, so the supervisor comes back for it in a pass
+    // that has time to spare.
+    if (port_get_raw_ticks(NULL) - start_ticks < CIRCUITPY_BACKGROUND_CALLBACK_IDLE_BUDGET_TICKS) {
+        run_queue(BACKGROUND_CALLBACK_IDLE);
+    }
+    update_queued();
     in_background_callback = false;
     CALLBACK_CRITICAL_END;
 }
@@ -119,33 +249,36 @@ void background_callback_end_critical_section() {
 
 // Filter out queued callbacks if they are allocated on the heap.
 void background_callback_reset() {
-    background_callback_t *new_head = NULL;
-    background_callback_t **previous_next = &new_head;
-    background_callback_t *new_tail = NULL;
     CALLBACK_CRITICAL_BEGIN;
-    background_callback_t *cb = (background_callback_t *)callback_head;
-    while (cb) {
-        background_callback_t *next = cb->next;
-        cb->next = NULL;
-        // Unlink any callbacks that are allocated on the python heap or if they
-        // reference data on the python heap. The python heap will be disappear
-        // soon after this.
-        if (gc_ptr_on_heap((void *)cb) || gc_ptr_on_heap(cb->data)) {
-            cb->prev = NULL; // Used to indicate a callback isn't queued.
-        } else {
-            // Set .next of the previous callback.
-            *previous_next = cb;
-            // Set our .next for the next callback.
-            previous_next = &cb->next;
-            // Set our prev to the last callback.
-            cb->prev = new_tail;
-            // Now we're the tail of the list.
-            new_tail = cb;
+    for (size_t i = 0; i < BACKGROUND_CALLBACK_PRIORITY_COUNT; i++) {
+        background_callback_t *new_head = NULL;
+        background_callback_t **previous_next = &new_head;
+        background_callback_t *new_tail = NULL;
+        background_callback_t *cb = (background_callback_t *)callback_head[i];
+        while (cb) {
+            background_callback_t *next = cb->next;
+            cb->next = NULL;
+            // Unlink any callbacks that are allocated on the python heap or if they
+            // reference data on the python heap. The python heap will be disappear
+            // soon after this.
+            if (gc_ptr_on_heap((void *)cb) || gc_ptr_on_heap(cb->data)) {
+                cb->prev = NULL; // Used to indicate a callback isn't queued.
+            } else {
+                // Set .next of the previous callback.
+                *previous_next = cb;
+                // Set our .next for the next callback.
+                previous_next = &cb->next;
+                // Set our prev to the last callback.
+                cb->prev = new_tail;
+                // Now we're the tail of the list.
+                new_tail = cb;
+            }
+            cb = next;
         }
-        cb = next;
+        callback_head[i] = new_head;
+        callback_tail[i] = new_tail;
     }
-    callback_head = new_head;
-    callback_tail = new_tail;
+    update_queued();
     in_background_callback = false;
     CALLBACK_CRITICAL_END;
 }
@@ -165,9 +298,11 @@ void background_callback_gc_collect(void) {
     // It's necessary to traverse the whole list here, as the callbacks
     // themselves can be in non-gc memory, and some of the cb->data
     // objects themselves might be in non-gc memory.
-    background_callback_t *cb = (background_callback_t *)callback_head;
-    while (cb) {
-        gc_collect_ptr(cb->data);
-        cb = cb->next;
+    for (size_t i = 0; i < BACKGROUND_CALLBACK_PRIORITY_COUNT; i++) {
+        background_callback_t *cb = (background_callback_t *)callback_head[i];
+        while (cb) {
+            gc_collect_ptr(cb->data);
+            cb = cb->next;
+        }
     }
 }
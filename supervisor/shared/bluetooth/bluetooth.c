@@ -297,6 +297,10 @@ void supervisor_bluetooth_background(void) {
         advertising = false;
     }
 
+    #if CIRCUITPY_SERIAL_BLE
+    ble_serial_background();
+    #endif
+
     #if CIRCUITPY_BLE_FILE_SERVICE
     supervisor_bluetooth_file_transfer_background();
     #endif
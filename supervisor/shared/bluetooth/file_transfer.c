@@ -65,8 +65,15 @@ const uint8_t file_transfer_base_uuid[16] = {0x72, 0x65, 0x66, 0x73, 0x6e, 0x61,
 
 STATIC mp_obj_list_t characteristic_list;
 STATIC mp_obj_t characteristic_list_items[2];
-// 2 * 10 ringbuf packets, 512 for a disk sector and 12 for the file transfer write header.
-#define PACKET_BUFFER_SIZE (2 * 10 + 512 + 12)
+// Number of chunks that may be outstanding in each direction when the client
+// asks for a windowed transfer. Incoming WRITE_DATA chunks must all fit in the
+// packet buffer, so each extra chunk costs a sector of RAM.
+#ifndef CIRCUITPY_BLE_FILE_TRANSFER_WINDOW
+#define CIRCUITPY_BLE_FILE_TRANSFER_WINDOW (CIRCUITPY_FULL_BUILD ? 4 : 1)
+#endif
+// 2 * 10 ringbuf packets, 512 for a disk sector and 12 for the file transfer write header
+// per windowed chunk.
+#define PACKET_BUFFER_SIZE (2 * 10 + CIRCUITPY_BLE_FILE_TRANSFER_WINDOW * (512 + 12))
 // uint32_t so its aligned
 STATIC uint32_t _buffer[PACKET_BUFFER_SIZE / 4 + 1];
 STATIC uint32_t _outgoing1[BLE_GATTS_VAR_ATTR_LEN_MAX / 4];
@@ -102,7 +109,7 @@ void supervisor_start_bluetooth_file_transfer(void) {
         NULL,                                       // no initial value
         NULL); // no description
 
-    uint32_t version = 4;
+    uint32_t version = 5;
     mp_buffer_info_t bufinfo;
     bufinfo.buf = &version;
     bufinfo.len = sizeof(version);
@@ -152,14 +159,80 @@ STATIC uint64_t truncate_time(uint64_t input_time, DWORD *fattime) {
 // Used by read and write.
 STATIC FIL active_file;
 STATIC fs_user_mount_t *active_mount;
+
+STATIC uint8_t _clamp_window(uint8_t requested) {
+    if (requested == 0) {
+        return 1;
+    }
+    return MIN(requested, CIRCUITPY_BLE_FILE_TRANSFER_WINDOW);
+}
+
+// Used by read and read pacing to keep the window full.
+STATIC uint8_t _read_window;
+STATIC uint32_t _read_chunk_size;
+STATIC uint32_t _read_next_offset;
+
+STATIC void _send_read_chunk(uint32_t offset, uint32_t chunk_size, uint32_t total_length) {
+    struct read_data response;
+    response.command = READ_DATA;
+    response.status = STATUS_OK;
+    response.window = _read_window;
+    response.chunk_offset = offset;
+    response.total_length = total_length;
+    response.data_size = chunk_size;
+    common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&response, sizeof(struct read_data), NULL, 0);
+    f_lseek(&active_file, offset);
+    // Write out the chunk contents. We can do this in small pieces because PacketBuffer
+    // will assemble them into larger packets of its own.
+    size_t chunk_offset = 0;
+    uint8_t data[20];
+    while (chunk_offset < chunk_size) {
+        size_t quantity_read;
+        size_t read_size = MIN(chunk_size - chunk_offset, sizeof(data));
+        FRESULT result = f_read(&active_file, &data, read_size, &quantity_read);
+        if (quantity_read == 0 || result != FR_OK) {
+            // TODO: If we can't read everything, then the file must have been shortened. Maybe we
+            // should return 0s to pad it out.
+            break;
+        }
+        common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&data, quantity_read, NULL, 0);
+        chunk_offset += quantity_read;
+    }
+}
+
+// Send chunks until the window past acked_offset is full. acked_offset is the
+// next offset the client still needs.
+STATIC uint8_t _send_read_window(uint32_t acked_offset) {
+    uint32_t total_length = f_size(&active_file);
+    // The client skipped ahead so start sending from there.
+    if (acked_offset > _read_next_offset) {
+        _read_next_offset = acked_offset;
+    }
+    // A zero chunk size still sends one empty chunk like older versions did.
+    uint64_t window_end = acked_offset + (uint64_t)_read_window * MAX(_read_chunk_size, 1);
+    for (uint8_t i = 0; i < _read_window && _read_next_offset < window_end; i++) {
+        uint32_t chunk_size = 0;
+        if (_read_next_offset < total_length) {
+            chunk_size = MIN(_read_chunk_size, total_length - _read_next_offset);
+        }
+        _send_read_chunk(_read_next_offset, chunk_size, total_length);
+        _read_next_offset += chunk_size;
+        if (_read_next_offset >= total_length) {
+            f_close(&active_file);
+            return ANY_COMMAND;
+        }
+    }
+    return READ_PACING;
+}
+
 STATIC uint8_t _process_read(const uint8_t *raw_buf, size_t command_len) {
     struct read_command *command = (struct read_command *)raw_buf;
     size_t header_size = sizeof(struct read_command);
     size_t response_size = sizeof(struct read_data);
-    uint8_t data_buffer[response_size];
     struct read_data response;
     response.command = READ_DATA;
     response.status = STATUS_OK;
+    response.window = 0;
     if (command->path_length > (COMMAND_SIZE - response_size - 1)) { // -1 for the null we'll write
         // TODO: throw away any more packets of path.
         response.status = STATUS_ERROR;
@@ -189,75 +262,24 @@ STATIC uint8_t _process_read(const uint8_t *raw_buf, size_t command_len) {
         common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&response, response_size, NULL, 0);
         return ANY_COMMAND;
     }
-    uint32_t total_length = f_size(&active_file);
-    // Write out the response header.
-    uint32_t offset = command->chunk_offset;
-    uint32_t chunk_size = command->chunk_size;
-    chunk_size = MIN(chunk_size, total_length - offset);
-    response.chunk_offset = offset;
-    response.total_length = total_length;
-    response.data_size = chunk_size;
-    common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&response, response_size, NULL, 0);
-    f_lseek(&active_file, offset);
-    // Write out the chunk contents. We can do this in small pieces because PacketBuffer
-    // will assemble them into larger packets of its own.
-    size_t chunk_end = offset + chunk_size;
-    while (offset < chunk_end) {
-        size_t quantity_read;
-        size_t read_amount = MIN(response_size, chunk_end - offset);
-        f_read(&active_file, data_buffer, read_amount, &quantity_read);
-        offset += quantity_read;
-        // TODO: Do something if the read fails
-        common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, data_buffer, quantity_read, NULL, 0);
-    }
-    if (offset >= total_length) {
-        f_close(&active_file);
-        return ANY_COMMAND;
-    }
-    return READ_PACING;
+    _read_window = _clamp_window(command->window);
+    _read_chunk_size = command->chunk_size;
+    _read_next_offset = command->chunk_offset;
+    return _send_read_window(command->chunk_offset);
 }
 
 STATIC uint8_t _process_read_pacing(const uint8_t *raw_buf, size_t command_len) {
     struct read_pacing *command = (struct read_pacing *)raw_buf;
-    struct read_data response;
-    response.command = READ_DATA;
-    response.status = STATUS_OK;
-    size_t response_size = sizeof(struct read_data);
-
-    uint32_t total_length = f_size(&active_file);
-    // Write out the response header.
-    uint32_t chunk_size = MIN(command->chunk_size, total_length - command->chunk_offset);
-    response.chunk_offset = command->chunk_offset;
-    response.total_length = total_length;
-    response.data_size = chunk_size;
-    common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&response, response_size, NULL, 0);
-    f_lseek(&active_file, command->chunk_offset);
-    // Write out the chunk contents. We can do this in small pieces because PacketBuffer
-    // will assemble them into larger packets of its own.
-    size_t chunk_offset = 0;
-    uint8_t data[20];
-    while (chunk_offset < chunk_size) {
-        size_t quantity_read;
-        size_t read_size = MIN(chunk_size - chunk_offset, sizeof(data));
-        FRESULT result = f_read(&active_file, &data, read_size, &quantity_read);
-        if (quantity_read == 0 || result != FR_OK) {
-            // TODO: If we can't read everything, then the file must have been shortened. Maybe we
-            // should return 0s to pad it out.
-            break;
-        }
-        common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&data, quantity_read, NULL, 0);
-        chunk_offset += quantity_read;
-    }
-    if ((chunk_offset + chunk_size) >= total_length) {
-        f_close(&active_file);
-        return ANY_COMMAND;
-    }
-    return READ_PACING;
+    _read_chunk_size = command->chunk_size;
+    return _send_read_window(command->chunk_offset);
 }
 
 // Used by write and write data to know when the write is complete.
 STATIC size_t total_write_length;
 STATIC uint64_t _truncated_time;
+// Used by write data to only acknowledge every half window.
+STATIC uint8_t _write_window;
+STATIC uint8_t _write_unacked_chunks;
 
 STATIC uint8_t _process_write(const uint8_t *raw_buf, size_t command_len) {
     struct write_command *command = (struct write_command *)raw_buf;
@@ -265,6 +287,7 @@ STATIC uint8_t _process_write(const uint8_t *raw_buf, size_t command_len) {
     struct write_pacing response;
     response.command = WRITE_PACING;
     response.status = STATUS_OK;
+    response.window = 0;
     if (command->path_length > (COMMAND_SIZE - header_size - 1)) { // -1 for the null we'll write
         // TODO: throw away any more packets of path.
         response.status = STATUS_ERROR;
@@ -306,10 +329,12 @@ STATIC uint8_t _process_write(const uint8_t *raw_buf, size_t command_len) {
         return ANY_COMMAND;
     }
     // Write out the pacing response.
+    _write_window = _clamp_window(command->window);
+    _write_unacked_chunks = 0;
 
     // Align the next chunk to a sector boundary.
     uint32_t offset = command->offset;
-    size_t chunk_size = MIN(total_write_length - offset, 512 - (offset % 512));
+    size_t chunk_size = MIN(total_write_length - offset, _write_window * 512 - (offset % 512));
     // Special case when truncating the file. (Deleting stuff off the end.)
     if (chunk_size == 0) {
         f_lseek(&active_file, offset);
@@ -318,6 +343,7 @@ STATIC uint8_t _process_write(const uint8_t *raw_buf, size_t command_len) {
         override_fattime(0);
         filesystem_unlock(active_mount);
     }
+    response.window = _write_window;
     response.offset = offset;
     response.free_space = chunk_size;
     response.truncated_time = _truncated_time;
@@ -337,10 +363,12 @@ STATIC uint8_t _process_write_data(const uint8_t *raw_buf, size_t command_len) {
     struct write_pacing response;
     response.command = WRITE_PACING;
     response.status = STATUS_OK;
+    response.window = _write_window;
     if (command->data_size > (COMMAND_SIZE - header_size - 1)) { // -1 for the null we'll write
         // TODO: throw away any more packets of path.
         response.status = STATUS_ERROR;
         common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&response, sizeof(struct write_pacing), NULL, 0);
+        f_close(&active_file);
         filesystem_unlock(active_mount);
         override_fattime(0);
         return ANY_COMMAND;
@@ -357,13 +385,21 @@ STATIC uint8_t _process_write_data(const uint8_t *raw_buf, size_t command_len) {
         // TODO: throw away any more packets of path.
         response.status = STATUS_ERROR;
         common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&response, sizeof(struct write_pacing), NULL, 0);
+        f_close(&active_file);
         filesystem_unlock(active_mount);
         override_fattime(0);
         return ANY_COMMAND;
     }
     offset += command->data_size;
+    _write_unacked_chunks++;
+    // Only acknowledge every half window so that the client always has chunks
+    // in flight. The last chunk is always acknowledged.
+    if (total_write_length != offset && _write_unacked_chunks < (_write_window + 1) / 2) {
+        return WRITE_DATA;
+    }
+    _write_unacked_chunks = 0;
     // Align the next chunk to a sector boundary.
-    size_t chunk_size = MIN(total_write_length - offset, 512);
+    size_t chunk_size = MIN(total_write_length - offset, _write_window * 512);
     response.offset = offset;
     response.free_space = chunk_size;
     response.truncated_time = _truncated_time;
@@ -648,6 +684,13 @@ void supervisor_bluetooth_file_transfer_background(void) {
             autoreload_resume(AUTORELOAD_SUSPEND_BLE);
             break;
         }
+        // Pipelined chunks and acknowledgements may still arrive after a windowed
+        // transfer finished or failed. Drop them quietly.
+        if (next_command == ANY_COMMAND && (current_state == READ_PACING || current_state == WRITE_DATA)) {
+            current_offset = 0;
+            autoreload_resume(AUTORELOAD_SUSPEND_BLE);
+            continue;
+        }
         switch (current_state) {
             case READ:
                 next_command = _process_read(current_command, current_offset);
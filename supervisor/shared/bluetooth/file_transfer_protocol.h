@@ -37,22 +37,30 @@
 // an array of the struct.) So, be careful that types added are aligned. Otherwise,
 // the compiler may generate more code than necessary.
 
+// Version 5 adds windowed transfers. A client may put the number of chunks it
+// is willing to have outstanding into the `window` byte of READ and WRITE.
+// Zero (what older clients send in the reserved byte) means one chunk at a
+// time, exactly like version 4. The server clamps the window to what it can
+// buffer and reports the granted window back in READ_DATA and WRITE_PACING.
+
 // 0x00 - 0x0f are never used by the protocol as a command
 #define READ 0x10
 struct read_command {
     uint8_t command;
-    uint8_t reserved;
+    uint8_t window;
     uint16_t path_length;
     uint32_t chunk_offset;
     uint32_t chunk_size;
     uint8_t path[];
 } __attribute__((packed));
 
+// With a window, the server sends consecutive READ_DATA chunks until `window`
+// chunks past the last READ_PACING chunk_offset are outstanding.
 #define READ_DATA 0x11
 struct read_data {
     uint8_t command;
     uint8_t status;
-    uint16_t reserved;
+    uint16_t window;
     uint32_t chunk_offset;
     uint32_t total_length;
     uint32_t data_size;
@@ -71,7 +79,7 @@ struct read_pacing {
 #define WRITE 0x20
 struct write_command {
     uint8_t command;
-    uint8_t reserved;
+    uint8_t window;
     uint16_t path_length;
     uint32_t offset;
     uint64_t modification_time;
@@ -79,11 +87,14 @@ struct write_command {
     uint8_t path[];
 } __attribute__((packed));
 
+// free_space is the number of bytes past offset the client may send before
+// waiting for the next WRITE_PACING. With a window, the server only sends one
+// every half window of WRITE_DATA chunks (each at most 512 bytes).
 #define WRITE_PACING 0x21
 struct write_pacing {
     uint8_t command;
     uint8_t status;
-    uint16_t reserved;
+    uint16_t window;
     uint32_t offset;
     uint64_t truncated_time;
     uint32_t free_space;
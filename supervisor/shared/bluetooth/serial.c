@@ -36,6 +36,7 @@
 #include "shared-bindings/_bleio/UUID.h"
 #include "shared-module/storage/__init__.h"
 #include "supervisor/shared/bluetooth/serial.h"
+#include "supervisor/shared/tick.h"
 
 #include "common-hal/_bleio/__init__.h"
 
@@ -67,6 +68,15 @@ STATIC bleio_characteristic_buffer_obj_t _rx_buffer;
 // Internal enabling so we can disable while printing BLE debugging.
 STATIC bool _enabled;
 
+// Output is collected here and sent as full packets. Whatever is left is sent by
+// ble_serial_background once the oldest byte has waited BLE_SERIAL_FLUSH_MS.
+#define BLE_SERIAL_FLUSH_MS (5)
+STATIC uint8_t _tx_staging[BLE_GATTS_VAR_ATTR_LEN_MAX];
+STATIC size_t _tx_staging_len;
+STATIC uint64_t _tx_staging_start_ms;
+// Writing a packet may run background tasks, which mustn't flush the same data again.
+STATIC bool _tx_flushing;
+
 void supervisor_start_bluetooth_serial(void) {
     supervisor_ble_circuitpython_service_uuid.base.type = &bleio_uuid_type;
     common_hal_bleio_uuid_construct(&supervisor_ble_circuitpython_service_uuid, 0x0001, circuitpython_base_uuid);
@@ -152,6 +162,21 @@ void supervisor_start_bluetooth_serial(void) {
     _enabled = true;
 }
 
+STATIC void _flush_staging(void) {
+    if (_tx_staging_len == 0 || _tx_flushing) {
+        return;
+    }
+    mp_int_t packet_length = common_hal_bleio_packet_buffer_get_outgoing_packet_length(&_tx_packet_buffer);
+    if (packet_length > 0) {
+        _tx_flushing = true;
+        // Anything past a packet was staged for an earlier connection, so drop it. A
+        // failed write drops the characters too.
+        common_hal_bleio_packet_buffer_write(&_tx_packet_buffer, _tx_staging, MIN(_tx_staging_len, (size_t)packet_length), NULL, 0);
+        _tx_flushing = false;
+    }
+    _tx_staging_len = 0;
+}
+
 void supervisor_stop_bluetooth_serial(void) {
     if (common_hal_bleio_packet_buffer_deinited(&_tx_packet_buffer)) {
         return;
@@ -159,6 +184,7 @@ void supervisor_stop_bluetooth_serial(void) {
     if (!_enabled) {
         return;
     }
+    _flush_staging();
     common_hal_bleio_packet_buffer_flush(&_tx_packet_buffer);
 }
 
@@ -191,15 +217,43 @@ void ble_serial_write(const char *text, size_t len) {
     if (!_enabled) {
         return;
     }
+    if (!ble_serial_connected()) {
+        _tx_staging_len = 0;
+        return;
+    }
+    mp_int_t packet_length = common_hal_bleio_packet_buffer_get_outgoing_packet_length(&_tx_packet_buffer);
+    // Printing from a write that is already sending, so we drop characters to transmit.
+    if (packet_length <= 0 || _tx_flushing) {
+        return;
+    }
+    size_t staging_size = MIN((size_t)packet_length, sizeof(_tx_staging));
     size_t sent = 0;
     while (sent < len) {
-        uint16_t packet_size = MIN(len - sent, (size_t)common_hal_bleio_packet_buffer_get_outgoing_packet_length(&_tx_packet_buffer));
-        mp_int_t written = common_hal_bleio_packet_buffer_write(&_tx_packet_buffer, (const uint8_t *)text + sent, packet_size, NULL, 0);
-        // Error, so we drop characters to transmit.
-        if (written < 0) {
-            break;
+        if (_tx_staging_len >= staging_size) {
+            _flush_staging();
+        }
+        if (_tx_staging_len == 0) {
+            _tx_staging_start_ms = supervisor_ticks_ms64();
         }
-        sent += written;
+        size_t copy_len = MIN(len - sent, staging_size - _tx_staging_len);
+        memcpy(_tx_staging + _tx_staging_len, text + sent, copy_len);
+        _tx_staging_len += copy_len;
+        sent += copy_len;
+    }
+    if (_tx_staging_len >= staging_size) {
+        _flush_staging();
+    }
+}
+
+void ble_serial_background(void) {
+    if (_tx_staging_len == 0 || !_enabled ||
+        common_hal_bleio_packet_buffer_deinited(&_tx_packet_buffer)) {
+        return;
+    }
+    if (!ble_serial_connected()) {
+        _tx_staging_len = 0;
+    } else if (supervisor_ticks_ms64() - _tx_staging_start_ms >= BLE_SERIAL_FLUSH_MS) {
+        _flush_staging();
     }
 }
 
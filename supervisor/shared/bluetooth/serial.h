@@ -36,6 +36,8 @@ bool ble_serial_connected(void);
 bool ble_serial_available(void);
 char ble_serial_read_char(void);
 void ble_serial_write(const char *text, size_t len);
+// Sends output that has waited long enough for more to fill its packet.
+void ble_serial_background(void);
 void ble_serial_enable(void);
 void ble_serial_disable(void);
 
@@ -0,0 +1,54 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "supervisor/shared/boot_trace.h"
+
+#include <stdbool.h>
+
+#include "supervisor/shared/tick.h"
+
+static supervisor_boot_trace_mark_t marks[CIRCUITPY_BOOT_TRACE_MARKS];
+static size_t mark_count;
+static bool ended;
+
+void supervisor_boot_trace_mark(const char *phase) {
+    if (ended || mark_count == CIRCUITPY_BOOT_TRACE_MARKS) {
+        return;
+    }
+    marks[mark_count].phase = phase;
+    marks[mark_count].ms = supervisor_ticks_ms32();
+    mark_count++;
+}
+
+void supervisor_boot_trace_end(const char *phase) {
+    supervisor_boot_trace_mark(phase);
+    ended = true;
+}
+
+const supervisor_boot_trace_mark_t *supervisor_boot_trace_get(size_t *count) {
+    *count = mark_count;
+    return marks;
+}
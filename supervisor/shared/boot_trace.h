@@ -0,0 +1,60 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SUPERVISOR_SHARED_BOOT_TRACE_H
+#define MICROPY_INCLUDED_SUPERVISOR_SHARED_BOOT_TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Records when each startup phase finishes so that slow boots can be diagnosed
+// from supervisor.runtime.boot_trace.
+
+#ifndef CIRCUITPY_BOOT_TRACE_MARKS
+#define CIRCUITPY_BOOT_TRACE_MARKS (16)
+#endif
+
+typedef struct {
+    const char *phase;
+    // Milliseconds since reset.
+    uint32_t ms;
+} supervisor_boot_trace_mark_t;
+
+#if CIRCUITPY_BOOT_TRACE
+// Note that phase has just finished. phase must be a string literal.
+void supervisor_boot_trace_mark(const char *phase);
+// Note the last mark of startup. Later marks, such as from a reload, are ignored.
+void supervisor_boot_trace_end(const char *phase);
+// Returns the marks recorded so far and sets *count to how many there are.
+const supervisor_boot_trace_mark_t *supervisor_boot_trace_get(size_t *count);
+#else
+static inline void supervisor_boot_trace_mark(const char *phase) {
+}
+static inline void supervisor_boot_trace_end(const char *phase) {
+}
+#endif
+
+#endif // MICROPY_INCLUDED_SUPERVISOR_SHARED_BOOT_TRACE_H
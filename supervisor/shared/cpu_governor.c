@@ -0,0 +1,145 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "supervisor/shared/cpu_governor.h"
+
+#include "py/mpconfig.h"
+#include "shared-bindings/microcontroller/Processor.h"
+#include "supervisor/shared/tick.h"
+
+// Times are in subticks, 1/32768 of a second.
+#define WINDOW_SUBTICKS (CIRCUITPY_CPU_GOVERNOR_WINDOW_MS * 32768 / 1000)
+
+static const uint32_t *frequencies;
+static size_t frequency_count;
+// frequencies[level], or the starting frequency when level == frequency_count.
+static size_t level;
+static uint32_t top_frequency;
+static bool running;
+// Ticks keep the background running while the VM is busy, so that it is seen
+// quickly. They are only needed below the starting frequency.
+static bool ticks_enabled;
+
+static uint32_t window_start;
+static uint32_t idle_time;
+
+static uint32_t now(void) {
+    uint8_t subticks;
+    uint64_t ticks = port_get_raw_ticks(&subticks);
+    return (uint32_t)(ticks * 32 + subticks);
+}
+
+MP_WEAK size_t port_cpu_governor_get_frequencies(const uint32_t **frequencies_out) {
+    *frequencies_out = NULL;
+    return 0;
+}
+
+MP_WEAK bool port_cpu_governor_can_change(void) {
+    return true;
+}
+
+static void set_level(size_t new_level) {
+    if (new_level == level) {
+        return;
+    }
+    level = new_level;
+    port_cpu_governor_set_frequency(level == frequency_count ? top_frequency : frequencies[level]);
+
+    bool want_ticks = level < frequency_count;
+    if (want_ticks && !ticks_enabled) {
+        supervisor_enable_tick();
+    } else if (!want_ticks && ticks_enabled) {
+        supervisor_disable_tick();
+    }
+    ticks_enabled = want_ticks;
+
+    // Start the next window after the change.
+    window_start = now();
+    idle_time = 0;
+}
+
+void supervisor_cpu_governor_reset(void) {
+    if (running) {
+        set_level(frequency_count);
+    }
+    top_frequency = common_hal_mcu_processor_get_frequency();
+    frequency_count = port_cpu_governor_get_frequencies(&frequencies);
+    // Only step between frequencies below the starting one.
+    while (frequency_count > 0 && frequencies[frequency_count - 1] >= top_frequency) {
+        frequency_count--;
+    }
+    level = frequency_count;
+    running = frequency_count > 0;
+    window_start = now();
+    idle_time = 0;
+}
+
+void supervisor_cpu_governor_stop(void) {
+    running = false;
+    if (ticks_enabled) {
+        supervisor_disable_tick();
+        ticks_enabled = false;
+    }
+}
+
+void supervisor_cpu_governor_restore_frequency(void) {
+    if (running) {
+        set_level(frequency_count);
+    }
+}
+
+void supervisor_cpu_governor_idle_until_interrupt(void) {
+    uint32_t start = now();
+    port_idle_until_interrupt();
+    idle_time += now() - start;
+    supervisor_cpu_governor_background();
+}
+
+void supervisor_cpu_governor_background(void) {
+    if (!running) {
+        return;
+    }
+    uint32_t elapsed = now() - window_start;
+    if (elapsed < WINDOW_SUBTICKS) {
+        return;
+    }
+    uint32_t busy_percent = 0;
+    if (idle_time < elapsed) {
+        busy_percent = (uint64_t)(elapsed - idle_time) * 100 / elapsed;
+    }
+    window_start += elapsed;
+    idle_time = 0;
+
+    // Peripherals set up at the current frequency keep it until they are done.
+    if (!port_cpu_governor_can_change()) {
+        return;
+    }
+    if (busy_percent >= CIRCUITPY_CPU_GOVERNOR_UP_PERCENT) {
+        set_level(frequency_count);
+    } else if (busy_percent < CIRCUITPY_CPU_GOVERNOR_DOWN_PERCENT && level > 0) {
+        set_level(level - 1);
+    }
+}
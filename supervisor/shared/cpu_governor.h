@@ -0,0 +1,91 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "supervisor/port.h"
+
+// Lowers the CPU frequency while the VM spends most of its time idle and
+// raises it again as soon as it gets busy. The frequency the VM started at is
+// the highest one used.
+
+#ifndef CIRCUITPY_CPU_GOVERNOR_WINDOW_MS
+#define CIRCUITPY_CPU_GOVERNOR_WINDOW_MS (100)
+#endif
+
+// Go back to the highest frequency when busy for at least this percentage of
+// a window.
+#ifndef CIRCUITPY_CPU_GOVERNOR_UP_PERCENT
+#define CIRCUITPY_CPU_GOVERNOR_UP_PERCENT (80)
+#endif
+
+// Step down one frequency when busy for less than this percentage of a
+// window.
+#ifndef CIRCUITPY_CPU_GOVERNOR_DOWN_PERCENT
+#define CIRCUITPY_CPU_GOVERNOR_DOWN_PERCENT (30)
+#endif
+
+#if CIRCUITPY_CPU_GOVERNOR
+// Return to the highest frequency and take the current one as the new highest.
+// Called before each VM starts.
+void supervisor_cpu_governor_reset(void);
+// Leave the frequency alone until the next reset. Used when code sets the
+// frequency itself.
+void supervisor_cpu_governor_stop(void);
+// Return to the highest frequency now. Called before setting up a peripheral
+// whose timing depends on the CPU clock, so that it is set up at the frequency
+// it will keep running at.
+void supervisor_cpu_governor_restore_frequency(void);
+// port_idle_until_interrupt() that counts the time spent idle.
+void supervisor_cpu_governor_idle_until_interrupt(void);
+// Looks at the last window and changes the frequency. Called from the
+// background tick.
+void supervisor_cpu_governor_background(void);
+
+// Ports that can scale provide these.
+
+// Set *frequencies to the frequencies to step between, slowest first, and
+// return how many there are. Ones at or above the starting frequency are not
+// used. The default returns 0, which turns the governor off.
+size_t port_cpu_governor_get_frequencies(const uint32_t **frequencies);
+// True when nothing running depends on the CPU clock staying where it is.
+bool port_cpu_governor_can_change(void);
+// Change the CPU clock. Only called with the starting frequency or one of the
+// frequencies above. There is no default.
+void port_cpu_governor_set_frequency(uint32_t frequency);
+#else
+static inline void supervisor_cpu_governor_restore_frequency(void) {
+}
+static inline void supervisor_cpu_governor_idle_until_interrupt(void) {
+    port_idle_until_interrupt();
+}
+static inline void supervisor_cpu_governor_background(void) {
+}
+#endif
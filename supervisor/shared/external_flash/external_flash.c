@@ -42,26 +42,59 @@
 
 #define NO_SECTOR_LOADED 0xFFFFFFFF
 
-// The currently cached sector in the cache, ram or flash based.
-static uint32_t current_sector;
+// Number of erase sectors that can be cached in ram at once. Writes to a cached sector are
+// coalesced until it is flushed or evicted, least recently used first, so each extra sector
+// costs SPI_FLASH_ERASE_SIZE bytes of supervisor memory but saves erase cycles when writes
+// hop between sectors (such as FAT and directory updates while logging to a file).
+#ifndef CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS
+#define CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS (1)
+#endif
+
+#define BLOCKS_PER_SECTOR (SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE)
+#define PAGES_PER_BLOCK (FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE)
+#define PAGES_PER_SECTOR (BLOCKS_PER_SECTOR * PAGES_PER_BLOCK)
 
 STATIC const external_flash_device possible_devices[] = {EXTERNAL_FLASH_DEVICES};
 #define EXTERNAL_FLASH_DEVICE_COUNT MP_ARRAY_SIZE(possible_devices)
 
 static const external_flash_device *flash_device = NULL;
 
-// Track which blocks (up to 32) in the current sector currently live in the
+// The sectors in the cache, or NO_SECTOR_LOADED for unused slots. When the
+// cache is in the scratch sector of flash only slot 0 is used.
+static uint32_t cached_sector[CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS];
+
+// Track which blocks (up to 32) in each cached sector currently live in the
 // cache.
-static uint32_t dirty_mask;
+static uint32_t dirty_mask[CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS];
+
+// When each slot was last written, for picking the least recently used one.
+static uint32_t last_use[CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS];
+static uint32_t use_count;
 
-// Table of pointers to each cached block
+// Table of pointers to each cached page, PAGES_PER_SECTOR per slot.
 static uint8_t **flash_cache_table = NULL;
 
+// Number of slots flash_cache_table holds.
+static uint8_t ram_cache_slots;
+
+// The slot supervisor_external_flash_flush_step() has erased and is writing
+// back, or -1, and the next page of it to write.
+static int8_t stepping_slot = -1;
+static uint16_t stepping_page;
+
+// Set whenever writes are enabled and cleared once the flash reports it is
+// ready again, so that reads don't poll the status register when nothing can
+// be in progress.
+static bool flash_busy = true;
+
 // Wait until both the write enable and write in progress bits have cleared.
 static bool wait_for_flash_ready(void) {
     if (flash_device == NULL) {
         return false;
     }
+    if (!flash_busy) {
+        return true;
+    }
     bool ok = true;
     // Both the write enable and write in progress bits should be low.
     if (flash_device->no_ready_bit) {
@@ -72,11 +105,26 @@ static bool wait_for_flash_ready(void) {
     do {
         ok = spi_flash_read_command(CMD_READ_STATUS, read_status_response, 1);
     } while (ok && (read_status_response[0] & 0x3) != 0);
+    flash_busy = !ok;
     return ok;
 }
 
+// Like wait_for_flash_ready() but checks the status only once.
+static bool flash_ready_now(void) {
+    if (!flash_busy || flash_device->no_ready_bit) {
+        return true;
+    }
+    uint8_t read_status_response[1] = {0x00};
+    if (spi_flash_read_command(CMD_READ_STATUS, read_status_response, 1) &&
+        (read_status_response[0] & 0x3) == 0) {
+        flash_busy = false;
+    }
+    return !flash_busy;
+}
+
 // Turn on the write enable bit so we can program and erase the flash.
 static bool write_enable(void) {
+    flash_busy = true;
     return spi_flash_command(CMD_ENABLE_WRITE);
 }
 
@@ -151,7 +199,7 @@ static bool page_erased(uint32_t sector_address) {
     uint8_t full_buffer[FILESYSTEM_BLOCK_SIZE];
     if (read_flash(sector_address, full_buffer, FILESYSTEM_BLOCK_SIZE)) {
         for (uint16_t i = 0; i < FILESYSTEM_BLOCK_SIZE; i++) {
-            if (short_buffer[i] != 0xff) {
+            if (full_buffer[i] != 0xff) {
                 return false;
             }
         }
@@ -293,9 +341,12 @@ void supervisor_flash_init(void) {
 
     wait_for_flash_ready();
 
-    current_sector = NO_SECTOR_LOADED;
-    dirty_mask = 0;
+    for (size_t slot = 0; slot < CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS; slot++) {
+        cached_sector[slot] = NO_SECTOR_LOADED;
+        dirty_mask[slot] = 0;
+    }
     flash_cache_table = NULL;
+    ram_cache_slots = 0;
 }
 
 // The size of each individual block.
@@ -316,6 +367,7 @@ uint32_t supervisor_flash_get_block_count(void) {
 // Flush the cache that was written to the scratch portion of flash. Only used
 // when ram is tight.
 static bool flush_scratch_flash(void) {
+    uint32_t current_sector = cached_sector[0];
     if (current_sector == NO_SECTOR_LOADED) {
         return true;
     }
@@ -323,8 +375,8 @@ static bool flush_scratch_flash(void) {
     // cached.
     bool copy_to_scratch_ok = true;
     uint32_t scratch_sector = flash_device->total_size - SPI_FLASH_ERASE_SIZE;
-    for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
-        if ((dirty_mask & (1 << i)) == 0) {
+    for (uint8_t i = 0; i < BLOCKS_PER_SECTOR; i++) {
+        if ((dirty_mask[0] & (1 << i)) == 0) {
             copy_to_scratch_ok = copy_to_scratch_ok &&
                 copy_block(current_sector + i * FILESYSTEM_BLOCK_SIZE,
                 scratch_sector + i * FILESYSTEM_BLOCK_SIZE);
@@ -338,89 +390,67 @@ static bool flush_scratch_flash(void) {
     // Second, erase the current sector.
     erase_sector(current_sector);
     // Finally, copy the new version into it.
-    for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
+    for (uint8_t i = 0; i < BLOCKS_PER_SECTOR; i++) {
         copy_block(scratch_sector + i * FILESYSTEM_BLOCK_SIZE,
             current_sector + i * FILESYSTEM_BLOCK_SIZE);
     }
     return true;
 }
 
-// Attempts to allocate a new set of page buffers for caching a full sector in
-// ram. Each page is allocated separately so that the GC doesn't need to provide
-// one huge block. We can free it as we write if we want to also.
-static bool allocate_ram_cache(void) {
-    uint8_t blocks_per_sector = SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE;
-    uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
+// Attempts to allocate a new set of page buffers for caching slots full
+// sectors in ram. Each page is allocated separately so that the GC doesn't need
+// to provide one huge block. We can free it as we write if we want to also.
+static bool allocate_ram_cache(uint8_t slots) {
+    uint32_t page_count = slots * PAGES_PER_SECTOR;
 
-    uint32_t table_size = blocks_per_sector * pages_per_block * sizeof(size_t);
+    uint32_t table_size = page_count * sizeof(size_t);
     // Attempt to allocate outside the heap first.
     flash_cache_table = port_malloc(table_size, false);
-
-    // Declare i and j outside the loops in case we fail to allocate everything
-    // we need. In that case we'll give it back.
-    uint8_t i = 0;
-    uint8_t j = 0;
-    bool success = flash_cache_table != NULL;
-    for (i = 0; i < blocks_per_sector && success; i++) {
-        for (j = 0; j < pages_per_block && success; j++) {
-            uint8_t *page_cache = port_malloc(SPI_FLASH_PAGE_SIZE, false);
-            if (page_cache == NULL) {
-                success = false;
-                break;
-            }
-            flash_cache_table[i * pages_per_block + j] = page_cache;
-        }
+    if (flash_cache_table == NULL) {
+        return false;
     }
-    // We couldn't allocate enough so give back what we got.
-    if (!success) {
-        // We add 1 so that we delete 0 when i is 1. Going to zero (i >= 0)
-        // would never stop because i is unsigned.
-        i++;
-        for (; i > 0; i--) {
-            for (; j > 0; j--) {
-                port_free(flash_cache_table[(i - 1) * pages_per_block + (j - 1)]);
+
+    for (uint32_t i = 0; i < page_count; i++) {
+        uint8_t *page_cache = port_malloc(SPI_FLASH_PAGE_SIZE, false);
+        if (page_cache == NULL) {
+            // We couldn't allocate enough so give back what we got.
+            while (i > 0) {
+                i--;
+                port_free(flash_cache_table[i]);
             }
-            j = pages_per_block;
+            port_free(flash_cache_table);
+            flash_cache_table = NULL;
+            return false;
         }
-        port_free(flash_cache_table);
-        flash_cache_table = NULL;
+        flash_cache_table[i] = page_cache;
     }
-    return success;
+    ram_cache_slots = slots;
+    return true;
 }
 
 static void release_ram_cache(void) {
-    uint8_t blocks_per_sector = SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE;
-    uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
-    for (uint8_t i = 0; i < blocks_per_sector; i++) {
-        for (uint8_t j = 0; j < pages_per_block; j++) {
-            uint32_t offset = i * pages_per_block + j;
-            port_free(flash_cache_table[offset]);
-        }
+    for (uint32_t i = 0; i < ram_cache_slots * PAGES_PER_SECTOR; i++) {
+        port_free(flash_cache_table[i]);
     }
     port_free(flash_cache_table);
     flash_cache_table = NULL;
+    ram_cache_slots = 0;
 }
 
-// Flush the cached sector from ram onto the flash. We'll free the cache unless
-// keep_cache is true.
-static bool flush_ram_cache(bool keep_cache) {
-    if (current_sector == NO_SECTOR_LOADED) {
-        if (!keep_cache) {
-            release_ram_cache();
-        }
-        return true;
-    }
-    // First, copy out any blocks that we haven't touched from the sector
-    // we've cached. If we don't do this we'll erase the data during the sector
-    // erase below.
+static uint8_t *cached_page(uint8_t slot, uint8_t block_index, uint8_t page) {
+    return flash_cache_table[slot * PAGES_PER_SECTOR + block_index * PAGES_PER_BLOCK + page];
+}
+
+// Copy out any blocks that we haven't touched from the sector cached in slot,
+// so that it can be erased. Afterwards every block of it lives in the cache.
+static bool fill_ram_cache_slot(uint8_t slot, uint32_t current_sector) {
     bool copy_to_ram_ok = true;
-    uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
-    for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
-        if ((dirty_mask & (1 << i)) == 0) {
-            for (uint8_t j = 0; j < pages_per_block; j++) {
+    for (uint8_t i = 0; i < BLOCKS_PER_SECTOR; i++) {
+        if ((dirty_mask[slot] & (1 << i)) == 0) {
+            for (uint8_t j = 0; j < PAGES_PER_BLOCK; j++) {
                 copy_to_ram_ok = read_flash(
-                    current_sector + (i * pages_per_block + j) * SPI_FLASH_PAGE_SIZE,
-                    flash_cache_table[i * pages_per_block + j],
+                    current_sector + (i * PAGES_PER_BLOCK + j) * SPI_FLASH_PAGE_SIZE,
+                    cached_page(slot, i, j),
                     SPI_FLASH_PAGE_SIZE);
                 if (!copy_to_ram_ok) {
                     break;
@@ -432,24 +462,54 @@ static bool flush_ram_cache(bool keep_cache) {
         }
     }
 
-    if (!copy_to_ram_ok) {
-        return false;
+    if (copy_to_ram_ok) {
+        dirty_mask[slot] = (uint32_t)((1ULL << BLOCKS_PER_SECTOR) - 1);
     }
-    // Second, erase the current sector.
-    erase_sector(current_sector);
-    // Lastly, write all the data in ram that we've cached.
-    for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
-        for (uint8_t j = 0; j < pages_per_block; j++) {
-            write_flash(current_sector + (i * pages_per_block + j) * SPI_FLASH_PAGE_SIZE,
-                flash_cache_table[i * pages_per_block + j],
-                SPI_FLASH_PAGE_SIZE);
+    return copy_to_ram_ok;
+}
+
+// Flush one cached sector from ram onto the flash and empty its slot.
+static bool flush_ram_cache_slot(uint8_t slot) {
+    uint32_t current_sector = cached_sector[slot];
+    if (current_sector == NO_SECTOR_LOADED) {
+        return true;
+    }
+    cached_sector[slot] = NO_SECTOR_LOADED;
+    uint16_t first_page = 0;
+    if (slot == stepping_slot) {
+        // Already erased, and partly written, by supervisor_external_flash_flush_step().
+        first_page = stepping_page;
+        stepping_slot = -1;
+    } else {
+        // First, copy out the rest of the sector. If we don't do this we'll
+        // erase the data during the sector erase below.
+        if (!fill_ram_cache_slot(slot, current_sector)) {
+            return false;
         }
+        // Second, erase the current sector.
+        erase_sector(current_sector);
+    }
+    // Lastly, write all the data in ram that we've cached.
+    for (uint16_t page = first_page; page < PAGES_PER_SECTOR; page++) {
+        write_flash(current_sector + page * SPI_FLASH_PAGE_SIZE,
+            flash_cache_table[slot * PAGES_PER_SECTOR + page],
+            SPI_FLASH_PAGE_SIZE);
+    }
+    return true;
+}
+
+// Flush the cached sectors from ram onto the flash. We'll free the cache unless
+// keep_cache is true.
+static bool flush_ram_cache(bool keep_cache) {
+    bool ok = true;
+    for (uint8_t slot = 0; slot < ram_cache_slots; slot++) {
+        ok = flush_ram_cache_slot(slot) && ok;
     }
     // We're done with the cache for now so give it back.
     if (!keep_cache) {
         release_ram_cache();
     }
-    return true;
+    return ok;
 }
 
 // Delegates to the correct flash flush method depending on the existing cache.
@@ -464,7 +524,9 @@ static void spi_flash_flush_keep_cache(bool keep_cache) {
     } else {
         flush_ram_cache(keep_cache);
     }
-    current_sector = NO_SECTOR_LOADED;
+    for (size_t slot = 0; slot < CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS; slot++) {
+        cached_sector[slot] = NO_SECTOR_LOADED;
+    }
     #ifdef MICROPY_HW_LED_MSC
     port_pin_set_output_level(MICROPY_HW_LED_MSC, false);
     #endif
@@ -478,6 +540,48 @@ void supervisor_flash_release_cache(void) {
     spi_flash_flush_keep_cache(false);
 }
 
+bool supervisor_external_flash_flush_step(void) {
+    if (flash_cache_table == NULL) {
+        // The scratch sector can only be copied back in one go.
+        supervisor_external_flash_flush();
+        return true;
+    }
+    if (!flash_ready_now()) {
+        return false;
+    }
+    if (stepping_slot < 0) {
+        // Start on the least recently used sector, since it is the least
+        // likely to be written again soon.
+        for (uint8_t slot = 0; slot < ram_cache_slots; slot++) {
+            if (cached_sector[slot] != NO_SECTOR_LOADED &&
+                (stepping_slot < 0 || last_use[slot] < last_use[stepping_slot])) {
+                stepping_slot = slot;
+            }
+        }
+        if (stepping_slot < 0) {
+            return true;
+        }
+        if (!fill_ram_cache_slot(stepping_slot, cached_sector[stepping_slot])) {
+            // Leave it for a full flush to report.
+            stepping_slot = -1;
+            supervisor_external_flash_flush();
+            return true;
+        }
+        erase_sector(cached_sector[stepping_slot]);
+        stepping_page = 0;
+        return false;
+    }
+    write_flash(cached_sector[stepping_slot] + stepping_page * SPI_FLASH_PAGE_SIZE,
+        flash_cache_table[stepping_slot * PAGES_PER_SECTOR + stepping_page],
+        SPI_FLASH_PAGE_SIZE);
+    stepping_page++;
+    if (stepping_page == PAGES_PER_SECTOR) {
+        cached_sector[stepping_slot] = NO_SECTOR_LOADED;
+        stepping_slot = -1;
+    }
+    return false;
+}
+
 static int32_t convert_block_to_flash_addr(uint32_t block) {
     if (0 <= block && block < supervisor_flash_get_block_count()) {
         // a block in partition 1
@@ -487,6 +591,16 @@ static int32_t convert_block_to_flash_addr(uint32_t block) {
     return -1;
 }
 
+// Returns the cache slot holding sector, or -1 if it isn't cached.
+static int find_cached_sector(uint32_t sector) {
+    for (size_t slot = 0; slot < CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS; slot++) {
+        if (cached_sector[slot] == sector) {
+            return slot;
+        }
+    }
+    return -1;
+}
+
 static bool external_flash_read_block(uint8_t *dest, uint32_t block) {
     int32_t address = convert_block_to_flash_addr(block);
     if (address == -1) {
@@ -496,15 +610,15 @@ static bool external_flash_read_block(uint8_t *dest, uint32_t block) {
 
     // Mask out the lower bits that designate the address within the sector.
     uint32_t this_sector = address & (~(SPI_FLASH_ERASE_SIZE - 1));
-    uint8_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % (SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE);
-    uint8_t mask = 1 << (block_index);
-    // We're reading from the currently cached sector.
-    if (current_sector == this_sector && (mask & dirty_mask) > 0) {
+    uint8_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % BLOCKS_PER_SECTOR;
+    uint32_t mask = 1 << (block_index);
+    int slot = find_cached_sector(this_sector);
+    // We're reading from a cached sector.
+    if (slot >= 0 && (mask & dirty_mask[slot]) > 0) {
         if (flash_cache_table != NULL) {
-            uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
-            for (int i = 0; i < pages_per_block; i++) {
+            for (int i = 0; i < PAGES_PER_BLOCK; i++) {
                 memcpy(dest + i * SPI_FLASH_PAGE_SIZE,
-                    flash_cache_table[block_index * pages_per_block + i],
+                    cached_page(slot, block_index, i),
                     SPI_FLASH_PAGE_SIZE);
             }
             return true;
@@ -516,6 +630,28 @@ static bool external_flash_read_block(uint8_t *dest, uint32_t block) {
     return read_flash(address, dest, FILESYSTEM_BLOCK_SIZE);
 }
 
+// Picks the ram cache slot for a newly cached sector, flushing the least
+// recently used sector if every slot is taken.
+static uint8_t claim_ram_cache_slot(void) {
+    uint8_t lru = 0;
+    for (uint8_t slot = 0; slot < ram_cache_slots; slot++) {
+        if (cached_sector[slot] == NO_SECTOR_LOADED) {
+            return slot;
+        }
+        if (last_use[slot] < last_use[lru]) {
+            lru = slot;
+        }
+    }
+    #ifdef MICROPY_HW_LED_MSC
+    port_pin_set_output_level(MICROPY_HW_LED_MSC, true);
+    #endif
+    flush_ram_cache_slot(lru);
+    #ifdef MICROPY_HW_LED_MSC
+    port_pin_set_output_level(MICROPY_HW_LED_MSC, false);
+    #endif
+    return lru;
+}
+
 static bool external_flash_write_block(const uint8_t *data, uint32_t block) {
     // Non-MBR block, copy to cache
     int32_t address = convert_block_to_flash_addr(block);
@@ -527,32 +663,43 @@ static bool external_flash_write_block(const uint8_t *data, uint32_t block) {
     wait_for_flash_ready();
     // Mask out the lower bits that designate the address within the sector.
     uint32_t this_sector = address & (~(SPI_FLASH_ERASE_SIZE - 1));
-    uint8_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % (SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE);
-    uint8_t mask = 1 << (block_index);
-    // Flush the cache if we're moving onto a sector or we're writing the
-    // same block again.
-    if (current_sector != this_sector || (mask & dirty_mask) > 0) {
+    uint8_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % BLOCKS_PER_SECTOR;
+    uint32_t mask = 1 << (block_index);
+    int slot = find_cached_sector(this_sector);
+    // Pages of a sector that is being written back in steps may already be on
+    // the flash, so finish it before changing its cache.
+    if (slot >= 0 && slot == stepping_slot) {
+        flush_ram_cache_slot(slot);
+        slot = -1;
+    }
+    // A sector cached in ram takes any number of writes to its blocks. The
+    // scratch sector can't be rewritten, so writing the same block again
+    // flushes it.
+    if (slot < 0 || (flash_cache_table == NULL && (mask & dirty_mask[slot]) > 0)) {
         // Check to see if we'd write to an erased page. In that case we
         // can write directly.
-        if (page_erased(address)) {
+        if (slot < 0 && page_erased(address)) {
             return write_flash(address, data, FILESYSTEM_BLOCK_SIZE);
         }
-        if (current_sector != NO_SECTOR_LOADED) {
+        if (flash_cache_table == NULL && cached_sector[0] != NO_SECTOR_LOADED) {
             supervisor_flash_flush();
         }
-        if (flash_cache_table == NULL && !allocate_ram_cache()) {
+        if (flash_cache_table == NULL &&
+            !allocate_ram_cache(CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS) &&
+            (CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS == 1 || !allocate_ram_cache(1))) {
             erase_sector(flash_device->total_size - SPI_FLASH_ERASE_SIZE);
             wait_for_flash_ready();
         }
-        current_sector = this_sector;
-        dirty_mask = 0;
+        slot = flash_cache_table == NULL ? 0 : claim_ram_cache_slot();
+        cached_sector[slot] = this_sector;
+        dirty_mask[slot] = 0;
     }
-    dirty_mask |= mask;
+    dirty_mask[slot] |= mask;
+    last_use[slot] = ++use_count;
     // Copy the block to the appropriate cache.
     if (flash_cache_table != NULL) {
-        uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
-        for (int i = 0; i < pages_per_block; i++) {
-            memcpy(flash_cache_table[block_index * pages_per_block + i],
+        for (int i = 0; i < PAGES_PER_BLOCK; i++) {
+            memcpy(cached_page(slot, block_index, i),
                 data + i * SPI_FLASH_PAGE_SIZE,
                 SPI_FLASH_PAGE_SIZE);
         }
@@ -563,11 +710,38 @@ static bool external_flash_write_block(const uint8_t *data, uint32_t block) {
     }
 }
 
+// Returns true if block has a newer copy in the cache than in flash.
+static bool block_is_cached(uint32_t block) {
+    uint32_t address = block * FILESYSTEM_BLOCK_SIZE;
+    int slot = find_cached_sector(address & (~(SPI_FLASH_ERASE_SIZE - 1)));
+    return slot >= 0 && (dirty_mask[slot] & (1 << ((address / FILESYSTEM_BLOCK_SIZE) % BLOCKS_PER_SECTOR))) > 0;
+}
+
 mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block_num, uint32_t num_blocks) {
-    for (size_t i = 0; i < num_blocks; i++) {
-        if (!external_flash_read_block(dest + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
+    uint32_t block_count = supervisor_flash_get_block_count();
+    if (block_num >= block_count || num_blocks > block_count - block_num) {
+        return 1; // error
+    }
+    size_t i = 0;
+    while (i < num_blocks) {
+        if (block_is_cached(block_num + i)) {
+            if (!external_flash_read_block(dest + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
+                return 1; // error
+            }
+            i++;
+            continue;
+        }
+        // Read a run of blocks that only live in flash with a single transfer.
+        // Ports with memory mapped (Q)SPI turn this into one long copy.
+        size_t run = 1;
+        while (i + run < num_blocks && !block_is_cached(block_num + i + run)) {
+            run++;
+        }
+        if (!read_flash((block_num + i) * FILESYSTEM_BLOCK_SIZE,
+            dest + i * FILESYSTEM_BLOCK_SIZE, run * FILESYSTEM_BLOCK_SIZE)) {
             return 1; // error
         }
+        i += run;
     }
     return 0; // success
 }
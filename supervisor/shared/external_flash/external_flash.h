@@ -47,6 +47,10 @@
 
 void supervisor_external_flash_flush(void);
 
+// Writes back a little of the sectors cached in ram without waiting on the
+// flash, for background tasks. Returns true once nothing is left to write.
+bool supervisor_external_flash_flush_step(void);
+
 // Configure anything that needs to get set up before the external flash
 // is init'ed. For example, if GPIO needs to be configured to enable the
 // flash chip, as is the case on some boards.
@@ -49,6 +49,15 @@ DWORD get_fattime(void) {
     #endif
 }
 
+#if MICROPY_VFS_LFS2
+// littlefs stamps files with this, so give them the same time as FAT files.
+uint64_t mp_hal_time_ns(void) {
+    DWORD t = get_fattime();
+    return timeutils_seconds_since_epoch(1980 + (t >> 25), (t >> 21) & 0xf, (t >> 16) & 0x1f,
+        (t >> 11) & 0x1f, (t >> 5) & 0x3f, (t & 0x1f) * 2) * 1000000000ULL;
+}
+#endif
+
 void override_fattime(DWORD time) {
     _time_override = time;
 }
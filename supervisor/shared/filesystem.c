@@ -34,6 +34,7 @@
 
 #include "supervisor/flash.h"
 #include "supervisor/linker.h"
+#include "supervisor/shared/boot_trace.h"
 
 static mp_vfs_mount_t _mp_vfs;
 static fs_user_mount_t _internal_vfs;
@@ -41,13 +42,38 @@ static fs_user_mount_t _internal_vfs;
 static volatile uint32_t filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
 volatile bool filesystem_flush_requested = false;
 
+#if CIRCUITPY_FILESYSTEM_WRITE_BEHIND
+static bool filesystem_write_behind_pending = false;
+
+void filesystem_write_behind(void) {
+    filesystem_write_behind_pending = true;
+}
+
+void filesystem_write_behind_sync(void) {
+    if (filesystem_write_behind_pending) {
+        supervisor_flash_flush();
+        filesystem_write_behind_pending = false;
+    }
+}
+#endif
+
 void filesystem_background(void) {
     if (filesystem_flush_requested) {
         filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
         // Flush but keep caches
+        #if CIRCUITPY_FILESYSTEM_WRITE_BEHIND
+        filesystem_write_behind_pending = true;
+        #else
         supervisor_flash_flush();
+        #endif
         filesystem_flush_requested = false;
     }
+    #if CIRCUITPY_FILESYSTEM_WRITE_BEHIND
+    // One page or erase per tick, so that nothing else waits long on the flash.
+    if (filesystem_write_behind_pending) {
+        filesystem_write_behind_pending = !supervisor_flash_flush_step();
+    }
+    #endif
 }
 
 inline void filesystem_tick(void) {
@@ -102,6 +128,7 @@ bool filesystem_init(bool create_allowed, bool force_create) {
 
     // try to mount the flash
     FRESULT res = f_mount(&vfs_fat->fatfs);
+    supervisor_boot_trace_mark("filesystem_mount");
     if ((res == FR_NO_FILESYSTEM && create_allowed) || force_create) {
         // No filesystem so create a fresh one, or reformat has been requested.
         uint8_t working_buf[FF_MAX_SS];
@@ -190,6 +217,9 @@ void PLACE_IN_ITCM(filesystem_flush)(void) {
     // Reset interval before next flush.
     filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
     supervisor_flash_flush();
+    #if CIRCUITPY_FILESYSTEM_WRITE_BEHIND
+    filesystem_write_behind_pending = false;
+    #endif
     // Don't keep caches because this is called when starting or stopping the VM.
     supervisor_flash_release_cache();
 }
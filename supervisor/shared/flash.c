@@ -29,12 +29,23 @@
 #include "py/runtime.h"
 #include "lib/oofatfs/ff.h"
 #include "supervisor/flash.h"
+#include "supervisor/filesystem.h"
 #include "supervisor/shared/tick.h"
 
 #define VFS_INDEX 0
 
 #define PART1_START_BLOCK (0x1)
 
+#ifndef CIRCUITPY_STORAGE_DATA_PARTITION_SIZE
+#define CIRCUITPY_STORAGE_DATA_PARTITION_SIZE (0)
+#endif
+
+#if CIRCUITPY_STORAGE_DATA_PARTITION_SIZE % 4096 != 0
+#error "CIRCUITPY_STORAGE_DATA_PARTITION_SIZE must be a multiple of 4096"
+#endif
+
+#define DATA_PARTITION_BLOCKS (CIRCUITPY_STORAGE_DATA_PARTITION_SIZE / FILESYSTEM_BLOCK_SIZE)
+
 // there is a singleton Flash object
 const mp_obj_type_t supervisor_flash_type;
 STATIC const mp_obj_base_t supervisor_flash_obj = {&supervisor_flash_type};
@@ -47,8 +58,13 @@ STATIC mp_obj_t supervisor_flash_obj_make_new(const mp_obj_type_t *type, size_t
     return (mp_obj_t)&supervisor_flash_obj;
 }
 
+// The blocks in CIRCUITPY, which leaves out the data partition.
+static uint32_t circuitpy_get_block_count(void) {
+    return supervisor_flash_get_block_count() - DATA_PARTITION_BLOCKS;
+}
+
 static uint32_t flash_get_block_count(void) {
-    return PART1_START_BLOCK + supervisor_flash_get_block_count();
+    return PART1_START_BLOCK + circuitpy_get_block_count();
 }
 
 static void build_partition(uint8_t *buf, int boot, int type, uint32_t start_block, uint32_t num_blocks) {
@@ -96,7 +112,7 @@ static mp_uint_t flash_read_blocks(mp_obj_t self, uint8_t *dest, uint32_t block_
         }
 
         // Specifying "Big FAT12/16 CHS" allows mounting by Android
-        build_partition(dest + 446, 0, 0x06 /* Big FAT12/16 CHS */, PART1_START_BLOCK, supervisor_flash_get_block_count());
+        build_partition(dest + 446, 0, 0x06 /* Big FAT12/16 CHS */, PART1_START_BLOCK, circuitpy_get_block_count());
         build_partition(dest + 462, 0, 0, 0, 0);
         build_partition(dest + 478, 0, 0, 0, 0);
         build_partition(dest + 494, 0, 0, 0, 0);
@@ -117,6 +133,14 @@ static mp_uint_t flash_read_blocks(mp_obj_t self, uint8_t *dest, uint32_t block_
 
 static volatile bool filesystem_dirty = false;
 
+static void flash_mark_dirty(void) {
+    if (!filesystem_dirty) {
+        // Turn on ticks so that we can flush after a period of time elapses.
+        supervisor_enable_tick();
+        filesystem_dirty = true;
+    }
+}
+
 static mp_uint_t flash_write_blocks(mp_obj_t self, const uint8_t *src, uint32_t block_num, uint32_t num_blocks) {
     if (block_num == 0) {
         if (num_blocks > 1) {
@@ -125,26 +149,59 @@ static mp_uint_t flash_write_blocks(mp_obj_t self, const uint8_t *src, uint32_t
         // can't write MBR, but pretend we did
         return 0;
     } else {
-        if (!filesystem_dirty) {
-            // Turn on ticks so that we can flush after a period of time elapses.
-            supervisor_enable_tick();
-            filesystem_dirty = true;
-        }
+        flash_mark_dirty();
         return supervisor_flash_write_blocks(src, block_num - PART1_START_BLOCK, num_blocks);
     }
 }
 
+#if CIRCUITPY_STORAGE_DATA_PARTITION_SIZE > 0
+uint32_t supervisor_flash_data_get_block_count(void) {
+    return DATA_PARTITION_BLOCKS;
+}
+
+mp_uint_t supervisor_flash_data_read_blocks(uint8_t *dest, uint32_t block_num, uint32_t num_blocks) {
+    if (block_num + num_blocks > DATA_PARTITION_BLOCKS) {
+        return 1; // error
+    }
+    return supervisor_flash_read_blocks(dest, circuitpy_get_block_count() + block_num, num_blocks);
+}
+
+mp_uint_t supervisor_flash_data_write_blocks(const uint8_t *src, uint32_t block_num, uint32_t num_blocks) {
+    if (block_num + num_blocks > DATA_PARTITION_BLOCKS) {
+        return 1; // error
+    }
+    flash_mark_dirty();
+    return supervisor_flash_write_blocks(src, circuitpy_get_block_count() + block_num, num_blocks);
+}
+#endif
+
+static void flash_flushed(void) {
+    // Turn off ticks now that our filesystem has been flushed.
+    if (filesystem_dirty) {
+        supervisor_disable_tick();
+    }
+    filesystem_dirty = false;
+}
+
 void PLACE_IN_ITCM(supervisor_flash_flush)(void) {
     #if INTERNAL_FLASH_FILESYSTEM
     port_internal_flash_flush();
     #else
     supervisor_external_flash_flush();
     #endif
-    // Turn off ticks now that our filesystem has been flushed.
-    if (filesystem_dirty) {
-        supervisor_disable_tick();
+    flash_flushed();
+}
+
+bool supervisor_flash_flush_step(void) {
+    #if INTERNAL_FLASH_FILESYSTEM
+    supervisor_flash_flush();
+    #else
+    if (!supervisor_external_flash_flush_step()) {
+        return false;
     }
-    filesystem_dirty = false;
+    flash_flushed();
+    #endif
+    return true;
 }
 
 STATIC mp_obj_t supervisor_flash_obj_readblocks(mp_obj_t self, mp_obj_t block_num, mp_obj_t buf) {
@@ -175,7 +232,11 @@ STATIC bool flash_ioctl(mp_obj_t self_in, size_t cmd, size_t arg, mp_int_t *out_
             supervisor_flash_flush();
             break; // TODO properly
         case MP_BLOCKDEV_IOCTL_SYNC:
+            #if CIRCUITPY_FILESYSTEM_WRITE_BEHIND
+            filesystem_write_behind();
+            #else
             supervisor_flash_flush();
+            #endif
             break;
         case MP_BLOCKDEV_IOCTL_BLOCK_COUNT:
             *out_value = flash_get_block_count();
@@ -0,0 +1,111 @@
+/*
+ * This file is part of the Micro Python project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "supervisor/shared/import_cache.h"
+
+#include <string.h>
+
+#include "py/persistentcode.h"
+#include "supervisor/port_heap.h"
+
+// Entries are packed one after another, oldest first, each padded to a multiple of four.
+typedef struct {
+    uint32_t size;
+    uint32_t data_len;
+    byte key[MP_IMPORT_CACHE_KEY_LEN];
+    // The NUL terminated path, followed by the data.
+    char path[];
+} import_cache_entry_t;
+
+STATIC byte *import_cache = NULL;
+STATIC size_t import_cache_used = 0;
+
+void supervisor_import_cache_init(void) {
+    if (import_cache == NULL) {
+        import_cache = port_malloc(CIRCUITPY_WARM_RELOAD_CACHE_SIZE, false);
+    }
+}
+
+STATIC void import_cache_remove(import_cache_entry_t *entry) {
+    byte *start = (byte *)entry;
+    size_t size = entry->size;
+    memmove(start, start + size, import_cache_used - (start - import_cache) - size);
+    import_cache_used -= size;
+}
+
+STATIC import_cache_entry_t *import_cache_find(const char *path) {
+    size_t offset = 0;
+    while (offset < import_cache_used) {
+        import_cache_entry_t *entry = (import_cache_entry_t *)(import_cache + offset);
+        if (strcmp(entry->path, path) == 0) {
+            return entry;
+        }
+        offset += entry->size;
+    }
+    return NULL;
+}
+
+const byte *mp_import_cache_warm_lookup(const char *path, const byte *key, size_t *len) {
+    if (import_cache == NULL) {
+        return NULL;
+    }
+    import_cache_entry_t *entry = import_cache_find(path);
+    if (entry == NULL) {
+        return NULL;
+    }
+    if (memcmp(entry->key, key, MP_IMPORT_CACHE_KEY_LEN) != 0) {
+        // The source has changed, so the data will be replaced once it's compiled.
+        import_cache_remove(entry);
+        return NULL;
+    }
+    *len = entry->data_len;
+    return (const byte *)entry->path + strlen(entry->path) + 1;
+}
+
+void mp_import_cache_warm_store(const char *path, const byte *key, const byte *data, size_t len) {
+    if (import_cache == NULL) {
+        return;
+    }
+    import_cache_entry_t *old = import_cache_find(path);
+    if (old != NULL) {
+        import_cache_remove(old);
+    }
+    size_t path_len = strlen(path) + 1;
+    size_t size = (sizeof(import_cache_entry_t) + path_len + len + 3) & ~3;
+    if (size > CIRCUITPY_WARM_RELOAD_CACHE_SIZE) {
+        return;
+    }
+    while (import_cache_used + size > CIRCUITPY_WARM_RELOAD_CACHE_SIZE) {
+        import_cache_remove((import_cache_entry_t *)import_cache);
+    }
+    import_cache_entry_t *entry = (import_cache_entry_t *)(import_cache + import_cache_used);
+    entry->size = size;
+    entry->data_len = len;
+    memcpy(entry->key, key, MP_IMPORT_CACHE_KEY_LEN);
+    memcpy(entry->path, path, path_len);
+    memcpy(entry->path + path_len, data, len);
+    import_cache_used += size;
+}
@@ -0,0 +1,109 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "supervisor/shared/native_code.h"
+
+#include <string.h>
+
+#include "py/persistentcode.h"
+#include "py/runtime.h"
+#include "supervisor/port_heap.h"
+
+typedef struct _native_code_node_t {
+    struct _native_code_node_t *next;
+    uint32_t data[];
+} native_code_node_t;
+
+STATIC native_code_node_t *native_code_head = NULL;
+
+#if CIRCUITPY_NATIVE_CODE_RAM_SIZE > 0
+// Reserved by the port's linker script. Code is only ever freed all at once, so a bump
+// allocator is all that's needed.
+extern uint32_t _ld_native_code_start;
+extern uint32_t _ld_native_code_end;
+
+STATIC uint32_t *native_code_next = NULL;
+
+MP_WEAK void *port_malloc_exec(size_t size) {
+    if (native_code_next == NULL) {
+        native_code_next = &_ld_native_code_start;
+    }
+    size_t words = (size + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+    if (words > (size_t)(&_ld_native_code_end - native_code_next)) {
+        return NULL;
+    }
+    void *ptr = native_code_next;
+    native_code_next += words;
+    return ptr;
+}
+
+MP_WEAK void port_free_exec(void *ptr) {
+    // The last free rewinds the region to its start.
+    native_code_next = ptr;
+}
+#else
+MP_WEAK void *port_malloc_exec(size_t size) {
+    return port_malloc(size, false);
+}
+
+MP_WEAK void port_free_exec(void *ptr) {
+    port_free(ptr);
+}
+#endif
+
+void *supervisor_native_code_commit(void *buf, size_t len, void *reloc) {
+    // Only code loaded from .mpy files comes with relocations. Dynamic native modules
+    // arrive as one block holding all of their functions.
+    if (len > (reloc ? CIRCUITPY_NATIVE_MODULE_MAX_SIZE : CIRCUITPY_NATIVE_FUNCTION_MAX_SIZE)) {
+        mp_raise_msg(&mp_type_MemoryError, MP_ERROR_TEXT("native method too big"));
+    }
+    // Some executable memory, such as Xtensa IRAM, only allows 32-bit accesses.
+    len = (len + 3) & ~3;
+    size_t len_node = sizeof(native_code_node_t) + len;
+    native_code_node_t *node = port_malloc_exec(len_node);
+    if (node == NULL) {
+        m_malloc_fail(len_node);
+    }
+    node->next = native_code_head;
+    native_code_head = node;
+    void *p = node->data;
+    #if MICROPY_PERSISTENT_CODE_LOAD
+    if (reloc) {
+        mp_native_relocate(reloc, buf, (uintptr_t)p);
+    }
+    #endif
+    memcpy(p, buf, len);
+    return p;
+}
+
+void supervisor_native_code_free_all(void) {
+    // Nodes are freed newest first so the reserved region unwinds to its start.
+    while (native_code_head != NULL) {
+        native_code_node_t *next = native_code_head->next;
+        port_free_exec(native_code_head);
+        native_code_head = next;
+    }
+}
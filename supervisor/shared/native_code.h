@@ -0,0 +1,48 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+// Machine code from @micropython.native, @micropython.viper and native .mpy files is
+// assembled on the VM heap and then copied here, into memory the CPU can execute from.
+// Each function is limited to CIRCUITPY_NATIVE_FUNCTION_MAX_SIZE bytes, and relocatable
+// code from .mpy files, such as a dynamic native module, to CIRCUITPY_NATIVE_MODULE_MAX_SIZE.
+// All of it is released when the VM stops.
+
+// Copies len bytes of code from buf into executable memory, applying the relocations in
+// reloc if it isn't NULL. Returns the executable copy. Raises MemoryError on failure.
+void *supervisor_native_code_commit(void *buf, size_t len, void *reloc);
+
+// Frees all committed code. Called once the VM heap is gone.
+void supervisor_native_code_free_all(void);
+
+// Ports provide executable memory by overriding these. The default carves code out of
+// the region reserved by the linker script when CIRCUITPY_NATIVE_CODE_RAM_SIZE is
+// non-zero, and otherwise out of the supervisor heap, which is executable on Cortex-M.
+void *port_malloc_exec(size_t size);
+void port_free_exec(void *ptr);
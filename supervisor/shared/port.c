@@ -46,6 +46,16 @@ MP_WEAK void port_yield(void) {
 MP_WEAK void port_boot_info(void) {
 }
 
+MP_WEAK uint32_t port_get_cycle_count(void) {
+    uint8_t subticks = 0;
+    uint64_t ticks = port_get_raw_ticks(&subticks);
+    return ticks * 32 + subticks;
+}
+
+MP_WEAK uint32_t port_get_cycle_count_frequency(void) {
+    return 32768;
+}
+
 MP_WEAK void port_heap_init(void) {
     uint32_t *heap_bottom = port_heap_get_bottom();
     uint32_t *heap_top = port_heap_get_top();
@@ -58,6 +68,15 @@ MP_WEAK void *port_malloc(size_t size, bool dma_capable) {
     return block;
 }
 
+// Ports with a single kind of RAM have nothing slower to avoid.
+MP_WEAK void *port_malloc_fast(size_t size) {
+    return port_malloc(size, false);
+}
+
+MP_WEAK bool port_heap_is_fast(void *ptr) {
+    return true;
+}
+
 MP_WEAK void port_free(void *ptr) {
     tlsf_free(heap, ptr);
 }
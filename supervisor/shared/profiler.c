@@ -0,0 +1,112 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "supervisor/shared/profiler.h"
+
+#include "py/bc.h"
+#include "py/mpstate.h"
+#include "py/objfun.h"
+#include "supervisor/shared/tick.h"
+
+static supervisor_profiler_sample_t samples[CIRCUITPY_SAMPLING_PROFILER_SAMPLES];
+// Total samples taken since the last start; the next one goes in
+// samples[total % CIRCUITPY_SAMPLING_PROFILER_SAMPLES].
+static volatile uint32_t total;
+static volatile bool running;
+static volatile bool held;
+
+void supervisor_profiler_start(void) {
+    held = false;
+    total = 0;
+    if (!running) {
+        running = true;
+        supervisor_enable_tick();
+    }
+}
+
+void supervisor_profiler_stop(void) {
+    if (running) {
+        running = false;
+        supervisor_disable_tick();
+    }
+}
+
+void supervisor_profiler_reset(void) {
+    supervisor_profiler_stop();
+    total = 0;
+}
+
+bool supervisor_profiler_running(void) {
+    return running;
+}
+
+void supervisor_profiler_hold(bool hold) {
+    held = hold;
+}
+
+void supervisor_profiler_sample(void) {
+    if (!running || held) {
+        return;
+    }
+    // The VM only changes this between frames, so whatever it points to is
+    // fully set up, and its ip is updated before each opcode runs.
+    const mp_code_state_t *code_state = MP_STATE_THREAD(current_code_state);
+    if (code_state == NULL) {
+        return;
+    }
+    const mp_obj_fun_bc_t *fun = code_state->fun_bc;
+    const byte *ip = fun->bytecode;
+    MP_BC_PRELUDE_SIG_DECODE(ip);
+    MP_BC_PRELUDE_SIZE_DECODE(ip);
+    const byte *bytecode_start = ip + n_info + n_cell;
+    qstr function = mp_decode_uint_value(ip);
+    #if MICROPY_EMIT_BYTECODE_USES_QSTR_TABLE
+    function = fun->context->constants.qstr_table[function];
+    qstr source_file = fun->context->constants.qstr_table[0];
+    #else
+    qstr source_file = fun->context->constants.source_file;
+    #endif
+
+    supervisor_profiler_sample_t *sample = &samples[total % CIRCUITPY_SAMPLING_PROFILER_SAMPLES];
+    sample->source_file = source_file;
+    sample->function = function;
+    sample->offset = code_state->ip - bytecode_start;
+    total++;
+}
+
+size_t supervisor_profiler_sample_count(void) {
+    return MIN(total, CIRCUITPY_SAMPLING_PROFILER_SAMPLES);
+}
+
+uint32_t supervisor_profiler_total(void) {
+    return total;
+}
+
+const supervisor_profiler_sample_t *supervisor_profiler_get_sample(size_t i) {
+    size_t oldest = total > CIRCUITPY_SAMPLING_PROFILER_SAMPLES ? total % CIRCUITPY_SAMPLING_PROFILER_SAMPLES : 0;
+    return &samples[(oldest + i) % CIRCUITPY_SAMPLING_PROFILER_SAMPLES];
+}
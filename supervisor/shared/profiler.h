@@ -0,0 +1,76 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#ifndef MICROPY_INCLUDED_SUPERVISOR_SHARED_PROFILER_H
+#define MICROPY_INCLUDED_SUPERVISOR_SHARED_PROFILER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "py/qstr.h"
+
+// Samples which bytecode function is running on every supervisor tick, so that
+// hot spots can be found from supervisor.runtime or the web workflow.
+
+#ifndef CIRCUITPY_SAMPLING_PROFILER_SAMPLES
+#define CIRCUITPY_SAMPLING_PROFILER_SAMPLES (256)
+#endif
+
+typedef struct {
+    qstr_short_t source_file;
+    qstr_short_t function;
+    // Offset of the running opcode from the start of the function's bytecode.
+    uint32_t offset;
+} supervisor_profiler_sample_t;
+
+#if CIRCUITPY_SAMPLING_PROFILER
+// Clear the samples and start taking new ones.
+void supervisor_profiler_start(void);
+// Stop taking samples and keep the ones taken so far.
+void supervisor_profiler_stop(void);
+// Stop and discard the samples. Called when the VM finishes, because samples
+// name functions by qstrs that may go away with the VM's heap.
+void supervisor_profiler_reset(void);
+bool supervisor_profiler_running(void);
+// Called from the tick interrupt.
+void supervisor_profiler_sample(void);
+// Pause or resume sampling while the samples are read out.
+void supervisor_profiler_hold(bool hold);
+// Returns the number of samples held. Older ones are overwritten once the
+// buffer is full.
+size_t supervisor_profiler_sample_count(void);
+// Returns the number of samples taken since the last start.
+uint32_t supervisor_profiler_total(void);
+// Returns sample i, where 0 is the oldest held.
+const supervisor_profiler_sample_t *supervisor_profiler_get_sample(size_t i);
+#else
+static inline void supervisor_profiler_sample(void) {
+}
+#endif
+
+#endif // MICROPY_INCLUDED_SUPERVISOR_SHARED_PROFILER_H
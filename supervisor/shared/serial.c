@@ -30,6 +30,7 @@
 #include "py/mpconfig.h"
 #include "py/mphal.h"
 
+#include "supervisor/background_callback.h"
 #include "supervisor/shared/cpu.h"
 #include "supervisor/shared/display.h"
 #include "shared-bindings/terminalio/Terminal.h"
@@ -80,6 +81,81 @@ static bool _serial_console_write_disabled;
 // Set to true to temporarily discard writes to the display terminal only.
 static bool _serial_display_write_disabled;
 
+#if CIRCUITPY_TERMINALIO
+#include "py/ringbuf.h"
+
+// Output for the display terminal is queued here and written to it from a background
+// callback, so print() doesn't wait for the terminal. 0 writes to the terminal directly.
+#ifndef CIRCUITPY_TERMINAL_OUTPUT_BUFFER_SIZE
+#define CIRCUITPY_TERMINAL_OUTPUT_BUFFER_SIZE (CIRCUITPY_FULL_BUILD ? 512 : 0)
+#endif
+
+// When the queue is full, 1 drops the oldest whole lines, as the terminal is only a view of
+// recent output. 0 writes the queue out to the terminal and then carries on.
+#ifndef CIRCUITPY_TERMINAL_OUTPUT_DROP
+#define CIRCUITPY_TERMINAL_OUTPUT_DROP (1)
+#endif
+
+#if CIRCUITPY_TERMINAL_OUTPUT_BUFFER_SIZE > 0
+typedef struct {
+    ringbuf_t ringbuf;
+    background_callback_t callback;
+    void (*write)(const char *text, uint32_t length);
+    bool drop_when_full;
+} serial_sink_buffer_t;
+
+STATIC void serial_sink_buffer_drain(void *data) {
+    serial_sink_buffer_t *sink = data;
+    char chunk[64];
+    size_t len;
+    while ((len = ringbuf_get_n(&sink->ringbuf, (uint8_t *)chunk, sizeof(chunk))) > 0) {
+        sink->write(chunk, len);
+    }
+}
+
+// Discard queued output up to and including the first newline, or all of it if there is none.
+STATIC void serial_sink_buffer_drop_line(serial_sink_buffer_t *sink) {
+    int c;
+    while ((c = ringbuf_get(&sink->ringbuf)) >= 0 && c != '\n') {
+    }
+}
+
+STATIC void serial_sink_buffer_write(serial_sink_buffer_t *sink, const char *text, uint32_t length) {
+    // Writes from interrupts go straight through, as before, instead of racing the drain.
+    if (cpu_interrupt_active()) {
+        sink->write(text, length);
+        return;
+    }
+    if (length > ringbuf_size(&sink->ringbuf)) {
+        serial_sink_buffer_drain(sink);
+        sink->write(text, length);
+        return;
+    }
+    while (ringbuf_num_empty(&sink->ringbuf) < length) {
+        if (sink->drop_when_full) {
+            serial_sink_buffer_drop_line(sink);
+        } else {
+            serial_sink_buffer_drain(sink);
+        }
+    }
+    ringbuf_put_n(&sink->ringbuf, (const uint8_t *)text, length);
+    background_callback_add(&sink->callback, serial_sink_buffer_drain, sink);
+}
+
+STATIC void serial_terminal_write(const char *text, uint32_t length) {
+    int errcode;
+    common_hal_terminalio_terminal_write(&supervisor_terminal, (const uint8_t *)text, length, &errcode);
+}
+
+STATIC uint8_t _terminal_output_buf[CIRCUITPY_TERMINAL_OUTPUT_BUFFER_SIZE];
+STATIC serial_sink_buffer_t _terminal_output = {
+    .ringbuf = { .buf = _terminal_output_buf, .size = sizeof(_terminal_output_buf) },
+    .write = serial_terminal_write,
+    .drop_when_full = CIRCUITPY_TERMINAL_OUTPUT_DROP,
+};
+#endif
+#endif
+
 #if CIRCUITPY_CONSOLE_UART
 STATIC void console_uart_print_strn(void *env, const char *str, size_t len) {
     (void)env;
@@ -314,9 +390,13 @@ void serial_write_substring(const char *text, uint32_t length) {
     }
 
     #if CIRCUITPY_TERMINALIO
-    int errcode;
     if (!_serial_display_write_disabled) {
+        #if CIRCUITPY_TERMINAL_OUTPUT_BUFFER_SIZE > 0
+        serial_sink_buffer_write(&_terminal_output, text, length);
+        #else
+        int errcode;
         common_hal_terminalio_terminal_write(&supervisor_terminal, (const uint8_t *)text, length, &errcode);
+        #endif
     }
     #endif
 
@@ -163,6 +163,8 @@ void supervisor_status_bar_resume(void) {
 void supervisor_status_bar_init(void) {
     status_bar_background_cb.fun = status_bar_background;
     status_bar_background_cb.data = NULL;
+    // The status bar can always wait for audio, USB and display refreshes.
+    status_bar_background_cb.priority = BACKGROUND_CALLBACK_IDLE;
 
     shared_module_supervisor_status_bar_init(&shared_module_supervisor_status_bar_obj);
 }
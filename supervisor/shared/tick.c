@@ -33,6 +33,8 @@
 #include "supervisor/filesystem.h"
 #include "supervisor/background_callback.h"
 #include "supervisor/port.h"
+#include "supervisor/shared/cpu_governor.h"
+#include "supervisor/shared/profiler.h"
 #include "supervisor/shared/stack.h"
 
 #if CIRCUITPY_BLEIO_HCI
@@ -81,6 +83,8 @@ static void supervisor_background_tick(void *unused) {
 
     port_background_tick();
 
+    supervisor_cpu_governor_background();
+
     assert_heap_ok();
 
     last_finished_tick = port_get_raw_ticks(NULL);
@@ -102,6 +106,8 @@ void supervisor_tick(void) {
     keypad_tick();
     #endif
 
+    supervisor_profiler_sample();
+
     background_callback_add(&tick_callback, supervisor_background_tick, NULL);
 }
 
@@ -135,7 +141,7 @@ void mp_hal_delay_ms(mp_uint_t delay_ms) {
         }
         port_interrupt_after_ticks(remaining);
         // Idle until an interrupt happens.
-        port_idle_until_interrupt();
+        supervisor_cpu_governor_idle_until_interrupt();
         remaining = end_tick - port_get_raw_ticks(NULL);
     }
 }
@@ -39,6 +39,10 @@
 #include "py/mpprint.h"
 #include "supervisor/serial.h"
 
+#ifndef CIRCUITPY_TRANSLATE_CACHE
+#define CIRCUITPY_TRANSLATE_CACHE (0)
+#endif
+
 void serial_write_compressed(mp_rom_error_text_t compressed) {
     mp_printf(MP_PYTHON_PRINTER, "%S", compressed);
 }
@@ -143,11 +147,46 @@ static void decompress_vstr(mp_rom_error_text_t compressed, vstr_t *decompressed
 }
 
 
+#if CIRCUITPY_TRANSLATE_CACHE
+// The last few strings decompressed, so that a message produced over and over, such as
+// an error raised in a retry loop, is copied instead of decoded again. Strings longer
+// than an entry aren't cached.
+#define TRANSLATE_CACHE_ENTRY_LEN (64)
+
+typedef struct {
+    mp_rom_error_text_t compressed;
+    char decompressed[TRANSLATE_CACHE_ENTRY_LEN];
+} translate_cache_entry_t;
+
+static translate_cache_entry_t translate_cache[CIRCUITPY_TRANSLATE_CACHE];
+static uint8_t translate_cache_next;
+#endif
+
 char *decompress(mp_rom_error_text_t compressed, char *decompressed) {
+    size_t length = decompress_length(compressed);
+    #if CIRCUITPY_TRANSLATE_CACHE
+    if (length <= TRANSLATE_CACHE_ENTRY_LEN) {
+        for (size_t i = 0; i < CIRCUITPY_TRANSLATE_CACHE; i++) {
+            if (translate_cache[i].compressed == compressed) {
+                memcpy(decompressed, translate_cache[i].decompressed, length);
+                return decompressed;
+            }
+        }
+    }
+    #endif
     vstr_t vstr;
-    vstr_init_fixed_buf(&vstr, decompress_length(compressed), decompressed);
+    vstr_init_fixed_buf(&vstr, length, decompressed);
     decompress_vstr(compressed, &vstr);
-    return vstr_null_terminated_str(&vstr);
+    char *result = vstr_null_terminated_str(&vstr);
+    #if CIRCUITPY_TRANSLATE_CACHE
+    if (length <= TRANSLATE_CACHE_ENTRY_LEN) {
+        translate_cache_entry_t *entry = &translate_cache[translate_cache_next];
+        memcpy(entry->decompressed, result, length);
+        entry->compressed = compressed;
+        translate_cache_next = (translate_cache_next + 1) % CIRCUITPY_TRANSLATE_CACHE;
+    }
+    #endif
+    return result;
 }
 
 #if CIRCUITPY_TRANSLATE_OBJECT == 1
@@ -40,9 +40,33 @@
 
 #define MSC_FLASH_BLOCK_SIZE    512
 
+// Number of blocks in the MSC block cache, a 4kB erase sector by default. TinyUSB hands
+// READ10 and WRITE10 data over one endpoint buffer at a time. The cache turns sequential
+// reads into one multi-block read per window, and collects contiguous writes until a
+// window-aligned run is complete so that supervisor_flash sees whole sectors at once.
+#ifndef CIRCUITPY_USB_MSC_CACHE_BLOCKS
+#define CIRCUITPY_USB_MSC_CACHE_BLOCKS (CIRCUITPY_FULL_BUILD ? 8 : 0)
+#endif
+
 static bool ejected[1] = {true};
 static bool locked[1] = {false};
 
+#if CIRCUITPY_USB_MSC_CACHE_BLOCKS > 0
+typedef enum {
+    MSC_CACHE_EMPTY,
+    MSC_CACHE_READ,
+    MSC_CACHE_WRITE,
+} msc_cache_state_t;
+
+static uint8_t msc_cache[CIRCUITPY_USB_MSC_CACHE_BLOCKS * MSC_FLASH_BLOCK_SIZE];
+static msc_cache_state_t msc_cache_state = MSC_CACHE_EMPTY;
+static uint8_t msc_cache_lun;
+static uint32_t msc_cache_lba;
+static uint32_t msc_cache_count;
+// The block after the last one read, used to detect sequential access.
+static uint32_t msc_next_read_lba;
+#endif
+
 // The root FS is always at the end of the list.
 static fs_user_mount_t *get_vfs(int lun) {
     // TODO(tannewt): Return the mount which matches the lun where 0 is the end
@@ -60,6 +84,101 @@ static fs_user_mount_t *get_vfs(int lun) {
     return current_mount->obj;
 }
 
+#if CIRCUITPY_USB_MSC_CACHE_BLOCKS > 0
+// Write out any coalesced blocks and forget cached reads.
+STATIC void msc_cache_flush(void) {
+    if (msc_cache_state == MSC_CACHE_WRITE) {
+        fs_user_mount_t *vfs = get_vfs(msc_cache_lun);
+        if (vfs != NULL) {
+            disk_write(vfs, msc_cache, msc_cache_lba, msc_cache_count);
+        }
+    }
+    msc_cache_state = MSC_CACHE_EMPTY;
+    msc_next_read_lba = 0;
+}
+
+STATIC uint32_t msc_cache_window_end(uint32_t lba) {
+    return (lba / CIRCUITPY_USB_MSC_CACHE_BLOCKS + 1) * CIRCUITPY_USB_MSC_CACHE_BLOCKS;
+}
+
+STATIC void msc_cache_read(uint8_t lun, fs_user_mount_t *vfs, uint8_t *buffer, uint32_t lba, uint32_t block_count, uint32_t disk_block_count) {
+    if (msc_cache_state == MSC_CACHE_WRITE) {
+        msc_cache_flush();
+    }
+    // Only read ahead while the host owns the drive. Otherwise the VM may
+    // write between callbacks and the cache would go stale.
+    bool sequential = locked[lun] && lba == msc_next_read_lba;
+    msc_next_read_lba = lba + block_count;
+    while (block_count > 0) {
+        if (msc_cache_state == MSC_CACHE_READ && msc_cache_lun == lun &&
+            lba >= msc_cache_lba && lba < msc_cache_lba + msc_cache_count) {
+            uint32_t n = MIN(block_count, msc_cache_lba + msc_cache_count - lba);
+            memcpy(buffer, msc_cache + (lba - msc_cache_lba) * MSC_FLASH_BLOCK_SIZE, n * MSC_FLASH_BLOCK_SIZE);
+            buffer += n * MSC_FLASH_BLOCK_SIZE;
+            lba += n;
+            block_count -= n;
+        } else if (sequential && block_count < CIRCUITPY_USB_MSC_CACHE_BLOCKS) {
+            // Fetch the rest of this window along with the requested blocks.
+            msc_cache_state = MSC_CACHE_EMPTY;
+            uint32_t count = MIN(msc_cache_window_end(lba), disk_block_count) - lba;
+            count = MAX(count, block_count);
+            if (disk_read(vfs, msc_cache, lba, count) != RES_OK) {
+                disk_read(vfs, buffer, lba, block_count);
+                return;
+            }
+            msc_cache_state = MSC_CACHE_READ;
+            msc_cache_lun = lun;
+            msc_cache_lba = lba;
+            msc_cache_count = count;
+        } else {
+            disk_read(vfs, buffer, lba, block_count);
+            return;
+        }
+    }
+}
+
+STATIC void msc_cache_write(uint8_t lun, fs_user_mount_t *vfs, const uint8_t *buffer, uint32_t lba, uint32_t block_count) {
+    if (msc_cache_state == MSC_CACHE_READ) {
+        msc_cache_flush();
+    }
+    while (block_count > 0) {
+        if (msc_cache_state == MSC_CACHE_WRITE &&
+            (msc_cache_lun != lun || lba != msc_cache_lba + msc_cache_count)) {
+            // Not contiguous with the pending run.
+            msc_cache_flush();
+        }
+        uint32_t window_end = msc_cache_window_end(lba);
+        if (msc_cache_state == MSC_CACHE_EMPTY && lba + block_count >= window_end) {
+            // The data covers the rest of this window, so write it straight through.
+            uint32_t n = block_count;
+            if (lba % CIRCUITPY_USB_MSC_CACHE_BLOCKS != 0) {
+                n = window_end - lba;
+            }
+            disk_write(vfs, buffer, lba, n);
+            buffer += n * MSC_FLASH_BLOCK_SIZE;
+            lba += n;
+            block_count -= n;
+            continue;
+        }
+        if (msc_cache_state == MSC_CACHE_EMPTY) {
+            msc_cache_state = MSC_CACHE_WRITE;
+            msc_cache_lun = lun;
+            msc_cache_lba = lba;
+            msc_cache_count = 0;
+        }
+        uint32_t n = MIN(block_count, window_end - lba);
+        memcpy(msc_cache + msc_cache_count * MSC_FLASH_BLOCK_SIZE, buffer, n * MSC_FLASH_BLOCK_SIZE);
+        msc_cache_count += n;
+        buffer += n * MSC_FLASH_BLOCK_SIZE;
+        lba += n;
+        block_count -= n;
+        if (lba == window_end) {
+            msc_cache_flush();
+        }
+    }
+}
+#endif
+
 STATIC void _usb_msc_uneject(void) {
     for (uint8_t i = 0; i < sizeof(ejected); i++) {
         ejected[i] = false;
@@ -72,6 +191,9 @@ void usb_msc_mount(void) {
 }
 
 void usb_msc_umount(void) {
+    #if CIRCUITPY_USB_MSC_CACHE_BLOCKS > 0
+    msc_cache_flush();
+    #endif
     for (uint8_t i = 0; i < sizeof(ejected); i++) {
         fs_user_mount_t *vfs = get_vfs(i + 1);
         if (vfs == NULL) {
@@ -166,7 +288,11 @@ int32_t tud_msc_read10_cb(uint8_t lun, uint32_t lba, uint32_t offset, void *buff
         return -1;
     }
 
+    #if CIRCUITPY_USB_MSC_CACHE_BLOCKS > 0
+    msc_cache_read(lun, vfs, buffer, lba, block_count, disk_block_count);
+    #else
     disk_read(vfs, buffer, lba, block_count);
+    #endif
 
     return block_count * MSC_FLASH_BLOCK_SIZE;
 }
@@ -181,7 +307,13 @@ int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t *
     const uint32_t block_count = bufsize / MSC_FLASH_BLOCK_SIZE;
 
     fs_user_mount_t *vfs = get_vfs(lun);
+    #if CIRCUITPY_USB_MSC_CACHE_BLOCKS > 0
+    msc_cache_write(lun, vfs, buffer, lba, block_count);
+    #else
     disk_write(vfs, buffer, lba, block_count);
+    #endif
+    // The host may have changed any directory, so drop cached path lookups.
+    vfs->fatfs.dir_changes++;
     // Since by getting here we assume the mount is read-only to
     // MicroPython let's update the cached FatFs sector if it's the one
     // we just wrote.
@@ -206,6 +338,11 @@ int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t *
 void tud_msc_write10_complete_cb(uint8_t lun) {
     (void)lun;
 
+    #if CIRCUITPY_USB_MSC_CACHE_BLOCKS > 0
+    // Don't hold a partial window past the end of the command.
+    msc_cache_flush();
+    #endif
+
     // This write is complete; initiate an autoreload.
     autoreload_resume(AUTORELOAD_SUSPEND_USB);
     autoreload_trigger();
@@ -252,6 +389,9 @@ bool tud_msc_start_stop_cb(uint8_t lun, uint8_t power_condition, bool start, boo
     if (current_mount == NULL) {
         return false;
     }
+    #if CIRCUITPY_USB_MSC_CACHE_BLOCKS > 0
+    msc_cache_flush();
+    #endif
     if (load_eject) {
         if (!start) {
             // Eject but first flush.
@@ -28,6 +28,7 @@
 #define _GNU_SOURCE
 
 #include <stdarg.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "extmod/vfs.h"
@@ -40,9 +41,11 @@
 #include "shared-bindings/wifi/Radio.h"
 #include "shared-module/storage/__init__.h"
 #include "shared/timeutils/timeutils.h"
+#include "supervisor/background_callback.h"
 #include "supervisor/fatfs.h"
 #include "supervisor/filesystem.h"
 #include "supervisor/port.h"
+#include "supervisor/shared/profiler.h"
 #include "supervisor/shared/reload.h"
 #include "supervisor/shared/translate/translate.h"
 #include "supervisor/shared/web_workflow/web_workflow.h"
@@ -76,6 +79,20 @@
 #include "shared-module/os/__init__.h"
 #endif
 
+// Files are streamed to and from the client through this many bytes at a time.
+// Keep it a multiple of the FAT sector size so that f_read and f_write copy whole
+// sectors straight to and from the buffer instead of through the file system window.
+#ifndef CIRCUITPY_WEB_WORKFLOW_FILE_BUFFER_SIZE
+#define CIRCUITPY_WEB_WORKFLOW_FILE_BUFFER_SIZE (2048)
+#endif
+
+// Number of client connections served at once. Connections are kept open
+// between requests, so browsers can fetch a page and its resources over
+// several sockets without waiting for each other.
+#ifndef CIRCUITPY_WEB_WORKFLOW_CLIENTS
+#define CIRCUITPY_WEB_WORKFLOW_CLIENTS (2)
+#endif
+
 enum request_state {
     STATE_METHOD,
     STATE_PATH,
@@ -105,9 +122,15 @@ typedef struct {
     bool json;
     bool websocket;
     bool new_socket;
+    bool keep_alive;
     uint32_t websocket_version;
     // RFC6455 for websockets says this header should be 24 base64 characters long.
     char websocket_key[24 + 1];
+    // Conditional and range headers for file GETs, as sent.
+    char if_none_match[32];
+    char if_modified_since[32];
+    char if_range[32];
+    char range[32];
 } _request;
 
 static wifi_radio_error_t _wifi_status = WIFI_RADIO_ERROR_NONE;
@@ -127,13 +150,20 @@ static mp_int_t web_api_port = 80;
 
 static socketpool_socketpool_obj_t pool;
 static socketpool_socket_obj_t listening;
-static socketpool_socket_obj_t active;
+static socketpool_socket_obj_t active[CIRCUITPY_WEB_WORKFLOW_CLIENTS];
+// Accepted connections land here until they are given a slot in active.
+static socketpool_socket_obj_t incoming;
+// Client that the next background pass starts with.
+static size_t next_client;
 
-static _request active_request;
+static _request active_request[CIRCUITPY_WEB_WORKFLOW_CLIENTS];
 
 static char _api_password[64];
 static char web_instance_name[50];
 
+// Too large for the stack of the task that runs the web workflow.
+static uint8_t _file_buffer[CIRCUITPY_WEB_WORKFLOW_FILE_BUFFER_SIZE];
+
 // Store the encoded IP so we don't duplicate work.
 static uint32_t _encoded_ip = 0;
 static char _our_ip_encoded[4 * 4];
@@ -293,9 +323,12 @@ bool supervisor_start_web_workflow(void) {
     // network. If we are connected to a different network, then it will disconnect before
     // attempting to connect to the given network.
 
+    mp_int_t fast_connect = 0;
+    (void)common_hal_os_getenv_int("CIRCUITPY_WIFI_FAST_CONNECT", &fast_connect);
+
     _wifi_status = common_hal_wifi_radio_connect(
         &common_hal_wifi_radio_obj, (uint8_t *)ssid, strlen(ssid), (uint8_t *)password, strlen(password),
-        0, 8, NULL, 0);
+        0, 8, NULL, 0, fast_connect != 0);
 
     if (_wifi_status != WIFI_RADIO_ERROR_NONE) {
         common_hal_wifi_radio_set_enabled(&common_hal_wifi_radio_obj, false);
@@ -336,7 +369,10 @@ bool supervisor_start_web_workflow(void) {
         common_hal_socketpool_socketpool_construct(&pool, &common_hal_wifi_radio_obj);
 
         socketpool_socket_reset(&listening);
-        socketpool_socket_reset(&active);
+        for (size_t i = 0; i < CIRCUITPY_WEB_WORKFLOW_CLIENTS; i++) {
+            socketpool_socket_reset(&active[i]);
+        }
+        socketpool_socket_reset(&incoming);
 
         websocket_init();
     }
@@ -344,8 +380,10 @@ bool supervisor_start_web_workflow(void) {
     initialized = pool.base.type == &socketpool_socketpool_type;
 
     if (initialized) {
-        if (!common_hal_socketpool_socket_get_closed(&active)) {
-            common_hal_socketpool_socket_close(&active);
+        for (size_t i = 0; i < CIRCUITPY_WEB_WORKFLOW_CLIENTS; i++) {
+            if (!common_hal_socketpool_socket_get_closed(&active[i])) {
+                common_hal_socketpool_socket_close(&active[i]);
+            }
         }
 
         #if CIRCUITPY_MDNS
@@ -614,6 +652,25 @@ static void _reply_precondition_failed(socketpool_socket_obj_t *socket, _request
     _send_final_str(socket, "\r\n");
 }
 
+static void _reply_not_modified(socketpool_socket_obj_t *socket, _request *request, const char *etag, const char *last_modified) {
+    _send_strs(socket,
+        "HTTP/1.1 304 Not Modified\r\n",
+        "ETag: ", etag, "\r\n",
+        "Last-Modified: ", last_modified, "\r\n", NULL);
+    _cors_header(socket, request);
+    _send_final_str(socket, "\r\n");
+}
+
+static void _reply_range_not_satisfiable(socketpool_socket_obj_t *socket, _request *request, uint32_t length) {
+    _send_strs(socket,
+        "HTTP/1.1 416 Range Not Satisfiable\r\n",
+        "Content-Length: 0\r\n", NULL);
+    mp_print_t _socket_print = {socket, _print_raw};
+    mp_printf(&_socket_print, "Content-Range: bytes */%u\r\n", length);
+    _cors_header(socket, request);
+    _send_final_str(socket, "\r\n");
+}
+
 static void _reply_payload_too_large(socketpool_socket_obj_t *socket, _request *request) {
     _send_strs(socket,
         "HTTP/1.1 413 Payload Too Large\r\n",
@@ -652,6 +709,7 @@ static void _reply_redirect(socketpool_socket_obj_t *socket, _request *request,
     int nodelay = 1;
     common_hal_socketpool_socket_setsockopt(socket, SOCKETPOOL_IPPROTO_TCP, SOCKETPOOL_TCP_NODELAY, &nodelay, sizeof(nodelay));
     const char *hostname = common_hal_mdns_server_get_hostname(&mdns);
+    request->keep_alive = false;
     _send_strs(socket,
         "HTTP/1.1 307 Temporary Redirect\r\n",
         "Connection: close\r\n",
@@ -674,10 +732,43 @@ static void _reply_redirect(socketpool_socket_obj_t *socket, _request *request,
 }
 #endif
 
-static void _reply_directory_json(socketpool_socket_obj_t *socket, _request *request, fs_user_mount_t *fs_mount, FF_DIR *dir, const char *request_path, const char *path) {
+// Collects small prints into chunks of up to _file_buffer's size so that long
+// listings don't go out a few bytes per chunk.
+typedef struct {
+    socketpool_socket_obj_t *socket;
+    size_t len;
+} _chunk_buffer_t;
+
+STATIC void _flush_chunk_buffer(_chunk_buffer_t *chunk) {
+    if (chunk->len > 0) {
+        _print_chunk(chunk->socket, (const char *)_file_buffer, chunk->len);
+        chunk->len = 0;
+    }
+}
+
+STATIC void _print_chunk_buffer(void *env, const char *str, size_t len) {
+    _chunk_buffer_t *chunk = env;
+    while (len > 0) {
+        if (chunk->len == sizeof(_file_buffer)) {
+            _flush_chunk_buffer(chunk);
+        }
+        size_t copy_len = MIN(len, sizeof(_file_buffer) - chunk->len);
+        memcpy(_file_buffer + chunk->len, str, copy_len);
+        chunk->len += copy_len;
+        str += copy_len;
+        len -= copy_len;
+    }
+}
+
+// Lists at most limit entries of dir, starting after the first offset of them.
+static void _reply_directory_json(socketpool_socket_obj_t *socket, _request *request, fs_user_mount_t *fs_mount, FF_DIR *dir, const char *request_path, const char *path, size_t offset, size_t limit) {
     FILINFO file_info;
     char *fn = file_info.fname;
     FRESULT res = f_readdir(dir, &file_info);
+    while (res == FR_OK && fn[0] != 0 && offset > 0) {
+        res = f_readdir(dir, &file_info);
+        offset--;
+    }
     if (res != FR_OK) {
         _reply_missing(socket, request);
         return;
@@ -686,7 +777,8 @@ static void _reply_directory_json(socketpool_socket_obj_t *socket, _request *req
     socketpool_socket_send(socket, (const uint8_t *)OK_JSON, strlen(OK_JSON));
     _cors_header(socket, request);
     _send_str(socket, "\r\n");
-    mp_print_t _socket_print = {socket, _print_chunk};
+    _chunk_buffer_t chunk = {socket, 0};
+    mp_print_t _socket_print = {&chunk, _print_chunk_buffer};
 
     // Send mount info.
     DWORD free_clusters = 0;
@@ -716,54 +808,145 @@ static void _reply_directory_json(socketpool_socket_obj_t *socket, _request *req
         "\"writable\": %s, ", free_clusters, total_clusters, cluster_size, writable);
 
     // Send file list
-    _send_chunk(socket, "\"files\": [");
+    mp_print_str(&_socket_print, "\"files\": [");
     bool first = true;
 
-    while (res == FR_OK && fn[0] != 0) {
+    while (res == FR_OK && fn[0] != 0 && limit > 0) {
         if (!first) {
-            _send_chunk(socket, ",");
-        }
-        _send_chunks(socket,
-            "{\"name\": \"", file_info.fname, "\",",
-            "\"directory\": ", NULL);
-        if ((file_info.fattrib & AM_DIR) != 0) {
-            _send_chunk(socket, "true");
-        } else {
-            _send_chunk(socket, "false");
+            mp_print_str(&_socket_print, ",");
         }
         // We use nanoseconds past Jan 1, 1970 for consistency with BLE API and
         // LittleFS.
-        _send_chunk(socket, ", ");
-
         uint32_t truncated_time = timeutils_mktime(1980 + (file_info.fdate >> 9),
             (file_info.fdate >> 5) & 0xf,
             file_info.fdate & 0x1f,
             file_info.ftime >> 11,
             (file_info.ftime >> 5) & 0x3f,
             (file_info.ftime & 0x1f) * 2);
-
-        // Manually append zeros to make the time nanoseconds. Support for printing 64 bit numbers
-        // varies across chipsets.
-        mp_printf(&_socket_print, "\"modified_ns\": %lu000000000, ", truncated_time);
         size_t file_size = 0;
         if ((file_info.fattrib & AM_DIR) == 0) {
             file_size = file_info.fsize;
         }
-        mp_printf(&_socket_print, "\"file_size\": %d }", file_size);
+
+        // Manually append zeros to make the time nanoseconds. Support for printing 64 bit numbers
+        // varies across chipsets.
+        mp_printf(&_socket_print,
+            "{\"name\": \"%s\",\"directory\": %s, \"modified_ns\": %lu000000000, \"file_size\": %d }",
+            file_info.fname, (file_info.fattrib & AM_DIR) != 0 ? "true" : "false", truncated_time, file_size);
 
         first = false;
+        limit--;
         res = f_readdir(dir, &file_info);
     }
-    _send_chunk(socket, "]}");
+    mp_print_str(&_socket_print, "]}");
+    _flush_chunk_buffer(&chunk);
     _send_chunk(socket, "");
 }
 
-static void _reply_with_file(socketpool_socket_obj_t *socket, _request *request, const char *filename, FIL *active_file) {
-    uint32_t total_length = f_size(active_file);
+// Reads a single "bytes=" range into start and end (exclusive) and sets partial.
+// Returns false when the range is outside the file. Anything else that isn't
+// understood selects the whole file, which is always a valid reply.
+static bool _parse_range(const char *range, uint32_t length, uint32_t *start, uint32_t *end, bool *partial) {
+    *start = 0;
+    *end = length;
+    *partial = false;
+    const char *prefix = "bytes=";
+    if (strncmp(range, prefix, strlen(prefix)) != 0 || strchr(range, ',') != NULL) {
+        return true;
+    }
+    const char *first = range + strlen(prefix);
+    if (first[0] == '-') {
+        // The last suffix bytes.
+        uint32_t suffix = strtoul(first + 1, NULL, 10);
+        if (suffix == 0 || length == 0) {
+            return false;
+        }
+        *start = length > suffix ? length - suffix : 0;
+        *partial = true;
+        return true;
+    }
+    char *dash;
+    uint32_t value = strtoul(first, &dash, 10);
+    if (dash == first || dash[0] != '-') {
+        return true;
+    }
+    if (dash[1] != '\0') {
+        uint32_t last = strtoul(dash + 1, NULL, 10);
+        if (last < value) {
+            return true;
+        }
+        if (last < length) {
+            *end = last + 1;
+        }
+    }
+    if (value >= length) {
+        return false;
+    }
+    *start = value;
+    *partial = true;
+    return true;
+}
+
+static void _reply_with_file(socketpool_socket_obj_t *socket, _request *request, const char *filename, FIL *active_file, const FILINFO *file_info) {
+    uint32_t file_length = f_size(active_file);
+
+    // Validators for conditional requests. FAT times have no time zone so they are
+    // treated as UTC like modified_ns in directory listings.
+    char etag[24];
+    snprintf(etag, sizeof(etag), "\"%04x%04x-%" PRIx32 "\"", file_info->fdate, file_info->ftime, file_length);
+    static const char *const days[] = { "Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun" };
+    static const char *const months[] = { "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+    int year = 1980 + (file_info->fdate >> 9);
+    int month = MAX(1, MIN(12, (file_info->fdate >> 5) & 0xf));
+    int day = file_info->fdate & 0x1f;
+    char last_modified[30];
+    snprintf(last_modified, sizeof(last_modified), "%s, %02d %s %04d %02d:%02d:%02d GMT",
+        days[timeutils_calc_weekday(year, month, day)], day, months[month - 1], year,
+        file_info->ftime >> 11, (file_info->ftime >> 5) & 0x3f, (file_info->ftime & 0x1f) * 2);
+
+    // If-None-Match wins over If-Modified-Since when both are sent.
+    bool not_modified;
+    if (request->if_none_match[0] != '\0') {
+        not_modified = strcmp(request->if_none_match, "*") == 0 || strstr(request->if_none_match, etag) != NULL;
+    } else {
+        not_modified = strcmp(request->if_modified_since, last_modified) == 0;
+    }
+    if (not_modified) {
+        _reply_not_modified(socket, request, etag, last_modified);
+        return;
+    }
+
+    uint32_t start = 0;
+    uint32_t end = file_length;
+    bool partial = false;
+    // A range only applies to the version of the file named by If-Range.
+    if (request->range[0] != '\0' &&
+        (request->if_range[0] == '\0' ||
+         strcmp(request->if_range, etag) == 0 ||
+         strcmp(request->if_range, last_modified) == 0)) {
+        if (!_parse_range(request->range, file_length, &start, &end, &partial)) {
+            _reply_range_not_satisfiable(socket, request, file_length);
+            return;
+        }
+    }
+    if (start > 0 && f_lseek(active_file, start) != FR_OK) {
+        _reply_server_error(socket, request);
+        return;
+    }
+    uint32_t total_length = end - start;
 
-    _send_str(socket, "HTTP/1.1 200 OK\r\n");
     mp_print_t _socket_print = {socket, _print_raw};
+    if (partial) {
+        _send_str(socket, "HTTP/1.1 206 Partial Content\r\n");
+        mp_printf(&_socket_print, "Content-Range: bytes %u-%u/%u\r\n", start, end - 1, file_length);
+    } else {
+        _send_str(socket, "HTTP/1.1 200 OK\r\n");
+    }
     mp_printf(&_socket_print, "Content-Length: %d\r\n", total_length);
+    _send_strs(socket,
+        "Accept-Ranges: bytes\r\n",
+        "ETag: ", etag, "\r\n",
+        "Last-Modified: ", last_modified, "\r\n", NULL);
     // TODO: Make this a table to save space.
     if (_endswith(filename, ".txt") || _endswith(filename, ".py") || _endswith(filename, ".toml")) {
         _send_strs(socket, "Content-Type:", "text/plain", ";charset=UTF-8\r\n", NULL);
@@ -781,32 +964,43 @@ static void _reply_with_file(socketpool_socket_obj_t *socket, _request *request,
 
     uint32_t total_read = 0;
     int nodelay_ok = -1;
+    bool send_failed = false;
     while (total_read < total_length) {
-        uint8_t data_buffer[64];
         size_t quantity_read;
-        f_read(active_file, data_buffer, 64, &quantity_read);
+        // Reads start at sector boundaries because the buffer is a whole number of sectors.
+        // Only a range can start elsewhere.
+        FRESULT result = f_read(active_file, _file_buffer, MIN(sizeof(_file_buffer), total_length - total_read), &quantity_read);
+        if (result != FR_OK || quantity_read == 0) {
+            break;
+        }
         total_read += quantity_read;
-        // When getting near the end of the file, disable Nagle's combining algorithm so that
+        // Before sending the last chunk, disable Nagle's combining algorithm so that
         // data is sent immediately.
-        if (total_length - total_read < 64) {
+        if (total_read == total_length) {
             int nodelay = 1;
             // Returns 0 when it works.
             nodelay_ok = common_hal_socketpool_socket_setsockopt(socket, SOCKETPOOL_IPPROTO_TCP, SOCKETPOOL_TCP_NODELAY, &nodelay, sizeof(nodelay));
         }
         uint32_t send_offset = 0;
         while (send_offset < quantity_read) {
-            int sent = socketpool_socket_send(socket, data_buffer + send_offset, quantity_read - send_offset);
+            int sent = socketpool_socket_send(socket, _file_buffer + send_offset, quantity_read - send_offset);
             if (sent < 0) {
                 if (sent == -MP_EAGAIN) {
                     sent = 0;
+                    // The send buffers are full, so let the network stack drain them.
+                    port_yield();
                 } else {
                     break;
                 }
             }
             send_offset += sent;
         }
+        if (send_offset < quantity_read) {
+            send_failed = true;
+            break;
+        }
     }
-    if (total_read < total_length) {
+    if (total_read < total_length || send_failed) {
         socketpool_socket_close(socket);
     }
 
@@ -947,6 +1141,67 @@ static void _reply_with_diskinfo_json(socketpool_socket_obj_t *socket, _request
     _send_chunk(socket, "");
 }
 
+#if CIRCUITPY_SAMPLING_PROFILER
+static void _reply_with_profile_json(socketpool_socket_obj_t *socket, _request *request) {
+    _send_str(socket, OK_JSON);
+    _cors_header(socket, request);
+    _send_str(socket, "\r\n");
+    mp_print_t _socket_print = {socket, _print_chunk};
+
+    // Sampling the VM while this runs would overwrite the samples being sent.
+    supervisor_profiler_hold(true);
+    size_t count = supervisor_profiler_sample_count();
+    mp_printf(&_socket_print, "{\"running\": %s, \"total\": %u, \"samples\": [",
+        supervisor_profiler_running() ? "true" : "false", (unsigned int)supervisor_profiler_total());
+    for (size_t i = 0; i < count; i++) {
+        const supervisor_profiler_sample_t *sample = supervisor_profiler_get_sample(i);
+        mp_printf(&_socket_print, "%s[\"%q\", \"%q\", %u]", i > 0 ? ", " : "",
+            (qstr)sample->source_file, (qstr)sample->function, (unsigned int)sample->offset);
+    }
+    supervisor_profiler_hold(false);
+    _send_chunk(socket, "]}");
+
+    // Empty chunk signals the end of the response.
+    _send_chunk(socket, "");
+}
+#endif
+
+#if CIRCUITPY_BACKGROUND_TASK_STATS
+// mp_printf has no 64 bit format.
+static void _print_uint64(const mp_print_t *print, uint64_t value) {
+    char digits[21];
+    char *start = digits + sizeof(digits) - 1;
+    *start = '\0';
+    do {
+        *--start = '0' + value % 10;
+        value /= 10;
+    } while (value > 0);
+    mp_print_str(print, start);
+}
+
+static void _reply_with_background_json(socketpool_socket_obj_t *socket, _request *request) {
+    _send_str(socket, OK_JSON);
+    _cors_header(socket, request);
+    _send_str(socket, "\r\n");
+    mp_print_t _socket_print = {socket, _print_chunk};
+
+    mp_printf(&_socket_print, "{\"cycles_per_second\": %u, \"callbacks\": [",
+        (unsigned int)port_get_cycle_count_frequency());
+    size_t count = background_callback_stats_count();
+    for (size_t i = 0; i < count; i++) {
+        const background_callback_stats_t *stats = background_callback_get_stats(i);
+        mp_printf(&_socket_print, "%s[\"%s\", %u, ", i > 0 ? ", " : "",
+            stats->name != NULL ? stats->name : "?", (unsigned int)stats->calls);
+        _print_uint64(&_socket_print, stats->total_cycles);
+        mp_printf(&_socket_print, ", %u]", (unsigned int)stats->max_cycles);
+    }
+    _send_chunk(socket, "]}");
+
+    // Empty chunk signals the end of the response.
+    _send_chunk(socket, "");
+}
+#endif
+
 
 // FATFS has a two second timestamp resolution but the BLE API allows for nanosecond resolution.
 // This function truncates the time the time to a resolution storable by FATFS and fills in the
@@ -1050,20 +1305,31 @@ static void _write_file_and_reply(socketpool_socket_obj_t *socket, _request *req
     size_t total_read = 0;
     bool error = false;
     while (total_read < request->content_length && !error) {
-        uint8_t bytes[64];
-        size_t read_len = MIN(sizeof(bytes), request->content_length - total_read);
-        int len = socketpool_socket_recv_into(socket, bytes, read_len);
-        if (len < 0) {
-            if (len == -MP_EAGAIN) {
-                continue;
+        // Fill the whole buffer before writing so that flash is written a few sectors
+        // at a time instead of every time a little data arrives. The network stack
+        // keeps receiving into its own buffers while the write runs.
+        size_t buffer_len = MIN(sizeof(_file_buffer), request->content_length - total_read);
+        size_t buffered = 0;
+        while (buffered < buffer_len) {
+            int len = socketpool_socket_recv_into(socket, _file_buffer + buffered, buffer_len - buffered);
+            if (len < 0) {
+                if (len == -MP_EAGAIN) {
+                    // Nothing has arrived yet, so let the network stack run.
+                    port_yield();
+                    continue;
+                }
+                error = true;
+                break;
             }
-            error = true;
+            buffered += len;
+        }
+        total_read += buffered;
+        if (error) {
             break;
         }
-        total_read += len;
         UINT actual;
-        f_write(&active_file, bytes, len, &actual);
-        if (actual < (UINT)len) {
+        f_write(&active_file, _file_buffer, buffered, &actual);
+        if (actual < buffered) {
             error = true;
             break;
         }
@@ -1168,6 +1434,22 @@ static void _decode_percents(char *str) {
     }
 }
 
+// Returns the number given for key in a URL query string or default_value when
+// key isn't there.
+static size_t _query_value(const char *query, const char *key, size_t default_value) {
+    size_t key_len = strlen(key);
+    while (query != NULL) {
+        if (strncmp(query, key, key_len) == 0 && query[key_len] == '=') {
+            return strtoul(query + key_len + 1, NULL, 10);
+        }
+        query = strchr(query, '&');
+        if (query != NULL) {
+            query++;
+        }
+    }
+    return default_value;
+}
+
 static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
     if (request->redirect) {
         #if CIRCUITPY_MDNS
@@ -1194,7 +1476,13 @@ static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
         } else {
             // Decode any percent encoded bytes so that we're left with UTF-8.
             // We only do this on /fs/ paths and after redirect so that any
-            // path echoing we do stays encoded.
+            // path echoing we do stays encoded. The query goes first so that an
+            // encoded ? stays part of the path.
+            char *query = strchr(request->path, '?');
+            if (query != NULL) {
+                *query = '\0';
+                query++;
+            }
             _decode_percents(request->path);
 
             char *path = request->path + 3;
@@ -1304,7 +1592,8 @@ static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
                         return false;
                     }
                     if (request->json) {
-                        _reply_directory_json(socket, request, fs_mount, &dir, request->path, path);
+                        _reply_directory_json(socket, request, fs_mount, &dir, request->path, path,
+                            _query_value(query, "offset", 0), _query_value(query, "limit", SIZE_MAX));
                     } else if (pathlen == 1) {
                         _REPLY_STATIC(socket, request, directory_html);
                     } else {
@@ -1316,12 +1605,16 @@ static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
             } else { // Dealing with a file.
                 if (strcasecmp(request->method, "GET") == 0) {
                     FIL active_file;
-                    FRESULT result = f_open(fs, &active_file, path, FA_READ);
+                    FILINFO file_info;
+                    FRESULT result = f_stat(fs, path, &file_info);
+                    if (result == FR_OK) {
+                        result = f_open(fs, &active_file, path, FA_READ);
+                    }
 
                     if (result != FR_OK) {
                         _reply_missing(socket, request);
                     } else {
-                        _reply_with_file(socket, request, path, &active_file);
+                        _reply_with_file(socket, request, path, &active_file, &file_info);
                     }
 
                     f_close(&active_file);
@@ -1356,6 +1649,30 @@ static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
             _reply_with_version_json(socket, request);
         } else if (strcmp(path, "/diskinfo.json") == 0) {
             _reply_with_diskinfo_json(socket, request);
+        #if CIRCUITPY_SAMPLING_PROFILER
+        } else if (strcmp(path, "/profile.json") == 0) {
+            if (!request->authenticated) {
+                if (_api_password[0] != '\0') {
+                    _reply_unauthorized(socket, request);
+                } else {
+                    _reply_forbidden(socket, request);
+                }
+            } else {
+                _reply_with_profile_json(socket, request);
+            }
+        #endif
+        #if CIRCUITPY_BACKGROUND_TASK_STATS
+        } else if (strcmp(path, "/background.json") == 0) {
+            if (!request->authenticated) {
+                if (_api_password[0] != '\0') {
+                    _reply_unauthorized(socket, request);
+                } else {
+                    _reply_forbidden(socket, request);
+                }
+            } else {
+                _reply_with_background_json(socket, request);
+            }
+        #endif
         } else if (strcmp(path, "/serial/") == 0) {
             if (!request->authenticated) {
                 if (_api_password[0] != '\0') {
@@ -1414,6 +1731,30 @@ static void _reset_request(_request *request) {
     request->expect = false;
     request->json = false;
     request->websocket = false;
+    request->if_none_match[0] = '\0';
+    request->if_modified_since[0] = '\0';
+    request->if_range[0] = '\0';
+    request->range[0] = '\0';
+    // Persistent connections are the default in HTTP/1.1.
+    request->keep_alive = true;
+}
+
+// Values too long for dest are dropped rather than cut short, so that a partial
+// validator or range is never acted on.
+static void _copy_header_value(_request *request, char *dest, size_t size) {
+    if (strlen(request->header_value) < size) {
+        strcpy(dest, request->header_value);
+    }
+}
+
+// Autoreload stays suspended while any client is part way through a request.
+static void _resume_autoreload_if_idle(void) {
+    for (size_t i = 0; i < CIRCUITPY_WEB_WORKFLOW_CLIENTS; i++) {
+        if (active_request[i].in_progress) {
+            return;
+        }
+    }
+    autoreload_resume(AUTORELOAD_SUSPEND_WEB);
 }
 
 static void _process_request(socketpool_socket_obj_t *socket, _request *request) {
@@ -1428,8 +1769,12 @@ static void _process_request(socketpool_socket_obj_t *socket, _request *request)
             more = false;
             if (len == 0 || len == -MP_ENOTCONN) {
                 // Disconnect - clear 'in-progress'
+                bool was_in_progress = request->in_progress;
                 _reset_request(request);
                 common_hal_socketpool_socket_close(socket);
+                if (was_in_progress) {
+                    _resume_autoreload_if_idle();
+                }
             }
             break;
         }
@@ -1533,6 +1878,16 @@ static void _process_request(socketpool_socket_obj_t *socket, _request *request)
                         strcpy(request->websocket_key, request->header_value);
                     } else if (strcasecmp(request->header_key, "X-Destination") == 0) {
                         strcpy(request->destination, request->header_value);
+                    } else if (strcasecmp(request->header_key, "Connection") == 0) {
+                        request->keep_alive = strcasecmp(request->header_value, "close") != 0;
+                    } else if (strcasecmp(request->header_key, "If-None-Match") == 0) {
+                        _copy_header_value(request, request->if_none_match, sizeof(request->if_none_match));
+                    } else if (strcasecmp(request->header_key, "If-Modified-Since") == 0) {
+                        _copy_header_value(request, request->if_modified_since, sizeof(request->if_modified_since));
+                    } else if (strcasecmp(request->header_key, "If-Range") == 0) {
+                        _copy_header_value(request, request->if_range, sizeof(request->if_range));
+                    } else if (strcasecmp(request->header_key, "Range") == 0) {
+                        _copy_header_value(request, request->range, sizeof(request->range));
                     }
                 } else if (request->offset > sizeof(request->header_value) - 1) {
                     // Skip methods that are too long.
@@ -1560,9 +1915,16 @@ static void _process_request(socketpool_socket_obj_t *socket, _request *request)
         return;
     }
     bool reload = _reply(socket, request);
+    // Keep the connection for the next request only when this one was fully
+    // read and its reply framed. Any body left unread would be parsed as the
+    // next request, and the 501 reply has no Content-Length.
+    bool keep_alive = request->keep_alive && !error && !reload && !request->websocket &&
+        request->content_length == 0 && common_hal_socketpool_socket_get_connected(socket);
     _reset_request(request);
-    common_hal_socketpool_socket_close(socket);
-    autoreload_resume(AUTORELOAD_SUSPEND_WEB);
+    if (!keep_alive) {
+        common_hal_socketpool_socket_close(socket);
+    }
+    _resume_autoreload_if_idle();
     if (reload) {
         autoreload_trigger();
     }
@@ -1589,46 +1951,71 @@ static bool supervisor_filesystem_access_could_block(void) {
     return false;
 }
 
+// Accepts a waiting connection into a free client slot, or in place of a
+// kept-alive connection that is between requests. Returns true if a client
+// was accepted.
+static bool _accept_client(void) {
+    if (common_hal_socketpool_socket_get_closed(&listening)) {
+        return false;
+    }
+    size_t slot = CIRCUITPY_WEB_WORKFLOW_CLIENTS;
+    for (size_t i = 0; i < CIRCUITPY_WEB_WORKFLOW_CLIENTS && slot == CIRCUITPY_WEB_WORKFLOW_CLIENTS; i++) {
+        if (!common_hal_socketpool_socket_get_connected(&active[i])) {
+            slot = i;
+        }
+    }
+    for (size_t i = 0; i < CIRCUITPY_WEB_WORKFLOW_CLIENTS && slot == CIRCUITPY_WEB_WORKFLOW_CLIENTS; i++) {
+        // New sockets haven't started their first request yet, so don't evict them.
+        if (!active_request[i].in_progress && !active_request[i].new_socket) {
+            slot = i;
+        }
+    }
+    if (slot == CIRCUITPY_WEB_WORKFLOW_CLIENTS) {
+        // Every client is busy. Leave the connection waiting in the backlog.
+        return false;
+    }
+    uint32_t ip;
+    uint32_t port;
+    int newsoc = socketpool_socket_accept(&listening, (uint8_t *)&ip, &port, &incoming);
+    if (newsoc == -EBADF) {
+        common_hal_socketpool_socket_close(&listening);
+        return false;
+    }
+    if (newsoc <= 0) {
+        return false;
+    }
+    if (!common_hal_socketpool_socket_get_closed(&active[slot])) {
+        common_hal_socketpool_socket_close(&active[slot]);
+    }
+    socketpool_socket_move(&incoming, &active[slot]);
+    common_hal_socketpool_socket_settimeout(&active[slot], 0);
+    _reset_request(&active_request[slot]);
+    // Mark new sockets, otherwise we may evict one before it could start its request.
+    active_request[slot].new_socket = true;
+    return true;
+}
+
 void supervisor_web_workflow_background(void *data) {
     // If "/sd" is mounted AND shared with a display, access could block.
     // We don't have a good way to defer a filesystem action way down inside _process_request
     // when this happens, so just postpone if there's a chance of blocking. (#8980)
     while (!supervisor_filesystem_access_could_block()) {
-        // If we have a request in progress, continue working on it. Do this first
-        // so that we can accept another socket after finishing this request.
-        if (common_hal_socketpool_socket_get_connected(&active)) {
-            _process_request(&active, &active_request);
-            if (active_request.in_progress) {
-                break;
-            }
-        } else {
-            // Close the active socket if necessary
-            if (!common_hal_socketpool_socket_get_closed(&active)) {
-                common_hal_socketpool_socket_close(&active);
+        // Work on each client's request in turn, starting with a different client each
+        // pass so one busy connection can't starve the others. Do this first so that
+        // finished clients free up their slots for new connections.
+        for (size_t n = 0; n < CIRCUITPY_WEB_WORKFLOW_CLIENTS; n++) {
+            size_t i = (next_client + n) % CIRCUITPY_WEB_WORKFLOW_CLIENTS;
+            if (common_hal_socketpool_socket_get_connected(&active[i])) {
+                _process_request(&active[i], &active_request[i]);
+            } else if (!common_hal_socketpool_socket_get_closed(&active[i])) {
+                // Close the socket if necessary
+                common_hal_socketpool_socket_close(&active[i]);
             }
         }
-        // Otherwise, see if we have another socket to accept.
-        if ((!common_hal_socketpool_socket_get_connected(&active) ||
-             (!active_request.in_progress && !active_request.new_socket)) &&
-            !common_hal_socketpool_socket_get_closed(&listening)) {
-            uint32_t ip;
-            uint32_t port;
-            if (!common_hal_socketpool_socket_get_closed(&active)) {
-                common_hal_socketpool_socket_close(&active);
-            }
-            int newsoc = socketpool_socket_accept(&listening, (uint8_t *)&ip, &port, &active);
-            if (newsoc == -EBADF) {
-                common_hal_socketpool_socket_close(&listening);
-                break;
-            }
-            if (newsoc > 0) {
-                common_hal_socketpool_socket_settimeout(&active, 0);
-                _reset_request(&active_request);
-                // Mark new sockets, otherwise we may accept another before the first
-                // could start its request.
-                active_request.new_socket = true;
-                continue;
-            }
+        next_client = (next_client + 1) % CIRCUITPY_WEB_WORKFLOW_CLIENTS;
+
+        // Then see if we have another socket to accept.
+        if (!_accept_client()) {
             break;
         }
     }
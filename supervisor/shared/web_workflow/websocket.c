@@ -24,13 +24,17 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "supervisor/shared/web_workflow/websocket.h"
 
 #include "py/ringbuf.h"
 #include "py/runtime.h"
 #include "shared/runtime/interrupt_char.h"
 #include "shared-bindings/socketpool/SocketPool.h"
+#include "supervisor/shared/tick.h"
 #include "supervisor/shared/web_workflow/web_workflow.h"
+#include "supervisor/workflow.h"
 
 #if CIRCUITPY_STATUS_BAR
 #include "supervisor/shared/status_bar.h"
@@ -47,10 +51,24 @@ typedef struct {
     size_t payload_remaining;
 } _websocket;
 
+// Output is collected into a single frame and sent once the buffer fills or the
+// oldest byte has waited this long. REPL output is many tiny writes and sending
+// each one as its own frame costs a TCP segment per write.
+#ifndef CIRCUITPY_WEB_WORKFLOW_WEBSOCKET_FLUSH_MS
+#define CIRCUITPY_WEB_WORKFLOW_WEBSOCKET_FLUSH_MS (10)
+#endif
+#ifndef CIRCUITPY_WEB_WORKFLOW_WEBSOCKET_OUTGOING_SIZE
+#define CIRCUITPY_WEB_WORKFLOW_WEBSOCKET_OUTGOING_SIZE (256)
+#endif
+
 // Buffer the incoming serial data in the background so that we can look for the
 // interrupt character.
 STATIC ringbuf_t _incoming_ringbuf;
-STATIC uint8_t _buf[16];
+STATIC uint8_t _buf[64];
+// Four bytes of room in front of the payload for the frame header.
+STATIC uint8_t _outgoing[4 + CIRCUITPY_WEB_WORKFLOW_WEBSOCKET_OUTGOING_SIZE];
+STATIC size_t _outgoing_len;
+STATIC uint32_t _outgoing_start_ms;
 // make sure background is not called recursively
 STATIC bool in_web_background = false;
 
@@ -71,6 +89,7 @@ void websocket_handoff(socketpool_socket_obj_t *socket) {
     cp_serial.opcode = 0;
     cp_serial.frame_index = 0;
     cp_serial.frame_len = 2;
+    _outgoing_len = 0;
 
     #if CIRCUITPY_STATUS_BAR
     // Send the title bar for the new client.
@@ -161,23 +180,39 @@ static void _read_next_frame_header(void) {
     }
 }
 
-static bool _read_next_payload_byte(uint8_t *c) {
-    _read_next_frame_header();
-    if (cp_serial.opcode == 0x1 &&
-        cp_serial.frame_index >= cp_serial.frame_len &&
-        cp_serial.payload_remaining > 0) {
-        if (_read_byte(c)) {
+// Read as much of the current data frame as fits into buf and unmask it.
+static size_t _read_next_payload(uint8_t *buf, size_t len) {
+    while (true) {
+        _read_next_frame_header();
+        if (cp_serial.frame_index < cp_serial.frame_len ||
+            cp_serial.opcode == 0x8 ||
+            cp_serial.opcode == 0x9) {
+            return 0;
+        }
+        if (cp_serial.payload_remaining == 0) {
+            // Empty frame.
+            cp_serial.frame_index = 0;
+            continue;
+        }
+        int received = socketpool_socket_recv_into(&cp_serial.socket, buf, MIN(len, cp_serial.payload_remaining));
+        if (received < 1) {
+            return 0;
+        }
+        for (int i = 0; i < received; i++) {
             uint8_t mask_offset = (cp_serial.frame_index - cp_serial.frame_len) % 4;
-            *c ^= cp_serial.mask[mask_offset];
+            buf[i] ^= cp_serial.mask[mask_offset];
             cp_serial.frame_index++;
-            cp_serial.payload_remaining--;
-            if (cp_serial.payload_remaining == 0) {
-                cp_serial.frame_index = 0;
-            }
-            return true;
+        }
+        cp_serial.payload_remaining -= received;
+        if (cp_serial.payload_remaining == 0) {
+            cp_serial.frame_index = 0;
+        }
+        // Continuation, text and binary frames are all serial data. Drop the
+        // payload of anything else, such as unsolicited PONGs.
+        if (cp_serial.opcode <= 0x2) {
+            return received;
         }
     }
-    return false;
 }
 
 bool websocket_available(void) {
@@ -196,43 +231,92 @@ char websocket_read_char(void) {
     return -1;
 }
 
+// Fill in the frame header directly in front of the payload and return where the
+// frame starts. There must be at least four bytes of room before payload.
+static uint8_t *_websocket_frame_header(uint8_t *payload, size_t len, size_t *header_len) {
+    uint32_t opcode = 1;
+    uint8_t *frame_header;
+    if (len <= 125) {
+        frame_header = payload - 2;
+        frame_header[1] = len;
+    } else {
+        frame_header = payload - 4;
+        frame_header[1] = 126;
+        frame_header[2] = (len >> 8) & 0xff;
+        frame_header[3] = len & 0xff;
+    }
+    frame_header[0] = 1 << 7 | opcode;
+    *header_len = payload - frame_header;
+    return frame_header;
+}
+
+static void _websocket_flush(_websocket *ws) {
+    if (_outgoing_len == 0) {
+        return;
+    }
+    size_t len = _outgoing_len;
+    _outgoing_len = 0;
+    if (!websocket_connected()) {
+        return;
+    }
+    size_t header_len;
+    uint8_t *frame = _websocket_frame_header(_outgoing + 4, len, &header_len);
+    web_workflow_send_raw(&ws->socket, true, frame, header_len + len);
+}
+
 static void _websocket_send(_websocket *ws, const char *text, size_t len) {
     if (!websocket_connected()) {
         return;
     }
     uint32_t opcode = 1;
-    uint8_t frame_header[2];
+    uint8_t frame_header[10];
+    size_t header_len = 2;
     frame_header[0] = 1 << 7 | opcode;
-    uint8_t payload_len;
     if (len <= 125) {
-        payload_len = len;
+        frame_header[1] = len;
     } else if (len < (1 << 16)) {
-        payload_len = 126;
+        frame_header[1] = 126;
+        frame_header[2] = (len >> 8) & 0xff;
+        frame_header[3] = len & 0xff;
+        header_len = 4;
     } else {
-        payload_len = 127;
-    }
-    frame_header[1] = payload_len;
-    web_workflow_send_raw(&ws->socket, false, (const uint8_t *)frame_header, 2);
-    uint8_t extended_len[4];
-    if (payload_len == 126) {
-        extended_len[0] = (len >> 8) & 0xff;
-        extended_len[1] = len & 0xff;
-        web_workflow_send_raw(&ws->socket, false, extended_len, 2);
-    } else if (payload_len == 127) {
-        uint32_t zero = 0;
+        frame_header[1] = 127;
         // 64 bits where top four bytes are zero.
-        web_workflow_send_raw(&ws->socket, false, (const uint8_t *)&zero, 4);
-        extended_len[0] = (len >> 24) & 0xff;
-        extended_len[1] = (len >> 16) & 0xff;
-        extended_len[2] = (len >> 8) & 0xff;
-        extended_len[3] = len & 0xff;
-        web_workflow_send_raw(&ws->socket, false, extended_len, 4);
+        memset(frame_header + 2, 0, 4);
+        frame_header[6] = (len >> 24) & 0xff;
+        frame_header[7] = (len >> 16) & 0xff;
+        frame_header[8] = (len >> 8) & 0xff;
+        frame_header[9] = len & 0xff;
+        header_len = 10;
     }
-    web_workflow_send_raw(&ws->socket, false, (const uint8_t *)text, len);
+    web_workflow_send_raw(&ws->socket, false, frame_header, header_len);
+    web_workflow_send_raw(&ws->socket, true, (const uint8_t *)text, len);
 }
 
 void websocket_write(const char *text, size_t len) {
-    _websocket_send(&cp_serial, text, len);
+    if (!websocket_connected()) {
+        return;
+    }
+    // Large writes go out as their own frame after anything already buffered.
+    if (len > CIRCUITPY_WEB_WORKFLOW_WEBSOCKET_OUTGOING_SIZE) {
+        _websocket_flush(&cp_serial);
+        _websocket_send(&cp_serial, text, len);
+        return;
+    }
+    if (_outgoing_len + len > CIRCUITPY_WEB_WORKFLOW_WEBSOCKET_OUTGOING_SIZE) {
+        _websocket_flush(&cp_serial);
+    }
+    if (_outgoing_len == 0) {
+        _outgoing_start_ms = supervisor_ticks_ms32();
+    }
+    memcpy(_outgoing + 4 + _outgoing_len, text, len);
+    _outgoing_len += len;
+    if (supervisor_ticks_ms32() - _outgoing_start_ms >= CIRCUITPY_WEB_WORKFLOW_WEBSOCKET_FLUSH_MS) {
+        _websocket_flush(&cp_serial);
+    } else {
+        // Make sure the background runs to flush what is left.
+        supervisor_workflow_request_background();
+    }
 }
 
 void websocket_background(void) {
@@ -243,14 +327,24 @@ void websocket_background(void) {
         return;
     }
     in_web_background = true;
-    uint8_t c;
+    if (_outgoing_len > 0) {
+        if (supervisor_ticks_ms32() - _outgoing_start_ms >= CIRCUITPY_WEB_WORKFLOW_WEBSOCKET_FLUSH_MS) {
+            _websocket_flush(&cp_serial);
+        } else {
+            supervisor_workflow_request_background();
+        }
+    }
+    uint8_t data[sizeof(_buf)];
+    size_t len;
     while (ringbuf_num_empty(&_incoming_ringbuf) > 0 &&
-           _read_next_payload_byte(&c)) {
-        if (c == mp_interrupt_char) {
-            mp_sched_keyboard_interrupt();
-            continue;
+           (len = _read_next_payload(data, ringbuf_num_empty(&_incoming_ringbuf))) > 0) {
+        for (size_t i = 0; i < len; i++) {
+            if (data[i] == mp_interrupt_char) {
+                mp_sched_keyboard_interrupt();
+                continue;
+            }
+            ringbuf_put(&_incoming_ringbuf, data[i]);
         }
-        ringbuf_put(&_incoming_ringbuf, c);
     }
     in_web_background = false;
 }
@@ -33,6 +33,7 @@
 #include "supervisor/filesystem.h"
 #include "supervisor/workflow.h"
 #include "supervisor/serial.h"
+#include "supervisor/shared/boot_trace.h"
 #include "supervisor/shared/workflow.h"
 
 #if CIRCUITPY_BLEIO
@@ -96,6 +97,7 @@ void supervisor_workflow_start(void) {
     // Setup USB connection after heap is available.
     // It needs the heap to build descriptors.
     usb_init();
+    supervisor_boot_trace_mark("usb_init");
     #endif
 
     // Set up any other serial connection.
@@ -105,6 +107,7 @@ void supervisor_workflow_start(void) {
     bleio_reset();
     supervisor_bluetooth_enable_workflow();
     supervisor_start_bluetooth();
+    supervisor_boot_trace_mark("ble_workflow");
     #endif
 
     #if CIRCUITPY_WEB_WORKFLOW
@@ -113,6 +116,7 @@ void supervisor_workflow_start(void) {
         memset(&workflow_background_cb, 0, sizeof(workflow_background_cb));
         workflow_background_cb.fun = supervisor_web_workflow_background;
     }
+    supervisor_boot_trace_mark("web_workflow");
     #endif
 
     #if CIRCUITPY_USB_KEYBOARD_WORKFLOW
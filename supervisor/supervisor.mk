@@ -24,6 +24,14 @@ SRC_SUPERVISOR = \
 # For tlsf
 CFLAGS += -D_DEBUG=0
 
+ifeq ($(CIRCUITPY_ENABLE_MPY_NATIVE),1)
+SRC_SUPERVISOR += supervisor/shared/native_code.c
+endif
+
+ifeq ($(CIRCUITPY_WARM_RELOAD),1)
+SRC_SUPERVISOR += supervisor/shared/import_cache.c
+endif
+
 NO_USB ?= $(wildcard supervisor/usb.c)
 
 
@@ -103,6 +111,18 @@ ifneq ($(wildcard supervisor/serial.c),)
   SRC_SUPERVISOR += supervisor/serial.c
 endif
 
+ifeq ($(CIRCUITPY_BOOT_TRACE),1)
+  SRC_SUPERVISOR += supervisor/shared/boot_trace.c
+endif
+
+ifeq ($(CIRCUITPY_CPU_GOVERNOR),1)
+  SRC_SUPERVISOR += supervisor/shared/cpu_governor.c
+endif
+
+ifeq ($(CIRCUITPY_SAMPLING_PROFILER),1)
+  SRC_SUPERVISOR += supervisor/shared/profiler.c
+endif
+
 ifeq ($(CIRCUITPY_STATUS_BAR),1)
   SRC_SUPERVISOR += \
     supervisor/shared/status_bar.c \
@@ -162,6 +182,7 @@ ifeq ($(CIRCUITPY_USB),1)
     SRC_SUPERVISOR += \
       shared-bindings/usb_video/__init__.c \
       shared-module/usb_video/__init__.c \
+      shared-module/usb_video/mjpeg.c \
       shared-bindings/usb_video/USBFramebuffer.c \
       shared-module/usb_video/USBFramebuffer.c \
       lib/tinyusb/src/class/video/video_device.c \
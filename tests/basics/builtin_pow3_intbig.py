@@ -20,3 +20,11 @@ print(hex(pow(2, x-1, x))) # Should be 1, since x is prime
 print(hex(pow(y, x-1, x))) # Should be 1, since x is prime
 print(hex(pow(y, y-1, x))) # Should be a 'big value'
 print(hex(pow(y, y-1, y))) # Should be a 'big value'
+
+# odd and even moduli, negative base and modulus
+print(hex(pow(y, x, x * 2)))
+print(hex(pow(-y, x - 1, x)))
+print(hex(pow(y, x - 1, -x)))
+print(hex(pow(-y, y, -(x << 7))))
+print(pow(7, 0xffff, 1))
+print(pow(x, 5, x))
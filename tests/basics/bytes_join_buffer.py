@@ -0,0 +1,15 @@
+# bytes.join with other bytes-like items
+
+print(b",".join([b"abc", bytearray(b"def"), memoryview(b"ghijk")[1:4]]))
+print(bytearray(b"-").join([memoryview(bytearray(b"xyz")), b"1"]))
+print(b"".join(memoryview(b"abcdef")[i : i + 2] for i in range(0, 6, 2)))
+
+try:
+    b",".join([b"abc", "def"])
+except TypeError:
+    print("TypeError")
+
+try:
+    b",".join([b"abc", 1])
+except TypeError:
+    print("TypeError")
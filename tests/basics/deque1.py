@@ -63,3 +63,10 @@ try:
     ~d
 except TypeError:
     print("TypeError")
+
+# extend from an iterable, dropping the oldest items when full
+d = deque((), 3)
+d.extend([1, 2])
+d.extend(range(3, 6))
+d.extend(())
+print(len(d), d.popleft(), d.popleft(), d.popleft())
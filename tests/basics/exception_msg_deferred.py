@@ -0,0 +1,24 @@
+# messages of exceptions raised from C are decompressed when first used
+
+# message containing an escaped percent, read in different orders
+for i in range(3):
+    try:
+        "%c" % 1.5
+    except TypeError as e:
+        if i == 0:
+            print(e)
+            print(e.args)
+        elif i == 1:
+            print(e.args[0] == "%c requires int or char")
+            print(hash(e.args[0]) == hash("%c requires int or char"))
+        else:
+            print({e.args[0]: 1}.get("%c requires int or char"))
+
+# exceptions that are caught and dropped
+n = 0
+for i in range(100):
+    try:
+        "%c" % 1.5
+    except TypeError:
+        n += 1
+print(n)
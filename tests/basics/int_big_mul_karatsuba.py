@@ -0,0 +1,18 @@
+# test multiplication of ints long enough to use Karatsuba multiplication
+
+a = (1 << 4099) - 12345
+b = (1 << 4107) + 6789
+print(a * b)
+print((a * b) // a == b)
+print(a * a == a**2)
+
+# unbalanced operands are multiplied in pieces
+c = (3 << 10000) - 1
+print(c * a)
+print(a * c == c * a)
+
+# operands with runs of zero and all-ones digits
+d = (1 << 3000) | (1 << 1500) | 1
+e = (1 << 3000) - 1
+print(d * e)
+print(-d * e, d * -e, -d * -e)
@@ -0,0 +1,33 @@
+# test small-int binary ops whose result crosses the small-int boundary
+# (values come from variables so nothing is constant-folded)
+
+# the small-int width depends on the port, so cover a spread of widths
+for bits in (14, 15, 16, 29, 30, 31, 32, 46, 47, 62, 63, 64):
+    big = (1 << bits) - 1
+    one = 1
+    n = -big
+    print(bits, big + one, big - -one, n - one, n + -one)
+    print(bits, big << one, n << one, one << bits, (big >> 1) << 2)
+    print(bits, big >> bits, n >> bits, n >> 100, big >> 100)
+    print(bits, big & n, big | n, big ^ n, big < n, big == big + 0)
+
+# shift counts that must still raise
+a = 1
+b = -1
+try:
+    a << b
+except ValueError:
+    print("ValueError")
+try:
+    a >> b
+except ValueError:
+    print("ValueError")
+
+# in-place forms
+x = 1
+for i in range(70):
+    x <<= 1
+    x += 1
+print(x)
+x -= x
+print(x)
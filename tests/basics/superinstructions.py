@@ -0,0 +1,102 @@
+# test opcode sequences that the bytecode emitter may fuse into superinstructions
+
+
+# two local loads, a local load and a small int, and a subscript of locals
+def f(a, b, n):
+    t = 0
+    i = 0
+    while i < n:
+        t += a[i] * b + i * 15 - 16
+        i = i + 1
+    return t
+
+
+print(f([1, 2, 3, 4], 3, 4))
+print(f((5, 6), -1, 2))
+print(f([0.5, 1.5], 2, 2))
+
+
+# attribute loads from the first few locals, and from later ones
+class A:
+    def __init__(self, x):
+        self.x = x
+
+    def add(self, o, p, q):
+        return self.x + o.x + p.x + q.x
+
+
+print(A(1).add(A(2), A(3), A(4)))
+
+
+# comparisons that jump on true and on false, including inverted ones
+def g(a, b):
+    r = []
+    for i in range(6):
+        if i != 2:
+            r.append(i)
+        if not i < 3:
+            r.append(-i)
+        if i in b:
+            r.append(10 + i)
+        if i not in b:
+            r.append(20)
+        if a is not b:
+            r.append(30)
+    return r
+
+
+print(g(1, [1, 4]))
+
+
+# a comparison that raises
+def h(a, b):
+    if a < b:
+        return True
+    return False
+
+
+try:
+    h(1, "x")
+except TypeError:
+    print("TypeError")
+
+
+# unbound locals in each position of a fused sequence
+def u1():
+    x = 1
+    print(y + x)
+    y = 2
+
+
+def u2():
+    x = 1
+    print(x + y)
+    y = 2
+
+
+def u3():
+    print(x + 1)
+    x = 1
+
+
+def u4():
+    a = [1]
+    print(a[i])
+    i = 0
+
+
+for fun in (u1, u2, u3, u4):
+    try:
+        fun()
+    except NameError:
+        print("NameError")
+
+
+# a store followed by a load of the same local
+def s(x):
+    y = x
+    y = y + 1
+    return y
+
+
+print(s(41))
@@ -0,0 +1,133 @@
+# Test the C event loop in _asyncio against a minimal stand-in for asyncio.core.
+try:
+    import select
+    from _asyncio import Task, TaskQueue, run_until_complete
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class CancelledError(BaseException):
+    pass
+
+
+class IOQueue:
+    def __init__(self):
+        self.poller = select.poll()
+        self.map = {}
+
+    def queue_write(self, s):
+        self.map[id(s)] = [None, cur_task, s]
+        self.poller.register(s, select.POLLOUT)
+
+    def _dequeue(self, s):
+        del self.map[id(s)]
+        self.poller.unregister(s)
+
+
+class Loop:
+    @staticmethod
+    def call_exception_handler(context):
+        print("handler:", context["message"], repr(context["exception"]))
+
+
+cur_task = None
+_task_queue = TaskQueue()
+_io_queue = IOQueue()
+_exc_context = {"message": "Task exception wasn't retrieved", "exception": None, "future": None}
+
+
+def ticks():
+    t = Task(None)
+    TaskQueue().push(t)
+    return t.ph_key
+
+
+class sleep_ms:
+    def __init__(self, ms):
+        self.ms = ms
+
+    def __await__(self):
+        _task_queue.push(cur_task, (ticks() + self.ms) & ((1 << 29) - 1))
+        yield
+
+
+def create_task(coro):
+    t = Task(coro, globals())
+    _task_queue.push(t)
+    return t
+
+
+async def worker(name, n):
+    for i in range(n):
+        print(name, i)
+        await sleep_ms(0)
+    return name + " done"
+
+
+async def sleeper():
+    await sleep_ms(20)
+    print("sleeper woke")
+    return 7
+
+
+async def fail():
+    await sleep_ms(0)
+    raise ValueError("boom")
+
+
+async def main():
+    a = create_task(worker("a", 3))
+    b = create_task(worker("b", 2))
+    s = create_task(sleeper())
+    print(await a)
+    print(await b)
+    print(await s)
+    try:
+        await create_task(fail())
+    except ValueError as e:
+        print("caught", e)
+    create_task(fail())
+    await sleep_ms(10)
+    return "main done"
+
+
+print(run_until_complete(create_task(main())))
+print(cur_task)
+
+# Cancel a sleeping task.
+async def long_sleep():
+    try:
+        await sleep_ms(10000)
+    except CancelledError:
+        print("cancelled")
+        raise
+
+
+async def canceller():
+    t = create_task(long_sleep())
+    await sleep_ms(0)
+    t.cancel()
+    await sleep_ms(0)
+    print("done:", t.done())
+
+
+run_until_complete(create_task(canceller()))
+
+# Wait for I/O through the select.poll object; fd 1 is stdout.
+class wait_writable:
+    def __await__(self):
+        _io_queue.queue_write(1)
+        yield
+
+
+async def writer():
+    await wait_writable()
+    print("writable", _io_queue.map)
+
+
+run_until_complete(create_task(writer()))
+
+# With no main task the loop runs until every task has finished.
+create_task(worker("c", 2))
+print(run_until_complete())
@@ -0,0 +1,30 @@
+import array
+import audiocore
+
+
+def get(sample):
+    result, data = audiocore.get_buffer(sample)
+    return result, list(data)
+
+
+buf = array.array("h", [1, 2, 3, 4, 5, 6, 7])
+print(get(audiocore.RawSample(buf)))
+
+# the halves play alternately, straight from the buffer
+sample = audiocore.RawSample(buf, single_buffer=False)
+print(audiocore.get_structure(sample))
+for _ in range(3):
+    print(get(sample))
+buf[1] = -2
+buf[4] = -5
+print(get(sample))
+audiocore.reset_buffer(sample)
+print(get(sample))
+
+stereo = audiocore.RawSample(array.array("h", range(8)), channel_count=2, single_buffer=False)
+print(get(stereo), get(stereo))
+
+try:
+    audiocore.RawSample(array.array("h", [0]), single_buffer=False)
+except ValueError as e:
+    print("ValueError", e)
@@ -0,0 +1,29 @@
+import array
+import audiocore
+import audiofx
+
+impulse = array.array("h", [16384, 0, 0, 0])
+
+delay = audiofx.Delay(
+    max_delay_ms=10, delay_ms=3, feedback=0.5, mix=0.5, buffer_size=24, sample_rate=1000
+)
+delay.play(audiocore.RawSample(impulse, sample_rate=1000))
+print(list(audiocore.get_buffer(delay)[1]))
+print(delay.playing)
+# The echoes keep fading out after the input ends.
+print(list(audiocore.get_buffer(delay)[1]))
+
+try:
+    delay.delay_ms = 11
+except ValueError:
+    print("ValueError")
+print(delay.delay_ms, delay.feedback, delay.mix)
+
+# With mix=0 only the dry input is heard.
+ramp = array.array("h", [100, -200, 300, -400])
+for effect in (
+    audiofx.Chorus(mix=0, buffer_size=8, sample_rate=1000),
+    audiofx.Reverb(mix=0, buffer_size=8, sample_rate=1000),
+):
+    effect.play(audiocore.RawSample(ramp, sample_rate=1000), loop=True)
+    print(list(audiocore.get_buffer(effect)[1]))
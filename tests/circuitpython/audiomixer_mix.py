@@ -0,0 +1,13 @@
+import array
+import audiocore
+import audiomixer
+
+a = array.array("h", [1000, -1000, 32767, -32768, 3, -3, 0, 100])
+b = array.array("h", [1000, -1001, 32767, -32768, 7, -7, 42, -100])
+
+for levels in ((1.0, 1.0), (1.0, 0.5), (0.5, 0.25), (0.0, 1.0)):
+    mixer = audiomixer.Mixer(voice_count=2, buffer_size=32, channel_count=1, sample_rate=8000)
+    for voice, data, level in zip(mixer.voice, (a, b), levels):
+        voice.level = level
+        voice.play(audiocore.RawSample(data, sample_rate=8000), loop=True)
+    print(levels, list(audiocore.get_buffer(mixer)[1]))
@@ -0,0 +1,31 @@
+import array
+import audiocore
+import audiomixer
+
+ramp = array.array("h", [0, 1000, 2000, 3000])
+
+# A mono 1kHz sample on a stereo 2kHz mixer is upsampled and played on both channels.
+mixer = audiomixer.Mixer(voice_count=1, buffer_size=64, channel_count=2, sample_rate=2000)
+mixer.voice[0].play(audiocore.RawSample(ramp, sample_rate=1000))
+print(list(audiocore.get_buffer(mixer)[1]))
+print(mixer.playing)
+print(list(audiocore.get_buffer(mixer)[1]))
+print(mixer.playing)
+
+# A stereo sample on a mono mixer is averaged.
+stereo = array.array("h", [100, 300, -100, -300, 1000, 2000])
+mixer = audiomixer.Mixer(voice_count=1, buffer_size=16, channel_count=1, sample_rate=1000)
+mixer.play(audiocore.RawSample(stereo, channel_count=2, sample_rate=1000))
+print(list(audiocore.get_buffer(mixer)[1]))
+
+# The polyphase filter keeps a constant level constant once its history is full.
+level = array.array("h", [10000] * 16)
+mixer = audiomixer.Mixer(voice_count=1, buffer_size=64, channel_count=1, sample_rate=3000)
+mixer.voice[0].play(audiocore.RawSample(level, sample_rate=2000), loop=True, polyphase=True)
+audiocore.get_buffer(mixer)
+print(all(abs(s - 10000) < 10 for s in audiocore.get_buffer(mixer)[1]))
+
+try:
+    mixer.play(audiocore.RawSample(array.array("b", [0, 1]), sample_rate=3000))
+except ValueError as e:
+    print(e)
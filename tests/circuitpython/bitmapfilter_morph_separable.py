@@ -0,0 +1,98 @@
+from displayio import Bitmap
+import bitmapfilter
+
+
+def make_bitmap(value_count, seed):
+    b = Bitmap(13, 11, value_count)
+    for i in range(b.height):
+        for j in range(b.width):
+            seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+            b[j, i] = (seed >> 8) % value_count
+    return b
+
+
+def clamp(v, lo, hi):
+    return min(max(v, lo), hi)
+
+
+def swap(p):
+    return ((p & 0xFF) << 8) | (p >> 8)
+
+
+def luma(p):
+    r = (p >> 8) & 0xF8
+    r |= r >> 5
+    g = (p >> 3) & 0xFC
+    g |= g >> 6
+    b = (p << 3) & 0xF8
+    b |= b >> 5
+    return (r * 38 + g * 75 + b * 15) >> 7
+
+
+# The same fixed point arithmetic as the general 2D convolution
+def reference(b, weights, add, threshold, mask):
+    n = int(len(weights) ** 0.5)
+    k = n // 2
+    s = sum(weights)
+    m_int = round(65536 / s) if s else 65536
+    gray = b.bits_per_value == 8
+    b_int = round(65536 * (255 if gray else 63) * add)
+    out = []
+    for y in range(b.height):
+        for x in range(b.width):
+            src = b[x, y]
+            if mask and mask[x, y]:
+                out.append(src)
+                continue
+            acc = [0, 0, 0]
+            for j in range(-k, k + 1):
+                for i in range(-k, k + 1):
+                    p = b[clamp(x + i, 0, b.width - 1), clamp(y + j, 0, b.height - 1)]
+                    w = weights[(j + k) * n + i + k]
+                    if gray:
+                        acc[0] += w * p
+                    else:
+                        p = swap(p)
+                        acc[0] += w * (p >> 11)
+                        acc[1] += w * ((p >> 5) & 0x3F)
+                        acc[2] += w * (p & 0x1F)
+            if gray:
+                pixel = clamp((acc[0] * m_int + b_int) >> 16, 0, 255)
+                if threshold:
+                    pixel = 255 if pixel < src else 0
+            else:
+                r = clamp((acc[0] * m_int + b_int) >> 16, 0, 31)
+                g = clamp((acc[1] * m_int + b_int * 2) >> 16, 0, 63)
+                bb = clamp((acc[2] * m_int + b_int) >> 16, 0, 31)
+                pixel = (r << 11) | (g << 5) | bb
+                if threshold:
+                    pixel = 0xFFFF if luma(pixel) < luma(swap(src)) else 0
+                pixel = swap(pixel)
+            out.append(pixel)
+    return out
+
+
+def check(name, value_count, weights, add=0, threshold=False, masked=False):
+    b = make_bitmap(value_count, len(weights) + value_count)
+    mask = make_bitmap(2, 7) if masked else None
+    expected = reference(b, weights, add, threshold, mask)
+    bitmapfilter.morph(b, weights=weights, add=add, threshold=threshold, mask=mask)
+    actual = [b[x, y] for y in range(b.height) for x in range(b.width)]
+    print(name, value_count, actual == expected)
+
+
+box3 = [1] * 9
+box5 = [1] * 25
+gauss5 = [a * b for a in (1, 4, 6, 4, 1) for b in (1, 4, 6, 4, 1)]
+sobel = [-1, 0, 1, -2, 0, 2, -1, 0, 1]
+sharpen = [0, -1, 0, -1, 5, -1, 0, -1, 0]
+
+for value_count in (65536, 256):
+    check("box3", value_count, box3)
+    check("box5", value_count, box5, add=0.1)
+    check("gauss5", value_count, gauss5)
+    check("gauss5 masked", value_count, gauss5, masked=True)
+    check("sobel", value_count, sobel, add=0.25)
+    check("sharpen", value_count, sharpen)
+    check("box3 threshold", value_count, box3, threshold=True)
+    check("sharpen threshold", value_count, sharpen, threshold=True)
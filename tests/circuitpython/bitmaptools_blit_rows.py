@@ -0,0 +1,67 @@
+# Check the row copy and fill paths give the same result as pixel by pixel copies.
+try:
+    import bitmaptools
+    import displayio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+def pattern(bitmap):
+    for y in range(bitmap.height):
+        for x in range(bitmap.width):
+            bitmap[x, y] = (x * 7 + y * 13 + x * y) % (1 << bits)
+
+
+def pixels(bitmap):
+    return [bitmap[i] for i in range(bitmap.width * bitmap.height)]
+
+
+def reference_blit(dest, source, x, y, x1, y1, x2, y2):
+    values = [[source[i, j] for i in range(x1, x2)] for j in range(y1, y2)]
+    for j, row in enumerate(values):
+        for i, value in enumerate(row):
+            if 0 <= x + i < dest.width and 0 <= y + j < dest.height:
+                dest[x + i, y + j] = value
+
+
+failures = 0
+cases = 0
+for bits in (1, 2, 4, 8, 16):
+    for x, y, x1, y1, x2, y2 in (
+        (0, 0, 0, 0, 37, 9),
+        (3, 2, 1, 1, 30, 8),
+        (31, 0, 5, 0, 37, 3),
+        (17, 5, 0, 2, 33, 9),
+        (36, 8, 0, 0, 37, 9),
+    ):
+        # Between two bitmaps and within one bitmap, where source and destination overlap.
+        for same in (False, True):
+            source = displayio.Bitmap(37, 9, 1 << bits)
+            pattern(source)
+            dest = source if same else displayio.Bitmap(37, 9, 1 << bits)
+            expected = displayio.Bitmap(37, 9, 1 << bits)
+            for i in range(37 * 9):
+                expected[i] = dest[i]
+            reference_blit(expected, source, x, y, x1, y1, x2, y2)
+            bitmaptools.blit(dest, source, x, y, x1=x1, y1=y1, x2=x2, y2=y2)
+            cases += 1
+            if pixels(dest) != pixels(expected):
+                failures += 1
+                print("blit mismatch", bits, same, x, y, x1, y1, x2, y2)
+
+    for x1, y1, x2, y2 in ((0, 0, 37, 9), (1, 1, 2, 2), (3, 2, 34, 7), (31, 0, 33, 9), (0, 4, 32, 5)):
+        value = (1 << bits) - 2
+        bitmap = displayio.Bitmap(37, 9, 1 << bits)
+        pattern(bitmap)
+        expected = pixels(bitmap)
+        for y in range(y1, y2):
+            for x in range(x1, x2):
+                expected[y * 37 + x] = value
+        bitmaptools.fill_region(bitmap, x1, y1, x2, y2, value)
+        cases += 1
+        if pixels(bitmap) != expected:
+            failures += 1
+            print("fill mismatch", bits, x1, y1, x2, y2)
+
+print(cases, "cases", failures, "failures")
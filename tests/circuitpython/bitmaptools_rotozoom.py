@@ -0,0 +1,25 @@
+# Rotations by right angles and integer scales land exactly on source pixel edges.
+try:
+    import bitmaptools
+    import displayio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+import math
+
+
+def show(bitmap):
+    for y in range(bitmap.height):
+        print("".join("%x" % bitmap[x, y] for x in range(bitmap.width)))
+
+
+for bits in (2, 8, 16):
+    source = displayio.Bitmap(5, 3, 1 << bits)
+    for y in range(3):
+        for x in range(5):
+            source[x, y] = (x + 5 * y) % ((1 << bits) - 1) + 1
+    for angle, scale in ((0, 1), (math.pi / 2, 1), (math.pi, 2), (-math.pi / 2, 0.5)):
+        dest = displayio.Bitmap(12, 12, 1 << bits)
+        bitmaptools.rotozoom(dest, source, ox=6, oy=6, px=2, py=1, angle=angle, scale=scale)
+        print(bits, "bits", angle, scale)
+        show(dest)
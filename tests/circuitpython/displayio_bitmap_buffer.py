@@ -0,0 +1,28 @@
+try:
+    import displayio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+# A read-only buffer is used in place, like assets frozen into flash
+data = bytes(range(16)) * 2
+b = displayio.Bitmap(4, 8, 256, buffer=data)
+print(b[1, 0], b[3, 7], b.width)
+try:
+    b[0, 0] = 1
+except Exception as e:
+    print(type(e).__name__)
+ba = bytearray(32)
+b2 = displayio.Bitmap(4, 8, 256, buffer=ba)
+b2[2, 1] = 9
+print(ba[6])
+try:
+    displayio.Bitmap(4, 9, 256, buffer=ba)
+except ValueError as e:
+    print(e)
+try:
+    displayio.Bitmap(4, 2, 256, buffer=memoryview(ba)[1:])
+except ValueError as e:
+    print(e)
+b3 = displayio.Bitmap(3, 2, 2, buffer=bytearray(8))
+print(b3.bits_per_value, len(memoryview(b3)))
@@ -0,0 +1,76 @@
+# StopIteration() is preallocated, so catching it doesn't allocate
+import gc
+import io
+import sys
+
+it = iter(())
+
+
+def poll(n):
+    while n:
+        n -= 1
+        try:
+            next(it)
+        except StopIteration:
+            pass
+
+
+def measure(n):
+    gc.collect()
+    gc.disable()
+    before = gc.mem_alloc()
+    poll(n)
+    after = gc.mem_alloc()
+    gc.enable()
+    return after - before
+
+
+measure(1)
+print(measure(100))
+
+
+# print the line numbers in the traceback, which don't depend on the file path
+def print_lines(e):
+    buf = io.StringIO()
+    sys.print_exception(e, buf)
+    print([line.split("line ")[1].strip() for line in buf.getvalue().split("\n") if "line " in line])
+
+
+# the instance is reused but still carries its own traceback
+def f():
+    next(it)
+
+try:
+    f()
+except StopIteration as e:
+    first = e
+    print_lines(e)
+try:
+    next(it)
+except StopIteration as e:
+    print(e is first, e.args)
+    print_lines(e)
+
+# deeper than the traceback storage, the outer frames are dropped
+def g(n):
+    if n:
+        g(n - 1)
+    else:
+        next(it)
+
+try:
+    g(10)
+except StopIteration as e:
+    print_lines(e)
+
+# StopIteration with a value is allocated as usual
+def gen():
+    yield 1
+    return 2
+
+gi = gen()
+next(gi)
+try:
+    next(gi)
+except StopIteration as e:
+    print(e is first, e.args)
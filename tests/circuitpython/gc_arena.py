@@ -0,0 +1,36 @@
+# Test gc.arena(), which bump-allocates from a contiguous reservation.
+import gc
+
+try:
+    gc.arena
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+arena = gc.arena(1024)
+print(arena.mem_free())
+
+with arena as a:
+    print(a is arena)
+    free = a.mem_free()
+    print(free >= 1024)
+    # Allocations come out of the arena.
+    items = [bytes(range(i)) for i in range(8)]
+    print(a.mem_free() < free)
+
+# The remainder is released on exit and objects outlive the arena.
+print(arena.mem_free())
+gc.collect()
+print(items[7])
+
+# Arenas nest, and running out falls back to the normal heap.
+with gc.arena(64) as outer:
+    with gc.arena(64) as inner:
+        big = bytearray(4096)
+    print(inner.mem_free())
+print(len(big))
+
+try:
+    gc.arena(0)
+except ValueError:
+    print("ValueError")
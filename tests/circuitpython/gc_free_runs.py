@@ -0,0 +1,38 @@
+# Test that small multi-block allocations still find free space correctly
+# when the heap is fragmented and blocks are freed and shrunk out of order.
+import gc
+
+gc.collect()
+
+# Fragment the heap with single-block objects, then drop every other one.
+keep = []
+holes = []
+for i in range(200):
+    keep.append(bytearray(4))
+    holes.append(bytearray(4))
+holes = None
+
+# Allocate each small size class repeatedly and check nothing overlaps.
+sizes = (20, 40, 60, 100, 120)
+objs = []
+for n in range(100):
+    size = sizes[n % len(sizes)]
+    objs.append(bytearray([n & 0xFF]) * size)
+    if n % 7 == 0:
+        # Free something earlier in the heap.
+        objs[n // 2] = None
+        gc.collect()
+
+ok = True
+for n, obj in enumerate(objs):
+    if obj is not None and (len(obj) != sizes[n % len(sizes)] or obj != bytearray([n & 0xFF]) * len(obj)):
+        ok = False
+print(ok)
+
+# Shrinking returns tail blocks that later allocations can reuse.
+big = [bytearray(128) for _ in range(20)]
+for i in range(len(big)):
+    big[i] = big[i][:8]
+small = [bytearray(b"x") * 48 for _ in range(20)]
+print(all(len(b) == 8 for b in big), all(s == b"x" * 48 for s in small))
+print(all(k == bytearray(4) for k in keep))
@@ -0,0 +1,63 @@
+# Test gc.sweep_budget(), which defers the sweep phase of a collection.
+import gc
+
+try:
+    gc.sweep_budget
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+print(gc.sweep_budget())
+gc.sweep_budget(500)
+print(gc.sweep_budget())
+
+try:
+    gc.sweep_budget(-1)
+except ValueError:
+    print("ValueError")
+
+
+def make(n, size):
+    return [bytearray([i & 0xFF]) * size for i in range(n)]
+
+
+def check(objs, size):
+    return all(o == bytearray([i & 0xFF]) * size for i, o in enumerate(objs))
+
+
+live = make(50, 24)
+garbage = make(200, 40)
+garbage = None
+gc.collect()
+
+# Allocate and resize while the sweep is still pending.
+fresh = make(100, 16)
+grown = [bytearray(8) for _ in range(20)]
+for g in grown:
+    g.extend(b"abcdefgh" * 4)
+shrunk = [bytearray(200)[:4] for _ in range(20)]
+
+# Reporting finishes the sweep.
+gc.mem_free()
+print(check(live, 24), check(fresh, 16))
+print(all(g == bytearray(8) + b"abcdefgh" * 4 for g in grown))
+print(all(s == bytearray(4) for s in shrunk))
+
+# A second collection finishes cleanly and keeps everything alive.
+gc.collect()
+fresh.extend(make(100, 16))
+gc.collect()
+print(check(live, 24), len(fresh), check(fresh[:100], 16), check(fresh[100:], 16))
+
+# Reusing the garbage from the last collection forces the pending sweep to finish.
+live = fresh = grown = shrunk = None
+gc.collect()
+n = gc.mem_free() * 8 // 10 // 1024
+garbage = [bytearray(1000) for _ in range(n)]
+garbage = None
+gc.collect()
+again = [bytearray(1000) for _ in range(n)]
+print(len(again) == n)
+
+gc.sweep_budget(0)
+print(gc.sweep_budget())
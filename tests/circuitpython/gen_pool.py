@@ -0,0 +1,88 @@
+# Test that generators which are only awaited or yielded from get reused.
+import micropython
+
+try:
+    micropython.heap_lock
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+def inner(x):
+    yield x
+    return x + 1
+
+
+def outer(n, res):
+    total = 0
+    i = 0
+    while i < n:
+        total += yield from inner(i)
+        i += 1
+    res[0] = total
+
+
+async def step(x):
+    return x + 1
+
+
+async def chain(n, res):
+    total = 0
+    i = 0
+    while i < n:
+        total += await step(i)
+        i += 1
+    res[0] = total
+
+
+def run_locked(gen, res):
+    ok = False
+    micropython.heap_lock()
+    try:
+        for _ in gen:
+            pass
+        ok = True
+    except MemoryError:
+        pass
+    micropython.heap_unlock()
+    print(ok, res[0])
+
+
+# Once a finished generator is pooled, yield from needs no allocation.
+res = [0]
+g = outer(100, res)
+for _ in outer(3, res):
+    pass
+run_locked(g, res)
+
+# Likewise for await.
+c = chain(50, res)
+for _ in chain(1, res):
+    pass
+run_locked(c, res)
+
+
+# Generators that are referenced elsewhere are left alone.
+def keep(res):
+    g = inner(7)
+    res[0] = yield from g
+    res.append(g)
+
+
+res = [0]
+for v in keep(res):
+    print(v)
+print(res[0], list(res[1]))
+
+
+async def escape():
+    a = step(1).__await__()
+    x = await a
+    y = await step(2)
+    b = step(3)
+    print(x, y, b is a)
+    b.close()
+
+
+for _ in escape():
+    pass
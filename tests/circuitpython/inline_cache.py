@@ -0,0 +1,103 @@
+# Test that cached name, global, attribute and method loads see updates.
+x = 1
+
+
+def read_x():
+    return x
+
+
+print(read_x())
+x = 2
+print(read_x())
+# Grow the globals dict so its table is reallocated.
+for i in range(40):
+    globals()["g%d" % i] = i
+print(read_x())
+del x
+try:
+    read_x()
+except NameError:
+    print("NameError")
+x = 3
+print(read_x())
+
+
+# A global shadowing a builtin, then removed again.
+def get_len():
+    return len("abc")
+
+
+print(get_len())
+len = lambda s: -1
+print(get_len())
+del len
+print(get_len())
+
+
+# One attribute site seeing several instances and classes.
+class A:
+    def __init__(self, v):
+        self.v = v
+
+    def m(self):
+        return "A"
+
+
+class B:
+    def __init__(self, v):
+        self.v = v
+
+    def m(self):
+        return "B"
+
+
+def read_v(o):
+    return o.v
+
+
+def call_m(o):
+    return o.m()
+
+
+objs = [A(1), B(2), A(3), B(4)]
+print([read_v(o) for o in objs for _ in range(2)])
+print([call_m(o) for o in objs])
+objs[0].v = 10
+del objs[1].v
+objs[1].w = 5
+try:
+    read_v(objs[1])
+except AttributeError:
+    print("AttributeError")
+print(read_v(objs[0]))
+A.m = lambda self: "A2"
+print(call_m(objs[0]))
+
+
+# Module attributes, through this module.
+import __main__ as mod
+
+value = 7
+
+
+def read_mod():
+    return mod.value
+
+
+print(read_mod())
+value = 8
+print(read_mod())
+for i in range(40, 80):
+    globals()["g%d" % i] = i
+print(read_mod())
+
+
+# Native type methods and attributes through one site.
+def append_all(items):
+    for seq in items:
+        seq.append(0)
+    return items
+
+
+print(append_all([[], bytearray(b"a"), [1]]))
+print([s.upper() for s in ("ab", b"cd", "ef")])
@@ -0,0 +1,49 @@
+import json
+from io import BytesIO
+
+doc = b"""{
+  "name": "Paris",
+  "coord": {"lon": 2.35, "lat": 48.85},
+  "list": [
+    {"dt": 1, "main": {"temp": 280, "humidity": 81}, "weather": [{"id": 800, "main": "Clear"}]},
+    {"dt": 2, "main": {"temp": 283, "humidity": 70}, "skip": [1, [2, {"x": "]}"}], null, true]}
+  ],
+  "escaped \\"key\\"": "v\\u0041",
+  "count": -12
+}"""
+
+print(json.extract(BytesIO(doc), [("name",), ("list", 1, "main", "temp"), ("count",)]))
+print(json.extract(doc, [("list", 0, "weather", 0, "main"), ("coord",), ("coord", "lat")]))
+print(json.extract(doc, [('escaped "key"',), ("list", 1, "skip", 1, 1, "x")]))
+print(json.extract(doc, [("missing",), ("list", 5), ("name", "x"), ("list", "dt")], default=0))
+print(json.extract("[1, 2]", [()]))
+print(json.extract("[1, [2, 3], 4]", [(2,), (1, 1)]))
+print(json.extract("[]", []))
+
+
+# Stops reading once everything has been found.
+class Reader:
+    def __init__(self, data):
+        self._data = data
+        self.pos = 0
+
+    def readinto(self, buf):
+        n = min(len(buf), len(self._data) - self.pos)
+        buf[:n] = self._data[self.pos : self.pos + n]
+        self.pos += n
+        return n
+
+
+r = Reader(doc + b" " * 200)
+print(json.extract(r, [("coord", "lon")]), r.pos < len(doc))
+
+for bad in ('{"a": [1, 2}', '{"a": ', "", '{1: 2}', '["abc'):
+    try:
+        json.extract(bad, [("a", 5)])
+    except ValueError as e:
+        print("ValueError", bad)
+
+try:
+    json.extract(doc, [("a",)] * 33)
+except ValueError:
+    print("ValueError too many paths")
@@ -0,0 +1,49 @@
+import gc
+import memorymonitor
+
+gc.collect()
+stats = memorymonitor.HeapStats()
+print(stats.bytes_per_block)
+print(stats.free > 0, stats.used > 0)
+print(0 < stats.largest_free <= stats.free)
+histogram = stats.free_histogram
+print(len(histogram), sum(histogram) > 0)
+
+
+# The class itself is counted along with its instances.
+class Thing:
+    pass
+
+
+things = [Thing() for _ in range(20)]
+type_blocks = memorymonitor.HeapStats().type_blocks
+print(Thing in type_blocks, type_blocks[Thing] >= 20)
+print(list in type_blocks, None in type_blocks)
+print(sum(type_blocks.values()) <= memorymonitor.HeapStats().used)
+
+# Allocation sites are recorded per line.
+def allocate():
+    a = []
+    for i in range(10):
+        a.append(bytearray(100))
+    b = bytes(200)
+    return a, b
+
+
+sites = memorymonitor.AllocationSites()
+with sites:
+    allocate()
+for source_file, function, line, count in sites:
+    if function == "allocate":
+        print(line, count)
+print(sites.dropped)
+
+sites = memorymonitor.AllocationSites(sample_every=5)
+with sites:
+    allocate()
+print(sum(site[3] for site in sites if site[1] == "allocate"))
+
+try:
+    memorymonitor.AllocationSites(sample_every=0)
+except ValueError:
+    print("ValueError")
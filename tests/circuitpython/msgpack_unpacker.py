@@ -0,0 +1,39 @@
+try:
+    import msgpack
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+from io import BytesIO
+
+b = BytesIO()
+for obj in ({"a": [1, -2, None], "b": b"\x01\x02\x03"}, "hello", 123456, b"x" * 300, (True, False)):
+    msgpack.pack(obj, b)
+data = b.getvalue()
+print(len(data))
+
+u = msgpack.Unpacker()
+out = []
+for i in range(0, len(data), 7):
+    u.feed(data[i : i + 7])
+    for obj in u:
+        out.append(obj)
+print(out[0], out[1], out[2], len(out[3]), out[4], u.in_waiting)
+
+u = msgpack.Unpacker(BytesIO(data), read_size=16, use_memoryview=True)
+objs = list(u)
+print(type(objs[0]["b"]), bytes(objs[0]["b"]), type(objs[3]), bytes(objs[3]) == b"x" * 300, objs[4])
+
+u = msgpack.Unpacker(use_list=False)
+u.feed(data[:5])
+print(list(u), u.in_waiting)
+u.feed(data[5:])
+print(next(u))
+
+u = msgpack.Unpacker()
+u.feed(b"\xc1")
+try:
+    next(u)
+except ValueError as e:
+    print("ValueError", e)
+print(msgpack.unpack(BytesIO(data)))
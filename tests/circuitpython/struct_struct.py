@@ -0,0 +1,58 @@
+import struct
+
+s = struct.Struct("<hhh")
+print(s.format, s.size)
+b = s.pack(1, -2, 3)
+print(b)
+print(s.unpack(b))
+print(s.unpack_from(b"\x00\x00" + b, 2))
+print(s.unpack_from(b, -6))
+
+buf = bytearray(8)
+s.pack_into(buf, 2, 0x1234, -1, 32767)
+print(buf)
+
+out = [None, None, None]
+r = s.unpack_from(buf, 2, into=out)
+print(r is out, out)
+
+# Mixed formats take the general path and must match the module functions.
+for fmt in ("<bHi", ">I2xh", "@bhi", "<3s2B", "<fH", ">Q", "<L", "B"):
+    st = struct.Struct(fmt)
+    vals = struct.unpack(fmt, bytes(range(1, struct.calcsize(fmt) + 1)))
+    print(fmt, st.size == struct.calcsize(fmt), st.pack(*vals) == struct.pack(fmt, *vals), st.unpack(st.pack(*vals)) == vals)
+
+try:
+    s.unpack(b"12345")
+except RuntimeError as e:
+    print(e)
+
+try:
+    s.unpack_from(b"12345")
+except RuntimeError as e:
+    print(e)
+
+try:
+    s.pack_into(bytearray(4), 0, 1, 2, 3)
+except RuntimeError as e:
+    print(e)
+
+try:
+    s.pack(1, 2)
+except ValueError as e:
+    print(e)
+
+try:
+    s.unpack_from(b, into=[0, 0])
+except ValueError as e:
+    print(e)
+
+try:
+    s.unpack_from(b, into=(0, 0, 0))
+except TypeError as e:
+    print(e)
+
+try:
+    struct.Struct("<b").pack(128)
+except OverflowError as e:
+    print("OverflowError")
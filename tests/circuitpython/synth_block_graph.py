@@ -0,0 +1,37 @@
+from audiocore import get_buffer
+from synthio import LFO, Math, MathOperation, Synthesizer
+
+synth = Synthesizer(sample_rate=8000)
+a = LFO(rate=4)
+b = LFO(rate=4)
+
+
+def advanced(*lfos):
+    before = [l.value for l in lfos]
+    get_buffer(synth)
+    return [l.value != v for l, v in zip(lfos, before)]
+
+
+# The block order is recorded on the first buffer and reused after that
+synth.blocks.append(a)
+print(advanced(a))
+print(advanced(a))
+print(advanced(a))
+
+# Changes to the blocks list are noticed
+synth.blocks.remove(a)
+print(advanced(a))
+synth.blocks.append(a)
+print(advanced(a, b))
+synth.blocks[0] = b
+print(advanced(a, b))
+print(advanced(a, b))
+
+# So are changes to block inputs
+m = Math(MathOperation.SUM, a)
+synth.blocks[0] = m
+print(advanced(a, b))
+print(advanced(a, b))
+m.a = b
+print(advanced(a, b))
+print(advanced(a, b))
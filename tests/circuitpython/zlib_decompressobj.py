@@ -0,0 +1,120 @@
+try:
+    import zlib
+
+    zlib.Decompress
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+def stored(payload):
+    # zlib stream of stored blocks, built by hand
+    out = bytearray(b"\x78\x01")
+    for i in range(0, len(payload), 1000):
+        block = payload[i : i + 1000]
+        final = 1 if i + 1000 >= len(payload) else 0
+        n = len(block)
+        out += bytes((final, n & 0xFF, n >> 8, ~n & 0xFF, (~n >> 8) & 0xFF)) + block
+    a, b = 1, 0
+    for c in payload:
+        a = (a + c) % 65521
+        b = (b + a) % 65521
+    out += ((b << 16) | a).to_bytes(4, "big")
+    return bytes(out)
+
+
+def run(packed, wbits, chunk_size, out_size, window=None):
+    d = zlib.decompressobj(wbits, window=window)
+    chunk = bytearray(chunk_size)
+    out = bytearray(out_size)
+    result = bytearray()
+    for i in range(0, len(packed), chunk_size):
+        n = min(chunk_size, len(packed) - i)
+        chunk[:n] = packed[i : i + n]
+        d.feed(memoryview(chunk)[:n])
+        while n := d.readinto(out):
+            result += out[:n]
+        # The chunk buffer may be reused once readinto() returns 0.
+        chunk[:] = bytes(chunk_size)
+    d.finish()
+    while n := d.readinto(out):
+        result += out[:n]
+    return bytes(result), d.eof
+
+
+data = bytes((i * i) % 251 for i in range(3000)) * 3
+packed = stored(data)
+print(zlib.decompress(packed) == data)
+for chunk_size, out_size in ((1, 7), (100, 512), (700, 64), (5000, 4096), (len(packed), 1)):
+    print(chunk_size, out_size, run(packed, 15, chunk_size, out_size) == (data, True))
+
+# gzip stream with dynamic Huffman blocks, from CPython's zlib.compressobj(9, zlib.DEFLATED, 31)
+words = [b"alpha", b"beta", b"gamma", b"delta", b"epsilon", b"zeta", b"eta", b"theta"]
+text = bytearray()
+x = 1
+for i in range(1000):
+    x = (x * 1103515245 + 12345) & 0x7FFFFFFF
+    text += words[(x >> 16) % 8] + bytes([48 + (x >> 8) % 10]) + b" "
+gz = bytes.fromhex(
+    "1f8b08000000000002036d595b8edb300cbc8a8fa0b7e5e3c468d016d83e80e64ba7efae342487dafd89e3d8"
+    "922872381c2acfd7a31ccf8f8ffbfdb31ddf9e6faf475d976b5dfaf1fdf1ebd723c9ddf3efbf9f6f7f7e878f"
+    "61d731e6e0d78f391a8fe89d7bbe341fe77953d7cd85f5de3fe231bfcd45823c9d97532ecf8f75e7f78449e6"
+    "dbfd78bcfdfdf13ec82d87a9da611bd20b9e7c18bd5ec61455a6b8e44be69d55b94c0bc6b469ce58c437f3b2"
+    "3615d794cdace257afb59969c09cb4cf4109a6f372495e90a51197b41638a7211de6d89e673cf1431423aa2e"
+    "9be4a738972c186fcbb6357e450e2bc149f022a2b222311f2d1cc0b0386f22fc8bd58a606ab915d18667306c"
+    "2d09c3e7a3204e5bd35b44f05a9d0faa4c375f829173cece70590b9ccbf7ea170c05926ec6715e0fcb42e9d0"
+    "307502e429f6e8d364c62681c79cbd18c896cfe13a8d07d204f7321b1c31344bd90f910dc70c059b46be0252"
+    "9fa6a962d5326628182abecf1151a61902ad4ccb9f87ec5d8308eb91b488121954c412ca956e1ec70e7cca30"
+    "0a33608b592887ba9800cf78da1a866709f36d616c9c4691d10c2e0abad3c67151cb9b8b4787236f19542541"
+    "9105167f5cd261600abaa4204113bd39e66bf606a3fe92d09173b2190a50738215710c127dc88e9591061304"
+    "82a4a1c646bc3197ee55500fd39f8a2aca88797f123c1bd1d82517bc85cd0f8bc365b91d0f2d36cd4cc4366e"
+    "fa640780390783d69b9899a59ad5cc20357330737b7a39611d12dc52a7ca5ac4a227e235e627ace3b4484c8a"
+    "5c4aa2c56d2797c2c9be47260bad88b3e6e3accce6f829fa8462b626b2574a69c873cbb84b40862832a6e46d"
+    "75dfd0dc5435c2c3eac64ea23f6ecb5fe2534b64611f4ecac24ef4f5c7c3f0f36e85de2578a818ea4f97b952"
+    "53f821ca3bbb8ab557611da5220dd0595812536e0e59138391a0a085c1a9d1dcc3cc0515dbce87451aa400ca"
+    "1a0c9b04f38725e2e04a8d68b086a8163132cd579e2486518a74735a3aac9475e35b9522600ca2fa8ab415ed"
+    "6841338c56c24aa1b09c5c7cb260846ccf4ebaa585352bb095a11c2941147c4e9c35bb15f1e8eeabf08254d1"
+    "9795ab5ba8301c4427b7f82d0ab2c049088b6ad62f79ac7c59fa4e52b055e643b4a99ee64d216407ce4c6a34"
+    "48d4003912d70a232bac0afd611bc99be2eae603e575d36a82087d199bf7aa1777dee3b066684b13387da5c7"
+    "c046b10f04c8a82d6c4c92a570333d2509017252ebdde99a86621061d241c9f142ca07bb399213f5c9a4a5a2"
+    "da0a79f7ae4baa4b5e9eb4b26f5390cbb7755292779eb912f3b4e40b01bc23e82c943d929b2fd2d44416aed8"
+    "d9447ba4389ef673205fbb5cef260aa525e3a6cb9a136e2c23359cc6f983114e3eea1b5d5e1208df90e996d5"
+    "33418b04a7ea9633a72bdb45dbcd6ca328181d7b14b4bd4c70535f283353550f8e1a2fd88731bedaf94464ea"
+    "14d16e2112ca40c23373d48d6a32115ff73ee8d4ea15977efa3e66067b0c6b7cbc4054ada6252a3841a98d02"
+    "f30ffceb7b091f50dfd6043e46c98eb0f2d7b535f0b9453a58c96de2011b25df27d7a807d6dfd9b5c19d0bb1"
+    "e4148cf3535049e57e44fb5916fcc830f386d8cb2f511c9c2027811885c38106473c601526a8c26d65d8c4e2"
+    "d81afee8662d07ebb002ec5aa7d75d06eb418335e1d1b71ba630dd691a090429ae92818d9a892490e01a16b8"
+    "cbcd4c861e02c51d245c5b4b7539a6286c5c76fdf8b5b587c9efd97187cfa86c9aba70f18e54bc9b67b2cb91"
+    "6825f123f43b98b1f62e940d6c5bff70ed9a8b9915b8e62e5c4ba2515015acdb51aaf369140473b93e55ed66"
+    "d75f07c696b62dbad362c5888f33fa16b1b0094c27f8aae39c4e4ab8c9e6e00c02d6c5f16dbee7a89b90185a"
+    "10f434e4a6d3253d51127731d1262ee085a24bfa66706a7b70d50d297c00537c5faca2d2374c7ce0d5dc5da2"
+    "e386930f2c93936555c27d7fb9dd8b30955c4f143e513c108a4833db39dac019a81c116872673e79a140543e"
+    "c7f3dd4fdb68170865797c6ec2d2e7a8ef8b2f6a65ca86c9c27194d362774aef0ef4f5b80ee01dd4dd6de72f"
+    "7a1040ed4d268e299ecf389ca677fb56b3588934c978560291ff412108a483cf008757029431eed4a711d628"
+    "8bfd111d774f991bfee8fe19e8ee2cf26603e2f11fd4f91aa6321a0000"
+)
+print(len(text), len(gz))
+for chunk_size, out_size in ((1, 100), (64, 1000), (1500, 37), (4096, 8192)):
+    print(chunk_size, out_size, run(gz, 31, chunk_size, out_size) == (text, True))
+
+# Caller-supplied window
+window = bytearray(32768)
+print(run(packed, 15, 333, 256, window=window)[0] == data)
+try:
+    run(packed, 15, 333, 256, window=bytearray(100))
+except ValueError as e:
+    print("ValueError", e)
+
+# Truncated input
+try:
+    run(gz[: len(gz) // 2], 31, 64, 64)
+except ValueError as e:
+    print("ValueError", e)
+
+# Corrupt data
+d = zlib.decompressobj()
+d.feed(b"\x78\x01\x07" + bytes(2000))
+try:
+    d.readinto(bytearray(10))
+except ValueError as e:
+    print("ValueError", e)
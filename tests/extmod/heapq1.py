@@ -37,3 +37,17 @@ heapq.heappush(h, 6)
 heapq.heappush(h, 12)
 print(h)
 pop_and_print(h)
+
+# heappushpop and heapreplace keep the heap the same size
+try:
+    heapq.heapreplace([], 1)
+except IndexError:
+    print("IndexError")
+print(heapq.heappushpop([], 5))
+h = [5, 1, 8, 3]
+heapq.heapify(h)
+print(heapq.heappushpop(h, 0), h)
+print(heapq.heappushpop(h, 4), h)
+print(heapq.heapreplace(h, 9), h)
+print(heapq.heapreplace(h, 2), h)
+pop_and_print(h)
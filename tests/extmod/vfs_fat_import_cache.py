@@ -0,0 +1,81 @@
+# Test that imports from a VfsFat see files created and removed after earlier lookups
+
+try:
+    import os, sys
+
+    os.VfsFat
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBlockDevice:
+    def __init__(self, blocks, sec_size=512):
+        self.sec_size = sec_size
+        self.data = bytearray(blocks * self.sec_size)
+
+    def readblocks(self, n, buf):
+        for i in range(len(buf)):
+            buf[i] = self.data[n * self.sec_size + i]
+
+    def writeblocks(self, n, buf):
+        for i in range(len(buf)):
+            self.data[n * self.sec_size + i] = buf[i]
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.sec_size
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.sec_size
+
+
+try:
+    bdev = RAMBlockDevice(50)
+except MemoryError:
+    print("SKIP")
+    raise SystemExit
+
+os.VfsFat.mkfs(bdev)
+vfs = os.VfsFat(bdev)
+os.mount(vfs, "/ramdisk")
+sys.path.insert(0, "/ramdisk")
+
+
+def try_import(name):
+    try:
+        mod = __import__(name)
+        print(name, mod.value)
+        del sys.modules[name]
+    except ImportError:
+        print(name, "ImportError")
+
+
+# The first lookup misses, the second must see the new file.
+try_import("cached_mod")
+with open("/ramdisk/cached_mod.py", "w") as f:
+    f.write("value = 1\n")
+try_import("cached_mod")
+try_import("cached_mod")
+
+# A package directory made after a failed lookup.
+try_import("cached_pkg")
+os.mkdir("/ramdisk/cached_pkg")
+with open("/ramdisk/cached_pkg/__init__.py", "w") as f:
+    f.write("value = 2\n")
+try_import("cached_pkg")
+
+# Removing and renaming files must be seen too.
+os.remove("/ramdisk/cached_mod.py")
+try_import("cached_mod")
+os.rename("/ramdisk/cached_pkg/__init__.py", "/ramdisk/cached_mod.py")
+os.rmdir("/ramdisk/cached_pkg")
+try_import("cached_mod")
+try_import("cached_pkg")
+
+# Remounting starts over.
+os.umount("/ramdisk")
+os.mount(os.VfsFat(bdev), "/ramdisk")
+try_import("cached_mod")
+
+sys.path.pop(0)
+os.umount("/ramdisk")
@@ -0,0 +1,54 @@
+# This tests how much CPU time audio playback takes away from Python code. A
+# synthio chord plays through an audiomixer voice while a fixed loop runs; the
+# score is loop iterations per second. Compare it with the same run while
+# nothing plays to get the audio load.
+
+try:
+    import board
+    import audiomixer
+    import synthio
+
+    try:
+        from audioio import AudioOut
+    except ImportError:
+        from audiopwmio import PWMAudioOut as AudioOut
+    pin = getattr(board, "SPEAKER", None) or board.A0
+except (ImportError, AttributeError):
+    pin = None
+
+
+def setup():
+    audio = AudioOut(pin)
+    mixer = audiomixer.Mixer(voice_count=1, sample_rate=22050, channel_count=1, buffer_size=1024)
+    synth = synthio.Synthesizer(sample_rate=22050)
+    audio.play(mixer)
+    mixer.voice[0].play(synth)
+    synth.press((60, 64, 67, 72))
+    return audio, synth
+
+
+def test(audio, synth, nloop):
+    x = 0
+    for i in range(nloop):
+        x += i
+    synth.release_all()
+    audio.deinit()
+    return x
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 25): (20000,),
+    (100, 100): (100000,),
+}
+
+if pin is None:
+    bm_params = {}
+
+
+def bm_setup(params):
+    (nloop,) = params
+    audio, synth = setup()
+    return lambda: test(audio, synth, nloop), lambda: (nloop // 100, None)
@@ -0,0 +1,48 @@
+# This tests how fast the built-in display redraws when every pixel changes.
+# The score is frames per second.
+
+try:
+    import board
+    import displayio
+
+    display = board.DISPLAY
+except (ImportError, AttributeError):
+    display = None
+
+
+def setup():
+    bitmap = displayio.Bitmap(display.width, display.height, 2)
+    palette = displayio.Palette(2)
+    palette[0] = 0x000000
+    palette[1] = 0xFFFFFF
+    group = displayio.Group()
+    group.append(displayio.TileGrid(bitmap, pixel_shader=palette))
+    display.auto_refresh = False
+    display.root_group = group
+    return bitmap
+
+
+def test(bitmap, nframe):
+    for i in range(nframe):
+        bitmap.fill(i & 1)
+        # No frame rate target, so refresh() doesn't wait between frames
+        display.refresh(target_frames_per_second=None)
+    display.auto_refresh = True
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 25): (10,),
+    (100, 100): (30,),
+}
+
+if display is None:
+    bm_params = {}
+
+
+def bm_setup(params):
+    (nframe,) = params
+    bitmap = setup()
+    return lambda: test(bitmap, nframe), lambda: (nframe, None)
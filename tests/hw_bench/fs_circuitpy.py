@@ -0,0 +1,46 @@
+# This tests write then read throughput of the CIRCUITPY filesystem. The score is
+# kilobytes per second. The filesystem must be writable from code, so the test
+# is skipped while USB has it mounted.
+
+import os
+
+FILENAME = "/bench.tmp"
+
+
+def writable():
+    try:
+        with open(FILENAME, "wb"):
+            pass
+        os.remove(FILENAME)
+    except OSError:
+        return False
+    return True
+
+
+def test(block_size, nblock):
+    buf = bytearray(block_size)
+    with open(FILENAME, "wb") as f:
+        for _ in range(nblock):
+            f.write(buf)
+    with open(FILENAME, "rb") as f:
+        for _ in range(nblock):
+            f.readinto(buf)
+    os.remove(FILENAME)
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 25): (512, 32),
+    (100, 100): (4096, 32),
+}
+
+if not writable():
+    bm_params = {}
+
+
+def bm_setup(params):
+    block_size, nblock = params
+    # Each block is written once and read once
+    return lambda: test(block_size, nblock), lambda: (2 * block_size * nblock // 1024, None)
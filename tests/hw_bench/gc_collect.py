@@ -0,0 +1,29 @@
+# This tests how long gc.collect() takes with a heap holding many small, linked objects.
+# The score is collections per second.
+
+import gc
+
+
+def test(nloop, nobj):
+    # Chain of lists plus some dicts, so marking has to follow pointers
+    head = None
+    for i in range(nobj):
+        head = [head, {i: i}, bytearray(8)]
+    for _ in range(nloop):
+        gc.collect()
+    return head
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 25): (10, 100),
+    (100, 100): (20, 1000),
+    (1000, 1000): (50, 10000),
+}
+
+
+def bm_setup(params):
+    nloop, nobj = params
+    return lambda: test(nloop, nobj), lambda: (nloop, None)
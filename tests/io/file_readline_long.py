@@ -0,0 +1,23 @@
+# readline() and iteration over lines longer than one read chunk
+import os
+
+if not hasattr(os, "remove"):
+    print("SKIP")
+    raise SystemExit
+
+data = "".join("line %d %s\n" % (i, "x" * (i * 37 % 500)) for i in range(40)) + "no newline"
+
+f = open("testfile", "w")
+f.write(data)
+f.close()
+
+f = open("testfile")
+print([len(line) for line in f])
+f.close()
+
+f = open("testfile", "rb")
+print(f.readline(3), f.readline(200)[-3:], f.tell())
+print(f.readline()[-3:], f.tell(), f.read(6))
+f.close()
+
+os.remove("testfile")
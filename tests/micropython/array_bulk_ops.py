@@ -0,0 +1,58 @@
+# test the array bulk elementwise methods (MicroPython extension)
+try:
+    from array import array
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+if not hasattr(array, "sum"):
+    print("SKIP")
+    raise SystemExit
+
+a = array("h", [1, -5, 300, 7])
+print(a.sum(), a.min(), a.max())
+
+# in place
+a.scale(2, 1)
+print(a)
+a.clip(0, 100)
+print(a)
+
+# unsigned and large values
+u = array("I", [0xFFFFFFFF, 1])
+print(u.sum(), u.min(), u.max())
+
+# into another array, converting the type
+b = array("f", [0.5] * 4)
+b.add(a)
+print(b)
+o = array("B", [0] * 4)
+b.scale(1.5, out=o)
+print(o)
+a.scale(0.5, out=b)
+print(b)
+print(b.sum(), b.min(), b.max())
+
+# fill
+o.fill(9)
+print(o)
+big = array("i", range(7))
+big.fill(-2)
+print(big)
+e = array("i")
+e.fill(3)
+print(e.sum())
+
+# errors
+try:
+    e.min()
+except ValueError:
+    print("ValueError")
+try:
+    a.add(array("h", [1]))
+except ValueError:
+    print("ValueError")
+try:
+    a.add([1, 2, 3, 4])
+except TypeError:
+    print("TypeError")
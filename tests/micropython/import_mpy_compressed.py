@@ -0,0 +1,92 @@
+# test importing of deflate compressed .mpy files
+
+try:
+    import sys, io, os
+
+    io.IOBase
+    os.mount
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class UserFile(io.IOBase):
+    def __init__(self, data):
+        self.data = memoryview(data)
+        self.pos = 0
+
+    def read(self):
+        return self.data
+
+    def readinto(self, buf):
+        n = min(len(buf), len(self.data) - self.pos)
+        buf[:n] = self.data[self.pos : self.pos + n]
+        self.pos += n
+        return n
+
+    def ioctl(self, req, arg):
+        return 0
+
+
+class UserFS:
+    def __init__(self, files):
+        self.files = files
+
+    def mount(self, readonly, mksfs):
+        pass
+
+    def umount(self):
+        pass
+
+    def stat(self, path):
+        if path in self.files:
+            return (32768, 0, 0, 0, 0, 0, 0, 0, 0, 0)
+        raise OSError
+
+    def open(self, path, mode):
+        return UserFile(self.files[path])
+
+
+# mod0 was compiled from:
+#   x = 1
+#   def f(a):
+#       return "compressed " * a + str(x)
+#   data = [b"bytes", (1, 2.5), "text " * 40]
+# and compressed with tools/mpy_compress.py --wbits 10
+mod0 = b'Z\x06\x00\x1f\n\xe3`\xe6K\xce\xcdO\xd1+\xa8d\xe0\xe7*I\xad(Q``Jc`\xaa`\xe0HI,Id`Jdh\xd2gcM\xaa,I-f\xe0bbg4\xe4`6\xd23e\xe5N\xce\xcf-(J-.NMQ`h\x8c\x91\xe0`LNQh\x14c1b\x10cVfPf\x14`Z\xf1E\x9bY\x8c50\x99\xb1Q@\x92\x83\x99-AA\x99i\xc3\x17!v!\x16\x13\xc6O\xc9\x00'
+
+# these are the test .mpy files
+user_files = {
+    "/mod0.mpy": mod0,
+    "/mod1.mpy": mod0[:40],  # truncated stream
+    "/mod2.mpy": mod0[:4] + b"\x20" + mod0[5:],  # window too big
+}
+
+# create and mount a user filesystem
+os.mount(UserFS(user_files), "/userfs")
+sys.path.append("/userfs")
+
+try:
+    import mod0
+except ValueError:
+    # compressed .mpy files not supported
+    print("SKIP")
+    raise SystemExit
+finally:
+    os.umount("/userfs")
+    sys.path.pop()
+
+print(mod0.f(2), mod0.data)
+
+os.mount(UserFS(user_files), "/userfs")
+sys.path.append("/userfs")
+for i in range(1, len(user_files)):
+    mod = "mod%u" % i
+    try:
+        __import__(mod)
+    except Exception as e:
+        print(mod, type(e).__name__, e)
+
+# unmount and undo path addition
+os.umount("/userfs")
+sys.path.pop()
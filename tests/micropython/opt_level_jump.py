@@ -0,0 +1,48 @@
+# test that nested control flow, whose jumps land on other jumps, still runs
+# correctly when those jumps are threaded at optimisation level 2
+import micropython
+
+micropython.opt_level(2)
+exec(
+    """
+def f(a, b):
+    if a:
+        if b:
+            x = 1
+        else:
+            x = 2
+    else:
+        x = 3
+    return x
+
+def g(n):
+    r = []
+    for i in range(n):
+        while i:
+            if i & 1:
+                if i > 2:
+                    r.append(i)
+                else:
+                    break
+            i -= 1
+    return r
+
+def h(a):
+    try:
+        if a:
+            if a > 1:
+                return 2
+            else:
+                a = 0
+    finally:
+        print("finally", a)
+    return a
+
+for a in (0, 1):
+    for b in (0, 1):
+        print(f(a, b))
+print(g(6))
+print(h(0), h(1), h(2))
+"""
+)
+micropython.opt_level(0)
@@ -0,0 +1,49 @@
+# Mix looping 16 bit stereo voices with audiomixer.Mixer.
+# The normalisation is output samples, so the score is samples per second.
+
+try:
+    import array
+    import audiocore
+    import audiomixer
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+if not hasattr(audiocore, "get_buffer"):
+    print("SKIP")
+    raise SystemExit
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 25): (10, 2),
+    (100, 100): (40, 4),
+    (1000, 1000): (400, 4),
+}
+
+
+def bm_setup(params):
+    nbuffers, voice_count = params
+    mixer = audiomixer.Mixer(
+        voice_count=voice_count,
+        buffer_size=1024,
+        channel_count=2,
+        sample_rate=22050,
+        bits_per_sample=16,
+        samples_signed=True,
+    )
+    for i, voice in enumerate(mixer.voice):
+        data = array.array("h", ((j * (i + 3) * 997) % 65536 - 32768 for j in range(256)))
+        voice.level = 0.5
+        voice.play(audiocore.RawSample(data, channel_count=2, sample_rate=22050), loop=True)
+    samples_per_buffer = len(audiocore.get_buffer(mixer)[1])
+
+    def run():
+        for i in range(nbuffers):
+            audiocore.get_buffer(mixer)
+
+    def result():
+        return nbuffers * samples_per_buffer, None
+
+    return run, result
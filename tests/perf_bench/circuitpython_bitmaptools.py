@@ -0,0 +1,41 @@
+# Fill, blit and rotozoom a 16 bit display sized bitmap with bitmaptools.
+# The normalisation is pixels written, so the score is pixels per second.
+
+try:
+    import bitmaptools
+    import displayio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 25): (2, 80, 60),
+    (100, 100): (4, 160, 120),
+    (1000, 1000): (20, 320, 240),
+}
+
+
+def bm_setup(params):
+    nloop, width, height = params
+    dest = displayio.Bitmap(width, height, 65536)
+    source = displayio.Bitmap(width // 2, height // 2, 65536)
+    for y in range(source.height):
+        for x in range(source.width):
+            source[x, y] = (x * 31 + y * 17) & 0xFFFF
+
+    def run():
+        for loop in range(nloop):
+            bitmaptools.fill_region(dest, 0, 0, width, height, loop)
+            bitmaptools.blit(dest, source, width // 4, height // 4)
+            bitmaptools.blit(dest, source, 0, 0, skip_source_index=0)
+            bitmaptools.rotozoom(dest, source, angle=0.5, scale=1.5)
+
+    def result():
+        # rotozoom writes every destination pixel it can reach, so count it as a full frame.
+        pixels = width * height + 2 * source.width * source.height + width * height
+        return nloop * pixels, None
+
+    return run, result
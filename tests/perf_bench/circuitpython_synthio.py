@@ -0,0 +1,46 @@
+# Render notes with synthio.Synthesizer, with and without envelopes and filters.
+# The normalisation is output samples, so the score is samples per second.
+
+try:
+    import audiocore
+    import synthio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+if not hasattr(audiocore, "get_buffer"):
+    print("SKIP")
+    raise SystemExit
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 25): (20, 4),
+    (100, 100): (80, 8),
+    (1000, 1000): (800, 12),
+}
+
+
+def bm_setup(params):
+    nbuffers, note_count = params
+    envelope = synthio.Envelope(attack_time=0.01, decay_time=0.1, sustain_level=0.7)
+    synth = synthio.Synthesizer(sample_rate=22050, channel_count=2, envelope=envelope)
+    lpf = synth.low_pass_filter(2000)
+    notes = []
+    for i in range(note_count):
+        note = synthio.Note(synthio.midi_to_hz(48 + 3 * i), panning=(i % 3 - 1) / 2)
+        if i % 2:
+            note.filter = lpf
+        notes.append(note)
+    synth.press(notes)
+    samples_per_buffer = len(audiocore.get_buffer(synth)[1])
+
+    def run():
+        for i in range(nbuffers):
+            audiocore.get_buffer(synth)
+
+    def result():
+        return nbuffers * samples_per_buffer, None
+
+    return run, result
@@ -0,0 +1,42 @@
+# Decompress a zlib stream of comma separated sensor log lines.
+# The normalisation is decompressed bytes, so the score is bytes per second.
+
+try:
+    import zlib
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+# 7520 bytes packed by CPython's zlib.compress(data, 9).
+COMPRESSED = (
+    b"x\xda\xed\xccA\n\xc20\x10@\xd1}\xce2H\xa3\x16\xbc\x8e\xe0\x88\xc1\xb6\t3"
+    b"\x93En/X\xd0;\x94\xbf~\xf0\\7\xaf\x96\x9e\xf7\xbe\x84\xbc\xfaZ\x1e%\x86"
+    b"\x84\xaeM\xf2\x94/b\x1a6\xd2\x0f\xea[\x9a\xa9{7\xddI\xce\xf94'\xff.\x7f"
+    b"\xba\xde\xf6\xc2\xd9\xd9\xd9\xd9\xd9\xd9\xd9\xd9\xd9\xd9\xd9\xd9\xd9\xd9"
+    b"\xd9\xd9\xd9\xd9\xd9\xd9\xd9\xd9\xd9\xd9\xd9\xd9\xd9\xd9\x0f\xb3\x7f\x00"
+    b"\xc5\xd7\x9c\x87"
+)
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (50, 25): (5,),
+    (100, 100): (20,),
+    (1000, 1000): (200,),
+}
+
+
+def bm_setup(params):
+    (nloop,) = params
+    length = 0
+
+    def run():
+        nonlocal length
+        for loop in range(nloop):
+            length = len(zlib.decompress(COMPRESSED))
+
+    def result():
+        return nloop * length, length
+
+    return run, result
@@ -28,6 +28,7 @@ else:
 PYTHON_TRUTH = CPYTHON3
 
 BENCH_SCRIPT_DIR = "perf_bench/"
+HW_BENCH_SCRIPT_DIR = "hw_bench/"
 
 
 def compute_stats(lst):
@@ -113,6 +114,9 @@ def run_benchmarks(console, target, param_n, param_m, n_average, test_list):
     live = Live(table, console=console)
     live.start()
 
+    # Lines in the format read back by parse_output()
+    results = []
+
     for test_file in sorted(test_list):
         # print(test_file + ": ", end="")
 
@@ -124,8 +128,8 @@ def run_benchmarks(console, target, param_n, param_m, n_average, test_list):
             and test_file.find("viper_") != -1
         )
         if skip:
-            print("skip")
-            table.add_row(test_file, *(["skip"] * 6))
+            table.add_row(test_file, *(["skip"] * 3))
+            results.append("{}: SKIP".format(test_file))
             continue
 
         # Create test script
@@ -169,11 +173,15 @@ def run_benchmarks(console, target, param_n, param_m, n_average, test_list):
                 error = "FAIL truth"
 
         if error is not None:
-            print(test_file, error)
-            if error == "no matching params":
-                table.add_row(test_file, *([None] * 3))
+            if error.startswith("SKIP"):
+                table.add_row(test_file, *(["skip"] * 3))
+                results.append("{}: SKIP".format(test_file))
             else:
                 table.add_row(test_file, *(["error"] * 3))
+                # Marked as a crash so that parse_output() leaves it out
+                if not error.startswith("CRASH"):
+                    error = "CRASH: " + error
+                results.append("{}: {}".format(test_file, error))
         else:
             t_avg, t_sd = compute_stats(times)
             r_avg, r_sd = compute_stats(runtimes)
@@ -189,6 +197,11 @@ def run_benchmarks(console, target, param_n, param_m, n_average, test_list):
                 f"{s_avg:.2f}±{100 * s_sd / s_avg:.1f}%",
                 f"{r_avg:.2f}±{100 * r_sd / r_avg:.1f}%",
             )
+            results.append(
+                "{}: {:.2f} {:.4f} {:.2f} {:.4f}".format(
+                    test_file, t_avg, 100 * t_sd / t_avg, s_avg, 100 * s_sd / s_avg
+                )
+            )
             if 0:
                 print("  times: ", times)
                 print("  scores:", scores)
@@ -196,6 +209,8 @@ def run_benchmarks(console, target, param_n, param_m, n_average, test_list):
         live.update(table, refresh=True)
     live.stop()
 
+    return results
+
 
 def parse_output(filename):
     with open(filename) as f:
@@ -205,34 +220,35 @@ def parse_output(filename):
         m = int(m.split("=")[1])
         data = []
         for l in f:
-            if l.find(": ") != -1 and l.find(": skip") == -1 and l.find("CRASH: ") == -1:
+            if ": " in l and ": SKIP" not in l and "CRASH: " not in l:
                 name, values = l.strip().split(": ")
                 values = tuple(float(v) for v in values.split())
                 data.append((name,) + values)
     return n, m, data
 
 
-def compute_diff(file1, file2, diff_score):
+def compute_diff(console, file1, file2, diff_score):
     # Parse output data from previous runs
     n1, m1, d1 = parse_output(file1)
     n2, m2, d2 = parse_output(file2)
 
-    # Print header
     if diff_score:
-        print("diff of scores (higher is better)")
+        title = "diff of scores (higher is better)"
     else:
-        print("diff of microsecond times (lower is better)")
+        title = "diff of microsecond times (lower is better)"
     if n1 == n2 and m1 == m2:
         hdr = "N={} M={}".format(n1, m1)
     else:
         hdr = "N={} M={} vs N={} M={}".format(n1, m1, n2, m2)
-    print(
-        "{:24} {:>10} -> {:>10}   {:>10}   {:>7}% (error%)".format(
-            hdr, file1, file2, "diff", "diff"
-        )
-    )
 
-    # Print entries
+    table = Table(title=title, show_header=True)
+    table.add_column(hdr)
+    table.add_column(file1, justify="right")
+    table.add_column(file2, justify="right")
+    table.add_column("Diff", justify="right")
+    table.add_column("Diff %", justify="right")
+
+    # Entries are sorted by name in both files (run_benchmarks sorts the tests)
     while d1 and d2:
         if d1[0][0] == d2[0][0]:
             # Found entries with matching names
@@ -247,16 +263,26 @@ def compute_diff(file1, file2, diff_score):
             sd_diff = (sd1**2 + sd2**2) ** 0.5
             percent = 100 * av_diff / av1
             percent_sd = 100 * sd_diff / av1
-            print(
-                "{:24} {:10.2f} -> {:10.2f} : {:+10.2f} = {:+7.3f}% (+/-{:.2f}%)".format(
-                    name, av1, av2, av_diff, percent, percent_sd
-                )
+            # Colour changes that are bigger than the noise
+            better = av_diff > 0 if diff_score else av_diff < 0
+            style = None
+            if abs(av_diff) > sd_diff:
+                style = "green" if better else "red"
+            table.add_row(
+                name,
+                f"{av1:.2f}",
+                f"{av2:.2f}",
+                f"{av_diff:+.2f}",
+                f"{percent:+.3f}%±{percent_sd:.2f}%",
+                style=style,
             )
         elif d1[0][0] < d2[0][0]:
             d1.pop(0)
         else:
             d2.pop(0)
 
+    console.print(table)
+
 
 def main():
     cmd_parser = argparse.ArgumentParser(description="Run benchmarks for MicroPython")
@@ -273,6 +299,14 @@ def main():
         "-d", "--device", default="/dev/ttyACM0", help="the device for pyboard.py"
     )
     cmd_parser.add_argument("-a", "--average", default="8", help="averaging number")
+    cmd_parser.add_argument(
+        "-o", "--output", help="save results to this file, for use with -t or -s later"
+    )
+    cmd_parser.add_argument(
+        "--hw",
+        action="store_true",
+        help="run the hardware benchmarks in " + HW_BENCH_SCRIPT_DIR + " (needs -p)",
+    )
     cmd_parser.add_argument(
         "--emit", default="bytecode", help="MicroPython emitter to use (bytecode or native)"
     )
@@ -281,8 +315,10 @@ def main():
     cmd_parser.add_argument("files", nargs="*", help="input test files")
     args = cmd_parser.parse_args()
 
+    console = Console()
+
     if args.diff_time or args.diff_score:
-        compute_diff(args.N[0], args.M[0], args.diff_score)
+        compute_diff(console, args.N[0], args.M[0], args.diff_score)
         sys.exit(0)
 
     # N, M = 50, 25 # esp8266
@@ -298,7 +334,13 @@ def main():
     else:
         target = [MICROPYTHON, "-X", "emit=" + args.emit]
 
-    if len(args.files) == 0:
+    if len(args.files) == 0 and args.hw:
+        tests = sorted(
+            HW_BENCH_SCRIPT_DIR + test_file
+            for test_file in os.listdir(HW_BENCH_SCRIPT_DIR)
+            if test_file.endswith(".py")
+        )
+    elif len(args.files) == 0:
         tests_skip = ("benchrun.py",)
         if M <= 25:
             # These scripts are too big to be compiled by the target
@@ -311,10 +353,16 @@ def main():
     else:
         tests = sorted(args.files)
 
-    console = Console()
-    print("N={} M={} n_average={}".format(N, M, n_average))
+    params = "N={} M={} n_average={}".format(N, M, n_average)
+    print(params)
+
+    results = run_benchmarks(console, target, N, M, n_average, tests)
 
-    run_benchmarks(console, target, N, M, n_average, tests)
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(params + "\n")
+            for line in results:
+                f.write(line + "\n")
 
     if isinstance(target, pyboard.Pyboard):
         target.exit_raw_repl()
@@ -135,6 +135,7 @@ def run_benchmarks(args, target, param_n, param_m, n_average, test_list):
         scores = []
         error = None
         result_out = None
+        norm_out = None
         for _ in range(n_average):
             time, norm, result = run_benchmark_on_target(target, test_script_target)
             if time < 0 or norm < 0:
@@ -142,6 +143,7 @@ def run_benchmarks(args, target, param_n, param_m, n_average, test_list):
                 break
             if result_out is None:
                 result_out = result
+                norm_out = norm
             elif result != result_out:
                 error = "FAIL self"
                 break
@@ -168,11 +170,13 @@ def run_benchmarks(args, target, param_n, param_m, n_average, test_list):
         else:
             t_avg, t_sd = compute_stats(times)
             s_avg, s_sd = compute_stats(scores)
-            print(
-                "{:.2f} {:.4f} {:.2f} {:.4f}".format(
-                    t_avg, 100 * t_sd / t_avg, s_avg, 100 * s_sd / s_avg
-                )
+            line = "{:.2f} {:.4f} {:.2f} {:.4f}".format(
+                t_avg, 100 * t_sd / t_avg, s_avg, 100 * s_sd / s_avg
             )
+            if args.unit_time and norm_out > 0:
+                # Nanoseconds per unit of work, such as a pixel or sample.
+                line += " {:.2f}".format(1000 * t_avg / norm_out)
+            print(line)
             if 0:
                 print("  times: ", times)
                 print("  scores:", scores)
@@ -263,6 +267,12 @@ def main():
     )
     cmd_parser.add_argument("--heapsize", help="heapsize to use (use default if not specified)")
     cmd_parser.add_argument("--via-mpy", action="store_true", help="compile code to .mpy first")
+    cmd_parser.add_argument(
+        "-u",
+        "--unit-time",
+        action="store_true",
+        help="also print nanoseconds per unit of work (such as pixel or sample)",
+    )
     cmd_parser.add_argument("--mpy-cross-flags", default="", help="flags to pass to mpy-cross")
     cmd_parser.add_argument(
         "N", nargs=1, help="N parameter (approximate target CPU frequency in MHz)"
@@ -94,10 +94,13 @@ for x, c in enumerate(filtered_characters):
                 b[overall_bit // 8] |= 1 << (7 - (overall_bit % 8))
 
 
+# filtered_characters is sorted, so these are too, for a binary search at runtime.
 extra_characters = ""
 for c in filtered_characters:
     if c not in visible_ascii:
         extra_characters += c
+if extra_characters and ord(extra_characters[-1]) > 0xFFFF:
+    raise RuntimeError("Characters outside the Basic Multilingual Plane are not supported")
 
 c_file = args.output_c_file
 
@@ -359,6 +362,17 @@ displayio_bitmap_t supervisor_terminal_font_bitmap = {{
 )
 
 
+if extra_characters:
+    c_file.write("const uint16_t supervisor_terminal_font_unicode_characters[] = {\n")
+    for i, c in enumerate(extra_characters):
+        c_file.write("0x{:04x}, ".format(ord(c)))
+        if i % 8 == 7:
+            c_file.write("\n")
+    c_file.write("\n};\n")
+    unicode_characters = "supervisor_terminal_font_unicode_characters"
+else:
+    unicode_characters = "NULL"
+
 c_file.write(
     """\
 const fontio_builtinfont_t supervisor_terminal_font = {{
@@ -366,11 +380,11 @@ const fontio_builtinfont_t supervisor_terminal_font = {{
     .bitmap = &supervisor_terminal_font_bitmap,
     .width = {},
     .height = {},
-    .unicode_characters = (const uint8_t*) "{}",
+    .unicode_characters = {},
     .unicode_characters_len = {}
 }};
 """.format(
-        tile_x, tile_y, extra_characters, len(extra_characters.encode("utf-8"))
+        tile_x, tile_y, unicode_characters, len(extra_characters)
     )
 )
 
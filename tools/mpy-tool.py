@@ -138,6 +138,9 @@ MP_BC_FORMAT_QSTR = 1
 MP_BC_FORMAT_VAR_UINT = 2
 MP_BC_FORMAT_OFFSET = 3
 
+# CIRCUITPY-CHANGE: see py/persistentcode.h
+MPY_FEATURE_SUPERINSTRUCTIONS = 0x80
+
 mp_unary_op_method_name = (
     "__pos__",
     "__neg__",
@@ -293,6 +296,16 @@ class Opcode:
     MP_BC_IMPORT_NAME                 = (MP_BC_BASE_QSTR_O + 0x0b) # qstr
     MP_BC_IMPORT_FROM                 = (MP_BC_BASE_QSTR_O + 0x0c) # qstr
     MP_BC_IMPORT_STAR                 = (MP_BC_BASE_BYTE_E + 0x09)
+
+    # CIRCUITPY-CHANGE: superinstructions
+    MP_BC_LOAD_FAST_LOAD_FAST         = (MP_BC_BASE_RESERVED + 0x00) # extra byte
+    MP_BC_STORE_FAST_LOAD_FAST        = (MP_BC_BASE_RESERVED + 0x01) # extra byte
+    MP_BC_LOAD_FAST_LOAD_ATTR_MULTI   = (MP_BC_BASE_QSTR_O + 0x0d) # qstr
+    MP_BC_BINARY_OP_POP_JUMP_IF       = (MP_BC_BASE_JUMP_E + 0x01) # signed relative bytecode offset; then a byte
+    MP_BC_LOAD_FAST_LOAD_CONST_SMALL_INT = (MP_BC_BASE_BYTE_E + 0x00) # extra byte
+    MP_BC_LOAD_FAST_LOAD_FAST_LOAD_SUBSCR = (MP_BC_BASE_BYTE_E + 0x01) # extra byte
+
+    MP_BC_LOAD_FAST_LOAD_ATTR_MULTI_NUM = 3
     # fmt: on
 
     # Create sets of related opcodes.
@@ -301,6 +314,7 @@ class Opcode:
         MP_BC_JUMP,
         MP_BC_POP_JUMP_IF_TRUE,
         MP_BC_POP_JUMP_IF_FALSE,
+        MP_BC_BINARY_OP_POP_JUMP_IF,
     )
 
     # Create a dict mapping opcode value to opcode name.
@@ -319,6 +333,8 @@ class Opcode:
         mapping[MP_BC_UNARY_OP_MULTI + i] = "UNARY_OP %d %s" % (i, mp_unary_op_method_name[i])
     for i in range(MP_BC_BINARY_OP_MULTI_NUM):
         mapping[MP_BC_BINARY_OP_MULTI + i] = "BINARY_OP %d %s" % (i, mp_binary_op_method_name[i])
+    for i in range(MP_BC_LOAD_FAST_LOAD_ATTR_MULTI_NUM):
+        mapping[MP_BC_LOAD_FAST_LOAD_ATTR_MULTI + i] = "LOAD_FAST_LOAD_ATTR %d" % i
 
     def __init__(self, offset, fmt, opcode_byte, arg, extra_arg):
         self.offset = offset
@@ -1336,7 +1352,10 @@ def read_mpy(filename):
         if header[1] != config.MPY_VERSION:
             raise MPYReadError(filename, "incompatible .mpy version")
         feature_byte = header[2]
-        mpy_native_arch = feature_byte >> 2
+        # CIRCUITPY-CHANGE: the top bit of the feature byte flags superinstructions
+        mpy_native_arch = (feature_byte >> 2) & 0x1F
+        if feature_byte & MPY_FEATURE_SUPERINSTRUCTIONS:
+            config.superinstructions = True
         if mpy_native_arch != MP_NATIVE_ARCH_NONE:
             mpy_sub_version = feature_byte & 3
             if mpy_sub_version != config.MPY_SUB_VERSION:
@@ -1417,6 +1436,13 @@ def freeze_mpy(base_qstrs, compiled_modules):
     print("#endif")
     print()
 
+    # CIRCUITPY-CHANGE
+    if config.superinstructions:
+        print("#if !MICROPY_OPT_BC_SUPERINSTRUCTIONS")
+        print('#error "frozen bytecode uses superinstructions, enable MICROPY_OPT_BC_SUPERINSTRUCTIONS"')
+        print("#endif")
+        print()
+
     if config.MICROPY_LONGINT_IMPL == config.MICROPY_LONGINT_IMPL_MPZ:
         print("#if MPZ_DIG_SIZE != %u" % config.MPZ_DIG_SIZE)
         print('#error "incompatible MPZ_DIG_SIZE"')
@@ -1488,6 +1514,9 @@ def freeze_mpy(base_qstrs, compiled_modules):
     print("    %u, // used entries" % len(new))
     print("    (qstr_hash_t *)mp_qstr_frozen_const_hashes,")
     print("    (qstr_len_t *)mp_qstr_frozen_const_lengths,")
+    # CIRCUITPY-CHANGE: frozen qstr pools are searched without an index
+    print("    NULL, // no index")
+    print("    0,")
     print("    {")
     for _, _, qstr, qbytes in new:
         print('        "%s",' % qstrutil.escape_bytes(qstr, qbytes))
@@ -1665,7 +1694,8 @@ def merge_mpy(compiled_modules, output_file):
         main_cm_idx = None
         for idx, cm in enumerate(compiled_modules):
             feature_byte = cm.header[2]
-            mpy_native_arch = feature_byte >> 2
+            # CIRCUITPY-CHANGE
+            mpy_native_arch = (feature_byte >> 2) & 0x1F
             if mpy_native_arch:
                 # Must use qstr_table and obj_table from this raw_code
                 if main_cm_idx is not None:
@@ -1679,6 +1709,9 @@ def merge_mpy(compiled_modules, output_file):
         header[0] = ord("C")
         header[1] = config.MPY_VERSION
         header[2] = config.native_arch << 2 | config.MPY_SUB_VERSION if config.native_arch else 0
+        # CIRCUITPY-CHANGE
+        if config.superinstructions:
+            header[2] |= MPY_FEATURE_SUPERINSTRUCTIONS
         header[3] = config.mp_small_int_bits
         merged_mpy.extend(header)
 
@@ -1776,6 +1809,8 @@ def main():
     }[args.mlongint_impl]
     config.MPZ_DIG_SIZE = args.mmpz_dig_size
     config.native_arch = MP_NATIVE_ARCH_NONE
+    # CIRCUITPY-CHANGE: set when any input .mpy uses superinstructions
+    config.superinstructions = False
 
     # set config values for qstrs, and get the existing base set of qstrs
     if args.qstr_header:
@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2014 MicroPython & CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+#
+# SPDX-License-Identifier: MIT
+
+"""Compress .mpy files so that they take less flash and load with fewer reads.
+
+A compressed .mpy starts with b"Z" instead of b"C", followed by the other three
+bytes of the original header, one byte giving the deflate window bits, and then
+the rest of the original file as a raw deflate stream. Boards built with
+MICROPY_PERSISTENT_CODE_LOAD_COMPRESSED import them like any other .mpy, using
+a buffer of 2 ** window bits bytes while loading.
+"""
+
+import argparse
+import zlib
+
+
+def compress(data, wbits=12):
+    if data[:1] == b"Z":
+        return data
+    if data[:1] != b"C" or len(data) < 4:
+        raise ValueError("not a CircuitPython .mpy file")
+    compressor = zlib.compressobj(9, zlib.DEFLATED, -wbits)
+    body = compressor.compress(data[4:]) + compressor.flush()
+    return b"Z" + data[1:4] + bytes([wbits]) + body
+
+
+def main():
+    argparser = argparse.ArgumentParser(description="Compress .mpy files in place")
+    argparser.add_argument(
+        "-w",
+        "--wbits",
+        type=int,
+        default=12,
+        choices=range(9, 16),
+        help="deflate window bits, which sets the RAM needed to load (default: 12)",
+    )
+    argparser.add_argument("files", nargs="+", help=".mpy files to compress")
+    args = argparser.parse_args()
+
+    for filename in args.files:
+        with open(filename, "rb") as f:
+            data = f.read()
+        compressed = compress(data, args.wbits)
+        with open(filename, "wb") as f:
+            f.write(compressed)
+        print(f"{filename}: {len(data)} -> {len(compressed)} bytes")
+
+
+if __name__ == "__main__":
+    main()